@@ -0,0 +1,320 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "replay_dataset.hpp"
+
+#include <autoware_utils_geometry/boost_polygon_utils.hpp>
+#include <autoware_utils_geometry/frenet_projector.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
+#include <autoware_utils_geometry/path_profile.hpp>
+#include <autoware_utils_geometry/resample.hpp>
+#include <autoware_utils_math/accumulator.hpp>
+#include <autoware_utils_math/hdr_histogram.hpp>
+#include <autoware_utils_math/unit_conversion.hpp>
+#include <autoware_utils_pcl/range_image.hpp>
+#include <autoware_utils_pcl/transforms.hpp>
+#include <autoware_utils_pcl/voxel_grid.hpp>
+#include <autoware_utils_system/stop_watch.hpp>
+#include <autoware_utils_tf/transform_window.hpp>
+#include <rclcpp/time.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Runs the messages of a replay dataset through the geometry, PCL and tf utilities and writes the
+// times of each stage as JSON, so that the releases are compared on the sizes of real traffic:
+//
+//   replay_benchmark <dataset> [--repeat N] [--output report.json]
+//                    [--parent-frame map] [--child-frame base_link]
+//
+// The dataset is recorded by replay_recorder. Each stage is timed per message, and its report has
+// the number of calls, the number of items processed, e.g. objects or points, and the statistics
+// of the times in milliseconds.
+namespace
+{
+using autoware_utils::replay::Kind;
+
+struct Options
+{
+  std::string dataset;
+  std::string output;
+  int repeat = 10;
+  std::string parent_frame = "map";
+  std::string child_frame = "base_link";
+};
+
+struct Dataset
+{
+  std::vector<autoware_planning_msgs::msg::Trajectory> trajectories;
+  std::vector<autoware_perception_msgs::msg::PredictedObjects> objects;
+  std::vector<sensor_msgs::msg::PointCloud2> clouds;
+  std::vector<tf2_msgs::msg::TFMessage> tfs;
+};
+
+Dataset load(const std::string & path)
+{
+  Dataset dataset;
+  autoware_utils::replay::DatasetReader reader(path);
+  rclcpp::SerializedMessage message;
+  Kind kind{};
+  while (reader.next(kind, message)) {
+    using autoware_utils::replay::deserialize;
+    switch (kind) {
+      case Kind::trajectory:
+        dataset.trajectories.push_back(
+          deserialize<autoware_planning_msgs::msg::Trajectory>(message));
+        break;
+      case Kind::objects:
+        dataset.objects.push_back(
+          deserialize<autoware_perception_msgs::msg::PredictedObjects>(message));
+        break;
+      case Kind::pointcloud:
+        dataset.clouds.push_back(deserialize<sensor_msgs::msg::PointCloud2>(message));
+        break;
+      case Kind::tf:
+        dataset.tfs.push_back(deserialize<tf2_msgs::msg::TFMessage>(message));
+        break;
+      default:
+        // the kinds of later versions of the recorder are skipped
+        break;
+    }
+  }
+  return dataset;
+}
+
+/// @brief times of a stage in milliseconds, and the number of items it processed
+class Stage
+{
+public:
+  explicit Stage(std::string name) : name_(std::move(name)) {}
+
+  /// @brief time a call of the stage processing the given number of items
+  template <class F>
+  void measure(const std::size_t items, F && function)
+  {
+    stop_watch_.tic();
+    function();
+    const double time = stop_watch_.toc();
+    times_.add(time);
+    histogram_.record(time);
+    items_ += items;
+  }
+
+  void write(std::ostream & os) const
+  {
+    os << "    \"" << name_ << "\": {\"calls\": " << times_.count() << ", \"items\": " << items_;
+    if (times_.count() != 0) {
+      os << ", \"mean_ms\": " << static_cast<double>(times_.mean())
+         << ", \"stddev_ms\": " << static_cast<double>(times_.stddev())
+         << ", \"min_ms\": " << times_.min() << ", \"max_ms\": " << times_.max()
+         << ", \"p50_ms\": " << histogram_.quantile(0.5)
+         << ", \"p90_ms\": " << histogram_.quantile(0.9)
+         << ", \"p99_ms\": " << histogram_.quantile(0.99);
+    }
+    os << "}";
+  }
+
+private:
+  std::string name_;
+  autoware_utils_system::StopWatch<std::chrono::milliseconds, std::chrono::nanoseconds> stop_watch_;
+  autoware_utils_math::Accumulator<double> times_;
+  // up to 10 s with 3 significant digits and a resolution of 1 us
+  autoware_utils_math::HdrHistogram histogram_{10000.0, 3, 0.001};
+  std::size_t items_ = 0;
+};
+
+std::string escape(const std::string & text)
+{
+  std::string escaped;
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+void run(const Options & options)
+{
+  const Dataset dataset = load(options.dataset);
+
+  Stage to_polygon2d("geometry/to_polygon2d");
+  Stage path_profile("geometry/path_profile");
+  Stage frenet_project("geometry/frenet_project");
+  Stage resample("geometry/resample_poses");
+  Stage window_add("tf/transform_window_add");
+  Stage voxel_grid("pcl/voxel_grid");
+  Stage range_image("pcl/range_image");
+  Stage transform("pcl/transform_pointcloud");
+
+  autoware_utils_geometry::PolygonArray2d polygons;
+  autoware_utils_geometry::PathProfile profile;
+  autoware_utils_geometry::FrenetProjector projector;
+  std::vector<autoware_utils_geometry::FrenetPoint> frenet_points;
+  std::vector<double> arc_lengths;
+  std::vector<geometry_msgs::msg::Pose> resampled;
+  autoware_utils_tf::TransformWindow window;
+  autoware_utils_pcl::VoxelGrid voxel_filter(0.1f);
+  // the rings of a 64 channels lidar with a resolution of 0.2 deg
+  autoware_utils_pcl::RangeImage image(
+    64, static_cast<float>(autoware_utils_math::deg2rad(0.2)),
+    static_cast<float>(autoware_utils_math::deg2rad(-25.0)),
+    static_cast<float>(autoware_utils_math::deg2rad(15.0)));
+  sensor_msgs::msg::PointCloud2 cloud_out;
+
+  // the positions of the objects of the dataset, projected on the trajectories in turn
+  std::vector<std::vector<geometry_msgs::msg::Point>> positions;
+  for (const auto & objects : dataset.objects) {
+    auto & points = positions.emplace_back();
+    for (const auto & object : objects.objects) {
+      points.push_back(object.kinematics.initial_pose_with_covariance.pose.position);
+    }
+  }
+
+  for (int r = 0; r < options.repeat; ++r) {
+    for (const auto & objects : dataset.objects) {
+      to_polygon2d.measure(
+        objects.objects.size(), [&] { autoware_utils_geometry::to_polygon2d(objects, polygons); });
+    }
+
+    for (std::size_t i = 0; i < dataset.trajectories.size(); ++i) {
+      const auto & points = dataset.trajectories[i].points;
+      path_profile.measure(points.size(), [&] { profile.build(points); });
+      if (!positions.empty()) {
+        const auto & objects = positions[i % positions.size()];
+        frenet_project.measure(objects.size(), [&] {
+          projector.build(points);
+          projector.project(objects, frenet_points);
+        });
+      }
+      // every 0.1 m as the planners resample the trajectories
+      arc_lengths.clear();
+      for (double s = 0.0; s < profile.length(); s += 0.1) {
+        arc_lengths.push_back(s);
+      }
+      resample.measure(arc_lengths.size(), [&] {
+        autoware_utils_geometry::resample_poses(points, arc_lengths, resampled);
+      });
+    }
+
+    window.clear();
+    for (const auto & tf : dataset.tfs) {
+      for (const auto & transform : tf.transforms) {
+        if (
+          transform.header.frame_id != options.parent_frame ||
+          transform.child_frame_id != options.child_frame) {
+          continue;
+        }
+        const auto stamp = rclcpp::Time(transform.header.stamp).nanoseconds();
+        if (window.empty() || window.end_ns() < stamp) {
+          window_add.measure(1, [&] { window.add(stamp, transform.transform); });
+        }
+      }
+    }
+
+    for (const auto & cloud : dataset.clouds) {
+      const std::size_t size = static_cast<std::size_t>(cloud.width) * cloud.height;
+      voxel_grid.measure(size, [&] { voxel_filter.filter(cloud, cloud_out); });
+      range_image.measure(size, [&] { image.project(cloud); });
+      if (!window.empty()) {
+        transform.measure(size, [&] {
+          autoware_utils_pcl::transform_pointcloud(
+            cloud, cloud_out, window.matrix_at(rclcpp::Time(cloud.header.stamp)));
+        });
+      }
+    }
+  }
+
+  std::ofstream file;
+  if (!options.output.empty()) {
+    file.open(options.output);
+    if (!file) {
+      throw std::runtime_error("Cannot open the report " + options.output + ".");
+    }
+  }
+  std::ostream & os = options.output.empty() ? std::cout : file;
+  os << "{\n";
+  os << "  \"dataset\": \"" << escape(options.dataset) << "\",\n";
+  os << "  \"repeat\": " << options.repeat << ",\n";
+  os << "  \"messages\": {\"trajectory\": " << dataset.trajectories.size()
+     << ", \"objects\": " << dataset.objects.size() << ", \"pointcloud\": " << dataset.clouds.size()
+     << ", \"tf\": " << dataset.tfs.size() << "},\n";
+  os << "  \"stages\": {\n";
+  const Stage * stages[] = {&to_polygon2d, &path_profile, &frenet_project, &resample,
+                            &window_add,   &voxel_grid,   &range_image,    &transform};
+  for (std::size_t i = 0; i < std::size(stages); ++i) {
+    stages[i]->write(os);
+    os << (i + 1 < std::size(stages) ? ",\n" : "\n");
+  }
+  os << "  }\n}\n";
+}
+
+bool parse(const int argc, char ** argv, Options & options)
+{
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--repeat" && has_value) {
+      options.repeat = std::stoi(argv[++i]);
+    } else if (arg == "--output" && has_value) {
+      options.output = argv[++i];
+    } else if (arg == "--parent-frame" && has_value) {
+      options.parent_frame = argv[++i];
+    } else if (arg == "--child-frame" && has_value) {
+      options.child_frame = argv[++i];
+    } else if (options.dataset.empty() && arg.rfind("--", 0) != 0) {
+      options.dataset = arg;
+    } else {
+      return false;
+    }
+  }
+  return !options.dataset.empty() && 0 < options.repeat;
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  Options options;
+  if (!parse(argc, argv, options)) {
+    std::cerr << "usage: replay_benchmark <dataset> [--repeat N] [--output report.json] "
+                 "[--parent-frame map] [--child-frame base_link]"
+              << std::endl;
+    return 1;
+  }
+  try {
+    run(options);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef REPLAY_DATASET_HPP_
+#define REPLAY_DATASET_HPP_
+
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+// A replay dataset is a file of messages serialized by rclcpp, in the order they were received:
+// a magic and a version, then for each message its kind, the size of its CDR bytes and the bytes.
+namespace autoware_utils::replay
+{
+enum class Kind : std::uint8_t {
+  trajectory = 1,  //!< autoware_planning_msgs/msg/Trajectory
+  objects = 2,     //!< autoware_perception_msgs/msg/PredictedObjects
+  pointcloud = 3,  //!< sensor_msgs/msg/PointCloud2
+  tf = 4,          //!< tf2_msgs/msg/TFMessage
+};
+
+constexpr char magic[8] = {'A', 'W', 'R', 'E', 'P', 'L', 'A', 'Y'};
+constexpr std::uint32_t version = 1;
+
+/// @brief writer of the serialized messages to a dataset file
+class DatasetWriter
+{
+public:
+  /// @throw std::runtime_error if the file cannot be opened
+  explicit DatasetWriter(const std::string & path) : file_(path, std::ios::binary)
+  {
+    if (!file_) {
+      throw std::runtime_error("Cannot open the dataset " + path + ".");
+    }
+    file_.write(magic, sizeof(magic));
+    write_value(version);
+  }
+
+  void write(const Kind kind, const rclcpp::SerializedMessage & message)
+  {
+    const auto & raw = message.get_rcl_serialized_message();
+    write_value(kind);
+    write_value(static_cast<std::uint32_t>(raw.buffer_length));
+    file_.write(
+      reinterpret_cast<const char *>(raw.buffer), static_cast<std::streamsize>(raw.buffer_length));
+  }
+
+  template <class T>
+  void write(const Kind kind, const T & message)
+  {
+    rclcpp::SerializedMessage serialized;
+    rclcpp::Serialization<T>().serialize_message(&message, &serialized);
+    write(kind, serialized);
+  }
+
+  void flush() { file_.flush(); }
+
+private:
+  template <class T>
+  void write_value(const T & value)
+  {
+    file_.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  std::ofstream file_;
+};
+
+/// @brief reader of the serialized messages of a dataset file, one by one
+class DatasetReader
+{
+public:
+  /// @throw std::runtime_error if the file cannot be opened or is not a dataset of this version
+  explicit DatasetReader(const std::string & path) : file_(path, std::ios::binary)
+  {
+    char header[sizeof(magic)];
+    std::uint32_t file_version = 0;
+    if (
+      !file_.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0 ||
+      !read_value(file_version) || file_version != version) {
+      throw std::runtime_error("The file " + path + " is not a replay dataset.");
+    }
+  }
+
+  /// @brief read the next message, reusing the buffer of the serialized message
+  /// @return false at the end of the file
+  /// @throw std::runtime_error if the file is truncated
+  bool next(Kind & kind, rclcpp::SerializedMessage & message)
+  {
+    std::uint32_t size = 0;
+    if (!read_value(kind)) {
+      return false;
+    }
+    if (!read_value(size)) {
+      throw std::runtime_error("The replay dataset is truncated.");
+    }
+    message.reserve(size);
+    auto & raw = message.get_rcl_serialized_message();
+    if (!file_.read(reinterpret_cast<char *>(raw.buffer), size)) {
+      throw std::runtime_error("The replay dataset is truncated.");
+    }
+    raw.buffer_length = size;
+    return true;
+  }
+
+private:
+  template <class T>
+  bool read_value(T & value)
+  {
+    return static_cast<bool>(file_.read(reinterpret_cast<char *>(&value), sizeof(value)));
+  }
+
+  std::ifstream file_;
+};
+
+template <class T>
+T deserialize(const rclcpp::SerializedMessage & message)
+{
+  T result;
+  rclcpp::Serialization<T>().deserialize_message(&message, &result);
+  return result;
+}
+
+}  // namespace autoware_utils::replay
+
+#endif  // REPLAY_DATASET_HPP_
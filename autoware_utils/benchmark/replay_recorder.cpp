@@ -0,0 +1,84 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "replay_dataset.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Records the messages of the inputs of the replay benchmark, remapped to the topics of a vehicle,
+// as a replay dataset. The messages are written as received, without deserializing them.
+namespace
+{
+using autoware_utils::replay::Kind;
+
+class ReplayRecorder : public rclcpp::Node
+{
+public:
+  ReplayRecorder()
+  : Node("replay_recorder"),
+    writer_(declare_parameter<std::string>("output", "replay.dataset")),
+    max_messages_(declare_parameter<int64_t>("max_messages", 1000))
+  {
+    subscribe<autoware_planning_msgs::msg::Trajectory>(
+      "~/input/trajectory", rclcpp::QoS(1), Kind::trajectory);
+    subscribe<autoware_perception_msgs::msg::PredictedObjects>(
+      "~/input/objects", rclcpp::QoS(1), Kind::objects);
+    subscribe<sensor_msgs::msg::PointCloud2>(
+      "~/input/pointcloud", rclcpp::SensorDataQoS(), Kind::pointcloud);
+    subscribe<tf2_msgs::msg::TFMessage>("/tf", rclcpp::QoS(100), Kind::tf);
+  }
+
+private:
+  template <class T>
+  void subscribe(const std::string & topic, const rclcpp::QoS & qos, const Kind kind)
+  {
+    subscriptions_.push_back(create_subscription<T>(
+      topic, qos, [this, kind](const std::shared_ptr<rclcpp::SerializedMessage> message) {
+        // at most max_messages of each kind, so that the dataset stays small
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (counts_[kind] < max_messages_) {
+          ++counts_[kind];
+          writer_.write(kind, *message);
+        }
+      }));
+  }
+
+  std::mutex mutex_;
+  autoware_utils::replay::DatasetWriter writer_;
+  int64_t max_messages_;
+  std::map<Kind, int64_t> counts_;
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions_;
+};
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  rclcpp::spin(std::make_shared<ReplayRecorder>());
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,106 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__CHROME_TRACE_WRITER_HPP_
+#define AUTOWARE_UTILS_DEBUG__CHROME_TRACE_WRITER_HPP_
+
+#include "autoware_utils_debug/time_keeper.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief Writer of the trees of TimeKeeper as trace events in the Chrome JSON format
+ *
+ * Each node is written as a complete event with its start time, duration, thread and comment, so
+ * that chrome://tracing or https://ui.perfetto.dev show the cycles on a timeline. The events are
+ * buffered in memory and the file is rotated when it exceeds a size: the previous files are
+ * renamed with the suffixes .1, .2, etc., the largest being the oldest. The writer can be shared
+ * by several TimeKeeper objects. Add it with TimeKeeper::add_reporter().
+ */
+class ChromeTraceWriter
+{
+public:
+  /**
+   * @brief Construct a new ChromeTraceWriter object, truncating the file
+   *
+   * @param path Path of the file
+   * @param max_file_size Size in bytes above which the file is rotated
+   * @param max_files Number of files kept, including the one being written
+   * @param buffer_size Size in bytes of the events buffered before being written to the file
+   * @throw std::invalid_argument if max_files is 0
+   * @throw std::runtime_error if the file cannot be opened
+   */
+  explicit ChromeTraceWriter(
+    const std::string & path, size_t max_file_size = 64 * 1024 * 1024, size_t max_files = 4,
+    size_t buffer_size = 64 * 1024);
+
+  /**
+   * @brief Destroy the ChromeTraceWriter object, writing the buffered events and closing the file
+   */
+  ~ChromeTraceWriter();
+
+  ChromeTraceWriter(const ChromeTraceWriter &) = delete;
+  ChromeTraceWriter & operator=(const ChromeTraceWriter &) = delete;
+
+  /**
+   * @brief Write the nodes of a tree, the subtrees of other threads with their thread index
+   *
+   * @param root Root node of the tree
+   */
+  void write(const ProcessingTimeNode & root);
+
+  /**
+   * @brief Write the nodes of a tree kept in an arena
+   *
+   * @param arena Tree of the cycle
+   */
+  void write(const ProcessingTimeArena & arena);
+
+  /**
+   * @brief Write the buffered events to the file
+   */
+  void flush();
+
+private:
+  void write_node(const ProcessingTimeNode & node, size_t thread_index);
+  void append_event(
+    const std::string & name, std::chrono::steady_clock::time_point start_time,
+    double processing_time, size_t thread_index, const std::string & comment);
+  void end_cycle();
+  void open();
+  void close();
+  void rotate();
+
+  const std::string path_;      //!< Path of the file being written
+  const size_t max_file_size_;  //!< Size in bytes above which the file is rotated
+  const size_t max_files_;      //!< Number of files kept
+  const size_t buffer_size_;    //!< Size in bytes of the buffer
+  const int pid_;               //!< Process id of the events
+  std::mutex mutex_;            //!< Mutex of the buffer and the file
+  std::string buffer_;          //!< Events not written yet
+  std::ofstream file_;          //!< File being written
+  size_t file_size_{0};         //!< Bytes written to the file
+  bool first_event_{true};      //!< Whether no event has been written to the file
+};
+
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__CHROME_TRACE_WRITER_HPP_
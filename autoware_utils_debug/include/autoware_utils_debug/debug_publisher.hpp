@@ -16,14 +16,18 @@
 #define AUTOWARE_UTILS_DEBUG__DEBUG_PUBLISHER_HPP_
 
 #include "autoware_utils_debug/debug_traits.hpp"
+#include "autoware_utils_debug/publish_if_subscribed.hpp"
 
 #include <rclcpp/publisher_base.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <rosidl_runtime_cpp/traits.hpp>
 
+#include <atomic>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace autoware_utils_debug
 {
@@ -47,16 +51,45 @@ class DebugPublisher
 public:
   explicit DebugPublisher(rclcpp::Node * node, const char * ns) : node_(node), ns_(ns) {}
 
+  /**
+   * @brief Get the publisher of a topic, created at the first call, to publish without looking up
+   * its name on every message
+   *
+   * @param name Name of the topic under the namespace
+   * @param qos QoS of the publisher, used only if it is created
+   * @return Publisher of the topic, shared with publish()
+   * @throw std::invalid_argument if the topic was registered or published with another type
+   */
   template <
     class T,
     std::enable_if_t<rosidl_generator_traits::is_message<T>::value, std::nullptr_t> = nullptr>
-  void publish(const std::string & name, const T & data, const rclcpp::QoS & qos = rclcpp::QoS(1))
+  typename rclcpp::Publisher<T>::SharedPtr register_topic(
+    const std::string & name, const rclcpp::QoS & qos = rclcpp::QoS(1))
   {
-    if (pub_map_.count(name) == 0) {
-      pub_map_[name] = node_->create_publisher<T>(std::string(ns_) + "/" + name, qos);
+    auto it = pub_map_.find(name);
+    if (it == pub_map_.end()) {
+      it = pub_map_.emplace(name, node_->create_publisher<T>(std::string(ns_) + "/" + name, qos))
+             .first;
+    }
+    auto publisher = std::dynamic_pointer_cast<rclcpp::Publisher<T>>(it->second);
+    if (!publisher) {
+      throw std::invalid_argument("The topic " + name + " is published with another type.");
     }
+    return publisher;
+  }
 
-    std::dynamic_pointer_cast<rclcpp::Publisher<T>>(pub_map_.at(name))->publish(data);
+  template <
+    class T,
+    std::enable_if_t<rosidl_generator_traits::is_message<T>::value, std::nullptr_t> = nullptr>
+  void publish(const std::string & name, const T & data, const rclcpp::QoS & qos = rclcpp::QoS(1))
+  {
+    if (!is_enabled()) {
+      return;
+    }
+    const auto publisher = register_topic<T>(name, qos);
+    if (has_subscribers(*publisher)) {
+      publisher->publish(data);
+    }
   }
 
   template <
@@ -64,13 +97,64 @@ public:
     std::enable_if_t<!rosidl_generator_traits::is_message<T>::value, std::nullptr_t> = nullptr>
   void publish(const std::string & name, const T & data, const rclcpp::QoS & qos = rclcpp::QoS(1))
   {
-    publish(name, debug_publisher::to_debug_msg<T_msg>(data, node_->now()), qos);
+    publish_if_subscribed<T_msg>(
+      name,
+      [&](T_msg & msg) {
+        msg.stamp = node_->now();
+        msg.data = data;
+      },
+      qos);
   }
 
+  /**
+   * @brief Build and publish a message only if the topic has subscribers
+   *
+   * @param name Name of the topic under the namespace
+   * @param build Callable filling the message, given as T &
+   * @param qos QoS of the publisher, used only if it is created
+   * @return Whether the message was built and published
+   */
+  template <class T, class Builder>
+  bool publish_if_subscribed(
+    const std::string & name, Builder && build, const rclcpp::QoS & qos = rclcpp::QoS(1))
+  {
+    if (!is_enabled()) {
+      return false;
+    }
+    return autoware_utils_debug::publish_if_subscribed(
+      *register_topic<T>(name, qos), std::forward<Builder>(build));
+  }
+
+  /**
+   * @brief Enable or disable the publishing by name at runtime, e.g. from another thread
+   *
+   * @param enabled Whether publish() and publish_if_subscribed() publish
+   */
+  void set_enabled(bool enabled) { enabled_.value.store(enabled, std::memory_order_relaxed); }
+
+  /**
+   * @brief Check whether the publishing by name is enabled
+   */
+  bool is_enabled() const { return enabled_.value.load(std::memory_order_relaxed); }
+
 private:
+  // an atomic flag copied by value, so that the publisher stays copyable
+  struct EnabledFlag
+  {
+    std::atomic<bool> value{true};
+    EnabledFlag() = default;
+    EnabledFlag(const EnabledFlag & other) : value(other.value.load()) {}
+    EnabledFlag & operator=(const EnabledFlag & other)
+    {
+      value.store(other.value.load());
+      return *this;
+    }
+  };
+
   rclcpp::Node * node_;
   const char * ns_;
   std::unordered_map<std::string, std::shared_ptr<rclcpp::PublisherBase>> pub_map_;
+  EnabledFlag enabled_;
 };
 }  // namespace autoware_utils_debug
 
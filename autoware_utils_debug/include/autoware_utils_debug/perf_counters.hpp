@@ -0,0 +1,125 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__PERF_COUNTERS_HPP_
+#define AUTOWARE_UTILS_DEBUG__PERF_COUNTERS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief Values of the hardware counters of a thread, or their difference over a scope
+ */
+struct PerfCounterValues
+{
+  uint64_t cycles{0};         //!< CPU cycles
+  uint64_t instructions{0};   //!< Retired instructions
+  uint64_t cache_misses{0};   //!< Last level cache misses
+  uint64_t branch_misses{0};  //!< Mispredicted branches
+  uint64_t time_enabled{0};   //!< Nanoseconds during which the counters were enabled
+  uint64_t time_running{0};   //!< Nanoseconds during which the counters were counting
+
+  /**
+   * @brief Get the counts from other to this, scaled by the fraction of that interval during which
+   * the counters were counting, as they are multiplexed with other events
+   *
+   * A value which decreases, e.g. from a failed read, gives 0 rather than wrapping around. The
+   * times of the result are the enabled time of the interval, as the counts are scaled.
+   */
+  PerfCounterValues operator-(const PerfCounterValues & other) const
+  {
+    const auto delta = [](const uint64_t end, const uint64_t start) -> uint64_t {
+      return start < end ? end - start : 0;
+    };
+    const uint64_t enabled = delta(time_enabled, other.time_enabled);
+    const uint64_t running = delta(time_running, other.time_running);
+    double scale = 1.0;
+    if (running != 0 && running < enabled) {
+      scale = static_cast<double>(enabled) / static_cast<double>(running);
+    }
+    const auto scaled = [&](const uint64_t end, const uint64_t start) {
+      return static_cast<uint64_t>(static_cast<double>(delta(end, start)) * scale);
+    };
+    return {
+      scaled(cycles, other.cycles),
+      scaled(instructions, other.instructions),
+      scaled(cache_misses, other.cache_misses),
+      scaled(branch_misses, other.branch_misses),
+      enabled,
+      enabled};
+  }
+
+  /**
+   * @brief Get the instructions per cycle, 0 if there is no cycle
+   */
+  double ipc() const
+  {
+    return cycles == 0 ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles);
+  }
+};
+
+/**
+ * @brief Hardware counters of the calling thread, opened with perf_event_open as one group
+ *
+ * The counters exclude the kernel, so they are available with a perf_event_paranoid up to 2. The
+ * values are read unscaled with the times the group was enabled and counting, so that the
+ * difference of two reads is scaled for the interval between them if the group is multiplexed
+ * with other events.
+ */
+class PerfCounters
+{
+public:
+  /**
+   * @brief Open the counters of the calling thread
+   *
+   * @throw std::runtime_error if the counters are not available, e.g. in a virtual machine
+   */
+  PerfCounters();
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters & operator=(const PerfCounters &) = delete;
+
+  /**
+   * @brief Read the counters since they were opened
+   *
+   * @return std::optional<PerfCounterValues> Values of the counters, or nullopt if the read fails
+   */
+  std::optional<PerfCounterValues> read() const;
+
+private:
+  std::array<int, 4> fds_;  //!< File descriptors of the counters, the first being the leader
+};
+
+/**
+ * @brief Read the counters of the calling thread, opened at its first call
+ *
+ * @return std::optional<PerfCounterValues> Values of the counters, or nullopt if they are not
+ * available or the read fails
+ */
+std::optional<PerfCounterValues> thread_perf_counters();
+
+/**
+ * @brief Format the values as "1200 cycles, IPC 1.50, 3 cache misses, 2 branch misses"
+ */
+std::string to_string(const PerfCounterValues & values);
+
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__PERF_COUNTERS_HPP_
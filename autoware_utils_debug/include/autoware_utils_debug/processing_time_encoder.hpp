@@ -0,0 +1,124 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_ENCODER_HPP_
+#define AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_ENCODER_HPP_
+
+#include "autoware_utils_debug/time_keeper.hpp"
+
+#include <rclcpp/publisher.hpp>
+
+#include <autoware_internal_debug_msgs/msg/processing_time_tree.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief Encoder of the trees of TimeKeeper into smaller ProcessingTimeTree messages
+ *
+ * The names of the nodes are interned and replaced by their index, as "#3". The name table is sent
+ * only in the reports after it changes, and every table_period reports for the late subscribers:
+ * the first node of each name in these reports is named "#3:name" instead. The subtrees whose
+ * processing time is below a threshold and the comments can be omitted as well. The messages are
+ * restored by ProcessingTimeTreeDecoder. Add it with TimeKeeper::add_reporter().
+ */
+class ProcessingTimeTreeEncoder
+{
+public:
+  /**
+   * @brief Construct a new ProcessingTimeTreeEncoder object
+   *
+   * @param publisher Publisher of the encoded messages, or nullptr to only call encode()
+   * @param table_period Number of reports after which the name table is sent again, at least 1
+   * @param min_time Processing time in milliseconds below which a subtree is omitted, except the
+   * root
+   * @param keep_comments Whether the comments are kept
+   * @throw std::invalid_argument if table_period is 0
+   */
+  explicit ProcessingTimeTreeEncoder(
+    rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher = nullptr,
+    size_t table_period = 100, double min_time = 0.0, bool keep_comments = true);
+
+  /**
+   * @brief Encode a tree, as returned by ProcessingTimeNode::to_msg()
+   *
+   * @param tree Tree whose nodes are in depth-first order, each after its parent
+   * @param encoded Encoded tree, the storage is reused
+   */
+  void encode(const ProcessingTimeDetail & tree, ProcessingTimeDetail & encoded);
+
+  /**
+   * @brief Encode and publish a tree tracked in ProcessingTimeNode objects
+   *
+   * @param root Root node of the tree
+   */
+  void publish(const ProcessingTimeNode & root);
+
+  /**
+   * @brief Encode and publish a tree kept in an arena
+   *
+   * @param arena Tree of the cycle
+   */
+  void publish(const ProcessingTimeArena & arena);
+
+private:
+  rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher_;
+  const size_t table_period_;
+  const double min_time_;
+  const bool keep_comments_;
+
+  std::unordered_map<std::string, size_t> name_indices_;  //!< Index of each interned name
+  size_t reports_since_table_{0};  //!< Number of reports since the name table was sent
+  std::vector<size_t> node_names_;  //!< Index of the name of each node of the tree being encoded
+  std::vector<int> node_ids_;       //!< Encoded id of each node of the tree, 0 if omitted
+  std::vector<bool> sent_names_;    //!< Whether each name was sent in the current report
+  ProcessingTimeDetail encoded_;    //!< Message reused by publish()
+};
+
+/**
+ * @brief Decoder of the messages of ProcessingTimeTreeEncoder, for the subscribers
+ *
+ * The names sent by the encoder are kept from one message to the next. The messages which are not
+ * encoded, i.e. whose names do not start with '#', are copied as they are.
+ */
+class ProcessingTimeTreeDecoder
+{
+public:
+  /**
+   * @brief Restore the names of an encoded tree
+   *
+   * @param encoded Tree encoded by ProcessingTimeTreeEncoder
+   * @param tree Decoded tree, the storage is reused
+   * @return true if all the names are known, otherwise the unknown names are left encoded, e.g.
+   * until the name table is sent again to a late subscriber
+   */
+  bool decode(const ProcessingTimeDetail & encoded, ProcessingTimeDetail & tree);
+
+  /**
+   * @brief Forget the names, e.g. when the publisher is restarted
+   */
+  void clear() { names_.clear(); }
+
+private:
+  std::vector<std::string> names_;  //!< Names by index, empty if not received yet
+};
+
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_ENCODER_HPP_
@@ -15,13 +15,19 @@
 #ifndef AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_PUBLISHER_HPP_
 #define AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_PUBLISHER_HPP_
 
+#include "autoware_utils_debug/publish_if_subscribed.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
+#include <autoware_internal_debug_msgs/msg/float64_multi_array_stamped.hpp>
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
 
+#include <charconv>
 #include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace autoware_utils_debug
 {
@@ -36,18 +42,21 @@ public:
       node->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>(name, qos);
   }
 
+  /**
+   * @brief Publish the processing times, only if the topic has subscribers
+   */
   void publish(const std::map<std::string, double> & processing_time_map)
   {
-    diagnostic_msgs::msg::DiagnosticStatus status;
-
-    for (const auto & m : processing_time_map) {
-      diagnostic_msgs::msg::KeyValue key_value;
-      key_value.key = m.first;
-      key_value.value = to_string_with_precision(m.second, 3);
-      status.values.push_back(key_value);
-    }
-
-    pub_processing_time_->publish(status);
+    publish_if_subscribed(
+      *pub_processing_time_, [&](diagnostic_msgs::msg::DiagnosticStatus & status) {
+        status.values.reserve(processing_time_map.size());
+        for (const auto & m : processing_time_map) {
+          diagnostic_msgs::msg::KeyValue key_value;
+          key_value.key = m.first;
+          key_value.value = to_string_with_precision(m.second, 3);
+          status.values.push_back(key_value);
+        }
+      });
   }
 
 private:
@@ -62,6 +71,99 @@ private:
     return oss.str();
   }
 };
+
+/**
+ * @brief Publisher of the processing times of a fixed set of keys, registered up front
+ *
+ * The message is kept between the calls, and the values are formatted with std::to_chars, or not
+ * formatted at all in the float64_array format, whose data are in the order of the keys.
+ */
+class FixedKeyProcessingTimePublisher
+{
+public:
+  enum class Format {
+    diagnostic_status,  //!< DiagnosticStatus with the values formatted with 3 decimals
+    float64_array,      //!< Float64MultiArrayStamped with the values in the order of the keys
+  };
+
+  /**
+   * @param node Node creating the publisher
+   * @param keys Keys of the processing times, in the order of publish()
+   * @param name Name of the topic
+   * @param format Type of the messages
+   * @param qos QoS of the publisher
+   */
+  FixedKeyProcessingTimePublisher(
+    rclcpp::Node * node, const std::vector<std::string> & keys,
+    const std::string & name = "~/debug/processing_time_ms",
+    const Format format = Format::diagnostic_status, const rclcpp::QoS & qos = rclcpp::QoS(1))
+  : node_(node), size_(keys.size())
+  {
+    if (format == Format::float64_array) {
+      pub_array_ =
+        node->create_publisher<autoware_internal_debug_msgs::msg::Float64MultiArrayStamped>(
+          name, qos);
+      array_.data.reserve(size_);
+      return;
+    }
+    pub_status_ = node->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>(name, qos);
+    status_.values.resize(size_);
+    for (size_t i = 0; i < size_; ++i) {
+      status_.values[i].key = keys[i];
+    }
+  }
+
+  /**
+   * @brief Get the number of keys
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Publish the processing times, only if the topic has subscribers
+   *
+   * @param processing_times Processing times in the order of the keys
+   * @throw std::invalid_argument if the number of processing times is not the number of keys
+   */
+  void publish(const std::vector<double> & processing_times)
+  {
+    if (processing_times.size() != size_) {
+      throw std::invalid_argument(
+        "The number of processing times " + std::to_string(processing_times.size()) +
+        " differs from the number of keys " + std::to_string(size_) + ".");
+    }
+    if (pub_array_) {
+      if (has_subscribers(*pub_array_)) {
+        array_.stamp = node_->now();
+        array_.data.assign(processing_times.begin(), processing_times.end());
+        pub_array_->publish(array_);
+      }
+      return;
+    }
+    if (!has_subscribers(*pub_status_)) {
+      return;
+    }
+    for (size_t i = 0; i < size_; ++i) {
+      char buffer[32];
+      auto result = std::to_chars(
+        buffer, buffer + sizeof(buffer), processing_times[i], std::chars_format::fixed, 3);
+      if (result.ec != std::errc()) {
+        // too large for the fixed notation, and the shortest representation always fits
+        result = std::to_chars(buffer, buffer + sizeof(buffer), processing_times[i]);
+      }
+      status_.values[i].value.assign(buffer, result.ptr);
+    }
+    pub_status_->publish(status_);
+  }
+
+private:
+  rclcpp::Node * node_;
+  size_t size_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticStatus>::SharedPtr pub_status_;
+  rclcpp::Publisher<autoware_internal_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr
+    pub_array_;
+  diagnostic_msgs::msg::DiagnosticStatus status_;  //!< Message reused by the calls
+  autoware_internal_debug_msgs::msg::Float64MultiArrayStamped array_;  //!< Message reused
+};
 }  // namespace autoware_utils_debug
 
 #endif  // AUTOWARE_UTILS_DEBUG__PROCESSING_TIME_PUBLISHER_HPP_
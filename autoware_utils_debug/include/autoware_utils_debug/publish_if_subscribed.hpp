@@ -0,0 +1,63 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__PUBLISH_IF_SUBSCRIBED_HPP_
+#define AUTOWARE_UTILS_DEBUG__PUBLISH_IF_SUBSCRIBED_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace autoware_utils_debug
+{
+/**
+ * @brief Check whether a publisher has subscribers, in other processes or in this one
+ */
+template <class T>
+bool has_subscribers(const rclcpp::Publisher<T> & publisher)
+{
+  return publisher.get_subscription_count() + publisher.get_intra_process_subscription_count() > 0;
+}
+
+/**
+ * @brief Build and publish a message only if the topic has subscribers
+ *
+ * The message is built in a loaned message if the middleware can loan them, otherwise in a
+ * unique_ptr passed to the intra-process subscriptions without a copy.
+ *
+ * @param publisher Publisher of the topic
+ * @param build Callable filling the message, given as T &
+ * @return Whether the message was built and published
+ */
+template <class T, class Builder>
+bool publish_if_subscribed(rclcpp::Publisher<T> & publisher, Builder && build)
+{
+  if (!has_subscribers(publisher)) {
+    return false;
+  }
+  if (publisher.can_loan_messages()) {
+    auto loaned_msg = publisher.borrow_loaned_message();
+    std::forward<Builder>(build)(loaned_msg.get());
+    publisher.publish(std::move(loaned_msg));
+  } else {
+    auto msg = std::make_unique<T>();
+    std::forward<Builder>(build)(*msg);
+    publisher.publish(std::move(msg));
+  }
+  return true;
+}
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__PUBLISH_IF_SUBSCRIBED_HPP_
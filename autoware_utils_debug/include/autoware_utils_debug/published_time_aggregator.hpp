@@ -0,0 +1,175 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__PUBLISHED_TIME_AGGREGATOR_HPP_
+#define AUTOWARE_UTILS_DEBUG__PUBLISHED_TIME_AGGREGATOR_HPP_
+
+#include <autoware_utils_math/accumulator.hpp>
+#include <autoware_utils_math/quantile.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_internal_msgs/msg/published_time.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief Statistics of the latencies of a hop or a path, in milliseconds
+ */
+struct LatencyStatistics
+{
+  std::string name;  //!< "first topic -> last topic"
+  size_t count{0};
+  double mean{0.0};
+  double max{0.0};
+  double p50{0.0};
+  double p99{0.0};
+};
+
+std::ostream & operator<<(std::ostream & os, const LatencyStatistics & statistics);
+
+/**
+ * @brief Latencies between the publications of messages with the same header stamp on the topics
+ * of a pipeline
+ *
+ * The nodes of the pipeline copy the stamp of their input to their output, so the messages of a
+ * cycle are matched by their stamp. A hop is an edge of the graph, usually from the input to the
+ * output of a node, and a path spans several hops, e.g. from a sensor to a planning output. The
+ * latency is recorded when the second of the two publication times arrives, in any order, and the
+ * publication times of the last stamps are kept for each topic.
+ */
+class LatencyGraph
+{
+public:
+  using Edge = std::pair<std::string, std::string>;  //!< First and last topic
+
+  /**
+   * @param hops Pairs of topics of the hops
+   * @param paths Pairs of the first and last topics of the paths
+   * @param window Number of stamps kept for each topic
+   * @throw std::invalid_argument if the window is 0
+   */
+  LatencyGraph(std::vector<Edge> hops, std::vector<Edge> paths, size_t window = 100);
+
+  /**
+   * @brief Get the topics of the hops and paths, in the order of their indices
+   */
+  const std::vector<std::string> & topics() const { return topics_; }
+
+  /**
+   * @brief Get the index of a topic
+   *
+   * @throw std::invalid_argument if the topic is not in a hop or a path
+   */
+  size_t topic_index(const std::string & topic) const;
+
+  /**
+   * @brief Add a publication of a topic
+   *
+   * @param topic Index of the topic
+   * @param stamp Header stamp of the message in nanoseconds
+   * @param published Time of the publication in nanoseconds
+   */
+  void add(size_t topic, int64_t stamp, int64_t published);
+
+  /**
+   * @brief Get the statistics of the hops, then of the paths
+   */
+  std::vector<LatencyStatistics> statistics() const;
+
+  /**
+   * @brief Clear the statistics, keeping the publication times
+   */
+  void reset();
+
+private:
+  struct Latency
+  {
+    size_t first;
+    size_t last;
+    std::string name;
+    autoware_utils_math::Accumulator<double> accumulator;
+    autoware_utils_math::P2Quantile p50{0.5};
+    autoware_utils_math::P2Quantile p99{0.99};
+  };
+
+  struct Window
+  {
+    std::vector<int64_t> stamps;                     //!< Ring of the stamps kept
+    size_t next{0};                                  //!< Oldest stamp, replaced next
+    std::unordered_map<int64_t, int64_t> published;  //!< Publication time of each stamp
+    std::vector<size_t> latencies;                   //!< Latencies of the topic
+  };
+
+  size_t intern(const std::string & topic);
+  void record(Latency & latency, int64_t stamp);
+
+  size_t window_;
+  std::vector<std::string> topics_;
+  std::unordered_map<std::string, size_t> topic_indices_;
+  std::vector<Window> windows_;
+  std::vector<Latency> latencies_;  //!< Hops, then paths
+};
+
+/**
+ * @brief Subscriber of the published times of the topics of a LatencyGraph, see
+ * PublishedTimePublisher
+ */
+class PublishedTimeAggregator
+{
+public:
+  /**
+   * @param node Node creating the subscriptions
+   * @param hops Pairs of topics of the hops
+   * @param paths Pairs of the first and last topics of the paths
+   * @param window Number of stamps kept for each topic
+   * @param topic_suffix Suffix of the topics of the published times, as in PublishedTimePublisher
+   * @param qos QoS of the subscriptions
+   */
+  PublishedTimeAggregator(
+    rclcpp::Node * node, std::vector<LatencyGraph::Edge> hops,
+    std::vector<LatencyGraph::Edge> paths, size_t window = 100,
+    const std::string & topic_suffix = "/debug/published_time",
+    const rclcpp::QoS & qos = rclcpp::QoS(10));
+
+  /**
+   * @brief Get the statistics of the hops, then of the paths
+   */
+  std::vector<LatencyStatistics> statistics() const;
+
+  /**
+   * @brief Clear the statistics, e.g. after each report
+   */
+  void reset();
+
+private:
+  using PublishedTime = autoware_internal_msgs::msg::PublishedTime;
+
+  mutable std::mutex mutex_;  //!< Mutex of the graph, for the multi-threaded executors
+  LatencyGraph graph_;
+  std::vector<rclcpp::Subscription<PublishedTime>::SharedPtr> subscriptions_;
+};
+
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__PUBLISHED_TIME_AGGREGATOR_HPP_
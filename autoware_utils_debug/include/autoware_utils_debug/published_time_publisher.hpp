@@ -20,41 +20,121 @@
 #include <autoware_internal_msgs/msg/published_time.hpp>
 #include <std_msgs/msg/header.hpp>
 
+#include <chrono>
 #include <cstring>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
 namespace autoware_utils_debug
 {
 
+/**
+ * @brief Publisher of the published time of one output publisher, returned by
+ * PublishedTimePublisher::bind()
+ *
+ * The number of subscribers is checked at most once per period, and the clock is shared with the
+ * PublishedTimePublisher, so a call without subscribers only reads the steady clock.
+ */
+class PublishedTimeHandle
+{
+public:
+  using PublishedTime = autoware_internal_msgs::msg::PublishedTime;
+
+  PublishedTimeHandle(
+    rclcpp::Publisher<PublishedTime>::SharedPtr publisher, rclcpp::Clock::SharedPtr clock,
+    const std::chrono::nanoseconds subscription_check_period)
+  : publisher_(std::move(publisher)),
+    clock_(std::move(clock)),
+    subscription_check_period_(subscription_check_period)
+  {
+  }
+
+  /**
+   * @brief Check whether the published time has subscribers, as of the last check
+   */
+  bool has_subscribers()
+  {
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= next_subscription_check_) {
+      subscribed_ = publisher_->get_subscription_count() > 0;
+      next_subscription_check_ = now + subscription_check_period_;
+    }
+    return subscribed_;
+  }
+
+  void publish_if_subscribed(const rclcpp::Time & stamp)
+  {
+    if (has_subscribers()) {
+      PublishedTime published_time;
+      published_time.header.stamp = stamp;
+      published_time.published_stamp = clock_->now();
+      publisher_->publish(published_time);
+    }
+  }
+
+  void publish_if_subscribed(const std_msgs::msg::Header & header)
+  {
+    if (has_subscribers()) {
+      PublishedTime published_time;
+      published_time.header = header;
+      published_time.published_stamp = clock_->now();
+      publisher_->publish(published_time);
+    }
+  }
+
+private:
+  rclcpp::Publisher<PublishedTime>::SharedPtr publisher_;
+  rclcpp::Clock::SharedPtr clock_;
+  std::chrono::nanoseconds subscription_check_period_;
+  std::chrono::steady_clock::time_point next_subscription_check_{};
+  bool subscribed_{false};
+};
+
 class PublishedTimePublisher
 {
 public:
   explicit PublishedTimePublisher(
     rclcpp::Node * node, std::string publisher_topic_suffix = "/debug/published_time",
     const rclcpp::QoS & qos = rclcpp::QoS(1))
-  : node_(node), publisher_topic_suffix_(std::move(publisher_topic_suffix)), qos_(qos)
+  : node_(node),
+    publisher_topic_suffix_(std::move(publisher_topic_suffix)),
+    qos_(qos),
+    clock_(std::make_shared<rclcpp::Clock>())
+  {
+  }
+
+  /**
+   * @brief Bind to an output publisher once, instead of looking it up on every publish
+   *
+   * @param publisher Output publisher
+   * @param subscription_check_period Period of the checks of the subscribers, which a new
+   * subscriber may wait before receiving the published time
+   * @return Handle publishing the published time of the output publisher
+   */
+  PublishedTimeHandle bind(
+    const rclcpp::PublisherBase::ConstSharedPtr & publisher,
+    const std::chrono::nanoseconds subscription_check_period = std::chrono::seconds(1))
   {
+    return PublishedTimeHandle(
+      get_publisher(publisher->get_gid(), publisher->get_topic_name()), clock_,
+      subscription_check_period);
   }
 
   void publish_if_subscribed(
     const rclcpp::PublisherBase::ConstSharedPtr & publisher, const rclcpp::Time & stamp)
   {
-    const auto & gid_key = publisher->get_gid();
-
-    // if the publisher is not in the map, create a new publisher for published time
-    ensure_publisher_exists(gid_key, publisher->get_topic_name());
-
-    const auto & pub_published_time = publishers_[gid_key];
+    const auto & pub_published_time =
+      get_publisher(publisher->get_gid(), publisher->get_topic_name());
 
     // Check if there are any subscribers, otherwise don't do anything
     if (pub_published_time->get_subscription_count() > 0) {
       PublishedTime published_time;
 
       published_time.header.stamp = stamp;
-      published_time.published_stamp = rclcpp::Clock().now();
+      published_time.published_stamp = clock_->now();
 
       pub_published_time->publish(published_time);
     }
@@ -63,19 +143,15 @@ public:
   void publish_if_subscribed(
     const rclcpp::PublisherBase::ConstSharedPtr & publisher, const std_msgs::msg::Header & header)
   {
-    const auto & gid_key = publisher->get_gid();
-
-    // if the publisher is not in the map, create a new publisher for published time
-    ensure_publisher_exists(gid_key, publisher->get_topic_name());
-
-    const auto & pub_published_time = publishers_[gid_key];
+    const auto & pub_published_time =
+      get_publisher(publisher->get_gid(), publisher->get_topic_name());
 
     // Check if there are any subscribers, otherwise don't do anything
     if (pub_published_time->get_subscription_count() > 0) {
       PublishedTime published_time;
 
       published_time.header = header;
-      published_time.published_stamp = rclcpp::Clock().now();
+      published_time.published_stamp = clock_->now();
 
       pub_published_time->publish(published_time);
     }
@@ -85,6 +161,7 @@ private:
   rclcpp::Node * node_;
   std::string publisher_topic_suffix_;
   rclcpp::QoS qos_;
+  rclcpp::Clock::SharedPtr clock_;  // system clock, as the one constructed for each publish before
 
   using PublishedTime = autoware_internal_msgs::msg::PublishedTime;
 
@@ -97,13 +174,19 @@ private:
     }
   };
 
-  // ensure that the publisher exists in publisher_ map, if not, create a new one
-  void ensure_publisher_exists(const rmw_gid_t & gid_key, const std::string & topic_name)
+  // get the publisher in publisher_ map, creating it if it does not exist
+  const rclcpp::Publisher<PublishedTime>::SharedPtr & get_publisher(
+    const rmw_gid_t & gid_key, const std::string & topic_name)
   {
-    if (publishers_.find(gid_key) == publishers_.end()) {
-      publishers_[gid_key] =
-        node_->create_publisher<PublishedTime>(topic_name + publisher_topic_suffix_, qos_);
+    auto it = publishers_.find(gid_key);
+    if (it == publishers_.end()) {
+      it = publishers_
+             .emplace(
+               gid_key,
+               node_->create_publisher<PublishedTime>(topic_name + publisher_topic_suffix_, qos_))
+             .first;
     }
+    return it->second;
   }
 
   // store them for each different publisher of the node
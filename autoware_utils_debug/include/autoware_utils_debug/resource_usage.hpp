@@ -0,0 +1,120 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__RESOURCE_USAGE_HPP_
+#define AUTOWARE_UTILS_DEBUG__RESOURCE_USAGE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief CPU time and heap allocations of the calling thread, or their difference over a scope
+ *
+ * The allocations are counted only in the executables which use
+ * AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS(), and are 0 otherwise.
+ */
+struct ResourceUsage
+{
+  double cpu_time{0.0};         //!< CPU time of the thread in milliseconds
+  uint64_t allocations{0};      //!< Number of calls to operator new
+  uint64_t allocated_bytes{0};  //!< Bytes requested from operator new
+
+  ResourceUsage operator-(const ResourceUsage & other) const
+  {
+    return {
+      cpu_time - other.cpu_time, allocations - other.allocations,
+      allocated_bytes - other.allocated_bytes};
+  }
+};
+
+/**
+ * @brief Get the resource usage of the calling thread since it started
+ *
+ * The CPU time is read from CLOCK_THREAD_CPUTIME_ID, so the time the thread waits or is preempted
+ * is not included.
+ */
+ResourceUsage thread_resource_usage() noexcept;
+
+/**
+ * @brief Count an allocation of the calling thread, called by the operator new of
+ * AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS()
+ *
+ * @param bytes Size of the allocation
+ */
+void count_allocation(size_t bytes) noexcept;
+
+/**
+ * @brief Format a resource usage as "cpu 1.2ms, 3 allocs, 128 B"
+ */
+std::string to_string(const ResourceUsage & usage);
+
+}  // namespace autoware_utils_debug
+
+/**
+ * @brief Replace the global operator new and delete with malloc and free which count the
+ * allocations of each thread
+ *
+ * Use it once at namespace scope in a source file of the executable. The aligned variants are not
+ * replaced, so the allocations of over-aligned types are not counted. The operators are not
+ * inlined, otherwise GCC warns about malloc and free being mixed with new and delete.
+ */
+#define AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS()                                                   \
+  __attribute__((noinline)) void * operator new(std::size_t size)                                  \
+  {                                                                                                \
+    autoware_utils_debug::count_allocation(size);                                                  \
+    if (void * ptr = std::malloc(size == 0 ? 1 : size)) {                                          \
+      return ptr;                                                                                  \
+    }                                                                                              \
+    throw std::bad_alloc();                                                                        \
+  }                                                                                                \
+  __attribute__((noinline)) void * operator new[](std::size_t size)                                \
+  {                                                                                                \
+    return operator new(size);                                                                     \
+  }                                                                                                \
+  __attribute__((noinline)) void * operator new(std::size_t size, const std::nothrow_t &) noexcept \
+  {                                                                                                \
+    autoware_utils_debug::count_allocation(size);                                                  \
+    return std::malloc(size == 0 ? 1 : size);                                                      \
+  }                                                                                                \
+  __attribute__((noinline)) void * operator new[](                                                 \
+    std::size_t size, const std::nothrow_t & tag) noexcept                                         \
+  {                                                                                                \
+    return operator new(size, tag);                                                                \
+  }                                                                                                \
+  __attribute__((noinline)) void operator delete(void * ptr) noexcept { std::free(ptr); }          \
+  __attribute__((noinline)) void operator delete[](void * ptr) noexcept { std::free(ptr); }        \
+  __attribute__((noinline)) void operator delete(void * ptr, std::size_t) noexcept                 \
+  {                                                                                                \
+    std::free(ptr);                                                                                \
+  }                                                                                                \
+  __attribute__((noinline)) void operator delete[](void * ptr, std::size_t) noexcept               \
+  {                                                                                                \
+    std::free(ptr);                                                                                \
+  }                                                                                                \
+  __attribute__((noinline)) void operator delete(void * ptr, const std::nothrow_t &) noexcept      \
+  {                                                                                                \
+    std::free(ptr);                                                                                \
+  }                                                                                                \
+  __attribute__((noinline)) void operator delete[](void * ptr, const std::nothrow_t &) noexcept    \
+  {                                                                                                \
+    std::free(ptr);                                                                                \
+  }
+
+#endif  // AUTOWARE_UTILS_DEBUG__RESOURCE_USAGE_HPP_
@@ -0,0 +1,104 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DEBUG__TIME_BUDGET_WATCHDOG_HPP_
+#define AUTOWARE_UTILS_DEBUG__TIME_BUDGET_WATCHDOG_HPP_
+
+#include "autoware_utils_debug/time_keeper.hpp"
+
+#include <autoware_utils_diagnostics/diagnostics_interface.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace autoware_utils_debug
+{
+
+/**
+ * @brief Watchdog of the processing times reported by TimeKeeper, raising diagnostics
+ *
+ * Each scope with a budget is checked on each report: the level of the status is WARN or ERROR
+ * when the processing time of a node of the scope exceeds the budget, with the path and the
+ * subtree of the node. Within the budgets, a report only costs a lookup of the name per node, and
+ * the status is built only on a violation. Add it with TimeKeeper::add_reporter().
+ */
+class TimeBudgetWatchdog
+{
+public:
+  /**
+   * @brief Construct a new TimeBudgetWatchdog object, with its own diagnostic status
+   *
+   * @param node Node publishing the diagnostics
+   * @param diagnostic_name Name of the status
+   */
+  explicit TimeBudgetWatchdog(
+    rclcpp::Node * node, const std::string & diagnostic_name = "processing_time");
+
+  /**
+   * @brief Set the budget of a scope, which applies to all the nodes of its name
+   *
+   * @param name Name of the scope, as passed to TimeKeeper::start_track()
+   * @param warn_ms Processing time in milliseconds above which the level is WARN
+   * @param error_ms Processing time in milliseconds above which the level is ERROR
+   * @throw std::invalid_argument if warn_ms is negative or greater than error_ms
+   */
+  void set_budget(const std::string & name, double warn_ms, double error_ms);
+
+  /**
+   * @brief Check the nodes of a tree and publish the status
+   *
+   * @param root Root node of the tree
+   * @return int8_t Level of the status
+   */
+  int8_t check(const ProcessingTimeNode & root);
+
+  /**
+   * @brief Check the nodes of a tree kept in an arena and publish the status
+   *
+   * @param arena Tree of the cycle
+   * @return int8_t Level of the status
+   */
+  int8_t check(const ProcessingTimeArena & arena);
+
+  /**
+   * @brief Get the diagnostic status, e.g. to limit the rate of its publishing
+   */
+  autoware_utils_diagnostics::DiagnosticsInterface & diagnostics() { return diagnostics_; }
+
+private:
+  struct Budget
+  {
+    double warn_ms;
+    double error_ms;
+  };
+
+  const Budget * find_budget(const std::string & name) const;
+  void check_node(const ProcessingTimeNode & node);
+  void raise(
+    const Budget & budget, double processing_time, const std::string & path,
+    const std::string & subtree);
+  int8_t publish();
+
+  rclcpp::Clock::SharedPtr clock_;
+  std::mutex mutex_;  //!< Mutex of the checks, which can be reported from a background thread
+  autoware_utils_diagnostics::DiagnosticsInterface diagnostics_;
+  std::unordered_map<std::string, Budget> budgets_;
+};
+
+}  // namespace autoware_utils_debug
+
+#endif  // AUTOWARE_UTILS_DEBUG__TIME_BUDGET_WATCHDOG_HPP_
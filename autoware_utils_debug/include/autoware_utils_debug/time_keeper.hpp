@@ -15,6 +15,11 @@
 #ifndef AUTOWARE_UTILS_DEBUG__TIME_KEEPER_HPP_
 #define AUTOWARE_UTILS_DEBUG__TIME_KEEPER_HPP_
 
+#include "autoware_utils_debug/perf_counters.hpp"
+#include "autoware_utils_debug/resource_usage.hpp"
+
+#include <autoware_utils_math/accumulator.hpp>
+#include <autoware_utils_math/quantile.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
 #include <rclcpp/publisher.hpp>
 
@@ -22,10 +27,18 @@
 #include <autoware_internal_debug_msgs/msg/processing_time_tree.hpp>
 #include <std_msgs/msg/string.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace autoware_utils_debug
@@ -51,6 +64,13 @@ public:
    */
   std::shared_ptr<ProcessingTimeNode> add_child(const std::string & name);
 
+  /**
+   * @brief Add an existing node as a child, e.g. a subtree tracked by another thread
+   *
+   * @param child Node to add, without parent
+   */
+  void adopt_child(const std::shared_ptr<ProcessingTimeNode> & child);
+
   /**
    * @brief Get the result string representing the node and its children in a tree structure
    *
@@ -95,6 +115,13 @@ public:
    */
   void set_comment(const std::string & comment);
 
+  /**
+   * @brief Set the index of the thread which ran the node and its children, 0 for the root thread
+   *
+   * @param thread_index Index of the thread, in the order of their first track
+   */
+  void set_thread_index(size_t thread_index);
+
   /**
    * @brief Get the name of the node
    *
@@ -102,21 +129,250 @@ public:
    */
   std::string get_name() const;
 
+  /**
+   * @brief Get the processing time of the node
+   *
+   * @return double Processing time of the node in milliseconds
+   */
+  double get_time() const;
+
+  /**
+   * @brief Get the comment of the node
+   *
+   * @return std::string Comment of the node
+   */
+  std::string get_comment() const;
+
+  /**
+   * @brief Get the index of the thread which ran the node, 0 for the root thread
+   */
+  size_t get_thread_index() const;
+
+  /**
+   * @brief Get the time at which the node was created, i.e. its track started
+   */
+  std::chrono::steady_clock::time_point get_start_time() const;
+
+  /**
+   * @brief Set the resource usage of the node, reported after its processing time
+   *
+   * @param usage CPU time and allocations of the node
+   */
+  void set_resource_usage(const ResourceUsage & usage);
+
+  /**
+   * @brief Get the resource usage of the node, if it was tracked
+   */
+  std::optional<ResourceUsage> get_resource_usage() const;
+
+  /**
+   * @brief Set the hardware counters of the node, reported after its resource usage
+   *
+   * @param values Counters of the node, or nullopt if they could not be read
+   */
+  void set_perf_counters(const std::optional<PerfCounterValues> & values);
+
+  /**
+   * @brief Get the hardware counters of the node, if they were read
+   */
+  std::optional<PerfCounterValues> get_perf_counters() const;
+
 private:
   const std::string name_;                         //!< Name of the node
+  const std::chrono::steady_clock::time_point start_time_;  //!< Time at which the track started
   double processing_time_{0.0};                    //!< Processing time of the node
   std::string comment_;                            //!< Comment for the node
+  size_t thread_index_{0};  //!< Index of the thread of the subtree, shown if not the root thread
+  std::optional<ResourceUsage> resource_usage_;    //!< Resource usage of the node, if tracked
+  std::optional<PerfCounterValues> perf_counters_;  //!< Hardware counters of the node, if read
   std::weak_ptr<ProcessingTimeNode> parent_node_;  //!< Weak pointer to the parent node
   std::vector<std::shared_ptr<ProcessingTimeNode>>
     child_nodes_;  //!< Vector of shared pointers to the child nodes
 };
 
+/**
+ * @brief Class holding a time tracking tree in flat arrays, reused from one report to the next
+ *
+ * The nodes are linked by indices and their names are interned, so that after the first cycles
+ * add() neither allocates nor copies a name, and clear() only resets the number of nodes.
+ */
+class ProcessingTimeArena
+{
+public:
+  static constexpr size_t none = std::numeric_limits<size_t>::max();  //!< Index of no node
+
+  /**
+   * @brief Get the index of a name, adding it to the names if it is new
+   *
+   * @param name Name of a node
+   * @return size_t Index of the name
+   */
+  size_t intern(const std::string & name);
+
+  /**
+   * @brief Get the index of a name with static storage duration, looked up by its address
+   *
+   * @param name Name of a node, e.g. a string literal
+   * @return size_t Index of the name
+   */
+  size_t intern_literal(const char * name);
+
+  /**
+   * @brief Add a node as the last child of its parent
+   *
+   * @param name Index of the name of the node, returned by intern()
+   * @param parent Index of the parent node, or none for the root
+   * @return size_t Index of the new node
+   */
+  size_t add(size_t name, size_t parent);
+
+  /**
+   * @brief Remove all the nodes, keeping the memory and the interned names
+   */
+  void clear() { size_ = 0; }
+
+  /**
+   * @brief Get the number of nodes
+   */
+  size_t size() const { return size_; }
+
+  const std::string & get_name(size_t node) const { return names_[nodes_[node].name]; }
+  size_t get_parent(size_t node) const { return nodes_[node].parent; }
+  double get_time(size_t node) const { return nodes_[node].processing_time; }
+  const std::string & get_comment(size_t node) const { return nodes_[node].comment; }
+  std::chrono::steady_clock::time_point get_start_time(size_t node) const
+  {
+    return nodes_[node].start_time;
+  }
+  void set_time(size_t node, double processing_time);
+  void set_comment(size_t node, const std::string & comment);
+  void set_start_time(size_t node, std::chrono::steady_clock::time_point start_time)
+  {
+    nodes_[node].start_time = start_time;
+  }
+  const std::optional<ResourceUsage> & get_resource_usage(size_t node) const
+  {
+    return nodes_[node].resource_usage;
+  }
+  void set_resource_usage(size_t node, const ResourceUsage & usage)
+  {
+    nodes_[node].resource_usage = usage;
+  }
+  const std::optional<PerfCounterValues> & get_perf_counters(size_t node) const
+  {
+    return nodes_[node].perf_counters;
+  }
+  void set_perf_counters(size_t node, const std::optional<PerfCounterValues> & values)
+  {
+    nodes_[node].perf_counters = values;
+  }
+
+  /**
+   * @brief Get the result string representing the tree, in the format of ProcessingTimeNode
+   */
+  std::string to_string() const;
+
+  /**
+   * @brief Construct a ProcessingTimeTree message from the tree, as ProcessingTimeNode does
+   */
+  autoware_internal_debug_msgs::msg::ProcessingTimeTree to_msg() const;
+
+private:
+  struct Node
+  {
+    size_t name;
+    size_t parent;
+    size_t first_child;
+    size_t last_child;
+    size_t next_sibling;
+    double processing_time;
+    std::string comment;
+    std::chrono::steady_clock::time_point start_time;
+    std::optional<ResourceUsage> resource_usage;
+    std::optional<PerfCounterValues> perf_counters;
+  };
+
+  std::vector<Node> nodes_;  //!< Nodes, of which the first size_ are in use
+  size_t size_{0};
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, size_t> name_indices_;
+  std::unordered_map<const char *, size_t> literal_indices_;
+};
+
+/**
+ * @brief Statistics of the processing times per path of the call tree, accumulated over cycles
+ *
+ * The nodes of the trees of the cycles are merged with the node of the same name under the same
+ * parent, as the siblings of the reports are in the order of their first track.
+ */
+class ProcessingTimeAggregate
+{
+public:
+  /**
+   * @brief Add the processing times of a cycle tracked in an arena
+   *
+   * @param arena Tree of the cycle
+   */
+  void add(const ProcessingTimeArena & arena);
+
+  /**
+   * @brief Add the processing times of a cycle tracked in ProcessingTimeNode objects
+   *
+   * @param root Root node of the tree of the cycle
+   */
+  void add(const ProcessingTimeNode & root);
+
+  /**
+   * @brief Get the number of cycles added since the last clear()
+   */
+  size_t cycles() const { return cycles_; }
+
+  /**
+   * @brief Remove all the paths and their statistics
+   */
+  void clear();
+
+  /**
+   * @brief Write the tree into an arena, with the mean as the processing time of each path and its
+   * count, max and p99 as the comment
+   *
+   * @param arena Arena to be overwritten
+   */
+  void to_arena(ProcessingTimeArena & arena) const;
+
+private:
+  struct Node
+  {
+    std::string name;
+    std::vector<size_t> children;
+    autoware_utils_math::Accumulator<double> times;
+    autoware_utils_math::P2Quantile p99{0.99};
+  };
+
+  size_t find_or_add(const std::string & name, size_t parent);
+  void add_subtree(const ProcessingTimeNode & node, size_t parent);
+
+  std::vector<Node> nodes_;    //!< Nodes, each after its parent
+  std::vector<size_t> roots_;  //!< Nodes without parent
+  size_t cycles_{0};
+};
+
+class ChromeTraceWriter;
+class ProcessingTimeTreeEncoder;
+class TimeBudgetWatchdog;
+
 using ProcessingTimeDetail =
   autoware_internal_debug_msgs::msg::ProcessingTimeTree;  //!< Alias for the ProcessingTimeTree
                                                           //!< message
 
 /**
  * @brief Class for tracking and reporting the processing time of various functions
+ *
+ * The first thread which starts a track owns the tree until its outermost track ends. The tracks
+ * of the other threads are kept in a stack per thread, and each of their outermost tracks is added
+ * as a subtree of the track of the owning thread in progress when it started, labeled with the
+ * index of the thread. These tracks must end before the outermost track of the owning thread, and
+ * are ignored while no track of the owning thread is in progress or in the arena mode.
  */
 class TimeKeeper
 {
@@ -128,6 +384,14 @@ public:
     (add_reporter(reporters), ...);
   }
 
+  /**
+   * @brief Destroy the TimeKeeper object, waiting for the asynchronous reports in the queue
+   */
+  ~TimeKeeper();
+
+  TimeKeeper(const TimeKeeper &) = delete;
+  TimeKeeper & operator=(const TimeKeeper &) = delete;
+
   /**
    * @brief Add a reporter to output processing times to an ostream
    *
@@ -142,6 +406,112 @@ public:
    */
   void add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher);
 
+  /**
+   * @brief Add a reporter to write the processing times as trace events
+   *
+   * @param writer Shared pointer to the ChromeTraceWriter, see chrome_trace_writer.hpp
+   */
+  void add_reporter(std::shared_ptr<ChromeTraceWriter> writer);
+
+  /**
+   * @brief Add a reporter to publish processing times with interned names
+   *
+   * @param encoder Shared pointer to the ProcessingTimeTreeEncoder, see processing_time_encoder.hpp
+   */
+  void add_reporter(std::shared_ptr<ProcessingTimeTreeEncoder> encoder);
+
+  /**
+   * @brief Add a reporter to check the processing times against budgets and raise diagnostics
+   *
+   * @param watchdog Shared pointer to the TimeBudgetWatchdog, see time_budget_watchdog.hpp
+   */
+  void add_reporter(std::shared_ptr<TimeBudgetWatchdog> watchdog);
+
+  /**
+   * @brief Keep the tree in a ProcessingTimeArena instead of shared ProcessingTimeNode objects
+   *
+   * The arena is reused after each report, so the tracks of a cycle do not allocate once the
+   * cycles have been seen. The reports are the same in both modes.
+   *
+   * @param enable Whether to use the arena
+   * @throw std::runtime_error if a track is in progress
+   */
+  void use_arena(bool enable);
+
+  /**
+   * @brief Report the statistics of each path over a number of cycles instead of every cycle
+   *
+   * The processing times of the cycles are accumulated in a ProcessingTimeAggregate, which is
+   * reported and cleared every given number of cycles. The reports show the mean as the
+   * processing time and the count, max and p99 as the comment.
+   *
+   * @param cycles Number of cycles per report, or 0 to report every cycle
+   * @throw std::runtime_error if a track is in progress
+   */
+  void use_aggregation(size_t cycles);
+
+  /**
+   * @brief Change the aggregation as use_aggregation() at the start of the next cycle
+   *
+   * Unlike use_aggregation(), it can be called from any thread while a cycle is tracked, e.g. by
+   * a service switching the instrumentation of a running node.
+   *
+   * @param cycles Number of cycles per report, or 0 to report every cycle
+   */
+  void request_aggregation(size_t cycles);
+
+  /**
+   * @brief Track the CPU time and the heap allocations of each node besides its processing time
+   *
+   * The CPU time excludes the waits, so that they can be told apart from the computation. The
+   * allocations are counted if the executable uses AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS(). In
+   * the tree mode, they include the allocations of the nodes of the children, which the arena
+   * mode avoids once the cycles have been seen. The usage is shown as "cpu 1.2ms, 3 allocs,
+   * 128 B" after the processing time, and at the beginning of the comment of the messages.
+   *
+   * @param enable Whether to track the resource usage
+   * @throw std::runtime_error if a track is in progress
+   */
+  void use_resource_usage(bool enable);
+
+  /**
+   * @brief Read the hardware counters of perf_event_open at the start and at the end of each track
+   *
+   * The cycles, instructions, cache misses and branch misses of each node are shown as "1200
+   * cycles, IPC 1.50, 3 cache misses, 2 branch misses" after the processing time, and at the
+   * beginning of the comment of the messages. They are not shown for the threads where the
+   * counters cannot be opened.
+   *
+   * @param enable Whether to read the counters
+   * @throw std::runtime_error if a track is in progress, or if the counters are not available
+   */
+  void use_perf_counters(bool enable);
+
+  /**
+   * @brief Call the reporters from a background thread instead of the tracked thread
+   *
+   * The finished trees are passed to the background thread through a lock-free queue, so that
+   * the formatting and the publication are off the critical path. In the arena mode, the arena is
+   * exchanged with one the background thread has finished reporting. A tree is dropped if the
+   * queue is full. The reporters must be added before.
+   *
+   * @param queue_size Number of trees waiting to be reported
+   * @throw std::runtime_error if a track is in progress
+   */
+  void start_async_reporting(size_t queue_size = 16);
+
+  /**
+   * @brief Report the trees in the queue, then call the reporters from the tracked thread again
+   *
+   * @throw std::runtime_error if a track is in progress
+   */
+  void stop_async_reporting();
+
+  /**
+   * @brief Get the number of trees dropped because the queue of the asynchronous reports was full
+   */
+  size_t dropped_reports() const;
+
   /**
    * @brief Start tracking the processing time of a function
    *
@@ -157,7 +527,35 @@ public:
   void end_track(const std::string & func_name);
 
   /**
-   * @brief Comment the current time node
+   * @brief Start tracking a function named by a string with static storage duration
+   *
+   * In the arena mode, the name is neither copied nor hashed once it has been seen.
+   *
+   * @param func_name Name of the function to be tracked, e.g. a string literal
+   */
+  void start_literal_track(const char * func_name);
+
+  /**
+   * @brief End tracking a function started by start_literal_track()
+   *
+   * @param func_name Name of the function to end tracking
+   */
+  void end_literal_track(const char * func_name);
+
+  /**
+   * @brief Enable or disable the tracks of ScopedLiteralTimeTrack at runtime
+   *
+   * @param enabled Whether the tracks are enabled
+   */
+  void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  /**
+   * @brief Check whether the tracks of ScopedLiteralTimeTrack are enabled
+   */
+  bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Comment the current time node, unless the tracks are disabled by set_enabled()
    *
    * @param comment Comment to be added to the current time node
    */
@@ -173,12 +571,54 @@ private:
     current_time_node_;                            //!< Shared pointer to the current time node
   std::shared_ptr<ProcessingTimeNode> root_node_;  //!< Shared pointer to the root time node
   std::thread::id root_node_thread_id_;            //!< ID of the thread that started the tracking
+  std::mutex mutex_;  //!< Mutex of the tree, shared with the tracks of the other threads
+
+  /**
+   * @brief Track stack of a thread other than the one that started the tracking
+   */
+  struct ThreadTrack
+  {
+    size_t index;                                     //!< Index of the thread
+    std::shared_ptr<ProcessingTimeNode> root_node;     //!< Outermost node of the thread
+    std::shared_ptr<ProcessingTimeNode> current_node;  //!< Current node of the thread
+    std::shared_ptr<ProcessingTimeNode> parent_node;   //!< Node of the root thread to add it to
+    autoware_utils_system::StopWatch<
+      std::chrono::milliseconds, std::chrono::microseconds, std::chrono::steady_clock>
+      stop_watch;  //!< StopWatch of the thread
+  };
+  std::unordered_map<std::thread::id, ThreadTrack> thread_tracks_;  //!< Track stack per thread
+
+  void start_thread_track(const std::string & func_name);
+  void end_thread_track(const std::string & func_name);
   autoware_utils_system::StopWatch<
     std::chrono::milliseconds, std::chrono::microseconds, std::chrono::steady_clock>
     stop_watch_;  //!< StopWatch object for tracking the processing time
 
   std::vector<std::function<void(const std::shared_ptr<ProcessingTimeNode> &)>>
     reporters_;  //!< Vector of functions for reporting the processing times
+
+  bool use_arena_{false};  //!< Whether the tree is kept in arena_
+  ProcessingTimeArena arena_;  //!< Tree of the current cycle in the arena mode
+  size_t current_arena_node_{ProcessingTimeArena::none};  //!< Current node in the arena mode
+  std::vector<std::function<void(const ProcessingTimeArena &)>>
+    arena_reporters_;  //!< Vector of functions for reporting the processing times of the arena
+
+  class AsyncReporter;
+  std::shared_ptr<AsyncReporter> async_reporter_;  //!< Background reporter, if asynchronous
+  size_t dropped_reports_{0};  //!< Number of trees dropped by the previous background reporters
+  std::atomic<bool> enabled_{true};  //!< Whether ScopedLiteralTimeTrack tracks
+
+  bool use_resource_usage_{false};         //!< Whether the resource usage is tracked
+  bool use_perf_counters_{false};          //!< Whether the hardware counters are read
+  size_t aggregation_cycles_{0};          //!< Number of cycles per report, 0 if not aggregated
+  std::optional<size_t> requested_aggregation_cycles_;  //!< Applied at the start of a cycle
+  ProcessingTimeAggregate aggregate_;      //!< Statistics of the cycles since the last report
+  ProcessingTimeArena aggregate_arena_;  //!< Tree of the reported statistics
+
+  void apply_requested_aggregation();
+  void start_arena_track(size_t name, const char * func_name);
+  void end_arena_track(const char * func_name);
+  void report_arena(ProcessingTimeArena & arena);
 };
 
 /**
@@ -210,6 +650,72 @@ private:
   TimeKeeper & time_keeper_;     //!< Reference to the TimeKeeper object
 };
 
+/**
+ * @brief Scoped tracker of a function named by a string literal, gated by TimeKeeper::is_enabled()
+ *
+ * The name is stored as a pointer. Use AUTOWARE_UTILS_DEBUG_TIME_TRACK to be able to compile the
+ * tracks out.
+ */
+class ScopedLiteralTimeTrack
+{
+public:
+  /**
+   * @brief Construct a new ScopedLiteralTimeTrack object, starting the track if enabled
+   *
+   * @param func_name Name of the function to be tracked, a string literal
+   * @param time_keeper Reference to the TimeKeeper object
+   */
+  template <size_t N>
+  ScopedLiteralTimeTrack(const char (&func_name)[N], TimeKeeper & time_keeper)
+  : func_name_(func_name), time_keeper_(time_keeper), started_(time_keeper.is_enabled())
+  {
+    if (started_) {
+      time_keeper_.start_literal_track(func_name_);
+    }
+  }
+
+  ScopedLiteralTimeTrack(const ScopedLiteralTimeTrack &) = delete;
+  ScopedLiteralTimeTrack & operator=(const ScopedLiteralTimeTrack &) = delete;
+  ScopedLiteralTimeTrack(ScopedLiteralTimeTrack &&) = delete;
+  ScopedLiteralTimeTrack & operator=(ScopedLiteralTimeTrack &&) = delete;
+
+  /**
+   * @brief Destroy the ScopedLiteralTimeTrack object, ending the track if it was started
+   */
+  ~ScopedLiteralTimeTrack()  // NOLINT
+  {
+    if (started_) {
+      time_keeper_.end_literal_track(func_name_);
+    }
+  }
+
+private:
+  const char * func_name_;    //!< Name of the function being tracked
+  TimeKeeper & time_keeper_;  //!< Reference to the TimeKeeper object
+  const bool started_;        //!< Whether the track was enabled at the construction
+};
+
 }  // namespace autoware_utils_debug
 
+#define AUTOWARE_UTILS_DEBUG_CONCAT_IMPL(a, b) a##b
+#define AUTOWARE_UTILS_DEBUG_CONCAT(a, b) AUTOWARE_UTILS_DEBUG_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Track the rest of the scope with a ScopedLiteralTimeTrack, and comment the current track
+ *
+ * Defining AUTOWARE_UTILS_DEBUG_DISABLE_TIME_TRACK removes the tracks and the comments, without
+ * evaluating the arguments.
+ */
+#ifdef AUTOWARE_UTILS_DEBUG_DISABLE_TIME_TRACK
+#define AUTOWARE_UTILS_DEBUG_TIME_TRACK(func_name, time_keeper) \
+  static_cast<void>(sizeof(time_keeper))
+#define AUTOWARE_UTILS_DEBUG_TIME_COMMENT(text, time_keeper) \
+  static_cast<void>(sizeof(time_keeper))
+#else
+#define AUTOWARE_UTILS_DEBUG_TIME_TRACK(func_name, time_keeper)                   \
+  const autoware_utils_debug::ScopedLiteralTimeTrack AUTOWARE_UTILS_DEBUG_CONCAT( \
+    autoware_utils_debug_time_track_, __LINE__)(func_name, time_keeper)
+#define AUTOWARE_UTILS_DEBUG_TIME_COMMENT(text, time_keeper) (time_keeper).comment(text)
+#endif
+
 #endif  // AUTOWARE_UTILS_DEBUG__TIME_KEEPER_HPP_
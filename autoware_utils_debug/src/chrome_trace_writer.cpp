@@ -0,0 +1,177 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/chrome_trace_writer.hpp"
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+namespace
+{
+void append_escaped_impl(std::string & out, const std::string & text)
+{
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          out += c;
+        }
+    }
+  }
+}
+}  // namespace
+
+ChromeTraceWriter::ChromeTraceWriter(
+  const std::string & path, const size_t max_file_size, const size_t max_files,
+  const size_t buffer_size)
+: path_(path),
+  max_file_size_(max_file_size),
+  max_files_(max_files),
+  buffer_size_(buffer_size),
+  pid_(static_cast<int>(getpid()))
+{
+  if (max_files_ == 0) {
+    throw std::invalid_argument("ChromeTraceWriter needs at least one file.");
+  }
+  buffer_.reserve(buffer_size_);
+  open();
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  close();
+}
+
+void ChromeTraceWriter::write(const ProcessingTimeNode & root)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  write_node(root, root.get_thread_index());
+  end_cycle();
+}
+
+void ChromeTraceWriter::write(const ProcessingTimeArena & arena)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t node = 0; node < arena.size(); ++node) {
+    append_event(
+      arena.get_name(node), arena.get_start_time(node), arena.get_time(node), 0,
+      arena.get_comment(node));
+  }
+  end_cycle();
+}
+
+void ChromeTraceWriter::flush()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_ << buffer_;
+  file_.flush();
+  file_size_ += buffer_.size();
+  buffer_.clear();
+}
+
+void ChromeTraceWriter::write_node(const ProcessingTimeNode & node, const size_t thread_index)
+{
+  append_event(
+    node.get_name(), node.get_start_time(), node.get_time(), thread_index, node.get_comment());
+  for (const auto & child : node.get_child_nodes()) {
+    // only the roots of the subtrees of the other threads have their thread index
+    const size_t child_thread_index = child->get_thread_index();
+    write_node(*child, child_thread_index != 0 ? child_thread_index : thread_index);
+  }
+}
+
+void ChromeTraceWriter::append_event(
+  const std::string & name, const std::chrono::steady_clock::time_point start_time,
+  const double processing_time, const size_t thread_index, const std::string & comment)
+{
+  const double start_us =
+    std::chrono::duration<double, std::micro>(start_time.time_since_epoch()).count();
+  buffer_ += first_event_ ? "\n" : ",\n";
+  first_event_ = false;
+  buffer_ += "{\"name\":\"";
+  append_escaped_impl(buffer_, name);
+  buffer_ += fmt::format(
+    "\",\"cat\":\"time_keeper\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{}",
+    start_us, processing_time * 1000.0, pid_, thread_index);
+  if (!comment.empty()) {
+    buffer_ += ",\"args\":{\"comment\":\"";
+    append_escaped_impl(buffer_, comment);
+    buffer_ += "\"}";
+  }
+  buffer_ += "}";
+}
+
+void ChromeTraceWriter::end_cycle()
+{
+  // the cycles are not split between the files
+  if (file_size_ + buffer_.size() >= max_file_size_) {
+    rotate();
+  } else if (buffer_.size() >= buffer_size_) {
+    file_ << buffer_;
+    file_size_ += buffer_.size();
+    buffer_.clear();
+  }
+}
+
+void ChromeTraceWriter::open()
+{
+  file_.open(path_, std::ios::out | std::ios::trunc);
+  if (!file_) {
+    throw std::runtime_error(fmt::format("ChromeTraceWriter cannot open {}.", path_));
+  }
+  file_ << "[";
+  file_size_ = 1;
+  first_event_ = true;
+}
+
+void ChromeTraceWriter::close()
+{
+  file_ << buffer_ << "\n]\n";
+  buffer_.clear();
+  file_.close();
+}
+
+void ChromeTraceWriter::rotate()
+{
+  close();
+  for (size_t i = max_files_ - 1; i > 0; --i) {
+    const std::string from = i == 1 ? path_ : fmt::format("{}.{}", path_, i - 1);
+    std::rename(from.c_str(), fmt::format("{}.{}", path_, i).c_str());
+  }
+  open();
+}
+
+}  // namespace autoware_utils_debug
@@ -0,0 +1,114 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/perf_counters.hpp"
+
+#include <fmt/format.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+namespace
+{
+int open_counter_impl(const uint64_t config, const int group_fd)
+{
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+    PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+}  // namespace
+
+PerfCounters::PerfCounters()
+{
+  constexpr std::array<uint64_t, 4> configs = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES};
+  fds_.fill(-1);
+  for (size_t i = 0; i < configs.size(); ++i) {
+    fds_[i] = open_counter_impl(configs[i], fds_[0]);
+    if (fds_[i] < 0) {
+      const int error = errno;
+      for (size_t j = 0; j < i; ++j) {
+        close(fds_[j]);
+      }
+      throw std::runtime_error(fmt::format("perf_event_open failed: {}.", std::strerror(error)));
+    }
+  }
+}
+
+PerfCounters::~PerfCounters()
+{
+  for (const int fd : fds_) {
+    close(fd);
+  }
+}
+
+std::optional<PerfCounterValues> PerfCounters::read() const
+{
+  struct
+  {
+    uint64_t nr;
+    uint64_t time_enabled;
+    uint64_t time_running;
+    uint64_t values[4];
+  } data{};
+  if (::read(fds_[0], &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+    return std::nullopt;
+  }
+  return PerfCounterValues{
+    data.values[0], data.values[1], data.values[2], data.values[3], data.time_enabled,
+    data.time_running};
+}
+
+std::optional<PerfCounterValues> thread_perf_counters()
+{
+  thread_local bool opened = false;
+  thread_local std::unique_ptr<PerfCounters> counters;
+  if (!opened) {
+    opened = true;
+    try {
+      counters = std::make_unique<PerfCounters>();
+    } catch (const std::runtime_error &) {
+      // not available, not retried for each track
+    }
+  }
+  if (!counters) {
+    return std::nullopt;
+  }
+  return counters->read();
+}
+
+std::string to_string(const PerfCounterValues & values)
+{
+  return fmt::format(
+    "{} cycles, IPC {:.2f}, {} cache misses, {} branch misses", values.cycles, values.ipc(),
+    values.cache_misses, values.branch_misses);
+}
+
+}  // namespace autoware_utils_debug
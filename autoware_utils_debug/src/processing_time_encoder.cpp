@@ -0,0 +1,139 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/processing_time_encoder.hpp"
+
+#include <charconv>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace autoware_utils_debug
+{
+
+ProcessingTimeTreeEncoder::ProcessingTimeTreeEncoder(
+  rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher, const size_t table_period,
+  const double min_time, const bool keep_comments)
+: publisher_(std::move(publisher)),
+  table_period_(table_period),
+  min_time_(min_time),
+  keep_comments_(keep_comments)
+{
+  if (table_period == 0) {
+    throw std::invalid_argument("ProcessingTimeTreeEncoder needs a table period of at least one.");
+  }
+}
+
+void ProcessingTimeTreeEncoder::encode(
+  const ProcessingTimeDetail & tree, ProcessingTimeDetail & encoded)
+{
+  // the table is sent again after a new name, or periodically
+  bool send_table = table_period_ <= ++reports_since_table_;
+  node_names_.clear();
+  for (const auto & node : tree.nodes) {
+    const auto [it, inserted] = name_indices_.try_emplace(node.name, name_indices_.size());
+    send_table = send_table || inserted;
+    node_names_.push_back(it->second);
+  }
+  if (send_table) {
+    reports_since_table_ = 0;
+    sent_names_.assign(name_indices_.size(), false);
+  }
+
+  // the ids of the tree are the positions of the nodes plus 1, and the kept nodes are renumbered
+  node_ids_.assign(tree.nodes.size(), 0);
+  encoded.nodes.clear();
+  for (size_t i = 0; i < tree.nodes.size(); ++i) {
+    const auto & node = tree.nodes[i];
+    int parent_id = 0;
+    if (node.parent_id != 0) {
+      const auto parent = static_cast<size_t>(node.parent_id - 1);
+      if (node.parent_id < 0 || i <= parent || node_ids_[parent] == 0) {
+        continue;
+      }
+      if (node.processing_time < min_time_) {
+        continue;
+      }
+      parent_id = node_ids_[parent];
+    }
+    node_ids_[i] = static_cast<int>(encoded.nodes.size() + 1);
+
+    const size_t name = node_names_[i];
+    autoware_internal_debug_msgs::msg::ProcessingTimeNode encoded_node;
+    encoded_node.id = node_ids_[i];
+    encoded_node.parent_id = parent_id;
+    encoded_node.processing_time = node.processing_time;
+    encoded_node.name = "#" + std::to_string(name);
+    if (send_table && !sent_names_[name]) {
+      encoded_node.name += ":" + node.name;
+      sent_names_[name] = true;
+    }
+    if (keep_comments_) {
+      encoded_node.comment = node.comment;
+    }
+    encoded.nodes.push_back(std::move(encoded_node));
+  }
+}
+
+void ProcessingTimeTreeEncoder::publish(const ProcessingTimeNode & root)
+{
+  encode(root.to_msg(), encoded_);
+  if (publisher_) {
+    publisher_->publish(encoded_);
+  }
+}
+
+void ProcessingTimeTreeEncoder::publish(const ProcessingTimeArena & arena)
+{
+  encode(arena.to_msg(), encoded_);
+  if (publisher_) {
+    publisher_->publish(encoded_);
+  }
+}
+
+bool ProcessingTimeTreeDecoder::decode(
+  const ProcessingTimeDetail & encoded, ProcessingTimeDetail & tree)
+{
+  tree.nodes = encoded.nodes;
+  bool known = true;
+  for (auto & node : tree.nodes) {
+    const std::string & name = node.name;
+    if (name.empty() || name.front() != '#') {
+      continue;
+    }
+    size_t index = 0;
+    const char * const end = name.data() + name.size();
+    const auto [ptr, ec] = std::from_chars(name.data() + 1, end, index);
+    if (ec != std::errc() || (ptr != end && *ptr != ':')) {
+      continue;
+    }
+
+    if (ptr != end) {
+      if (names_.size() <= index) {
+        names_.resize(index + 1);
+      }
+      names_[index] = name.substr(static_cast<size_t>(ptr + 1 - name.data()));
+      node.name = names_[index];
+    } else if (index < names_.size() && !names_[index].empty()) {
+      node.name = names_[index];
+    } else {
+      known = false;
+    }
+  }
+  return known;
+}
+
+}  // namespace autoware_utils_debug
@@ -0,0 +1,164 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/published_time_aggregator.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_debug
+{
+
+std::ostream & operator<<(std::ostream & os, const LatencyStatistics & statistics)
+{
+  return os << fmt::format(
+           "{}: count={} mean={:.3f}ms max={:.3f}ms p50={:.3f}ms p99={:.3f}ms", statistics.name,
+           statistics.count, statistics.mean, statistics.max, statistics.p50, statistics.p99);
+}
+
+LatencyGraph::LatencyGraph(std::vector<Edge> hops, std::vector<Edge> paths, const size_t window)
+: window_(window)
+{
+  if (window_ == 0) {
+    throw std::invalid_argument("LatencyGraph needs a window of at least one stamp.");
+  }
+  std::vector<Edge> edges = std::move(hops);
+  edges.insert(edges.end(), paths.begin(), paths.end());
+  latencies_.reserve(edges.size());
+  for (const auto & [first, last] : edges) {
+    const size_t first_index = intern(first);
+    const size_t last_index = intern(last);
+    latencies_.push_back(Latency{first_index, last_index, first + " -> " + last, {}});
+    windows_[first_index].latencies.push_back(latencies_.size() - 1);
+    windows_[last_index].latencies.push_back(latencies_.size() - 1);
+  }
+}
+
+size_t LatencyGraph::intern(const std::string & topic)
+{
+  const auto [it, inserted] = topic_indices_.emplace(topic, topics_.size());
+  if (inserted) {
+    topics_.push_back(topic);
+    windows_.emplace_back();
+    windows_.back().stamps.reserve(window_);
+    windows_.back().published.reserve(window_);
+  }
+  return it->second;
+}
+
+size_t LatencyGraph::topic_index(const std::string & topic) const
+{
+  const auto it = topic_indices_.find(topic);
+  if (it == topic_indices_.end()) {
+    throw std::invalid_argument("The topic " + topic + " is not in the latency graph.");
+  }
+  return it->second;
+}
+
+void LatencyGraph::add(const size_t topic, const int64_t stamp, const int64_t published)
+{
+  Window & window = windows_[topic];
+  if (!window.published.emplace(stamp, published).second) {
+    return;  // published twice with the same stamp, the first one is kept
+  }
+  if (window.stamps.size() < window_) {
+    window.stamps.push_back(stamp);
+  } else {
+    window.published.erase(window.stamps[window.next]);
+    window.stamps[window.next] = stamp;
+    window.next = (window.next + 1) % window_;
+  }
+  for (const size_t index : window.latencies) {
+    record(latencies_[index], stamp);
+  }
+}
+
+void LatencyGraph::record(Latency & latency, const int64_t stamp)
+{
+  const auto & first = windows_[latency.first].published;
+  const auto & last = windows_[latency.last].published;
+  const auto first_it = first.find(stamp);
+  const auto last_it = last.find(stamp);
+  if (first_it == first.end() || last_it == last.end()) {
+    return;  // recorded when the other one arrives
+  }
+  const double value = static_cast<double>(last_it->second - first_it->second) * 1e-6;
+  latency.accumulator.add(value);
+  latency.p50.add(value);
+  latency.p99.add(value);
+}
+
+std::vector<LatencyStatistics> LatencyGraph::statistics() const
+{
+  std::vector<LatencyStatistics> result;
+  result.reserve(latencies_.size());
+  for (const auto & latency : latencies_) {
+    LatencyStatistics statistics;
+    statistics.name = latency.name;
+    statistics.count = latency.accumulator.count();
+    if (statistics.count != 0) {
+      statistics.mean = static_cast<double>(latency.accumulator.mean());
+      statistics.max = latency.accumulator.max();
+      statistics.p50 = latency.p50.quantile();
+      statistics.p99 = latency.p99.quantile();
+    }
+    result.push_back(statistics);
+  }
+  return result;
+}
+
+void LatencyGraph::reset()
+{
+  for (auto & latency : latencies_) {
+    latency.accumulator = {};
+    latency.p50 = autoware_utils_math::P2Quantile{0.5};
+    latency.p99 = autoware_utils_math::P2Quantile{0.99};
+  }
+}
+
+PublishedTimeAggregator::PublishedTimeAggregator(
+  rclcpp::Node * node, std::vector<LatencyGraph::Edge> hops, std::vector<LatencyGraph::Edge> paths,
+  const size_t window, const std::string & topic_suffix, const rclcpp::QoS & qos)
+: graph_(std::move(hops), std::move(paths), window)
+{
+  const auto & topics = graph_.topics();
+  subscriptions_.reserve(topics.size());
+  for (size_t topic = 0; topic < topics.size(); ++topic) {
+    subscriptions_.push_back(node->create_subscription<PublishedTime>(
+      topics[topic] + topic_suffix, qos, [this, topic](const PublishedTime & msg) {
+        const int64_t stamp = rclcpp::Time(msg.header.stamp).nanoseconds();
+        const int64_t published = rclcpp::Time(msg.published_stamp).nanoseconds();
+        std::lock_guard<std::mutex> lock(mutex_);
+        graph_.add(topic, stamp, published);
+      }));
+  }
+}
+
+std::vector<LatencyStatistics> PublishedTimeAggregator::statistics() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return graph_.statistics();
+}
+
+void PublishedTimeAggregator::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  graph_.reset();
+}
+
+}  // namespace autoware_utils_debug
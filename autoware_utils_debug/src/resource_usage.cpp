@@ -0,0 +1,60 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/resource_usage.hpp"
+
+#include <fmt/format.h>
+
+#include <ctime>
+#include <string>
+
+namespace autoware_utils_debug
+{
+
+namespace
+{
+/// @brief allocations of the thread, trivially initialized so that operator new can use it
+struct AllocationCount
+{
+  uint64_t allocations;
+  uint64_t bytes;
+};
+thread_local AllocationCount allocation_count{0, 0};
+}  // namespace
+
+ResourceUsage thread_resource_usage() noexcept
+{
+  timespec cpu_time{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+  ResourceUsage usage;
+  usage.cpu_time =
+    static_cast<double>(cpu_time.tv_sec) * 1e3 + static_cast<double>(cpu_time.tv_nsec) * 1e-6;
+  usage.allocations = allocation_count.allocations;
+  usage.allocated_bytes = allocation_count.bytes;
+  return usage;
+}
+
+void count_allocation(const size_t bytes) noexcept
+{
+  ++allocation_count.allocations;
+  allocation_count.bytes += bytes;
+}
+
+std::string to_string(const ResourceUsage & usage)
+{
+  return fmt::format(
+    "cpu {:.3f}ms, {} allocs, {} B", usage.cpu_time, usage.allocations, usage.allocated_bytes);
+}
+
+}  // namespace autoware_utils_debug
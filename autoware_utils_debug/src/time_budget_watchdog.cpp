@@ -0,0 +1,144 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/time_budget_watchdog.hpp"
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_debug
+{
+
+namespace
+{
+using diagnostic_msgs::msg::DiagnosticStatus;
+
+void append_subtree_impl(const ProcessingTimeNode & node, size_t depth, std::string & subtree)
+{
+  subtree += fmt::format(
+    "{}{} ({:.3f}ms)\n", std::string(2 * depth, ' '), node.get_name(), node.get_time());
+  for (const auto & child : node.get_child_nodes()) {
+    append_subtree_impl(*child, depth + 1, subtree);
+  }
+}
+}  // namespace
+
+TimeBudgetWatchdog::TimeBudgetWatchdog(rclcpp::Node * node, const std::string & diagnostic_name)
+: clock_(node->get_clock()), diagnostics_(node, diagnostic_name)
+{
+}
+
+void TimeBudgetWatchdog::set_budget(const std::string & name, double warn_ms, double error_ms)
+{
+  if (warn_ms < 0.0 || error_ms < warn_ms) {
+    throw std::invalid_argument(
+      fmt::format("The budget of '{}' must satisfy 0 <= warn_ms <= error_ms.", name));
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  budgets_[name] = Budget{warn_ms, error_ms};
+}
+
+const TimeBudgetWatchdog::Budget * TimeBudgetWatchdog::find_budget(const std::string & name) const
+{
+  const auto it = budgets_.find(name);
+  return it == budgets_.end() ? nullptr : &it->second;
+}
+
+int8_t TimeBudgetWatchdog::check(const ProcessingTimeNode & root)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  diagnostics_.clear();
+  check_node(root);
+  return publish();
+}
+
+void TimeBudgetWatchdog::check_node(const ProcessingTimeNode & node)
+{
+  const auto * budget = find_budget(node.get_name());
+  if (budget != nullptr && node.get_time() > budget->warn_ms) {
+    // the path and the subtree are only built on a violation
+    std::string path = node.get_name();
+    for (auto parent = node.get_parent_node().lock(); parent;
+         parent = parent->get_parent_node().lock()) {
+      path = parent->get_name() + "/" + path;
+    }
+    std::string subtree;
+    append_subtree_impl(node, 0, subtree);
+    raise(*budget, node.get_time(), path, subtree);
+  }
+  for (const auto & child : node.get_child_nodes()) {
+    check_node(*child);
+  }
+}
+
+int8_t TimeBudgetWatchdog::check(const ProcessingTimeArena & arena)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  diagnostics_.clear();
+  std::vector<size_t> depths;
+  for (size_t node = 0; node < arena.size(); ++node) {
+    const auto * budget = find_budget(arena.get_name(node));
+    if (budget == nullptr || arena.get_time(node) <= budget->warn_ms) {
+      continue;
+    }
+
+    // the depths are only computed on a violation
+    if (depths.empty()) {
+      depths.resize(arena.size());
+      for (size_t i = 0; i < arena.size(); ++i) {
+        const size_t parent = arena.get_parent(i);
+        depths[i] = parent == ProcessingTimeArena::none ? 0 : depths[parent] + 1;
+      }
+    }
+    std::string path = arena.get_name(node);
+    for (size_t parent = arena.get_parent(node); parent != ProcessingTimeArena::none;
+         parent = arena.get_parent(parent)) {
+      path = arena.get_name(parent) + "/" + path;
+    }
+    // the nodes are added in preorder, so the subtree is the following deeper nodes
+    std::string subtree;
+    for (size_t i = node; i < arena.size() && (i == node || depths[i] > depths[node]); ++i) {
+      subtree += fmt::format(
+        "{}{} ({:.3f}ms)\n", std::string(2 * (depths[i] - depths[node]), ' '), arena.get_name(i),
+        arena.get_time(i));
+    }
+    raise(*budget, arena.get_time(node), path, subtree);
+  }
+  return publish();
+}
+
+void TimeBudgetWatchdog::raise(
+  const Budget & budget, const double processing_time, const std::string & path,
+  const std::string & subtree)
+{
+  const bool error = processing_time > budget.error_ms;
+  diagnostics_.update_level_and_message(
+    error ? DiagnosticStatus::ERROR : DiagnosticStatus::WARN,
+    fmt::format(
+      "{} took {:.3f}ms, over the budget of {:.3f}ms", path, processing_time,
+      error ? budget.error_ms : budget.warn_ms));
+  diagnostics_.add_key_value(path, subtree);
+}
+
+int8_t TimeBudgetWatchdog::publish()
+{
+  diagnostics_.publish(clock_->now());
+  return diagnostics_.status().level;
+}
+
+}  // namespace autoware_utils_debug
@@ -14,20 +14,198 @@
 
 #include "autoware_utils_debug/time_keeper.hpp"
 
+#include "autoware_utils_debug/chrome_trace_writer.hpp"
+#include "autoware_utils_debug/processing_time_encoder.hpp"
+#include "autoware_utils_debug/time_budget_watchdog.hpp"
+
 #include <rclcpp/logging.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <fmt/format.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace autoware_utils_debug
 {
 
-ProcessingTimeNode::ProcessingTimeNode(const std::string & name) : name_(name)
+namespace
+{
+/// @brief lock-free queue of one producer and one consumer, which does not block when full
+template <typename T>
+class SpscQueue
+{
+public:
+  explicit SpscQueue(const size_t capacity) : slots_(capacity + 1) {}
+
+  bool push(T && value)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t next = (tail + 1) % slots_.size();
+    if (next == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    slots_[tail] = std::move(value);
+    tail_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T & value)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = std::move(slots_[head]);
+    head_.store((head + 1) % slots_.size(), std::memory_order_release);
+    return true;
+  }
+
+private:
+  std::vector<T> slots_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
+
+/// @brief format the resource usage and the hardware counters of a node, empty if neither is set
+std::string usage_to_string_impl(
+  const std::optional<ResourceUsage> & resource_usage,
+  const std::optional<PerfCounterValues> & perf_counters)
+{
+  std::string usage;
+  if (resource_usage) {
+    usage = to_string(*resource_usage);
+  }
+  if (perf_counters) {
+    usage += (usage.empty() ? "" : ", ") + to_string(*perf_counters);
+  }
+  return usage;
+}
+
+/// @brief counters of a track from those at its start, nullopt if the start or the end is not read
+std::optional<PerfCounterValues> perf_counters_delta_impl(
+  const std::optional<PerfCounterValues> & start)
+{
+  if (!start) {
+    return std::nullopt;
+  }
+  const auto end = thread_perf_counters();
+  if (!end) {
+    return std::nullopt;
+  }
+  return *end - *start;
+}
+}  // namespace
+
+/**
+ * @brief Thread calling the reporters of a TimeKeeper with the trees passed through a queue
+ */
+class TimeKeeper::AsyncReporter
+{
+public:
+  AsyncReporter(const TimeKeeper & time_keeper, const size_t queue_size)
+  : time_keeper_(time_keeper), reports_(queue_size), free_arenas_(queue_size)
+  {
+    thread_ = std::thread([this] { run(); });
+  }
+
+  ~AsyncReporter()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+  }
+
+  AsyncReporter(const AsyncReporter &) = delete;
+  AsyncReporter & operator=(const AsyncReporter &) = delete;
+
+  void push(std::shared_ptr<ProcessingTimeNode> tree)
+  {
+    if (!reports_.push(Report{std::move(tree), nullptr})) {
+      ++dropped_;
+      return;
+    }
+    condition_.notify_one();
+  }
+
+  /// @brief pass the arena to the background thread, leaving a reported one in its place
+  void push(ProcessingTimeArena & arena)
+  {
+    std::unique_ptr<ProcessingTimeArena> spare;
+    if (!free_arenas_.pop(spare)) {
+      spare = std::make_unique<ProcessingTimeArena>();
+    }
+    std::swap(*spare, arena);
+    Report report{nullptr, std::move(spare)};
+    if (!reports_.push(std::move(report))) {
+      // the push only moves on success, and the next track clears the arena
+      std::swap(*report.arena, arena);
+      ++dropped_;
+      return;
+    }
+    condition_.notify_one();
+  }
+
+  size_t dropped() const { return dropped_; }
+
+private:
+  struct Report
+  {
+    std::shared_ptr<ProcessingTimeNode> tree;
+    std::unique_ptr<ProcessingTimeArena> arena;
+  };
+
+  void run()
+  {
+    while (true) {
+      Report report;
+      if (reports_.pop(report)) {
+        if (report.tree) {
+          for (const auto & reporter : time_keeper_.reporters_) {
+            reporter(report.tree);
+          }
+        } else {
+          for (const auto & reporter : time_keeper_.arena_reporters_) {
+            reporter(*report.arena);
+          }
+          free_arenas_.push(std::move(report.arena));
+        }
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stop_) {
+        return;
+      }
+      // the notification of a push between the pop and the wait is caught by the timeout
+      condition_.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  const TimeKeeper & time_keeper_;
+  SpscQueue<Report> reports_;
+  SpscQueue<std::unique_ptr<ProcessingTimeArena>> free_arenas_;
+  size_t dropped_{0};  //!< Only accessed by the tracked thread
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_{false};
+  std::thread thread_;
+};
+
+ProcessingTimeNode::ProcessingTimeNode(const std::string & name)
+: name_(name), start_time_(std::chrono::steady_clock::now())
 {
 }
 
@@ -39,6 +217,12 @@ std::shared_ptr<ProcessingTimeNode> ProcessingTimeNode::add_child(const std::str
   return new_child_node;
 }
 
+void ProcessingTimeNode::adopt_child(const std::shared_ptr<ProcessingTimeNode> & child)
+{
+  child->parent_node_ = weak_from_this();
+  child_nodes_.push_back(child);
+}
+
 std::string ProcessingTimeNode::to_string() const
 {
   std::function<void(
@@ -49,10 +233,19 @@ std::string ProcessingTimeNode::to_string() const
       if (!is_root) {
         oss << prefix << (is_last ? "└── " : "├── ");
       }
+      oss << node.name_;
+      if (node.thread_index_ != 0) {
+        oss << " [thread " << node.thread_index_ << "]";
+      }
+      oss << " (" << node.processing_time_ << "ms";
+      const auto usage = usage_to_string_impl(node.resource_usage_, node.perf_counters_);
+      if (!usage.empty()) {
+        oss << ", " << usage;
+      }
       if (!node.comment_.empty()) {
-        oss << node.name_ << " (" << node.processing_time_ << "ms) : " << node.comment_ << "\n";
+        oss << ") : " << node.comment_ << "\n";
       } else {
-        oss << node.name_ << " (" << node.processing_time_ << "ms)\n";
+        oss << ")\n";
       }
       for (size_t i = 0; i < node.child_nodes_.size(); ++i) {
         const auto & child = node.child_nodes_[i];
@@ -83,6 +276,14 @@ autoware_internal_debug_msgs::msg::ProcessingTimeTree ProcessingTimeNode::to_msg
       time_node_msg.id = static_cast<int>(tree_msg.nodes.size() + 1);
       time_node_msg.parent_id = parent_id;
       time_node_msg.comment = node.comment_;
+      const auto usage = usage_to_string_impl(node.resource_usage_, node.perf_counters_);
+      if (!usage.empty()) {
+        time_node_msg.comment = fmt::format("[{}] {}", usage, time_node_msg.comment);
+      }
+      if (node.thread_index_ != 0) {
+        time_node_msg.comment =
+          fmt::format("[thread {}] {}", node.thread_index_, time_node_msg.comment);
+      }
       tree_msg.nodes.emplace_back(time_node_msg);
 
       for (const auto & child : node.child_nodes_) {
@@ -112,17 +313,192 @@ void ProcessingTimeNode::set_comment(const std::string & comment)
   comment_ = comment;
 }
 
+void ProcessingTimeNode::set_thread_index(const size_t thread_index)
+{
+  thread_index_ = thread_index;
+}
+
 std::string ProcessingTimeNode::get_name() const
 {
   return name_;
 }
 
+double ProcessingTimeNode::get_time() const
+{
+  return processing_time_;
+}
+
+std::string ProcessingTimeNode::get_comment() const
+{
+  return comment_;
+}
+
+size_t ProcessingTimeNode::get_thread_index() const
+{
+  return thread_index_;
+}
+
+std::chrono::steady_clock::time_point ProcessingTimeNode::get_start_time() const
+{
+  return start_time_;
+}
+
+void ProcessingTimeNode::set_resource_usage(const ResourceUsage & usage)
+{
+  resource_usage_ = usage;
+}
+
+std::optional<ResourceUsage> ProcessingTimeNode::get_resource_usage() const
+{
+  return resource_usage_;
+}
+
+void ProcessingTimeNode::set_perf_counters(const std::optional<PerfCounterValues> & values)
+{
+  perf_counters_ = values;
+}
+
+std::optional<PerfCounterValues> ProcessingTimeNode::get_perf_counters() const
+{
+  return perf_counters_;
+}
+
+size_t ProcessingTimeArena::intern(const std::string & name)
+{
+  const auto it = name_indices_.find(name);
+  if (it != name_indices_.end()) {
+    return it->second;
+  }
+  names_.push_back(name);
+  name_indices_.emplace(name, names_.size() - 1);
+  return names_.size() - 1;
+}
+
+size_t ProcessingTimeArena::intern_literal(const char * name)
+{
+  const auto it = literal_indices_.find(name);
+  if (it != literal_indices_.end()) {
+    return it->second;
+  }
+  const size_t index = intern(name);
+  literal_indices_.emplace(name, index);
+  return index;
+}
+
+size_t ProcessingTimeArena::add(const size_t name, const size_t parent)
+{
+  if (size_ == nodes_.size()) {
+    nodes_.emplace_back();
+  }
+  const size_t index = size_++;
+  Node & node = nodes_[index];
+  node.name = name;
+  node.parent = parent;
+  node.first_child = none;
+  node.last_child = none;
+  node.next_sibling = none;
+  node.processing_time = 0.0;
+  node.comment.clear();
+  node.resource_usage.reset();
+  node.perf_counters.reset();
+
+  if (parent != none) {
+    Node & parent_node = nodes_[parent];
+    if (parent_node.last_child == none) {
+      parent_node.first_child = index;
+    } else {
+      nodes_[parent_node.last_child].next_sibling = index;
+    }
+    parent_node.last_child = index;
+  }
+  return index;
+}
+
+void ProcessingTimeArena::set_time(const size_t node, const double processing_time)
+{
+  nodes_[node].processing_time = processing_time;
+}
+
+void ProcessingTimeArena::set_comment(const size_t node, const std::string & comment)
+{
+  nodes_[node].comment = comment;
+}
+
+std::string ProcessingTimeArena::to_string() const
+{
+  std::function<void(size_t, std::ostringstream &, const std::string &, bool, bool)>
+    construct_string = [&](
+                         const size_t index, std::ostringstream & oss, const std::string & prefix,
+                         bool is_last, bool is_root) {
+      const Node & node = nodes_[index];
+      if (!is_root) {
+        oss << prefix << (is_last ? "└── " : "├── ");
+      }
+      oss << names_[node.name] << " (" << node.processing_time << "ms";
+      const auto usage = usage_to_string_impl(node.resource_usage, node.perf_counters);
+      if (!usage.empty()) {
+        oss << ", " << usage;
+      }
+      if (!node.comment.empty()) {
+        oss << ") : " << node.comment << "\n";
+      } else {
+        oss << ")\n";
+      }
+      for (size_t child = node.first_child; child != none; child = nodes_[child].next_sibling) {
+        construct_string(
+          child, oss, prefix + (is_last ? "    " : "│   "), nodes_[child].next_sibling == none,
+          false);
+      }
+    };
+
+  std::ostringstream oss;
+  if (size_ != 0) {
+    construct_string(0, oss, "", true, true);
+  }
+  return oss.str();
+}
+
+autoware_internal_debug_msgs::msg::ProcessingTimeTree ProcessingTimeArena::to_msg() const
+{
+  autoware_internal_debug_msgs::msg::ProcessingTimeTree time_tree_msg;
+  time_tree_msg.nodes.reserve(size_);
+
+  std::function<void(size_t, int)> construct_msg = [&](const size_t index, int parent_id) {
+    const Node & node = nodes_[index];
+    autoware_internal_debug_msgs::msg::ProcessingTimeNode time_node_msg;
+    time_node_msg.name = names_[node.name];
+    time_node_msg.processing_time = node.processing_time;
+    time_node_msg.id = static_cast<int>(time_tree_msg.nodes.size() + 1);
+    time_node_msg.parent_id = parent_id;
+    time_node_msg.comment = node.comment;
+    const auto usage = usage_to_string_impl(node.resource_usage, node.perf_counters);
+    if (!usage.empty()) {
+      time_node_msg.comment = fmt::format("[{}] {}", usage, node.comment);
+    }
+    time_tree_msg.nodes.emplace_back(time_node_msg);
+
+    const int id = time_node_msg.id;
+    for (size_t child = node.first_child; child != none; child = nodes_[child].next_sibling) {
+      construct_msg(child, id);
+    }
+  };
+  if (size_ != 0) {
+    construct_msg(0, 0);
+  }
+
+  return time_tree_msg;
+}
+
 void TimeKeeper::add_reporter(std::ostream * os)
 {
   reporters_.emplace_back([os](const std::shared_ptr<ProcessingTimeNode> & node) {
     *os << "==========================" << std::endl;
     *os << node->to_string() << std::endl;
   });
+  arena_reporters_.emplace_back([os](const ProcessingTimeArena & arena) {
+    *os << "==========================" << std::endl;
+    *os << arena.to_string() << std::endl;
+  });
 }
 
 void TimeKeeper::add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher)
@@ -130,29 +506,366 @@ void TimeKeeper::add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr
   reporters_.emplace_back([publisher](const std::shared_ptr<ProcessingTimeNode> & node) {
     publisher->publish(node->to_msg());
   });
+  arena_reporters_.emplace_back(
+    [publisher](const ProcessingTimeArena & arena) { publisher->publish(arena.to_msg()); });
+}
+
+void TimeKeeper::add_reporter(std::shared_ptr<ChromeTraceWriter> writer)
+{
+  reporters_.emplace_back(
+    [writer](const std::shared_ptr<ProcessingTimeNode> & node) { writer->write(*node); });
+  arena_reporters_.emplace_back(
+    [writer](const ProcessingTimeArena & arena) { writer->write(arena); });
+}
+
+void TimeKeeper::add_reporter(std::shared_ptr<ProcessingTimeTreeEncoder> encoder)
+{
+  reporters_.emplace_back(
+    [encoder](const std::shared_ptr<ProcessingTimeNode> & node) { encoder->publish(*node); });
+  arena_reporters_.emplace_back(
+    [encoder](const ProcessingTimeArena & arena) { encoder->publish(arena); });
+}
+
+void TimeKeeper::add_reporter(std::shared_ptr<TimeBudgetWatchdog> watchdog)
+{
+  reporters_.emplace_back(
+    [watchdog](const std::shared_ptr<ProcessingTimeNode> & node) { watchdog->check(*node); });
+  arena_reporters_.emplace_back(
+    [watchdog](const ProcessingTimeArena & arena) { watchdog->check(arena); });
+}
+
+TimeKeeper::~TimeKeeper() = default;
+
+void TimeKeeper::start_async_reporting(const size_t queue_size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("start_async_reporting() is called while a track is in progress");
+  }
+  if (async_reporter_) {
+    dropped_reports_ += async_reporter_->dropped();
+  }
+  async_reporter_ = std::make_shared<AsyncReporter>(*this, queue_size);
+}
+
+void TimeKeeper::stop_async_reporting()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("stop_async_reporting() is called while a track is in progress");
+  }
+  if (async_reporter_) {
+    dropped_reports_ += async_reporter_->dropped();
+  }
+  async_reporter_.reset();
+}
+
+size_t TimeKeeper::dropped_reports() const
+{
+  return dropped_reports_ + (async_reporter_ ? async_reporter_->dropped() : 0);
+}
+
+void ProcessingTimeAggregate::add(const ProcessingTimeArena & arena)
+{
+  // the parents are added before their children
+  std::vector<size_t> paths(arena.size());
+  for (size_t node = 0; node < arena.size(); ++node) {
+    const size_t parent = arena.get_parent(node);
+    paths[node] = find_or_add(
+      arena.get_name(node), parent == ProcessingTimeArena::none ? parent : paths[parent]);
+    nodes_[paths[node]].times.add(arena.get_time(node));
+    nodes_[paths[node]].p99.add(arena.get_time(node));
+  }
+  ++cycles_;
+}
+
+void ProcessingTimeAggregate::add(const ProcessingTimeNode & root)
+{
+  add_subtree(root, ProcessingTimeArena::none);
+  ++cycles_;
+}
+
+void ProcessingTimeAggregate::add_subtree(const ProcessingTimeNode & node, const size_t parent)
+{
+  const size_t path = find_or_add(node.get_name(), parent);
+  nodes_[path].times.add(node.get_time());
+  nodes_[path].p99.add(node.get_time());
+  for (const auto & child : node.get_child_nodes()) {
+    add_subtree(*child, path);
+  }
+}
+
+size_t ProcessingTimeAggregate::find_or_add(const std::string & name, const size_t parent)
+{
+  auto & siblings = parent == ProcessingTimeArena::none ? roots_ : nodes_[parent].children;
+  for (const size_t sibling : siblings) {
+    if (nodes_[sibling].name == name) {
+      return sibling;
+    }
+  }
+  const size_t path = nodes_.size();
+  siblings.push_back(path);
+  nodes_.push_back(Node{name, {}, {}, autoware_utils_math::P2Quantile{0.99}});
+  return path;
+}
+
+void ProcessingTimeAggregate::clear()
+{
+  nodes_.clear();
+  roots_.clear();
+  cycles_ = 0;
+}
+
+void ProcessingTimeAggregate::to_arena(ProcessingTimeArena & arena) const
+{
+  arena.clear();
+  std::function<void(size_t, size_t)> add_to_arena = [&](size_t path, size_t parent) {
+    const Node & node = nodes_[path];
+    const size_t index = arena.add(arena.intern(node.name), parent);
+    arena.set_time(index, static_cast<double>(node.times.mean()));
+    arena.set_comment(
+      index, fmt::format(
+               "count={} max={:.3f} p99={:.3f}", node.times.count(), node.times.max(),
+               node.p99.quantile()));
+    for (const size_t child : node.children) {
+      add_to_arena(child, index);
+    }
+  };
+  for (const size_t root : roots_) {
+    add_to_arena(root, ProcessingTimeArena::none);
+  }
+}
+
+void TimeKeeper::use_arena(const bool enable)
+{
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("use_arena() is called while a track is in progress");
+  }
+  use_arena_ = enable;
+}
+
+void TimeKeeper::use_aggregation(const size_t cycles)
+{
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("use_aggregation() is called while a track is in progress");
+  }
+  aggregation_cycles_ = cycles;
+  aggregate_.clear();
+}
+
+void TimeKeeper::request_aggregation(const size_t cycles)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  requested_aggregation_cycles_ = cycles;
+}
+
+void TimeKeeper::apply_requested_aggregation()
+{
+  if (requested_aggregation_cycles_) {
+    aggregation_cycles_ = *requested_aggregation_cycles_;
+    aggregate_.clear();
+    requested_aggregation_cycles_.reset();
+  }
+}
+
+void TimeKeeper::use_resource_usage(const bool enable)
+{
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("use_resource_usage() is called while a track is in progress");
+  }
+  use_resource_usage_ = enable;
+}
+
+void TimeKeeper::use_perf_counters(const bool enable)
+{
+  if (current_time_node_ != nullptr || current_arena_node_ != ProcessingTimeArena::none) {
+    throw std::runtime_error("use_perf_counters() is called while a track is in progress");
+  }
+  if (enable && !thread_perf_counters()) {
+    // open them again for the message of the error
+    PerfCounters counters;
+  }
+  use_perf_counters_ = enable;
 }
 
 void TimeKeeper::start_track(const std::string & func_name)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (use_arena_) {
+    start_arena_track(arena_.intern(func_name), func_name.c_str());
+    return;
+  }
   if (current_time_node_ == nullptr) {
+    apply_requested_aggregation();
     current_time_node_ = std::make_shared<ProcessingTimeNode>(func_name);
     root_node_ = current_time_node_;
     root_node_thread_id_ = std::this_thread::get_id();
   } else {
     if (root_node_thread_id_ != std::this_thread::get_id()) {
-      const auto warning_msg = fmt::format(
-        "TimeKeeper::start_track({}) is called from a different thread. Ignoring the call.",
-        func_name);
-      RCLCPP_WARN(rclcpp::get_logger("TimeKeeper"), "%s", warning_msg.c_str());
+      start_thread_track(func_name);
       return;
     }
     current_time_node_ = current_time_node_->add_child(func_name);
   }
+  // the values at the start, replaced by the differences at the end
+  if (use_resource_usage_) {
+    current_time_node_->set_resource_usage(thread_resource_usage());
+  }
+  if (use_perf_counters_) {
+    current_time_node_->set_perf_counters(thread_perf_counters());
+  }
   stop_watch_.tic(func_name);
 }
 
+void TimeKeeper::start_literal_track(const char * func_name)
+{
+  if (!use_arena_) {
+    start_track(func_name);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  start_arena_track(arena_.intern_literal(func_name), func_name);
+}
+
+void TimeKeeper::end_literal_track(const char * func_name)
+{
+  if (!use_arena_) {
+    end_track(func_name);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (root_node_thread_id_ == std::this_thread::get_id()) {
+    end_arena_track(func_name);
+  }
+}
+
+void TimeKeeper::start_arena_track(const size_t name, const char * func_name)
+{
+  if (current_arena_node_ == ProcessingTimeArena::none) {
+    apply_requested_aggregation();
+    arena_.clear();
+    root_node_thread_id_ = std::this_thread::get_id();
+  } else if (root_node_thread_id_ != std::this_thread::get_id()) {
+    const auto warning_msg = fmt::format(
+      "TimeKeeper::start_track({}) is called from a different thread. Ignoring the call.",
+      func_name);
+    RCLCPP_WARN(rclcpp::get_logger("TimeKeeper"), "%s", warning_msg.c_str());
+    return;
+  }
+  current_arena_node_ = arena_.add(name, current_arena_node_);
+  if (use_resource_usage_) {
+    arena_.set_resource_usage(current_arena_node_, thread_resource_usage());
+  }
+  if (use_perf_counters_) {
+    arena_.set_perf_counters(current_arena_node_, thread_perf_counters());
+  }
+  arena_.set_start_time(current_arena_node_, std::chrono::steady_clock::now());
+}
+
+void TimeKeeper::end_arena_track(const char * func_name)
+{
+  if (arena_.get_name(current_arena_node_) != func_name) {
+    throw std::runtime_error(
+      fmt::format(
+        "You must call end_track({}) first, but end_track({}) is called",
+        arena_.get_name(current_arena_node_), func_name));
+  }
+  // truncated to microseconds, as the StopWatch of the tree mode
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - arena_.get_start_time(current_arena_node_));
+  arena_.set_time(current_arena_node_, static_cast<double>(duration.count()) / 1000.0);
+  if (use_resource_usage_) {
+    arena_.set_resource_usage(
+      current_arena_node_,
+      thread_resource_usage() - *arena_.get_resource_usage(current_arena_node_));
+  }
+  if (use_perf_counters_) {
+    arena_.set_perf_counters(
+      current_arena_node_, perf_counters_delta_impl(arena_.get_perf_counters(current_arena_node_)));
+  }
+  current_arena_node_ = arena_.get_parent(current_arena_node_);
+
+  if (current_arena_node_ == ProcessingTimeArena::none) {
+    report();
+  }
+}
+
+void TimeKeeper::start_thread_track(const std::string & func_name)
+{
+  auto it = thread_tracks_.find(std::this_thread::get_id());
+  if (it == thread_tracks_.end()) {
+    it = thread_tracks_.emplace(std::this_thread::get_id(), ThreadTrack{}).first;
+    it->second.index = thread_tracks_.size();
+  }
+  ThreadTrack & track = it->second;
+  if (track.current_node == nullptr) {
+    track.root_node = std::make_shared<ProcessingTimeNode>(func_name);
+    track.root_node->set_thread_index(track.index);
+    track.current_node = track.root_node;
+    track.parent_node = current_time_node_;
+  } else {
+    track.current_node = track.current_node->add_child(func_name);
+  }
+  if (use_resource_usage_) {
+    track.current_node->set_resource_usage(thread_resource_usage());
+  }
+  if (use_perf_counters_) {
+    track.current_node->set_perf_counters(thread_perf_counters());
+  }
+  track.stop_watch.tic(func_name);
+}
+
+void TimeKeeper::end_thread_track(const std::string & func_name)
+{
+  const auto it = thread_tracks_.find(std::this_thread::get_id());
+  if (it == thread_tracks_.end() || it->second.current_node == nullptr) {
+    return;  // the start was ignored
+  }
+  ThreadTrack & track = it->second;
+  if (track.current_node->get_name() != func_name) {
+    throw std::runtime_error(
+      fmt::format(
+        "You must call end_track({}) first, but end_track({}) is called",
+        track.current_node->get_name(), func_name));
+  }
+  track.current_node->set_time(track.stop_watch.toc(func_name));
+  if (use_resource_usage_) {
+    track.current_node->set_resource_usage(
+      thread_resource_usage() - *track.current_node->get_resource_usage());
+  }
+  if (use_perf_counters_) {
+    track.current_node->set_perf_counters(
+      perf_counters_delta_impl(track.current_node->get_perf_counters()));
+  }
+  const auto parent = track.current_node->get_parent_node().lock();
+  if (parent == nullptr) {
+    track.parent_node->adopt_child(track.root_node);
+    track.parent_node.reset();
+    track.root_node.reset();
+  }
+  track.current_node = parent;
+}
+
 void TimeKeeper::comment(const std::string & comment)
 {
+  if (!is_enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (use_arena_) {
+    if (current_arena_node_ == ProcessingTimeArena::none) {
+      throw std::runtime_error("You must call start_track() first, but comment() is called");
+    }
+    arena_.set_comment(current_arena_node_, comment);
+    return;
+  }
+  if (current_time_node_ != nullptr && root_node_thread_id_ != std::this_thread::get_id()) {
+    const auto it = thread_tracks_.find(std::this_thread::get_id());
+    if (it != thread_tracks_.end() && it->second.current_node != nullptr) {
+      it->second.current_node->set_comment(comment);
+    }
+    return;
+  }
   if (current_time_node_ == nullptr) {
     throw std::runtime_error("You must call start_track() first, but comment() is called");
   }
@@ -161,7 +874,15 @@ void TimeKeeper::comment(const std::string & comment)
 
 void TimeKeeper::end_track(const std::string & func_name)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
   if (root_node_thread_id_ != std::this_thread::get_id()) {
+    if (!use_arena_) {
+      end_thread_track(func_name);
+    }
+    return;
+  }
+  if (use_arena_) {
+    end_arena_track(func_name.c_str());
     return;
   }
   if (current_time_node_->get_name() != func_name) {
@@ -172,6 +893,14 @@ void TimeKeeper::end_track(const std::string & func_name)
   }
   const double processing_time = stop_watch_.toc(func_name);
   current_time_node_->set_time(processing_time);
+  if (use_resource_usage_) {
+    current_time_node_->set_resource_usage(
+      thread_resource_usage() - *current_time_node_->get_resource_usage());
+  }
+  if (use_perf_counters_) {
+    current_time_node_->set_perf_counters(
+      perf_counters_delta_impl(current_time_node_->get_perf_counters()));
+  }
   current_time_node_ = current_time_node_->get_parent_node().lock();
 
   if (current_time_node_ == nullptr) {
@@ -181,19 +910,53 @@ void TimeKeeper::end_track(const std::string & func_name)
 
 void TimeKeeper::report()
 {
+  if (aggregation_cycles_ != 0) {
+    if (use_arena_) {
+      aggregate_.add(arena_);
+    } else {
+      aggregate_.add(*root_node_);
+      current_time_node_.reset();
+      root_node_.reset();
+    }
+    if (aggregate_.cycles() >= aggregation_cycles_) {
+      aggregate_.to_arena(aggregate_arena_);
+      aggregate_.clear();
+      report_arena(aggregate_arena_);
+    }
+    return;
+  }
+  if (use_arena_) {
+    report_arena(arena_);
+    return;
+  }
   if (current_time_node_ != nullptr) {
     throw std::runtime_error(
       fmt::format(
         "You must call end_track({}) first, but report() is called",
         current_time_node_->get_name()));
   }
-  for (const auto & reporter : reporters_) {
-    reporter(root_node_);
+  if (async_reporter_) {
+    async_reporter_->push(std::move(root_node_));
+  } else {
+    for (const auto & reporter : reporters_) {
+      reporter(root_node_);
+    }
   }
   current_time_node_.reset();
   root_node_.reset();
 }
 
+void TimeKeeper::report_arena(ProcessingTimeArena & arena)
+{
+  if (async_reporter_) {
+    async_reporter_->push(arena);
+    return;
+  }
+  for (const auto & reporter : arena_reporters_) {
+    reporter(arena);
+  }
+}
+
 ScopedTimeTrack::ScopedTimeTrack(const std::string & func_name, TimeKeeper & time_keeper)
 : func_name_(func_name), time_keeper_(time_keeper)
 {
@@ -0,0 +1,95 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/chrome_trace_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using autoware_utils_debug::ChromeTraceWriter;
+using autoware_utils_debug::ScopedTimeTrack;
+using autoware_utils_debug::TimeKeeper;
+
+namespace
+{
+std::string read_file(const std::string & path)
+{
+  std::ifstream file(path);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+bool exists(const std::string & path)
+{
+  return std::ifstream(path).good();
+}
+}  // namespace
+
+TEST(TestChromeTraceWriter, Events)
+{
+  const std::string path = testing::TempDir() + "chrome_trace_writer_events.json";
+  for (const bool arena : {false, true}) {
+    {
+      TimeKeeper time_keeper(std::make_shared<ChromeTraceWriter>(path));
+      time_keeper.use_arena(arena);
+      ScopedTimeTrack root("root", time_keeper);
+      ScopedTimeTrack child("child \"quoted\"", time_keeper);
+      time_keeper.comment("line\nbreak");
+      std::thread([&time_keeper] { ScopedTimeTrack work("work", time_keeper); }).join();
+    }
+    const std::string trace = read_file(path);
+    EXPECT_EQ(trace.front(), '[');
+    EXPECT_EQ(trace.substr(trace.size() - 3), "\n]\n");
+    const auto root_event = "{\"name\":\"root\",\"cat\":\"time_keeper\",\"ph\":\"X\",\"ts\":";
+    EXPECT_NE(trace.find(root_event), std::string::npos) << trace;
+    EXPECT_NE(trace.find("\"name\":\"child \\\"quoted\\\"\""), std::string::npos) << trace;
+    EXPECT_NE(trace.find(",\"args\":{\"comment\":\"line\\nbreak\"}}"), std::string::npos) << trace;
+    // the tracks of the other threads are ignored in the arena mode
+    const auto work_event = trace.find("{\"name\":\"work\"");
+    EXPECT_EQ(work_event == std::string::npos, arena) << trace;
+    EXPECT_EQ(trace.find("\"tid\":1}") == std::string::npos, arena) << trace;
+  }
+  std::remove(path.c_str());
+}
+
+TEST(TestChromeTraceWriter, Rotation)
+{
+  const std::string path = testing::TempDir() + "chrome_trace_writer_rotation.json";
+  {
+    auto writer = std::make_shared<ChromeTraceWriter>(path, 1, 2);
+    TimeKeeper time_keeper(writer);
+    for (int i = 0; i < 3; ++i) {
+      ScopedTimeTrack root("cycle" + std::to_string(i), time_keeper);
+    }
+  }
+  // each cycle exceeds the size, so the file only has the last one
+  EXPECT_EQ(read_file(path), "[\n]\n");
+  const std::string previous = read_file(path + ".1");
+  EXPECT_NE(previous.find("\"name\":\"cycle2\""), std::string::npos) << previous;
+  EXPECT_EQ(previous.substr(previous.size() - 3), "\n]\n");
+  EXPECT_FALSE(exists(path + ".2"));
+  std::remove(path.c_str());
+  std::remove((path + ".1").c_str());
+
+  EXPECT_THROW(ChromeTraceWriter(path, 1, 0), std::invalid_argument);
+  EXPECT_THROW(ChromeTraceWriter("/nonexistent/trace.json"), std::runtime_error);
+}
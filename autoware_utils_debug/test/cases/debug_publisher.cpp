@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <stdexcept>
 
 using autoware_utils_debug::DebugPublisher;
 
@@ -25,3 +26,19 @@ TEST(TestDebugPublisher, Instantiation)
   const auto node = std::make_shared<rclcpp::Node>("test_node");
   DebugPublisher(node.get(), "namespace");
 }
+
+TEST(TestDebugPublisher, RegisterTopic)
+{
+  using autoware_internal_debug_msgs::msg::Float64Stamped;
+  using autoware_internal_debug_msgs::msg::StringStamped;
+
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  DebugPublisher debug_publisher(node.get(), "namespace");
+  const auto publisher = debug_publisher.register_topic<Float64Stamped>("value");
+  ASSERT_NE(publisher, nullptr);
+
+  // the registered publisher is shared with publish() and the next registrations
+  EXPECT_EQ(debug_publisher.register_topic<Float64Stamped>("value"), publisher);
+  debug_publisher.publish<Float64Stamped>("value", 1.0);
+  EXPECT_THROW(debug_publisher.register_topic<StringStamped>("value"), std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/perf_counters.hpp"
+
+#include "autoware_utils_debug/time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using autoware_utils_debug::PerfCounters;
+using autoware_utils_debug::PerfCounterValues;
+using autoware_utils_debug::ScopedTimeTrack;
+using autoware_utils_debug::TimeKeeper;
+
+TEST(TestPerfCounters, Values)
+{
+  const PerfCounterValues start{100, 50, 1, 2};
+  const PerfCounterValues end{300, 350, 4, 2};
+  const auto values = end - start;
+  EXPECT_DOUBLE_EQ(values.ipc(), 1.5);
+  EXPECT_DOUBLE_EQ(PerfCounterValues{}.ipc(), 0.0);
+  EXPECT_EQ(
+    autoware_utils_debug::to_string(values),
+    "200 cycles, IPC 1.50, 3 cache misses, 0 branch misses");
+}
+
+TEST(TestPerfCounters, Multiplexed)
+{
+  // counting during half of the interval, the counts are doubled
+  const PerfCounterValues start{100, 50, 1, 2, 1000, 1000};
+  const PerfCounterValues end{300, 350, 4, 2, 3000, 2000};
+  const auto values = end - start;
+  EXPECT_EQ(values.cycles, 400u);
+  EXPECT_EQ(values.instructions, 600u);
+  EXPECT_EQ(values.cache_misses, 6u);
+  EXPECT_EQ(values.branch_misses, 0u);
+  EXPECT_EQ(values.time_enabled, 2000u);
+  EXPECT_EQ(values.time_running, 2000u);
+}
+
+TEST(TestPerfCounters, NonMonotonic)
+{
+  // the values of a failed read, or decreasing ones, give 0 rather than wrapping around
+  const PerfCounterValues start{100, 50, 1, 2, 1000, 1000};
+  const auto failed = PerfCounterValues{} - start;
+  EXPECT_EQ(failed.cycles, 0u);
+  EXPECT_EQ(failed.instructions, 0u);
+  EXPECT_EQ(failed.cache_misses, 0u);
+  EXPECT_EQ(failed.branch_misses, 0u);
+  EXPECT_DOUBLE_EQ(failed.ipc(), 0.0);
+
+  const PerfCounterValues end{90, 60, 1, 1, 1500, 1500};
+  const auto values = end - start;
+  EXPECT_EQ(values.cycles, 0u);
+  EXPECT_EQ(values.instructions, 10u);
+  EXPECT_EQ(values.branch_misses, 0u);
+}
+
+TEST(TestPerfCounters, TimeKeeper)
+{
+  std::ostringstream report;
+  TimeKeeper time_keeper(&report);
+  std::unique_ptr<PerfCounters> counters;
+  try {
+    counters = std::make_unique<PerfCounters>();
+  } catch (const std::runtime_error &) {
+    // e.g. in a virtual machine without a virtual PMU
+    EXPECT_FALSE(autoware_utils_debug::thread_perf_counters());
+    EXPECT_THROW(time_keeper.use_perf_counters(true), std::runtime_error);
+    GTEST_SKIP() << "The hardware counters are not available.";
+  }
+  const auto before = counters->read();
+  ASSERT_TRUE(before);
+  volatile double sum = 0.0;
+  for (int i = 0; i < 100000; ++i) {
+    sum = sum + i;
+  }
+  const auto after = counters->read();
+  ASSERT_TRUE(after);
+  const auto values = *after - *before;
+  EXPECT_GT(values.instructions, 100000u);
+
+  for (const bool arena : {false, true}) {
+    report.str("");
+    time_keeper.use_arena(arena);
+    time_keeper.use_perf_counters(true);
+    {
+      ScopedTimeTrack root("root", time_keeper);
+      ScopedTimeTrack child("child", time_keeper);
+    }
+    EXPECT_NE(report.str().find("root ("), std::string::npos) << report.str();
+    EXPECT_NE(report.str().find(" cycles, IPC "), std::string::npos) << report.str();
+    time_keeper.use_perf_counters(false);
+  }
+}
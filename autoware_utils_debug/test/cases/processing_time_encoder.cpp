@@ -0,0 +1,123 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/processing_time_encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using autoware_utils_debug::ProcessingTimeDetail;
+using autoware_utils_debug::ProcessingTimeTreeDecoder;
+using autoware_utils_debug::ProcessingTimeTreeEncoder;
+
+namespace
+{
+void expect_same_tree(const ProcessingTimeDetail & tree, const ProcessingTimeDetail & expected)
+{
+  ASSERT_EQ(tree.nodes.size(), expected.nodes.size());
+  for (size_t i = 0; i < tree.nodes.size(); ++i) {
+    EXPECT_EQ(tree.nodes[i].id, expected.nodes[i].id);
+    EXPECT_EQ(tree.nodes[i].parent_id, expected.nodes[i].parent_id);
+    EXPECT_EQ(tree.nodes[i].name, expected.nodes[i].name);
+    EXPECT_EQ(tree.nodes[i].comment, expected.nodes[i].comment);
+    EXPECT_DOUBLE_EQ(tree.nodes[i].processing_time, expected.nodes[i].processing_time);
+  }
+}
+}  // namespace
+
+TEST(TestProcessingTimeEncoder, RoundTrip)
+{
+  EXPECT_THROW(ProcessingTimeTreeEncoder(nullptr, 0), std::invalid_argument);
+
+  const auto root = std::make_shared<autoware_utils_debug::ProcessingTimeNode>("root");
+  const auto a = root->add_child("a_long_function_name");
+  a->add_child("b_long_function_name")->set_time(1.0);
+  a->add_child("b_long_function_name")->set_time(2.0);
+  a->set_time(3.0);
+  a->set_comment("3 objects");
+  root->set_time(4.0);
+  const auto tree = root->to_msg();
+
+  ProcessingTimeTreeEncoder encoder(nullptr, 3);
+  ProcessingTimeTreeDecoder decoder;
+  ProcessingTimeDetail encoded;
+  ProcessingTimeDetail decoded;
+
+  // the first report sends the names, once per name
+  encoder.encode(tree, encoded);
+  ASSERT_EQ(encoded.nodes.size(), 4u);
+  EXPECT_EQ(encoded.nodes[0].name, "#0:root");
+  EXPECT_EQ(encoded.nodes[2].name, "#2:b_long_function_name");
+  EXPECT_EQ(encoded.nodes[3].name, "#2");
+  EXPECT_TRUE(decoder.decode(encoded, decoded));
+  expect_same_tree(decoded, tree);
+
+  // the next reports only send the indices, until the period of the table
+  encoder.encode(tree, encoded);
+  EXPECT_EQ(encoded.nodes[1].name, "#1");
+  EXPECT_EQ(encoded.nodes[1].comment, "3 objects");
+  EXPECT_TRUE(decoder.decode(encoded, decoded));
+  expect_same_tree(decoded, tree);
+
+  ProcessingTimeTreeDecoder late_decoder;
+  EXPECT_FALSE(late_decoder.decode(encoded, decoded));
+  EXPECT_EQ(decoded.nodes[1].name, "#1");
+  encoder.encode(tree, encoded);
+  EXPECT_FALSE(late_decoder.decode(encoded, decoded));
+  encoder.encode(tree, encoded);
+  EXPECT_EQ(encoded.nodes[1].name, "#1:a_long_function_name");
+  EXPECT_TRUE(late_decoder.decode(encoded, decoded));
+  expect_same_tree(decoded, tree);
+
+  // a new name sends the table again
+  a->add_child("c")->set_time(0.5);
+  const auto grown_tree = root->to_msg();
+  encoder.encode(grown_tree, encoded);
+  EXPECT_EQ(encoded.nodes[0].name, "#0:root");
+  EXPECT_EQ(encoded.nodes[4].name, "#3:c");
+  EXPECT_TRUE(decoder.decode(encoded, decoded));
+  expect_same_tree(decoded, grown_tree);
+
+  // the messages which are not encoded are copied
+  EXPECT_TRUE(decoder.decode(tree, decoded));
+  expect_same_tree(decoded, tree);
+}
+
+TEST(TestProcessingTimeEncoder, Omission)
+{
+  const auto root = std::make_shared<autoware_utils_debug::ProcessingTimeNode>("root");
+  const auto a = root->add_child("a");
+  a->add_child("b")->set_time(2.0);
+  a->set_time(0.5);
+  const auto c = root->add_child("c");
+  c->add_child("d")->set_time(0.1);
+  c->set_time(1.5);
+  c->set_comment("comment");
+  root->set_time(0.2);
+
+  ProcessingTimeTreeEncoder encoder(nullptr, 100, 1.0, false);
+  ProcessingTimeDetail encoded;
+  encoder.encode(root->to_msg(), encoded);
+
+  // the subtree of a is omitted although b is above the threshold, and the ids are contiguous
+  ASSERT_EQ(encoded.nodes.size(), 2u);
+  EXPECT_EQ(encoded.nodes[0].name, "#0:root");
+  EXPECT_EQ(encoded.nodes[1].name, "#3:c");
+  EXPECT_EQ(encoded.nodes[1].id, 2);
+  EXPECT_EQ(encoded.nodes[1].parent_id, 1);
+  EXPECT_TRUE(encoded.nodes[1].comment.empty());
+}
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <stdexcept>
 
 using autoware_utils_debug::ProcessingTimePublisher;
 
@@ -25,3 +26,17 @@ TEST(TestProcessingTimePublisher, Instantiation)
   const auto node = std::make_shared<rclcpp::Node>("test_node");
   ProcessingTimePublisher(node.get());
 }
+
+TEST(TestProcessingTimePublisher, FixedKeys)
+{
+  using Format = autoware_utils_debug::FixedKeyProcessingTimePublisher::Format;
+
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  for (const auto format : {Format::diagnostic_status, Format::float64_array}) {
+    autoware_utils_debug::FixedKeyProcessingTimePublisher publisher(
+      node.get(), {"a", "b"}, "~/debug/processing_time_ms", format);
+    EXPECT_EQ(publisher.size(), 2u);
+    EXPECT_NO_THROW(publisher.publish({1.0, 2.5}));
+    EXPECT_THROW(publisher.publish({1.0}), std::invalid_argument);
+  }
+}
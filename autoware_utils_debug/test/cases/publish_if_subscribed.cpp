@@ -0,0 +1,55 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/publish_if_subscribed.hpp"
+
+#include "autoware_utils_debug/debug_publisher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using autoware_internal_debug_msgs::msg::Float64Stamped;
+using autoware_utils_debug::DebugPublisher;
+
+TEST(TestPublishIfSubscribed, DebugPublisher)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  DebugPublisher debug_publisher(node.get(), "publish_if_subscribed");
+  int built = 0;
+  const auto build = [&built](Float64Stamped & msg) {
+    msg.data = 1.0;
+    ++built;
+  };
+
+  EXPECT_FALSE(debug_publisher.publish_if_subscribed<Float64Stamped>("value", build));
+  EXPECT_EQ(built, 0);
+
+  const auto subscription = node->create_subscription<Float64Stamped>(
+    "publish_if_subscribed/value", rclcpp::QoS(1), [](const Float64Stamped &) {});
+  const auto publisher = debug_publisher.register_topic<Float64Stamped>("value");
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!autoware_utils_debug::has_subscribers(*publisher) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(debug_publisher.publish_if_subscribed<Float64Stamped>("value", build));
+  EXPECT_EQ(built, 1);
+
+  debug_publisher.set_enabled(false);
+  EXPECT_FALSE(debug_publisher.publish_if_subscribed<Float64Stamped>("value", build));
+  EXPECT_EQ(built, 1);
+}
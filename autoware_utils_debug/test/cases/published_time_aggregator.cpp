@@ -0,0 +1,63 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/published_time_aggregator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+
+using autoware_utils_debug::LatencyGraph;
+
+TEST(TestPublishedTimeAggregator, LatencyGraph)
+{
+  LatencyGraph graph({{"a", "b"}, {"b", "c"}}, {{"a", "c"}}, 2);
+  const size_t a = graph.topic_index("a");
+  const size_t b = graph.topic_index("b");
+  const size_t c = graph.topic_index("c");
+  EXPECT_THROW(graph.topic_index("d"), std::invalid_argument);
+
+  // the published times arrive in any order
+  graph.add(a, 100, 1'000'000);
+  graph.add(c, 100, 5'000'000);
+  graph.add(b, 100, 2'000'000);
+  graph.add(b, 100, 9'000'000);  // the same stamp is ignored
+
+  auto statistics = graph.statistics();
+  ASSERT_EQ(statistics.size(), 3u);
+  EXPECT_EQ(statistics[0].name, "a -> b");
+  EXPECT_EQ(statistics[0].count, 1u);
+  EXPECT_DOUBLE_EQ(statistics[0].mean, 1.0);
+  EXPECT_DOUBLE_EQ(statistics[1].mean, 3.0);
+  EXPECT_EQ(statistics[2].name, "a -> c");
+  EXPECT_DOUBLE_EQ(statistics[2].p99, 4.0);
+
+  // only the last 2 stamps of each topic are kept
+  graph.add(a, 200, 10'000'000);
+  graph.add(a, 300, 20'000'000);
+  graph.add(b, 100, 30'000'000);
+  graph.add(b, 200, 12'000'000);
+  statistics = graph.statistics();
+  EXPECT_EQ(statistics[0].count, 2u);
+  EXPECT_DOUBLE_EQ(statistics[0].max, 2.0);
+
+  std::ostringstream os;
+  os << statistics[0];
+  EXPECT_EQ(os.str(), "a -> b: count=2 mean=1.500ms max=2.000ms p50=1.500ms p99=1.990ms");
+
+  graph.reset();
+  EXPECT_EQ(graph.statistics()[0].count, 0u);
+  EXPECT_THROW(LatencyGraph({}, {}, 0), std::invalid_argument);
+}
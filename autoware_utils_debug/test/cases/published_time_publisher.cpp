@@ -16,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 using autoware_utils_debug::PublishedTimePublisher;
 
@@ -25,3 +27,24 @@ TEST(TestPublishedTimePublisher, Instantiation)
   const auto node = std::make_shared<rclcpp::Node>("test_node");
   PublishedTimePublisher(node.get());
 }
+
+TEST(TestPublishedTimePublisher, Bind)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  PublishedTimePublisher published_time_publisher(node.get());
+  const auto output = node->create_publisher<std_msgs::msg::Header>("output", rclcpp::QoS(1));
+  auto handle = published_time_publisher.bind(output, std::chrono::nanoseconds(0));
+  EXPECT_FALSE(handle.has_subscribers());
+  handle.publish_if_subscribed(node->now());
+
+  const auto subscription = node->create_subscription<autoware_internal_msgs::msg::PublishedTime>(
+    "output/debug/published_time", rclcpp::QoS(1),
+    [](const autoware_internal_msgs::msg::PublishedTime &) {});
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!handle.has_subscribers() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(handle.has_subscribers());
+  handle.publish_if_subscribed(std_msgs::msg::Header{});
+  published_time_publisher.publish_if_subscribed(output, node->now());
+}
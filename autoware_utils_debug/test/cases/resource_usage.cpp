@@ -0,0 +1,78 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/resource_usage.hpp"
+
+#include "autoware_utils_debug/time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS()
+
+using autoware_utils_debug::ResourceUsage;
+using autoware_utils_debug::ScopedTimeTrack;
+using autoware_utils_debug::thread_resource_usage;
+using autoware_utils_debug::TimeKeeper;
+
+TEST(TestResourceUsage, ThreadResourceUsage)
+{
+  const auto start = thread_resource_usage();
+  auto values = std::make_unique<std::vector<double>>(1000);
+  volatile double sum = 0.0;
+  for (int i = 0; i < 1000000; ++i) {
+    sum = sum + (*values)[i % 1000];
+  }
+  const auto usage = thread_resource_usage() - start;
+  EXPECT_EQ(usage.allocations, 2u);
+  EXPECT_GE(usage.allocated_bytes, 1000 * sizeof(double));
+  EXPECT_GT(usage.cpu_time, 0.0);
+  EXPECT_EQ(
+    autoware_utils_debug::to_string(ResourceUsage{1.5, 3, 128}), "cpu 1.500ms, 3 allocs, 128 B");
+}
+
+TEST(TestResourceUsage, TimeKeeper)
+{
+  for (const bool arena : {false, true}) {
+    std::ostringstream report;
+    TimeKeeper time_keeper(&report);
+    time_keeper.use_arena(arena);
+    time_keeper.use_resource_usage(true);
+    for (int cycle = 0; cycle < 2; ++cycle) {
+      report.str("");
+      ScopedTimeTrack root("root", time_keeper);
+      {
+        ScopedTimeTrack allocate("allocate", time_keeper);
+        const std::vector<char> buffer(4096);
+        time_keeper.comment("buffer");
+      }
+      ScopedTimeTrack compute("compute", time_keeper);
+    }
+    const std::string lines = report.str();
+    EXPECT_TRUE(std::regex_search(lines, std::regex("root \\([0-9.e-]+ms, cpu [0-9.]+ms, ")))
+      << lines;
+    EXPECT_NE(lines.find(", 1 allocs, 4096 B) : buffer"), std::string::npos) << lines;
+    EXPECT_NE(lines.find(", 0 allocs, 0 B)"), std::string::npos) << lines;
+
+    time_keeper.use_resource_usage(false);
+    report.str("");
+    { ScopedTimeTrack root("root", time_keeper); }
+    EXPECT_EQ(report.str().find("allocs"), std::string::npos) << report.str();
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_debug/time_budget_watchdog.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+
+using autoware_utils_debug::TimeBudgetWatchdog;
+using diagnostic_msgs::msg::DiagnosticStatus;
+
+TEST(TestTimeBudgetWatchdog, Tree)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  TimeBudgetWatchdog watchdog(node.get());
+  EXPECT_THROW(watchdog.set_budget("a", 2.0, 1.0), std::invalid_argument);
+  watchdog.set_budget("a", 1.0, 5.0);
+  watchdog.set_budget("b", 1.0, 2.0);
+
+  const auto root = std::make_shared<autoware_utils_debug::ProcessingTimeNode>("root");
+  const auto a = root->add_child("a");
+  const auto b = a->add_child("b");
+  root->set_time(10.0);
+  a->set_time(0.5);
+  b->set_time(0.2);
+  EXPECT_EQ(watchdog.check(*root), DiagnosticStatus::OK);
+  EXPECT_TRUE(watchdog.diagnostics().status().values.empty());
+
+  a->set_time(3.0);
+  EXPECT_EQ(watchdog.check(*root), DiagnosticStatus::WARN);
+  const auto & status = watchdog.diagnostics().status();
+  EXPECT_EQ(status.message, "root/a took 3.000ms, over the budget of 1.000ms");
+  ASSERT_EQ(status.values.size(), 1u);
+  EXPECT_EQ(status.values[0].key, "root/a");
+  EXPECT_EQ(status.values[0].value, "a (3.000ms)\n  b (0.200ms)\n");
+
+  b->set_time(2.5);
+  EXPECT_EQ(watchdog.check(*root), DiagnosticStatus::ERROR);
+  EXPECT_EQ(watchdog.diagnostics().status().values.size(), 2u);
+}
+
+TEST(TestTimeBudgetWatchdog, Arena)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  TimeBudgetWatchdog watchdog(node.get());
+  watchdog.set_budget("a", 1.0, 5.0);
+
+  autoware_utils_debug::ProcessingTimeArena arena;
+  const auto none = autoware_utils_debug::ProcessingTimeArena::none;
+  const auto root = arena.add(arena.intern("root"), none);
+  const auto a = arena.add(arena.intern("a"), root);
+  arena.set_time(arena.add(arena.intern("b"), a), 0.2);
+  arena.set_time(arena.add(arena.intern("c"), root), 0.1);
+  arena.set_time(root, 10.0);
+  arena.set_time(a, 0.5);
+  EXPECT_EQ(watchdog.check(arena), DiagnosticStatus::OK);
+
+  arena.set_time(a, 6.0);
+  EXPECT_EQ(watchdog.check(arena), DiagnosticStatus::ERROR);
+  const auto & status = watchdog.diagnostics().status();
+  EXPECT_EQ(status.message, "root/a took 6.000ms, over the budget of 5.000ms");
+  ASSERT_EQ(status.values.size(), 1u);
+  EXPECT_EQ(status.values[0].value, "a (6.000ms)\n  b (0.200ms)\n");
+}
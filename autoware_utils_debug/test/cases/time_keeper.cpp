@@ -16,6 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 using autoware_utils_debug::ScopedTimeTrack;
 using autoware_utils_debug::TimeKeeper;
 
@@ -24,3 +31,253 @@ TEST(TestTimeKeeper, Instantiation)
   TimeKeeper time_keeper;
   ScopedTimeTrack st("test", time_keeper);
 }
+
+namespace
+{
+void track_cycle(TimeKeeper & time_keeper)
+{
+  ScopedTimeTrack root("root", time_keeper);
+  {
+    ScopedTimeTrack a("a", time_keeper);
+    ScopedTimeTrack b("b", time_keeper);
+    time_keeper.comment("nested");
+  }
+  ScopedTimeTrack c("c", time_keeper);
+}
+
+/// @brief remove the processing times, which differ between the runs
+std::string remove_times(const std::string & report)
+{
+  return std::regex_replace(report, std::regex("\\([0-9.e+-]+ms\\)"), "(ms)");
+}
+}  // namespace
+
+TEST(TestTimeKeeper, Arena)
+{
+  std::ostringstream tree_report;
+  TimeKeeper tree_keeper(&tree_report);
+  track_cycle(tree_keeper);
+
+  std::ostringstream arena_report;
+  TimeKeeper arena_keeper(&arena_report);
+  arena_keeper.use_arena(true);
+  track_cycle(arena_keeper);
+  EXPECT_EQ(remove_times(arena_report.str()), remove_times(tree_report.str()));
+
+  // the arena is reused by the next cycle
+  arena_report.str("");
+  track_cycle(arena_keeper);
+  EXPECT_EQ(remove_times(arena_report.str()), remove_times(tree_report.str()));
+
+  arena_keeper.start_track("root");
+  EXPECT_THROW(arena_keeper.use_arena(false), std::runtime_error);
+  EXPECT_THROW(arena_keeper.end_track("a"), std::runtime_error);
+}
+
+TEST(TestTimeKeeper, ArenaMessage)
+{
+  autoware_utils_debug::ProcessingTimeArena arena;
+  const auto none = autoware_utils_debug::ProcessingTimeArena::none;
+  const auto root = arena.add(arena.intern("root"), none);
+  const auto a = arena.add(arena.intern("a"), root);
+  arena.add(arena.intern("b"), a);
+  arena.add(arena.intern("a"), root);
+  EXPECT_EQ(arena.intern("a"), 1u);
+
+  const auto msg = arena.to_msg();
+  ASSERT_EQ(msg.nodes.size(), 4u);
+  EXPECT_EQ(msg.nodes[2].name, "b");
+  EXPECT_EQ(msg.nodes[2].parent_id, 2);
+  EXPECT_EQ(msg.nodes[3].parent_id, 1);
+
+  arena.clear();
+  EXPECT_EQ(arena.size(), 0u);
+  EXPECT_TRUE(arena.to_msg().nodes.empty());
+}
+
+TEST(TestTimeKeeper, Threads)
+{
+  std::ostringstream report;
+  TimeKeeper time_keeper(&report);
+  {
+    ScopedTimeTrack root("root", time_keeper);
+    ScopedTimeTrack loop("loop", time_keeper);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 2; ++i) {
+      workers.emplace_back([&time_keeper] {
+        ScopedTimeTrack work("work", time_keeper);
+        ScopedTimeTrack inner("inner", time_keeper);
+        time_keeper.comment("worker");
+      });
+    }
+    for (auto & worker : workers) {
+      worker.join();
+    }
+  }
+  const auto lines = remove_times(report.str());
+  const auto first_work = "└── loop (ms)\n        ├── work [thread ";
+  EXPECT_NE(lines.find(first_work), std::string::npos) << lines;
+  EXPECT_NE(lines.find("[thread 1] (ms)"), std::string::npos) << lines;
+  EXPECT_NE(lines.find("[thread 2] (ms)"), std::string::npos) << lines;
+  EXPECT_NE(lines.find("inner (ms) : worker"), std::string::npos) << lines;
+}
+
+TEST(TestTimeKeeper, AsyncReporting)
+{
+  for (const bool arena : {false, true}) {
+    std::ostringstream report;
+    {
+      TimeKeeper time_keeper(&report);
+      time_keeper.use_arena(arena);
+      time_keeper.start_async_reporting(4);
+      for (int i = 0; i < 3; ++i) {
+        track_cycle(time_keeper);
+      }
+      time_keeper.stop_async_reporting();
+      EXPECT_EQ(time_keeper.dropped_reports(), 0u);
+
+      time_keeper.start_async_reporting(1);
+      track_cycle(time_keeper);
+    }
+
+    std::ostringstream expected;
+    {
+      TimeKeeper time_keeper(&expected);
+      for (int i = 0; i < 4; ++i) {
+        track_cycle(time_keeper);
+      }
+    }
+    EXPECT_EQ(remove_times(report.str()), remove_times(expected.str()));
+  }
+}
+
+namespace
+{
+void track_literal_cycle(TimeKeeper & time_keeper)
+{
+  AUTOWARE_UTILS_DEBUG_TIME_TRACK("root", time_keeper);
+  {
+    AUTOWARE_UTILS_DEBUG_TIME_TRACK("a", time_keeper);
+    AUTOWARE_UTILS_DEBUG_TIME_TRACK("b", time_keeper);
+    AUTOWARE_UTILS_DEBUG_TIME_COMMENT("nested", time_keeper);
+  }
+  AUTOWARE_UTILS_DEBUG_TIME_TRACK("c", time_keeper);
+}
+}  // namespace
+
+TEST(TestTimeKeeper, LiteralTrack)
+{
+  std::ostringstream tree_report;
+  TimeKeeper tree_keeper(&tree_report);
+  track_cycle(tree_keeper);
+
+  for (const bool arena : {false, true}) {
+    std::ostringstream report;
+    TimeKeeper time_keeper(&report);
+    time_keeper.use_arena(arena);
+    track_literal_cycle(time_keeper);
+    EXPECT_EQ(remove_times(report.str()), remove_times(tree_report.str()));
+
+    report.str("");
+    time_keeper.set_enabled(false);
+    EXPECT_FALSE(time_keeper.is_enabled());
+    track_literal_cycle(time_keeper);
+    EXPECT_TRUE(report.str().empty());
+
+    // the tracks started before disabling are still ended
+    time_keeper.set_enabled(true);
+    {
+      const autoware_utils_debug::ScopedLiteralTimeTrack root("root", time_keeper);
+      time_keeper.set_enabled(false);
+      AUTOWARE_UTILS_DEBUG_TIME_TRACK("a", time_keeper);
+    }
+    EXPECT_EQ(remove_times(report.str()), "==========================\nroot (ms)\n\n");
+  }
+}
+
+TEST(TestTimeKeeper, Aggregation)
+{
+  for (const bool arena : {false, true}) {
+    std::ostringstream report;
+    TimeKeeper time_keeper(&report);
+    time_keeper.use_arena(arena);
+    time_keeper.use_aggregation(3);
+    track_cycle(time_keeper);
+    track_cycle(time_keeper);
+    EXPECT_TRUE(report.str().empty());
+
+    // the paths are merged across the cycles, in the order of their first track
+    time_keeper.start_track("root");
+    time_keeper.start_track("d");
+    time_keeper.end_track("d");
+    time_keeper.start_track("a");
+    time_keeper.end_track("a");
+    time_keeper.end_track("root");
+    const std::string aggregate = std::regex_replace(
+      remove_times(report.str()), std::regex("max=[0-9.]+ p99=[0-9.]+"), "max p99");
+    EXPECT_EQ(
+      aggregate,
+      "==========================\n"
+      "root (ms) : count=3 max p99\n"
+      "    ├── a (ms) : count=3 max p99\n"
+      "    │   └── b (ms) : count=2 max p99\n"
+      "    ├── c (ms) : count=2 max p99\n"
+      "    └── d (ms) : count=1 max p99\n\n");
+
+    // the statistics are cleared after each report
+    report.str("");
+    track_cycle(time_keeper);
+    EXPECT_TRUE(report.str().empty());
+  }
+}
+
+TEST(TestTimeKeeper, RequestAggregation)
+{
+  for (const bool arena : {false, true}) {
+    std::ostringstream report;
+    TimeKeeper time_keeper(&report);
+    time_keeper.use_arena(arena);
+
+    // the request is applied at the start of the next cycle
+    time_keeper.start_track("root");
+    time_keeper.request_aggregation(2);
+    time_keeper.end_track("root");
+    EXPECT_FALSE(report.str().empty());
+
+    report.str("");
+    track_cycle(time_keeper);
+    EXPECT_TRUE(report.str().empty());
+    track_cycle(time_keeper);
+    EXPECT_NE(report.str().find("count=2"), std::string::npos) << report.str();
+  }
+}
+
+TEST(TestTimeKeeper, AggregateStatistics)
+{
+  autoware_utils_debug::ProcessingTimeArena cycle;
+  const auto none = autoware_utils_debug::ProcessingTimeArena::none;
+  autoware_utils_debug::ProcessingTimeAggregate aggregate;
+  for (int i = 1; i <= 4; ++i) {
+    cycle.clear();
+    const auto root = cycle.add(cycle.intern("root"), none);
+    cycle.set_time(root, 10.0 * i);
+    cycle.set_time(cycle.add(cycle.intern("a"), root), 1.0 * i);
+    aggregate.add(cycle);
+  }
+  EXPECT_EQ(aggregate.cycles(), 4u);
+
+  autoware_utils_debug::ProcessingTimeArena result;
+  aggregate.to_arena(result);
+  const auto msg = result.to_msg();
+  ASSERT_EQ(msg.nodes.size(), 2u);
+  EXPECT_EQ(msg.nodes[0].name, "root");
+  EXPECT_DOUBLE_EQ(msg.nodes[0].processing_time, 25.0);
+  EXPECT_EQ(msg.nodes[0].comment, "count=4 max=40.000 p99=39.700");
+  EXPECT_EQ(msg.nodes[1].name, "a");
+  EXPECT_EQ(msg.nodes[1].parent_id, 1);
+  EXPECT_DOUBLE_EQ(msg.nodes[1].processing_time, 2.5);
+
+  aggregate.clear();
+  aggregate.to_arena(result);
+  EXPECT_EQ(result.size(), 0u);
+}
@@ -0,0 +1,175 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE_UTILS_DIAGNOSTICS__CONCURRENT_DIAGNOSTICS_HPP_
+#define AUTOWARE_UTILS_DIAGNOSTICS__CONCURRENT_DIAGNOSTICS_HPP_
+
+#include "autoware_utils_diagnostics/diagnostics_interface.hpp"
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_diagnostics
+{
+/**
+ * @brief Updates a status from several threads, merged into it by the publishing thread
+ *
+ * The registered keys are slots of atomic values, which the workers set without a lock. The other
+ * keys, the levels and the messages are staged by a writer per worker, whose lock is only taken
+ * by the merge, so that the workers do not wait for each other. The slots and the writers are
+ * added before the workers start, then the publishing thread merges them before each publish:
+ * @code
+ * status.clear();
+ * concurrent.merge();
+ * status.publish(node->now());
+ * @endcode
+ */
+class ConcurrentDiagnostics
+{
+public:
+  /**
+   * @brief Staging of the updates of a worker, to be used by one thread at a time
+   */
+  class Writer
+  {
+  public:
+    template <typename T>
+    void add_key_value(const std::string & key, const T & value);
+    void add_key_value(const std::string & key, const std::string & value);
+    void add_key_value(const std::string & key, bool value);
+    void update_level_and_message(int8_t level, const std::string & message);
+
+  private:
+    friend class ConcurrentDiagnostics;
+
+    /**
+     * @brief Add a key value, whose value is already formatted
+     */
+    void stage(diagnostic_msgs::msg::KeyValue && key_value);
+
+    std::mutex mutex_;  //!< Only contended by the merge
+    std::vector<diagnostic_msgs::msg::KeyValue> values_;
+    std::vector<std::pair<int8_t, std::string>> messages_;
+  };
+
+  /**
+   * @brief Construct the concurrent updates of a status, e.g. of a DiagnosticsHub
+   *
+   * @param status Status to merge into, which must outlive this object
+   */
+  explicit ConcurrentDiagnostics(DiagnosticsInterface & status);
+
+  ConcurrentDiagnostics(const ConcurrentDiagnostics &) = delete;
+  ConcurrentDiagnostics & operator=(const ConcurrentDiagnostics &) = delete;
+
+  /**
+   * @brief Register a key of the status, whose value is set without a lock. Not thread-safe.
+   *
+   * @param key Key of the value
+   * @return size_t Index of the slot, to be passed to set_value()
+   */
+  size_t register_key(const std::string & key);
+
+  /**
+   * @brief Add a writer for a worker, which stays valid as long as this object. Not thread-safe.
+   */
+  Writer & add_writer();
+
+  /**
+   * @brief Set the value of a registered key, from any thread without a lock
+   *
+   * A slot keeps the last value set since the previous merge, which formats it as
+   * DiagnosticsInterface::set_value(). The values of a slot are expected to be of the same type.
+   *
+   * @param slot Index returned by register_key()
+   * @param value Integer, floating point or bool value
+   */
+  template <typename T>
+  void set_value(size_t slot, T value);
+
+  /**
+   * @brief Move the updates since the previous merge into the status
+   *
+   * The slots which were not set keep their value in the status, e.g. empty after its clear(). The
+   * key values and the messages of the writers are added in the order of the writers.
+   */
+  void merge();
+
+private:
+  enum class Kind : uint8_t { none, int64, uint64, float64, boolean };
+
+  struct Slot
+  {
+    explicit Slot(size_t status_slot) : status_slot(status_slot) {}
+
+    size_t status_slot;
+    std::atomic<uint64_t> bits{0};
+    std::atomic<Kind> kind{Kind::none};  //!< Kind of the value set since the merge, or none
+  };
+
+  DiagnosticsInterface & status_;
+  std::deque<Slot> slots_;      //!< Deque of the atomics, which cannot be moved
+  std::deque<Writer> writers_;  //!< Deque keeping the references valid
+
+  // buffers swapped with the ones of a writer by the merge, to keep its lock short
+  std::vector<diagnostic_msgs::msg::KeyValue> merged_values_;
+  std::vector<std::pair<int8_t, std::string>> merged_messages_;
+};
+
+template <typename T>
+void ConcurrentDiagnostics::Writer::add_key_value(const std::string & key, const T & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = std::to_string(value);
+  stage(std::move(key_value));
+}
+
+template <typename T>
+void ConcurrentDiagnostics::set_value(const size_t slot, const T value)
+{
+  static_assert(std::is_arithmetic_v<T>, "The value of a slot must be a number or a bool.");
+  Kind kind;
+  uint64_t bits;
+  if constexpr (std::is_same_v<T, bool>) {
+    kind = Kind::boolean;
+    bits = value ? 1 : 0;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    const auto float64 = static_cast<double>(value);
+    kind = Kind::float64;
+    std::memcpy(&bits, &float64, sizeof(bits));
+  } else if constexpr (std::is_signed_v<T>) {
+    kind = Kind::int64;
+    bits = static_cast<uint64_t>(static_cast<int64_t>(value));
+  } else {
+    kind = Kind::uint64;
+    bits = static_cast<uint64_t>(value);
+  }
+  // the release publishes the bits to the merge which reads the kind
+  auto & target = slots_.at(slot);
+  target.bits.store(bits, std::memory_order_relaxed);
+  target.kind.store(kind, std::memory_order_release);
+}
+
+}  // namespace autoware_utils_diagnostics
+
+#endif  // AUTOWARE_UTILS_DIAGNOSTICS__CONCURRENT_DIAGNOSTICS_HPP_
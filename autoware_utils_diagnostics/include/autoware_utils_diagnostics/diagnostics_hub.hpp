@@ -0,0 +1,79 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_DIAGNOSTICS__DIAGNOSTICS_HUB_HPP_
+#define AUTOWARE_UTILS_DIAGNOSTICS__DIAGNOSTICS_HUB_HPP_
+
+#include "autoware_utils_diagnostics/diagnostics_interface.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <deque>
+#include <string>
+
+namespace autoware_utils_diagnostics
+{
+/**
+ * @brief Owns the statuses of a node and publishes them in a single array
+ *
+ * A node with several diagnostic names sends one message per cycle instead of one per status.
+ */
+class DiagnosticsHub
+{
+public:
+  explicit DiagnosticsHub(rclcpp::Node * node);
+
+  DiagnosticsHub(const DiagnosticsHub &) = delete;
+  DiagnosticsHub & operator=(const DiagnosticsHub &) = delete;
+
+  /**
+   * @brief Add a status, which stays valid as long as the hub
+   *
+   * The status is updated as a DiagnosticsInterface, but published by the hub.
+   *
+   * @param diagnostic_name Name of the status, prefixed by the name of the node
+   * @return DiagnosticsInterface& The status
+   * @throws std::invalid_argument if the hub already has a status of the name
+   */
+  DiagnosticsInterface & add(const std::string & diagnostic_name);
+
+  /**
+   * @brief Clear all the statuses, as DiagnosticsInterface::clear()
+   */
+  void clear();
+
+  /**
+   * @brief Publish all the statuses in a single array
+   *
+   * @param publish_time_stamp Stamp of the array
+   */
+  void publish(const rclcpp::Time & publish_time_stamp);
+
+  /**
+   * @brief Get the array as it was last published
+   */
+  const diagnostic_msgs::msg::DiagnosticArray & array() const { return diagnostics_array_msg_; }
+
+private:
+  rclcpp::Node * node_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_pub_;
+  std::deque<DiagnosticsInterface> statuses_;  //!< Deque keeping the references valid
+  diagnostic_msgs::msg::DiagnosticArray diagnostics_array_msg_;  //!< Array reused by publish()
+};
+
+}  // namespace autoware_utils_diagnostics
+
+#endif  // AUTOWARE_UTILS_DIAGNOSTICS__DIAGNOSTICS_HUB_HPP_
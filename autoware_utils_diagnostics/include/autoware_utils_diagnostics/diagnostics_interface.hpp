@@ -19,11 +19,17 @@
 
 #include <diagnostic_msgs/msg/diagnostic_array.hpp>
 
+#include <charconv>
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace autoware_utils_diagnostics
 {
+class DiagnosticsHub;
+
 class DiagnosticsInterface
 {
 public:
@@ -34,17 +40,89 @@ public:
   void add_key_value(const std::string & key, const T & value);
   void add_key_value(const std::string & key, const std::string & value);
   void add_key_value(const std::string & key, bool value);
+
+  /**
+   * @brief Register a key, which is kept in a slot of the status with an empty value by clear()
+   *
+   * The registered keys come before the other keys, in the order of their registration.
+   *
+   * @param key Key of the value
+   * @return size_t Index of the slot, to be passed to set_value()
+   */
+  size_t register_key(const std::string & key);
+
+  /**
+   * @brief Set the value of a registered key, without searching for the key
+   *
+   * @param slot Index returned by register_key()
+   * @param value Value, formatted as by add_key_value()
+   */
+  template <typename T>
+  void set_value(size_t slot, const T & value);
+  void set_value(size_t slot, const std::string & value);
+  void set_value(size_t slot, bool value);
+
   void update_level_and_message(const int8_t level, const std::string & message);
-  void publish(const rclcpp::Time & publish_time_stamp);
+
+  /**
+   * @brief Publish the status, or skip it as set by set_rate_limit()
+   *
+   * @throws std::runtime_error if the status belongs to a DiagnosticsHub, which publishes it
+   *
+   * @param publish_time_stamp Stamp of the array, also used for the rate limit
+   * @return bool true if the status was published
+   */
+  bool publish(const rclcpp::Time & publish_time_stamp);
+
+  /**
+   * @brief Limit the rate of publish() and suppress the unchanged statuses
+   *
+   * A change of the level is published immediately. A change of the message or the values is
+   * published at most once per min_interval, and an unchanged status once per heartbeat.
+   *
+   * @param min_interval Minimum interval between two statuses with the same level
+   * @param heartbeat Interval at which an unchanged status is published again
+   */
+  void set_rate_limit(
+    const std::chrono::nanoseconds min_interval, const std::chrono::nanoseconds heartbeat);
+
+  /**
+   * @brief Get the status as it would be published
+   */
+  const diagnostic_msgs::msg::DiagnosticStatus & status() const { return diagnostics_status_msg_; }
 
 private:
-  [[nodiscard]] diagnostic_msgs::msg::DiagnosticArray create_diagnostics_array(
-    const rclcpp::Time & publish_time_stamp) const;
+  friend class DiagnosticsHub;
+
+  /**
+   * @brief Construct a status, with a publisher unless it is published by a hub
+   */
+  DiagnosticsInterface(
+    rclcpp::Node * node, const std::string & diagnostic_name, const DiagnosticsHub * hub);
+
+  /**
+   * @brief Copy the status to a message, with the message "OK" for the OK level
+   */
+  void copy_status(diagnostic_msgs::msg::DiagnosticStatus & status) const;
+
+  /**
+   * @brief Update the array reused by the calls of publish()
+   */
+  const diagnostic_msgs::msg::DiagnosticArray & create_diagnostics_array(
+    const rclcpp::Time & publish_time_stamp);
 
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_pub_;
 
   diagnostic_msgs::msg::DiagnosticStatus diagnostics_status_msg_;
+  size_t registered_keys_{0};  //!< Number of the registered keys, at the front of the values
+  diagnostic_msgs::msg::DiagnosticArray diagnostics_array_msg_;  //!< Array reused by publish()
+
+  bool rate_limited_{false};
+  std::chrono::nanoseconds min_interval_{0};
+  std::chrono::nanoseconds heartbeat_{0};
+  bool published_{false};  //!< Whether the array holds the last published status
+  int64_t last_publish_time_ns_{0};
 };
 
 template <typename T>
@@ -56,6 +134,24 @@ void DiagnosticsInterface::add_key_value(const std::string & key, const T & valu
   add_key_value(key_value);
 }
 
+template <typename T>
+void DiagnosticsInterface::set_value(const size_t slot, const T & value)
+{
+  // the same format as std::to_string, without allocating once the string has grown
+  char buffer[64];
+  std::to_chars_result result;
+  if constexpr (std::is_floating_point_v<T>) {
+    result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+  } else {
+    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  }
+  if (result.ec != std::errc()) {
+    set_value(slot, std::to_string(value));
+    return;
+  }
+  diagnostics_status_msg_.values.at(slot).value.assign(buffer, result.ptr);
+}
+
 }  // namespace autoware_utils_diagnostics
 
 #endif  // AUTOWARE_UTILS_DIAGNOSTICS__DIAGNOSTICS_INTERFACE_HPP_
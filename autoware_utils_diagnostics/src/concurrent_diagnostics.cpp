@@ -0,0 +1,120 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_diagnostics/concurrent_diagnostics.hpp"
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace autoware_utils_diagnostics
+{
+void ConcurrentDiagnostics::Writer::add_key_value(
+  const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  stage(std::move(key_value));
+}
+
+void ConcurrentDiagnostics::Writer::add_key_value(const std::string & key, const bool value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value ? "True" : "False";
+  stage(std::move(key_value));
+}
+
+void ConcurrentDiagnostics::Writer::update_level_and_message(
+  const int8_t level, const std::string & message)
+{
+  const std::lock_guard<std::mutex> lock(mutex_);
+  messages_.emplace_back(level, message);
+}
+
+void ConcurrentDiagnostics::Writer::stage(diagnostic_msgs::msg::KeyValue && key_value)
+{
+  const std::lock_guard<std::mutex> lock(mutex_);
+  values_.push_back(std::move(key_value));
+}
+
+ConcurrentDiagnostics::ConcurrentDiagnostics(DiagnosticsInterface & status) : status_(status)
+{
+}
+
+size_t ConcurrentDiagnostics::register_key(const std::string & key)
+{
+  const size_t status_slot = status_.register_key(key);
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    if (slots_[i].status_slot == status_slot) {
+      return i;
+    }
+  }
+  slots_.emplace_back(status_slot);
+  return slots_.size() - 1;
+}
+
+ConcurrentDiagnostics::Writer & ConcurrentDiagnostics::add_writer()
+{
+  return writers_.emplace_back();
+}
+
+void ConcurrentDiagnostics::merge()
+{
+  for (auto & slot : slots_) {
+    const Kind kind = slot.kind.exchange(Kind::none, std::memory_order_acquire);
+    const uint64_t bits = slot.bits.load(std::memory_order_relaxed);
+    switch (kind) {
+      case Kind::none:
+        break;
+      case Kind::int64:
+        status_.set_value(slot.status_slot, static_cast<int64_t>(bits));
+        break;
+      case Kind::uint64:
+        status_.set_value(slot.status_slot, bits);
+        break;
+      case Kind::float64: {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        status_.set_value(slot.status_slot, value);
+        break;
+      }
+      case Kind::boolean:
+        status_.set_value(slot.status_slot, bits != 0);
+        break;
+    }
+  }
+
+  for (auto & writer : writers_) {
+    {
+      const std::lock_guard<std::mutex> lock(writer.mutex_);
+      merged_values_.swap(writer.values_);
+      merged_messages_.swap(writer.messages_);
+    }
+    for (const auto & key_value : merged_values_) {
+      status_.add_key_value(key_value);
+    }
+    for (const auto & [level, message] : merged_messages_) {
+      status_.update_level_and_message(level, message);
+    }
+    merged_values_.clear();
+    merged_messages_.clear();
+  }
+}
+}  // namespace autoware_utils_diagnostics
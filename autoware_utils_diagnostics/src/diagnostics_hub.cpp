@@ -0,0 +1,62 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_diagnostics/diagnostics_hub.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace autoware_utils_diagnostics
+{
+DiagnosticsHub::DiagnosticsHub(rclcpp::Node * node) : node_(node)
+{
+  diagnostics_pub_ =
+    node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 10);
+}
+
+DiagnosticsInterface & DiagnosticsHub::add(const std::string & diagnostic_name)
+{
+  // the private constructor is not reachable by emplace_back
+  DiagnosticsInterface status(node_, diagnostic_name, this);
+  for (const auto & other : statuses_) {
+    if (other.status().name == status.status().name) {
+      throw std::invalid_argument("The status '" + diagnostic_name + "' is already added.");
+    }
+  }
+  statuses_.push_back(std::move(status));
+  diagnostics_array_msg_.status.resize(statuses_.size());
+  return statuses_.back();
+}
+
+void DiagnosticsHub::clear()
+{
+  for (auto & status : statuses_) {
+    status.clear();
+  }
+}
+
+void DiagnosticsHub::publish(const rclcpp::Time & publish_time_stamp)
+{
+  diagnostics_array_msg_.header.stamp = publish_time_stamp;
+  for (size_t i = 0; i < statuses_.size(); ++i) {
+    statuses_[i].copy_status(diagnostics_array_msg_.status[i]);
+  }
+  diagnostics_pub_->publish(diagnostics_array_msg_);
+}
+}  // namespace autoware_utils_diagnostics
@@ -19,25 +19,61 @@
 #include <diagnostic_msgs/msg/diagnostic_array.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 
 namespace autoware_utils_diagnostics
 {
+namespace
+{
+bool is_same_status_impl(
+  const diagnostic_msgs::msg::DiagnosticStatus & status,
+  const diagnostic_msgs::msg::DiagnosticStatus & published)
+{
+  if (status.level != published.level || status.values.size() != published.values.size()) {
+    return false;
+  }
+  const bool ok_message = status.level == diagnostic_msgs::msg::DiagnosticStatus::OK;
+  if (!ok_message && status.message != published.message) {
+    return false;
+  }
+  return std::equal(
+    std::begin(status.values), std::end(status.values), std::begin(published.values),
+    [](const auto & a, const auto & b) { return a.key == b.key && a.value == b.value; });
+}
+}  // namespace
+
 DiagnosticsInterface::DiagnosticsInterface(rclcpp::Node * node, const std::string & diagnostic_name)
+: DiagnosticsInterface(node, diagnostic_name, nullptr)
+{
+}
+
+DiagnosticsInterface::DiagnosticsInterface(
+  rclcpp::Node * node, const std::string & diagnostic_name, const DiagnosticsHub * hub)
 : clock_(node->get_clock())
 {
-  diagnostics_pub_ =
-    node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 10);
+  if (!hub) {
+    diagnostics_pub_ =
+      node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 10);
+  }
 
   diagnostics_status_msg_.name =
     std::string(node->get_name()) + std::string(": ") + diagnostic_name;
   diagnostics_status_msg_.hardware_id = node->get_name();
+  diagnostics_array_msg_.status.resize(1);
 }
 
 void DiagnosticsInterface::clear()
 {
-  diagnostics_status_msg_.values.clear();
-  diagnostics_status_msg_.values.shrink_to_fit();
+  // keep the registered keys and the memory of their values
+  diagnostics_status_msg_.values.resize(registered_keys_);
+  for (auto & key_value : diagnostics_status_msg_.values) {
+    key_value.value.clear();
+  }
 
   diagnostics_status_msg_.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
   diagnostics_status_msg_.message = "";
@@ -72,6 +108,37 @@ void DiagnosticsInterface::add_key_value(const std::string & key, bool value)
   add_key_value(key_value);
 }
 
+size_t DiagnosticsInterface::register_key(const std::string & key)
+{
+  auto & values = diagnostics_status_msg_.values;
+  const auto it = std::find_if(
+    std::begin(values), std::end(values), [&key](const auto & arg) { return arg.key == key; });
+  const auto index = static_cast<size_t>(std::distance(std::begin(values), it));
+  if (index < registered_keys_) {
+    return index;
+  }
+
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  if (it != std::end(values)) {
+    // added before its registration, moved to the registered keys
+    key_value.value = it->value;
+    values.erase(it);
+  }
+  values.insert(std::begin(values) + static_cast<std::ptrdiff_t>(registered_keys_), key_value);
+  return registered_keys_++;
+}
+
+void DiagnosticsInterface::set_value(const size_t slot, const std::string & value)
+{
+  diagnostics_status_msg_.values.at(slot).value = value;
+}
+
+void DiagnosticsInterface::set_value(const size_t slot, const bool value)
+{
+  diagnostics_status_msg_.values.at(slot).value = value ? "True" : "False";
+}
+
 void DiagnosticsInterface::update_level_and_message(const int8_t level, const std::string & message)
 {
   if ((level > diagnostic_msgs::msg::DiagnosticStatus::OK)) {
@@ -85,22 +152,54 @@ void DiagnosticsInterface::update_level_and_message(const int8_t level, const st
   }
 }
 
-void DiagnosticsInterface::publish(const rclcpp::Time & publish_time_stamp)
+bool DiagnosticsInterface::publish(const rclcpp::Time & publish_time_stamp)
 {
+  if (!diagnostics_pub_) {
+    throw std::runtime_error("The status of a hub is published by the hub.");
+  }
+  const int64_t now_ns = publish_time_stamp.nanoseconds();
+  if (rate_limited_ && published_) {
+    const auto & published = diagnostics_array_msg_.status.at(0);
+    const auto elapsed = std::chrono::nanoseconds(now_ns - last_publish_time_ns_);
+    if (diagnostics_status_msg_.level == published.level && elapsed < heartbeat_) {
+      if (elapsed < min_interval_ || is_same_status_impl(diagnostics_status_msg_, published)) {
+        return false;
+      }
+    }
+  }
+
   diagnostics_pub_->publish(create_diagnostics_array(publish_time_stamp));
+  published_ = true;
+  last_publish_time_ns_ = now_ns;
+  return true;
 }
 
-diagnostic_msgs::msg::DiagnosticArray DiagnosticsInterface::create_diagnostics_array(
-  const rclcpp::Time & publish_time_stamp) const
+void DiagnosticsInterface::set_rate_limit(
+  const std::chrono::nanoseconds min_interval, const std::chrono::nanoseconds heartbeat)
 {
-  diagnostic_msgs::msg::DiagnosticArray diagnostics_msg;
-  diagnostics_msg.header.stamp = publish_time_stamp;
-  diagnostics_msg.status.push_back(diagnostics_status_msg_);
-
-  if (diagnostics_msg.status.at(0).level == diagnostic_msgs::msg::DiagnosticStatus::OK) {
-    diagnostics_msg.status.at(0).message = "OK";
+  if (min_interval.count() < 0 || heartbeat < min_interval) {
+    throw std::invalid_argument("The heartbeat must not be shorter than the minimum interval.");
   }
+  rate_limited_ = true;
+  min_interval_ = min_interval;
+  heartbeat_ = heartbeat;
+}
 
-  return diagnostics_msg;
+const diagnostic_msgs::msg::DiagnosticArray & DiagnosticsInterface::create_diagnostics_array(
+  const rclcpp::Time & publish_time_stamp)
+{
+  diagnostics_array_msg_.header.stamp = publish_time_stamp;
+  copy_status(diagnostics_array_msg_.status.at(0));
+  return diagnostics_array_msg_;
+}
+
+void DiagnosticsInterface::copy_status(diagnostic_msgs::msg::DiagnosticStatus & status) const
+{
+  // the assignment reuses the memory of the strings and the values of the previous call
+  status = diagnostics_status_msg_;
+
+  if (status.level == diagnostic_msgs::msg::DiagnosticStatus::OK) {
+    status.message = "OK";
+  }
 }
 }  // namespace autoware_utils_diagnostics
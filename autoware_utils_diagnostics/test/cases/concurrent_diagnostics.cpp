@@ -0,0 +1,109 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_diagnostics/concurrent_diagnostics.hpp"
+
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using diagnostic_msgs::msg::DiagnosticStatus;
+
+TEST(TestConcurrentDiagnostics, Merge)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_diagnostics::DiagnosticsInterface status(node.get(), "diag_name");
+  autoware_utils_diagnostics::ConcurrentDiagnostics concurrent(status);
+  const size_t count = concurrent.register_key("count");
+  const size_t ratio = concurrent.register_key("ratio");
+  const size_t valid = concurrent.register_key("valid");
+  EXPECT_EQ(concurrent.register_key("count"), count);
+  auto & writer = concurrent.add_writer();
+
+  concurrent.set_value(count, -3);
+  concurrent.set_value(ratio, 0.5f);
+  writer.add_key_value("name", std::string("lidar"));
+  writer.update_level_and_message(DiagnosticStatus::WARN, "slow");
+  // nothing is written to the status before the merge
+  EXPECT_EQ(status.status().values.at(0).value, "");
+  EXPECT_EQ(status.status().level, DiagnosticStatus::OK);
+
+  concurrent.merge();
+  const auto & values = status.status().values;
+  ASSERT_EQ(values.size(), 4u);
+  EXPECT_EQ(values[0].value, "-3");
+  EXPECT_EQ(values[1].value, "0.500000");
+  EXPECT_EQ(values[2].value, "");
+  EXPECT_EQ(values[3].key, "name");
+  EXPECT_EQ(values[3].value, "lidar");
+  EXPECT_EQ(status.status().level, DiagnosticStatus::WARN);
+  EXPECT_EQ(status.status().message, "slow");
+
+  // the staged updates are merged once, the slots which are not set keep their value
+  status.clear();
+  concurrent.set_value(valid, true);
+  concurrent.merge();
+  EXPECT_EQ(status.status().values.size(), 3u);
+  EXPECT_EQ(status.status().values[0].value, "");
+  EXPECT_EQ(status.status().values[2].value, "True");
+  EXPECT_EQ(status.status().level, DiagnosticStatus::OK);
+  status.publish(node->now());
+}
+
+TEST(TestConcurrentDiagnostics, Workers)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_diagnostics::DiagnosticsInterface status(node.get(), "diag_name");
+  autoware_utils_diagnostics::ConcurrentDiagnostics concurrent(status);
+
+  constexpr int workers = 4;
+  constexpr uint64_t iterations = 10000;
+  std::vector<size_t> slots;
+  std::vector<autoware_utils_diagnostics::ConcurrentDiagnostics::Writer *> writers;
+  for (int i = 0; i < workers; ++i) {
+    slots.push_back(concurrent.register_key("worker_" + std::to_string(i)));
+    writers.push_back(&concurrent.add_writer());
+  }
+
+  // the merges run while the workers write
+  std::vector<std::thread> threads;
+  for (int i = 0; i < workers; ++i) {
+    threads.emplace_back([&concurrent, &slots, &writers, i] {
+      for (uint64_t j = 1; j <= iterations; ++j) {
+        concurrent.set_value(slots[i], j);
+        if (j % 1000 == 0) {
+          writers[i]->update_level_and_message(DiagnosticStatus::WARN, std::to_string(i));
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 100; ++i) {
+    concurrent.merge();
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  concurrent.merge();
+
+  // the last values are merged, by the last merge or by one before
+  EXPECT_EQ(status.status().level, DiagnosticStatus::WARN);
+  for (int i = 0; i < workers; ++i) {
+    EXPECT_EQ(status.status().values.at(slots[i]).value, std::to_string(iterations));
+  }
+}
@@ -0,0 +1,47 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_diagnostics/diagnostics_hub.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+
+TEST(TestDiagnosticsHub, Publish)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_diagnostics::DiagnosticsHub hub(node.get());
+  auto & planning = hub.add("planning");
+  auto & control = hub.add("control");
+  EXPECT_THROW(hub.add("planning"), std::invalid_argument);
+  EXPECT_THROW(planning.publish(node->now()), std::runtime_error);
+
+  planning.add_key_value("count", 1);
+  control.update_level_and_message(DiagnosticStatus::WARN, "slow");
+  hub.publish(node->now());
+
+  const auto & array = hub.array();
+  ASSERT_EQ(array.status.size(), 2u);
+  EXPECT_EQ(array.status[0].name, "test_node: planning");
+  EXPECT_EQ(array.status[0].message, "OK");
+  ASSERT_EQ(array.status[0].values.size(), 1u);
+  EXPECT_EQ(array.status[1].level, DiagnosticStatus::WARN);
+  EXPECT_EQ(array.status[1].message, "slow");
+
+  hub.clear();
+  EXPECT_TRUE(planning.status().values.empty());
+  EXPECT_EQ(control.status().level, DiagnosticStatus::OK);
+}
@@ -16,10 +16,74 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
 
 TEST(TestDiagnosticsInterface, Instantiation)
 {
   const auto node = std::make_shared<rclcpp::Node>("test_node");
   autoware_utils_diagnostics::DiagnosticsInterface(node.get(), "diag_name");
 }
+
+TEST(TestDiagnosticsInterface, RegisterKey)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_diagnostics::DiagnosticsInterface interface(node.get(), "diag_name");
+  interface.add_key_value("other", 1);
+  interface.add_key_value("count", 2);
+  const size_t distance = interface.register_key("distance");
+  const size_t count = interface.register_key("count");
+  EXPECT_EQ(interface.register_key("distance"), distance);
+
+  // the registered keys come first, with the values added before
+  ASSERT_EQ(interface.status().values.size(), 3u);
+  EXPECT_EQ(interface.status().values[count].value, "2");
+  EXPECT_EQ(interface.status().values[2].key, "other");
+
+  interface.set_value(distance, 1.5);
+  interface.set_value(count, 3);
+  EXPECT_EQ(interface.status().values[distance].value, "1.500000");
+  EXPECT_EQ(interface.status().values[count].value, "3");
+  interface.set_value(count, true);
+  EXPECT_EQ(interface.status().values[count].value, "True");
+
+  interface.clear();
+  ASSERT_EQ(interface.status().values.size(), 2u);
+  EXPECT_EQ(interface.status().values[distance].key, "distance");
+  EXPECT_EQ(interface.status().values[distance].value, "");
+  interface.add_key_value("distance", std::string("near"));
+  EXPECT_EQ(interface.status().values[distance].value, "near");
+  interface.publish(node->now());
+}
+
+TEST(TestDiagnosticsInterface, RateLimit)
+{
+  using std::chrono::milliseconds;
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_diagnostics::DiagnosticsInterface interface(node.get(), "diag_name");
+  EXPECT_THROW(
+    interface.set_rate_limit(milliseconds(100), milliseconds(10)), std::invalid_argument);
+  interface.set_rate_limit(milliseconds(100), milliseconds(1000));
+  const auto at = [](const int64_t ms) { return rclcpp::Time(ms * 1000000); };
+
+  interface.add_key_value("count", 1);
+  EXPECT_TRUE(interface.publish(at(0)));
+  EXPECT_FALSE(interface.publish(at(10)));
+
+  // a change of the values waits for the minimum interval
+  interface.add_key_value("count", 2);
+  EXPECT_FALSE(interface.publish(at(50)));
+  EXPECT_TRUE(interface.publish(at(100)));
+  EXPECT_FALSE(interface.publish(at(300)));
+
+  // a change of the level is published immediately
+  interface.update_level_and_message(diagnostic_msgs::msg::DiagnosticStatus::WARN, "slow");
+  EXPECT_TRUE(interface.publish(at(310)));
+  EXPECT_FALSE(interface.publish(at(320)));
+
+  // an unchanged status is published at the heartbeat
+  EXPECT_FALSE(interface.publish(at(1000)));
+  EXPECT_TRUE(interface.publish(at(1310)));
+}
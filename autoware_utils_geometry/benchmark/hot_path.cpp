@@ -0,0 +1,272 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "allocation_counter.hpp"
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_polygon_utils.hpp"
+#include "autoware_utils_geometry/ear_clipping.hpp"
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+#include "autoware_utils_geometry/rigid_transform.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Hot paths of the planning and perception modules at the sizes they see in a cycle. Each
+// benchmark reports the heap allocations per call next to the time.
+namespace
+{
+using benchmark_support::allocation_count;
+using benchmark_support::report_allocations;
+
+std::vector<autoware_utils_geometry::Point3d> make_points(const std::size_t size)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+  std::vector<autoware_utils_geometry::Point3d> points;
+  points.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    points.emplace_back(coordinate(gen), coordinate(gen), coordinate(gen));
+  }
+  return points;
+}
+
+/// @brief poses along a smooth curve with a spacing of 1 m, as a trajectory
+std::vector<geometry_msgs::msg::Pose> make_trajectory(const std::size_t size)
+{
+  std::vector<geometry_msgs::msg::Pose> poses(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double s = static_cast<double>(i);
+    const double yaw = 0.3 * std::sin(0.05 * s);
+    poses[i].position = autoware_utils_geometry::create_point(s, 10.0 * std::sin(0.01 * s), 0.0);
+    poses[i].orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+  }
+  return poses;
+}
+
+geometry_msgs::msg::Transform make_transform()
+{
+  geometry_msgs::msg::Transform transform;
+  transform.translation.x = 1.0;
+  transform.translation.y = -2.0;
+  transform.translation.z = 0.5;
+  transform.rotation = autoware_utils_geometry::create_quaternion_from_rpy(0.01, -0.02, 0.7);
+  return transform;
+}
+
+/// @brief args: number of points
+void transform_point_msg(benchmark::State & state)
+{
+  const auto points = make_points(static_cast<std::size_t>(state.range(0)));
+  const auto transform = make_transform();
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (const auto & point : points) {
+      benchmark::DoNotOptimize(autoware_utils_geometry::transform_point(point, transform));
+    }
+  }
+  report_allocations(state, allocations_before, points.size());
+}
+
+/// @brief args: number of points
+void transform_point_rigid(benchmark::State & state)
+{
+  const auto points = make_points(static_cast<std::size_t>(state.range(0)));
+  const autoware_utils_geometry::RigidTransform3d transform(make_transform());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (const auto & point : points) {
+      benchmark::DoNotOptimize(autoware_utils_geometry::transform_point(point, transform));
+    }
+  }
+  report_allocations(state, allocations_before, points.size());
+}
+
+/// @brief args: number of poses
+void calc_distance2d(benchmark::State & state)
+{
+  const auto poses = make_trajectory(static_cast<std::size_t>(state.range(0)));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    double length = 0.0;
+    for (std::size_t i = 0; i + 1 < poses.size(); ++i) {
+      length += autoware_utils_geometry::calc_distance2d(poses[i], poses[i + 1]);
+    }
+    benchmark::DoNotOptimize(length);
+  }
+  report_allocations(state, allocations_before, poses.size() - 1);
+}
+
+/// @brief args: number of poses, 1 to take the orientation from the positions, 0 to slerp
+void calc_interpolated_pose(benchmark::State & state)
+{
+  const auto poses = make_trajectory(static_cast<std::size_t>(state.range(0)));
+  const bool from_positions = state.range(1) != 0;
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i + 1 < poses.size(); ++i) {
+      benchmark::DoNotOptimize(autoware_utils_geometry::calc_interpolated_pose(
+        poses[i], poses[i + 1], 0.3, from_positions));
+    }
+  }
+  report_allocations(state, allocations_before, poses.size() - 1);
+}
+
+autoware_utils_geometry::alt::Polygon2d make_concave_polygon(const std::size_t vertices)
+{
+  std::mt19937_64 gen(0);
+  const auto polygon = autoware_utils_geometry::random_star_polygon(vertices, 10.0, gen);
+  return autoware_utils_geometry::alt::Polygon2d::create(polygon).value();
+}
+
+/// @brief args: number of vertices
+void triangulate(benchmark::State & state)
+{
+  const auto polygon = make_concave_polygon(static_cast<std::size_t>(state.range(0)));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware_utils_geometry::triangulate(polygon));
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of vertices
+void triangulator(benchmark::State & state)
+{
+  const auto polygon = make_concave_polygon(static_cast<std::size_t>(state.range(0)));
+  autoware_utils_geometry::Triangulator triangulator;
+  triangulator.triangulate(polygon);  // the buffers are allocated by the first call
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(triangulator.triangulate(polygon).data());
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+autoware_utils_geometry::alt::Points2d make_cloud(const std::size_t size)
+{
+  std::mt19937 gen(0);
+  std::normal_distribution<double> coordinate(0.0, 5.0);
+  autoware_utils_geometry::alt::Points2d points;
+  points.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    points.emplace_back(coordinate(gen), coordinate(gen));
+  }
+  return points;
+}
+
+/// @brief args: number of points
+void convex_hull(benchmark::State & state)
+{
+  const auto points = make_cloud(static_cast<std::size_t>(state.range(0)));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware_utils_geometry::convex_hull(points));
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of points
+void convex_hull_buffer(benchmark::State & state)
+{
+  const auto points = make_cloud(static_cast<std::size_t>(state.range(0)));
+  // the points are reordered in place, so they are copied into a buffer allocated once
+  auto work = points;
+  autoware_utils_geometry::alt::PointList2d hull;
+  autoware_utils_geometry::convex_hull(work, hull);
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    std::copy(points.begin(), points.end(), work.begin());
+    benchmark::DoNotOptimize(autoware_utils_geometry::convex_hull(work, hull));
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief noisy polyline along a curve, as a lane boundary with a point every 0.1 m
+autoware_utils_geometry::alt::PointList2d make_polyline(const std::size_t size)
+{
+  std::mt19937 gen(0);
+  std::normal_distribution<double> noise(0.0, 0.02);
+  autoware_utils_geometry::alt::PointList2d line;
+  line.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double s = 0.1 * static_cast<double>(i);
+    line.emplace_back(s + noise(gen), 5.0 * std::sin(0.05 * s) + noise(gen));
+  }
+  return line;
+}
+
+/// @brief args: number of points
+void simplify(benchmark::State & state)
+{
+  const auto line = make_polyline(static_cast<std::size_t>(state.range(0)));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware_utils_geometry::simplify(line, 0.05));
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of points
+void simplify_douglas_peucker(benchmark::State & state)
+{
+  const auto line = make_polyline(static_cast<std::size_t>(state.range(0)));
+  std::vector<std::size_t> kept_indices;
+  autoware_utils_geometry::SimplifyBuffer buffer;
+  autoware_utils_geometry::simplify_douglas_peucker(
+    line.data(), line.size(), 0.05, kept_indices, buffer);
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    autoware_utils_geometry::simplify_douglas_peucker(
+      line.data(), line.size(), 0.05, kept_indices, buffer);
+    benchmark::DoNotOptimize(kept_indices.data());
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of vertices
+void expand_polygon(benchmark::State & state)
+{
+  const auto polygon =
+    autoware_utils_geometry::random_convex_polygon(static_cast<std::size_t>(state.range(0)), 2.0);
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware_utils_geometry::expand_polygon(polygon, 0.5));
+  }
+  report_allocations(state, allocations_before, 1);
+}
+}  // namespace
+
+BENCHMARK(transform_point_msg)->Arg(100)->Arg(10000)->ArgName("points");
+BENCHMARK(transform_point_rigid)->Arg(100)->Arg(10000)->ArgName("points");
+BENCHMARK(calc_distance2d)->Arg(200)->Arg(2000)->ArgName("poses");
+BENCHMARK(calc_interpolated_pose)
+  ->ArgsProduct({{200, 2000}, {0, 1}})
+  ->ArgNames({"poses", "from_positions"});
+BENCHMARK(triangulate)->Arg(16)->Arg(64)->Arg(256)->ArgName("vertices");
+BENCHMARK(triangulator)->Arg(16)->Arg(64)->Arg(256)->ArgName("vertices");
+BENCHMARK(convex_hull)->Arg(100)->Arg(1000)->Arg(10000)->ArgName("points");
+BENCHMARK(convex_hull_buffer)->Arg(100)->Arg(1000)->Arg(10000)->ArgName("points");
+BENCHMARK(simplify)->Arg(100)->Arg(1000)->ArgName("points");
+BENCHMARK(simplify_douglas_peucker)->Arg(100)->Arg(1000)->Arg(10000)->ArgName("points");
+BENCHMARK(expand_polygon)->Arg(8)->Arg(32)->ArgName("vertices");
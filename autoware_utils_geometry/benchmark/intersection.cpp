@@ -0,0 +1,260 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "allocation_counter.hpp"
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_geometry.hpp"
+#include "autoware_utils_geometry/gjk_2d.hpp"
+#include "autoware_utils_geometry/oriented_box_2d.hpp"
+#include "autoware_utils_geometry/prepared_convex_polygon.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+#include "autoware_utils_geometry/sat_2d.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::Polygon2d;
+
+/**
+ * @brief Two sets of random convex polygons.
+ * @details The polygons have a radius of at most 1 and their centers are spread uniformly over a
+ *          square of the given side, so the smaller the side, the more pairs overlap.
+ */
+struct Inputs
+{
+  Inputs(const std::size_t vertices, const std::size_t polygons, const double spread)
+  {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> offset(-spread / 2, spread / 2);
+    for (auto * set : {&polygons1, &polygons2}) {
+      for (std::size_t i = 0; i < polygons; ++i) {
+        auto polygon = autoware_utils_geometry::random_convex_polygon(vertices, 1.0);
+        const double dx = offset(gen);
+        const double dy = offset(gen);
+        for (auto & point : polygon.outer()) {
+          point = autoware_utils_geometry::Point2d(point.x() + dx, point.y() + dy);
+        }
+        set->push_back(polygon);
+      }
+    }
+  }
+
+  std::vector<Polygon2d> polygons1;
+  std::vector<Polygon2d> polygons2;
+};
+
+/// @brief args: number of vertices, number of polygons in each set, spread in tenths
+Inputs make_inputs(const benchmark::State & state)
+{
+  return Inputs(
+    static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)),
+    static_cast<double>(state.range(2)) / 10.0);
+}
+
+/// @brief test all the pairs between the sets and report the time and the allocations per query
+template <class Polygons1, class Polygons2, class Predicate>
+void run(
+  benchmark::State & state, const Polygons1 & polygons1, const Polygons2 & polygons2,
+  const Predicate & predicate)
+{
+  std::size_t hits = 0;
+  const auto allocations_before = benchmark_support::allocation_count();
+  for (auto _ : state) {
+    for (const auto & polygon1 : polygons1) {
+      for (const auto & polygon2 : polygons2) {
+        const bool hit = predicate(polygon1, polygon2);
+        benchmark::DoNotOptimize(hit);
+        hits += hit;
+      }
+    }
+  }
+  const auto queries =
+    static_cast<double>(state.iterations() * polygons1.size() * polygons2.size());
+  state.SetItemsProcessed(static_cast<int64_t>(queries));
+  state.counters["ns/query"] = benchmark::Counter(
+    queries, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  state.counters["allocs/query"] =
+    static_cast<double>(benchmark_support::allocation_count() - allocations_before) / queries;
+  state.counters["hit_ratio"] = static_cast<double>(hits) / queries;
+}
+
+void boost_intersects(benchmark::State & state)
+{
+  const auto inputs = make_inputs(state);
+  run(state, inputs.polygons1, inputs.polygons2, [](const auto & p1, const auto & p2) {
+    return boost::geometry::intersects(p1, p2);
+  });
+}
+
+void sat_intersects(benchmark::State & state)
+{
+  const auto inputs = make_inputs(state);
+  run(state, inputs.polygons1, inputs.polygons2, [](const auto & p1, const auto & p2) {
+    return autoware_utils_geometry::sat::intersects(p1, p2);
+  });
+}
+
+void sat_prepared_intersects(benchmark::State & state)
+{
+  const auto inputs = make_inputs(state);
+  const std::vector<autoware_utils_geometry::PreparedConvexPolygon2d> prepared(
+    inputs.polygons1.begin(), inputs.polygons1.end());
+  run(state, prepared, inputs.polygons2, [](const auto & p1, const auto & p2) {
+    return autoware_utils_geometry::sat::intersects(p1, p2);
+  });
+}
+
+// intersects_convex forwards to gjk::intersects
+void gjk_intersects(benchmark::State & state)
+{
+  const auto inputs = make_inputs(state);
+  run(state, inputs.polygons1, inputs.polygons2, [](const auto & p1, const auto & p2) {
+    return autoware_utils_geometry::gjk::intersects(p1, p2);
+  });
+}
+
+void alt_intersects(benchmark::State & state)
+{
+  const auto inputs = make_inputs(state);
+  const auto to_alt = [](const std::vector<Polygon2d> & polygons) {
+    std::vector<autoware_utils_geometry::alt::ConvexPolygon2d> alt_polygons;
+    for (const auto & polygon : polygons) {
+      alt_polygons.push_back(
+        autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon).value());
+    }
+    return alt_polygons;
+  };
+  run(
+    state, to_alt(inputs.polygons1), to_alt(inputs.polygons2),
+    [](const auto & p1, const auto & p2) { return autoware_utils_geometry::intersects(p1, p2); });
+}
+
+/**
+ * @brief Two sets of vehicle footprints with random yaws, their centers spread uniformly over a
+ *        square of the given side.
+ * @details args: number of boxes in each set, spread in tenths
+ */
+struct BoxInputs
+{
+  explicit BoxInputs(const benchmark::State & state)
+  {
+    const auto spread = static_cast<double>(state.range(1)) / 10.0;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> offset(-spread / 2, spread / 2);
+    std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+    for (auto * set : {&boxes1, &boxes2}) {
+      for (int64_t i = 0; i < state.range(0); ++i) {
+        geometry_msgs::msg::Pose pose;
+        pose.position.x = offset(gen);
+        pose.position.y = offset(gen);
+        const double angle = yaw(gen);
+        pose.orientation.z = std::sin(angle / 2);
+        pose.orientation.w = std::cos(angle / 2);
+        set->push_back(autoware_utils_geometry::OrientedBox2d::from_footprint(pose, 3.8, 1.0, 1.8));
+      }
+    }
+  }
+
+  std::vector<autoware_utils_geometry::OrientedBox2d> boxes1;
+  std::vector<autoware_utils_geometry::OrientedBox2d> boxes2;
+};
+
+void box_sat_intersects(benchmark::State & state)
+{
+  const BoxInputs inputs(state);
+  const auto to_polygons = [](const std::vector<autoware_utils_geometry::OrientedBox2d> & boxes) {
+    std::vector<Polygon2d> polygons;
+    for (const auto & box : boxes) {
+      polygons.push_back(box.to_polygon());
+    }
+    return polygons;
+  };
+  run(
+    state, to_polygons(inputs.boxes1), to_polygons(inputs.boxes2),
+    [](const auto & p1, const auto & p2) {
+      return autoware_utils_geometry::sat::intersects(p1, p2);
+    });
+}
+
+void box_intersects(benchmark::State & state)
+{
+  const BoxInputs inputs(state);
+  run(state, inputs.boxes1, inputs.boxes2, [](const auto & b1, const auto & b2) {
+    return autoware_utils_geometry::sat::intersects(b1, b2);
+  });
+}
+
+void box_batch_intersects(benchmark::State & state)
+{
+  const BoxInputs inputs(state);
+  autoware_utils_geometry::OrientedBoxArray2d boxes2;
+  for (const auto & box : inputs.boxes2) {
+    boxes2.push_back(box);
+  }
+  std::vector<char> results;
+  std::size_t hits = 0;
+  for (auto _ : state) {
+    for (const auto & box : inputs.boxes1) {
+      hits += autoware_utils_geometry::sat::intersects(box, boxes2, results);
+      benchmark::DoNotOptimize(results.data());
+    }
+  }
+  const auto queries =
+    static_cast<double>(state.iterations() * inputs.boxes1.size() * inputs.boxes2.size());
+  state.SetItemsProcessed(static_cast<int64_t>(queries));
+  state.counters["ns/query"] = benchmark::Counter(
+    queries, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  state.counters["hit_ratio"] = static_cast<double>(hits) / queries;
+}
+
+/// @brief sweep the number of boxes and the spread, i.e. the overlap ratio
+void box_sweep(benchmark::internal::Benchmark * benchmark)
+{
+  for (const int64_t boxes : {10, 100, 1000}) {
+    for (const int64_t spread : {100, 1000}) {
+      benchmark->Args({boxes, spread});
+    }
+  }
+  benchmark->ArgNames({"boxes", "spread_x10"});
+}
+
+/// @brief sweep the vertices, the number of polygons and the spread, i.e. the overlap ratio
+void sweep(benchmark::internal::Benchmark * benchmark)
+{
+  for (const int64_t vertices : {4, 8, 16, 32}) {
+    for (const int64_t polygons : {1, 10, 100}) {
+      for (const int64_t spread : {10, 40, 200}) {
+        benchmark->Args({vertices, polygons, spread});
+      }
+    }
+  }
+  benchmark->ArgNames({"vertices", "polygons", "spread_x10"});
+}
+}  // namespace
+
+BENCHMARK(boost_intersects)->Apply(sweep);
+BENCHMARK(sat_intersects)->Apply(sweep);
+BENCHMARK(sat_prepared_intersects)->Apply(sweep);
+BENCHMARK(gjk_intersects)->Apply(sweep);
+BENCHMARK(alt_intersects)->Apply(sweep);
+BENCHMARK(box_sat_intersects)->Apply(box_sweep);
+BENCHMARK(box_intersects)->Apply(box_sweep);
+BENCHMARK(box_batch_intersects)->Apply(box_sweep);
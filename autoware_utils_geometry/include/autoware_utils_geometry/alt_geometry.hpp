@@ -16,9 +16,14 @@
 #define AUTOWARE_UTILS_GEOMETRY__ALT_GEOMETRY_HPP_
 
 #include "autoware_utils_geometry/boost_geometry.hpp"
+#include "autoware_utils_geometry/small_vector.hpp"
 
-#include <list>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -28,69 +33,103 @@ namespace autoware_utils_geometry
 // TODO(mitukou1109): remove namespace
 namespace alt
 {
-class Vector2d
+/**
+ * @brief 2D vector in double or single precision
+ * @details The single precision is enough for the local frames within a few hundred meters. The
+ *          conversions between the precisions are explicit.
+ */
+template <class T>
+class Vector2
 {
 public:
-  Vector2d() : x_(0.0), y_(0.0) {}
+  using value_type = T;
 
-  Vector2d(const double x, const double y) : x_(x), y_(y) {}
+  Vector2() : x_(0), y_(0) {}
 
-  explicit Vector2d(const autoware_utils_geometry::Point2d & point) : x_(point.x()), y_(point.y())
+  Vector2(const T x, const T y) : x_(x), y_(y) {}
+
+  explicit Vector2(const autoware_utils_geometry::Point2d & point)
+  : x_(static_cast<T>(point.x())), y_(static_cast<T>(point.y()))
+  {
+  }
+
+  explicit Vector2(const autoware_utils_geometry::Point2f & point)
+  : x_(static_cast<T>(point.x())), y_(static_cast<T>(point.y()))
   {
   }
 
-  double cross(const Vector2d & other) const { return x_ * other.y() - y_ * other.x(); }
+  template <class U>
+  explicit Vector2(const Vector2<U> & other)
+  : x_(static_cast<T>(other.x())), y_(static_cast<T>(other.y()))
+  {
+  }
 
-  double dot(const Vector2d & other) const { return x_ * other.x() + y_ * other.y(); }
+  T cross(const Vector2 & other) const { return x_ * other.y() - y_ * other.x(); }
 
-  double norm2() const { return x_ * x_ + y_ * y_; }
+  T dot(const Vector2 & other) const { return x_ * other.x() + y_ * other.y(); }
 
-  double norm() const { return std::sqrt(norm2()); }
+  T norm2() const { return x_ * x_ + y_ * y_; }
 
-  Vector2d vector_triple(const Vector2d & v1, const Vector2d & v2) const
+  T norm() const { return std::sqrt(norm2()); }
+
+  Vector2 vector_triple(const Vector2 & v1, const Vector2 & v2) const
   {
     const auto tmp = this->cross(v1);
     return {-v2.y() * tmp, v2.x() * tmp};
   }
 
-  const double & x() const { return x_; }
+  const T & x() const { return x_; }
 
-  double & x() { return x_; }
+  T & x() { return x_; }
 
-  const double & y() const { return y_; }
+  const T & y() const { return y_; }
 
-  double & y() { return y_; }
+  T & y() { return y_; }
 
 private:
-  double x_;
-  double y_;
+  T x_;
+  T y_;
 };
 
-inline Vector2d operator+(const Vector2d & v1, const Vector2d & v2)
+template <class T>
+inline Vector2<T> operator+(const Vector2<T> & v1, const Vector2<T> & v2)
 {
   return {v1.x() + v2.x(), v1.y() + v2.y()};
 }
 
-inline Vector2d operator-(const Vector2d & v1, const Vector2d & v2)
+template <class T>
+inline Vector2<T> operator-(const Vector2<T> & v1, const Vector2<T> & v2)
 {
   return {v1.x() - v2.x(), v1.y() - v2.y()};
 }
 
-inline Vector2d operator-(const Vector2d & v)
+template <class T>
+inline Vector2<T> operator-(const Vector2<T> & v)
 {
   return {-v.x(), -v.y()};
 }
 
-inline Vector2d operator*(const double & s, const Vector2d & v)
+// the scalar is not deduced so that a double multiplies a single precision vector
+template <class T>
+inline Vector2<T> operator*(const typename Vector2<T>::value_type & s, const Vector2<T> & v)
 {
   return {s * v.x(), s * v.y()};
 }
 
+using Vector2d = Vector2<double>;
+using Vector2f = Vector2<float>;
+
 // We use Vector2d to represent points, but we do not name the class Point2d directly
 // as it has some vector operation functions.
 using Point2d = Vector2d;
 using Points2d = std::vector<Point2d>;
-using PointList2d = std::list<Point2d>;
+// The vertex rings are stored contiguously, and inline for the small polygons such as footprints.
+inline constexpr std::size_t ring_inline_capacity = 16;
+using PointList2d = SmallVector<Point2d, ring_inline_capacity>;
+
+using Point2f = Vector2f;
+using Points2f = std::vector<Point2f>;
+using PointList2f = SmallVector<Point2f, ring_inline_capacity>;
 
 class Polygon2d
 {
@@ -149,22 +188,205 @@ private:
 
   explicit ConvexPolygon2d(PointList2d && vertices) : Polygon2d(std::move(vertices), {}) {}
 };
+
+/**
+ * @brief Correct a vertex ring stored contiguously in place as correct() does, and check that it is
+ *        a convex polygon.
+ * @param capacity size of the buffer, the ring is closed only if there is room for the point
+ * @return the size of the corrected ring, or nullopt if it is not a valid convex polygon
+ */
+std::optional<std::size_t> correct_convex_ring(
+  Point2d * vertices, const std::size_t size, const std::size_t capacity) noexcept;
+
+std::optional<std::size_t> correct_convex_ring(
+  Point2f * vertices, const std::size_t size, const std::size_t capacity) noexcept;
+
+/**
+ * @brief Convex polygon with at most N vertices stored inline.
+ * @details Unlike ConvexPolygon2d, it never allocates. The vertices are a closed clockwise ring, so
+ *          vertices() has at most N + 1 points. T is the precision of the coordinates.
+ */
+template <class T, std::size_t N>
+class StaticConvexPolygon2
+{
+  static_assert(3 <= N, "A polygon needs at least 3 vertices.");
+
+public:
+  using Point = Vector2<T>;
+  using BoostPolygon = std::conditional_t<
+    std::is_same_v<T, float>, autoware_utils_geometry::Polygon2f,
+    autoware_utils_geometry::Polygon2d>;
+
+  static constexpr std::size_t max_vertices = N;
+
+  /// @details The vertices of the other precision are converted, e.g. from a ConvexPolygon2d.
+  template <class Range>
+  static std::optional<StaticConvexPolygon2> create(const Range & vertices) noexcept
+  {
+    StaticConvexPolygon2 poly;
+    std::size_t size = 0;
+    for (const auto & vertex : vertices) {
+      if (poly.vertices_.size() <= size) {
+        return std::nullopt;
+      }
+      poly.vertices_[size++] = Point(vertex);
+    }
+    const auto corrected_size =
+      correct_convex_ring(poly.vertices_.data(), size, poly.vertices_.size());
+    if (!corrected_size) {
+      return std::nullopt;
+    }
+    poly.size_ = *corrected_size;
+    return poly;
+  }
+
+  static std::optional<StaticConvexPolygon2> create(std::initializer_list<Point> vertices) noexcept
+  {
+    return create<std::initializer_list<Point>>(vertices);
+  }
+
+  /**
+   * @brief Create the rectangle of a footprint without the correction and the convexity check.
+   * @details The vertices are the same as to_footprint. base_to_front + base_to_rear and width
+   *          must be positive.
+   * @param origin position of the base
+   * @param yaw heading of the rectangle
+   */
+  static StaticConvexPolygon2 create_box(
+    const Point & origin, const double yaw, const double base_to_front, const double base_to_rear,
+    const double width) noexcept
+  {
+    static_assert(4 <= N, "A box has 4 vertices.");
+    const Point forward(static_cast<T>(std::cos(yaw)), static_cast<T>(std::sin(yaw)));
+    const Point left(-forward.y(), forward.x());
+    const auto front = origin + static_cast<T>(base_to_front) * forward;
+    const auto rear = origin - static_cast<T>(base_to_rear) * forward;
+    const auto half_width = static_cast<T>(0.5 * width) * left;
+
+    StaticConvexPolygon2 poly;
+    poly.vertices_[0] = front + half_width;
+    poly.vertices_[1] = front - half_width;
+    poly.vertices_[2] = rear - half_width;
+    poly.vertices_[3] = rear + half_width;
+    poly.vertices_[4] = poly.vertices_[0];
+    poly.size_ = 5;
+    return poly;
+  }
+
+  /// @brief Create the rectangle of a box centered at center, as to_polygon2d does for objects.
+  static StaticConvexPolygon2 create_box(
+    const Point & center, const double yaw, const double length, const double width) noexcept
+  {
+    return create_box(center, yaw, 0.5 * length, 0.5 * length, width);
+  }
+
+  const Point * begin() const noexcept { return vertices_.data(); }
+
+  const Point * end() const noexcept { return vertices_.data() + size_; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  BoostPolygon to_boost() const
+  {
+    BoostPolygon polygon;
+    for (const auto & point : *this) {
+      polygon.outer().emplace_back(point.x(), point.y());
+    }
+    return polygon;
+  }
+
+private:
+  StaticConvexPolygon2() = default;
+
+  std::array<Point, N + 1> vertices_;
+  std::size_t size_{0};
+};
+
+template <std::size_t N>
+using StaticConvexPolygon2d = StaticConvexPolygon2<double, N>;
+
+template <std::size_t N>
+using StaticConvexPolygon2f = StaticConvexPolygon2<float, N>;
+
+/**
+ * @brief Non-owning view of the closed clockwise vertex ring of a convex polygon.
+ * @details The polygon predicates take this view, so they accept ConvexPolygon2d and
+ *          StaticConvexPolygon2d alike. The polygon must outlive the view.
+ */
+template <class T>
+class ConvexPolygon2View
+{
+public:
+  using Point = Vector2<T>;
+
+  template <class U = T, std::enable_if_t<std::is_same_v<U, double>, int> = 0>
+  ConvexPolygon2View(const ConvexPolygon2d & poly) noexcept  // NOLINT
+  : begin_(poly.vertices().data()), size_(poly.vertices().size())
+  {
+  }
+
+  template <std::size_t N>
+  ConvexPolygon2View(const StaticConvexPolygon2<T, N> & poly) noexcept  // NOLINT
+  : begin_(poly.begin()), size_(poly.size())
+  {
+  }
+
+  const Point * begin() const noexcept { return begin_; }
+
+  const Point * end() const noexcept { return begin_ + size_; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  const Point & front() const noexcept { return *begin_; }
+
+  const Point & back() const noexcept { return begin_[size_ - 1]; }
+
+private:
+  const Point * begin_;
+  std::size_t size_;
+};
+
+using ConvexPolygon2dView = ConvexPolygon2View<double>;
+using ConvexPolygon2fView = ConvexPolygon2View<float>;
 }  // namespace alt
 
-double area(const alt::ConvexPolygon2d & poly);
+double area(const alt::ConvexPolygon2dView & poly);
 
 std::optional<alt::ConvexPolygon2d> convex_hull(const alt::Points2d & points);
 
+/**
+ * @brief Compute the convex hull into a reusable buffer with the monotone chain algorithm.
+ * @details The points are reordered in place. For the large inputs, the points inside the
+ *          quadrilateral of the extreme points are discarded before sorting.
+ * @param hull closed clockwise ring of the hull vertices without collinear points, which can be
+ *        passed to ConvexPolygon2d::create
+ * @param points_sorted true if the points are already sorted by x and then by y, the sort is
+ *        skipped
+ * @return false if the points do not span a polygon with an area
+ */
+bool convex_hull(alt::Points2d & points, alt::PointList2d & hull, const bool points_sorted = false);
+
 void correct(alt::Polygon2d & poly);
 
-bool covered_by(const alt::Point2d & point, const alt::ConvexPolygon2d & poly);
+bool covered_by(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly);
 
-bool disjoint(const alt::ConvexPolygon2d & poly1, const alt::ConvexPolygon2d & poly2);
+/**
+ * @brief covered_by() for many points, with the half-planes of the edges computed once
+ * @details The points are evaluated 8 at a time in a loop that the compiler vectorizes. The
+ *          boundary tolerance applies to the lines of the edges, so the result may differ from
+ *          covered_by() for the points within the tolerance of a vertex.
+ * @param indices indices of the covered points in increasing order, cleared first
+ */
+void covered_by(
+  const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices);
+
+bool disjoint(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
 
 double distance(
   const alt::Point2d & point, const alt::Point2d & seg_start, const alt::Point2d & seg_end);
 
-double distance(const alt::Point2d & point, const alt::ConvexPolygon2d & poly);
+double distance(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly);
 
 std::optional<alt::ConvexPolygon2d> envelope(const alt::Polygon2d & poly);
 
@@ -175,11 +397,37 @@ bool equals(const alt::Polygon2d & poly1, const alt::Polygon2d & poly2);
 alt::Points2d::const_iterator find_farthest(
   const alt::Points2d & points, const alt::Point2d & seg_start, const alt::Point2d & seg_end);
 
+/**
+ * @brief Compute the intersection of two convex polygons by clipping one with the other with the
+ *        Sutherland-Hodgman algorithm.
+ * @return the intersection, or std::nullopt if the polygons do not overlap or only touch
+ */
+std::optional<alt::ConvexPolygon2d> intersection(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
+
+/// @brief Compute the area of the intersection of two convex polygons, clipped in inline buffers.
+double intersection_area(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
+
 bool intersects(
   const alt::Point2d & seg1_start, const alt::Point2d & seg1_end, const alt::Point2d & seg2_start,
   const alt::Point2d & seg2_end);
 
-bool intersects(const alt::ConvexPolygon2d & poly1, const alt::ConvexPolygon2d & poly2);
+bool intersects(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
+
+/// @brief Compute the intersection over union of two convex polygons, 0 if both are empty.
+double iou(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
+
+/**
+ * @brief Compute the intersection over union of all the pairs of two sets of convex polygons, e.g.
+ *        the footprints of the tracked and the detected objects for their association.
+ * @details The areas and the bounding boxes are computed once per polygon, and the pairs whose
+ *          boxes are disjoint are not clipped.
+ * @param ious row-major matrix of polys1.size() rows and polys2.size() columns
+ */
+void iou(
+  const std::vector<alt::ConvexPolygon2d> & polys1,
+  const std::vector<alt::ConvexPolygon2d> & polys2, std::vector<double> & ious);
 
 bool is_above(
   const alt::Point2d & point, const alt::Point2d & seg_start, const alt::Point2d & seg_end);
@@ -188,17 +436,127 @@ bool is_clockwise(const alt::PointList2d & vertices);
 
 bool is_convex(const alt::Polygon2d & poly);
 
+/// @brief Rectangle with its length along yaw, the longer side, and its width across it.
+struct OrientedRectangle
+{
+  alt::Point2d center;
+  double yaw;
+  double length;
+  double width;
+};
+
+/**
+ * @brief Compute the minimum area rectangle enclosing a convex polygon with rotating calipers.
+ * @details One side of the rectangle lies on an edge of the polygon. Use convex_hull first for a
+ *          set of points. StaticConvexPolygon2d<4>::create_box converts the result to a polygon.
+ */
+OrientedRectangle min_area_rectangle(const alt::ConvexPolygon2dView & poly);
+
+/// @brief Compute the enclosing rectangle whose width is the minimum width of a convex polygon.
+OrientedRectangle min_width_rectangle(const alt::ConvexPolygon2dView & poly);
+
+/**
+ * @brief Compute the Minkowski sum of two convex polygons in O(n + m) by merging their edges.
+ * @details To inflate an obstacle into the configuration space of the ego footprint at a yaw, add
+ *          the footprint at the origin with this yaw reflected through the origin, so that the
+ *          footprint at a position intersects the obstacle iff the position is covered_by() the
+ *          sum.
+ * @return the sum, or std::nullopt if a polygon is empty
+ */
+std::optional<alt::ConvexPolygon2d> minkowski_sum(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2);
+
+/**
+ * @brief Compute the Minkowski sums of many polygons with the same shape, e.g. the obstacles
+ *        inflated by the ego footprint.
+ * @param sums sums in the order of polys, whose storage is reused, which must not be polys
+ */
+void minkowski_sum(
+  const std::vector<alt::ConvexPolygon2d> & polys, const alt::ConvexPolygon2dView & shape,
+  std::vector<alt::ConvexPolygon2d> & sums);
+
 alt::PointList2d simplify(const alt::PointList2d & line, const double max_distance);
 
+/// @brief Scratch storage of the simplification algorithms, reuse it across calls to avoid
+///        reallocation.
+struct SimplifyBuffer
+{
+  std::vector<std::size_t> stack;
+  std::vector<std::size_t> prev;
+  std::vector<std::size_t> next;
+  std::vector<double> areas;
+  std::vector<std::pair<double, std::size_t>> heap;
+};
+
+/**
+ * @brief Simplify a polyline with the Douglas-Peucker algorithm using an explicit stack.
+ * @details The points farther than max_distance from the simplified segments are kept recursively.
+ * @param points contiguous polyline of size points
+ * @param kept_indices indices of the kept points in increasing order, including the end points
+ */
+void simplify_douglas_peucker(
+  const alt::Point2d * points, const std::size_t size, const double max_distance,
+  std::vector<std::size_t> & kept_indices, SimplifyBuffer & buffer);
+
+/**
+ * @brief Simplify a polyline with the Visvalingam-Whyatt algorithm.
+ * @details The point making the smallest triangle with its neighbors is removed repeatedly while
+ *          its area is below max_area or more than max_points remain. The end points are kept.
+ * @param points contiguous polyline of size points
+ * @param kept_indices indices of the kept points in increasing order, including the end points
+ */
+void simplify_visvalingam(
+  const alt::Point2d * points, const std::size_t size, const double max_area,
+  const std::size_t max_points, std::vector<std::size_t> & kept_indices, SimplifyBuffer & buffer);
+
 bool touches(
   const alt::Point2d & point, const alt::Point2d & seg_start, const alt::Point2d & seg_end);
 
-bool touches(const alt::Point2d & point, const alt::ConvexPolygon2d & poly);
+bool touches(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly);
+
+bool within(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly);
+
+/// @brief within() for many points, see the batched covered_by()
+void within(
+  const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices);
+
+bool within(
+  const alt::ConvexPolygon2dView & poly_contained,
+  const alt::ConvexPolygon2dView & poly_containing);
+
+// Single precision versions of the predicates for the collision checks in a local frame. The
+// coordinates should stay within a few hundred meters of the origin, where the rounding is below a
+// millimeter, and the boundary tolerances are below the rounding.
+
+float area(const alt::ConvexPolygon2fView & poly);
+
+bool covered_by(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly);
+
+void covered_by(
+  const alt::Points2f & points, const alt::ConvexPolygon2fView & poly,
+  std::vector<std::size_t> & indices);
+
+bool disjoint(const alt::ConvexPolygon2fView & poly1, const alt::ConvexPolygon2fView & poly2);
+
+bool equals(const alt::Point2f & point1, const alt::Point2f & point2);
+
+bool intersects(const alt::ConvexPolygon2fView & poly1, const alt::ConvexPolygon2fView & poly2);
+
+bool touches(
+  const alt::Point2f & point, const alt::Point2f & seg_start, const alt::Point2f & seg_end);
+
+bool touches(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly);
+
+bool within(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly);
 
-bool within(const alt::Point2d & point, const alt::ConvexPolygon2d & poly);
+void within(
+  const alt::Points2f & points, const alt::ConvexPolygon2fView & poly,
+  std::vector<std::size_t> & indices);
 
 bool within(
-  const alt::ConvexPolygon2d & poly_contained, const alt::ConvexPolygon2d & poly_containing);
+  const alt::ConvexPolygon2fView & poly_contained,
+  const alt::ConvexPolygon2fView & poly_containing);
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__ALT_GEOMETRY_HPP_
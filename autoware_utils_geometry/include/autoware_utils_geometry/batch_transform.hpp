@@ -0,0 +1,207 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__BATCH_TRANSFORM_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__BATCH_TRANSFORM_HPP_
+
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_geometry/rigid_transform.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/transform.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Structure-of-arrays buffer of positions and orientations used by the batch transforms.
+ * @details Keeping one instance alive across cycles lets the batch transforms reuse its storage.
+ */
+struct PoseArraySoA
+{
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<double> qx;
+  std::vector<double> qy;
+  std::vector<double> qz;
+  std::vector<double> qw;
+
+  void resize(const std::size_t size, const bool with_orientation = true);
+  std::size_t size() const { return x.size(); }
+};
+
+/**
+ * @brief Transform the positions stored in the buffer in place.
+ * @details The rotation matrix is built once and applied to all the elements in a single loop.
+ */
+void transform_positions(PoseArraySoA & soa, const RigidTransform3d & transform);
+
+void transform_positions(PoseArraySoA & soa, const geometry_msgs::msg::Transform & transform);
+
+/**
+ * @brief Transform the positions and orientations stored in the buffer in place.
+ * @details The output orientations are normalized in the same way as transform_pose.
+ */
+void transform_poses(PoseArraySoA & soa, const RigidTransform3d & transform);
+
+void transform_poses(PoseArraySoA & soa, const geometry_msgs::msg::Transform & transform);
+
+/**
+ * @brief Transform all the points in place using one rotation matrix for the whole container.
+ * @param points container of objects with x, y and z members such as Point or Point32
+ * @param transform transform applied to every point
+ * @param buffer scratch storage, reuse it across calls to avoid reallocation
+ */
+template <class PointContainer>
+void transform_points(
+  PointContainer & points, const RigidTransform3d & transform, PoseArraySoA & buffer)
+{
+  buffer.resize(points.size(), false);
+  std::size_t i = 0;
+  for (const auto & p : points) {
+    buffer.x[i] = p.x;
+    buffer.y[i] = p.y;
+    buffer.z[i] = p.z;
+    ++i;
+  }
+
+  transform_positions(buffer, transform);
+
+  i = 0;
+  for (auto & p : points) {
+    p.x = static_cast<decltype(p.x)>(buffer.x[i]);
+    p.y = static_cast<decltype(p.y)>(buffer.y[i]);
+    p.z = static_cast<decltype(p.z)>(buffer.z[i]);
+    ++i;
+  }
+}
+
+template <class PointContainer>
+void transform_points(PointContainer & points, const RigidTransform3d & transform)
+{
+  PoseArraySoA buffer;
+  transform_points(points, transform, buffer);
+}
+
+template <class PointContainer>
+void transform_points(
+  PointContainer & points, const geometry_msgs::msg::Transform & transform, PoseArraySoA & buffer)
+{
+  transform_points(points, RigidTransform3d(transform), buffer);
+}
+
+template <class PointContainer>
+void transform_points(PointContainer & points, const geometry_msgs::msg::Transform & transform)
+{
+  PoseArraySoA buffer;
+  transform_points(points, RigidTransform3d(transform), buffer);
+}
+
+template <class PointContainer>
+void transform_points(
+  PointContainer & points, const geometry_msgs::msg::Pose & pose, PoseArraySoA & buffer)
+{
+  transform_points(points, RigidTransform3d(pose), buffer);
+}
+
+template <class PointContainer>
+void transform_points(PointContainer & points, const geometry_msgs::msg::Pose & pose)
+{
+  PoseArraySoA buffer;
+  transform_points(points, RigidTransform3d(pose), buffer);
+}
+
+/**
+ * @brief Transform all the poses in place using one rotation matrix for the whole container.
+ * @param poses container of any type supported by get_pose and set_pose, e.g. TrajectoryPoint
+ * @param transform transform applied to every pose
+ * @param buffer scratch storage, reuse it across calls to avoid reallocation
+ */
+template <class PoseContainer>
+void transform_poses(
+  PoseContainer & poses, const RigidTransform3d & transform, PoseArraySoA & buffer)
+{
+  buffer.resize(poses.size());
+  std::size_t i = 0;
+  for (const auto & p : poses) {
+    const auto pose = get_pose(p);
+    buffer.x[i] = pose.position.x;
+    buffer.y[i] = pose.position.y;
+    buffer.z[i] = pose.position.z;
+    buffer.qx[i] = pose.orientation.x;
+    buffer.qy[i] = pose.orientation.y;
+    buffer.qz[i] = pose.orientation.z;
+    buffer.qw[i] = pose.orientation.w;
+    ++i;
+  }
+
+  transform_poses(buffer, transform);
+
+  i = 0;
+  for (auto & p : poses) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = buffer.x[i];
+    pose.position.y = buffer.y[i];
+    pose.position.z = buffer.z[i];
+    pose.orientation.x = buffer.qx[i];
+    pose.orientation.y = buffer.qy[i];
+    pose.orientation.z = buffer.qz[i];
+    pose.orientation.w = buffer.qw[i];
+    set_pose(pose, p);
+    ++i;
+  }
+}
+
+template <class PoseContainer>
+void transform_poses(PoseContainer & poses, const RigidTransform3d & transform)
+{
+  PoseArraySoA buffer;
+  transform_poses(poses, transform, buffer);
+}
+
+template <class PoseContainer>
+void transform_poses(
+  PoseContainer & poses, const geometry_msgs::msg::Transform & transform, PoseArraySoA & buffer)
+{
+  transform_poses(poses, RigidTransform3d(transform), buffer);
+}
+
+template <class PoseContainer>
+void transform_poses(PoseContainer & poses, const geometry_msgs::msg::Transform & transform)
+{
+  PoseArraySoA buffer;
+  transform_poses(poses, RigidTransform3d(transform), buffer);
+}
+
+template <class PoseContainer>
+void transform_poses(
+  PoseContainer & poses, const geometry_msgs::msg::Pose & pose, PoseArraySoA & buffer)
+{
+  transform_poses(poses, RigidTransform3d(pose), buffer);
+}
+
+template <class PoseContainer>
+void transform_poses(PoseContainer & poses, const geometry_msgs::msg::Pose & pose)
+{
+  PoseArraySoA buffer;
+  transform_poses(poses, RigidTransform3d(pose), buffer);
+}
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__BATCH_TRANSFORM_HPP_
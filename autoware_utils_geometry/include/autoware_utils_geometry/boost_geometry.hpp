@@ -25,6 +25,9 @@
 
 #include <geometry_msgs/msg/point.hpp>
 
+#include <cstddef>
+#include <type_traits>
+
 namespace autoware_utils_geometry
 {
 // 2D
@@ -39,6 +42,21 @@ using MultiPoint2d = boost::geometry::model::multi_point<Point2d>;
 using MultiLineString2d = boost::geometry::model::multi_linestring<LineString2d>;
 using MultiPolygon2d = boost::geometry::model::multi_polygon<Polygon2d>;
 
+// 2D in single precision, for the local frames within a few hundred meters
+struct Point2f;
+using Segment2f = boost::geometry::model::segment<Point2f>;
+using Box2f = boost::geometry::model::box<Point2f>;
+using LineString2f = boost::geometry::model::linestring<Point2f>;
+using LinearRing2f = boost::geometry::model::ring<Point2f>;
+using Polygon2f = boost::geometry::model::polygon<Point2f>;
+using MultiPoint2f = boost::geometry::model::multi_point<Point2f>;
+using MultiPolygon2f = boost::geometry::model::multi_polygon<Polygon2f>;
+
+// 2D over a trivially copyable point, for the rings copied in bulk
+struct PlainPoint2d;
+using PlainLinearRing2d = boost::geometry::model::ring<PlainPoint2d>;
+using PlainPolygon2d = boost::geometry::model::polygon<PlainPoint2d>;
+
 // 3D
 struct Point3d;
 using Segment3d = boost::geometry::model::segment<Point3d>;
@@ -66,6 +84,65 @@ struct Point3d : public Eigen::Vector3d
   [[nodiscard]] Point2d to_2d() const;
 };
 
+/// @brief The conversions from and to Point2d are explicit as they change the precision.
+struct Point2f : public Eigen::Vector2f
+{
+  Point2f() : Eigen::Vector2f(0.0f, 0.0f) {}
+  Point2f(const float x, const float y) : Eigen::Vector2f(x, y) {}
+  explicit Point2f(const Point2d & point)
+  : Eigen::Vector2f(static_cast<float>(point.x()), static_cast<float>(point.y()))
+  {
+  }
+
+  [[nodiscard]] Point2d to_double() const { return Point2d{x(), y()}; }
+};
+
+/**
+ * @brief Point2d without the Eigen base
+ * @details It is trivially copyable, so its rings are plain arrays of interleaved x and y which
+ *          are copied with memcpy, e.g. from a memory mapped file. as_eigen() gives an Eigen view.
+ */
+struct PlainPoint2d
+{
+  double x;
+  double y;
+};
+
+static_assert(std::is_trivially_copyable_v<PlainPoint2d>);
+static_assert(sizeof(PlainPoint2d) == 2 * sizeof(double));
+
+inline Eigen::Map<Eigen::Vector2d> as_eigen(PlainPoint2d & point)
+{
+  return Eigen::Map<Eigen::Vector2d>(&point.x);
+}
+
+inline Eigen::Map<const Eigen::Vector2d> as_eigen(const PlainPoint2d & point)
+{
+  return Eigen::Map<const Eigen::Vector2d>(&point.x);
+}
+
+/// @brief view of contiguous points as the columns of a 2xN matrix
+inline Eigen::Map<Eigen::Matrix2Xd> as_eigen(PlainPoint2d * points, const std::size_t size)
+{
+  return Eigen::Map<Eigen::Matrix2Xd>(&points->x, 2, static_cast<Eigen::Index>(size));
+}
+
+inline Eigen::Map<const Eigen::Matrix2Xd> as_eigen(
+  const PlainPoint2d * points, const std::size_t size)
+{
+  return Eigen::Map<const Eigen::Matrix2Xd>(&points->x, 2, static_cast<Eigen::Index>(size));
+}
+
+inline PlainPoint2d to_plain(const Point2d & point)
+{
+  return PlainPoint2d{point.x(), point.y()};
+}
+
+inline Point2d from_plain(const PlainPoint2d & point)
+{
+  return Point2d{point.x, point.y};
+}
+
 inline Point3d Point2d::to_3d(const double z) const
 {
   return Point3d{x(), y(), z};
@@ -99,6 +176,49 @@ BOOST_GEOMETRY_REGISTER_POINT_2D(                                          // NO
   autoware_utils_geometry::Point2d, double, cs::cartesian, x(), y())       // NOLINT
 BOOST_GEOMETRY_REGISTER_POINT_3D(                                          // NOLINT
   autoware_utils_geometry::Point3d, double, cs::cartesian, x(), y(), z())  // NOLINT
+BOOST_GEOMETRY_REGISTER_POINT_2D(                                          // NOLINT
+  autoware_utils_geometry::Point2f, float, cs::cartesian, x(), y())        // NOLINT
+BOOST_GEOMETRY_REGISTER_POINT_2D(                                          // NOLINT
+  autoware_utils_geometry::PlainPoint2d, double, cs::cartesian, x, y)      // NOLINT
 BOOST_GEOMETRY_REGISTER_RING(autoware_utils_geometry::LinearRing2d)  // NOLINT
+BOOST_GEOMETRY_REGISTER_RING(autoware_utils_geometry::LinearRing2f)  // NOLINT
+
+namespace autoware_utils_geometry
+{
+/// @brief Round the vertices of a polygon to single precision.
+inline Polygon2f to_float(const Polygon2d & polygon)
+{
+  Polygon2f converted;
+  converted.outer().reserve(polygon.outer().size());
+  for (const auto & point : polygon.outer()) {
+    converted.outer().emplace_back(point);
+  }
+  converted.inners().resize(polygon.inners().size());
+  for (std::size_t i = 0; i < polygon.inners().size(); ++i) {
+    converted.inners()[i].reserve(polygon.inners()[i].size());
+    for (const auto & point : polygon.inners()[i]) {
+      converted.inners()[i].emplace_back(point);
+    }
+  }
+  return converted;
+}
+
+inline Polygon2d to_double(const Polygon2f & polygon)
+{
+  Polygon2d converted;
+  converted.outer().reserve(polygon.outer().size());
+  for (const auto & point : polygon.outer()) {
+    converted.outer().push_back(point.to_double());
+  }
+  converted.inners().resize(polygon.inners().size());
+  for (std::size_t i = 0; i < polygon.inners().size(); ++i) {
+    converted.inners()[i].reserve(polygon.inners()[i].size());
+    for (const auto & point : polygon.inners()[i]) {
+      converted.inners()[i].push_back(point.to_double());
+    }
+  }
+  return converted;
+}
+}  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__BOOST_GEOMETRY_HPP_
@@ -18,10 +18,15 @@
 #include <autoware_utils_geometry/boost_geometry.hpp>
 
 #include <autoware_perception_msgs/msg/detected_object.hpp>
+#include <autoware_perception_msgs/msg/detected_objects.hpp>
 #include <autoware_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/predicted_path.hpp>
 #include <autoware_perception_msgs/msg/tracked_object.hpp>
+#include <autoware_perception_msgs/msg/tracked_objects.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 
+#include <cstddef>
 #include <vector>
 
 namespace autoware_utils_geometry
@@ -42,11 +47,112 @@ Polygon2d to_polygon2d(
 Polygon2d to_polygon2d(const autoware_perception_msgs::msg::DetectedObject & object);
 Polygon2d to_polygon2d(const autoware_perception_msgs::msg::TrackedObject & object);
 Polygon2d to_polygon2d(const autoware_perception_msgs::msg::PredictedObject & object);
+
+/// @brief polygons of many objects stored contiguously, to be reused across cycles
+struct PolygonArray2d
+{
+  /// @brief closed clockwise rings of the polygons, one after the other
+  std::vector<PlainPoint2d> points;
+  /// @brief the ring of the i-th polygon is points[offsets[i]] to points[offsets[i + 1] - 1]
+  std::vector<std::size_t> offsets{0};
+
+  std::size_t size() const { return offsets.size() - 1; }
+  const PlainPoint2d * ring_begin(const std::size_t i) const { return points.data() + offsets[i]; }
+  const PlainPoint2d * ring_end(const std::size_t i) const
+  {
+    return points.data() + offsets[i + 1];
+  }
+
+  /// @brief copy of the i-th polygon, as to_polygon2d() of the i-th object
+  Polygon2d polygon(const std::size_t i) const;
+
+  /// @brief copy of the i-th polygon with a single memcpy of its ring, reusing the storage
+  void polygon(const std::size_t i, PlainPolygon2d & polygon) const;
+};
+
+/// @brief to_polygon2d() of all the objects, with the shape and the pose transform done in one pass
+/// @details the rotated polygon footprints are not rounded to float as in to_polygon2d()
+/// @param[out] polygons output polygons, their storage is reused
+/// @param[in] num_threads number of chunks of objects run in parallel on
+/// autoware_utils_system::ThreadPool::shared(), only used from 200 objects
+/// @throw std::logic_error if the shape type of an object is not supported
+void to_polygon2d(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads = 1);
+void to_polygon2d(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads = 1);
+void to_polygon2d(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads = 1);
+
+/// @brief footprints of an object along one of its predicted paths
+struct SweptFootprint
+{
+  /// @brief time of each footprint from the first pose of the path [s]
+  std::vector<double> times;
+  /// @brief closed clockwise footprint at each pose of the path
+  std::vector<Polygon2d> footprints;
+  /// @brief convex hull of the footprints i and i + 1, empty if not requested
+  std::vector<Polygon2d> segment_hulls;
+};
+
+/// @brief footprints of the shape of an object moved along a predicted path
+/// @details the shape polygon is computed once in the object frame and each pose of the path only
+/// rotates it by its yaw and translates it, instead of calling to_polygon2d() for every pose
+/// @param[out] swept output footprints, their storage is reused
+/// @param[in] with_segment_hulls also compute the convex hull of each pair of consecutive
+/// footprints, which covers the swept area of the segment when the shape is convex
+/// @throw std::logic_error if the shape type of the object is not supported
+void to_swept_footprint(
+  const autoware_perception_msgs::msg::PredictedObject & object,
+  const autoware_perception_msgs::msg::PredictedPath & path, SweptFootprint & swept,
+  const bool with_segment_hulls = false);
+
 Polygon2d to_footprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width);
 double get_area(const autoware_perception_msgs::msg::Shape & shape);
+
+/// @brief area, perimeter and centroid of a shape
+struct ShapeStats
+{
+  double area{0.0};       // same as get_area(), negative for clockwise polygon footprints
+  double perimeter{0.0};  // of the exact rectangle or circle for boxes and cylinders
+  Point2d centroid{};     // in the object frame for a shape, in the map frame for objects
+};
+
+/// @brief area, perimeter and centroid of a shape, computed without building a polygon
+/// @throw std::logic_error if the shape type is not supported
+ShapeStats get_shape_stats(const autoware_perception_msgs::msg::Shape & shape);
+
+/// @brief get_shape_stats() of all the objects in one pass, the centroids are moved to their pose
+/// @param[out] stats stats of each object, the storage is reused
+/// @throw std::logic_error if the shape type of an object is not supported
+void get_shape_stats(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, std::vector<ShapeStats> & stats);
+void get_shape_stats(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, std::vector<ShapeStats> & stats);
+void get_shape_stats(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, std::vector<ShapeStats> & stats);
+
 Polygon2d expand_polygon(const Polygon2d & input_polygon, const double offset);
+
+/// @brief shape of the corners of expand_convex_polygon()
+enum class ExpandJoin { mitre, round };
+
+/// @brief expand a convex polygon by moving each edge out along its normal
+/// @param[in] convex_polygon clockwise convex polygon, closed or not, whose consecutive duplicate
+/// points are skipped
+/// @param[in] offset distance by which the edges are moved [m]
+/// @param[out] expanded_polygon closed clockwise polygon, its storage is reused, empty if the input
+/// has less than 3 distinct points
+/// @param[in] join mitre to extend the moved edges until they meet, round to join them with arcs
+/// of radius offset around the original vertices
+/// @param[in] points_per_circle number of segments of a full circle for the round joins
+void expand_convex_polygon(
+  const Polygon2d & convex_polygon, const double offset, Polygon2d & expanded_polygon,
+  const ExpandJoin join = ExpandJoin::mitre, const size_t points_per_circle = 16);
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__BOOST_POLYGON_UTILS_HPP_
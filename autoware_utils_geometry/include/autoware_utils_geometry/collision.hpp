@@ -0,0 +1,122 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__COLLISION_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__COLLISION_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/spatial_hash_grid.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+struct CollisionPair
+{
+  std::size_t index1;  // index in the first set of polygons
+  std::size_t index2;  // index in the second set of polygons
+};
+
+/**
+ * @brief Find all the pairs of intersecting polygons between two sets of convex polygons.
+ * @details The bounding boxes of the polygons, the same as envelope, are swept along the x axis and
+ *          intersects is only called for the pairs whose boxes overlap. The result is the same as
+ *          calling intersects for every pair, sorted by index1 and then index2.
+ */
+std::vector<CollisionPair> find_collisions(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2);
+
+/**
+ * @brief Find the first pair of intersecting polygons in the order of find_collisions.
+ * @details The narrow phase stops at the first hit, e.g. the first colliding footprint along a
+ *          trajectory when polygons1 are the footprints.
+ */
+std::optional<CollisionPair> find_first_collision(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2);
+
+/**
+ * @brief Find the first pair of intersecting polygons in the order of find_collisions, searching
+ *        coarse to fine along the footprints of a path.
+ * @details The bounding boxes of the consecutive footprints are merged pairwise into a hierarchy,
+ *          which is bisected from the first footprint while only the objects overlapping the box
+ *          of a range are kept, so that the ranges away from all the objects are skipped at once
+ *          and the search stops at the first colliding footprint. The result is the same as
+ *          find_first_collision, which sorts and sweeps all the boxes before the first check, and
+ *          this suits long paths with few objects near them better.
+ * @param footprints polygons along a path, the spatially close ones at consecutive indices
+ * @param objects obstacles, whose index is index2 of the result
+ */
+std::optional<CollisionPair> find_first_collision_along_path(
+  const std::vector<alt::ConvexPolygon2dView> & footprints,
+  const std::vector<alt::ConvexPolygon2dView> & objects);
+
+/**
+ * @brief Find all the pairs of intersecting polygons with a spatial hash grid as the broad phase.
+ * @details polygons2 are inserted into the grid, which keeps its storage across the calls, and the
+ *          grid is queried with the bounding box of each of polygons1. This suits polygons of
+ *          similar sizes, e.g. the objects moving every cycle, with cells of about their size.
+ *          The result is the same as find_collisions without the grid.
+ */
+std::vector<CollisionPair> find_collisions(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2, SpatialHashGrid & grid);
+
+/// @brief Overload for the containers of ConvexPolygon2d or StaticConvexPolygon2d.
+template <class Polygons1, class Polygons2>
+std::vector<CollisionPair> find_collisions(
+  const Polygons1 & polygons1, const Polygons2 & polygons2)
+{
+  return find_collisions(
+    std::vector<alt::ConvexPolygon2dView>(polygons1.begin(), polygons1.end()),
+    std::vector<alt::ConvexPolygon2dView>(polygons2.begin(), polygons2.end()));
+}
+
+/// @brief Overload for the containers of ConvexPolygon2d or StaticConvexPolygon2d.
+template <class Polygons1, class Polygons2>
+std::optional<CollisionPair> find_first_collision(
+  const Polygons1 & polygons1, const Polygons2 & polygons2)
+{
+  return find_first_collision(
+    std::vector<alt::ConvexPolygon2dView>(polygons1.begin(), polygons1.end()),
+    std::vector<alt::ConvexPolygon2dView>(polygons2.begin(), polygons2.end()));
+}
+
+/// @brief Overload for the containers of ConvexPolygon2d or StaticConvexPolygon2d.
+template <class Footprints, class Objects>
+std::optional<CollisionPair> find_first_collision_along_path(
+  const Footprints & footprints, const Objects & objects)
+{
+  return find_first_collision_along_path(
+    std::vector<alt::ConvexPolygon2dView>(footprints.begin(), footprints.end()),
+    std::vector<alt::ConvexPolygon2dView>(objects.begin(), objects.end()));
+}
+
+/// @brief Overload for the containers of ConvexPolygon2d or StaticConvexPolygon2d.
+template <class Polygons1, class Polygons2>
+std::vector<CollisionPair> find_collisions(
+  const Polygons1 & polygons1, const Polygons2 & polygons2, SpatialHashGrid & grid)
+{
+  return find_collisions(
+    std::vector<alt::ConvexPolygon2dView>(polygons1.begin(), polygons1.end()),
+    std::vector<alt::ConvexPolygon2dView>(polygons2.begin(), polygons2.end()), grid);
+}
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__COLLISION_HPP_
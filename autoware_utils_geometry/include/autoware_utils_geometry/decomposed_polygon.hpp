@@ -0,0 +1,59 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__DECOMPOSED_POLYGON_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__DECOMPOSED_POLYGON_HPP_
+
+#include "autoware_utils_geometry/boost_geometry.hpp"
+#include "autoware_utils_geometry/prepared_convex_polygon.hpp"
+
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Concave polygon, with or without holes, cached as a set of prepared convex pieces.
+ * @details The polygon is decomposed once with convex_decompose(), so that intersection tests
+ *          against it only use the convex predicates on the pieces whose bounding box overlaps.
+ */
+class DecomposedPolygon2d
+{
+public:
+  /**
+   * @throw std::invalid_argument if the polygon is empty
+   */
+  explicit DecomposedPolygon2d(const Polygon2d & polygon);
+
+  const std::vector<PreparedConvexPolygon2d> & pieces() const { return pieces_; }
+
+  const Box2d & box() const { return box_; }
+
+private:
+  std::vector<PreparedConvexPolygon2d> pieces_;
+  Box2d box_;
+};
+
+/**
+ * @brief Check if a decomposed polygon intersects a convex polygon
+ * @details the result is the same as boost::geometry::intersects() on the original polygon, up to
+ *          the tolerance of the SAT algorithm for touching polygons
+ */
+bool intersects(const DecomposedPolygon2d & polygon, const Polygon2d & convex_polygon);
+
+bool intersects(const DecomposedPolygon2d & polygon1, const DecomposedPolygon2d & polygon2);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__DECOMPOSED_POLYGON_HPP_
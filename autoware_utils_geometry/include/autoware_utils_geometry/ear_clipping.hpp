@@ -17,26 +17,56 @@
 
 #include "autoware_utils_geometry/alt_geometry.hpp"
 
-#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace autoware_utils_geometry
 {
 struct LinkedPoint
 {
+  /// @brief sentinel of the links that are not set
+  static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
   explicit LinkedPoint(const alt::Point2d & point)
-  : pt(point), steiner(false), prev_index(std::nullopt), next_index(std::nullopt)
+  : pt(point),
+    vertex_index(none),
+    steiner(false),
+    prev_index(none),
+    next_index(none),
+    z(0),
+    prev_z(none),
+    next_z(none)
   {
   }
 
   alt::Point2d pt;
+  std::size_t vertex_index;  // index of the input vertex, shared by the copies of split_polygon()
   bool steiner;
-  std::optional<std::size_t> prev_index;
-  std::optional<std::size_t> next_index;
+  std::size_t prev_index;
+  std::size_t next_index;
+  std::uint32_t z;     // z-order curve value, only set when the z-order hashing is enabled
+  std::size_t prev_z;  // previous point in z-order
+  std::size_t next_z;  // next point in z-order
   [[nodiscard]] double x() const { return pt.x(); }
   [[nodiscard]] double y() const { return pt.y(); }
 };
 
+/**
+ * @brief parameters of the z-order curve hashing of the points
+ * @details the coordinates are mapped to 15 bits integers in the bounding box of the outer ring.
+ * The hashing is disabled when inv_size is 0.
+ */
+struct ZOrderHash
+{
+  double min_x{0.0};
+  double min_y{0.0};
+  double inv_size{0.0};
+
+  [[nodiscard]] bool enabled() const { return inv_size != 0.0; }
+};
+
 /**
  * @brief main ear slicing loop which triangulates a polygon using linked list
  * @details iterates over the linked list of polygon points, cutting off triangular ears one by one
@@ -44,9 +74,10 @@ struct LinkedPoint
  */
 void ear_clipping_linked(
   std::size_t ear_index, std::vector<std::size_t> & indices, std::vector<LinkedPoint> & points,
-  const int pass = 0);
+  const int pass = 0, const ZOrderHash & hash = {});
 void split_ear_clipping(
-  std::vector<LinkedPoint> & points, std::size_t start_index, std::vector<std::size_t> & indices);
+  std::vector<LinkedPoint> & points, std::size_t start_index, std::vector<std::size_t> & indices,
+  const ZOrderHash & hash = {});
 
 /**
  * @brief creates a linked list from a ring of points
@@ -60,7 +91,7 @@ std::size_t linked_list(
 /**
  * @brief David Eberly's algorithm for finding a bridge between hole and outer polygon
  * @details connects a hole to the outer polygon by finding the closest bridge point
- * @return index of the bridge point
+ * @return index of the bridge point, LinkedPoint::none if the hole cannot be bridged
  */
 std::size_t find_hole_bridge(
   const std::size_t hole_index, const std::size_t outer_point_index,
@@ -76,17 +107,62 @@ std::size_t eliminate_hole(
 
 /**
  * @brief eliminates all holes from a polygon
- * @details processes multiple holes by connecting each to the outer polygon in sequence
+ * @details processes multiple holes by connecting each to the outer polygon in sequence, from
+ * left to right by the leftmost point of the holes
  * @return the updated outer_index after all holes are eliminated
  */
 std::size_t eliminate_holes(
   const std::vector<alt::PointList2d> & inners, std::size_t outer_index, std::size_t & vertices,
   std::vector<LinkedPoint> & points);
 
+/// @brief same as above, reusing the storage of the queue of holes
+std::size_t eliminate_holes(
+  const std::vector<alt::PointList2d> & inners, std::size_t outer_index, std::size_t & vertices,
+  std::vector<LinkedPoint> & points, std::vector<std::size_t> & queue);
+
+/**
+ * @brief Ear clipping triangulation which keeps its buffers between calls
+ * @details use one instance for all the polygons of a cycle to avoid allocations once the buffers
+ * are large enough
+ */
+class Triangulator
+{
+public:
+  /// @brief default number of vertices above which the z-order hashing is used
+  static constexpr std::size_t default_z_order_threshold = 80;
+
+  /**
+   * @param z_order_threshold number of vertices, holes included, above which the points are
+   * indexed on a z-order curve so that the ear test only visits the points near the ear
+   */
+  explicit Triangulator(const std::size_t z_order_threshold = default_z_order_threshold)
+  : z_order_threshold_(z_order_threshold)
+  {
+  }
+
+  /**
+   * @brief triangulates a polygon, with or without holes
+   * @return the indices of the vertices of each triangle, 3 by 3, in points(). The reference is
+   * valid until the next call.
+   */
+  const std::vector<std::size_t> & triangulate(const alt::Polygon2d & polygon);
+
+  /// @brief vertices of the last triangulation, including the duplicated points bridging holes
+  const std::vector<LinkedPoint> & points() const { return points_; }
+
+  const std::vector<std::size_t> & indices() const { return indices_; }
+
+private:
+  std::size_t z_order_threshold_;
+  std::vector<LinkedPoint> points_;
+  std::vector<std::size_t> indices_;
+  std::vector<std::size_t> hole_queue_;
+};
+
 /**
  * @brief triangulates a polygon into convex triangles
  * @details simplifies a concave polygon, with or without holes, into a set of triangles
- * the size of the `points` vector at the end of the perform_triangulation algorithm is described as
+ * by Triangulator::triangulate(), after which the size of Triangulator::points() is described as
  * follow:
  * - `outer_points`: Number of points in the initial outer linked list.
  * - `hole_points`: Number of points in all inner polygons.
@@ -101,6 +177,21 @@ std::vector<alt::ConvexPolygon2d> triangulate(const alt::Polygon2d & polygon);
  * @return A vector of convex triangles representing the triangulated polygon.
  */
 std::vector<Polygon2d> triangulate(const Polygon2d & polygon);
+
+/**
+ * @brief decomposes a polygon, with or without holes, into convex polygons
+ * @details the triangles of triangulate() are merged along their common edges with the
+ * Hertel-Mehlhorn algorithm: a diagonal is removed if both of its end points stay convex. The
+ * number of pieces is at most 4 times the minimum.
+ * @return A vector of convex polygons covering the polygon.
+ */
+std::vector<alt::ConvexPolygon2d> convex_decompose(const alt::Polygon2d & polygon);
+
+/**
+ * @brief Boost.Geometry version of convex_decompose()
+ * @return A vector of convex polygons covering the polygon.
+ */
+std::vector<Polygon2d> convex_decompose(const Polygon2d & polygon);
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__EAR_CLIPPING_HPP_
@@ -0,0 +1,172 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__FRENET_PROJECTOR_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__FRENET_PROJECTOR_HPP_
+
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_geometry/segment_index.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Frenet coordinates of a point relative to a path.
+ * @details s is the arc length of the foot of the point on the path, extrapolated before the first
+ *          and after the last point, and d is the signed distance to the foot, positive on the
+ *          left of the path.
+ */
+struct FrenetPoint
+{
+  double s;
+  double d;
+  std::size_t segment_index;
+};
+
+/**
+ * @brief Conversion between the XY plane and the Frenet coordinates of a reference path.
+ * @details The arc lengths and the unit directions of the segments are computed once, and a
+ *          PathSegmentIndex finds the nearest segment of a point in logarithmic time. The batch
+ *          projection starts the search of each point from the segment of the previous point and
+ *          walks along the path while the distance decreases, which is a few steps for points that
+ *          are close to each other such as the points of a path or of a footprint. The distance of
+ *          the walk then bounds the query of the index, which only visits the few nodes closer
+ *          than it, so that the result is the nearest segment even if the walk stopped early.
+ *          The segment i connects the points i and i + 1.
+ */
+class FrenetProjector
+{
+public:
+  FrenetProjector() = default;
+
+  template <class T>
+  explicit FrenetProjector(const std::vector<T> & points)
+  {
+    build(points);
+  }
+
+  template <class T>
+  void build(const std::vector<T> & points)
+  {
+    clear();
+    reserve(points.size());
+    for (const auto & point : points) {
+      const auto & p = get_point_view(point);
+      push_back(p.x, p.y, p.z);
+    }
+  }
+
+  void clear();
+
+  void reserve(const std::size_t num_points);
+
+  /// @brief Add a point at the end of the path.
+  void push_back(const double x, const double y, const double z = 0.0);
+
+  /// @brief Number of points of the path.
+  std::size_t size() const { return x_.size(); }
+
+  /// @brief Total length of the path.
+  double length() const { return arc_lengths_.empty() ? 0.0 : arc_lengths_.back(); }
+
+  /// @brief Arc length from the first point to each point, the size is size().
+  const std::vector<double> & arc_lengths() const { return arc_lengths_; }
+
+  /// @brief Project a point with the index, or nullopt if the path has less than two points.
+  template <class Point>
+  std::optional<FrenetPoint> project(const Point & point) const
+  {
+    const auto & p = get_point_view(point);
+    return project(p.x, p.y);
+  }
+
+  std::optional<FrenetPoint> project(const double x, const double y) const;
+
+  /**
+   * @brief Project a point starting the search from a segment, e.g. the segment of the same object
+   *        in the last cycle.
+   * @return The Frenet coordinates, or nullopt if the path has less than two points.
+   */
+  std::optional<FrenetPoint> project(const double x, const double y, const std::size_t hint) const;
+
+  /**
+   * @brief Project points in order, each one starting from the segment of the previous one.
+   * @param results Frenet coordinates of the points, the storage is reused.
+   * @return false if the path has less than two points, and the results are empty.
+   */
+  template <class T>
+  bool project(const std::vector<T> & points, std::vector<FrenetPoint> & results) const
+  {
+    results.clear();
+    if (x_.size() < 2) {
+      return false;
+    }
+    results.reserve(points.size());
+    std::size_t hint = 0;
+    for (const auto & point : points) {
+      const auto & p = get_point_view(point);
+      results.push_back(to_frenet(nearest_from(hint, p.x, p.y), p.x, p.y));
+      hint = results.back().segment_index;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Convert Frenet coordinates to a pose, extrapolated beyond the ends of the path.
+   * @details The orientation is the heading of the segment and the z is interpolated.
+   * @return The pose, or nullopt if the path has less than two points.
+   */
+  std::optional<geometry_msgs::msg::Pose> to_pose(const double s, const double d) const;
+
+  /**
+   * @brief Convert Frenet coordinates to poses, each one starting the search of its segment from
+   *        the segment of the previous one, which is constant time for sorted arc lengths.
+   * @return false if the path has less than two points, and the poses are empty.
+   */
+  bool to_poses(
+    const std::vector<FrenetPoint> & points, std::vector<geometry_msgs::msg::Pose> & poses) const;
+
+private:
+  std::size_t num_segments() const { return x_.empty() ? 0 : x_.size() - 1; }
+
+  double squared_distance(const std::size_t segment_index, const double x, const double y) const;
+
+  std::size_t walk(std::size_t segment_index, const double x, const double y) const;
+
+  std::size_t nearest_from(const std::size_t hint, const double x, const double y) const;
+
+  FrenetPoint to_frenet(const std::size_t segment_index, const double x, const double y) const;
+
+  geometry_msgs::msg::Pose to_pose(
+    const std::size_t segment_index, const double s, const double d) const;
+
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<double> arc_lengths_;
+  std::vector<double> unit_x_;  // direction of each segment, of the neighbors if degenerate
+  std::vector<double> unit_y_;
+  bool has_direction_{false};  // whether a segment is not degenerate
+  PathSegmentIndex index_;
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__FRENET_PROJECTOR_HPP_
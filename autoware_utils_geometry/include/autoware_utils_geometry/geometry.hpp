@@ -17,11 +17,17 @@
 
 #include "autoware_utils_geometry/boost_geometry.hpp"
 #include "autoware_utils_geometry/msg/covariance.hpp"
+#include "autoware_utils_geometry/point_access.hpp"
+#include "autoware_utils_geometry/point_traits.hpp"
+#include "autoware_utils_geometry/rigid_transform.hpp"
 #include "autoware_utils_math/constants.hpp"
 #include "autoware_utils_math/normalization.hpp"
 
 #include <exception>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
@@ -102,196 +108,6 @@ namespace autoware_utils_geometry
 using autoware_utils_math::normalize_radian;
 using autoware_utils_math::pi;
 
-template <class T>
-geometry_msgs::msg::Point get_point(const T & p)
-{
-  return geometry_msgs::build<geometry_msgs::msg::Point>().x(p.x).y(p.y).z(p.z);
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::Point & p)
-{
-  return p;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::Pose & p)
-{
-  return p.position;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::PoseStamped & p)
-{
-  return p.pose.position;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::PoseWithCovarianceStamped & p)
-{
-  return p.pose.pose.position;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const autoware_planning_msgs::msg::PathPoint & p)
-{
-  return p.pose.position;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(
-  const autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
-{
-  return p.point.pose.position;
-}
-
-template <>
-inline geometry_msgs::msg::Point get_point(const autoware_planning_msgs::msg::TrajectoryPoint & p)
-{
-  return p.pose.position;
-}
-
-template <class T>
-geometry_msgs::msg::Pose get_pose([[maybe_unused]] const T & p)
-{
-  static_assert(sizeof(T) == 0, "Only specializations of get_pose can be used.");
-  throw std::logic_error("Only specializations of get_pose can be used.");
-}
-
-template <>
-inline geometry_msgs::msg::Pose get_pose(const geometry_msgs::msg::Pose & p)
-{
-  return p;
-}
-
-template <>
-inline geometry_msgs::msg::Pose get_pose(const geometry_msgs::msg::PoseStamped & p)
-{
-  return p.pose;
-}
-
-template <>
-inline geometry_msgs::msg::Pose get_pose(const autoware_planning_msgs::msg::PathPoint & p)
-{
-  return p.pose;
-}
-
-template <>
-inline geometry_msgs::msg::Pose get_pose(
-  const autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
-{
-  return p.point.pose;
-}
-
-template <>
-inline geometry_msgs::msg::Pose get_pose(const autoware_planning_msgs::msg::TrajectoryPoint & p)
-{
-  return p.pose;
-}
-
-template <class T>
-double get_longitudinal_velocity([[maybe_unused]] const T & p)
-{
-  static_assert(sizeof(T) == 0, "Only specializations of getVelocity can be used.");
-  throw std::logic_error("Only specializations of getVelocity can be used.");
-}
-
-template <>
-inline double get_longitudinal_velocity(const autoware_planning_msgs::msg::PathPoint & p)
-{
-  return p.longitudinal_velocity_mps;
-}
-
-template <>
-inline double get_longitudinal_velocity(
-  const autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
-{
-  return p.point.longitudinal_velocity_mps;
-}
-
-template <>
-inline double get_longitudinal_velocity(const autoware_planning_msgs::msg::TrajectoryPoint & p)
-{
-  return p.longitudinal_velocity_mps;
-}
-
-template <class T>
-void set_pose([[maybe_unused]] const geometry_msgs::msg::Pose & pose, [[maybe_unused]] T & p)
-{
-  static_assert(sizeof(T) == 0, "Only specializations of get_pose can be used.");
-  throw std::logic_error("Only specializations of get_pose can be used.");
-}
-
-template <>
-inline void set_pose(const geometry_msgs::msg::Pose & pose, geometry_msgs::msg::Pose & p)
-{
-  p = pose;
-}
-
-template <>
-inline void set_pose(const geometry_msgs::msg::Pose & pose, geometry_msgs::msg::PoseStamped & p)
-{
-  p.pose = pose;
-}
-
-template <>
-inline void set_pose(
-  const geometry_msgs::msg::Pose & pose, autoware_planning_msgs::msg::PathPoint & p)
-{
-  p.pose = pose;
-}
-
-template <>
-inline void set_pose(
-  const geometry_msgs::msg::Pose & pose,
-  autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
-{
-  p.point.pose = pose;
-}
-
-template <>
-inline void set_pose(
-  const geometry_msgs::msg::Pose & pose, autoware_planning_msgs::msg::TrajectoryPoint & p)
-{
-  p.pose = pose;
-}
-
-template <class T>
-inline void set_orientation(const geometry_msgs::msg::Quaternion & orientation, T & p)
-{
-  auto pose = get_pose(p);
-  pose.orientation = orientation;
-  set_pose(pose, p);
-}
-
-template <class T>
-void set_longitudinal_velocity([[maybe_unused]] const float velocity, [[maybe_unused]] T & p)
-{
-  static_assert(sizeof(T) == 0, "Only specializations of getLongitudinalVelocity can be used.");
-  throw std::logic_error("Only specializations of getLongitudinalVelocity can be used.");
-}
-
-template <>
-inline void set_longitudinal_velocity(
-  const float velocity, autoware_planning_msgs::msg::TrajectoryPoint & p)
-{
-  p.longitudinal_velocity_mps = velocity;
-}
-
-template <>
-inline void set_longitudinal_velocity(
-  const float velocity, autoware_planning_msgs::msg::PathPoint & p)
-{
-  p.longitudinal_velocity_mps = velocity;
-}
-
-template <>
-inline void set_longitudinal_velocity(
-  const float velocity, autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
-{
-  p.point.longitudinal_velocity_mps = velocity;
-}
-
 inline geometry_msgs::msg::Point create_point(const double x, const double y, const double z)
 {
   geometry_msgs::msg::Point p;
@@ -319,35 +135,42 @@ geometry_msgs::msg::Vector3 create_translation(const double x, const double y, c
 geometry_msgs::msg::Quaternion create_quaternion_from_rpy(
   const double roll, const double pitch, const double yaw);
 
-geometry_msgs::msg::Quaternion create_quaternion_from_yaw(const double yaw);
+/**
+ * @brief Trade-off between accuracy and speed of the trigonometric functions.
+ * @details fast uses the float lookup table and polynomial approximations of autoware_utils_math,
+ *          whose errors are about 3e-5 for sin/cos and 2e-4 for atan2.
+ */
+enum class TrigonometryMode { accurate, fast };
 
-template <class Point1, class Point2>
-double calc_distance2d(const Point1 & point1, const Point2 & point2)
-{
-  const auto p1 = get_point(point1);
-  const auto p2 = get_point(point2);
-  return std::hypot(p1.x - p2.x, p1.y - p2.y);
-}
+geometry_msgs::msg::Quaternion create_quaternion_from_yaw(
+  const double yaw, const TrigonometryMode mode = TrigonometryMode::accurate);
 
-template <class Point1, class Point2>
-double calc_squared_distance2d(const Point1 & point1, const Point2 & point2)
-{
-  const auto p1 = get_point(point1);
-  const auto p2 = get_point(point2);
-  const auto dx = p1.x - p2.x;
-  const auto dy = p1.y - p2.y;
-  return dx * dx + dy * dy;
-}
+/**
+ * @brief Get the yaw angle of a quaternion in closed form.
+ * @details Same as get_rpy(quat).z without building a tf2::Matrix3x3.
+ * @return -pi <= yaw <= pi
+ */
+double get_yaw(
+  const geometry_msgs::msg::Quaternion & quat,
+  const TrigonometryMode mode = TrigonometryMode::accurate);
 
-template <class Point1, class Point2>
-double calc_distance3d(const Point1 & point1, const Point2 & point2)
+/// @brief Get the yaw angles of the orientations of all the points of a container.
+template <class T>
+void get_yaws(
+  const T & points, std::vector<double> & yaws,
+  const TrigonometryMode mode = TrigonometryMode::accurate)
 {
-  const auto p1 = get_point(point1);
-  const auto p2 = get_point(point2);
-  // To be replaced by std::hypot(dx, dy, dz) in C++17
-  return std::hypot(std::hypot(p1.x - p2.x, p1.y - p2.y), p1.z - p2.z);
+  yaws.resize(points.size());
+  std::size_t i = 0;
+  for (const auto & point : points) {
+    yaws[i++] = get_yaw(get_pose_view(point).orientation, mode);
+  }
 }
 
+void create_quaternions_from_yaws(
+  const std::vector<double> & yaws, std::vector<geometry_msgs::msg::Quaternion> & quaternions,
+  const TrigonometryMode mode = TrigonometryMode::accurate);
+
 /**
  * @brief calculate elevation angle of two points.
  * @details This function returns the elevation angle of the position of the two input points
@@ -385,8 +208,8 @@ geometry_msgs::msg::TransformStamped pose2transform(
 template <class Point1, class Point2>
 tf2::Vector3 point_2_tf_vector(const Point1 & src, const Point2 & dst)
 {
-  const auto src_p = get_point(src);
-  const auto dst_p = get_point(dst);
+  const auto & src_p = get_point_view(src);
+  const auto & dst_p = get_point_view(dst);
 
   double dx = dst_p.x - src_p.x;
   double dy = dst_p.y - src_p.y;
@@ -407,8 +230,27 @@ geometry_msgs::msg::Point transform_point(
 geometry_msgs::msg::Point32 transform_point(
   const geometry_msgs::msg::Point32 & point32, const geometry_msgs::msg::Pose & pose);
 
-template <class T>
-T transform_vector(const T & points, const geometry_msgs::msg::Transform & transform)
+Point3d transform_point(const Point3d & point, const RigidTransform3d & transform);
+
+Point2d transform_point(const Point2d & point, const RigidTransform3d & transform);
+
+Point2d transform_point(const Point2d & point, const RigidTransform2d & transform);
+
+Eigen::Vector3d transform_point(const Eigen::Vector3d & point, const RigidTransform3d & transform);
+
+geometry_msgs::msg::Point transform_point(
+  const geometry_msgs::msg::Point & point, const RigidTransform3d & transform);
+
+geometry_msgs::msg::Point32 transform_point(
+  const geometry_msgs::msg::Point32 & point32, const RigidTransform3d & transform);
+
+/**
+ * @brief Transform all the points of a container.
+ * @details Pass a RigidTransform3d or RigidTransform2d instead of a message to build the rotation
+ *          only once for the whole container.
+ */
+template <class T, class TransformT>
+T transform_vector(const T & points, const TransformT & transform)
 {
   T transformed;
   for (const auto & point : points) {
@@ -426,6 +268,9 @@ geometry_msgs::msg::Pose transform_pose(
 geometry_msgs::msg::Pose transform_pose(
   const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Pose & pose_transform);
 
+geometry_msgs::msg::Pose transform_pose(
+  const geometry_msgs::msg::Pose & pose, const RigidTransform3d & transform);
+
 // Transform pose in world coordinates to local coordinates
 /*
 geometry_msgs::msg::Pose inverse_transform_pose(
@@ -440,6 +285,10 @@ geometry_msgs::msg::Pose inverse_transform_pose(
 geometry_msgs::msg::Pose inverse_transform_pose(
   const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Pose & transform_pose);
 
+// Transform pose in world coordinates to local coordinates
+geometry_msgs::msg::Pose inverse_transform_pose(
+  const geometry_msgs::msg::Pose & pose, const RigidTransform3d & transform);
+
 // Transform point in world coordinates to local coordinates
 Eigen::Vector3d inverse_transform_point(
   const Eigen::Vector3d & point, const geometry_msgs::msg::Pose & pose);
@@ -448,6 +297,14 @@ Eigen::Vector3d inverse_transform_point(
 geometry_msgs::msg::Point inverse_transform_point(
   const geometry_msgs::msg::Point & point, const geometry_msgs::msg::Pose & pose);
 
+// Transform point in world coordinates to local coordinates
+Eigen::Vector3d inverse_transform_point(
+  const Eigen::Vector3d & point, const RigidTransform3d & transform);
+
+// Transform point in world coordinates to local coordinates
+geometry_msgs::msg::Point inverse_transform_point(
+  const geometry_msgs::msg::Point & point, const RigidTransform3d & transform);
+
 double calc_curvature(
   const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
   const geometry_msgs::msg::Point & p3);
@@ -456,11 +313,63 @@ template <class Pose1, class Pose2>
 bool is_driving_forward(const Pose1 & src_pose, const Pose2 & dst_pose)
 {
   // check the first point direction
-  const double src_yaw = tf2::getYaw(get_pose(src_pose).orientation);
-  const double pose_direction_yaw = calc_azimuth_angle(get_point(src_pose), get_point(dst_pose));
+  const double src_yaw = tf2::getYaw(get_pose_view(src_pose).orientation);
+  const double pose_direction_yaw =
+    calc_azimuth_angle(get_point_view(src_pose), get_point_view(dst_pose));
   return std::fabs(normalize_radian(src_yaw - pose_direction_yaw)) < pi / 2.0;
 }
 
+/// @brief Range [begin, end) of the indices of the points of a path driven in one direction.
+struct DrivingDirectionRange
+{
+  std::size_t begin;
+  std::size_t end;
+  bool is_driving_forward;
+};
+
+/**
+ * @brief Split a path into the ranges of constant driving direction, e.g. the forward and reverse
+ *        parts of a parking path, in one pass without copying the points.
+ * @details The direction of each pair of consecutive points is is_driving_forward, and a pair of
+ *          the same positions keeps the direction of its neighbors. Adjacent ranges share the
+ *          point of the direction change, which is the last point of a range and the first point of
+ *          the next one.
+ * @param ranges ranges in order covering all the points, empty if there are less than two points
+ */
+template <class T>
+void split_by_driving_direction(const T & points, std::vector<DrivingDirectionRange> & ranges)
+{
+  ranges.clear();
+  if (points.size() < 2) {
+    return;
+  }
+  ranges.push_back(DrivingDirectionRange{0, points.size(), true});
+  bool has_direction = false;
+  for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+    const auto & src = points[i];
+    const auto & dst = points[i + 1];
+    if (calc_squared_distance2d(src, dst) < 1e-12) {
+      continue;
+    }
+    const bool forward = is_driving_forward(src, dst);
+    if (!has_direction) {
+      ranges.back().is_driving_forward = forward;
+      has_direction = true;
+    } else if (forward != ranges.back().is_driving_forward) {
+      ranges.back().end = i + 1;
+      ranges.push_back(DrivingDirectionRange{i, points.size(), forward});
+    }
+  }
+}
+
+template <class T>
+std::vector<DrivingDirectionRange> split_by_driving_direction(const T & points)
+{
+  std::vector<DrivingDirectionRange> ranges;
+  split_by_driving_direction(points, ranges);
+  return ranges;
+}
+
 /**
  * @brief Calculate offset pose. The offset values are defined in the local coordinate of the input
  * pose.
@@ -469,6 +378,29 @@ geometry_msgs::msg::Pose calc_offset_pose(
   const geometry_msgs::msg::Pose & p, const double x, const double y, const double z,
   const double yaw = 0.0);
 
+/// @brief Offset in the local coordinate of a base pose, as the arguments of calc_offset_pose.
+struct PoseOffset
+{
+  double x;
+  double y;
+  double z;
+  double yaw;
+};
+
+/**
+ * @brief Calculate the offset poses of many offsets from the same base pose.
+ * @details Same as calc_offset_pose for each offset, but the rotation of the base pose is computed
+ *          only once. fast computes the yaw of the offsets with autoware_utils_math::sin_and_cos.
+ */
+void calc_offset_poses(
+  const geometry_msgs::msg::Pose & p, const std::vector<PoseOffset> & offsets,
+  std::vector<geometry_msgs::msg::Pose> & poses,
+  const TrigonometryMode mode = TrigonometryMode::accurate);
+
+std::vector<geometry_msgs::msg::Pose> calc_offset_poses(
+  const geometry_msgs::msg::Pose & p, const std::vector<PoseOffset> & offsets,
+  const TrigonometryMode mode = TrigonometryMode::accurate);
+
 /**
  * @brief Calculate a point by linear interpolation.
  * @param src source point
@@ -480,8 +412,8 @@ template <class Point1, class Point2>
 geometry_msgs::msg::Point calc_interpolated_point(
   const Point1 & src, const Point2 & dst, const double ratio)
 {
-  const auto src_point = get_point(src);
-  const auto dst_point = get_point(dst);
+  const auto & src_point = get_point_view(src);
+  const auto & dst_point = get_point_view(dst);
 
   tf2::Vector3 src_vec;
   src_vec.setX(src_point.x);
@@ -524,30 +456,29 @@ geometry_msgs::msg::Pose calc_interpolated_pose(
   const double clamped_ratio = std::clamp(ratio, 0.0, 1.0);
 
   geometry_msgs::msg::Pose output_pose;
-  output_pose.position =
-    calc_interpolated_point(get_point(src_pose), get_point(dst_pose), clamped_ratio);
+  output_pose.position = calc_interpolated_point(src_pose, dst_pose, clamped_ratio);
 
   if (set_orientation_from_position_direction) {
-    const double input_poses_dist = calc_distance2d(get_point(src_pose), get_point(dst_pose));
+    const double input_poses_dist = calc_distance2d(src_pose, dst_pose);
     const bool is_driving_forward_flag = is_driving_forward(src_pose, dst_pose);
 
     // Get orientation from interpolated point and src_pose
     if ((is_driving_forward_flag && clamped_ratio > 1.0 - (1e-6)) || input_poses_dist < 1e-3) {
-      output_pose.orientation = get_pose(dst_pose).orientation;
+      output_pose.orientation = get_pose_view(dst_pose).orientation;
     } else if (!is_driving_forward_flag && clamped_ratio < 1e-6) {
-      output_pose.orientation = get_pose(src_pose).orientation;
+      output_pose.orientation = get_pose_view(src_pose).orientation;
     } else {
       const auto & base_pose = is_driving_forward_flag ? dst_pose : src_pose;
-      const double pitch = calc_elevation_angle(get_point(output_pose), get_point(base_pose));
-      const double yaw = calc_azimuth_angle(get_point(output_pose), get_point(base_pose));
+      const double pitch = calc_elevation_angle(output_pose.position, get_point_view(base_pose));
+      const double yaw = calc_azimuth_angle(output_pose.position, get_point_view(base_pose));
       output_pose.orientation = create_quaternion_from_rpy(0.0, pitch, yaw);
     }
   } else {
     // Get orientation by spherical linear interpolation
     tf2::Transform src_tf;
     tf2::Transform dst_tf;
-    tf2::fromMsg(get_pose(src_pose), src_tf);
-    tf2::fromMsg(get_pose(dst_pose), dst_tf);
+    tf2::fromMsg(get_pose_view(src_pose), src_tf);
+    tf2::fromMsg(get_pose_view(dst_pose), dst_tf);
     const auto & quaternion = tf2::slerp(src_tf.getRotation(), dst_tf.getRotation(), clamped_ratio);
     output_pose.orientation = tf2::toMsg(quaternion);
   }
@@ -586,12 +517,84 @@ std::optional<geometry_msgs::msg::Point> intersect(
   const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
   const geometry_msgs::msg::Point & p3, const geometry_msgs::msg::Point & p4);
 
+struct PolylineIntersection
+{
+  std::size_t segment_index1;  // the segment from polyline1[segment_index1] to the next point
+  std::size_t segment_index2;
+  geometry_msgs::msg::Point point;
+};
+
+/**
+ * @brief Find all the intersections between the segments of two polylines.
+ * @details The bounding boxes of the segments are swept along the x axis and only the
+ *          overlapping pairs are passed to intersect(), so the result is the same as calling it
+ *          for all the pairs in a double loop. The intersections are sorted by segment_index1 and
+ *          then segment_index2.
+ */
+std::vector<PolylineIntersection> intersect_polylines(
+  const std::vector<geometry_msgs::msg::Point> & polyline1,
+  const std::vector<geometry_msgs::msg::Point> & polyline2);
+
+template <class T1, class T2>
+std::vector<PolylineIntersection> intersect_polylines(const T1 & polyline1, const T2 & polyline2)
+{
+  std::vector<geometry_msgs::msg::Point> points1;
+  std::vector<geometry_msgs::msg::Point> points2;
+  points1.reserve(polyline1.size());
+  points2.reserve(polyline2.size());
+  for (const auto & p : polyline1) {
+    points1.push_back(get_point_view(p));
+  }
+  for (const auto & p : polyline2) {
+    points2.push_back(get_point_view(p));
+  }
+  return intersect_polylines(points1, points2);
+}
+
 /**
  * @brief Check if 2 convex polygons intersect using the GJK algorithm
  * @details much faster than boost::geometry::intersects()
  */
 bool intersects_convex(const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2);
 
+// The instantiations of the heavier templates for the message types of the paths and the
+// trajectories are compiled once in the library instead of in each including translation unit.
+extern template geometry_msgs::msg::Point calc_interpolated_point(
+  const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Pose &, const double);
+extern template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_planning_msgs::msg::PathPoint &, const autoware_planning_msgs::msg::PathPoint &,
+  const double);
+extern template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &,
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &, const double);
+extern template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_planning_msgs::msg::TrajectoryPoint &,
+  const autoware_planning_msgs::msg::TrajectoryPoint &, const double);
+
+extern template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Pose &, const double, const bool);
+extern template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_planning_msgs::msg::PathPoint &, const autoware_planning_msgs::msg::PathPoint &,
+  const double, const bool);
+extern template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &,
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &, const double, const bool);
+extern template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_planning_msgs::msg::TrajectoryPoint &,
+  const autoware_planning_msgs::msg::TrajectoryPoint &, const double, const bool);
+
+extern template void split_by_driving_direction(
+  const std::vector<geometry_msgs::msg::Pose> &, std::vector<DrivingDirectionRange> &);
+extern template void split_by_driving_direction(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> &,
+  std::vector<DrivingDirectionRange> &);
+extern template void split_by_driving_direction(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  std::vector<DrivingDirectionRange> &);
+extern template void split_by_driving_direction(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> &,
+  std::vector<DrivingDirectionRange> &);
+
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__GEOMETRY_HPP_
@@ -15,7 +15,14 @@
 #ifndef AUTOWARE_UTILS_GEOMETRY__GJK_2D_HPP_
 #define AUTOWARE_UTILS_GEOMETRY__GJK_2D_HPP_
 
+#include <autoware_utils_geometry/alt_geometry.hpp>
 #include <autoware_utils_geometry/boost_geometry.hpp>
+#include <autoware_utils_geometry/prepared_convex_polygon.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
 
 namespace autoware_utils_geometry::gjk
 {
@@ -24,6 +31,101 @@ namespace autoware_utils_geometry::gjk
  * @details much faster than boost::geometry::overlaps() but limited to convex polygons
  */
 bool intersects(const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2);
+
+/// @brief Check if 2 convex polygons intersect using the GJK algorithm after a bounding box check
+bool intersects(const PreparedConvexPolygon2d & prepared, const Polygon2d & convex_polygon);
+
+/**
+ * @brief Intersection checks of one convex polygon against a sequence of convex polygons, e.g. an
+ *        object against the consecutive ego footprints along a trajectory, warm started by the
+ *        previous check
+ * @details The GJK loop of the previous check ends with a separating direction or with a triangle
+ *          of the Minkowski difference containing the origin. For temporally coherent polygons,
+ *          the support point in the previous separating direction separates the next polygons too,
+ *          and the support points in the directions of the previous triangle surround the origin
+ *          again, so that most checks take one or three support points instead of the full loop.
+ *          The results are the same as gjk::intersects, up to the rounding for touching polygons.
+ */
+class IntersectionQuery
+{
+public:
+  /// @param convex_polygon first polygon of all the checks, copied
+  explicit IntersectionQuery(const Polygon2d & convex_polygon);
+
+  /// @brief return true if the polygon intersects the polygon of the query, as gjk::intersects
+  bool intersects(const Polygon2d & convex_polygon);
+
+  /// @brief return the index of the first polygon intersecting the polygon of the query, if any
+  std::optional<std::size_t> first_intersection(const std::vector<Polygon2d> & convex_polygons);
+
+  /// @brief forget the previous check, e.g. before a polygon unrelated to the previous one
+  void reset() { cache_ = Cache::none; }
+
+  /// @brief number of support points computed by the last check, to measure the warm starts
+  std::size_t support_count() const { return support_count_; }
+
+private:
+  enum class Cache { none, separating_direction, triangle };
+
+  Point2d support(const Polygon2d & convex_polygon, const Point2d & direction);
+  bool intersects_cold(const Polygon2d & convex_polygon, const Point2d & initial_direction);
+
+  Polygon2d polygon_;
+  Cache cache_{Cache::none};
+  std::array<Point2d, 3> directions_;  // the separating direction or those of the triangle
+  std::size_t support_count_{0};
+};
+
+template <class PointT>
+struct SignedDistance
+{
+  double distance;  // separation distance if positive, opposite of the penetration depth otherwise
+  PointT point1;    // closest or deepest point of the first polygon
+  PointT point2;    // closest or deepest point of the second polygon
+};
+
+/**
+ * @brief Calculate the signed distance between 2 convex polygons using the GJK and EPA algorithms
+ * @details If the polygons are separated, the distance is the minimum distance between them and
+ *          point1 - point2 is the shortest vector between them. Otherwise, it is the opposite of
+ *          the penetration depth, and translating the first polygon by point2 - point1 makes the
+ *          polygons touch.
+ * @throw std::invalid_argument if a polygon is empty
+ */
+SignedDistance<Point2d> signed_distance(
+  const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2);
+
+SignedDistance<alt::Point2d> signed_distance(
+  const alt::ConvexPolygon2dView & convex_polygon1,
+  const alt::ConvexPolygon2dView & convex_polygon2);
+
+/// @brief rigid motion of a polygon with constant linear and angular velocities
+struct Motion2d
+{
+  alt::Vector2d velocity;          // velocity of the rotation center
+  double angular_velocity{0.0};    // counter-clockwise
+  alt::Point2d rotation_center{};  // position of the rotation center at time 0
+};
+
+/**
+ * @brief Calculate the earliest time when 2 moving convex polygons come into contact
+ * @details The polygons are advanced conservatively by the largest step after which a bound of
+ *          their approach along the direction of their closest points does not exceed their
+ *          signed distance, so the contact cannot be missed between samples. The bound follows
+ *          the current velocities of the vertices and how fast the rotations turn them. The
+ *          returned time is at most the exact contact time, and the polygons are closer than the
+ *          tolerance at that time unless the advancement runs out of its 100 steps, e.g. for a
+ *          fast rotation of a polygon that stays apart. The time reached is then returned as a
+ *          possible contact.
+ * @param duration end of the time interval starting at 0
+ * @param tolerance distance below which the polygons are considered in contact
+ * @return the time of impact, 0 if the polygons initially intersect, or nullopt if they do not come
+ *         into contact before duration
+ */
+std::optional<double> time_of_impact(
+  const alt::ConvexPolygon2dView & convex_polygon1, const Motion2d & motion1,
+  const alt::ConvexPolygon2dView & convex_polygon2, const Motion2d & motion2,
+  const double duration, const double tolerance = 1e-3);
 }  // namespace autoware_utils_geometry::gjk
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__GJK_2D_HPP_
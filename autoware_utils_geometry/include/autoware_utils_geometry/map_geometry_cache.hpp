@@ -0,0 +1,161 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__MAP_GEOMETRY_CACHE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__MAP_GEOMETRY_CACHE_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_geometry.hpp"
+#include "autoware_utils_geometry/prepared_polygon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/// @brief 64-bit FNV-1a hash of the bytes of a map, used as the key of its geometry cache
+std::uint64_t map_hash(const void * data, const std::size_t size);
+
+/// @brief map_hash() of the content of a file, e.g. of the lanelet2 map
+/// @return nullopt if the file cannot be read
+std::optional<std::uint64_t> map_file_hash(const std::string & path);
+
+/**
+ * @brief Write the precomputed geometry of the static polygons of a map to a binary file which can
+ *        be mapped back with MappedMapGeometry.
+ * @details The file has the rings of the polygons, the triangles of their ear clipping
+ *          triangulation and the packed R-tree over their outer rings, in flat arrays after a
+ *          header with a version and the hash of the map.
+ * @param num_threads number of threads packing the R-tree
+ * @return false if the file cannot be written
+ */
+bool save_map_geometry_cache(
+  const std::string & path, const std::uint64_t map_hash,
+  const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads = 1);
+
+/**
+ * @brief Read-only geometry of the static polygons of a map, memory mapped from a file written by
+ *        save_map_geometry_cache().
+ * @details Nothing is rebuilt or copied when the file is opened, the pages are loaded when they are
+ *          accessed and are shared by all the processes mapping the same file. The R-tree queries
+ *          walk the mapped nodes as PackedRTree does. The prepared polygons, whose grid of edges
+ *          is built in linear time, are built on demand from the mapped rings.
+ */
+class MappedMapGeometry
+{
+public:
+  /// @brief version of the file format, the files of other versions are not opened
+  static constexpr std::uint32_t version = 1;
+
+  /// @return nullopt if the file cannot be mapped, is not a cache of this version, or is the
+  ///         cache of another map
+  static std::optional<MappedMapGeometry> open(
+    const std::string & path, const std::uint64_t map_hash);
+
+  MappedMapGeometry(const MappedMapGeometry &) = delete;
+  MappedMapGeometry & operator=(const MappedMapGeometry &) = delete;
+  MappedMapGeometry(MappedMapGeometry && other) noexcept;
+  MappedMapGeometry & operator=(MappedMapGeometry && other) noexcept;
+  ~MappedMapGeometry();
+
+  std::uint64_t map_hash() const { return map_hash_; }
+
+  /// @brief number of polygons
+  std::size_t size() const { return polygons_; }
+
+  /// @brief number of rings of the i-th polygon, the outer ring then the holes
+  std::size_t ring_count(const std::size_t i) const
+  {
+    return polygon_rings_[i + 1] - polygon_rings_[i];
+  }
+
+  /// @brief number of points of the r-th ring of the i-th polygon
+  std::size_t ring_size(const std::size_t i, const std::size_t r) const
+  {
+    const std::size_t ring = polygon_rings_[i] + r;
+    return ring_offsets_[ring + 1] - ring_offsets_[ring];
+  }
+
+  /// @brief x and y of the points of the r-th ring of the i-th polygon, interleaved
+  const double * ring_coordinates(const std::size_t i, const std::size_t r) const
+  {
+    return coordinates_ + 2 * ring_offsets_[polygon_rings_[i] + r];
+  }
+
+  /// @brief copy of the i-th polygon
+  alt::Polygon2d polygon(const std::size_t i) const;
+
+  /// @brief number of triangles of the i-th polygon
+  std::size_t triangle_count(const std::size_t i) const
+  {
+    return polygon_triangles_[i + 1] - polygon_triangles_[i];
+  }
+
+  /// @brief x and y of the 3 vertices of each triangle of the i-th polygon, interleaved
+  const double * triangle_coordinates(const std::size_t i) const
+  {
+    return triangles_ + 6 * polygon_triangles_[i];
+  }
+
+  /// @brief triangles of the i-th polygon, as triangulate() returns them
+  std::vector<alt::ConvexPolygon2d> triangles(const std::size_t i) const;
+
+  /// @brief prepared polygon of the i-th polygon, built from the mapped rings
+  PreparedPolygon2d prepared_polygon(const std::size_t i) const;
+
+  /// @brief Find the polygons whose boxes intersect a box, in no particular order.
+  void intersecting(const Box2d & box, std::vector<std::size_t> & indices) const;
+
+  /// @brief Find the polygons whose boxes contain a point, in no particular order.
+  void containing(const Point2d & point, std::vector<std::size_t> & indices) const;
+
+private:
+  MappedMapGeometry() = default;
+
+  template <class Visit>
+  void search(
+    const double min_x, const double min_y, const double max_x, const double max_y,
+    const Visit & visit) const;
+
+  void * data_{nullptr};
+  std::size_t length_{0};
+  std::uint64_t map_hash_{0};
+  std::size_t polygons_{0};
+  const std::uint64_t * polygon_rings_{nullptr};      // rings of polygon i from [i] to [i + 1]
+  const std::uint64_t * ring_offsets_{nullptr};       // points of ring j from [j] to [j + 1]
+  const double * coordinates_{nullptr};               // x and y of the points
+  const std::uint64_t * polygon_triangles_{nullptr};  // triangles of polygon i from [i] to [i + 1]
+  const double * triangles_{nullptr};                 // x and y of the 3 vertices of the triangles
+  std::size_t tree_levels_{0};
+  const std::uint64_t * level_offsets_{nullptr};  // as in PackedRTree
+  const double * tree_boxes_{nullptr};            // min x, min y, max x and max y of the boxes
+  const std::uint64_t * tree_indices_{nullptr};   // polygon of each sorted item
+};
+
+/**
+ * @brief Map the geometry cache of a map, precomputing and saving it first if it does not exist,
+ *        has another version or is the cache of another map.
+ * @return nullopt if the file cannot be written or mapped
+ */
+std::optional<MappedMapGeometry> load_or_build_map_geometry_cache(
+  const std::string & path, const std::uint64_t map_hash,
+  const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads = 1);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__MAP_GEOMETRY_CACHE_HPP_
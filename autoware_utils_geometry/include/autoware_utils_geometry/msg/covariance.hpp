@@ -15,6 +15,10 @@
 #ifndef AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_HPP_
 #define AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_HPP_
 
+#include <Eigen/Core>
+
+#include <array>
+
 namespace autoware_utils_geometry
 {
 namespace xyz_covariance_index
@@ -115,6 +119,33 @@ enum XYZ_UPPER_COV_IDX {
   Z_Z = 5,
 };
 }  // namespace xyz_upper_covariance_index
+
+/// Row-major matrices with the layout of the covariance arrays of the messages.
+using CovarianceMatrix3d = Eigen::Matrix<double, 3, 3, Eigen::RowMajor>;
+using CovarianceMatrix6d = Eigen::Matrix<double, 6, 6, Eigen::RowMajor>;
+
+/// Zero-copy views of the covariance arrays of the messages, e.g. PoseWithCovariance::covariance.
+inline Eigen::Map<CovarianceMatrix3d> covariance_view(std::array<double, 9> & covariance)
+{
+  return Eigen::Map<CovarianceMatrix3d>(covariance.data());
+}
+
+inline Eigen::Map<const CovarianceMatrix3d> covariance_view(
+  const std::array<double, 9> & covariance)
+{
+  return Eigen::Map<const CovarianceMatrix3d>(covariance.data());
+}
+
+inline Eigen::Map<CovarianceMatrix6d> covariance_view(std::array<double, 36> & covariance)
+{
+  return Eigen::Map<CovarianceMatrix6d>(covariance.data());
+}
+
+inline Eigen::Map<const CovarianceMatrix6d> covariance_view(
+  const std::array<double, 36> & covariance)
+{
+  return Eigen::Map<const CovarianceMatrix6d>(covariance.data());
+}
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_OPS_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_OPS_HPP_
+
+#include "autoware_utils_geometry/msg/covariance.hpp"
+
+#include <Eigen/Core>
+
+#include <autoware_perception_msgs/msg/detected_objects.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/tracked_objects.hpp>
+
+#include <array>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+/**
+ * @brief Rotate a 6-DOF covariance into another frame in place.
+ * @details Same as tf2::transformCovariance: both the position and the orientation blocks are
+ * rotated, Σ' = R6 Σ R6ᵀ with R6 = diag(R, R), without building the 6x6 matrix.
+ */
+void rotate_covariance(std::array<double, 36> & covariance, const Eigen::Matrix3d & rotation);
+
+/// @brief rotate_covariance() of the pose covariance of all the objects
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::DetectedObjects & objects, const Eigen::Matrix3d & rotation);
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::TrackedObjects & objects, const Eigen::Matrix3d & rotation);
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::PredictedObjects & objects, const Eigen::Matrix3d & rotation);
+
+/// @brief 1-sigma ellipse of the x-y block of a covariance
+struct CovarianceEllipse2d
+{
+  double semi_major{0.0};  // standard deviation along the major axis
+  double semi_minor{0.0};  // standard deviation along the minor axis
+  double yaw{0.0};         // angle of the major axis from the x axis, in [-pi/2, pi/2]
+};
+
+/**
+ * @brief Calculate the 1-sigma ellipse of the x-y block of a 6-DOF covariance.
+ * @details The eigenvalues of the 2x2 block are computed in closed form, negative ones from
+ * rounding errors are clamped to 0.
+ */
+CovarianceEllipse2d calc_covariance_ellipse(const std::array<double, 36> & covariance);
+
+/// @brief calc_covariance_ellipse() of the pose covariance of all the objects
+/// @param[out] ellipses ellipse of each object, the storage is reused
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::DetectedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses);
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::TrackedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses);
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::PredictedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses);
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__MSG__COVARIANCE_OPS_HPP_
@@ -17,6 +17,8 @@
 
 #include "geometry_msgs/msg/quaternion.hpp"
 
+#include <vector>
+
 // NOTE: Do not use autoware_utils namespace
 namespace geometry_msgs
 {
@@ -25,7 +27,37 @@ namespace msg
 Quaternion operator+(Quaternion a, Quaternion b) noexcept;
 Quaternion operator-(Quaternion a) noexcept;
 Quaternion operator-(Quaternion a, Quaternion b) noexcept;
+/// Hamilton product, the rotation of a * b applies b first and then a
+Quaternion operator*(Quaternion a, Quaternion b) noexcept;
 }  // namespace msg
 }  // namespace geometry_msgs
 
+namespace autoware_utils_geometry
+{
+/// Inverse rotation of a unit quaternion.
+geometry_msgs::msg::Quaternion conjugate(const geometry_msgs::msg::Quaternion & q) noexcept;
+
+/// Unit quaternion of the same rotation, the input is returned as it is if its norm is 0.
+geometry_msgs::msg::Quaternion normalize(const geometry_msgs::msg::Quaternion & q) noexcept;
+
+/// Normalized linear interpolation along the shortest path, cheaper than slerp but the angular
+/// velocity is not constant.
+geometry_msgs::msg::Quaternion nlerp(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b,
+  const double ratio) noexcept;
+
+/// Spherical linear interpolation along the shortest path, same as tf2::slerp for unit quaternions.
+geometry_msgs::msg::Quaternion slerp(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b,
+  const double ratio) noexcept;
+
+/// Compose all the quaternions with one rotation, q = rotation * q, in a single loop.
+void rotate_quaternions(
+  const geometry_msgs::msg::Quaternion & rotation,
+  std::vector<geometry_msgs::msg::Quaternion> & quaternions) noexcept;
+
+/// Normalize all the quaternions in place.
+void normalize_quaternions(std::vector<geometry_msgs::msg::Quaternion> & quaternions) noexcept;
+}  // namespace autoware_utils_geometry
+
 #endif  // AUTOWARE_UTILS_GEOMETRY__MSG__OPERATION_HPP_
@@ -0,0 +1,125 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__ORIENTED_BOX_2D_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__ORIENTED_BOX_2D_HPP_
+
+#include "autoware_utils_geometry/boost_geometry.hpp"
+
+#include <autoware_perception_msgs/msg/shape.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+/**
+ * @brief Rectangle in the XY plane by its center, the unit direction of its length and its half
+ *        sizes, for the intersection checks of footprints without a polygon.
+ * @details Two boxes only have 4 separating axes, the directions of their sides, and the overlap on
+ *          each axis is a few multiplications with the cosine and the sine of the angle between
+ *          them, instead of the projections of all the vertices on the 8 edges of two polygons.
+ */
+struct OrientedBox2d
+{
+  double center_x{0.0};
+  double center_y{0.0};
+  double axis_x{1.0};  // cosine of the yaw
+  double axis_y{0.0};  // sine of the yaw
+  double half_length{0.0};
+  double half_width{0.0};
+
+  /// @brief the box of to_footprint(), with the yaw of the pose
+  static OrientedBox2d from_footprint(
+    const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+    const double base_to_rear, const double width);
+
+  /// @brief the box of to_polygon2d() of a bounding box shape
+  /// @throw std::logic_error if the shape is not a bounding box
+  static OrientedBox2d from_shape(
+    const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape);
+
+  /// @brief closed clockwise ring of the corners, front left first as to_footprint()
+  Polygon2d to_polygon() const;
+};
+
+/**
+ * @brief Boxes in structure of arrays, checked against one box in a single vectorized loop.
+ */
+class OrientedBoxArray2d
+{
+public:
+  void clear();
+  void reserve(const std::size_t size);
+  void push_back(const OrientedBox2d & box);
+
+  std::size_t size() const { return center_x_.size(); }
+  bool empty() const { return center_x_.empty(); }
+  OrientedBox2d operator[](const std::size_t i) const;
+
+  const std::vector<double> & center_x() const { return center_x_; }
+  const std::vector<double> & center_y() const { return center_y_; }
+  const std::vector<double> & axis_x() const { return axis_x_; }
+  const std::vector<double> & axis_y() const { return axis_y_; }
+  const std::vector<double> & half_length() const { return half_length_; }
+  const std::vector<double> & half_width() const { return half_width_; }
+
+private:
+  std::vector<double> center_x_;
+  std::vector<double> center_y_;
+  std::vector<double> axis_x_;
+  std::vector<double> axis_y_;
+  std::vector<double> half_length_;
+  std::vector<double> half_width_;
+};
+
+namespace sat
+{
+/**
+ * @brief Check if 2 boxes intersect by their 4 separating axes, without branches
+ * @details the result is the same as intersects(box1.to_polygon(), box2.to_polygon()), touching
+ *          boxes intersect
+ */
+inline bool intersects(const OrientedBox2d & box1, const OrientedBox2d & box2)
+{
+  const double dx = box2.center_x - box1.center_x;
+  const double dy = box2.center_y - box1.center_y;
+  // cosine and sine of the angle from box1 to box2
+  const double c = std::abs(box1.axis_x * box2.axis_x + box1.axis_y * box2.axis_y);
+  const double s = std::abs(box1.axis_x * box2.axis_y - box1.axis_y * box2.axis_x);
+  const double l1 = box1.half_length;
+  const double w1 = box1.half_width;
+  const double l2 = box2.half_length;
+  const double w2 = box2.half_width;
+  // the distance of the centers on each axis against the sum of the half extents of the boxes
+  return (std::abs(dx * box1.axis_x + dy * box1.axis_y) <= l1 + c * l2 + s * w2) &
+         (std::abs(dy * box1.axis_x - dx * box1.axis_y) <= w1 + s * l2 + c * w2) &
+         (std::abs(dx * box2.axis_x + dy * box2.axis_y) <= l2 + c * l1 + s * w1) &
+         (std::abs(dy * box2.axis_x - dx * box2.axis_y) <= w2 + s * l1 + c * w1);
+}
+
+/**
+ * @brief Check a box against many boxes, e.g. the ego footprint against the objects
+ * @param results 1 if the box intersects the i-th box, else 0, the storage is reused
+ * @return number of boxes intersecting the box
+ */
+std::size_t intersects(
+  const OrientedBox2d & box, const OrientedBoxArray2d & boxes, std::vector<char> & results);
+}  // namespace sat
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__ORIENTED_BOX_2D_HPP_
@@ -0,0 +1,185 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__PACKED_RTREE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__PACKED_RTREE_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_geometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief R-tree over the bounding boxes of polygons, bulk loaded with Sort-Tile-Recursive packing
+ *        into flat arrays.
+ * @details The items are sorted by the x of the centers of their boxes, cut into vertical slices,
+ *          and sorted by y in each slice, so that each run of node_size items makes a leaf. Each
+ *          upper level groups the runs of node_size nodes of the level below, so that the children
+ *          of a node are contiguous and the tree has no pointers. The whole tree is rebuilt in
+ *          O(n log n) reusing its storage, e.g. every cycle, in parallel for large inputs.
+ *          The queries return the indices of the items in the input of build().
+ */
+class PackedRTree
+{
+public:
+  static constexpr std::size_t node_size = 16;
+
+  PackedRTree() = default;
+
+  template <class Polygons>
+  explicit PackedRTree(const Polygons & polygons, const std::size_t num_threads = 1)
+  {
+    build(polygons, num_threads);
+  }
+
+  /**
+   * @brief Index the bounding boxes of the outer rings of the polygons.
+   * @param num_threads number of chunks sorted and packed in parallel on
+   * autoware_utils_system::ThreadPool::shared(), only used from 8192 items
+   */
+  void build(const std::vector<Polygon2d> & polygons, const std::size_t num_threads = 1);
+
+  void build(const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads = 1);
+
+  void build(const std::vector<alt::ConvexPolygon2d> & polygons, const std::size_t num_threads = 1);
+
+  void build(const std::vector<Box2d> & boxes, const std::size_t num_threads = 1);
+
+  void clear();
+
+  /// @brief Number of indexed items.
+  std::size_t size() const { return indices_.size(); }
+
+  bool empty() const { return indices_.empty(); }
+
+  /// @brief Find the items whose boxes intersect a box, in no particular order.
+  void intersecting(const Box2d & box, std::vector<std::size_t> & indices) const;
+
+  /// @brief Find the items whose boxes contain a point, in no particular order.
+  void containing(const Point2d & point, std::vector<std::size_t> & indices) const;
+
+  /// @brief Find the k items whose boxes are the nearest to a point, sorted by distance.
+  void nearest(
+    const Point2d & point, const std::size_t k, std::vector<std::size_t> & indices) const;
+
+  /**
+   * @brief Find the k nearest items to a point by their exact distance, sorted by distance.
+   * @details The boxes bound the distances from below, so that only the items whose boxes are
+   *          nearer than the k-th item found are measured.
+   * @param item_distance distance from the point to the item of an index, e.g. to its polygon,
+   *        which is at least the distance to its box
+   */
+  template <class ItemDistance>
+  void nearest(
+    const Point2d & point, const std::size_t k, std::vector<std::size_t> & indices,
+    const ItemDistance & item_distance) const
+  {
+    indices.clear();
+    if (empty() || k == 0) {
+      return;
+    }
+
+    // the entries are the nodes and the items, the items being measured when they are pushed
+    struct Entry
+    {
+      double distance;
+      std::size_t level;
+      std::size_t index;
+      bool operator>(const Entry & other) const { return distance > other.distance; }
+    };
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    const std::size_t root_level = level_offsets_.size() - 2;
+    queue.push(Entry{box_distance(boxes_.back(), point), root_level, 0});
+    while (!queue.empty() && indices.size() < k) {
+      const auto entry = queue.top();
+      queue.pop();
+      if (entry.level == 0) {
+        indices.push_back(indices_[entry.index]);
+        continue;
+      }
+      const auto [begin, end] = children(entry.level, entry.index);
+      for (std::size_t child = begin; child < end; ++child) {
+        const auto & box = boxes_[level_offsets_[entry.level - 1] + child];
+        const double distance = box_distance(box, point);
+        if (entry.level == 1) {
+          queue.push(Entry{std::max(distance, item_distance(indices_[child])), 0, child});
+        } else {
+          queue.push(Entry{distance, entry.level - 1, child});
+        }
+      }
+    }
+  }
+
+private:
+  struct Box
+  {
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+  };
+
+  struct Key
+  {
+    double value;
+    std::size_t index;
+  };
+
+  static double box_distance(const Box & box, const Point2d & point)
+  {
+    const double dx = std::max({box.min_x - point.x(), 0.0, point.x() - box.max_x});
+    const double dy = std::max({box.min_y - point.y(), 0.0, point.y() - box.max_y});
+    return std::hypot(dx, dy);
+  }
+
+  /// @brief range of the children of a node in the level below
+  std::pair<std::size_t, std::size_t> children(
+    const std::size_t level, const std::size_t index) const
+  {
+    const std::size_t below = level_offsets_[level] - level_offsets_[level - 1];
+    return {index * node_size, std::min(below, (index + 1) * node_size)};
+  }
+
+  /// @brief sort and pack the boxes of the items in the input order in items_
+  void pack(const std::size_t num_threads);
+
+  template <class Visit>
+  void search(const Box & box, const Visit & visit) const;
+
+  // writes the packed arrays to the file mapped by MappedMapGeometry
+  friend bool save_map_geometry_cache(
+    const std::string & path, const std::uint64_t map_hash,
+    const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads);
+
+  std::vector<Box> items_;                  // boxes of the items in the input order
+  std::vector<Key> keys_;                   // centers of the items sorted for the packing
+  std::vector<Box> boxes_;                  // items sorted, then the nodes level by level
+  std::vector<std::size_t> indices_;        // input index of each sorted item
+  std::vector<std::size_t> level_offsets_;  // start of each level in boxes_, then its size
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__PACKED_RTREE_HPP_
@@ -0,0 +1,127 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__PATH_PROFILE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__PATH_PROFILE_HPP_
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Cumulative arc length, segment headings and curvature of a path in the XY plane.
+ * @details All the values are computed in one linear pass and each segment length is shared by the
+ *          arc length and the two curvatures that use it. The buffers are kept across calls, so
+ *          keeping one instance alive avoids the allocations, and update() only recomputes the
+ *          values that depend on the points that changed.
+ *          The curvature is the signed Menger curvature of each point and its two neighbors, as
+ *          calc_curvature, and is 0 for the first and last points and for degenerate triplets.
+ */
+class PathProfile
+{
+public:
+  PathProfile() = default;
+
+  template <class T>
+  explicit PathProfile(const std::vector<T> & points)
+  {
+    build(points);
+  }
+
+  /// @brief Recompute the whole profile.
+  template <class T>
+  void build(const std::vector<T> & points)
+  {
+    load(points, 0);
+    recompute(0);
+  }
+
+  /**
+   * @brief Recompute the profile when the points before begin are the same as the last call.
+   * @param begin index of the first point that was changed, appended or removed
+   */
+  template <class T>
+  void update(const std::vector<T> & points, const std::size_t begin)
+  {
+    const std::size_t first = std::min({begin, points.size(), x_.size()});
+    load(points, first);
+    recompute(first);
+  }
+
+  /// @brief Recompute the profile from the first point that differs from the last call.
+  template <class T>
+  void update(const std::vector<T> & points)
+  {
+    const std::size_t size = std::min(points.size(), x_.size());
+    std::size_t first = 0;
+    while (first < size) {
+      const auto & p = get_point_view(points.at(first));
+      if (p.x != x_.at(first) || p.y != y_.at(first)) {
+        break;
+      }
+      ++first;
+    }
+    update(points, first);
+  }
+
+  std::size_t size() const { return x_.size(); }
+
+  bool empty() const { return x_.empty(); }
+
+  /// @brief Total length of the path.
+  double length() const { return arc_lengths_.empty() ? 0.0 : arc_lengths_.back(); }
+
+  /// @brief Arc length from the first point to each point, the size is size().
+  const std::vector<double> & arc_lengths() const { return arc_lengths_; }
+
+  /// @brief Length of the segment from each point to the next, the size is size() - 1.
+  const std::vector<double> & segment_lengths() const { return segment_lengths_; }
+
+  /// @brief Azimuth angle of the segment from each point to the next, the size is size() - 1.
+  const std::vector<double> & headings() const { return headings_; }
+
+  /// @brief Signed curvature at each point, the size is size().
+  const std::vector<double> & curvatures() const { return curvatures_; }
+
+private:
+  template <class T>
+  void load(const std::vector<T> & points, const std::size_t begin)
+  {
+    x_.resize(points.size());
+    y_.resize(points.size());
+    for (std::size_t i = begin; i < points.size(); ++i) {
+      const auto & p = get_point_view(points[i]);
+      x_[i] = p.x;
+      y_[i] = p.y;
+    }
+  }
+
+  void recompute(const std::size_t begin);
+
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> arc_lengths_;
+  std::vector<double> segment_lengths_;
+  std::vector<double> headings_;
+  std::vector<double> curvatures_;
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__PATH_PROFILE_HPP_
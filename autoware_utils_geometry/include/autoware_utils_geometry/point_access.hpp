@@ -0,0 +1,254 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE_UTILS_GEOMETRY__POINT_ACCESS_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__POINT_ACCESS_HPP_
+
+#include "autoware_utils_geometry/point_traits.hpp"
+
+#include <autoware_internal_planning_msgs/msg/path_point_with_lane_id.hpp>
+#include <autoware_planning_msgs/msg/path_point.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
+#include <geometry_msgs/msg/quaternion.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The accessors of the points and the poses of the messages and the distances between them, which
+// need only the message headers, without tf2, Boost.Geometry or Eigen. geometry.hpp includes them.
+namespace autoware_utils_geometry
+{
+
+template <class T>
+geometry_msgs::msg::Point get_point(const T & p)
+{
+  return geometry_msgs::build<geometry_msgs::msg::Point>().x(p.x).y(p.y).z(p.z);
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::Point & p)
+{
+  return p;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::Pose & p)
+{
+  return p.position;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::PoseStamped & p)
+{
+  return p.pose.position;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const geometry_msgs::msg::PoseWithCovarianceStamped & p)
+{
+  return p.pose.pose.position;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const autoware_planning_msgs::msg::PathPoint & p)
+{
+  return p.pose.position;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId & p)
+{
+  return p.point.pose.position;
+}
+
+template <>
+inline geometry_msgs::msg::Point get_point(const autoware_planning_msgs::msg::TrajectoryPoint & p)
+{
+  return p.pose.position;
+}
+
+/// @brief Return a copy of the pose of a type registered in PointTraits.
+template <class T>
+geometry_msgs::msg::Pose get_pose(const T & p)
+{
+  static_assert(has_pose_trait<T>::value, "Only the types registered in PointTraits can be used.");
+  return PointTraits<T>::pose(p);
+}
+
+/**
+ * @brief Reference accessors for the types that store a Point or a Pose.
+ * @details Unlike get_point and get_pose, they do not copy the message. Generic code should use
+ *          get_point_view and get_pose_view, which fall back to the copy for the other types.
+ */
+inline const geometry_msgs::msg::Point & get_point_ref(const geometry_msgs::msg::Point & p)
+{
+  return p;
+}
+
+inline const geometry_msgs::msg::Point & get_point_ref(
+  const geometry_msgs::msg::PoseWithCovarianceStamped & p)
+{
+  return p.pose.pose.position;
+}
+
+template <class T, std::enable_if_t<has_pose_trait<T>::value, std::nullptr_t> = nullptr>
+const geometry_msgs::msg::Point & get_point_ref(const T & p)
+{
+  return PointTraits<T>::pose(p).position;
+}
+
+template <class T, std::enable_if_t<has_pose_trait<T>::value, std::nullptr_t> = nullptr>
+const geometry_msgs::msg::Pose & get_pose_ref(const T & p)
+{
+  return PointTraits<T>::pose(p);
+}
+
+template <class T, class = void>
+struct has_point_ref : std::false_type
+{
+};
+
+template <class T>
+struct has_point_ref<T, std::void_t<decltype(get_point_ref(std::declval<const T &>()))>>
+: std::true_type
+{
+};
+
+template <class T, class = void>
+struct has_pose_ref : std::false_type
+{
+};
+
+template <class T>
+struct has_pose_ref<T, std::void_t<decltype(get_pose_ref(std::declval<const T &>()))>>
+: std::true_type
+{
+};
+
+/**
+ * @brief Return a reference to the point when possible, and a copy from get_point otherwise.
+ * @details Bind the result to `const auto &`, which is valid in both cases.
+ */
+template <class T>
+decltype(auto) get_point_view(const T & p)
+{
+  if constexpr (has_point_ref<T>::value) {
+    return get_point_ref(p);
+  } else {
+    return get_point(p);
+  }
+}
+
+/// @brief Return a reference to the pose when possible, and a copy from get_pose otherwise.
+template <class T>
+decltype(auto) get_pose_view(const T & p)
+{
+  if constexpr (has_pose_ref<T>::value) {
+    return get_pose_ref(p);
+  } else {
+    return get_pose(p);
+  }
+}
+
+template <class T>
+double get_longitudinal_velocity(const T & p)
+{
+  static_assert(
+    has_longitudinal_velocity_trait<T>::value,
+    "Only the types registered in PointTraits with a longitudinal velocity can be used.");
+  return PointTraits<T>::longitudinal_velocity(p);
+}
+
+template <class T>
+void set_pose(const geometry_msgs::msg::Pose & pose, T & p)
+{
+  static_assert(has_pose_trait<T>::value, "Only the types registered in PointTraits can be used.");
+  PointTraits<T>::pose(p) = pose;
+}
+
+template <class T>
+inline void set_orientation(const geometry_msgs::msg::Quaternion & orientation, T & p)
+{
+  static_assert(has_pose_trait<T>::value, "Only the types registered in PointTraits can be used.");
+  PointTraits<T>::pose(p).orientation = orientation;
+}
+
+template <class T>
+void set_longitudinal_velocity(const float velocity, T & p)
+{
+  static_assert(
+    has_longitudinal_velocity_trait<T>::value,
+    "Only the types registered in PointTraits with a longitudinal velocity can be used.");
+  PointTraits<T>::longitudinal_velocity(p) = velocity;
+}
+
+/// @brief Set the same longitudinal velocity on all the points of a container.
+template <class Container>
+void set_longitudinal_velocities(const float velocity, Container & points)
+{
+  for (auto & p : points) {
+    set_longitudinal_velocity(velocity, p);
+  }
+}
+
+/// @brief Set the longitudinal velocities of the points of a container from an array.
+template <class Container>
+void set_longitudinal_velocities(const std::vector<float> & velocities, Container & points)
+{
+  if (velocities.size() != points.size()) {
+    throw std::invalid_argument("The number of velocities and points are different.");
+  }
+  std::size_t i = 0;
+  for (auto & p : points) {
+    set_longitudinal_velocity(velocities[i++], p);
+  }
+}
+
+template <class Point1, class Point2>
+double calc_distance2d(const Point1 & point1, const Point2 & point2)
+{
+  const auto & p1 = get_point_view(point1);
+  const auto & p2 = get_point_view(point2);
+  return std::hypot(p1.x - p2.x, p1.y - p2.y);
+}
+
+template <class Point1, class Point2>
+double calc_squared_distance2d(const Point1 & point1, const Point2 & point2)
+{
+  const auto & p1 = get_point_view(point1);
+  const auto & p2 = get_point_view(point2);
+  const auto dx = p1.x - p2.x;
+  const auto dy = p1.y - p2.y;
+  return dx * dx + dy * dy;
+}
+
+template <class Point1, class Point2>
+double calc_distance3d(const Point1 & point1, const Point2 & point2)
+{
+  const auto & p1 = get_point_view(point1);
+  const auto & p2 = get_point_view(point2);
+  // To be replaced by std::hypot(dx, dy, dz) in C++17
+  return std::hypot(std::hypot(p1.x - p2.x, p1.y - p2.y), p1.z - p2.z);
+}
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__POINT_ACCESS_HPP_
@@ -0,0 +1,117 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__POINT_TRAITS_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__POINT_TRAITS_HPP_
+
+#include <autoware_internal_planning_msgs/msg/path_point_with_lane_id.hpp>
+#include <autoware_planning_msgs/msg/path_point.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/pose_stamped.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Registry of the point types accepted by get_pose, set_pose, get_longitudinal_velocity and
+ *        the other accessors in geometry.hpp.
+ * @details Downstream packages register a message type by specializing this template with
+ *          `pose(T &)` and `pose(const T &)` returning a reference to the pose, and optionally
+ *          `longitudinal_velocity(T &)` and `longitudinal_velocity(const T &)` returning a
+ *          reference to the velocity. Using an accessor with a type that is not registered, or
+ *          that does not provide the member it needs, is a compile error.
+ */
+template <class T>
+struct PointTraits
+{
+};
+
+template <class T, class = void>
+struct has_pose_trait : std::false_type
+{
+};
+
+template <class T>
+struct has_pose_trait<T, std::void_t<decltype(PointTraits<T>::pose(std::declval<const T &>()))>>
+: std::true_type
+{
+};
+
+template <class T, class = void>
+struct has_longitudinal_velocity_trait : std::false_type
+{
+};
+
+template <class T>
+struct has_longitudinal_velocity_trait<
+  T, std::void_t<decltype(PointTraits<T>::longitudinal_velocity(std::declval<const T &>()))>>
+: std::true_type
+{
+};
+
+template <>
+struct PointTraits<geometry_msgs::msg::Pose>
+{
+  static geometry_msgs::msg::Pose & pose(geometry_msgs::msg::Pose & p) { return p; }
+  static const geometry_msgs::msg::Pose & pose(const geometry_msgs::msg::Pose & p) { return p; }
+};
+
+template <>
+struct PointTraits<geometry_msgs::msg::PoseStamped>
+{
+  using T = geometry_msgs::msg::PoseStamped;
+  static geometry_msgs::msg::Pose & pose(T & p) { return p.pose; }
+  static const geometry_msgs::msg::Pose & pose(const T & p) { return p.pose; }
+};
+
+template <>
+struct PointTraits<autoware_planning_msgs::msg::PathPoint>
+{
+  using T = autoware_planning_msgs::msg::PathPoint;
+  static geometry_msgs::msg::Pose & pose(T & p) { return p.pose; }
+  static const geometry_msgs::msg::Pose & pose(const T & p) { return p.pose; }
+  static auto & longitudinal_velocity(T & p) { return p.longitudinal_velocity_mps; }
+  static const auto & longitudinal_velocity(const T & p) { return p.longitudinal_velocity_mps; }
+};
+
+template <>
+struct PointTraits<autoware_internal_planning_msgs::msg::PathPointWithLaneId>
+{
+  using T = autoware_internal_planning_msgs::msg::PathPointWithLaneId;
+  static geometry_msgs::msg::Pose & pose(T & p) { return p.point.pose; }
+  static const geometry_msgs::msg::Pose & pose(const T & p) { return p.point.pose; }
+  static auto & longitudinal_velocity(T & p) { return p.point.longitudinal_velocity_mps; }
+  static const auto & longitudinal_velocity(const T & p)
+  {
+    return p.point.longitudinal_velocity_mps;
+  }
+};
+
+template <>
+struct PointTraits<autoware_planning_msgs::msg::TrajectoryPoint>
+{
+  using T = autoware_planning_msgs::msg::TrajectoryPoint;
+  static geometry_msgs::msg::Pose & pose(T & p) { return p.pose; }
+  static const geometry_msgs::msg::Pose & pose(const T & p) { return p.pose; }
+  static auto & longitudinal_velocity(T & p) { return p.longitudinal_velocity_mps; }
+  static const auto & longitudinal_velocity(const T & p) { return p.longitudinal_velocity_mps; }
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__POINT_TRAITS_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__POLYGON_FIXTURE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__POLYGON_FIXTURE_HPP_
+
+#include "autoware_utils_geometry/boost_geometry.hpp"
+#include "autoware_utils_geometry/boost_polygon_utils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace autoware_utils_geometry
+{
+
+/// @brief Parameters of a reproducible set of random polygons, also used as the key of its file
+struct PolygonFixtureParams
+{
+  std::size_t polygons{0};
+  std::size_t vertices{0};
+  double max{1.0};
+  std::uint64_t seed{0};
+};
+
+/**
+ * @brief Generate the random_star_polygon() set of the parameters into a contiguous store.
+ * @details The polygons are drawn from one engine seeded with params.seed, so the same parameters
+ *          always give the same polygons.
+ */
+void generate_polygon_fixture(const PolygonFixtureParams & params, PolygonArray2d & polygons);
+
+/**
+ * @brief Write a polygon set to a binary file which can be mapped back with MappedPolygonArray.
+ * @return false if the file cannot be written
+ */
+bool save_polygon_fixture(
+  const std::string & path, const PolygonFixtureParams & params, const PolygonArray2d & polygons);
+
+/**
+ * @brief Read-only polygon set memory mapped from a file written by save_polygon_fixture().
+ * @details The rings are not copied, the pages are only loaded when the polygons are accessed.
+ */
+class MappedPolygonArray
+{
+public:
+  /// @return nullopt if the file cannot be mapped or is not a valid fixture
+  static std::optional<MappedPolygonArray> open(const std::string & path);
+
+  MappedPolygonArray(const MappedPolygonArray &) = delete;
+  MappedPolygonArray & operator=(const MappedPolygonArray &) = delete;
+  MappedPolygonArray(MappedPolygonArray && other) noexcept;
+  MappedPolygonArray & operator=(MappedPolygonArray && other) noexcept;
+  ~MappedPolygonArray();
+
+  const PolygonFixtureParams & params() const { return params_; }
+
+  std::size_t size() const { return params_.polygons; }
+
+  /// @brief number of points of the closed ring of the i-th polygon
+  std::size_t ring_size(const std::size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+  /// @brief x and y of the points of the i-th ring, interleaved
+  const double * ring_coordinates(const std::size_t i) const
+  {
+    return coordinates_ + 2 * offsets_[i];
+  }
+
+  /// @brief copy of the i-th polygon
+  Polygon2d polygon(const std::size_t i) const;
+
+  /// @brief copy of the i-th polygon with a single memcpy of its ring, reusing the storage
+  void polygon(const std::size_t i, PlainPolygon2d & polygon) const;
+
+private:
+  MappedPolygonArray() = default;
+
+  void * data_{nullptr};
+  std::size_t length_{0};
+  PolygonFixtureParams params_{};
+  const std::uint64_t * offsets_{nullptr};
+  const double * coordinates_{nullptr};
+};
+
+/**
+ * @brief Map the fixture file of the parameters, generating and saving it first if it does not
+ *        exist or was generated with other parameters.
+ * @return nullopt if the file cannot be written or mapped
+ */
+std::optional<MappedPolygonArray> load_or_generate_polygon_fixture(
+  const std::string & path, const PolygonFixtureParams & params);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__POLYGON_FIXTURE_HPP_
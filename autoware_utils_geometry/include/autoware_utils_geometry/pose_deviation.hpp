@@ -15,9 +15,16 @@
 #ifndef AUTOWARE_UTILS_GEOMETRY__POSE_DEVIATION_HPP_
 #define AUTOWARE_UTILS_GEOMETRY__POSE_DEVIATION_HPP_
 
+#include "autoware_utils_geometry/geometry.hpp"
+
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
 namespace autoware_utils_geometry
 {
 struct PoseDeviation
@@ -39,6 +46,103 @@ double calc_yaw_deviation(
 PoseDeviation calc_pose_deviation(
   const geometry_msgs::msg::Pose & base_pose, const geometry_msgs::msg::Pose & target_pose);
 
+/**
+ * @brief Structure-of-arrays deviations of many targets from one base pose.
+ * @details Keeping one instance alive across cycles lets the batch functions reuse its storage.
+ */
+struct PoseDeviationArray
+{
+  std::vector<double> lateral;
+  std::vector<double> longitudinal;
+  std::vector<double> yaw;  // empty for the deviations of points
+
+  void resize(const std::size_t size, const bool with_yaw = true);
+  std::size_t size() const { return lateral.size(); }
+};
+
+/**
+ * @brief Frame of a base pose, with the yaw converted once for many deviation calculations.
+ */
+class PoseDeviationFrame
+{
+public:
+  explicit PoseDeviationFrame(const geometry_msgs::msg::Pose & base_pose);
+
+  double lateral(const geometry_msgs::msg::Point & target_point) const
+  {
+    return cos_ * (target_point.y - y_) - sin_ * (target_point.x - x_);
+  }
+
+  double longitudinal(const geometry_msgs::msg::Point & target_point) const
+  {
+    return cos_ * (target_point.x - x_) + sin_ * (target_point.y - y_);
+  }
+
+  double yaw(const geometry_msgs::msg::Quaternion & target_orientation) const;
+
+private:
+  double x_;
+  double y_;
+  double yaw_;
+  double cos_;
+  double sin_;
+};
+
+/**
+ * @brief Calculate the deviations of all the target poses from one base pose.
+ * @param target_poses container of any type supported by get_pose, e.g. TrajectoryPoint
+ * @param deviations output deviations, same as calc_pose_deviation for each target
+ */
+template <class PoseContainer>
+void calc_pose_deviations(
+  const geometry_msgs::msg::Pose & base_pose, const PoseContainer & target_poses,
+  PoseDeviationArray & deviations)
+{
+  const PoseDeviationFrame frame(base_pose);
+  deviations.resize(target_poses.size());
+  std::size_t i = 0;
+  for (const auto & p : target_poses) {
+    const auto pose = get_pose(p);
+    deviations.lateral[i] = frame.lateral(pose.position);
+    deviations.longitudinal[i] = frame.longitudinal(pose.position);
+    deviations.yaw[i] = frame.yaw(pose.orientation);
+    ++i;
+  }
+}
+
+/**
+ * @brief Calculate the lateral and longitudinal deviations of all the target points from one base
+ * pose, the yaw deviations are left empty.
+ * @param target_points container of any type supported by get_point, e.g. Point or Pose
+ */
+template <class PointContainer>
+void calc_point_deviations(
+  const geometry_msgs::msg::Pose & base_pose, const PointContainer & target_points,
+  PoseDeviationArray & deviations)
+{
+  const PoseDeviationFrame frame(base_pose);
+  deviations.resize(target_points.size(), false);
+  std::size_t i = 0;
+  for (const auto & p : target_points) {
+    const auto point = get_point(p);
+    deviations.lateral[i] = frame.lateral(point);
+    deviations.longitudinal[i] = frame.longitudinal(point);
+    ++i;
+  }
+}
+
+/**
+ * @brief Find the target at the minimum distance from the base pose.
+ * @param max_dist targets farther than this distance are skipped
+ * @param max_yaw targets with a larger absolute yaw deviation are skipped, ignored if the yaw
+ * deviations are empty
+ * @return the index of the nearest target, or nullopt if no target satisfies the conditions
+ */
+std::optional<std::size_t> find_min_deviation_index(
+  const PoseDeviationArray & deviations,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__POSE_DEVIATION_HPP_
@@ -0,0 +1,68 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__PREPARED_CONVEX_POLYGON_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__PREPARED_CONVEX_POLYGON_HPP_
+
+#include "autoware_utils_geometry/boost_geometry.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Convex polygon with the data of the SAT queries precomputed.
+ * @details The separating axes, the projections of the polygon on them and its bounding box are
+ *          computed once, so that a static obstacle can be tested against many polygons cheaply.
+ */
+class PreparedConvexPolygon2d
+{
+public:
+  /**
+   * @brief Use the edge normals of the polygon as the separating axes.
+   * @throw std::invalid_argument if the polygon is empty
+   */
+  explicit PreparedConvexPolygon2d(const Polygon2d & convex_polygon);
+
+  /**
+   * @brief Use the given separating axes instead of computing the edge normals.
+   * @details The axes must include the directions of all the edge normals of the polygon, e.g. the
+   *          2 axes of a rectangular footprint whose orientation is known.
+   */
+  PreparedConvexPolygon2d(const Polygon2d & convex_polygon, std::vector<Point2d> axes);
+
+  const Polygon2d & polygon() const { return polygon_; }
+
+  const std::vector<Point2d> & axes() const { return axes_; }
+
+  /// @brief minimum and maximum of the projections of the polygon on each axis
+  const std::vector<std::pair<double, double>> & projections() const { return projections_; }
+
+  const Box2d & box() const { return box_; }
+
+private:
+  Polygon2d polygon_;
+  std::vector<Point2d> axes_;
+  std::vector<std::pair<double, double>> projections_;
+  Box2d box_;
+};
+
+/// @brief return true if the bounding boxes of the polygons are separated
+bool boxes_disjoint(const Box2d & box1, const Box2d & box2);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__PREPARED_CONVEX_POLYGON_HPP_
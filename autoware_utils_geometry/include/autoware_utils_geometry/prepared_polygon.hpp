@@ -0,0 +1,89 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__PREPARED_POLYGON_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__PREPARED_POLYGON_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_geometry.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Polygon, concave or with holes, indexed for repeated point queries.
+ * @details The edges are bucketed once in a uniform grid over the bounding box, with about one edge
+ *          per cell, and each cell stores a reference point whose containment is precomputed. A
+ *          containment query only tests the edges of the cell of the point, and a distance query
+ *          the edges of the cells around it.
+ */
+class PreparedPolygon2d
+{
+public:
+  /**
+   * @throw std::invalid_argument if the outer ring does not have any edge
+   */
+  explicit PreparedPolygon2d(const Polygon2d & polygon);
+
+  explicit PreparedPolygon2d(const alt::Polygon2d & polygon);
+
+  const std::vector<std::pair<alt::Point2d, alt::Point2d>> & edges() const { return edges_; }
+
+  std::size_t cols() const { return cols_; }
+
+  std::size_t rows() const { return rows_; }
+
+private:
+  enum class Location { outside, boundary, inside };
+
+  void build();
+
+  std::size_t cell_col(const double x) const;
+
+  std::size_t cell_row(const double y) const;
+
+  Location locate(const alt::Point2d & point) const;
+
+  friend bool covered_by(const alt::Point2d & point, const PreparedPolygon2d & poly);
+  friend double distance(const alt::Point2d & point, const PreparedPolygon2d & poly);
+  friend bool within(const alt::Point2d & point, const PreparedPolygon2d & poly);
+
+  std::vector<std::pair<alt::Point2d, alt::Point2d>> edges_;
+  alt::Point2d min_corner_;
+  alt::Point2d max_corner_;
+  double cell_width_{0.0};
+  double cell_height_{0.0};
+  std::size_t cols_{0};
+  std::size_t rows_{0};
+  std::vector<std::size_t> cell_offsets_;  // edges of cell i are cell_edges_[offsets[i], [i + 1])
+  std::vector<std::size_t> cell_edges_;
+  std::vector<alt::Point2d> references_;
+  std::vector<char> reference_inside_;
+};
+
+/// @brief Same as covered_by() with a polygon, in about constant time
+bool covered_by(const alt::Point2d & point, const PreparedPolygon2d & poly);
+
+/// @brief Distance to the polygon, 0 if the point is covered by it
+double distance(const alt::Point2d & point, const PreparedPolygon2d & poly);
+
+bool within(const alt::Point2d & point, const PreparedPolygon2d & poly);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__PREPARED_POLYGON_HPP_
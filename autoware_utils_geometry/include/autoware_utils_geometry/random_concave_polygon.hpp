@@ -17,7 +17,12 @@
 
 #include <autoware_utils_geometry/geometry.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <optional>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware_utils_geometry
@@ -29,6 +34,17 @@ namespace autoware_utils_geometry
 /// https://digitalscholarship.unlv.edu/cgi/viewcontent.cgi?article=3183&context=thesesdissertations
 std::optional<Polygon2d> random_concave_polygon(const size_t vertices, const double max);
 
+/// @brief generate a random star-shaped non-convex polygon
+/// @param vertices number of vertices for the desired polygon, at least 4
+/// @param max points will be generated in the range [-max, max]
+/// @param random_engine source of randomness, the same state gives the same polygon
+/// @details the vertices are placed around the origin at jittered angles with random radii, and
+/// one vertex is dented inside its neighbors. Unlike random_concave_polygon(), the polygon is
+/// always simple and non-convex, so no retry is needed and the cost is linear in the vertices.
+/// @return closed clockwise polygon, empty if vertices is less than 4
+Polygon2d random_star_polygon(
+  const size_t vertices, const double max, std::mt19937_64 & random_engine);
+
 /// @brief checks for collisions between two vectors of convex polygons using a specified collision
 /// detection algorithm
 /// @param polygons1 A vector of convex polygons to check for collisions.
@@ -42,6 +58,41 @@ bool test_intersection(
   const std::function<bool(
     const autoware_utils_geometry::Polygon2d &, const autoware_utils_geometry::Polygon2d &)> &);
 
+/// @brief named intersection predicate compared by compare_intersection_predicates()
+struct IntersectionPredicate
+{
+  std::string name;
+  std::function<bool(const Polygon2d &, const Polygon2d &)> intersects;
+};
+
+/// @brief timings and disagreements of intersection predicates over the same pairs of polygons
+struct IntersectionReport
+{
+  struct PredicateResult
+  {
+    std::string name;
+    std::size_t intersections{0};  // number of intersecting pairs
+    double elapsed_ms{0.0};        // wall time of all the pairs
+    double pairs_per_second{0.0};
+  };
+
+  std::size_t pairs{0};
+  std::vector<PredicateResult> results;  // same order as the predicates
+  /// @brief (index in polygons1, index in polygons2) of the pairs where the predicates disagree
+  std::vector<std::pair<std::size_t, std::size_t>> disagreements;
+};
+
+/// @brief run several intersection predicates over all the pairs of two polygon vectors, time them
+/// and collect the pairs where they disagree
+/// @param predicates predicates to compare, each one is run over all the pairs before the next
+/// @param num_threads number of chunks of the polygons1 run in parallel on
+/// autoware_utils_system::ThreadPool::shared()
+/// @param max_disagreements maximum number of disagreeing pairs stored in the report
+IntersectionReport compare_intersection_predicates(
+  const std::vector<Polygon2d> & polygons1, const std::vector<Polygon2d> & polygons2,
+  const std::vector<IntersectionPredicate> & predicates, const std::size_t num_threads = 1,
+  const std::size_t max_disagreements = 100);
+
 }  // namespace autoware_utils_geometry
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__RANDOM_CONCAVE_POLYGON_HPP_
@@ -0,0 +1,104 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__RASTERIZE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__RASTERIZE_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/boost_geometry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Layout of a row-major grid of square cells, the same as the info of an OccupancyGrid
+ *        without rotation: the cell (row, column) is at index row * width + column, and its lower
+ *        left corner is at (origin_x + column * resolution, origin_y + row * resolution).
+ */
+struct GridLayout
+{
+  double resolution{1.0};
+  double origin_x{0.0};
+  double origin_y{0.0};
+  std::size_t width{0};
+  std::size_t height{0};
+
+  std::size_t size() const { return width * height; }
+};
+
+/**
+ * @brief Scratch storage of the scanline fill, reuse it across calls to avoid reallocation.
+ */
+struct RasterizeBuffer
+{
+  struct Edge
+  {
+    std::size_t first_row;  // first row whose center is crossed
+    std::size_t last_row;   // row after the last row whose center is crossed
+    double x;               // x at the center of the first row
+    double dx;              // change of x per row
+  };
+
+  std::vector<Edge> edges;
+  std::vector<std::size_t> active;
+  std::vector<double> crossings;
+};
+
+/**
+ * @brief Set the cells whose centers are inside a polygon with a scanline fill.
+ * @details The edges of all the rings are sorted by their first row, and the crossings of the
+ *          active edges with the center line of each row are filled by pairs, so that the holes
+ *          are left out and the cost is in the number of rows and filled cells, not of the cells
+ *          times the vertices. The cells outside the grid are ignored.
+ * @param cells row-major cells of the grid, of size layout.size()
+ * @param value value of the cells inside the polygon, the other cells are unchanged
+ * @throw std::invalid_argument if the size of the cells does not match the layout
+ */
+void rasterize(
+  const Polygon2d & polygon, const GridLayout & layout, std::vector<std::uint8_t> & cells,
+  const std::uint8_t value, RasterizeBuffer & buffer);
+
+void rasterize(
+  const alt::Polygon2d & polygon, const GridLayout & layout, std::vector<std::uint8_t> & cells,
+  const std::uint8_t value, RasterizeBuffer & buffer);
+
+/// @brief Rasterize many polygons into the same grid, reusing the scratch storage.
+void rasterize(
+  const std::vector<Polygon2d> & polygons, const GridLayout & layout,
+  std::vector<std::uint8_t> & cells, const std::uint8_t value);
+
+void rasterize(
+  const std::vector<alt::Polygon2d> & polygons, const GridLayout & layout,
+  std::vector<std::uint8_t> & cells, const std::uint8_t value);
+
+/**
+ * @brief Compute the Euclidean distance from the center of each cell to the center of the nearest
+ *        occupied cell, with the separable algorithm of Felzenszwalb and Huttenlocher in O(cells).
+ * @param cells row-major cells of the grid, of size layout.size()
+ * @param threshold minimum value of the occupied cells
+ * @param distances distances in the unit of the resolution, 0 in the occupied cells, infinity if
+ *        no cell is occupied
+ * @throw std::invalid_argument if the size of the cells does not match the layout
+ */
+void distance_transform(
+  const std::vector<std::uint8_t> & cells, const GridLayout & layout,
+  const std::uint8_t threshold, std::vector<float> & distances);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__RASTERIZE_HPP_
@@ -0,0 +1,70 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__RESAMPLE_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__RESAMPLE_HPP_
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Interpolate the poses of a path at the given arc lengths.
+ * @details The result is the same as calling calc_interpolated_pose on the segment containing each
+ *          arc length, but the path is walked once and the orientation computed from the position
+ *          direction is built only once per segment. The arc length is measured in the XY plane
+ *          and is clamped to the length of the path.
+ * @param poses source path
+ * @param arc_lengths target arc lengths, which should be sorted in ascending order
+ * @param output interpolated poses, the buffer is reused
+ * @param set_orientation_from_position_direction set orientation by spherical interpolation if
+ *        false
+ */
+void resample_poses(
+  const std::vector<geometry_msgs::msg::Pose> & poses, const std::vector<double> & arc_lengths,
+  std::vector<geometry_msgs::msg::Pose> & output,
+  const bool set_orientation_from_position_direction = true);
+
+template <class T>
+void resample_poses(
+  const std::vector<T> & points, const std::vector<double> & arc_lengths,
+  std::vector<geometry_msgs::msg::Pose> & output,
+  const bool set_orientation_from_position_direction = true)
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(points.size());
+  for (const auto & point : points) {
+    poses.push_back(get_pose(point));
+  }
+  resample_poses(poses, arc_lengths, output, set_orientation_from_position_direction);
+}
+
+template <class T>
+std::vector<geometry_msgs::msg::Pose> resample_poses(
+  const std::vector<T> & points, const std::vector<double> & arc_lengths,
+  const bool set_orientation_from_position_direction = true)
+{
+  std::vector<geometry_msgs::msg::Pose> output;
+  resample_poses(points, arc_lengths, output, set_orientation_from_position_direction);
+  return output;
+}
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__RESAMPLE_HPP_
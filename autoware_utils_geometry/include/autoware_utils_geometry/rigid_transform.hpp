@@ -0,0 +1,148 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__RIGID_TRANSFORM_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__RIGID_TRANSFORM_HPP_
+
+#define EIGEN_MPL2_ONLY
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/quaternion.hpp>
+#include <geometry_msgs/msg/transform.hpp>
+#include <geometry_msgs/msg/transform_stamped.hpp>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Rigid transform in 3D with the rotation matrix, translation and inverse precomputed.
+ * @details Build it once from a message and pass it to transform_point, transform_pose and the
+ *          inverse variants so that the quaternion conversion is not repeated for each element.
+ */
+class RigidTransform3d
+{
+public:
+  RigidTransform3d()
+  : rotation_(Eigen::Matrix3d::Identity()),
+    translation_(Eigen::Vector3d::Zero()),
+    quaternion_(Eigen::Quaterniond::Identity()),
+    inverse_translation_(Eigen::Vector3d::Zero())
+  {
+  }
+
+  RigidTransform3d(const Eigen::Quaterniond & rotation, const Eigen::Vector3d & translation);
+
+  explicit RigidTransform3d(const geometry_msgs::msg::Transform & transform);
+
+  explicit RigidTransform3d(const geometry_msgs::msg::TransformStamped & transform);
+
+  explicit RigidTransform3d(const geometry_msgs::msg::Pose & pose);
+
+  const Eigen::Matrix3d & rotation() const { return rotation_; }
+
+  const Eigen::Vector3d & translation() const { return translation_; }
+
+  const Eigen::Quaterniond & quaternion() const { return quaternion_; }
+
+  /// @brief Return the inverse transform, which only swaps the cached values.
+  RigidTransform3d inverse() const;
+
+  /// @brief Compose two transforms, the right hand side is applied first.
+  RigidTransform3d operator*(const RigidTransform3d & other) const;
+
+  Eigen::Vector3d apply(const Eigen::Vector3d & point) const
+  {
+    return rotation_ * point + translation_;
+  }
+
+  Eigen::Vector3d apply_inverse(const Eigen::Vector3d & point) const
+  {
+    return rotation_.transpose() * point + inverse_translation_;
+  }
+
+  /// @brief Rotate an orientation message, the output is normalized.
+  geometry_msgs::msg::Quaternion apply(const geometry_msgs::msg::Quaternion & orientation) const;
+
+  geometry_msgs::msg::Quaternion apply_inverse(
+    const geometry_msgs::msg::Quaternion & orientation) const;
+
+  geometry_msgs::msg::Transform to_msg() const;
+
+private:
+  Eigen::Matrix3d rotation_;
+  Eigen::Vector3d translation_;
+  Eigen::Quaterniond quaternion_;
+  Eigen::Vector3d inverse_translation_;
+};
+
+/**
+ * @brief Rigid transform in the XY plane with the cosine and sine of the yaw precomputed.
+ * @details Roll, pitch and the Z translation of the source message are ignored.
+ */
+class RigidTransform2d
+{
+public:
+  RigidTransform2d() : cos_(1.0), sin_(0.0), x_(0.0), y_(0.0) {}
+
+  RigidTransform2d(const double yaw, const double x, const double y);
+
+  explicit RigidTransform2d(const geometry_msgs::msg::Transform & transform);
+
+  explicit RigidTransform2d(const geometry_msgs::msg::TransformStamped & transform);
+
+  explicit RigidTransform2d(const geometry_msgs::msg::Pose & pose);
+
+  double cos() const { return cos_; }
+
+  double sin() const { return sin_; }
+
+  double x() const { return x_; }
+
+  double y() const { return y_; }
+
+  double yaw() const;
+
+  RigidTransform2d inverse() const;
+
+  RigidTransform2d operator*(const RigidTransform2d & other) const;
+
+  Eigen::Vector2d apply(const Eigen::Vector2d & point) const
+  {
+    return {cos_ * point.x() - sin_ * point.y() + x_, sin_ * point.x() + cos_ * point.y() + y_};
+  }
+
+  Eigen::Vector2d apply_inverse(const Eigen::Vector2d & point) const
+  {
+    const double dx = point.x() - x_;
+    const double dy = point.y() - y_;
+    return {cos_ * dx + sin_ * dy, -sin_ * dx + cos_ * dy};
+  }
+
+private:
+  RigidTransform2d(const double cos, const double sin, const double x, const double y)
+  : cos_(cos), sin_(sin), x_(x), y_(y)
+  {
+  }
+
+  double cos_;
+  double sin_;
+  double x_;
+  double y_;
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__RIGID_TRANSFORM_HPP_
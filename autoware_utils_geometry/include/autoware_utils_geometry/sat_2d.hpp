@@ -16,6 +16,7 @@
 #define AUTOWARE_UTILS_GEOMETRY__SAT_2D_HPP_
 
 #include <autoware_utils_geometry/boost_geometry.hpp>
+#include <autoware_utils_geometry/prepared_convex_polygon.hpp>
 
 namespace autoware_utils_geometry::sat
 {
@@ -25,6 +26,15 @@ namespace autoware_utils_geometry::sat
  */
 bool intersects(const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2);
 
+/**
+ * @brief Check if 2 convex polygons intersect using the SAT algorithm and the precomputed data
+ * @details the result is the same as intersects(prepared.polygon(), convex_polygon)
+ */
+bool intersects(const PreparedConvexPolygon2d & prepared, const Polygon2d & convex_polygon);
+
+bool intersects(
+  const PreparedConvexPolygon2d & prepared1, const PreparedConvexPolygon2d & prepared2);
+
 }  // namespace autoware_utils_geometry::sat
 
 #endif  // AUTOWARE_UTILS_GEOMETRY__SAT_2D_HPP_
@@ -0,0 +1,139 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__SEGMENT_INDEX_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__SEGMENT_INDEX_HPP_
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Spatial index over the segments of a path for nearest segment queries in the XY plane.
+ * @details Consecutive segments are grouped into small leaves and the bounding boxes of the leaves
+ *          are stored in a flat complete binary tree. Since the segments of a path are spatially
+ *          coherent, the boxes stay tight and a query only visits a logarithmic number of nodes.
+ *          Extending the path at the end only updates the boxes from the last leaf to the root.
+ *          The segment i connects the points i and i + 1.
+ */
+class PathSegmentIndex
+{
+public:
+  struct Result
+  {
+    std::size_t segment_index;
+    double ratio;  // position of the closest point on the segment, in [0.0, 1.0]
+    double distance;
+  };
+
+  PathSegmentIndex() = default;
+
+  template <class T>
+  explicit PathSegmentIndex(const std::vector<T> & points)
+  {
+    build(points);
+  }
+
+  template <class T>
+  void build(const std::vector<T> & points)
+  {
+    clear();
+    extend(points);
+  }
+
+  /**
+   * @brief Add the points after the ones already indexed.
+   * @details The first size() points must be the same as the ones indexed previously.
+   */
+  template <class T>
+  void extend(const std::vector<T> & points)
+  {
+    reserve(points.size());
+    for (std::size_t i = size(); i < points.size(); ++i) {
+      const auto & p = get_point_view(points[i]);
+      push_back(p.x, p.y);
+    }
+  }
+
+  void clear();
+
+  void reserve(const std::size_t num_points);
+
+  void push_back(const double x, const double y);
+
+  /// @brief Number of indexed points.
+  std::size_t size() const { return x_.size(); }
+
+  template <class Point>
+  std::optional<Result> nearest_segment(const Point & point) const
+  {
+    const auto & p = get_point_view(point);
+    return nearest_segment(p.x, p.y);
+  }
+
+  /// @brief Return the k nearest segments sorted by distance.
+  template <class Point>
+  std::vector<Result> nearest_segments(const Point & point, const std::size_t k) const
+  {
+    const auto & p = get_point_view(point);
+    return nearest_segments(p.x, p.y, k);
+  }
+
+  std::optional<Result> nearest_segment(const double x, const double y) const;
+
+  std::vector<Result> nearest_segments(const double x, const double y, const std::size_t k) const;
+
+  /**
+   * @brief Return the nearest segment if it is closer than a distance, e.g. the distance to a
+   *        segment found by a local search, which prunes most of the tree.
+   */
+  std::optional<Result> nearest_segment(
+    const double x, const double y, const double max_distance) const;
+
+private:
+  struct Box
+  {
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+  };
+
+  static constexpr std::size_t leaf_size = 8;
+
+  std::size_t num_segments() const { return x_.empty() ? 0 : x_.size() - 1; }
+
+  void grow(const std::size_t num_leaves);
+
+  void expand(std::size_t node, const Box & box);
+
+  Result to_result(const std::size_t segment_index, const double x, const double y) const;
+
+  std::vector<Result> nearest_segments(
+    const double x, const double y, const std::size_t k, const double max_squared_distance) const;
+
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::size_t num_leaves_capacity_{0};
+  std::vector<Box> nodes_;  // nodes_[1] is the root, the children of n are 2n and 2n + 1
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__SEGMENT_INDEX_HPP_
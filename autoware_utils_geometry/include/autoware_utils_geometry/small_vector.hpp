@@ -0,0 +1,295 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__SMALL_VECTOR_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__SMALL_VECTOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Contiguous sequence container that stores up to N elements inline without allocation.
+ * @details It behaves like std::vector and moves its elements to the heap when it grows beyond N.
+ *          Only trivially copyable types are supported, so that the elements can be copied without
+ *          running constructors and destructors.
+ */
+template <class T, std::size_t N>
+class SmallVector
+{
+  static_assert(
+    std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+    "SmallVector only supports trivially copyable types.");
+  static_assert(0 < N, "The inline capacity must be positive.");
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type inline_capacity = N;
+
+  SmallVector() noexcept = default;
+
+  SmallVector(const size_type count, const T & value) { assign(count, value); }
+
+  template <class InputIt, class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  SmallVector(InputIt first, InputIt last)
+  {
+    assign(first, last);
+  }
+
+  SmallVector(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+
+  SmallVector(const SmallVector & other) { assign(other.begin(), other.end()); }
+
+  SmallVector(SmallVector && other) noexcept { move_from(other); }
+
+  ~SmallVector() { release(); }
+
+  SmallVector & operator=(const SmallVector & other)
+  {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  SmallVector & operator=(SmallVector && other) noexcept
+  {
+    if (this != &other) {
+      release();
+      move_from(other);
+    }
+    return *this;
+  }
+
+  SmallVector & operator=(std::initializer_list<T> init)
+  {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  void assign(const size_type count, const T & value)
+  {
+    const T copy = value;
+    clear();
+    reserve(count);
+    std::uninitialized_fill_n(data_, count, copy);
+    size_ = count;
+  }
+
+  template <class InputIt, class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt first, InputIt last)
+  {
+    clear();
+    if constexpr (std::is_base_of_v<
+                    std::forward_iterator_tag,
+                    typename std::iterator_traits<InputIt>::iterator_category>) {
+      reserve(static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator cbegin() const noexcept { return data_; }
+
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+  const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  /// @brief Whether the elements are stored in the inline buffer.
+  bool is_inline() const noexcept { return data_ == inline_data(); }
+
+  T * data() noexcept { return data_; }
+  const T * data() const noexcept { return data_; }
+
+  T & operator[](const size_type i) { return data_[i]; }
+  const T & operator[](const size_type i) const { return data_[i]; }
+
+  T & front() { return data_[0]; }
+  const T & front() const { return data_[0]; }
+
+  T & back() { return data_[size_ - 1]; }
+  const T & back() const { return data_[size_ - 1]; }
+
+  void clear() noexcept { size_ = 0; }
+
+  void reserve(const size_type new_capacity)
+  {
+    if (capacity_ < new_capacity) {
+      reallocate(std::max(new_capacity, 2 * capacity_));
+    }
+  }
+
+  void resize(const size_type count) { resize(count, T{}); }
+
+  void resize(const size_type count, const T & value)
+  {
+    if (size_ < count) {
+      const T copy = value;
+      reserve(count);
+      std::uninitialized_fill(data_ + size_, data_ + count, copy);
+    }
+    size_ = count;
+  }
+
+  void push_back(const T & value)
+  {
+    // Copy first since value may refer to an element of this container.
+    const T copy = value;
+    reserve(size_ + 1);
+    ::new (static_cast<void *>(data_ + size_)) T(copy);
+    ++size_;
+  }
+
+  template <class... Args>
+  T & emplace_back(Args &&... args)
+  {
+    push_back(T(std::forward<Args>(args)...));
+    return back();
+  }
+
+  void pop_back() noexcept { --size_; }
+
+  iterator insert(const_iterator pos, const T & value)
+  {
+    const auto index = pos - begin();
+    push_back(value);
+    std::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+
+  template <class InputIt, class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last)
+  {
+    const auto index = pos - begin();
+    const auto old_size = static_cast<difference_type>(size_);
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+    std::rotate(begin() + index, begin() + old_size, end());
+    return begin() + index;
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last)
+  {
+    const auto index = first - begin();
+    const auto num_erased = last - first;
+    std::copy(begin() + (last - begin()), end(), begin() + index);
+    size_ -= static_cast<size_type>(num_erased);
+    return begin() + index;
+  }
+
+  void swap(SmallVector & other) noexcept
+  {
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+private:
+  T * inline_data() noexcept { return reinterpret_cast<T *>(buffer_); }
+  const T * inline_data() const noexcept { return reinterpret_cast<const T *>(buffer_); }
+
+  void reallocate(const size_type new_capacity)
+  {
+    T * new_data = std::allocator<T>().allocate(new_capacity);
+    std::uninitialized_copy(begin(), end(), new_data);
+    release();
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  void release() noexcept
+  {
+    if (!is_inline()) {
+      std::allocator<T>().deallocate(data_, capacity_);
+      data_ = inline_data();
+      capacity_ = N;
+    }
+  }
+
+  void move_from(SmallVector & other) noexcept
+  {
+    if (other.is_inline()) {
+      std::uninitialized_copy(other.begin(), other.end(), inline_data());
+      data_ = inline_data();
+      capacity_ = N;
+    } else {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.capacity_ = N;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+  T * data_{inline_data()};
+  size_type size_{0};
+  size_type capacity_{N};
+};
+
+template <class T, std::size_t N>
+bool operator==(const SmallVector<T, N> & lhs, const SmallVector<T, N> & rhs)
+{
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, std::size_t N>
+bool operator!=(const SmallVector<T, N> & lhs, const SmallVector<T, N> & rhs)
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__SMALL_VECTOR_HPP_
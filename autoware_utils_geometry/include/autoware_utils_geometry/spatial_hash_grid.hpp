@@ -0,0 +1,132 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__SPATIAL_HASH_GRID_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__SPATIAL_HASH_GRID_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Uniform grid of square cells hashed into an open addressing table, indexing the points
+ *        and the bounding boxes of polygons which move every cycle.
+ * @details An item is added to all the cells overlapped by its box, so the cell size should be
+ *          about the size of the items or of the queries. clear() keeps the storage, so that the
+ *          grid is refilled every cycle without allocation, instead of rebuilding a tree.
+ *          The queries return the ids of the items once each, in no particular order.
+ */
+class SpatialHashGrid
+{
+public:
+  /**
+   * @param cell_size side of the cells
+   * @throw std::invalid_argument if the cell size is not positive
+   */
+  explicit SpatialHashGrid(const double cell_size);
+
+  double cell_size() const { return cell_size_; }
+
+  /// @brief Remove all the items, keeping the storage.
+  void clear();
+
+  /// @brief Number of inserted items.
+  std::size_t size() const { return items_.size(); }
+
+  bool empty() const { return items_.empty(); }
+
+  void insert(const std::size_t id, const alt::Point2d & point);
+
+  /// @brief Insert the bounding box of a polygon, the same as envelope.
+  void insert(const std::size_t id, const alt::ConvexPolygon2dView & polygon);
+
+  void insert(const std::size_t id, const alt::Point2d & min, const alt::Point2d & max);
+
+  /// @brief Clear the grid and insert the points with their indices as ids.
+  void build(const alt::Points2d & points);
+
+  /// @brief Clear the grid and insert the polygons with their indices as ids.
+  void build(const std::vector<alt::ConvexPolygon2dView> & polygons);
+
+  /// @brief Find the items whose boxes intersect a box.
+  void query_box(
+    const alt::Point2d & min, const alt::Point2d & max, std::vector<std::size_t> & ids) const;
+
+  /// @brief Find the items whose boxes are within a distance of a point.
+  void query_radius(
+    const alt::Point2d & center, const double radius, std::vector<std::size_t> & ids) const;
+
+private:
+  static constexpr std::uint32_t npos = UINT32_MAX;
+
+  struct Item
+  {
+    std::size_t id;
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+  };
+
+  struct Entry
+  {
+    std::uint32_t item;
+    std::uint32_t next;  // next entry of the same cell
+  };
+
+  struct Slot
+  {
+    std::int32_t x;
+    std::int32_t y;
+    std::uint32_t head;  // first entry of the cell, or npos for an empty slot
+  };
+
+  std::int32_t to_cell(const double coordinate) const;
+
+  std::size_t find_slot(const std::int32_t x, const std::int32_t y) const;
+
+  void rehash(const std::size_t capacity);
+
+  template <class Visit>
+  void visit_box(
+    const double min_x, const double min_y, const double max_x, const double max_y,
+    const Visit & visit) const;
+
+  double cell_size_;
+  double inverse_cell_size_;
+  std::vector<Item> items_;
+  std::vector<Entry> entries_;
+  std::vector<Slot> slots_;  // open addressing with linear probing, the capacity a power of 2
+  std::size_t used_slots_{0};
+  int shift_{64};  // 64 - log2 of the capacity, for the Fibonacci hashing
+};
+
+/**
+ * @brief Find the points covered by a polygon among the points indexed in a grid, e.g. for the
+ *        filtering of the points in many areas, querying the box of each area.
+ * @param grid grid built from the points
+ * @param indices indices of the covered points, sorted
+ */
+void covered_by(
+  const SpatialHashGrid & grid, const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices);
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__SPATIAL_HASH_GRID_HPP_
@@ -0,0 +1,255 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_GEOMETRY__TIME_SERIES_BUFFER_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__TIME_SERIES_BUFFER_HPP_
+
+#include <builtin_interfaces/msg/time.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/quaternion.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <geometry_msgs/msg/vector3.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Interpolation of the values of a TimeSeriesBuffer.
+ * @details The vectors are interpolated linearly and the orientations by slerp, so that the poses
+ *          are the same as calc_interpolated_pose with set_orientation_from_position_direction
+ *          false. Other types need their own function object with the same signature.
+ */
+struct TimeSeriesInterpolation
+{
+  double operator()(const double a, const double b, const double ratio) const
+  {
+    return a + ratio * (b - a);
+  }
+
+  geometry_msgs::msg::Point operator()(
+    const geometry_msgs::msg::Point & a, const geometry_msgs::msg::Point & b,
+    const double ratio) const;
+
+  geometry_msgs::msg::Vector3 operator()(
+    const geometry_msgs::msg::Vector3 & a, const geometry_msgs::msg::Vector3 & b,
+    const double ratio) const;
+
+  geometry_msgs::msg::Quaternion operator()(
+    const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b,
+    const double ratio) const;
+
+  geometry_msgs::msg::Pose operator()(
+    const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b,
+    const double ratio) const;
+
+  geometry_msgs::msg::Twist operator()(
+    const geometry_msgs::msg::Twist & a, const geometry_msgs::msg::Twist & b,
+    const double ratio) const;
+};
+
+/// @brief Nanoseconds since the epoch of a stamp, same as rclcpp::Time(stamp).nanoseconds().
+inline std::int64_t to_nanoseconds(const builtin_interfaces::msg::Time & stamp)
+{
+  return static_cast<std::int64_t>(stamp.sec) * 1000000000 + stamp.nanosec;
+}
+
+/**
+ * @brief History of stamped values, e.g. the poses of Odometry or the twists of TwistStamped, with
+ *        interpolation at any stamp between the oldest and the newest values.
+ * @details The stamps and the values are stored in contiguous arrays of twice the capacity, in
+ *          which the window of the last values moves forward and is copied back to the front once
+ *          every capacity pushes, so that a push is amortized constant time and a lookup is a
+ *          binary search over a plain array of stamps. The batch interpolation searches each stamp
+ *          from the segment of the previous one with an exponential search, which is constant time
+ *          for sorted stamps such as the points of a scan, and logarithmic otherwise.
+ *          The stamps are in nanoseconds, e.g. rclcpp::Time::nanoseconds().
+ * @tparam T type of the values, default constructible and copyable
+ * @tparam Interpolation function object returning the value at a ratio between two values
+ */
+template <class T, class Interpolation = TimeSeriesInterpolation>
+class TimeSeriesBuffer
+{
+public:
+  /**
+   * @param capacity maximum number of values kept, the oldest value is dropped beyond it
+   * @throw std::invalid_argument if the capacity is less than 2
+   */
+  explicit TimeSeriesBuffer(
+    const std::size_t capacity, const Interpolation & interpolation = Interpolation())
+  : capacity_(capacity), interpolation_(interpolation)
+  {
+    if (capacity < 2) {
+      throw std::invalid_argument("The capacity must be at least 2.");
+    }
+    stamps_.resize(2 * capacity);
+    values_.resize(2 * capacity);
+  }
+
+  /**
+   * @brief Add the newest value.
+   * @return false if the stamp is not newer than the newest value, and the value is not added
+   */
+  bool push_back(const std::int64_t stamp, const T & value)
+  {
+    if (!empty() && stamp <= stamps_[end_ - 1]) {
+      return false;
+    }
+    if (end_ == stamps_.size()) {
+      // keep the newest capacity - 1 values at the front of the storage
+      const std::size_t first = std::max(begin_, end_ - (capacity_ - 1));
+      std::copy(stamps_.begin() + first, stamps_.begin() + end_, stamps_.begin());
+      std::copy(values_.begin() + first, values_.begin() + end_, values_.begin());
+      end_ -= first;
+      begin_ = 0;
+    }
+    stamps_[end_] = stamp;
+    values_[end_] = value;
+    ++end_;
+    if (capacity_ < end_ - begin_) {
+      ++begin_;
+    }
+    return true;
+  }
+
+  bool push_back(const builtin_interfaces::msg::Time & stamp, const T & value)
+  {
+    return push_back(to_nanoseconds(stamp), value);
+  }
+
+  /**
+   * @brief Remove the values older than needed to interpolate at the stamp or later, i.e. all but
+   *        the newest value that is not newer than the stamp.
+   */
+  void erase_before(const std::int64_t stamp)
+  {
+    if (empty()) {
+      return;
+    }
+    begin_ = upper_bound(begin_ + 1, stamp) - 1;
+  }
+
+  void clear()
+  {
+    begin_ = 0;
+    end_ = 0;
+  }
+
+  std::size_t size() const { return end_ - begin_; }
+  std::size_t capacity() const { return capacity_; }
+  bool empty() const { return begin_ == end_; }
+
+  /// @brief Stamp of the oldest value, the buffer must not be empty.
+  std::int64_t front_stamp() const { return stamps_[begin_]; }
+
+  /// @brief Stamp of the newest value, the buffer must not be empty.
+  std::int64_t back_stamp() const { return stamps_[end_ - 1]; }
+
+  const T & front() const { return values_[begin_]; }
+  const T & back() const { return values_[end_ - 1]; }
+
+  /**
+   * @brief Interpolate the value at a stamp.
+   * @return The value, or nullopt if the stamp is outside of the stamps of the buffer.
+   */
+  std::optional<T> interpolate(const std::int64_t stamp) const
+  {
+    if (empty() || stamp < front_stamp() || back_stamp() < stamp) {
+      return std::nullopt;
+    }
+    return value_at(upper_bound(begin_ + 1, stamp), stamp);
+  }
+
+  std::optional<T> interpolate(const builtin_interfaces::msg::Time & stamp) const
+  {
+    return interpolate(to_nanoseconds(stamp));
+  }
+
+  /**
+   * @brief Interpolate the values at many stamps, each one searched from the previous one.
+   * @param values values at the stamps, the oldest or the newest value for the stamps outside of
+   *        the buffer, and empty if the buffer is empty, the storage is reused
+   * @return Number of stamps outside of the stamps of the buffer.
+   */
+  std::size_t interpolate(const std::vector<std::int64_t> & stamps, std::vector<T> & values) const
+  {
+    values.clear();
+    if (empty()) {
+      return stamps.size();
+    }
+    values.reserve(stamps.size());
+    std::size_t num_outside = 0;
+    std::size_t index = begin_ + 1;
+    for (const auto stamp : stamps) {
+      if (stamp < front_stamp() || back_stamp() < stamp) {
+        values.push_back(stamp < front_stamp() ? front() : back());
+        ++num_outside;
+        continue;
+      }
+      index = stamps_[index - 1] <= stamp ? gallop(index, stamp) : upper_bound(begin_ + 1, stamp);
+      values.push_back(value_at(index, stamp));
+    }
+    return num_outside;
+  }
+
+private:
+  // index of the first stamp newer than the stamp in [first, end_], or end_
+  std::size_t upper_bound(const std::size_t first, const std::int64_t stamp) const
+  {
+    const auto it = std::upper_bound(stamps_.begin() + first, stamps_.begin() + end_, stamp);
+    return static_cast<std::size_t>(it - stamps_.begin());
+  }
+
+  // same as upper_bound(first, stamp) if the stamp at first - 1 is not newer than the stamp
+  std::size_t gallop(std::size_t first, const std::int64_t stamp) const
+  {
+    std::size_t step = 1;
+    while (first + step < end_ && stamps_[first + step - 1] <= stamp) {
+      first += step;
+      step *= 2;
+    }
+    const auto last = stamps_.begin() + std::min(first + step, end_);
+    return static_cast<std::size_t>(
+      std::upper_bound(stamps_.begin() + first, last, stamp) - stamps_.begin());
+  }
+
+  // value at a stamp between the stamps at index - 1 and index, or at end_ - 1 if index is end_
+  T value_at(const std::size_t index, const std::int64_t stamp) const
+  {
+    if (index == end_) {
+      return values_[end_ - 1];
+    }
+    const double ratio = static_cast<double>(stamp - stamps_[index - 1]) /
+                         static_cast<double>(stamps_[index] - stamps_[index - 1]);
+    return interpolation_(values_[index - 1], values_[index], ratio);
+  }
+
+  std::size_t capacity_;
+  Interpolation interpolation_;
+  std::vector<std::int64_t> stamps_;
+  std::vector<T> values_;
+  std::size_t begin_{0};
+  std::size_t end_{0};
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__TIME_SERIES_BUFFER_HPP_
@@ -0,0 +1,172 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE_UTILS_GEOMETRY__TRAJECTORY_COMPACTOR_HPP_
+#define AUTOWARE_UTILS_GEOMETRY__TRAJECTORY_COMPACTOR_HPP_
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_geometry/point_traits.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+/**
+ * @brief Decimation of the points of a trajectory or a path for the debug topics and the logs,
+ *        and their delta encoding for the recordings.
+ * @details The points are removed by the Douglas-Peucker algorithm of simplify_douglas_peucker
+ *          while they are within max_lateral_error of the kept segments and, for the types with a
+ *          longitudinal velocity, within max_velocity_error of the velocity interpolated along the
+ *          arc length between the kept points. The points where the velocity becomes 0 or leaves
+ *          0 are always kept, as the end points. The encoding rounds the positions, the yaws and
+ *          the velocities of the kept points to the resolutions and writes the differences between
+ *          consecutive points as variable length integers, i.e. a few bytes per point. The other
+ *          fields, e.g. the roll and the pitch or the acceleration, are not encoded.
+ *          The buffers are kept across calls, so keeping one instance alive avoids the allocations.
+ */
+class TrajectoryCompactor
+{
+public:
+  struct Parameters
+  {
+    double max_lateral_error{0.05};     ///< [m] distance of the removed points to the kept segments
+    double max_velocity_error{0.1};     ///< [m/s] error of the interpolated velocities
+    double position_resolution{1e-3};   ///< [m] rounding of the encoded positions
+    double yaw_resolution{1e-4};        ///< [rad] rounding of the encoded yaws
+    double velocity_resolution{1e-3};   ///< [m/s] rounding of the encoded velocities
+  };
+
+  TrajectoryCompactor() : TrajectoryCompactor(Parameters{}) {}
+
+  /**
+   * @throw std::invalid_argument if an error is negative or a resolution is not positive
+   */
+  explicit TrajectoryCompactor(const Parameters & parameters);
+
+  /**
+   * @brief Get the indices of the kept points in increasing order, including the end points.
+   * @return indices valid until the next call
+   */
+  template <class T>
+  const std::vector<std::size_t> & compact_indices(const std::vector<T> & points)
+  {
+    load(points, false);
+    compact_loaded();
+    return kept_indices_;
+  }
+
+  /**
+   * @brief Copy the kept points.
+   * @param compacted kept points, the buffer is reused
+   */
+  template <class T>
+  void compact(const std::vector<T> & points, std::vector<T> & compacted)
+  {
+    compact_indices(points);
+    compacted.clear();
+    for (const auto index : kept_indices_) {
+      compacted.push_back(points[index]);
+    }
+  }
+
+  /**
+   * @brief Encode the kept points.
+   * @return bytes for e.g. a uint8[] field of a message, valid until the next call
+   */
+  template <class T>
+  const std::vector<std::uint8_t> & encode(const std::vector<T> & points)
+  {
+    load(points, true);
+    compact_loaded();
+    encode_loaded();
+    return bytes_;
+  }
+
+  /**
+   * @brief Decode the points encoded by encode(), with the other fields default constructed.
+   * @param points decoded points, the buffer is reused
+   * @throw std::invalid_argument if the bytes are not an encoded trajectory
+   */
+  template <class T>
+  void decode(const std::vector<std::uint8_t> & bytes, std::vector<T> & points)
+  {
+    decode_loaded(bytes);
+    points.resize(xy_.size());
+    for (std::size_t i = 0; i < xy_.size(); ++i) {
+      points[i] = T{};
+      geometry_msgs::msg::Pose pose;
+      pose.position.x = xy_[i].x();
+      pose.position.y = xy_[i].y();
+      pose.position.z = z_[i];
+      pose.orientation = create_quaternion_from_yaw(yaws_[i]);
+      set_pose(pose, points[i]);
+      if constexpr (has_longitudinal_velocity_trait<T>::value) {
+        if (has_velocity_) {
+          set_longitudinal_velocity(static_cast<float>(velocities_[i]), points[i]);
+        }
+      }
+    }
+  }
+
+  const Parameters & parameters() const { return parameters_; }
+
+private:
+  template <class T>
+  void load(const std::vector<T> & points, const bool with_pose)
+  {
+    const std::size_t size = points.size();
+    has_velocity_ = has_longitudinal_velocity_trait<T>::value;
+    xy_.resize(size);
+    z_.resize(with_pose ? size : 0);
+    yaws_.resize(with_pose ? size : 0);
+    velocities_.resize(has_velocity_ ? size : 0);
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto & pose = get_pose_view(points[i]);
+      xy_[i] = alt::Point2d(pose.position.x, pose.position.y);
+      if (with_pose) {
+        z_[i] = pose.position.z;
+        yaws_[i] = get_yaw(pose.orientation);
+      }
+      if constexpr (has_longitudinal_velocity_trait<T>::value) {
+        velocities_[i] = get_longitudinal_velocity(points[i]);
+      }
+    }
+  }
+
+  void compact_loaded();
+  void compact_piece(std::size_t first, std::size_t last);
+  void encode_loaded();
+  void decode_loaded(const std::vector<std::uint8_t> & bytes);
+
+  Parameters parameters_;
+  bool has_velocity_{false};
+  std::vector<alt::Point2d> xy_;
+  std::vector<double> z_;
+  std::vector<double> yaws_;
+  std::vector<double> velocities_;
+  std::vector<double> arc_lengths_;
+  std::vector<std::size_t> kept_indices_;
+  std::vector<std::size_t> piece_indices_;
+  SimplifyBuffer buffer_;
+  std::vector<std::uint8_t> bytes_;
+};
+
+}  // namespace autoware_utils_geometry
+
+#endif  // AUTOWARE_UTILS_GEOMETRY__TRAJECTORY_COMPACTOR_HPP_
@@ -15,12 +15,595 @@
 #include "autoware_utils_geometry/alt_geometry.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
 #include <limits>
 #include <utility>
 #include <vector>
 
 namespace autoware_utils_geometry
 {
+namespace
+{
+template <class Iterator>
+bool is_clockwise_ring(const Iterator first, const Iterator last)
+{
+  double sum = 0.;
+  for (auto it = first; it != std::prev(last); ++it) {
+    sum += (std::next(it)->x() - it->x()) * (std::next(it)->y() + it->y());
+  }
+
+  return sum > 0;
+}
+
+template <class Iterator>
+bool is_convex_ring(const Iterator first, const Iterator last)
+{
+  constexpr double epsilon = 1e-6;
+
+  for (auto it = std::next(first); it != std::prev(last); ++it) {
+    const auto & p1 = *std::prev(it);
+    const auto & p2 = *it;
+    const auto & p3 = *std::next(it);
+
+    if ((p2 - p1).cross(p3 - p2) > epsilon) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class T>
+bool equals_ring(const alt::ConvexPolygon2View<T> & poly1, const alt::ConvexPolygon2View<T> & poly2)
+{
+  return std::equal(
+    poly1.begin(), std::prev(poly1.end()), poly2.begin(), std::prev(poly2.end()),
+    [](const auto & a, const auto & b) { return equals(a, b); });
+}
+
+/// @brief enclosing rectangle flush with an edge of the polygon that minimizes the given cost
+/// @details the extreme vertices only move forward along the ring as the edge does, so each
+///          pointer goes around the polygon once
+template <class Cost>
+OrientedRectangle min_enclosing_rectangle(const alt::ConvexPolygon2dView & poly, const Cost cost)
+{
+  const auto * vertices = poly.begin();
+  const std::size_t size = poly.size() - 1;  // the ring is closed
+  const auto next = [size](const std::size_t i) { return i + 1 == size ? 0 : i + 1; };
+  const auto advance = [&](std::size_t i, const alt::Vector2d & direction) {
+    for (std::size_t step = 0; step < size; ++step) {
+      if (direction.dot(vertices[next(i)] - vertices[i]) <= 0.0) {
+        break;
+      }
+      i = next(i);
+    }
+    return i;
+  };
+
+  OrientedRectangle best{};
+  double min_cost = std::numeric_limits<double>::max();
+  bool initialized = false;
+  std::size_t forward_idx = 0;
+  std::size_t far_idx = 0;
+  std::size_t backward_idx = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto edge = vertices[next(i)] - vertices[i];
+    const double edge_length = edge.norm();
+    if (edge_length == 0.0) {
+      continue;
+    }
+    const auto u = (1.0 / edge_length) * edge;
+    const alt::Vector2d n(u.y(), -u.x());  // inwards as the ring is clockwise
+
+    if (initialized) {
+      forward_idx = advance(forward_idx, u);
+      far_idx = advance(far_idx, n);
+      backward_idx = advance(backward_idx, -u);
+    } else {
+      // the extreme vertices come in this order along the ring from the first edge
+      forward_idx = advance(i, u);
+      far_idx = advance(forward_idx, n);
+      backward_idx = advance(far_idx, -u);
+      initialized = true;
+    }
+
+    const double max_u = u.dot(vertices[forward_idx] - vertices[i]);
+    const double min_u = u.dot(vertices[backward_idx] - vertices[i]);
+    const double height = n.dot(vertices[far_idx] - vertices[i]);
+    const double c = cost(max_u - min_u, height);
+    if (c < min_cost) {
+      min_cost = c;
+      best.center = vertices[i] + (0.5 * (max_u + min_u)) * u + (0.5 * height) * n;
+      best.yaw = std::atan2(u.y(), u.x());
+      best.length = max_u - min_u;
+      best.width = height;
+    }
+  }
+
+  if (best.length < best.width) {
+    std::swap(best.length, best.width);
+    best.yaw = best.yaw < 0.0 ? best.yaw + M_PI_2 : best.yaw - M_PI_2;
+  }
+  return best;
+}
+
+/**
+ * @brief select the points for which the cross products of all the edges and the vectors from their
+ *        start to the point are at most max_cross, i.e. the points on the right of all the edges
+ */
+template <class T>
+void select_points_right_of_edges(
+  const std::vector<alt::Vector2<T>> & points, const alt::ConvexPolygon2View<T> & poly,
+  const T max_cross, std::vector<std::size_t> & indices)
+{
+  indices.clear();
+  if (poly.size() < 4) {
+    return;
+  }
+
+  // the cross product is a * x + b * y + c for each edge, with the coordinates relative to the
+  // first vertex to keep the precision with the map coordinates
+  const alt::Vector2<T> origin = poly.front();
+  SmallVector<T, alt::ring_inline_capacity> a;
+  SmallVector<T, alt::ring_inline_capacity> b;
+  SmallVector<T, alt::ring_inline_capacity> c;
+  for (auto it = poly.begin(); it != std::prev(poly.end()); ++it) {
+    const auto p1 = *it - origin;
+    const auto p2 = *std::next(it) - origin;
+    a.push_back(p1.y() - p2.y());
+    b.push_back(p2.x() - p1.x());
+    c.push_back(p1.x() * p2.y() - p2.x() * p1.y());
+  }
+  const std::size_t edges = a.size();
+
+  // a cache line of values
+  constexpr std::size_t block_size = 64 / sizeof(T);
+  std::array<T, block_size> max_values{};
+  std::size_t i = 0;
+  for (; i + block_size <= points.size(); i += block_size) {
+    max_values.fill(-std::numeric_limits<T>::infinity());
+    for (std::size_t k = 0; k < edges; ++k) {
+      for (std::size_t j = 0; j < block_size; ++j) {
+        const T x = points[i + j].x() - origin.x();
+        const T y = points[i + j].y() - origin.y();
+        max_values[j] = std::max(max_values[j], a[k] * x + b[k] * y + c[k]);
+      }
+    }
+    for (std::size_t j = 0; j < block_size; ++j) {
+      if (max_values[j] <= max_cross) {
+        indices.push_back(i + j);
+      }
+    }
+  }
+
+  for (; i < points.size(); ++i) {
+    const T x = points[i].x() - origin.x();
+    const T y = points[i].y() - origin.y();
+    T max_value = -std::numeric_limits<T>::infinity();
+    for (std::size_t k = 0; k < edges; ++k) {
+      max_value = std::max(max_value, a[k] * x + b[k] * y + c[k]);
+    }
+    if (max_value <= max_cross) {
+      indices.push_back(i);
+    }
+  }
+}
+
+template <class T>
+std::optional<std::size_t> correct_convex_ring_impl(
+  alt::Vector2<T> * vertices, const std::size_t size, const std::size_t capacity)
+{
+  if (size == 0) {
+    return std::nullopt;
+  }
+
+  // same as correct()
+  std::size_t corrected_size =
+    std::unique(
+      vertices, vertices + size, [](const auto & a, const auto & b) { return equals(a, b); }) -
+    vertices;
+
+  if (!equals(vertices[0], vertices[corrected_size - 1])) {
+    if (capacity <= corrected_size) {
+      return std::nullopt;
+    }
+    vertices[corrected_size++] = vertices[0];
+  }
+
+  if (!is_clockwise_ring(vertices, vertices + corrected_size)) {
+    std::reverse(vertices + 1, vertices + corrected_size - 1);
+  }
+
+  if (corrected_size < 4 || !is_convex_ring(vertices, vertices + corrected_size)) {
+    return std::nullopt;
+  }
+
+  return corrected_size;
+}
+
+template <class T>
+T area_impl(const alt::ConvexPolygon2View<T> & poly)
+{
+  T area = 0;
+  for (auto it = std::next(poly.begin()); it != std::prev(poly.end(), 2); ++it) {
+    area += (*std::next(it) - poly.front()).cross(*it - poly.front()) / 2;
+  }
+
+  return area;
+}
+
+template <class T>
+bool covered_by_impl(const alt::Vector2<T> & point, const alt::ConvexPolygon2View<T> & poly)
+{
+  constexpr T epsilon = static_cast<T>(1e-6);
+
+  const auto & vertices = poly;
+  std::size_t winding_number = 0;
+
+  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
+    vertices.begin(), std::prev(vertices.end()),
+    [](const auto & a, const auto & b) { return a.y() < b.y(); });
+  if (point.y() < y_min_vertex->y() || point.y() > y_max_vertex->y()) {
+    return false;
+  }
+
+  for (auto it = vertices.begin(); it != std::prev(vertices.end()); ++it) {
+    const auto & p1 = *it;
+    const auto & p2 = *std::next(it);
+
+    const auto is_upward_edge = p1.y() <= point.y() && p2.y() >= point.y();
+    const auto is_downward_edge = p1.y() >= point.y() && p2.y() <= point.y();
+
+    if (!is_upward_edge && !is_downward_edge) {
+      continue;
+    }
+
+    const auto start_vec = point - p1;
+    const auto end_vec = point - p2;
+    const auto cross = start_vec.cross(end_vec);
+
+    if (is_upward_edge && cross > 0) {  // point is to the left of edge
+      winding_number++;
+      continue;
+    } else if (is_downward_edge && cross < 0) {  // point is to the left of edge
+      winding_number--;
+      continue;
+    }
+
+    if (std::abs(cross) < epsilon && start_vec.dot(end_vec) <= 0.) {  // point is on edge
+      return true;
+    }
+  }
+
+  return winding_number != 0;
+}
+
+template <class T>
+void covered_by_impl(
+  const std::vector<alt::Vector2<T>> & points, const alt::ConvexPolygon2View<T> & poly,
+  std::vector<std::size_t> & indices)
+{
+  constexpr T epsilon = static_cast<T>(1e-6);
+  select_points_right_of_edges(points, poly, epsilon, indices);
+}
+
+template <class T>
+bool disjoint_impl(
+  const alt::ConvexPolygon2View<T> & poly1, const alt::ConvexPolygon2View<T> & poly2)
+{
+  if (equals_ring(poly1, poly2)) {
+    return false;
+  }
+
+  if (intersects(poly1, poly2)) {
+    return false;
+  }
+
+  for (const auto & vertex : poly1) {
+    if (touches(vertex, poly2)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class T>
+bool equals_impl(const alt::Vector2<T> & point1, const alt::Vector2<T> & point2)
+{
+  constexpr T epsilon = static_cast<T>(1e-3);
+  return std::abs(point1.x() - point2.x()) < epsilon && std::abs(point1.y() - point2.y()) < epsilon;
+}
+
+template <class T>
+bool intersects_impl(
+  const alt::ConvexPolygon2View<T> & poly1, const alt::ConvexPolygon2View<T> & poly2)
+{
+  if (equals_ring(poly1, poly2)) {
+    return true;
+  }
+
+  // GJK algorithm
+
+  auto find_support_vector = [](
+                               const alt::ConvexPolygon2View<T> & poly1,
+                               const alt::ConvexPolygon2View<T> & poly2,
+                               const alt::Vector2<T> & direction) {
+    auto find_farthest_vertex =
+      [](const alt::ConvexPolygon2View<T> & poly, const alt::Vector2<T> & direction) {
+        return std::max_element(
+          poly.begin(), std::prev(poly.end()),
+          [&](const auto & a, const auto & b) { return direction.dot(a) <= direction.dot(b); });
+      };
+    return *find_farthest_vertex(poly1, direction) - *find_farthest_vertex(poly2, -direction);
+  };
+
+  alt::Vector2<T> direction = {1, 0};
+  auto a = find_support_vector(poly1, poly2, direction);
+  direction = -a;
+  auto b = find_support_vector(poly1, poly2, direction);
+  if (b.dot(direction) <= 0.0) {
+    return false;
+  }
+
+  direction = (b - a).vector_triple(-a, b - a);
+  while (true) {
+    auto c = find_support_vector(poly1, poly2, direction);
+    if (c.dot(direction) <= 0.0) {
+      return false;
+    }
+
+    auto n_ca = (b - c).vector_triple(a - c, a - c);
+    if (n_ca.dot(-c) > 0.0) {
+      b = c;
+      direction = n_ca;
+    } else {
+      auto n_cb = (a - c).vector_triple(b - c, b - c);
+      if (n_cb.dot(-c) > 0.0) {
+        a = c;
+        direction = n_cb;
+      } else {
+        break;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <class T>
+bool touches_impl(
+  const alt::Vector2<T> & point, const alt::Vector2<T> & seg_start, const alt::Vector2<T> & seg_end)
+{
+  constexpr T epsilon = static_cast<T>(1e-6);
+
+  // if the cross product of the vectors from the start point and the end point to the point is 0
+  // and the vectors opposite each other, the point is on the segment
+  const auto start_vec = point - seg_start;
+  const auto end_vec = point - seg_end;
+  return std::abs(start_vec.cross(end_vec)) < epsilon && start_vec.dot(end_vec) <= 0;
+}
+
+template <class T>
+bool touches_impl(const alt::Vector2<T> & point, const alt::ConvexPolygon2View<T> & poly)
+{
+  const auto & vertices = poly;
+
+  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
+    vertices.begin(), std::prev(vertices.end()),
+    [](const auto & a, const auto & b) { return a.y() < b.y(); });
+  if (point.y() < y_min_vertex->y() || point.y() > y_max_vertex->y()) {
+    return false;
+  }
+
+  for (auto it = vertices.begin(); it != std::prev(vertices.end()); ++it) {
+    // check if the point is on each edge of the polygon
+    if (touches(point, *it, *std::next(it))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+template <class T>
+bool within_impl(const alt::Vector2<T> & point, const alt::ConvexPolygon2View<T> & poly)
+{
+  constexpr T epsilon = static_cast<T>(1e-6);
+
+  const auto & vertices = poly;
+  int64_t winding_number = 0;
+
+  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
+    vertices.begin(), std::prev(vertices.end()),
+    [](const auto & a, const auto & b) { return a.y() < b.y(); });
+  if (point.y() <= y_min_vertex->y() || point.y() >= y_max_vertex->y()) {
+    return false;
+  }
+
+  for (auto it = vertices.begin(); it != std::prev(vertices.end()); ++it) {
+    const auto & p1 = *it;
+    const auto & p2 = *std::next(it);
+
+    const auto is_upward_edge = p1.y() < point.y() && p2.y() > point.y();
+    const auto is_downward_edge = p1.y() > point.y() && p2.y() < point.y();
+
+    if (!is_upward_edge && !is_downward_edge) {
+      continue;
+    }
+
+    const auto start_vec = point - p1;
+    const auto end_vec = point - p2;
+    const auto cross = start_vec.cross(end_vec);
+
+    if (is_upward_edge && cross > 0) {  // point is to the left of edge
+      winding_number++;
+      continue;
+    } else if (is_downward_edge && cross < 0) {  // point is to the left of edge
+      winding_number--;
+      continue;
+    }
+
+    if (std::abs(cross) < epsilon && start_vec.dot(end_vec) <= 0.) {  // point is on edge
+      return false;
+    }
+  }
+
+  return winding_number != 0;
+}
+
+template <class T>
+void within_impl(
+  const std::vector<alt::Vector2<T>> & points, const alt::ConvexPolygon2View<T> & poly,
+  std::vector<std::size_t> & indices)
+{
+  constexpr T epsilon = static_cast<T>(1e-6);
+  select_points_right_of_edges(points, poly, -epsilon, indices);
+}
+
+template <class T>
+bool within_impl(
+  const alt::ConvexPolygon2View<T> & poly_contained,
+  const alt::ConvexPolygon2View<T> & poly_containing)
+{
+  if (equals_ring(poly_contained, poly_containing)) {
+    return true;
+  }
+
+  // check if all points of poly_contained are within poly_containing
+  for (const auto & vertex : poly_contained) {
+    if (!within(vertex, poly_containing)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief clip a convex polygon by another one with the Sutherland-Hodgman algorithm
+ * @details the vertices are relative to the origin to keep the precision with the map coordinates,
+ *          and the clipped polygon is an open clockwise ring, empty if the polygons do not overlap
+ */
+void clip_convex(
+  const alt::ConvexPolygon2dView & subject, const alt::ConvexPolygon2dView & clip,
+  const alt::Point2d & origin, alt::PointList2d & clipped, alt::PointList2d & buffer)
+{
+  clipped.clear();
+  if (subject.size() < 4 || clip.size() < 4) {
+    return;
+  }
+
+  // the buffers alternate as the input and the output of each edge of the clip polygon
+  alt::PointList2d * input = &buffer;
+  alt::PointList2d * output = &clipped;
+  for (auto it = subject.begin(); it != std::prev(subject.end()); ++it) {
+    output->push_back(*it - origin);
+  }
+
+  for (auto it = clip.begin(); it != std::prev(clip.end()) && !output->empty(); ++it) {
+    const auto edge_start = *it - origin;
+    const auto edge = (*std::next(it) - origin) - edge_start;
+    // the inside of the clockwise ring is on the right of its edges
+    const auto side = [&](const alt::Point2d & p) { return edge.cross(p - edge_start); };
+
+    std::swap(input, output);
+    output->clear();
+    alt::Point2d start = input->back();
+    double start_side = side(start);
+    for (const auto & end : *input) {
+      const double end_side = side(end);
+      if ((start_side <= 0.0) != (end_side <= 0.0)) {
+        output->push_back(start + (start_side / (start_side - end_side)) * (end - start));
+      }
+      if (end_side <= 0.0) {
+        output->push_back(end);
+      }
+      start = end;
+      start_side = end_side;
+    }
+  }
+
+  if (output->size() < 3) {
+    clipped.clear();
+  } else if (output != &clipped) {
+    clipped.assign(output->begin(), output->end());
+  }
+}
+
+/// @brief area of an open clockwise ring
+double open_ring_area(const alt::PointList2d & ring)
+{
+  double area = 0.0;
+  for (std::size_t i = 1; i + 1 < ring.size(); ++i) {
+    area += (ring[i + 1] - ring[0]).cross(ring[i] - ring[0]) / 2;
+  }
+  return area;
+}
+
+/**
+ * @brief Minkowski sum of two convex polygons by merging their edges in the order of their angles
+ * @details the edges of the clockwise rings turn clockwise from their lowest vertices, so the edge
+ *          turning less is taken first, and the parallel edges are merged into one
+ */
+void minkowski_sum_impl(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2,
+  alt::PointList2d & sum)
+{
+  sum.clear();
+  if (poly1.size() < 4 || poly2.size() < 4) {
+    return;
+  }
+
+  const auto lowest_vertex = [](const alt::ConvexPolygon2dView & poly) {
+    return static_cast<std::size_t>(
+      std::min_element(
+        poly.begin(), std::prev(poly.end()),
+        [](const auto & a, const auto & b) {
+          return a.y() < b.y() || (a.y() == b.y() && a.x() < b.x());
+        }) -
+      poly.begin());
+  };
+  const auto * vertices1 = poly1.begin();
+  const auto * vertices2 = poly2.begin();
+  const std::size_t size1 = poly1.size() - 1;  // the rings are closed
+  const std::size_t size2 = poly2.size() - 1;
+  std::size_t i = lowest_vertex(poly1);
+  std::size_t j = lowest_vertex(poly2);
+
+  sum.reserve(size1 + size2 + 1);
+  std::size_t edges1 = 0;
+  std::size_t edges2 = 0;
+  while (edges1 < size1 || edges2 < size2) {
+    sum.push_back(vertices1[i] + vertices2[j]);
+    const std::size_t next_i = i + 1 == size1 ? 0 : i + 1;
+    const std::size_t next_j = j + 1 == size2 ? 0 : j + 1;
+    double cross = edges1 < size1 ? -1.0 : 1.0;
+    if (edges1 < size1 && edges2 < size2) {
+      cross = (vertices1[next_i] - vertices1[i]).cross(vertices2[next_j] - vertices2[j]);
+    }
+    if (cross <= 0.0) {
+      i = next_i;
+      ++edges1;
+    }
+    if (0.0 <= cross) {
+      j = next_j;
+      ++edges2;
+    }
+  }
+  sum.push_back(sum.front());
+}
+
+/// @brief intersection over union of two polygons from their areas, 0 if the union is empty
+double intersection_over_union(const double intersection, const double area1, const double area2)
+{
+  const double union_area = area1 + area2 - intersection;
+  return 0.0 < union_area ? intersection / union_area : 0.0;
+}
+}  // namespace
+
 // Alternatives for Boost.Geometry ----------------------------------------------------------------
 namespace alt
 {
@@ -66,6 +649,7 @@ std::optional<Polygon2d> Polygon2d::create(
   const autoware_utils_geometry::Polygon2d & polygon) noexcept
 {
   PointList2d outer;
+  outer.reserve(polygon.outer().size());
   for (const auto & point : polygon.outer()) {
     outer.push_back(Point2d(point));
   }
@@ -76,13 +660,14 @@ std::optional<Polygon2d> Polygon2d::create(
     if (inner.empty()) {
       continue;
     }
+    _inner.reserve(inner.size());
     for (const auto & point : inner) {
       _inner.push_back(Point2d(point));
     }
-    inners.push_back(_inner);
+    inners.push_back(std::move(_inner));
   }
 
-  return Polygon2d::create(outer, inners);
+  return Polygon2d::create(std::move(outer), std::move(inners));
 }
 
 autoware_utils_geometry::Polygon2d Polygon2d::to_boost() const
@@ -140,24 +725,35 @@ std::optional<ConvexPolygon2d> ConvexPolygon2d::create(
   const autoware_utils_geometry::Polygon2d & polygon) noexcept
 {
   PointList2d vertices;
+  vertices.reserve(polygon.outer().size());
   for (const auto & point : polygon.outer()) {
     vertices.push_back(Point2d(point));
   }
 
-  return ConvexPolygon2d::create(vertices);
+  return ConvexPolygon2d::create(std::move(vertices));
 }
-}  // namespace alt
 
-double area(const alt::ConvexPolygon2d & poly)
+std::optional<std::size_t> correct_convex_ring(
+  Point2d * vertices, const std::size_t size, const std::size_t capacity) noexcept
 {
-  const auto & vertices = poly.vertices();
+  return correct_convex_ring_impl(vertices, size, capacity);
+}
 
-  double area = 0.;
-  for (auto it = std::next(vertices.cbegin()); it != std::prev(vertices.cend(), 2); ++it) {
-    area += (*std::next(it) - vertices.front()).cross(*it - vertices.front()) / 2;
-  }
+std::optional<std::size_t> correct_convex_ring(
+  Point2f * vertices, const std::size_t size, const std::size_t capacity) noexcept
+{
+  return correct_convex_ring_impl(vertices, size, capacity);
+}
+}  // namespace alt
 
-  return area;
+double area(const alt::ConvexPolygon2dView & poly)
+{
+  return area_impl(poly);
+}
+
+float area(const alt::ConvexPolygon2fView & poly)
+{
+  return area_impl(poly);
 }
 
 std::optional<alt::ConvexPolygon2d> convex_hull(const alt::Points2d & points)
@@ -210,19 +806,85 @@ std::optional<alt::ConvexPolygon2d> convex_hull(const alt::Points2d & points)
         below_points.push_back(point);
       }
     }
-
-    vertices.push_back(p_min);
-    make_hull(make_hull, p_min, p_max, above_points);
-    vertices.push_back(p_max);
-    make_hull(make_hull, p_max, p_min, below_points);
+
+    vertices.push_back(p_min);
+    make_hull(make_hull, p_min, p_max, above_points);
+    vertices.push_back(p_max);
+    make_hull(make_hull, p_max, p_min, below_points);
+  }
+
+  auto hull = alt::ConvexPolygon2d::create(std::move(vertices));
+  if (!hull) {
+    return std::nullopt;
+  }
+
+  return hull;
+}
+
+bool convex_hull(alt::Points2d & points, alt::PointList2d & hull, const bool points_sorted)
+{
+  // below this size, the filter costs more than the sort it saves
+  constexpr std::size_t filter_min_size = 64;
+
+  hull.clear();
+  if (points.size() < 3) {
+    return false;
+  }
+
+  // Akl-Toussaint heuristic, the removal keeps the order of the remaining points
+  if (filter_min_size <= points.size()) {
+    const auto [min_x, max_x] = std::minmax_element(
+      points.begin(), points.end(), [](const auto & a, const auto & b) { return a.x() < b.x(); });
+    const auto [min_y, max_y] = std::minmax_element(
+      points.begin(), points.end(), [](const auto & a, const auto & b) { return a.y() < b.y(); });
+    const std::array<alt::Point2d, 4> quad{*min_x, *min_y, *max_x, *max_y};  // counter-clockwise
+    const auto is_strictly_inside = [&quad](const alt::Point2d & p) {
+      for (std::size_t i = 0; i < quad.size(); ++i) {
+        const auto & a = quad[i];
+        const auto & b = quad[(i + 1) % quad.size()];
+        if ((b - a).cross(p - a) <= 0.0) {
+          return false;
+        }
+      }
+      return true;
+    };
+    points.erase(std::remove_if(points.begin(), points.end(), is_strictly_inside), points.end());
+  }
+
+  if (!points_sorted) {
+    std::sort(points.begin(), points.end(), [](const auto & a, const auto & b) {
+      return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+    });
+  }
+
+  // Andrew's monotone chain, the lower and then the upper hull in counter-clockwise order
+  hull.reserve(points.size() + 1);
+  const auto add_point = [&hull](const alt::Point2d & p, const std::size_t min_size) {
+    while (min_size < hull.size()) {
+      const auto & a = hull[hull.size() - 2];
+      if (0.0 < (hull.back() - a).cross(p - a)) {
+        break;
+      }
+      hull.pop_back();
+    }
+    hull.push_back(p);
+  };
+  for (const auto & p : points) {
+    add_point(p, 1);
   }
+  const std::size_t lower_size = hull.size();
+  for (auto it = std::next(points.rbegin()); it != points.rend(); ++it) {
+    add_point(*it, lower_size);
+  }
+  // the last point is the first one, which closes the ring
 
-  auto hull = alt::ConvexPolygon2d::create(vertices);
-  if (!hull) {
-    return std::nullopt;
+  if (hull.size() < 4) {
+    hull.clear();
+    return false;
   }
 
-  return hull;
+  std::reverse(hull.begin(), hull.end());  // clockwise
+  return true;
 }
 
 void correct(alt::Polygon2d & poly)
@@ -249,68 +911,38 @@ void correct(alt::Polygon2d & poly)
   }
 }
 
-bool covered_by(const alt::Point2d & point, const alt::ConvexPolygon2d & poly)
+bool covered_by(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly)
 {
-  constexpr double epsilon = 1e-6;
-
-  const auto & vertices = poly.vertices();
-  std::size_t winding_number = 0;
-
-  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
-    vertices.begin(), std::prev(vertices.end()),
-    [](const auto & a, const auto & b) { return a.y() < b.y(); });
-  if (point.y() < y_min_vertex->y() || point.y() > y_max_vertex->y()) {
-    return false;
-  }
-
-  for (auto it = vertices.cbegin(); it != std::prev(vertices.cend()); ++it) {
-    const auto & p1 = *it;
-    const auto & p2 = *std::next(it);
-
-    const auto is_upward_edge = p1.y() <= point.y() && p2.y() >= point.y();
-    const auto is_downward_edge = p1.y() >= point.y() && p2.y() <= point.y();
-
-    if (!is_upward_edge && !is_downward_edge) {
-      continue;
-    }
-
-    const auto start_vec = point - p1;
-    const auto end_vec = point - p2;
-    const auto cross = start_vec.cross(end_vec);
-
-    if (is_upward_edge && cross > 0) {  // point is to the left of edge
-      winding_number++;
-      continue;
-    } else if (is_downward_edge && cross < 0) {  // point is to the left of edge
-      winding_number--;
-      continue;
-    }
-
-    if (std::abs(cross) < epsilon && start_vec.dot(end_vec) <= 0.) {  // point is on edge
-      return true;
-    }
-  }
+  return covered_by_impl(point, poly);
+}
 
-  return winding_number != 0;
+bool covered_by(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly)
+{
+  return covered_by_impl(point, poly);
 }
 
-bool disjoint(const alt::ConvexPolygon2d & poly1, const alt::ConvexPolygon2d & poly2)
+void covered_by(
+  const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices)
 {
-  if (equals(poly1, poly2)) {
-    return false;
-  }
+  return covered_by_impl(points, poly, indices);
+}
 
-  if (intersects(poly1, poly2)) {
-    return false;
-  }
+void covered_by(
+  const alt::Points2f & points, const alt::ConvexPolygon2fView & poly,
+  std::vector<std::size_t> & indices)
+{
+  return covered_by_impl(points, poly, indices);
+}
 
-  for (const auto & vertex : poly1.vertices()) {
-    if (touches(vertex, poly2)) {
-      return false;
-    }
-  }
+bool disjoint(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
+{
+  return disjoint_impl(poly1, poly2);
+}
 
-  return true;
+bool disjoint(const alt::ConvexPolygon2fView & poly1, const alt::ConvexPolygon2fView & poly2)
+{
+  return disjoint_impl(poly1, poly2);
 }
 
 double distance(
@@ -333,16 +965,16 @@ double distance(
   }
 }
 
-double distance(const alt::Point2d & point, const alt::ConvexPolygon2d & poly)
+double distance(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly)
 {
   if (covered_by(point, poly)) {
     return 0.0;
   }
 
   // TODO(mitukou1109): Use plane sweep method to improve performance?
-  const auto & vertices = poly.vertices();
+  const auto & vertices = poly;
   double min_distance = std::numeric_limits<double>::max();
-  for (auto it = vertices.cbegin(); it != std::prev(vertices.cend()); ++it) {
+  for (auto it = vertices.begin(); it != std::prev(vertices.end()); ++it) {
     min_distance = std::min(min_distance, distance(point, *it, *std::next(it)));
   }
 
@@ -369,8 +1001,12 @@ std::optional<alt::ConvexPolygon2d> envelope(const alt::Polygon2d & poly)
 
 bool equals(const alt::Point2d & point1, const alt::Point2d & point2)
 {
-  constexpr double epsilon = 1e-3;
-  return std::abs(point1.x() - point2.x()) < epsilon && std::abs(point1.y() - point2.y()) < epsilon;
+  return equals_impl(point1, point2);
+}
+
+bool equals(const alt::Point2f & point1, const alt::Point2f & point2)
+{
+  return equals_impl(point1, point2);
 }
 
 bool equals(const alt::Polygon2d & poly1, const alt::Polygon2d & poly2)
@@ -401,6 +1037,37 @@ alt::Points2d::const_iterator find_farthest(
   });
 }
 
+std::optional<alt::ConvexPolygon2d> intersection(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
+{
+  if (poly1.size() < 4) {
+    return std::nullopt;
+  }
+  const auto origin = poly1.front();
+  alt::PointList2d clipped;
+  alt::PointList2d buffer;
+  clip_convex(poly1, poly2, origin, clipped, buffer);
+  if (clipped.empty()) {
+    return std::nullopt;
+  }
+  for (auto & vertex : clipped) {
+    vertex = vertex + origin;
+  }
+  return alt::ConvexPolygon2d::create(std::move(clipped));
+}
+
+double intersection_area(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
+{
+  if (poly1.size() < 4) {
+    return 0.0;
+  }
+  alt::PointList2d clipped;
+  alt::PointList2d buffer;
+  clip_convex(poly1, poly2, poly1.front(), clipped, buffer);
+  return open_ring_area(clipped);
+}
+
 bool intersects(
   const alt::Point2d & seg1_start, const alt::Point2d & seg1_end, const alt::Point2d & seg2_start,
   const alt::Point2d & seg2_end)
@@ -425,58 +1092,64 @@ bool intersects(
   return true;
 }
 
-bool intersects(const alt::ConvexPolygon2d & poly1, const alt::ConvexPolygon2d & poly2)
+bool intersects(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
 {
-  if (equals(poly1, poly2)) {
-    return true;
-  }
+  return intersects_impl(poly1, poly2);
+}
 
-  // GJK algorithm
+bool intersects(const alt::ConvexPolygon2fView & poly1, const alt::ConvexPolygon2fView & poly2)
+{
+  return intersects_impl(poly1, poly2);
+}
 
-  auto find_support_vector = [](
-                               const alt::ConvexPolygon2d & poly1,
-                               const alt::ConvexPolygon2d & poly2,
-                               const alt::Vector2d & direction) {
-    auto find_farthest_vertex =
-      [](const alt::ConvexPolygon2d & poly, const alt::Vector2d & direction) {
-        return std::max_element(
-          poly.vertices().begin(), std::prev(poly.vertices().end()),
-          [&](const auto & a, const auto & b) { return direction.dot(a) <= direction.dot(b); });
-      };
-    return *find_farthest_vertex(poly1, direction) - *find_farthest_vertex(poly2, -direction);
+double iou(const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
+{
+  return intersection_over_union(intersection_area(poly1, poly2), area(poly1), area(poly2));
+}
+
+void iou(
+  const std::vector<alt::ConvexPolygon2d> & polys1,
+  const std::vector<alt::ConvexPolygon2d> & polys2, std::vector<double> & ious)
+{
+  struct Bounds
+  {
+    double area;
+    alt::Point2d min;
+    alt::Point2d max;
+  };
+  const auto get_bounds = [](const alt::ConvexPolygon2d & poly) {
+    Bounds bounds{area(poly), poly.vertices().front(), poly.vertices().front()};
+    for (const auto & vertex : poly.vertices()) {
+      bounds.min = {std::min(bounds.min.x(), vertex.x()), std::min(bounds.min.y(), vertex.y())};
+      bounds.max = {std::max(bounds.max.x(), vertex.x()), std::max(bounds.max.y(), vertex.y())};
+    }
+    return bounds;
   };
 
-  alt::Vector2d direction = {1.0, 0.0};
-  auto a = find_support_vector(poly1, poly2, direction);
-  direction = -a;
-  auto b = find_support_vector(poly1, poly2, direction);
-  if (b.dot(direction) <= 0.0) {
-    return false;
+  ious.assign(polys1.size() * polys2.size(), 0.0);
+  std::vector<Bounds> bounds2;
+  bounds2.reserve(polys2.size());
+  for (const auto & poly2 : polys2) {
+    bounds2.push_back(get_bounds(poly2));
   }
 
-  direction = (b - a).vector_triple(-a, b - a);
-  while (true) {
-    auto c = find_support_vector(poly1, poly2, direction);
-    if (c.dot(direction) <= 0.0) {
-      return false;
-    }
-
-    auto n_ca = (b - c).vector_triple(a - c, a - c);
-    if (n_ca.dot(-c) > 0.0) {
-      b = c;
-      direction = n_ca;
-    } else {
-      auto n_cb = (a - c).vector_triple(b - c, b - c);
-      if (n_cb.dot(-c) > 0.0) {
-        a = c;
-        direction = n_cb;
-      } else {
-        break;
+  // the buffers keep their capacity across the pairs
+  alt::PointList2d clipped;
+  alt::PointList2d buffer;
+  for (std::size_t i = 0; i < polys1.size(); ++i) {
+    const auto bounds1 = get_bounds(polys1[i]);
+    for (std::size_t j = 0; j < polys2.size(); ++j) {
+      const auto & b2 = bounds2[j];
+      if (
+        b2.max.x() < bounds1.min.x() || bounds1.max.x() < b2.min.x() ||
+        b2.max.y() < bounds1.min.y() || bounds1.max.y() < b2.min.y()) {
+        continue;
       }
+      clip_convex(polys1[i], polys2[j], polys1[i].vertices().front(), clipped, buffer);
+      ious[i * polys2.size() + j] =
+        intersection_over_union(open_ring_area(clipped), bounds1.area, b2.area);
     }
   }
-
-  return true;
 }
 
 bool is_above(
@@ -487,35 +1160,55 @@ bool is_above(
 
 bool is_clockwise(const alt::PointList2d & vertices)
 {
-  double sum = 0.;
-  for (auto it = vertices.cbegin(); it != std::prev(vertices.cend()); ++it) {
-    sum += (std::next(it)->x() - it->x()) * (std::next(it)->y() + it->y());
-  }
-
-  return sum > 0;
+  return is_clockwise_ring(vertices.begin(), vertices.end());
 }
 
 bool is_convex(const alt::Polygon2d & poly)
 {
-  constexpr double epsilon = 1e-6;
-
   if (!poly.inners().empty()) {
     return false;
   }
 
-  const auto & outer = poly.outer();
+  return is_convex_ring(poly.outer().begin(), poly.outer().end());
+}
 
-  for (auto it = std::next(outer.cbegin()); it != std::prev(outer.cend()); ++it) {
-    const auto & p1 = *--it;
-    const auto & p2 = *it;
-    const auto & p3 = *++it;
+OrientedRectangle min_area_rectangle(const alt::ConvexPolygon2dView & poly)
+{
+  return min_enclosing_rectangle(
+    poly, [](const double length, const double width) { return length * width; });
+}
 
-    if ((p2 - p1).cross(p3 - p2) > epsilon) {
-      return false;
+OrientedRectangle min_width_rectangle(const alt::ConvexPolygon2dView & poly)
+{
+  return min_enclosing_rectangle(
+    poly, [](const double /*length*/, const double width) { return width; });
+}
+
+std::optional<alt::ConvexPolygon2d> minkowski_sum(
+  const alt::ConvexPolygon2dView & poly1, const alt::ConvexPolygon2dView & poly2)
+{
+  alt::PointList2d sum;
+  minkowski_sum_impl(poly1, poly2, sum);
+  return alt::ConvexPolygon2d::create(std::move(sum));
+}
+
+void minkowski_sum(
+  const std::vector<alt::ConvexPolygon2d> & polys, const alt::ConvexPolygon2dView & shape,
+  std::vector<alt::ConvexPolygon2d> & sums)
+{
+  if (polys.size() < sums.size()) {
+    sums.erase(sums.begin() + polys.size(), sums.end());
+  }
+  alt::PointList2d sum;
+  for (std::size_t i = 0; i < polys.size(); ++i) {
+    if (i < sums.size()) {
+      // the sum of two convex polygons is a valid polygon, so the vertices are written in place
+      minkowski_sum_impl(polys[i], shape, sums[i].vertices());
+      continue;
     }
+    minkowski_sum_impl(polys[i], shape, sum);
+    sums.push_back(alt::ConvexPolygon2d::create(sum).value());
   }
-
-  return true;
 }
 
 alt::PointList2d simplify(const alt::PointList2d & line, const double max_distance)
@@ -556,98 +1249,171 @@ alt::PointList2d simplify(const alt::PointList2d & line, const double max_distan
   return simplified;
 }
 
-bool touches(
-  const alt::Point2d & point, const alt::Point2d & seg_start, const alt::Point2d & seg_end)
+void simplify_douglas_peucker(
+  const alt::Point2d * points, const std::size_t size, const double max_distance,
+  std::vector<std::size_t> & kept_indices, SimplifyBuffer & buffer)
 {
-  constexpr double epsilon = 1e-6;
+  kept_indices.clear();
+  if (size == 0) {
+    return;
+  }
 
-  // if the cross product of the vectors from the start point and the end point to the point is 0
-  // and the vectors opposite each other, the point is on the segment
-  const auto start_vec = point - seg_start;
-  const auto end_vec = point - seg_end;
-  return std::abs(start_vec.cross(end_vec)) < epsilon && start_vec.dot(end_vec) <= 0;
+  // the stack holds the ends of the pending segments, which all start at the last kept point
+  auto & stack = buffer.stack;
+  stack.clear();
+  kept_indices.push_back(0);
+  if (1 < size) {
+    stack.push_back(size - 1);
+  }
+  while (!stack.empty()) {
+    const std::size_t start = kept_indices.back();
+    const std::size_t end = stack.back();
+
+    double max_segment_distance = -1.0;
+    std::size_t farthest = start;
+    for (std::size_t i = start + 1; i < end; ++i) {
+      const double d = distance(points[i], points[start], points[end]);
+      if (max_segment_distance < d) {
+        max_segment_distance = d;
+        farthest = i;
+      }
+    }
+
+    if (max_distance < max_segment_distance) {
+      stack.push_back(farthest);
+    } else {
+      kept_indices.push_back(end);
+      stack.pop_back();
+    }
+  }
 }
 
-bool touches(const alt::Point2d & point, const alt::ConvexPolygon2d & poly)
+void simplify_visvalingam(
+  const alt::Point2d * points, const std::size_t size, const double max_area,
+  const std::size_t max_points, std::vector<std::size_t> & kept_indices, SimplifyBuffer & buffer)
 {
-  const auto & vertices = poly.vertices();
+  kept_indices.clear();
+  if (size < 3) {
+    for (std::size_t i = 0; i < size; ++i) {
+      kept_indices.push_back(i);
+    }
+    return;
+  }
 
-  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
-    vertices.begin(), std::prev(vertices.end()),
-    [](const auto & a, const auto & b) { return a.y() < b.y(); });
-  if (point.y() < y_min_vertex->y() || point.y() > y_max_vertex->y()) {
-    return false;
+  auto & prev = buffer.prev;
+  auto & next = buffer.next;
+  auto & areas = buffer.areas;
+  auto & heap = buffer.heap;
+  prev.resize(size);
+  next.resize(size);
+  areas.resize(size);
+  heap.clear();
+
+  const auto triangle_area = [&](const std::size_t i) {
+    return std::abs((points[i] - points[prev[i]]).cross(points[next[i]] - points[prev[i]])) / 2;
+  };
+  // min heap, the stale entries whose area does not match areas are skipped when popped
+  const auto greater = std::greater<std::pair<double, std::size_t>>();
+
+  for (std::size_t i = 0; i < size; ++i) {
+    prev[i] = i == 0 ? 0 : i - 1;
+    next[i] = i + 1 == size ? i : i + 1;
   }
+  for (std::size_t i = 1; i + 1 < size; ++i) {
+    areas[i] = triangle_area(i);
+    heap.emplace_back(areas[i], i);
+  }
+  std::make_heap(heap.begin(), heap.end(), greater);
 
-  for (auto it = vertices.cbegin(); it != std::prev(vertices.cend()); ++it) {
-    // check if the point is on each edge of the polygon
-    if (touches(point, *it, *std::next(it))) {
-      return true;
+  std::size_t remaining = size;
+  while (!heap.empty()) {
+    const auto [area, i] = heap.front();
+    if (max_area <= area && remaining <= std::max<std::size_t>(max_points, 2)) {
+      break;
+    }
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    heap.pop_back();
+    if (area != areas[i]) {
+      continue;
+    }
+
+    // remove the point, the neighbors areas do not decrease so that the removal order is kept
+    areas[i] = -1.0;
+    --remaining;
+    next[prev[i]] = next[i];
+    prev[next[i]] = prev[i];
+    for (const auto neighbor : {prev[i], next[i]}) {
+      if (neighbor != 0 && neighbor + 1 != size) {
+        areas[neighbor] = std::max(triangle_area(neighbor), area);
+        heap.emplace_back(areas[neighbor], neighbor);
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
     }
   }
 
-  return false;
+  for (std::size_t i = 0; i + 1 < size; i = next[i]) {
+    kept_indices.push_back(i);
+  }
+  kept_indices.push_back(size - 1);
 }
 
-bool within(const alt::Point2d & point, const alt::ConvexPolygon2d & poly)
+bool touches(
+  const alt::Point2d & point, const alt::Point2d & seg_start, const alt::Point2d & seg_end)
 {
-  constexpr double epsilon = 1e-6;
-
-  const auto & vertices = poly.vertices();
-  int64_t winding_number = 0;
-
-  const auto [y_min_vertex, y_max_vertex] = std::minmax_element(
-    vertices.begin(), std::prev(vertices.end()),
-    [](const auto & a, const auto & b) { return a.y() < b.y(); });
-  if (point.y() <= y_min_vertex->y() || point.y() >= y_max_vertex->y()) {
-    return false;
-  }
+  return touches_impl(point, seg_start, seg_end);
+}
 
-  for (auto it = vertices.cbegin(); it != std::prev(vertices.cend()); ++it) {
-    const auto & p1 = *it;
-    const auto & p2 = *std::next(it);
+bool touches(
+  const alt::Point2f & point, const alt::Point2f & seg_start, const alt::Point2f & seg_end)
+{
+  return touches_impl(point, seg_start, seg_end);
+}
 
-    const auto is_upward_edge = p1.y() < point.y() && p2.y() > point.y();
-    const auto is_downward_edge = p1.y() > point.y() && p2.y() < point.y();
+bool touches(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly)
+{
+  return touches_impl(point, poly);
+}
 
-    if (!is_upward_edge && !is_downward_edge) {
-      continue;
-    }
+bool touches(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly)
+{
+  return touches_impl(point, poly);
+}
 
-    const auto start_vec = point - p1;
-    const auto end_vec = point - p2;
-    const auto cross = start_vec.cross(end_vec);
+bool within(const alt::Point2d & point, const alt::ConvexPolygon2dView & poly)
+{
+  return within_impl(point, poly);
+}
 
-    if (is_upward_edge && cross > 0) {  // point is to the left of edge
-      winding_number++;
-      continue;
-    } else if (is_downward_edge && cross < 0) {  // point is to the left of edge
-      winding_number--;
-      continue;
-    }
+bool within(const alt::Point2f & point, const alt::ConvexPolygon2fView & poly)
+{
+  return within_impl(point, poly);
+}
 
-    if (std::abs(cross) < epsilon && start_vec.dot(end_vec) <= 0.) {  // point is on edge
-      return false;
-    }
-  }
+void within(
+  const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices)
+{
+  return within_impl(points, poly, indices);
+}
 
-  return winding_number != 0;
+void within(
+  const alt::Points2f & points, const alt::ConvexPolygon2fView & poly,
+  std::vector<std::size_t> & indices)
+{
+  return within_impl(points, poly, indices);
 }
 
 bool within(
-  const alt::ConvexPolygon2d & poly_contained, const alt::ConvexPolygon2d & poly_containing)
+  const alt::ConvexPolygon2dView & poly_contained,
+  const alt::ConvexPolygon2dView & poly_containing)
 {
-  if (equals(poly_contained, poly_containing)) {
-    return true;
-  }
-
-  // check if all points of poly_contained are within poly_containing
-  for (const auto & vertex : poly_contained.vertices()) {
-    if (!within(vertex, poly_containing)) {
-      return false;
-    }
-  }
+  return within_impl(poly_contained, poly_containing);
+}
 
-  return true;
+bool within(
+  const alt::ConvexPolygon2fView & poly_contained,
+  const alt::ConvexPolygon2fView & poly_containing)
+{
+  return within_impl(poly_contained, poly_containing);
 }
 }  // namespace autoware_utils_geometry
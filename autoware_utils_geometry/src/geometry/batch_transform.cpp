@@ -0,0 +1,104 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/batch_transform.hpp"
+
+#include <cmath>
+
+namespace autoware_utils_geometry
+{
+
+void PoseArraySoA::resize(const std::size_t size, const bool with_orientation)
+{
+  x.resize(size);
+  y.resize(size);
+  z.resize(size);
+  if (with_orientation) {
+    qx.resize(size);
+    qy.resize(size);
+    qz.resize(size);
+    qw.resize(size);
+  }
+}
+
+namespace
+{
+// The loops below only read locals, so the compiler can keep them in registers and vectorize.
+void rotate_and_translate(
+  const RigidTransform3d & transform, const std::size_t size, double * x, double * y, double * z)
+{
+  const auto & r = transform.rotation();
+  const auto & t = transform.translation();
+  const double r00 = r(0, 0), r01 = r(0, 1), r02 = r(0, 2);
+  const double r10 = r(1, 0), r11 = r(1, 1), r12 = r(1, 2);
+  const double r20 = r(2, 0), r21 = r(2, 1), r22 = r(2, 2);
+  const double tx = t.x(), ty = t.y(), tz = t.z();
+  for (std::size_t i = 0; i < size; ++i) {
+    const double px = x[i];
+    const double py = y[i];
+    const double pz = z[i];
+    x[i] = r00 * px + r01 * py + r02 * pz + tx;
+    y[i] = r10 * px + r11 * py + r12 * pz + ty;
+    z[i] = r20 * px + r21 * py + r22 * pz + tz;
+  }
+}
+
+// Hamilton product q_t * q_i followed by normalization.
+void rotate_orientations(
+  const RigidTransform3d & transform, const std::size_t size, double * qx, double * qy,
+  double * qz, double * qw)
+{
+  const auto & q = transform.quaternion();
+  const double ax = q.x(), ay = q.y(), az = q.z(), aw = q.w();
+  for (std::size_t i = 0; i < size; ++i) {
+    const double bx = qx[i];
+    const double by = qy[i];
+    const double bz = qz[i];
+    const double bw = qw[i];
+    const double x = aw * bx + ax * bw + ay * bz - az * by;
+    const double y = aw * by - ax * bz + ay * bw + az * bx;
+    const double z = aw * bz + ax * by - ay * bx + az * bw;
+    const double w = aw * bw - ax * bx - ay * by - az * bz;
+    const double inv_norm = 1.0 / std::sqrt(x * x + y * y + z * z + w * w);
+    qx[i] = x * inv_norm;
+    qy[i] = y * inv_norm;
+    qz[i] = z * inv_norm;
+    qw[i] = w * inv_norm;
+  }
+}
+}  // namespace
+
+void transform_positions(PoseArraySoA & soa, const RigidTransform3d & transform)
+{
+  rotate_and_translate(transform, soa.size(), soa.x.data(), soa.y.data(), soa.z.data());
+}
+
+void transform_positions(PoseArraySoA & soa, const geometry_msgs::msg::Transform & transform)
+{
+  transform_positions(soa, RigidTransform3d(transform));
+}
+
+void transform_poses(PoseArraySoA & soa, const RigidTransform3d & transform)
+{
+  rotate_and_translate(transform, soa.size(), soa.x.data(), soa.y.data(), soa.z.data());
+  rotate_orientations(
+    transform, soa.size(), soa.qx.data(), soa.qy.data(), soa.qz.data(), soa.qw.data());
+}
+
+void transform_poses(PoseArraySoA & soa, const geometry_msgs::msg::Transform & transform)
+{
+  transform_poses(soa, RigidTransform3d(transform));
+}
+
+}  // namespace autoware_utils_geometry
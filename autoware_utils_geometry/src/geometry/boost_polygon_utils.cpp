@@ -14,15 +14,25 @@
 
 #include "autoware_utils_geometry/boost_polygon_utils.hpp"
 
+#include "autoware_utils_geometry/alt_geometry.hpp"
 #include "autoware_utils_geometry/geometry.hpp"
 
+#include <autoware_utils_system/thread_pool.hpp>
 #include <tf2/utils.hpp>
 
 #include <boost/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 namespace
 {
 namespace bg = boost::geometry;
+using autoware_utils_geometry::PlainPoint2d;
 using autoware_utils_geometry::Point2d;
 using autoware_utils_geometry::Polygon2d;
 
@@ -46,15 +56,20 @@ void append_point_to_polygon(Polygon2d & polygon, const Point2d & point)
  */
 double get_polygon_area(const geometry_msgs::msg::Polygon & footprint)
 {
-  double area = 0.0;
+  const auto & points = footprint.points;
+  if (points.empty()) {
+    return 0.0;
+  }
 
-  for (size_t i = 0; i < footprint.points.size(); ++i) {
-    size_t j = (i + 1) % footprint.points.size();
-    area += 0.5 * (footprint.points.at(i).x * footprint.points.at(j).y -
-                   footprint.points.at(j).x * footprint.points.at(i).y);
+  // shoelace formula on the message points, the last edge closes the ring
+  double sum = 0.0;
+  const auto * prev = &points.back();
+  for (const auto & point : points) {
+    sum += static_cast<double>(prev->x) * point.y - static_cast<double>(point.x) * prev->y;
+    prev = &point;
   }
 
-  return area;
+  return 0.5 * sum;
 }
 
 double get_rectangle_area(const geometry_msgs::msg::Vector3 & dimensions)
@@ -66,6 +81,201 @@ double get_circle_area(const geometry_msgs::msg::Vector3 & dimensions)
 {
   return static_cast<double>((dimensions.x / 2.0) * (dimensions.x / 2.0) * M_PI);
 }
+
+/// @brief stats of a shape in the object frame, with the same area as get_area()
+autoware_utils_geometry::ShapeStats get_local_shape_stats(
+  const autoware_perception_msgs::msg::Shape & shape)
+{
+  autoware_utils_geometry::ShapeStats stats;
+  if (shape.type == autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    stats.area = get_rectangle_area(shape.dimensions);
+    stats.perimeter = 2.0 * (shape.dimensions.x + shape.dimensions.y);
+  } else if (shape.type == autoware_perception_msgs::msg::Shape::CYLINDER) {
+    stats.area = get_circle_area(shape.dimensions);
+    stats.perimeter = M_PI * shape.dimensions.x;
+  } else if (shape.type == autoware_perception_msgs::msg::Shape::POLYGON) {
+    // area, perimeter and centroid in the same pass over the edges
+    const auto & points = shape.footprint.points;
+    if (points.empty()) {
+      return stats;
+    }
+    double sum = 0.0;
+    double cx = 0.0;
+    double cy = 0.0;
+    double mean_x = 0.0;
+    double mean_y = 0.0;
+    const auto * prev = &points.back();
+    for (const auto & point : points) {
+      const double x1 = prev->x;
+      const double y1 = prev->y;
+      const double x2 = point.x;
+      const double y2 = point.y;
+      const double cross = x1 * y2 - x2 * y1;
+      sum += cross;
+      cx += (x1 + x2) * cross;
+      cy += (y1 + y2) * cross;
+      mean_x += x2;
+      mean_y += y2;
+      stats.perimeter += std::hypot(x2 - x1, y2 - y1);
+      prev = &point;
+    }
+    stats.area = 0.5 * sum;
+    const double num_points = static_cast<double>(points.size());
+    stats.centroid = sum == 0.0
+                       ? autoware_utils_geometry::Point2d(mean_x / num_points, mean_y / num_points)
+                       : autoware_utils_geometry::Point2d(cx / (3.0 * sum), cy / (3.0 * sum));
+  } else {
+    throw std::logic_error("The shape type is not supported in autoware_utils.");
+  }
+  return stats;
+}
+
+template <class Objects, class GetPose>
+void objects_to_shape_stats(
+  const Objects & objects, std::vector<autoware_utils_geometry::ShapeStats> & stats,
+  const GetPose & get_pose)
+{
+  stats.resize(objects.objects.size());
+  for (std::size_t i = 0; i < objects.objects.size(); ++i) {
+    const auto & object = objects.objects[i];
+    const auto & pose = get_pose(object);
+    auto & object_stats = stats[i];
+    object_stats = get_local_shape_stats(object.shape);
+
+    // the centroid of the boxes and cylinders is the position, no need of the yaw
+    const auto & local = object_stats.centroid;
+    if (local.x() == 0.0 && local.y() == 0.0) {
+      object_stats.centroid = autoware_utils_geometry::Point2d(pose.position.x, pose.position.y);
+      continue;
+    }
+    const double yaw = tf2::getYaw(pose.orientation);
+    const double cos = std::cos(yaw);
+    const double sin = std::sin(yaw);
+    object_stats.centroid = autoware_utils_geometry::Point2d(
+      pose.position.x + cos * local.x() - sin * local.y(),
+      pose.position.y + sin * local.x() + cos * local.y());
+  }
+}
+
+constexpr int circle_discrete_num = 6;
+constexpr std::size_t min_objects_per_thread = 100;
+constexpr std::size_t min_parallel_objects = 200;
+
+/// @brief number of points of the closed ring of to_polygon2d()
+std::size_t count_ring_points(const autoware_perception_msgs::msg::Shape & shape)
+{
+  if (shape.type == autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    return 5;
+  } else if (shape.type == autoware_perception_msgs::msg::Shape::CYLINDER) {
+    return circle_discrete_num + 1;
+  } else if (shape.type == autoware_perception_msgs::msg::Shape::POLYGON) {
+    return shape.footprint.points.empty() ? 0 : shape.footprint.points.size() + 1;
+  }
+  throw std::logic_error("The shape type is not supported in autoware_utils.");
+}
+
+/// @brief same as to_polygon2d() but writing the ring in place
+void write_ring(
+  const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape,
+  PlainPoint2d * ring, const std::size_t ring_size)
+{
+  if (ring_size == 0) {
+    return;
+  }
+  const auto & position = pose.position;
+
+  if (shape.type == autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    // first 2 columns of the rotation matrix, normalized in the same way as calc_offset_pose
+    const auto & q = pose.orientation;
+    const double norm = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    const double qx = q.x / norm;
+    const double qy = q.y / norm;
+    const double qz = q.z / norm;
+    const double qw = q.w / norm;
+    const double r00 = 1.0 - 2.0 * (qy * qy + qz * qz);
+    const double r01 = 2.0 * (qx * qy - qz * qw);
+    const double r10 = 2.0 * (qx * qy + qz * qw);
+    const double r11 = 1.0 - 2.0 * (qx * qx + qz * qz);
+
+    const double half_length = shape.dimensions.x / 2.0;
+    const double half_width = shape.dimensions.y / 2.0;
+    const std::array<std::pair<double, double>, 4> corners{
+      {{half_length, half_width},
+       {-half_length, half_width},
+       {-half_length, -half_width},
+       {half_length, -half_width}}};
+    for (std::size_t i = 0; i < 4; ++i) {
+      const auto [x, y] = corners[i];
+      ring[i] = PlainPoint2d{position.x + r00 * x + r01 * y, position.y + r10 * x + r11 * y};
+    }
+  } else if (shape.type == autoware_perception_msgs::msg::Shape::CYLINDER) {
+    const double radius = shape.dimensions.x / 2.0;
+    for (int i = 0; i < circle_discrete_num; ++i) {
+      const double angle =
+        (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
+        M_PI / static_cast<double>(circle_discrete_num);
+      ring[i] =
+        PlainPoint2d{std::cos(angle) * radius + position.x, std::sin(angle) * radius + position.y};
+    }
+  } else {
+    const double yaw = tf2::getYaw(pose.orientation);
+    const double cos = std::cos(yaw);
+    const double sin = std::sin(yaw);
+    for (std::size_t i = 0; i + 1 < ring_size; ++i) {
+      // not rounded to float as the rotated geometry_msgs::msg::Polygon of to_polygon2d()
+      const auto & point = shape.footprint.points[i];
+      ring[i] = PlainPoint2d{
+        position.x + (cos * point.x - sin * point.y), position.y + (sin * point.x + cos * point.y)};
+    }
+  }
+  ring[ring_size - 1] = ring[0];
+
+  // same orientation test as is_clockwise()
+  double sum = 0.0;
+  for (std::size_t i = 0; i < ring_size; ++i) {
+    const auto & p1 = ring[i];
+    const auto & p2 = ring[(i + 1) % ring_size];
+    sum += (p1.x - ring[0].x) * (p2.y - ring[0].y) - (p1.y - ring[0].y) * (p2.x - ring[0].x);
+  }
+  if (sum >= 0.0) {
+    std::reverse(ring, ring + ring_size);
+  }
+}
+
+template <class Objects, class GetPose>
+void objects_to_polygons(
+  const Objects & objects, autoware_utils_geometry::PolygonArray2d & polygons,
+  const std::size_t num_threads, const GetPose & get_pose)
+{
+  const std::size_t num_objects = objects.objects.size();
+  polygons.offsets.resize(num_objects + 1);
+  polygons.offsets.front() = 0;
+  for (std::size_t i = 0; i < num_objects; ++i) {
+    polygons.offsets[i + 1] = polygons.offsets[i] + count_ring_points(objects.objects[i].shape);
+  }
+  polygons.points.resize(polygons.offsets.back());
+
+  // the rings are disjoint ranges of the points, so the objects can be split between threads
+  const auto convert = [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const auto & object = objects.objects[i];
+      write_ring(
+        get_pose(object), object.shape, polygons.points.data() + polygons.offsets[i],
+        polygons.offsets[i + 1] - polygons.offsets[i]);
+    }
+  };
+
+  const std::size_t threads =
+    num_objects < min_parallel_objects
+      ? 1
+      : std::min(num_threads, (num_objects + min_objects_per_thread - 1) / min_objects_per_thread);
+  if (threads <= 1) {
+    convert(0, num_objects);
+    return;
+  }
+  const std::size_t chunk = (num_objects + threads - 1) / threads;
+  autoware_utils_system::ThreadPool::shared().parallel_for(0, num_objects, chunk, convert);
+}
 }  // namespace
 
 namespace autoware_utils_geometry
@@ -200,6 +410,104 @@ autoware_utils_geometry::Polygon2d to_polygon2d(
     object.kinematics.initial_pose_with_covariance.pose, object.shape);
 }
 
+Polygon2d PolygonArray2d::polygon(const std::size_t i) const
+{
+  Polygon2d polygon;
+  polygon.outer().reserve(offsets[i + 1] - offsets[i]);
+  for (const auto * point = ring_begin(i); point != ring_end(i); ++point) {
+    polygon.outer().push_back(from_plain(*point));
+  }
+  return polygon;
+}
+
+void PolygonArray2d::polygon(const std::size_t i, PlainPolygon2d & polygon) const
+{
+  polygon.inners().clear();
+  polygon.outer().assign(ring_begin(i), ring_end(i));
+}
+
+void to_polygon2d(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads)
+{
+  objects_to_polygons(objects, polygons, num_threads, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.pose;
+  });
+}
+
+void to_polygon2d(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads)
+{
+  objects_to_polygons(objects, polygons, num_threads, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.pose;
+  });
+}
+
+void to_polygon2d(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, PolygonArray2d & polygons,
+  const std::size_t num_threads)
+{
+  objects_to_polygons(objects, polygons, num_threads, [](const auto & object) -> const auto & {
+    return object.kinematics.initial_pose_with_covariance.pose;
+  });
+}
+
+void to_swept_footprint(
+  const autoware_perception_msgs::msg::PredictedObject & object,
+  const autoware_perception_msgs::msg::PredictedPath & path, SweptFootprint & swept,
+  const bool with_segment_hulls)
+{
+  const auto local_polygon = to_polygon2d(geometry_msgs::msg::Pose{}, object.shape);
+  const auto & local_ring = local_polygon.outer();
+  const double time_step =
+    static_cast<double>(path.time_step.sec) + static_cast<double>(path.time_step.nanosec) * 1e-9;
+
+  const std::size_t num_poses = path.path.size();
+  swept.times.resize(num_poses);
+  swept.footprints.resize(num_poses);
+  for (std::size_t i = 0; i < num_poses; ++i) {
+    const auto & pose = path.path[i];
+    const double yaw = tf2::getYaw(pose.orientation);
+    const double cos = std::cos(yaw);
+    const double sin = std::sin(yaw);
+
+    swept.times[i] = static_cast<double>(i) * time_step;
+    auto & ring = swept.footprints[i].outer();
+    ring.resize(local_ring.size());
+    for (std::size_t j = 0; j < local_ring.size(); ++j) {
+      const auto & p = local_ring[j];
+      ring[j] = Point2d(
+        pose.position.x + cos * p.x() - sin * p.y(), pose.position.y + sin * p.x() + cos * p.y());
+    }
+  }
+
+  if (!with_segment_hulls || num_poses < 2) {
+    swept.segment_hulls.clear();
+    return;
+  }
+  swept.segment_hulls.resize(num_poses - 1);
+  alt::Points2d points;
+  alt::PointList2d hull;
+  for (std::size_t i = 0; i + 1 < num_poses; ++i) {
+    // the closing points are skipped
+    points.clear();
+    for (const auto k : {i, i + 1}) {
+      const auto & ring = swept.footprints[k].outer();
+      for (std::size_t j = 0; j + 1 < ring.size(); ++j) {
+        points.emplace_back(ring[j]);
+      }
+    }
+    auto & hull_ring = swept.segment_hulls[i].outer();
+    hull_ring.clear();
+    if (convex_hull(points, hull)) {
+      for (const auto & p : hull) {
+        hull_ring.emplace_back(p.x(), p.y());
+      }
+    }
+  }
+}
+
 Polygon2d to_footprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width)
@@ -233,6 +541,35 @@ double get_area(const autoware_perception_msgs::msg::Shape & shape)
   throw std::logic_error("The shape type is not supported in autoware_utils.");
 }
 
+ShapeStats get_shape_stats(const autoware_perception_msgs::msg::Shape & shape)
+{
+  return get_local_shape_stats(shape);
+}
+
+void get_shape_stats(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, std::vector<ShapeStats> & stats)
+{
+  objects_to_shape_stats(objects, stats, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.pose;
+  });
+}
+
+void get_shape_stats(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, std::vector<ShapeStats> & stats)
+{
+  objects_to_shape_stats(objects, stats, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.pose;
+  });
+}
+
+void get_shape_stats(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, std::vector<ShapeStats> & stats)
+{
+  objects_to_shape_stats(objects, stats, [](const auto & object) -> const auto & {
+    return object.kinematics.initial_pose_with_covariance.pose;
+  });
+}
+
 // NOTE: The number of vertices on the expanded polygon by boost::geometry::buffer
 //       is larger than the original one.
 //       This function fixes the issue.
@@ -265,4 +602,84 @@ Polygon2d expand_polygon(const Polygon2d & input_polygon, const double offset)
   boost::geometry::correct(expanded_polygon);
   return expanded_polygon;
 }
+
+void expand_convex_polygon(
+  const Polygon2d & convex_polygon, const double offset, Polygon2d & expanded_polygon,
+  const ExpandJoin join, const size_t points_per_circle)
+{
+  auto & expanded_ring = expanded_polygon.outer();
+  expanded_ring.clear();
+  expanded_polygon.inners().clear();
+
+  const auto & ring = convex_polygon.outer();
+  size_t num_points = ring.size();
+  const bool closed = num_points > 1 && ring.front().x() == ring.back().x() &&
+                      ring.front().y() == ring.back().y();
+  if (closed) {
+    --num_points;
+  }
+  if (num_points < 3) {
+    return;
+  }
+
+  // the points equal to the next one are skipped, as their edge has no normal
+  const auto is_duplicate = [&](const size_t i) {
+    const auto & p1 = ring[i];
+    const auto & p2 = ring[(i + 1) % num_points];
+    return p1.x() == p2.x() && p1.y() == p2.y();
+  };
+  size_t num_vertices = 0;
+  size_t last_vertex = 0;
+  for (size_t i = 0; i < num_points; ++i) {
+    if (!is_duplicate(i)) {
+      ++num_vertices;
+      last_vertex = i;
+    }
+  }
+  if (num_vertices < 3) {
+    return;
+  }
+
+  // outward unit normal of the edge from the i-th point, on the left of the clockwise ring
+  const auto normal = [&](const size_t i) {
+    const auto & p1 = ring[i];
+    const auto & p2 = ring[(i + 1) % num_points];
+    const double dx = p2.x() - p1.x();
+    const double dy = p2.y() - p1.y();
+    const double length = std::hypot(dx, dy);
+    return std::make_pair(-dy / length, dx / length);
+  };
+
+  const double max_step_angle =
+    2.0 * M_PI / static_cast<double>(std::max<size_t>(points_per_circle, 3));
+  auto [prev_nx, prev_ny] = normal(last_vertex);
+  for (size_t i = 0; i < num_points; ++i) {
+    if (is_duplicate(i)) {
+      continue;
+    }
+    const auto & p = ring[i];
+    const auto [nx, ny] = normal(i);
+    const double cos_angle = prev_nx * nx + prev_ny * ny;
+
+    if (join == ExpandJoin::mitre || offset == 0.0) {
+      const double scale = offset / (1.0 + cos_angle);
+      expanded_ring.emplace_back(p.x() + (prev_nx + nx) * scale, p.y() + (prev_ny + ny) * scale);
+    } else {
+      // rotate the normal of the previous edge to the normal of the next one
+      const double angle = std::atan2(prev_nx * ny - prev_ny * nx, cos_angle);
+      const size_t steps = static_cast<size_t>(std::ceil(std::abs(angle) / max_step_angle));
+      for (size_t k = 0; k <= steps; ++k) {
+        const double a = steps == 0 ? 0.0 : angle * static_cast<double>(k) / steps;
+        const double c = std::cos(a);
+        const double s = std::sin(a);
+        expanded_ring.emplace_back(
+          p.x() + offset * (prev_nx * c - prev_ny * s),
+          p.y() + offset * (prev_nx * s + prev_ny * c));
+      }
+    }
+    prev_nx = nx;
+    prev_ny = ny;
+  }
+  expanded_ring.push_back(expanded_ring.front());
+}
 }  // namespace autoware_utils_geometry
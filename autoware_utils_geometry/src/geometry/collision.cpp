@@ -0,0 +1,264 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/collision.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+struct Box
+{
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+};
+
+std::vector<Box> to_boxes(const std::vector<alt::ConvexPolygon2dView> & polygons)
+{
+  std::vector<Box> boxes;
+  boxes.reserve(polygons.size());
+  for (const auto & poly : polygons) {
+    Box box{poly.front().x(), poly.front().y(), poly.front().x(), poly.front().y()};
+    for (const auto & vertex : poly) {
+      box.min_x = std::min(box.min_x, vertex.x());
+      box.min_y = std::min(box.min_y, vertex.y());
+      box.max_x = std::max(box.max_x, vertex.x());
+      box.max_y = std::max(box.max_y, vertex.y());
+    }
+    boxes.push_back(box);
+  }
+  return boxes;
+}
+
+std::vector<std::size_t> sort_by_min_x(const std::vector<Box> & boxes)
+{
+  std::vector<std::size_t> order(boxes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](const auto a, const auto b) {
+    return boxes[a].min_x < boxes[b].min_x;
+  });
+  return order;
+}
+
+// Sweep and prune: return the pairs whose boxes overlap, sorted by index1 and then index2.
+std::vector<CollisionPair> find_candidates(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2)
+{
+  std::vector<CollisionPair> candidates;
+  if (polygons1.empty() || polygons2.empty()) {
+    return candidates;
+  }
+
+  const auto boxes1 = to_boxes(polygons1);
+  const auto boxes2 = to_boxes(polygons2);
+  const auto order1 = sort_by_min_x(boxes1);
+  const auto order2 = sort_by_min_x(boxes2);
+
+  // the boxes that the sweep line has entered and may not have left yet
+  std::vector<std::size_t> active1;
+  std::vector<std::size_t> active2;
+
+  const auto overlaps_y = [](const Box & a, const Box & b) {
+    return a.min_y <= b.max_y && b.min_y <= a.max_y;
+  };
+  const auto prune = [](std::vector<std::size_t> & active, const std::vector<Box> & boxes,
+                        const double x) {
+    active.erase(
+      std::remove_if(
+        active.begin(), active.end(), [&](const auto i) { return boxes[i].max_x < x; }),
+      active.end());
+  };
+
+  std::size_t next1 = 0;
+  std::size_t next2 = 0;
+  while (next1 < order1.size() || next2 < order2.size()) {
+    const bool from1 = next2 == order2.size() ||
+                       (next1 < order1.size() &&
+                        boxes1[order1[next1]].min_x <= boxes2[order2[next2]].min_x);
+    if (from1) {
+      const auto i = order1[next1++];
+      const auto & box = boxes1[i];
+      prune(active2, boxes2, box.min_x);
+      for (const auto j : active2) {
+        if (overlaps_y(box, boxes2[j])) {
+          candidates.push_back({i, j});
+        }
+      }
+      active1.push_back(i);
+    } else {
+      const auto j = order2[next2++];
+      const auto & box = boxes2[j];
+      prune(active1, boxes1, box.min_x);
+      for (const auto i : active1) {
+        if (overlaps_y(box, boxes1[i])) {
+          candidates.push_back({i, j});
+        }
+      }
+      active2.push_back(j);
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return std::tie(a.index1, a.index2) < std::tie(b.index1, b.index2);
+  });
+  return candidates;
+}
+
+Box merge(const Box & a, const Box & b)
+{
+  return {
+    std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y), std::max(a.max_x, b.max_x),
+    std::max(a.max_y, b.max_y)};
+}
+
+bool overlaps(const Box & a, const Box & b)
+{
+  return a.min_x <= b.max_x && b.min_x <= a.max_x && a.min_y <= b.max_y && b.min_y <= a.max_y;
+}
+
+// Depth first search of the hierarchy of the footprint boxes, from the first footprint.
+class PathCollisionSearch
+{
+public:
+  PathCollisionSearch(
+    const std::vector<alt::ConvexPolygon2dView> & footprints,
+    const std::vector<alt::ConvexPolygon2dView> & objects)
+  : footprints_(footprints), objects_(objects), object_boxes_(to_boxes(objects))
+  {
+    // levels_[k + 1][i] merges levels_[k][2 * i] and levels_[k][2 * i + 1]
+    levels_.push_back(to_boxes(footprints));
+    while (levels_.back().size() > 1) {
+      const auto & lower = levels_.back();
+      std::vector<Box> upper((lower.size() + 1) / 2);
+      for (std::size_t i = 0; i < upper.size(); ++i) {
+        upper[i] = 2 * i + 1 < lower.size() ? merge(lower[2 * i], lower[2 * i + 1]) : lower[2 * i];
+      }
+      levels_.push_back(std::move(upper));
+    }
+    // the objects overlapping the current node of each level, all of them above the root
+    candidates_.resize(levels_.size() + 1);
+    candidates_.back().resize(objects.size());
+    std::iota(candidates_.back().begin(), candidates_.back().end(), 0);
+  }
+
+  std::optional<CollisionPair> search() { return search(levels_.size() - 1, 0); }
+
+private:
+  std::optional<CollisionPair> search(const std::size_t level, const std::size_t index)
+  {
+    const auto & box = levels_[level][index];
+    auto & candidates = candidates_[level];
+    candidates.clear();
+    for (const auto j : candidates_[level + 1]) {
+      if (overlaps(box, object_boxes_[j])) {
+        candidates.push_back(j);
+      }
+    }
+    if (candidates.empty()) {
+      return std::nullopt;
+    }
+    if (level == 0) {
+      for (const auto j : candidates) {
+        if (intersects(footprints_[index], objects_[j])) {
+          return CollisionPair{index, j};
+        }
+      }
+      return std::nullopt;
+    }
+    const auto end = std::min(2 * index + 2, levels_[level - 1].size());
+    for (auto child = 2 * index; child < end; ++child) {
+      if (const auto collision = search(level - 1, child)) {
+        return collision;
+      }
+    }
+    return std::nullopt;
+  }
+
+  const std::vector<alt::ConvexPolygon2dView> & footprints_;
+  const std::vector<alt::ConvexPolygon2dView> & objects_;
+  std::vector<Box> object_boxes_;
+  std::vector<std::vector<Box>> levels_;
+  std::vector<std::vector<std::size_t>> candidates_;
+};
+}  // namespace
+
+std::vector<CollisionPair> find_collisions(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2)
+{
+  auto collisions = find_candidates(polygons1, polygons2);
+  collisions.erase(
+    std::remove_if(
+      collisions.begin(), collisions.end(),
+      [&](const auto & c) { return !intersects(polygons1[c.index1], polygons2[c.index2]); }),
+    collisions.end());
+  return collisions;
+}
+
+std::vector<CollisionPair> find_collisions(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2, SpatialHashGrid & grid)
+{
+  std::vector<CollisionPair> collisions;
+  if (polygons1.empty() || polygons2.empty()) {
+    return collisions;
+  }
+
+  grid.build(polygons2);
+  const auto boxes1 = to_boxes(polygons1);
+  std::vector<std::size_t> candidates;
+  for (std::size_t i = 0; i < polygons1.size(); ++i) {
+    const auto & box = boxes1[i];
+    grid.query_box({box.min_x, box.min_y}, {box.max_x, box.max_y}, candidates);
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto j : candidates) {
+      if (intersects(polygons1[i], polygons2[j])) {
+        collisions.push_back({i, j});
+      }
+    }
+  }
+  return collisions;
+}
+
+std::optional<CollisionPair> find_first_collision(
+  const std::vector<alt::ConvexPolygon2dView> & polygons1,
+  const std::vector<alt::ConvexPolygon2dView> & polygons2)
+{
+  for (const auto & c : find_candidates(polygons1, polygons2)) {
+    if (intersects(polygons1[c.index1], polygons2[c.index2])) {
+      return c;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<CollisionPair> find_first_collision_along_path(
+  const std::vector<alt::ConvexPolygon2dView> & footprints,
+  const std::vector<alt::ConvexPolygon2dView> & objects)
+{
+  if (footprints.empty() || objects.empty()) {
+    return std::nullopt;
+  }
+  return PathCollisionSearch(footprints, objects).search();
+}
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,73 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/decomposed_polygon.hpp"
+
+#include "autoware_utils_geometry/ear_clipping.hpp"
+#include "autoware_utils_geometry/sat_2d.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+
+DecomposedPolygon2d::DecomposedPolygon2d(const Polygon2d & polygon)
+{
+  if (polygon.outer().empty()) {
+    throw std::invalid_argument("The polygon must not be empty.");
+  }
+  const auto convex_polygons = convex_decompose(polygon);
+  pieces_.reserve(convex_polygons.size());
+  for (const auto & convex_polygon : convex_polygons) {
+    pieces_.emplace_back(convex_polygon);
+  }
+  boost::geometry::envelope(polygon, box_);
+}
+
+bool intersects(const DecomposedPolygon2d & polygon, const Polygon2d & convex_polygon)
+{
+  const auto box = boost::geometry::return_envelope<Box2d>(convex_polygon);
+  if (boxes_disjoint(polygon.box(), box)) {
+    return false;
+  }
+  for (const auto & piece : polygon.pieces()) {
+    if (!boxes_disjoint(piece.box(), box) && sat::intersects(piece, convex_polygon)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool intersects(const DecomposedPolygon2d & polygon1, const DecomposedPolygon2d & polygon2)
+{
+  if (boxes_disjoint(polygon1.box(), polygon2.box())) {
+    return false;
+  }
+  for (const auto & piece1 : polygon1.pieces()) {
+    if (boxes_disjoint(piece1.box(), polygon2.box())) {
+      continue;
+    }
+    for (const auto & piece2 : polygon2.pieces()) {
+      if (sat::intersects(piece1, piece2)) {  // also checks the boxes of the pieces
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace autoware_utils_geometry
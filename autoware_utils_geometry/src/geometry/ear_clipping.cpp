@@ -15,7 +15,12 @@
 #include "autoware_utils_geometry/ear_clipping.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware_utils_geometry
@@ -23,26 +28,31 @@ namespace autoware_utils_geometry
 
 void remove_point(const std::size_t p_index, std::vector<LinkedPoint> & points)
 {
-  std::size_t prev_index = points[p_index].prev_index.value();
-  std::size_t next_index = points[p_index].next_index.value();
+  const std::size_t prev_index = points[p_index].prev_index;
+  const std::size_t next_index = points[p_index].next_index;
 
   points[prev_index].next_index = next_index;
   points[next_index].prev_index = prev_index;
+
+  const std::size_t prev_z = points[p_index].prev_z;
+  const std::size_t next_z = points[p_index].next_z;
+  if (prev_z != LinkedPoint::none) points[prev_z].next_z = next_z;
+  if (next_z != LinkedPoint::none) points[next_z].prev_z = prev_z;
 }
 
 std::size_t get_leftmost(const std::size_t start_idx, const std::vector<LinkedPoint> & points)
 {
-  std::optional<std::size_t> p_idx = points[start_idx].next_index;
+  std::size_t p_idx = points[start_idx].next_index;
   std::size_t left_most_idx = start_idx;
 
-  while (p_idx.has_value() && p_idx.value() != start_idx) {
+  while (p_idx != LinkedPoint::none && p_idx != start_idx) {
     if (
-      points[p_idx.value()].x() < points[left_most_idx].x() ||
-      (points[p_idx.value()].x() == points[left_most_idx].x() &&
-       points[p_idx.value()].y() < points[left_most_idx].y())) {
-      left_most_idx = p_idx.value();
+      points[p_idx].x() < points[left_most_idx].x() ||
+      (points[p_idx].x() == points[left_most_idx].x() &&
+       points[p_idx].y() < points[left_most_idx].y())) {
+      left_most_idx = p_idx;
     }
-    p_idx = points[p_idx.value()].next_index;
+    p_idx = points[p_idx].next_index;
   }
 
   return left_most_idx;
@@ -70,15 +80,15 @@ double area(
 bool middle_inside(
   const std::size_t a_idx, const std::size_t b_idx, const std::vector<LinkedPoint> & points)
 {
-  std::optional<std::size_t> p_idx = a_idx;
+  std::size_t p_idx = a_idx;
   bool inside = false;
   double px = (points[a_idx].x() + points[b_idx].x()) / 2;
   double py = (points[a_idx].y() + points[b_idx].y()) / 2;
   std::size_t start_idx = a_idx;
 
-  while (p_idx.has_value()) {
-    std::size_t current_idx = p_idx.value();
-    std::size_t next_idx = points[current_idx].next_index.value();
+  while (p_idx != LinkedPoint::none) {
+    std::size_t current_idx = p_idx;
+    std::size_t next_idx = points[current_idx].next_index;
 
     if (
       ((points[current_idx].y() > py) != (points[next_idx].y() > py)) &&
@@ -124,18 +134,18 @@ bool on_segment(
 bool locally_inside(
   const std::size_t a_idx, const std::size_t b_idx, const std::vector<LinkedPoint> & points)
 {
-  const auto & prev_idx = points[a_idx].prev_index;
-  const auto & next_idx = points[a_idx].next_index;
+  const auto prev_idx = points[a_idx].prev_index;
+  const auto next_idx = points[a_idx].next_index;
 
-  if (!prev_idx.has_value() || !next_idx.has_value()) {
+  if (prev_idx == LinkedPoint::none || next_idx == LinkedPoint::none) {
     return false;
   }
 
-  double area_prev = area(points, prev_idx.value(), a_idx, next_idx.value());
-  double area_a_b_next = area(points, a_idx, b_idx, next_idx.value());
-  double area_a_prev_b = area(points, a_idx, prev_idx.value(), b_idx);
-  double area_a_b_prev = area(points, a_idx, b_idx, prev_idx.value());
-  double area_a_next_b = area(points, a_idx, next_idx.value(), b_idx);
+  double area_prev = area(points, prev_idx, a_idx, next_idx);
+  double area_a_b_next = area(points, a_idx, b_idx, next_idx);
+  double area_a_prev_b = area(points, a_idx, prev_idx, b_idx);
+  double area_a_b_prev = area(points, a_idx, b_idx, prev_idx);
+  double area_a_next_b = area(points, a_idx, next_idx, b_idx);
 
   return area_prev < 0 ? area_a_b_next >= 0 && area_a_prev_b >= 0
                        : area_a_b_prev < 0 || area_a_next_b < 0;
@@ -163,21 +173,21 @@ bool intersects(
 bool intersects_polygon(
   const std::vector<LinkedPoint> & points, const std::size_t a_idx, const std::size_t b_idx)
 {
+  const std::size_t a_vertex = points[a_idx].vertex_index;
+  const std::size_t b_vertex = points[b_idx].vertex_index;
   std::size_t p_idx = a_idx;
-  std::optional<std::size_t> p_next_opt = points[p_idx].next_index;
 
-  while (p_next_opt.has_value() && p_next_opt.value() != a_idx) {
-    std::size_t p_next_idx = p_next_opt.value();
-
-    if (p_idx != a_idx && p_next_idx != a_idx && p_idx != b_idx && p_next_idx != b_idx) {
-      if (intersects(p_idx, p_next_idx, a_idx, b_idx, points)) {
-        return true;
-      }
+  do {
+    const std::size_t p_next_idx = points[p_idx].next_index;
+    const std::size_t p_vertex = points[p_idx].vertex_index;
+    const std::size_t p_next_vertex = points[p_next_idx].vertex_index;
+    if (
+      p_vertex != a_vertex && p_next_vertex != a_vertex && p_vertex != b_vertex &&
+      p_next_vertex != b_vertex && intersects(p_idx, p_next_idx, a_idx, b_idx, points)) {
+      return true;
     }
-
     p_idx = p_next_idx;
-    p_next_opt = points[p_idx].next_index;
-  }
+  } while (p_idx != a_idx);
 
   return false;
 }
@@ -186,17 +196,22 @@ bool is_valid_diagonal(
   const std::size_t a_idx, const std::size_t b_idx, const std::vector<LinkedPoint> & points)
 {
   if (
-    !points[a_idx].next_index.has_value() || !points[a_idx].prev_index.has_value() ||
-    !points[b_idx].next_index.has_value() || !points[b_idx].prev_index.has_value()) {
+    points[a_idx].next_index == LinkedPoint::none ||
+    points[a_idx].prev_index == LinkedPoint::none ||
+    points[b_idx].next_index == LinkedPoint::none ||
+    points[b_idx].prev_index == LinkedPoint::none) {
     return false;
   }
 
-  std::size_t a_next_idx = points[a_idx].next_index.value();
-  std::size_t a_prev_idx = points[a_idx].prev_index.value();
-  std::size_t b_next_idx = points[b_idx].next_index.value();
-  std::size_t b_prev_idx = points[b_idx].prev_index.value();
+  std::size_t a_next_idx = points[a_idx].next_index;
+  std::size_t a_prev_idx = points[a_idx].prev_index;
+  std::size_t b_next_idx = points[b_idx].next_index;
+  std::size_t b_prev_idx = points[b_idx].prev_index;
 
-  if (a_next_idx == b_idx || a_prev_idx == b_idx || intersects_polygon(points, a_idx, b_idx)) {
+  const std::size_t b_vertex = points[b_idx].vertex_index;
+  if (
+    points[a_next_idx].vertex_index == b_vertex || points[a_prev_idx].vertex_index == b_vertex ||
+    intersects_polygon(points, a_idx, b_idx)) {
     return false;
   }
 
@@ -215,19 +230,19 @@ bool is_valid_diagonal(
 }
 
 std::size_t insert_point(
-  const alt::Point2d & pt, std::vector<LinkedPoint> & points,
-  const std::optional<std::size_t> last_index)
+  const alt::Point2d & pt, std::vector<LinkedPoint> & points, const std::size_t last_index)
 {
   std::size_t p_idx = points.size();
   points.push_back(LinkedPoint(pt));
+  points[p_idx].vertex_index = p_idx;
 
   // Making sure all next_index and prev_index will always have values
-  if (!last_index.has_value()) {
+  if (last_index == LinkedPoint::none) {
     points[p_idx].prev_index = p_idx;
     points[p_idx].next_index = p_idx;
   } else {
-    std::size_t last = last_index.value();
-    std::size_t next = points[last].next_index.value();
+    std::size_t last = last_index;
+    std::size_t next = points[last].next_index;
     points[p_idx].prev_index = last;
     points[p_idx].next_index = next;
     points[last].next_index = p_idx;
@@ -244,7 +259,7 @@ std::size_t linked_list(
   std::vector<LinkedPoint> & points)
 {
   const std::size_t len = ring.size();
-  std::optional<std::size_t> last_index = std::nullopt;
+  std::size_t last_index = LinkedPoint::none;
 
   // create forward linked list if forward is true and ring is counter-clockwise, or
   //                               forward is false and ring is clockwise
@@ -260,32 +275,33 @@ std::size_t linked_list(
     }
   }
 
-  if (last_index.has_value()) {
-    std::size_t last_idx_value = last_index.value();
-    std::optional<std::size_t> next_index = points[last_idx_value].next_index;
+  if (last_index != LinkedPoint::none) {
+    const std::size_t next_index = points[last_index].next_index;
 
-    if (next_index.has_value() && equals(last_idx_value, next_index.value(), points)) {
-      std::size_t next_idx_value = next_index.value();
-      remove_point(last_idx_value, points);
-      last_index = next_idx_value;
+    if (next_index != LinkedPoint::none && equals(last_index, next_index, points)) {
+      remove_point(last_index, points);
+      last_index = next_index;
     }
   }
 
   vertices += len;
-  return last_index.value();
+  return last_index;
 }
 
 bool sector_contains_sector(
   const std::size_t m_idx, const std::size_t p_idx, const std::vector<LinkedPoint> & points)
 {
-  if (!points[m_idx].prev_index.has_value() || !points[m_idx].next_index.has_value()) {
+  if (
+    points[m_idx].prev_index == LinkedPoint::none ||
+    points[m_idx].next_index == LinkedPoint::none) {
     return false;
   }
 
-  std::size_t m_prev_idx = points[m_idx].prev_index.value();
-  std::size_t m_next_idx = points[m_idx].next_index.value();
+  std::size_t m_prev_idx = points[m_idx].prev_index;
+  std::size_t m_next_idx = points[m_idx].next_index;
 
-  return area(points, m_prev_idx, m_idx, p_idx) < 0 && area(points, p_idx, m_next_idx, m_idx) < 0;
+  return area(points, m_prev_idx, m_idx, points[p_idx].prev_index) < 0 &&
+         area(points, points[p_idx].next_index, m_idx, m_next_idx) < 0;
 }
 
 std::size_t find_hole_bridge(
@@ -296,10 +312,14 @@ std::size_t find_hole_bridge(
   double hx = points[hole_index].x();
   double hy = points[hole_index].y();
   double qx = -std::numeric_limits<double>::infinity();
-  std::optional<std::size_t> bridge_index = std::nullopt;
-  std::size_t next_index = points[p].next_index.value();
+  std::size_t bridge_index = LinkedPoint::none;
 
-  while (p != outer_point_index) {
+  // find a segment intersected by a ray from the leftmost point of the hole to the left, its end
+  // point with the lesser x is the potential bridge unless the ray hits a vertex
+  if (equals(hole_index, p, points)) return p;
+  do {
+    const std::size_t next_index = points[p].next_index;
+    if (equals(hole_index, next_index, points)) return next_index;
     if (
       hy <= points[p].y() && hy >= points[next_index].y() &&
       points[next_index].y() != points[p].y()) {
@@ -308,24 +328,23 @@ std::size_t find_hole_bridge(
       if (x <= hx && x > qx) {
         qx = x;
         bridge_index = (points[p].x() < points[next_index].x()) ? p : next_index;
-        if (x == hx) return bridge_index.value();
+        if (x == hx) return bridge_index;  // the hole touches the segment
       }
     }
     p = next_index;
-    next_index = points[p].next_index.value();
-  }
+  } while (p != outer_point_index);
 
-  if (!bridge_index.has_value()) return outer_point_index;
+  if (bridge_index == LinkedPoint::none) return LinkedPoint::none;
 
-  const std::size_t stop = bridge_index.value();
+  // look for the points inside the triangle of the hole point, the intersection and the end point,
+  // the one with the minimum angle with the ray is the bridge
+  const std::size_t stop = bridge_index;
+  const double mx = points[stop].x();
+  const double my = points[stop].y();
   double min_tan = std::numeric_limits<double>::infinity();
 
-  p = bridge_index.value();
-  double mx = points[p].x();
-  double my = points[p].y();
-  next_index = points[p].next_index.value();
-
-  while (p != stop) {
+  p = stop;
+  do {
     if (
       hx >= points[p].x() && points[p].x() >= mx && hx != points[p].x() &&
       point_in_triangle(
@@ -335,71 +354,72 @@ std::size_t find_hole_bridge(
       if (
         locally_inside(p, hole_index, points) &&
         (current_tan < min_tan ||
-         (current_tan == min_tan && (points[p].x() > points[bridge_index.value()].x() ||
-                                     sector_contains_sector(bridge_index.value(), p, points))))) {
+         (current_tan == min_tan &&
+          (points[p].x() > points[bridge_index].x() ||
+           (points[p].x() == points[bridge_index].x() &&
+            sector_contains_sector(bridge_index, p, points)))))) {
         bridge_index = p;
         min_tan = current_tan;
       }
     }
 
-    p = next_index;
-    next_index = points[p].next_index.value();
-  }
+    p = points[p].next_index;
+  } while (p != stop);
 
-  return bridge_index.value();
+  return bridge_index;
 }
 
 std::size_t split_polygon(
   std::size_t a_index, std::size_t b_index, std::vector<LinkedPoint> & points)
 {
-  std::size_t an_idx = points[a_index].next_index.value();
-  std::size_t bp_idx = points[b_index].prev_index.value();
+  std::size_t an_idx = points[a_index].next_index;
+  std::size_t bp_idx = points[b_index].prev_index;
 
   std::size_t a2_idx = points.size();
   std::size_t b2_idx = points.size() + 1;
-  points.push_back(points[a_index]);
-  points.push_back(points[b_index]);
+  points.push_back(LinkedPoint(points[a_index].pt));
+  points.push_back(LinkedPoint(points[b_index].pt));
+  points[a2_idx].vertex_index = points[a_index].vertex_index;
+  points[b2_idx].vertex_index = points[b_index].vertex_index;
 
   points[a_index].next_index = b_index;
   points[a2_idx].prev_index = b2_idx;
   points[a2_idx].next_index = an_idx;
 
   points[b_index].prev_index = a_index;
-  points[an_idx].prev_index = b2_idx;
+  points[an_idx].prev_index = a2_idx;
   points[b2_idx].next_index = a2_idx;
   points[b2_idx].prev_index = bp_idx;
-
-  if (bp_idx != b_index) {
-    points[bp_idx].next_index = b2_idx;
-  }
+  points[bp_idx].next_index = b2_idx;
 
   return b2_idx;
 }
 
+/// @brief removes the duplicated and collinear points from start to end, returns the new end
 std::size_t filter_points(
-  const std::size_t start_index, const std::size_t end_index, std::vector<LinkedPoint> & points)
+  const std::size_t start_index, std::size_t end_index, std::vector<LinkedPoint> & points)
 {
   auto p = start_index;
-  bool again = true;
+  bool again = false;
 
-  while (again && p != end_index) {
+  do {
     again = false;
 
     if (
       !points[p].steiner &&
-      (equals(p, points[p].next_index.value(), points) ||
-       area(points, points[p].prev_index.value(), p, points[p].next_index.value()) == 0)) {
+      (equals(p, points[p].next_index, points) ||
+       area(points, points[p].prev_index, p, points[p].next_index) == 0)) {
       remove_point(p, points);
-      p = points[p].prev_index.value();
+      p = end_index = points[p].prev_index;
 
-      if (p == points[p].next_index.value()) {
+      if (p == points[p].next_index) {
         break;
       }
       again = true;
     } else {
-      p = points[p].next_index.value();
+      p = points[p].next_index;
     }
-  }
+  } while (again || p != end_index);
 
   return end_index;
 }
@@ -408,13 +428,14 @@ std::size_t eliminate_hole(
   const std::size_t hole_index, const std::size_t outer_index, std::vector<LinkedPoint> & points)
 {
   auto bridge = find_hole_bridge(hole_index, outer_index, points);
+  if (bridge == LinkedPoint::none) {
+    return outer_index;
+  }
   auto bridge_reverse = split_polygon(bridge, hole_index, points);
 
-  auto next_index_bridge_reverse = points[bridge_reverse].next_index.value();
-  filter_points(bridge_reverse, next_index_bridge_reverse, points);
-
-  auto next_index_bridge = points[bridge].next_index.value();
-  return filter_points(bridge, next_index_bridge, points);
+  // filter the collinear points around the cuts
+  filter_points(bridge_reverse, points[bridge_reverse].next_index, points);
+  return filter_points(bridge, points[bridge].next_index, points);
 }
 
 std::size_t eliminate_holes(
@@ -422,6 +443,14 @@ std::size_t eliminate_holes(
   std::vector<LinkedPoint> & points)
 {
   std::vector<std::size_t> queue;
+  return eliminate_holes(inners, outer_index, vertices, points, queue);
+}
+
+std::size_t eliminate_holes(
+  const std::vector<alt::PointList2d> & inners, std::size_t outer_index, std::size_t & vertices,
+  std::vector<LinkedPoint> & points, std::vector<std::size_t> & queue)
+{
+  queue.clear();
 
   for (const auto & ring : inners) {
     if (ring.empty()) {
@@ -429,15 +458,23 @@ std::size_t eliminate_holes(
     }
     auto inner_index = linked_list(ring, false, vertices, points);
 
-    if (points[inner_index].next_index.value() == inner_index) {
+    if (points[inner_index].next_index == inner_index) {
       points[inner_index].steiner = true;
     }
 
     queue.push_back(get_leftmost(inner_index, points));
   }
 
-  std::sort(queue.begin(), queue.end(), [&](std::size_t a, std::size_t b) {
-    return points[a].x() < points[b].x();
+  // process the holes from left to right, the ties are broken by y then by the slope of the first
+  // edge so that the holes sharing their leftmost point are bridged in a consistent order
+  const auto slope = [&](const std::size_t p) {
+    const auto & next = points[points[p].next_index];
+    return (next.y() - points[p].y()) / (next.x() - points[p].x());
+  };
+  std::sort(queue.begin(), queue.end(), [&](const std::size_t a, const std::size_t b) {
+    if (points[a].x() != points[b].x()) return points[a].x() < points[b].x();
+    if (points[a].y() != points[b].y()) return points[a].y() < points[b].y();
+    return slope(a) < slope(b);
   });
 
   for (const auto & q : queue) {
@@ -449,24 +486,171 @@ std::size_t eliminate_holes(
 
 bool is_ear(const std::size_t ear_index, const std::vector<LinkedPoint> & points)
 {
-  const auto a_index = points[ear_index].prev_index.value();
+  const auto a_index = points[ear_index].prev_index;
   const auto b_index = ear_index;
-  const auto c_index = points[ear_index].next_index.value();
+  const auto c_index = points[ear_index].next_index;
 
-  const auto a = points[a_index];
-  const auto b = points[b_index];
-  const auto c = points[c_index];
+  const auto & a = points[a_index];
+  const auto & b = points[b_index];
+  const auto & c = points[c_index];
 
   if (area(points, a_index, b_index, c_index) >= 0) return false;
-  auto p_index = points[c_index].next_index.value();
+  auto p_index = points[c_index].next_index;
   while (p_index != a_index) {
-    const auto p = points[p_index];
+    const auto & p = points[p_index];
     if (
       point_in_triangle(a.x(), a.y(), b.x(), b.y(), c.x(), c.y(), p.x(), p.y()) &&
-      area(points, p.prev_index.value(), p_index, p.next_index.value()) >= 0) {
+      area(points, p.prev_index, p_index, p.next_index) >= 0) {
       return false;
     }
-    p_index = points[p_index].next_index.value();
+    p_index = points[p_index].next_index;
+  }
+
+  return true;
+}
+
+/// @brief interleaves the bits of the coordinates mapped to 15 bits integers
+std::uint32_t z_order(const double x, const double y, const ZOrderHash & hash)
+{
+  auto ix = static_cast<std::uint32_t>((x - hash.min_x) * hash.inv_size);
+  auto iy = static_cast<std::uint32_t>((y - hash.min_y) * hash.inv_size);
+
+  ix = (ix | (ix << 8)) & 0x00FF00FF;
+  ix = (ix | (ix << 4)) & 0x0F0F0F0F;
+  ix = (ix | (ix << 2)) & 0x33333333;
+  ix = (ix | (ix << 1)) & 0x55555555;
+
+  iy = (iy | (iy << 8)) & 0x00FF00FF;
+  iy = (iy | (iy << 4)) & 0x0F0F0F0F;
+  iy = (iy | (iy << 2)) & 0x33333333;
+  iy = (iy | (iy << 1)) & 0x55555555;
+
+  return ix | (iy << 1);
+}
+
+/// @brief sorts the z-order linked list with Simon Tatham's merge sort, returns the new head
+std::size_t sort_linked(std::size_t list, std::vector<LinkedPoint> & points)
+{
+  std::size_t in_size = 1;
+  std::size_t num_merges = 0;
+
+  do {
+    std::size_t p = list;
+    std::size_t tail = LinkedPoint::none;
+    list = LinkedPoint::none;
+    num_merges = 0;
+
+    while (p != LinkedPoint::none) {
+      ++num_merges;
+      std::size_t q = p;
+      std::size_t p_size = 0;
+      for (std::size_t i = 0; i < in_size && q != LinkedPoint::none; ++i) {
+        ++p_size;
+        q = points[q].next_z;
+      }
+      std::size_t q_size = in_size;
+
+      while (p_size > 0 || (q_size > 0 && q != LinkedPoint::none)) {
+        std::size_t e = LinkedPoint::none;
+        if (p_size != 0 && (q_size == 0 || q == LinkedPoint::none || points[p].z <= points[q].z)) {
+          e = p;
+          p = points[p].next_z;
+          --p_size;
+        } else {
+          e = q;
+          q = points[q].next_z;
+          --q_size;
+        }
+
+        if (tail != LinkedPoint::none) {
+          points[tail].next_z = e;
+        } else {
+          list = e;
+        }
+        points[e].prev_z = tail;
+        tail = e;
+      }
+
+      p = q;
+    }
+
+    points[tail].next_z = LinkedPoint::none;
+    in_size *= 2;
+  } while (num_merges > 1);
+
+  return list;
+}
+
+/// @brief computes the z-order of the points of a ring and links them in z-order
+void index_curve(
+  const std::size_t start_index, std::vector<LinkedPoint> & points, const ZOrderHash & hash)
+{
+  std::size_t p = start_index;
+  do {
+    points[p].z = z_order(points[p].x(), points[p].y(), hash);
+    points[p].prev_z = points[p].prev_index;
+    points[p].next_z = points[p].next_index;
+    p = points[p].next_index;
+  } while (p != start_index);
+
+  points[points[p].prev_z].next_z = LinkedPoint::none;
+  points[p].prev_z = LinkedPoint::none;
+
+  sort_linked(p, points);
+}
+
+/// @brief same as is_ear() but only visits the points whose z-order is in the range of the ear
+bool is_ear_hashed(
+  const std::size_t ear_index, const std::vector<LinkedPoint> & points, const ZOrderHash & hash)
+{
+  const auto a_index = points[ear_index].prev_index;
+  const auto b_index = ear_index;
+  const auto c_index = points[ear_index].next_index;
+
+  const auto & a = points[a_index];
+  const auto & b = points[b_index];
+  const auto & c = points[c_index];
+
+  if (area(points, a_index, b_index, c_index) >= 0) return false;
+
+  const double x0 = std::min({a.x(), b.x(), c.x()});
+  const double y0 = std::min({a.y(), b.y(), c.y()});
+  const double x1 = std::max({a.x(), b.x(), c.x()});
+  const double y1 = std::max({a.y(), b.y(), c.y()});
+
+  const std::uint32_t min_z = z_order(x0, y0, hash);
+  const std::uint32_t max_z = z_order(x1, y1, hash);
+
+  const auto blocks_ear = [&](const std::size_t p_index) {
+    const auto & p = points[p_index];
+    return p.x() >= x0 && p.x() <= x1 && p.y() >= y0 && p.y() <= y1 && p_index != a_index &&
+           p_index != c_index &&
+           point_in_triangle(a.x(), a.y(), b.x(), b.y(), c.x(), c.y(), p.x(), p.y()) &&
+           area(points, p.prev_index, p_index, p.next_index) >= 0;
+  };
+
+  // look for points inside the triangle in both directions
+  auto p_index = points[ear_index].prev_z;
+  auto n_index = points[ear_index].next_z;
+  while (
+    p_index != LinkedPoint::none && points[p_index].z >= min_z && n_index != LinkedPoint::none &&
+    points[n_index].z <= max_z) {
+    if (blocks_ear(p_index)) return false;
+    p_index = points[p_index].prev_z;
+    if (blocks_ear(n_index)) return false;
+    n_index = points[n_index].next_z;
+  }
+
+  // look for remaining points in decreasing z-order
+  while (p_index != LinkedPoint::none && points[p_index].z >= min_z) {
+    if (blocks_ear(p_index)) return false;
+    p_index = points[p_index].prev_z;
+  }
+
+  // look for remaining points in increasing z-order
+  while (n_index != LinkedPoint::none && points[n_index].z <= max_z) {
+    if (blocks_ear(n_index)) return false;
+    n_index = points[n_index].next_z;
   }
 
   return true;
@@ -476,130 +660,150 @@ std::size_t cure_local_intersections(
   std::size_t start_index, std::vector<std::size_t> & indices, std::vector<LinkedPoint> & points)
 {
   auto p = start_index;
-  bool updated = false;
 
-  while (p != start_index || updated) {
-    updated = false;
-    auto a_idx = points[p].prev_index.value();
-    auto b_idx = points[points[p].next_index.value()].next_index.value();
+  do {
+    const auto a_idx = points[p].prev_index;
+    const auto b_idx = points[points[p].next_index].next_index;
 
     if (
       !equals(a_idx, b_idx, points) &&
-      intersects(
-        a_idx, p, points[points[p].next_index.value()].next_index.value(), b_idx, points) &&
+      intersects(a_idx, p, points[p].next_index, b_idx, points) &&
       locally_inside(a_idx, b_idx, points) && locally_inside(b_idx, a_idx, points)) {
       indices.push_back(a_idx);
       indices.push_back(p);
       indices.push_back(b_idx);
 
+      // remove the two points of the self-intersection
       remove_point(p, points);
-      remove_point(points[p].next_index.value(), points);
+      remove_point(points[p].next_index, points);
 
       p = start_index = b_idx;
-      updated = true;
-    } else {
-      p = points[p].next_index.value();
     }
-  }
+    p = points[p].next_index;
+  } while (p != start_index);
 
   return filter_points(p, p, points);
 }
 
 void split_ear_clipping(
   std::vector<LinkedPoint> & points, const std::size_t start_idx,
-  std::vector<std::size_t> & indices)
+  std::vector<std::size_t> & indices, const ZOrderHash & hash)
 {
   std::size_t a_idx = start_idx;
   do {
-    std::size_t b_idx = points[points[a_idx].next_index.value()].next_index.value();
-    while (b_idx != points[a_idx].prev_index.value()) {
-      if (a_idx != b_idx && is_valid_diagonal(a_idx, b_idx, points)) {
+    std::size_t b_idx = points[points[a_idx].next_index].next_index;
+    while (b_idx != points[a_idx].prev_index) {
+      if (
+        points[a_idx].vertex_index != points[b_idx].vertex_index &&
+        is_valid_diagonal(a_idx, b_idx, points)) {
         std::size_t c_idx = split_polygon(a_idx, b_idx, points);
 
-        a_idx = filter_points(start_idx, points[a_idx].next_index.value(), points);
-        c_idx = filter_points(start_idx, points[c_idx].next_index.value(), points);
+        a_idx = filter_points(a_idx, points[a_idx].next_index, points);
+        c_idx = filter_points(c_idx, points[c_idx].next_index, points);
 
-        ear_clipping_linked(a_idx, indices, points);
-        ear_clipping_linked(c_idx, indices, points);
+        ear_clipping_linked(a_idx, indices, points, 0, hash);
+        ear_clipping_linked(c_idx, indices, points, 0, hash);
         return;
       }
-      b_idx = points[b_idx].next_index.value();
+      b_idx = points[b_idx].next_index;
     }
-    a_idx = points[a_idx].next_index.value();
+    a_idx = points[a_idx].next_index;
   } while (a_idx != start_idx);
 }
 
 void ear_clipping_linked(
   std::size_t ear_index, std::vector<std::size_t> & indices, std::vector<LinkedPoint> & points,
-  const int pass)
+  const int pass, const ZOrderHash & hash)
 {
+  if (pass == 0 && hash.enabled()) {
+    index_curve(ear_index, points, hash);
+  }
+
   auto stop = ear_index;
-  std::optional<std::size_t> next = std::nullopt;
 
-  while (points[ear_index].prev_index.value() != points[ear_index].next_index.value()) {
-    next = points[ear_index].next_index;
+  while (points[ear_index].prev_index != points[ear_index].next_index) {
+    const std::size_t next = points[ear_index].next_index;
 
-    if (is_ear(ear_index, points)) {
-      indices.push_back(points[ear_index].prev_index.value());
+    if (hash.enabled() ? is_ear_hashed(ear_index, points, hash) : is_ear(ear_index, points)) {
+      indices.push_back(points[ear_index].prev_index);
       indices.push_back(ear_index);
-      indices.push_back(next.value());
+      indices.push_back(next);
 
       remove_point(ear_index, points);
 
-      ear_index = points[next.value()].next_index.value();
-      stop = points[next.value()].next_index.value();
+      ear_index = points[next].next_index;
+      stop = points[next].next_index;
       continue;
     }
 
-    ear_index = next.value();
+    ear_index = next;
 
     if (ear_index == stop) {
       if (pass == 0) {
-        ear_clipping_linked(filter_points(ear_index, ear_index, points), indices, points, 1);
+        ear_clipping_linked(
+          filter_points(ear_index, ear_index, points), indices, points, 1, hash);
       } else if (pass == 1) {
         ear_index =
           cure_local_intersections(filter_points(ear_index, ear_index, points), indices, points);
-        ear_clipping_linked(ear_index, indices, points, 2);
+        ear_clipping_linked(ear_index, indices, points, 2, hash);
       } else if (pass == 2) {
-        split_ear_clipping(points, ear_index, indices);
+        split_ear_clipping(points, ear_index, indices, hash);
       }
       break;
     }
   }
 }
 
-std::vector<LinkedPoint> perform_triangulation(
-  const alt::Polygon2d & polygon, std::vector<std::size_t> & indices)
+const std::vector<std::size_t> & Triangulator::triangulate(const alt::Polygon2d & polygon)
 {
-  indices.clear();
-  std::vector<LinkedPoint> points;
+  indices_.clear();
+  points_.clear();
   std::size_t vertices = 0;
   const auto & outer_ring = polygon.outer();
   std::size_t len = outer_ring.size();
-  points.reserve(len * 3 / 2);
+  points_.reserve(len * 3 / 2);
 
-  if (polygon.outer().empty()) return points;
+  if (polygon.outer().empty()) return indices_;
 
-  indices.reserve(len + outer_ring.size());
-  auto outer_point_index = linked_list(outer_ring, true, vertices, points);
+  indices_.reserve(len + outer_ring.size());
+  auto outer_point_index = linked_list(outer_ring, true, vertices, points_);
   if (
-    !points[outer_point_index].prev_index.has_value() ||
-    outer_point_index == points[outer_point_index].prev_index.value()) {
-    return points;
+    points_[outer_point_index].prev_index == LinkedPoint::none ||
+    points_[outer_point_index].next_index == points_[outer_point_index].prev_index) {
+    return indices_;
   }
 
   if (!polygon.inners().empty()) {
-    outer_point_index = eliminate_holes(polygon.inners(), outer_point_index, vertices, points);
+    outer_point_index =
+      eliminate_holes(polygon.inners(), outer_point_index, vertices, points_, hole_queue_);
   }
 
-  ear_clipping_linked(outer_point_index, indices, points);
-  return points;
+  ZOrderHash hash;
+  if (vertices > z_order_threshold_) {
+    double max_x = outer_ring.front().x();
+    double max_y = outer_ring.front().y();
+    hash.min_x = max_x;
+    hash.min_y = max_y;
+    for (const auto & point : outer_ring) {
+      hash.min_x = std::min(hash.min_x, point.x());
+      hash.min_y = std::min(hash.min_y, point.y());
+      max_x = std::max(max_x, point.x());
+      max_y = std::max(max_y, point.y());
+    }
+    // the holes are inside the outer ring, so the z-order of all the points fits in 15 bits
+    const double size = std::max(max_x - hash.min_x, max_y - hash.min_y);
+    hash.inv_size = size != 0.0 ? 32767.0 / size : 0.0;
+  }
+
+  ear_clipping_linked(outer_point_index, indices_, points_, 0, hash);
+  return indices_;
 }
 
 std::vector<alt::ConvexPolygon2d> triangulate(const alt::Polygon2d & poly)
 {
-  std::vector<std::size_t> indices;
-  auto points = perform_triangulation(poly, indices);
+  Triangulator triangulator;
+  const auto & indices = triangulator.triangulate(poly);
+  const auto & points = triangulator.points();
 
   std::vector<alt::ConvexPolygon2d> triangles;
   const std::size_t num_indices = indices.size();
@@ -617,7 +821,6 @@ std::vector<alt::ConvexPolygon2d> triangulate(const alt::Polygon2d & poly)
 
     triangles.push_back(alt::ConvexPolygon2d::create(vertices).value());
   }
-  points.clear();
   return triangles;
 }
 
@@ -631,4 +834,141 @@ std::vector<Polygon2d> triangulate(const Polygon2d & poly)
   }
   return triangles;
 }
+
+namespace
+{
+/// @brief cross product of (p1 - p0) and (p2 - p1), positive for a left turn
+double turn(const alt::Point2d & p0, const alt::Point2d & p1, const alt::Point2d & p2)
+{
+  return (p1 - p0).cross(p2 - p1);
+}
+}  // namespace
+
+std::vector<alt::ConvexPolygon2d> convex_decompose(const alt::Polygon2d & poly)
+{
+  Triangulator triangulator;
+  const auto & indices = triangulator.triangulate(poly);
+  const auto & points = triangulator.points();
+  const std::size_t num_points = points.size();
+
+  // the points duplicated to bridge holes or split the polygon are merged so that the triangles on
+  // both sides of a bridge share their edge
+  std::vector<std::size_t> canonical(num_points);
+  std::iota(canonical.begin(), canonical.end(), 0);
+  std::sort(canonical.begin(), canonical.end(), [&](const std::size_t a, const std::size_t b) {
+    return points[a].x() < points[b].x() ||
+           (points[a].x() == points[b].x() && points[a].y() < points[b].y());
+  });
+  std::vector<std::size_t> representative(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const bool duplicated = i > 0 && equals(canonical[i], canonical[i - 1], points);
+    representative[canonical[i]] = duplicated ? representative[canonical[i - 1]] : canonical[i];
+  }
+
+  // pieces in counter-clockwise order, and the piece on the left of each directed edge
+  std::vector<std::vector<std::size_t>> pieces;
+  pieces.reserve(indices.size() / 3);
+  std::unordered_map<std::size_t, std::size_t> edge_to_piece;
+  const auto edge_key = [&](const std::size_t from, const std::size_t to) {
+    return from * num_points + to;
+  };
+
+  for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const std::size_t a = representative[indices[i]];
+    const std::size_t b = representative[indices[i + 1]];
+    const std::size_t c = representative[indices[i + 2]];
+    // the degenerate triangles along the bridges do not cover any area
+    if (a == b || b == c || c == a || turn(points[a].pt, points[b].pt, points[c].pt) <= 0.0) {
+      continue;
+    }
+    const std::size_t piece = pieces.size();
+    pieces.push_back({a, b, c});
+    edge_to_piece.emplace(edge_key(a, b), piece);
+    edge_to_piece.emplace(edge_key(b, c), piece);
+    edge_to_piece.emplace(edge_key(c, a), piece);
+  }
+
+  // the diagonals are the edges shared by 2 triangles, visited once from their smaller end point
+  std::vector<std::pair<std::size_t, std::size_t>> diagonals;
+  for (const auto & triangle : pieces) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      const std::size_t u = triangle[i];
+      const std::size_t v = triangle[(i + 1) % 3];
+      if (u < v && edge_to_piece.count(edge_key(v, u)) != 0) {
+        diagonals.emplace_back(u, v);
+      }
+    }
+  }
+
+  for (const auto & [u, v] : diagonals) {
+    const std::size_t p = edge_to_piece.at(edge_key(u, v));
+    const std::size_t q = edge_to_piece.at(edge_key(v, u));
+    if (p == q) {
+      continue;
+    }
+    auto & piece_p = pieces[p];
+    auto & piece_q = pieces[q];
+    const std::size_t size_p = piece_p.size();
+    const std::size_t size_q = piece_q.size();
+
+    // u is followed by v in p, and v by u in q
+    const std::size_t i = std::find(piece_p.begin(), piece_p.end(), u) - piece_p.begin();
+    const std::size_t j = std::find(piece_q.begin(), piece_q.end(), v) - piece_q.begin();
+    const auto & before_u = points[piece_p[(i + size_p - 1) % size_p]].pt;
+    const auto & after_u = points[piece_q[(j + 2) % size_q]].pt;
+    const auto & before_v = points[piece_q[(j + size_q - 1) % size_q]].pt;
+    const auto & after_v = points[piece_p[(i + 2) % size_p]].pt;
+    if (
+      turn(before_u, points[u].pt, after_u) < 0.0 || turn(before_v, points[v].pt, after_v) < 0.0) {
+      continue;
+    }
+
+    // p from v to u, then q without u and v
+    std::vector<std::size_t> merged;
+    merged.reserve(size_p + size_q - 2);
+    for (std::size_t k = 1; k <= size_p; ++k) {
+      merged.push_back(piece_p[(i + k) % size_p]);
+    }
+    for (std::size_t k = 2; k < size_q; ++k) {
+      merged.push_back(piece_q[(j + k) % size_q]);
+    }
+
+    edge_to_piece.erase(edge_key(u, v));
+    edge_to_piece.erase(edge_key(v, u));
+    for (std::size_t k = 1; k < size_q; ++k) {
+      edge_to_piece[edge_key(piece_q[(j + k) % size_q], piece_q[(j + k + 1) % size_q])] = p;
+    }
+    piece_p = std::move(merged);
+    piece_q.clear();
+  }
+
+  std::vector<alt::ConvexPolygon2d> convex_polygons;
+  for (const auto & piece : pieces) {
+    if (piece.empty()) {
+      continue;
+    }
+    alt::PointList2d vertices;
+    for (const auto index : piece) {
+      vertices.push_back(points[index].pt);
+    }
+    vertices.push_back(points[piece.front()].pt);
+    // only the pieces that are degenerate within the tolerance of the convexity check are dropped
+    if (auto convex_polygon = alt::ConvexPolygon2d::create(std::move(vertices))) {
+      convex_polygons.push_back(std::move(*convex_polygon));
+    }
+  }
+  return convex_polygons;
+}
+
+std::vector<Polygon2d> convex_decompose(const Polygon2d & poly)
+{
+  const auto alt_poly = alt::Polygon2d::create(poly);
+  const auto alt_convex_polygons = convex_decompose(alt_poly.value());
+  std::vector<Polygon2d> convex_polygons;
+  convex_polygons.reserve(alt_convex_polygons.size());
+  for (const auto & alt_convex_polygon : alt_convex_polygons) {
+    convex_polygons.push_back(alt_convex_polygon.to_boost());
+  }
+  return convex_polygons;
+}
 }  // namespace autoware_utils_geometry
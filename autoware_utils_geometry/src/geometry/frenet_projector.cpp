@@ -0,0 +1,226 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/frenet_projector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr double min_length = 1e-10;
+}  // namespace
+
+void FrenetProjector::clear()
+{
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  arc_lengths_.clear();
+  unit_x_.clear();
+  unit_y_.clear();
+  has_direction_ = false;
+  index_.clear();
+}
+
+void FrenetProjector::reserve(const std::size_t num_points)
+{
+  x_.reserve(num_points);
+  y_.reserve(num_points);
+  z_.reserve(num_points);
+  arc_lengths_.reserve(num_points);
+  unit_x_.reserve(num_points);
+  unit_y_.reserve(num_points);
+  index_.reserve(num_points);
+}
+
+void FrenetProjector::push_back(const double x, const double y, const double z)
+{
+  index_.push_back(x, y);
+  if (x_.empty()) {
+    x_.push_back(x);
+    y_.push_back(y);
+    z_.push_back(z);
+    arc_lengths_.push_back(0.0);
+    return;
+  }
+
+  const double dx = x - x_.back();
+  const double dy = y - y_.back();
+  const double length = std::hypot(dx, dy);
+  arc_lengths_.push_back(arc_lengths_.back() + length);
+  x_.push_back(x);
+  y_.push_back(y);
+  z_.push_back(z);
+
+  if (length < min_length) {
+    // a degenerate segment takes the direction of the previous one, or of the first one after it
+    unit_x_.push_back(has_direction_ ? unit_x_.back() : 1.0);
+    unit_y_.push_back(has_direction_ ? unit_y_.back() : 0.0);
+    return;
+  }
+  unit_x_.push_back(dx / length);
+  unit_y_.push_back(dy / length);
+  if (!has_direction_) {
+    std::fill(unit_x_.begin(), unit_x_.end() - 1, unit_x_.back());
+    std::fill(unit_y_.begin(), unit_y_.end() - 1, unit_y_.back());
+    has_direction_ = true;
+  }
+}
+
+double FrenetProjector::squared_distance(
+  const std::size_t segment_index, const double x, const double y) const
+{
+  const double sx = x_[segment_index];
+  const double sy = y_[segment_index];
+  const double length = arc_lengths_[segment_index + 1] - arc_lengths_[segment_index];
+  const double t = std::clamp(
+    (x - sx) * unit_x_[segment_index] + (y - sy) * unit_y_[segment_index], 0.0, length);
+  const double ex = sx + t * unit_x_[segment_index] - x;
+  const double ey = sy + t * unit_y_[segment_index] - y;
+  return ex * ex + ey * ey;
+}
+
+std::size_t FrenetProjector::walk(std::size_t segment_index, const double x, const double y) const
+{
+  segment_index = std::min(segment_index, num_segments() - 1);
+  double distance = squared_distance(segment_index, x, y);
+
+  // forward while the distance does not increase, which also passes the degenerate segments
+  const std::size_t start = segment_index;
+  while (segment_index + 1 < num_segments()) {
+    const double next = squared_distance(segment_index + 1, x, y);
+    if (distance < next) {
+      break;
+    }
+    distance = next;
+    ++segment_index;
+  }
+  if (segment_index != start) {
+    return segment_index;
+  }
+  while (0 < segment_index) {
+    const double prev = squared_distance(segment_index - 1, x, y);
+    if (distance < prev) {
+      break;
+    }
+    distance = prev;
+    --segment_index;
+  }
+  return segment_index;
+}
+
+std::size_t FrenetProjector::nearest_from(
+  const std::size_t hint, const double x, const double y) const
+{
+  const std::size_t segment_index = walk(hint, x, y);
+  // only the segments closer than the local minimum of the walk are searched in the index
+  const auto nearest =
+    index_.nearest_segment(x, y, std::sqrt(squared_distance(segment_index, x, y)));
+  return nearest ? nearest->segment_index : segment_index;
+}
+
+FrenetPoint FrenetProjector::to_frenet(
+  const std::size_t segment_index, const double x, const double y) const
+{
+  const double sx = x_[segment_index];
+  const double sy = y_[segment_index];
+  const double ux = unit_x_[segment_index];
+  const double uy = unit_y_[segment_index];
+  const double length = arc_lengths_[segment_index + 1] - arc_lengths_[segment_index];
+
+  // the foot is extrapolated before the first segment and after the last one
+  double t = (x - sx) * ux + (y - sy) * uy;
+  if (0 < segment_index) {
+    t = std::max(t, 0.0);
+  }
+  if (segment_index + 1 < num_segments()) {
+    t = std::min(t, length);
+  }
+  const double distance = std::hypot(x - (sx + t * ux), y - (sy + t * uy));
+  const double cross = ux * (y - sy) - uy * (x - sx);
+  return FrenetPoint{
+    arc_lengths_[segment_index] + t, cross < 0.0 ? -distance : distance, segment_index};
+}
+
+std::optional<FrenetPoint> FrenetProjector::project(const double x, const double y) const
+{
+  const auto nearest = index_.nearest_segment(x, y);
+  if (!nearest) {
+    return std::nullopt;
+  }
+  return to_frenet(nearest->segment_index, x, y);
+}
+
+std::optional<FrenetPoint> FrenetProjector::project(
+  const double x, const double y, const std::size_t hint) const
+{
+  if (x_.size() < 2) {
+    return std::nullopt;
+  }
+  return to_frenet(nearest_from(hint, x, y), x, y);
+}
+
+geometry_msgs::msg::Pose FrenetProjector::to_pose(
+  const std::size_t segment_index, const double s, const double d) const
+{
+  const double ux = unit_x_[segment_index];
+  const double uy = unit_y_[segment_index];
+  const double offset = s - arc_lengths_[segment_index];
+  const double length = arc_lengths_[segment_index + 1] - arc_lengths_[segment_index];
+  const double ratio = length < min_length ? 0.0 : std::clamp(offset / length, 0.0, 1.0);
+
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x_[segment_index] + offset * ux - d * uy;
+  pose.position.y = y_[segment_index] + offset * uy + d * ux;
+  pose.position.z = z_[segment_index] + ratio * (z_[segment_index + 1] - z_[segment_index]);
+  pose.orientation = create_quaternion_from_yaw(std::atan2(uy, ux));
+  return pose;
+}
+
+std::optional<geometry_msgs::msg::Pose> FrenetProjector::to_pose(
+  const double s, const double d) const
+{
+  if (x_.size() < 2) {
+    return std::nullopt;
+  }
+  // the last segment whose start is not after s, which skips the degenerate segments
+  const auto it = std::upper_bound(arc_lengths_.begin() + 1, arc_lengths_.end() - 1, s);
+  return to_pose(static_cast<std::size_t>(it - arc_lengths_.begin()) - 1, s, d);
+}
+
+bool FrenetProjector::to_poses(
+  const std::vector<FrenetPoint> & points, std::vector<geometry_msgs::msg::Pose> & poses) const
+{
+  poses.clear();
+  if (x_.size() < 2) {
+    return false;
+  }
+  poses.reserve(points.size());
+  std::size_t segment_index = 0;
+  for (const auto & point : points) {
+    while (segment_index + 1 < num_segments() && arc_lengths_[segment_index + 1] <= point.s) {
+      ++segment_index;
+    }
+    while (0 < segment_index && point.s < arc_lengths_[segment_index]) {
+      --segment_index;
+    }
+    poses.push_back(to_pose(segment_index, point.s, point.d));
+  }
+  return true;
+}
+
+}  // namespace autoware_utils_geometry
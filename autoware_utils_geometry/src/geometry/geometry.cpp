@@ -15,13 +15,17 @@
 #include "autoware_utils_geometry/geometry.hpp"
 
 #include "autoware_utils_geometry/gjk_2d.hpp"
+#include "autoware_utils_math/trigonometry.hpp"
 
 #include <Eigen/Geometry>
 #include <tf2/convert.hpp>
 
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
+#include <algorithm>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace tf2
 {
@@ -90,11 +94,45 @@ geometry_msgs::msg::Quaternion create_quaternion_from_rpy(
   return tf2::toMsg(q);
 }
 
-geometry_msgs::msg::Quaternion create_quaternion_from_yaw(const double yaw)
+geometry_msgs::msg::Quaternion create_quaternion_from_yaw(
+  const double yaw, const TrigonometryMode mode)
 {
-  tf2::Quaternion q;
-  q.setRPY(0, 0, yaw);
-  return tf2::toMsg(q);
+  // Same as tf2::Quaternion::setRPY(0, 0, yaw).
+  geometry_msgs::msg::Quaternion q;
+  if (mode == TrigonometryMode::fast) {
+    const auto [sin_half, cos_half] =
+      autoware_utils_math::sin_and_cos(static_cast<float>(yaw) * 0.5f);
+    q.z = sin_half;
+    q.w = cos_half;
+  } else {
+    q.z = std::sin(yaw * 0.5);
+    q.w = std::cos(yaw * 0.5);
+  }
+  return q;
+}
+
+double get_yaw(const geometry_msgs::msg::Quaternion & quat, const TrigonometryMode mode)
+{
+  // Same as the yaw of tf2::Matrix3x3::getRPY.
+  const double y = 2.0 * (quat.w * quat.z + quat.x * quat.y);
+  const double x = 1.0 - 2.0 * (quat.y * quat.y + quat.z * quat.z);
+  if (mode == TrigonometryMode::fast) {
+    // opencv_fast_atan2 returns an angle in [0, 2pi).
+    const double yaw =
+      autoware_utils_math::opencv_fast_atan2(static_cast<float>(y), static_cast<float>(x));
+    return pi < yaw ? yaw - 2.0 * pi : yaw;
+  }
+  return std::atan2(y, x);
+}
+
+void create_quaternions_from_yaws(
+  const std::vector<double> & yaws, std::vector<geometry_msgs::msg::Quaternion> & quaternions,
+  const TrigonometryMode mode)
+{
+  quaternions.resize(yaws.size());
+  for (std::size_t i = 0; i < yaws.size(); ++i) {
+    quaternions[i] = create_quaternion_from_yaw(yaws[i], mode);
+  }
 }
 
 double calc_elevation_angle(
@@ -312,6 +350,96 @@ geometry_msgs::msg::Point inverse_transform_point(
   return local_point;
 }
 
+Point3d transform_point(const Point3d & point, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d transformed = transform.apply(point);
+  return Point3d{transformed.x(), transformed.y(), transformed.z()};
+}
+
+Point2d transform_point(const Point2d & point, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d transformed = transform.apply(Eigen::Vector3d(point.x(), point.y(), 0.0));
+  return Point2d{transformed.x(), transformed.y()};
+}
+
+Point2d transform_point(const Point2d & point, const RigidTransform2d & transform)
+{
+  const Eigen::Vector2d transformed = transform.apply(point);
+  return Point2d{transformed.x(), transformed.y()};
+}
+
+Eigen::Vector3d transform_point(const Eigen::Vector3d & point, const RigidTransform3d & transform)
+{
+  return transform.apply(point);
+}
+
+geometry_msgs::msg::Point transform_point(
+  const geometry_msgs::msg::Point & point, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d transformed = transform.apply(Eigen::Vector3d(point.x, point.y, point.z));
+  return geometry_msgs::build<geometry_msgs::msg::Point>()
+    .x(transformed.x())
+    .y(transformed.y())
+    .z(transformed.z());
+}
+
+geometry_msgs::msg::Point32 transform_point(
+  const geometry_msgs::msg::Point32 & point32, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d transformed =
+    transform.apply(Eigen::Vector3d(point32.x, point32.y, point32.z));
+  return geometry_msgs::build<geometry_msgs::msg::Point32>()
+    .x(transformed.x())
+    .y(transformed.y())
+    .z(transformed.z());
+}
+
+geometry_msgs::msg::Pose transform_pose(
+  const geometry_msgs::msg::Pose & pose, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d position =
+    transform.apply(Eigen::Vector3d(pose.position.x, pose.position.y, pose.position.z));
+
+  geometry_msgs::msg::Pose transformed_pose;
+  transformed_pose.position.x = position.x();
+  transformed_pose.position.y = position.y();
+  transformed_pose.position.z = position.z();
+  transformed_pose.orientation = transform.apply(pose.orientation);
+  return transformed_pose;
+}
+
+geometry_msgs::msg::Pose inverse_transform_pose(
+  const geometry_msgs::msg::Pose & pose, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d position =
+    transform.apply_inverse(Eigen::Vector3d(pose.position.x, pose.position.y, pose.position.z));
+
+  geometry_msgs::msg::Pose transformed_pose;
+  transformed_pose.position.x = position.x();
+  transformed_pose.position.y = position.y();
+  transformed_pose.position.z = position.z();
+  transformed_pose.orientation = transform.apply_inverse(pose.orientation);
+  return transformed_pose;
+}
+
+Eigen::Vector3d inverse_transform_point(
+  const Eigen::Vector3d & point, const RigidTransform3d & transform)
+{
+  return transform.apply_inverse(point);
+}
+
+geometry_msgs::msg::Point inverse_transform_point(
+  const geometry_msgs::msg::Point & point, const RigidTransform3d & transform)
+{
+  const Eigen::Vector3d local_vec =
+    transform.apply_inverse(Eigen::Vector3d(point.x, point.y, point.z));
+  geometry_msgs::msg::Point local_point;
+  local_point.x = local_vec.x();
+  local_point.y = local_vec.y();
+  local_point.z = local_vec.z();
+  return local_point;
+}
+
 double calc_curvature(
   const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
   const geometry_msgs::msg::Point & p3)
@@ -346,6 +474,65 @@ geometry_msgs::msg::Pose calc_offset_pose(
   return pose;
 }
 
+void calc_offset_poses(
+  const geometry_msgs::msg::Pose & p, const std::vector<PoseOffset> & offsets,
+  std::vector<geometry_msgs::msg::Pose> & poses, const TrigonometryMode mode)
+{
+  // tf2::Transform normalizes the rotation of the base pose.
+  const auto & q = p.orientation;
+  const double norm = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  const double qx = q.x / norm;
+  const double qy = q.y / norm;
+  const double qz = q.z / norm;
+  const double qw = q.w / norm;
+
+  // Rotation matrix of the base pose, computed once for all the offsets.
+  const double r00 = 1.0 - 2.0 * (qy * qy + qz * qz);
+  const double r01 = 2.0 * (qx * qy - qz * qw);
+  const double r02 = 2.0 * (qx * qz + qy * qw);
+  const double r10 = 2.0 * (qx * qy + qz * qw);
+  const double r11 = 1.0 - 2.0 * (qx * qx + qz * qz);
+  const double r12 = 2.0 * (qy * qz - qx * qw);
+  const double r20 = 2.0 * (qx * qz - qy * qw);
+  const double r21 = 2.0 * (qy * qz + qx * qw);
+  const double r22 = 1.0 - 2.0 * (qx * qx + qy * qy);
+
+  poses.resize(offsets.size());
+  for (std::size_t i = 0; i < offsets.size(); ++i) {
+    const auto & offset = offsets[i];
+    auto & pose = poses[i];
+    pose.position.x = p.position.x + r00 * offset.x + r01 * offset.y + r02 * offset.z;
+    pose.position.y = p.position.y + r10 * offset.x + r11 * offset.y + r12 * offset.z;
+    pose.position.z = p.position.z + r20 * offset.x + r21 * offset.y + r22 * offset.z;
+
+    // Product of the base rotation and the rotation around the z axis by the offset yaw.
+    double s = 0.0;
+    double c = 1.0;
+    if (mode == TrigonometryMode::fast) {
+      const auto [sin_half, cos_half] =
+        autoware_utils_math::sin_and_cos(static_cast<float>(offset.yaw) * 0.5f);
+      s = sin_half;
+      c = cos_half;
+    } else {
+      s = std::sin(offset.yaw * 0.5);
+      c = std::cos(offset.yaw * 0.5);
+    }
+    pose.orientation.x = qx * c + qy * s;
+    pose.orientation.y = qy * c - qx * s;
+    pose.orientation.z = qz * c + qw * s;
+    pose.orientation.w = qw * c - qz * s;
+  }
+}
+
+std::vector<geometry_msgs::msg::Pose> calc_offset_poses(
+  const geometry_msgs::msg::Pose & p, const std::vector<PoseOffset> & offsets,
+  const TrigonometryMode mode)
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  calc_offset_poses(p, offsets, poses, mode);
+  return poses;
+}
+
 /**
  * @brief Judge whether twist covariance is valid.
  *
@@ -388,9 +575,111 @@ std::optional<geometry_msgs::msg::Point> intersect(
   return intersect_point;
 }
 
+std::vector<PolylineIntersection> intersect_polylines(
+  const std::vector<geometry_msgs::msg::Point> & polyline1,
+  const std::vector<geometry_msgs::msg::Point> & polyline2)
+{
+  struct SegmentBox
+  {
+    double min_x;
+    double max_x;
+    double min_y;
+    double max_y;
+    std::size_t index;
+    bool is_polyline1;
+  };
+
+  // The margin keeps the pairs whose rounded intersection is reported by intersect() at a shared
+  // end point, so that no pair accepted by the double loop is pruned.
+  constexpr double margin = 1e-6;
+  std::vector<SegmentBox> boxes;
+  boxes.reserve(polyline1.size() + polyline2.size());
+  const auto add_boxes = [&](const std::vector<geometry_msgs::msg::Point> & polyline, bool first) {
+    for (std::size_t i = 0; i + 1 < polyline.size(); ++i) {
+      const auto & p = polyline[i];
+      const auto & q = polyline[i + 1];
+      boxes.push_back(SegmentBox{
+        std::min(p.x, q.x) - margin, std::max(p.x, q.x) + margin, std::min(p.y, q.y) - margin,
+        std::max(p.y, q.y) + margin, i, first});
+    }
+  };
+  add_boxes(polyline1, true);
+  add_boxes(polyline2, false);
+  std::sort(boxes.begin(), boxes.end(), [](const SegmentBox & a, const SegmentBox & b) {
+    return a.min_x < b.min_x;
+  });
+
+  std::vector<PolylineIntersection> intersections;
+  std::vector<const SegmentBox *> active1;
+  std::vector<const SegmentBox *> active2;
+  for (const auto & box : boxes) {
+    const auto is_expired = [&](const SegmentBox * b) { return b->max_x < box.min_x; };
+    active1.erase(std::remove_if(active1.begin(), active1.end(), is_expired), active1.end());
+    active2.erase(std::remove_if(active2.begin(), active2.end(), is_expired), active2.end());
+
+    for (const auto * other : box.is_polyline1 ? active2 : active1) {
+      if (other->max_y < box.min_y || box.max_y < other->min_y) {
+        continue;
+      }
+      const auto i = box.is_polyline1 ? box.index : other->index;
+      const auto j = box.is_polyline1 ? other->index : box.index;
+      const auto point = intersect(polyline1[i], polyline1[i + 1], polyline2[j], polyline2[j + 1]);
+      if (point) {
+        intersections.push_back(PolylineIntersection{i, j, *point});
+      }
+    }
+    (box.is_polyline1 ? active1 : active2).push_back(&box);
+  }
+
+  std::sort(
+    intersections.begin(), intersections.end(),
+    [](const PolylineIntersection & a, const PolylineIntersection & b) {
+      return std::tie(a.segment_index1, a.segment_index2) <
+             std::tie(b.segment_index1, b.segment_index2);
+    });
+  return intersections;
+}
+
 bool intersects_convex(const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2)
 {
   return gjk::intersects(convex_polygon1, convex_polygon2);
 }
 
+// the instantiations declared extern in geometry.hpp
+template geometry_msgs::msg::Point calc_interpolated_point(
+  const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Pose &, const double);
+template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_planning_msgs::msg::PathPoint &, const autoware_planning_msgs::msg::PathPoint &,
+  const double);
+template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &,
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &, const double);
+template geometry_msgs::msg::Point calc_interpolated_point(
+  const autoware_planning_msgs::msg::TrajectoryPoint &,
+  const autoware_planning_msgs::msg::TrajectoryPoint &, const double);
+
+template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Pose &, const double, const bool);
+template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_planning_msgs::msg::PathPoint &, const autoware_planning_msgs::msg::PathPoint &,
+  const double, const bool);
+template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &,
+  const autoware_internal_planning_msgs::msg::PathPointWithLaneId &, const double, const bool);
+template geometry_msgs::msg::Pose calc_interpolated_pose(
+  const autoware_planning_msgs::msg::TrajectoryPoint &,
+  const autoware_planning_msgs::msg::TrajectoryPoint &, const double, const bool);
+
+template void split_by_driving_direction(
+  const std::vector<geometry_msgs::msg::Pose> &, std::vector<DrivingDirectionRange> &);
+template void split_by_driving_direction(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> &,
+  std::vector<DrivingDirectionRange> &);
+template void split_by_driving_direction(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  std::vector<DrivingDirectionRange> &);
+template void split_by_driving_direction(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> &,
+  std::vector<DrivingDirectionRange> &);
+
 }  // namespace autoware_utils_geometry
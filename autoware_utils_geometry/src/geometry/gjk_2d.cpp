@@ -15,8 +15,18 @@
 #include <autoware_utils_geometry/boost_geometry.hpp>
 #include <autoware_utils_geometry/gjk_2d.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/equals.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
 namespace autoware_utils_geometry::gjk
 {
 
@@ -110,6 +120,333 @@ bool update_search_simplex_and_direction(SimplexSearch & search)
   }
   return continue_search;
 }
+
+/// @brief vertex of the Minkowski difference with the polygon vertices it comes from
+struct SupportPoint
+{
+  alt::Vector2d w;  // a - b
+  alt::Vector2d a;  // vertex of the first polygon
+  alt::Vector2d b;  // vertex of the second polygon
+};
+
+alt::Vector2d furthest_vertex(const Polygon2d & poly, const alt::Vector2d & direction)
+{
+  const auto & p = poly.outer()[furthest_vertex_idx(poly, Point2d(direction.x(), direction.y()))];
+  return {p.x(), p.y()};
+}
+
+alt::Vector2d furthest_vertex(
+  const alt::ConvexPolygon2dView & poly, const alt::Vector2d & direction)
+{
+  const auto * furthest = poly.begin();
+  for (const auto * it = poly.begin(); it != poly.end(); ++it) {
+    if (direction.dot(*it) > direction.dot(*furthest)) {
+      furthest = it;
+    }
+  }
+  return *furthest;
+}
+
+template <class Polygon>
+SupportPoint support_point(
+  const Polygon & poly1, const Polygon & poly2, const alt::Vector2d & direction)
+{
+  const auto a = furthest_vertex(poly1, direction);
+  const auto b = furthest_vertex(poly2, -direction);
+  return {a - b, a, b};
+}
+
+/// @brief simplex of the GJK distance loop and the barycentric weights of its closest point
+struct DistanceSimplex
+{
+  std::array<SupportPoint, 3> points;
+  std::array<double, 3> weights;
+  std::size_t size;
+};
+
+alt::Vector2d interpolate(const DistanceSimplex & simplex, alt::Vector2d SupportPoint::*member)
+{
+  alt::Vector2d v;
+  for (std::size_t i = 0; i < simplex.size; ++i) {
+    v = v + simplex.weights[i] * (simplex.points[i].*member);
+  }
+  return v;
+}
+
+/// @brief set the simplex to the feature of the segment that is the closest to the origin
+void set_closest_on_segment(
+  DistanceSimplex & simplex, const SupportPoint & p, const SupportPoint & q)
+{
+  const auto pq = q.w - p.w;
+  const double norm2 = pq.norm2();
+  const double t = norm2 > 0.0 ? -p.w.dot(pq) / norm2 : 0.0;
+  if (t <= 0.0) {
+    simplex.points[0] = p;
+    simplex.weights[0] = 1.0;
+    simplex.size = 1;
+  } else if (1.0 <= t) {
+    simplex.points[0] = q;
+    simplex.weights[0] = 1.0;
+    simplex.size = 1;
+  } else {
+    simplex.points[0] = p;
+    simplex.points[1] = q;
+    simplex.weights[0] = 1.0 - t;
+    simplex.weights[1] = t;
+    simplex.size = 2;
+  }
+}
+
+/// @brief reduce the simplex to its feature closest to the origin
+/// @return true if the simplex is a triangle containing the origin
+bool reduce_simplex(DistanceSimplex & simplex)
+{
+  if (simplex.size == 1) {
+    simplex.weights[0] = 1.0;
+    return false;
+  }
+  const auto p0 = simplex.points[0];
+  const auto p1 = simplex.points[1];
+  if (simplex.size == 2) {
+    set_closest_on_segment(simplex, p0, p1);
+    return false;
+  }
+
+  const auto p2 = simplex.points[2];
+  const double area = (p1.w - p0.w).cross(p2.w - p0.w);
+  if (area != 0.0) {
+    const bool inside = 0.0 <= (p1.w - p0.w).cross(-p0.w) * area &&
+                        0.0 <= (p2.w - p1.w).cross(-p1.w) * area &&
+                        0.0 <= (p0.w - p2.w).cross(-p2.w) * area;
+    if (inside) {
+      return true;
+    }
+  }
+
+  // the closest point is on one of the edges
+  const std::array<std::array<const SupportPoint *, 2>, 3> edges{
+    {{&p0, &p1}, {&p1, &p2}, {&p2, &p0}}};
+  double min_norm2 = std::numeric_limits<double>::max();
+  DistanceSimplex closest = simplex;
+  for (const auto & edge : edges) {
+    DistanceSimplex candidate = simplex;
+    set_closest_on_segment(candidate, *edge[0], *edge[1]);
+    const double norm2 = interpolate(candidate, &SupportPoint::w).norm2();
+    if (norm2 < min_norm2) {
+      min_norm2 = norm2;
+      closest = candidate;
+    }
+  }
+  simplex = closest;
+  return false;
+}
+
+/// @brief complete the simplex into a triangle containing the origin for EPA
+/// @return false if the Minkowski difference has no area
+template <class Polygon>
+bool make_initial_polytope(
+  const Polygon & poly1, const Polygon & poly2, std::vector<SupportPoint> & polytope)
+{
+  constexpr double epsilon = 1e-12;
+
+  const auto is_new = [&](const SupportPoint & s) {
+    for (const auto & p : polytope) {
+      if ((p.w - s.w).norm2() < epsilon) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  if (polytope.size() == 1) {
+    for (const auto & direction : {alt::Vector2d(1.0, 0.0), alt::Vector2d(0.0, 1.0)}) {
+      for (const auto & d : {direction, -direction}) {
+        const auto s = support_point(poly1, poly2, d);
+        if (polytope.size() < 2 && is_new(s)) {
+          polytope.push_back(s);
+        }
+      }
+    }
+    if (polytope.size() < 2) {
+      return false;
+    }
+  }
+
+  if (polytope.size() == 2) {
+    const auto edge = polytope[1].w - polytope[0].w;
+    const alt::Vector2d normal(-edge.y(), edge.x());
+    for (const auto & d : {normal, -normal}) {
+      const auto s = support_point(poly1, poly2, d);
+      if (d.dot(s.w - polytope[0].w) > epsilon * std::max(1.0, edge.norm2())) {
+        polytope.push_back(s);
+        break;
+      }
+    }
+    if (polytope.size() < 3) {
+      return false;
+    }
+  }
+
+  // counter-clockwise
+  if ((polytope[1].w - polytope[0].w).cross(polytope[2].w - polytope[0].w) < 0.0) {
+    std::swap(polytope[1], polytope[2]);
+  }
+  return true;
+}
+
+template <class Polygon>
+SignedDistance<alt::Point2d> signed_distance_impl(const Polygon & poly1, const Polygon & poly2)
+{
+  constexpr std::size_t max_iterations = 64;
+  constexpr double relative_epsilon = 1e-10;
+  constexpr double contact_epsilon = 1e-20;
+
+  // GJK for the closest point of the Minkowski difference to the origin
+  DistanceSimplex simplex{};
+  simplex.points[0] = support_point(poly1, poly2, alt::Vector2d(1.0, 0.0));
+  simplex.size = 1;
+  bool contains_origin = false;
+  for (std::size_t i = 0; i < max_iterations; ++i) {
+    contains_origin = reduce_simplex(simplex);
+    if (contains_origin) {
+      break;
+    }
+    const auto v = interpolate(simplex, &SupportPoint::w);
+    const double v_norm2 = v.norm2();
+    if (v_norm2 < contact_epsilon) {
+      contains_origin = true;
+      break;
+    }
+    const auto s = support_point(poly1, poly2, -v);
+    if (v_norm2 - v.dot(s.w) <= relative_epsilon * v_norm2) {
+      break;
+    }
+    simplex.points[simplex.size++] = s;
+  }
+
+  if (!contains_origin) {
+    return {
+      interpolate(simplex, &SupportPoint::w).norm(), interpolate(simplex, &SupportPoint::a),
+      interpolate(simplex, &SupportPoint::b)};
+  }
+
+  // EPA for the closest point of the boundary of the Minkowski difference to the origin
+  std::vector<SupportPoint> polytope(simplex.points.begin(), simplex.points.begin() + simplex.size);
+  if (!make_initial_polytope(poly1, poly2, polytope)) {
+    const auto & s = polytope.front();
+    return {0.0, s.a, s.b};
+  }
+
+  std::size_t closest_edge = 0;
+  double depth = 0.0;
+  for (std::size_t i = 0; i < max_iterations; ++i) {
+    depth = std::numeric_limits<double>::max();
+    alt::Vector2d normal;
+    for (std::size_t j = 0; j < polytope.size(); ++j) {
+      const auto edge = polytope[(j + 1) % polytope.size()].w - polytope[j].w;
+      const auto edge_normal = (1.0 / edge.norm()) * alt::Vector2d(edge.y(), -edge.x());
+      const double distance = edge_normal.dot(polytope[j].w);
+      if (distance < depth) {
+        depth = distance;
+        normal = edge_normal;
+        closest_edge = j;
+      }
+    }
+    const auto s = support_point(poly1, poly2, normal);
+    if (normal.dot(s.w) - depth <= relative_epsilon * std::max(1.0, depth)) {
+      break;
+    }
+    polytope.insert(polytope.begin() + static_cast<std::ptrdiff_t>(closest_edge) + 1, s);
+  }
+
+  const auto & p = polytope[closest_edge];
+  const auto & q = polytope[(closest_edge + 1) % polytope.size()];
+  DistanceSimplex edge{};
+  set_closest_on_segment(edge, p, q);
+  return {-depth, interpolate(edge, &SupportPoint::a), interpolate(edge, &SupportPoint::b)};
+}
+
+/// @brief polygon moved by a Motion2d at a given time, transformed lazily by the support function
+struct MovedPolygon
+{
+  MovedPolygon(const alt::ConvexPolygon2dView & poly, const Motion2d & motion, const double time)
+  : poly(poly),
+    center(motion.rotation_center),
+    translation(time * motion.velocity),
+    cos_yaw(std::cos(motion.angular_velocity * time)),
+    sin_yaw(std::sin(motion.angular_velocity * time))
+  {
+  }
+
+  const alt::ConvexPolygon2dView & poly;
+  alt::Point2d center;
+  alt::Vector2d translation;
+  double cos_yaw;
+  double sin_yaw;
+};
+
+alt::Vector2d furthest_vertex(const MovedPolygon & poly, const alt::Vector2d & direction)
+{
+  // the furthest vertex of the rotated polygon is the rotated furthest vertex in the inverse
+  // rotated direction
+  const alt::Vector2d local_direction(
+    poly.cos_yaw * direction.x() + poly.sin_yaw * direction.y(),
+    -poly.sin_yaw * direction.x() + poly.cos_yaw * direction.y());
+  const auto v = furthest_vertex(poly.poly, local_direction) - poly.center;
+  const alt::Vector2d rotated(
+    poly.cos_yaw * v.x() - poly.sin_yaw * v.y(), poly.sin_yaw * v.x() + poly.cos_yaw * v.y());
+  return poly.center + poly.translation + rotated;
+}
+
+/// @brief speed of a vertex of a moving polygon along a direction, and its distance behind the
+/// furthest vertex in that direction
+struct VertexApproach
+{
+  double speed;
+  double gap;
+};
+
+void vertex_approaches(
+  const MovedPolygon & poly, const Motion2d & motion, const alt::Vector2d & direction,
+  std::vector<VertexApproach> & approaches)
+{
+  approaches.clear();
+  double support = -std::numeric_limits<double>::infinity();
+  for (const auto & p : poly.poly) {
+    // position relative to the rotation center, whose translation is common to the vertices
+    const auto v = p - poly.center;
+    const alt::Vector2d rotated(
+      poly.cos_yaw * v.x() - poly.sin_yaw * v.y(), poly.sin_yaw * v.x() + poly.cos_yaw * v.y());
+    const double speed =
+      motion.velocity.dot(direction) + motion.angular_velocity * rotated.cross(direction);
+    const double position = rotated.dot(direction);
+    approaches.push_back({speed, position});
+    support = std::max(support, position);
+  }
+  for (auto & approach : approaches) {
+    approach.gap = support - approach.gap;
+  }
+}
+
+/// @brief bound of the advance of the furthest vertex after dt, apart from the change of the speeds
+double max_advance(const std::vector<VertexApproach> & approaches, const double dt)
+{
+  double advance = -std::numeric_limits<double>::infinity();
+  for (const auto & approach : approaches) {
+    advance = std::max(advance, approach.speed * dt - approach.gap);
+  }
+  return advance;
+}
+
+/// @brief maximum distance between the vertices and the rotation center
+double max_radius(const alt::ConvexPolygon2dView & poly, const alt::Point2d & center)
+{
+  double max_norm2 = 0.0;
+  for (const auto & p : poly) {
+    max_norm2 = std::max(max_norm2, (p - center).norm2());
+  }
+  return std::sqrt(max_norm2);
+}
 }  // namespace
 
 /// @brief return true if the two given polygons intersect
@@ -146,4 +483,186 @@ bool intersects(const Polygon2d & convex_polygon1, const Polygon2d & convex_poly
   }
   return true;
 }
+
+bool intersects(const PreparedConvexPolygon2d & prepared, const Polygon2d & convex_polygon)
+{
+  if (convex_polygon.outer().empty()) {
+    return false;
+  }
+  return !boxes_disjoint(prepared.box(), boost::geometry::return_envelope<Box2d>(convex_polygon)) &&
+         intersects(prepared.polygon(), convex_polygon);
+}
+
+IntersectionQuery::IntersectionQuery(const Polygon2d & convex_polygon) : polygon_(convex_polygon)
+{
+}
+
+Point2d IntersectionQuery::support(const Polygon2d & convex_polygon, const Point2d & direction)
+{
+  ++support_count_;
+  return support_vertex(polygon_, convex_polygon, direction);
+}
+
+bool IntersectionQuery::intersects(const Polygon2d & convex_polygon)
+{
+  support_count_ = 0;
+  if (polygon_.outer().empty() || convex_polygon.outer().empty()) {
+    return false;
+  }
+  Point2d initial_direction(1.0, 0.0);
+  if (cache_ == Cache::triangle) {
+    // the origin strictly inside the triangle of the new support points is a positive area
+    // intersection, otherwise the loop restarts
+    const auto a = support(convex_polygon, directions_[0]);
+    const auto b = support(convex_polygon, directions_[1]);
+    const auto c = support(convex_polygon, directions_[2]);
+    const auto cross = [](const Point2d & p, const Point2d & q, const Point2d & r) {
+      return (q.x() - p.x()) * (r.y() - p.y()) - (q.y() - p.y()) * (r.x() - p.x());
+    };
+    const double area = cross(a, b, c);
+    const Point2d o(0.0, 0.0);
+    if (0.0 < cross(a, b, o) * area && 0.0 < cross(b, c, o) * area && 0.0 < cross(c, a, o) * area) {
+      return true;
+    }
+    initial_direction = directions_[0];
+  } else if (cache_ == Cache::separating_direction) {
+    initial_direction = directions_[0];
+  }
+  return intersects_cold(convex_polygon, initial_direction);
+}
+
+bool IntersectionQuery::intersects_cold(
+  const Polygon2d & convex_polygon, const Point2d & initial_direction)
+{
+  // same loop as gjk::intersects from the given direction, which also keeps the directions of
+  // the support points of the simplex
+  const auto separated = [&](const Point2d & direction) {
+    cache_ = Cache::separating_direction;
+    directions_[0] = direction;
+    // the equal polygons are intersecting even without area, as in gjk::intersects
+    return boost::geometry::equals(polygon_, convex_polygon);
+  };
+
+  Point2d a_direction = initial_direction;
+  Point2d a = support(convex_polygon, a_direction);
+  if (dot_product(a, a_direction) < 0.0) {  // strictly separated, so not equal either
+    cache_ = Cache::separating_direction;
+    directions_[0] = a_direction;
+    return false;
+  }
+  Point2d b_direction(-a.x(), -a.y());
+  Point2d b = support(convex_polygon, b_direction);
+  if (dot_product(b, b_direction) <= 0.0) {
+    return separated(b_direction);
+  }
+  const Point2d ab(b.x() - a.x(), b.y() - a.y());
+  const Point2d ao(-a.x(), -a.y());
+  Point2d c_direction = cross_product(ab, ao, ab);
+  while (true) {
+    const auto c = support(convex_polygon, c_direction);
+    if (!same_direction(c, c_direction)) {
+      return separated(c_direction);
+    }
+    const Point2d co(-c.x(), -c.y());
+    const Point2d ca(a.x() - c.x(), a.y() - c.y());
+    const Point2d cb(b.x() - c.x(), b.y() - c.y());
+    const auto ca_perpendicular = cross_product(cb, ca, ca);
+    const auto cb_perpendicular = cross_product(ca, cb, cb);
+    if (same_direction(ca_perpendicular, co)) {
+      b = c;
+      b_direction = c_direction;
+      c_direction = ca_perpendicular;
+    } else if (same_direction(cb_perpendicular, co)) {
+      a = c;
+      a_direction = c_direction;
+      c_direction = cb_perpendicular;
+    } else {
+      cache_ = Cache::triangle;
+      directions_ = {a_direction, b_direction, c_direction};
+      return true;
+    }
+  }
+}
+
+std::optional<std::size_t> IntersectionQuery::first_intersection(
+  const std::vector<Polygon2d> & convex_polygons)
+{
+  for (std::size_t i = 0; i < convex_polygons.size(); ++i) {
+    if (intersects(convex_polygons[i])) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+
+SignedDistance<Point2d> signed_distance(
+  const Polygon2d & convex_polygon1, const Polygon2d & convex_polygon2)
+{
+  if (convex_polygon1.outer().empty() || convex_polygon2.outer().empty()) {
+    throw std::invalid_argument("The polygons must not be empty.");
+  }
+  const auto result = signed_distance_impl(convex_polygon1, convex_polygon2);
+  return {
+    result.distance, Point2d(result.point1.x(), result.point1.y()),
+    Point2d(result.point2.x(), result.point2.y())};
+}
+
+SignedDistance<alt::Point2d> signed_distance(
+  const alt::ConvexPolygon2dView & convex_polygon1,
+  const alt::ConvexPolygon2dView & convex_polygon2)
+{
+  return signed_distance_impl(convex_polygon1, convex_polygon2);
+}
+
+std::optional<double> time_of_impact(
+  const alt::ConvexPolygon2dView & convex_polygon1, const Motion2d & motion1,
+  const alt::ConvexPolygon2dView & convex_polygon2, const Motion2d & motion2,
+  const double duration, const double tolerance)
+{
+  constexpr std::size_t max_iterations = 100;
+  constexpr std::size_t bisection_iterations = 40;
+
+  // the speed of a point of a rotating polygon along a fixed direction changes at most by
+  // w^2 * radius per time, the speeds of the vertices are otherwise taken at the current time
+  const double acceleration =
+    motion1.angular_velocity * motion1.angular_velocity *
+      max_radius(convex_polygon1, motion1.rotation_center) +
+    motion2.angular_velocity * motion2.angular_velocity *
+      max_radius(convex_polygon2, motion2.rotation_center);
+
+  std::vector<VertexApproach> approaches1;
+  std::vector<VertexApproach> approaches2;
+  double time = 0.0;
+  for (std::size_t i = 0; i < max_iterations; ++i) {
+    const MovedPolygon moved1(convex_polygon1, motion1, time);
+    const MovedPolygon moved2(convex_polygon2, motion2, time);
+    const auto result = signed_distance_impl(moved1, moved2);
+    if (result.distance <= tolerance) {
+      return time;
+    }
+    // the gap along the direction of the closest points closes at most by the advances of the
+    // furthest vertices of both polygons towards each other, which is convex in the time
+    const auto direction = (1.0 / result.distance) * (result.point2 - result.point1);
+    vertex_approaches(moved1, motion1, direction, approaches1);
+    vertex_approaches(moved2, motion2, -direction, approaches2);
+    const auto closing = [&](const double dt) {
+      return max_advance(approaches1, dt) + max_advance(approaches2, dt) +
+             0.5 * acceleration * dt * dt;
+    };
+    const double remaining = duration - time;
+    if (closing(remaining) < result.distance) {
+      return std::nullopt;
+    }
+    // the largest step after which the gap is not closed
+    double step = 0.0;
+    double upper = remaining;
+    for (std::size_t j = 0; j < bisection_iterations; ++j) {
+      const double middle = 0.5 * (step + upper);
+      (closing(middle) < result.distance ? step : upper) = middle;
+    }
+    time += step;
+  }
+  // not converged, the contact is not excluded after the time reached, which is a lower bound of it
+  return time;
+}
 }  // namespace autoware_utils_geometry::gjk
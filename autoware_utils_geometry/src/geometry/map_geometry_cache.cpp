@@ -0,0 +1,389 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/map_geometry_cache.hpp"
+
+#include "autoware_utils_geometry/ear_clipping.hpp"
+#include "autoware_utils_geometry/packed_rtree.hpp"
+#include "autoware_utils_geometry/small_vector.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr char cache_magic[8] = {'A', 'W', 'M', 'A', 'P', 'G', 'E', 'O'};
+
+/// @brief header of a cache file, followed by the arrays in the order of the counts
+struct CacheHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t reserved;
+  std::uint64_t map_hash;
+  std::uint64_t polygons;
+  std::uint64_t rings;
+  std::uint64_t points;
+  std::uint64_t triangles;
+  std::uint64_t tree_levels;
+  std::uint64_t tree_boxes;
+};
+
+template <class T>
+void write_array(std::ofstream & file, const T * data, const std::size_t size)
+{
+  file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+void write_offsets(std::ofstream & file, const std::vector<std::size_t> & offsets)
+{
+  const std::vector<std::uint64_t> values(offsets.begin(), offsets.end());
+  write_array(file, values.data(), values.size());
+}
+
+void append_ring(
+  const alt::PointList2d & ring, std::vector<double> & coordinates,
+  std::vector<std::size_t> & ring_offsets)
+{
+  for (const auto & point : ring) {
+    coordinates.push_back(point.x());
+    coordinates.push_back(point.y());
+  }
+  ring_offsets.push_back(coordinates.size() / 2);
+}
+
+alt::PointList2d to_ring(const double * coordinates, const std::size_t size)
+{
+  alt::PointList2d ring;
+  ring.reserve(size);
+  for (std::size_t j = 0; j < size; ++j) {
+    ring.emplace_back(coordinates[2 * j], coordinates[2 * j + 1]);
+  }
+  return ring;
+}
+}  // namespace
+
+std::uint64_t map_hash(const void * data, const std::size_t size)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  const auto * bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::optional<std::uint64_t> map_file_hash(const std::string & path)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  const std::vector<char> content(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return map_hash(content.data(), content.size());
+}
+
+bool save_map_geometry_cache(
+  const std::string & path, const std::uint64_t map_hash,
+  const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads)
+{
+  std::vector<std::size_t> polygon_rings{0};
+  std::vector<std::size_t> ring_offsets{0};
+  std::vector<double> coordinates;
+  std::vector<std::size_t> polygon_triangles{0};
+  std::vector<double> triangles;
+  Triangulator triangulator;
+  for (const auto & polygon : polygons) {
+    append_ring(polygon.outer(), coordinates, ring_offsets);
+    for (const auto & inner : polygon.inners()) {
+      append_ring(inner, coordinates, ring_offsets);
+    }
+    polygon_rings.push_back(ring_offsets.size() - 1);
+
+    const auto & indices = triangulator.triangulate(polygon);
+    const auto & points = triangulator.points();
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+      for (std::size_t k = 0; k < 3; ++k) {
+        triangles.push_back(points[indices[i + k]].x());
+        triangles.push_back(points[indices[i + k]].y());
+      }
+    }
+    polygon_triangles.push_back(triangles.size() / 6);
+  }
+
+  PackedRTree tree;
+  tree.build(polygons, num_threads);
+  static_assert(sizeof(PackedRTree::Box) == 4 * sizeof(double));
+
+  // written aside and renamed, so that the processes mapping the previous file keep its pages
+  const std::string temporary_path = path + ".tmp" + std::to_string(::getpid());
+  std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  CacheHeader header{};
+  std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+  header.version = MappedMapGeometry::version;
+  header.map_hash = map_hash;
+  header.polygons = polygons.size();
+  header.rings = ring_offsets.size() - 1;
+  header.points = coordinates.size() / 2;
+  header.triangles = triangles.size() / 6;
+  header.tree_levels = tree.level_offsets_.size();
+  header.tree_boxes = tree.boxes_.size();
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  write_offsets(file, polygon_rings);
+  write_offsets(file, ring_offsets);
+  write_array(file, coordinates.data(), coordinates.size());
+  write_offsets(file, polygon_triangles);
+  write_array(file, triangles.data(), triangles.size());
+  write_offsets(file, tree.level_offsets_);
+  write_array(file, tree.boxes_.data(), tree.boxes_.size());
+  write_offsets(file, tree.indices_);
+  file.close();
+  if (!file || std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+    std::remove(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+std::optional<MappedMapGeometry> MappedMapGeometry::open(
+  const std::string & path, const std::uint64_t map_hash)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  struct stat file_stat;
+  if (
+    ::fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(CacheHeader))) {
+    ::close(fd);
+    return std::nullopt;
+  }
+  const auto length = static_cast<std::size_t>(file_stat.st_size);
+  // shared, so that the processes mapping the same cache share its pages
+  void * data = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return std::nullopt;
+  }
+
+  MappedMapGeometry mapped;
+  mapped.data_ = data;
+  mapped.length_ = length;
+
+  CacheHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  if (
+    std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+    header.version != version || header.map_hash != map_hash) {
+    return std::nullopt;
+  }
+  const std::size_t expected_length =
+    sizeof(header) +
+    sizeof(std::uint64_t) * ((header.polygons + 1) + (header.rings + 1) + (header.polygons + 1) +
+                             header.tree_levels + header.polygons) +
+    sizeof(double) * (2 * header.points + 6 * header.triangles + 4 * header.tree_boxes);
+  if (length != expected_length) {
+    return std::nullopt;
+  }
+
+  const auto * bytes = static_cast<const char *>(data) + sizeof(header);
+  const auto take = [&bytes](auto & array, const std::size_t size) {
+    array = reinterpret_cast<std::remove_reference_t<decltype(array)>>(bytes);
+    bytes += size * sizeof(*array);
+  };
+  mapped.map_hash_ = header.map_hash;
+  mapped.polygons_ = header.polygons;
+  mapped.tree_levels_ = header.tree_levels;
+  take(mapped.polygon_rings_, header.polygons + 1);
+  take(mapped.ring_offsets_, header.rings + 1);
+  take(mapped.coordinates_, 2 * header.points);
+  take(mapped.polygon_triangles_, header.polygons + 1);
+  take(mapped.triangles_, 6 * header.triangles);
+  take(mapped.level_offsets_, header.tree_levels);
+  take(mapped.tree_boxes_, 4 * header.tree_boxes);
+  take(mapped.tree_indices_, header.polygons);
+
+  const bool empty_tree = header.polygons == 0 && header.tree_levels == 0;
+  if (
+    mapped.polygon_rings_[header.polygons] != header.rings ||
+    mapped.ring_offsets_[header.rings] != header.points ||
+    mapped.polygon_triangles_[header.polygons] != header.triangles ||
+    !(empty_tree ||
+      (2 <= header.tree_levels && mapped.level_offsets_[1] == header.polygons &&
+       mapped.level_offsets_[header.tree_levels - 1] == header.tree_boxes))) {
+    return std::nullopt;
+  }
+  return mapped;
+}
+
+MappedMapGeometry::MappedMapGeometry(MappedMapGeometry && other) noexcept
+{
+  *this = std::move(other);
+}
+
+MappedMapGeometry & MappedMapGeometry::operator=(MappedMapGeometry && other) noexcept
+{
+  if (this != &other) {
+    if (data_) {
+      ::munmap(data_, length_);
+    }
+    data_ = std::exchange(other.data_, nullptr);
+    length_ = std::exchange(other.length_, 0);
+    map_hash_ = other.map_hash_;
+    polygons_ = std::exchange(other.polygons_, 0);
+    polygon_rings_ = other.polygon_rings_;
+    ring_offsets_ = other.ring_offsets_;
+    coordinates_ = other.coordinates_;
+    polygon_triangles_ = other.polygon_triangles_;
+    triangles_ = other.triangles_;
+    tree_levels_ = std::exchange(other.tree_levels_, 0);
+    level_offsets_ = other.level_offsets_;
+    tree_boxes_ = other.tree_boxes_;
+    tree_indices_ = other.tree_indices_;
+  }
+  return *this;
+}
+
+MappedMapGeometry::~MappedMapGeometry()
+{
+  if (data_) {
+    ::munmap(data_, length_);
+  }
+}
+
+alt::Polygon2d MappedMapGeometry::polygon(const std::size_t i) const
+{
+  std::vector<alt::PointList2d> inners;
+  for (std::size_t r = 1; r < ring_count(i); ++r) {
+    inners.push_back(to_ring(ring_coordinates(i, r), ring_size(i, r)));
+  }
+  // the rings were written from a valid polygon
+  return alt::Polygon2d::create(to_ring(ring_coordinates(i, 0), ring_size(i, 0)), std::move(inners))
+    .value();
+}
+
+std::vector<alt::ConvexPolygon2d> MappedMapGeometry::triangles(const std::size_t i) const
+{
+  std::vector<alt::ConvexPolygon2d> triangles;
+  triangles.reserve(triangle_count(i));
+  const double * coordinates = triangle_coordinates(i);
+  for (std::size_t t = 0; t < triangle_count(i); ++t, coordinates += 6) {
+    alt::PointList2d vertices;
+    vertices.emplace_back(coordinates[0], coordinates[1]);
+    vertices.emplace_back(coordinates[2], coordinates[3]);
+    vertices.emplace_back(coordinates[4], coordinates[5]);
+    vertices.emplace_back(coordinates[0], coordinates[1]);
+    triangles.push_back(alt::ConvexPolygon2d::create(vertices).value());
+  }
+  return triangles;
+}
+
+PreparedPolygon2d MappedMapGeometry::prepared_polygon(const std::size_t i) const
+{
+  return PreparedPolygon2d(polygon(i));
+}
+
+template <class Visit>
+void MappedMapGeometry::search(
+  const double min_x, const double min_y, const double max_x, const double max_y,
+  const Visit & visit) const
+{
+  if (tree_levels_ < 2) {
+    return;
+  }
+  const auto overlaps = [&](const double * b) {
+    return b[0] <= max_x && min_x <= b[2] && b[1] <= max_y && min_y <= b[3];
+  };
+
+  // the same walk as PackedRTree::search() over the mapped levels
+  struct Node
+  {
+    std::size_t level;
+    std::size_t index;
+  };
+  constexpr std::size_t node_size = PackedRTree::node_size;
+  SmallVector<Node, 128> stack;
+  const std::size_t root_level = tree_levels_ - 2;
+  if (overlaps(tree_boxes_ + 4 * (level_offsets_[tree_levels_ - 1] - 1))) {
+    stack.push_back(Node{root_level, 0});
+  }
+  while (!stack.empty()) {
+    const auto [level, index] = stack.back();
+    stack.pop_back();
+    const std::size_t offset = level_offsets_[level - 1];
+    const std::size_t below = level_offsets_[level] - offset;
+    const std::size_t end = std::min(below, (index + 1) * node_size);
+    for (std::size_t child = index * node_size; child < end; ++child) {
+      if (!overlaps(tree_boxes_ + 4 * (offset + child))) {
+        continue;
+      }
+      if (level == 1) {
+        visit(tree_indices_[child]);
+      } else {
+        stack.push_back(Node{level - 1, child});
+      }
+    }
+  }
+}
+
+void MappedMapGeometry::intersecting(const Box2d & box, std::vector<std::size_t> & indices) const
+{
+  indices.clear();
+  const auto & min = box.min_corner();
+  const auto & max = box.max_corner();
+  search(min.x(), min.y(), max.x(), max.y(), [&indices](const std::size_t index) {
+    indices.push_back(index);
+  });
+}
+
+void MappedMapGeometry::containing(const Point2d & point, std::vector<std::size_t> & indices) const
+{
+  indices.clear();
+  search(point.x(), point.y(), point.x(), point.y(), [&indices](const std::size_t index) {
+    indices.push_back(index);
+  });
+}
+
+std::optional<MappedMapGeometry> load_or_build_map_geometry_cache(
+  const std::string & path, const std::uint64_t map_hash,
+  const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads)
+{
+  auto mapped = MappedMapGeometry::open(path, map_hash);
+  if (mapped) {
+    return mapped;
+  }
+  if (!save_map_geometry_cache(path, map_hash, polygons, num_threads)) {
+    return std::nullopt;
+  }
+  return MappedMapGeometry::open(path, map_hash);
+}
+
+}  // namespace autoware_utils_geometry
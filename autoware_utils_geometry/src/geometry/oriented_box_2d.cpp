@@ -0,0 +1,175 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/oriented_box_2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+/// @brief unit direction of the x axis of a pose projected on the XY plane, i.e. its yaw
+void yaw_axis(const geometry_msgs::msg::Pose & pose, double & axis_x, double & axis_y)
+{
+  // first column of the rotation matrix, in which the norm of the quaternion cancels
+  const auto & q = pose.orientation;
+  const double x = q.w * q.w + q.x * q.x - q.y * q.y - q.z * q.z;
+  const double y = 2.0 * (q.x * q.y + q.z * q.w);
+  const double norm = std::hypot(x, y);
+  axis_x = 0.0 < norm ? x / norm : 1.0;
+  axis_y = 0.0 < norm ? y / norm : 0.0;
+}
+}  // namespace
+
+OrientedBox2d OrientedBox2d::from_footprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width)
+{
+  OrientedBox2d box;
+  yaw_axis(base_link_pose, box.axis_x, box.axis_y);
+  const double offset = 0.5 * (base_to_front - base_to_rear);
+  box.center_x = base_link_pose.position.x + offset * box.axis_x;
+  box.center_y = base_link_pose.position.y + offset * box.axis_y;
+  box.half_length = 0.5 * (base_to_front + base_to_rear);
+  box.half_width = 0.5 * width;
+  return box;
+}
+
+OrientedBox2d OrientedBox2d::from_shape(
+  const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape)
+{
+  if (shape.type != autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    throw std::logic_error("The shape type is not a bounding box.");
+  }
+  OrientedBox2d box;
+  yaw_axis(pose, box.axis_x, box.axis_y);
+  box.center_x = pose.position.x;
+  box.center_y = pose.position.y;
+  box.half_length = 0.5 * shape.dimensions.x;
+  box.half_width = 0.5 * shape.dimensions.y;
+  return box;
+}
+
+Polygon2d OrientedBox2d::to_polygon() const
+{
+  const double lx = half_length * axis_x;
+  const double ly = half_length * axis_y;
+  const double wx = -half_width * axis_y;
+  const double wy = half_width * axis_x;
+  Polygon2d polygon;
+  polygon.outer().reserve(5);
+  polygon.outer().emplace_back(center_x + lx + wx, center_y + ly + wy);
+  polygon.outer().emplace_back(center_x + lx - wx, center_y + ly - wy);
+  polygon.outer().emplace_back(center_x - lx - wx, center_y - ly - wy);
+  polygon.outer().emplace_back(center_x - lx + wx, center_y - ly + wy);
+  polygon.outer().push_back(polygon.outer().front());
+  return polygon;
+}
+
+void OrientedBoxArray2d::clear()
+{
+  center_x_.clear();
+  center_y_.clear();
+  axis_x_.clear();
+  axis_y_.clear();
+  half_length_.clear();
+  half_width_.clear();
+}
+
+void OrientedBoxArray2d::reserve(const std::size_t size)
+{
+  center_x_.reserve(size);
+  center_y_.reserve(size);
+  axis_x_.reserve(size);
+  axis_y_.reserve(size);
+  half_length_.reserve(size);
+  half_width_.reserve(size);
+}
+
+void OrientedBoxArray2d::push_back(const OrientedBox2d & box)
+{
+  center_x_.push_back(box.center_x);
+  center_y_.push_back(box.center_y);
+  axis_x_.push_back(box.axis_x);
+  axis_y_.push_back(box.axis_y);
+  half_length_.push_back(box.half_length);
+  half_width_.push_back(box.half_width);
+}
+
+OrientedBox2d OrientedBoxArray2d::operator[](const std::size_t i) const
+{
+  return OrientedBox2d{center_x_[i], center_y_[i],    axis_x_[i],
+                       axis_y_[i],   half_length_[i], half_width_[i]};
+}
+
+namespace sat
+{
+std::size_t intersects(
+  const OrientedBox2d & box, const OrientedBoxArray2d & boxes, std::vector<char> & results)
+{
+  const std::size_t size = boxes.size();
+  results.resize(size);
+
+  // the arrays and the box copied to locals which the stores cannot alias
+  const double * center_x = boxes.center_x().data();
+  const double * center_y = boxes.center_y().data();
+  const double * axis_x = boxes.axis_x().data();
+  const double * axis_y = boxes.axis_y().data();
+  const double * half_length = boxes.half_length().data();
+  const double * half_width = boxes.half_width().data();
+  const double x1 = box.center_x;
+  const double y1 = box.center_y;
+  const double ux1 = box.axis_x;
+  const double uy1 = box.axis_y;
+  const double l1 = box.half_length;
+  const double w1 = box.half_width;
+
+  // the largest gap between the boxes on the 4 axes of each box of a block is computed in doubles,
+  // which is vectorized unlike the conversion of the comparisons to the results, and the gap is
+  // not positive exactly when the comparisons of intersects() of two boxes hold
+  constexpr std::size_t block_size = 64;
+  double gaps[block_size];
+  std::size_t count = 0;
+  for (std::size_t begin = 0; begin < size; begin += block_size) {
+    const std::size_t block = std::min(block_size, size - begin);
+    for (std::size_t j = 0; j < block; ++j) {
+      const std::size_t i = begin + j;
+      const double dx = center_x[i] - x1;
+      const double dy = center_y[i] - y1;
+      const double ux2 = axis_x[i];
+      const double uy2 = axis_y[i];
+      const double l2 = half_length[i];
+      const double w2 = half_width[i];
+      const double c = std::abs(ux1 * ux2 + uy1 * uy2);
+      const double s = std::abs(ux1 * uy2 - uy1 * ux2);
+      const double gap1 = std::abs(dx * ux1 + dy * uy1) - (l1 + c * l2 + s * w2);
+      const double gap2 = std::abs(dy * ux1 - dx * uy1) - (w1 + s * l2 + c * w2);
+      const double gap3 = std::abs(dx * ux2 + dy * uy2) - (l2 + c * l1 + s * w1);
+      const double gap4 = std::abs(dy * ux2 - dx * uy2) - (w2 + s * l1 + c * w1);
+      gaps[j] = std::max(std::max(gap1, gap2), std::max(gap3, gap4));
+    }
+    for (std::size_t j = 0; j < block; ++j) {
+      const bool hit = gaps[j] <= 0.0;
+      results[begin + j] = static_cast<char>(hit);
+      count += hit;
+    }
+  }
+  return count;
+}
+}  // namespace sat
+
+}  // namespace autoware_utils_geometry
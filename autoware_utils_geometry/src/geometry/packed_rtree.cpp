@@ -0,0 +1,266 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/packed_rtree.hpp"
+
+#include "autoware_utils_geometry/small_vector.hpp"
+
+#include <autoware_utils_system/thread_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr std::size_t min_items_per_thread = 4096;
+constexpr std::size_t min_parallel_items = 8192;
+
+std::size_t count_threads(const std::size_t num_items, const std::size_t num_threads)
+{
+  return num_items < min_parallel_items
+           ? 1
+           : std::min(num_threads, (num_items + min_items_per_thread - 1) / min_items_per_thread);
+}
+
+/// @brief call f(begin, end) on at most threads chunks of [0, size) on the shared thread pool
+template <class Function>
+void parallel_for(const std::size_t size, const std::size_t threads, const Function & f)
+{
+  if (threads <= 1 || size <= 1) {
+    f(0, size);
+    return;
+  }
+  const std::size_t chunk = (size + threads - 1) / threads;
+  autoware_utils_system::ThreadPool::shared().parallel_for(0, size, chunk, f);
+}
+
+template <class Box, class Polygons, class GetRing>
+void compute_boxes(
+  const Polygons & polygons, const GetRing & get_ring, const std::size_t threads,
+  std::vector<Box> & boxes)
+{
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  boxes.resize(polygons.size());
+  parallel_for(polygons.size(), threads, [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      Box box{inf, inf, -inf, -inf};
+      for (const auto & point : get_ring(polygons[i])) {
+        box.min_x = std::min(box.min_x, point.x());
+        box.min_y = std::min(box.min_y, point.y());
+        box.max_x = std::max(box.max_x, point.x());
+        box.max_y = std::max(box.max_y, point.y());
+      }
+      boxes[i] = box;
+    }
+  });
+}
+}  // namespace
+
+void PackedRTree::build(const std::vector<Polygon2d> & polygons, const std::size_t num_threads)
+{
+  const auto outer = [](const Polygon2d & polygon) -> const auto & { return polygon.outer(); };
+  compute_boxes(polygons, outer, count_threads(polygons.size(), num_threads), items_);
+  pack(num_threads);
+}
+
+void PackedRTree::build(const std::vector<alt::Polygon2d> & polygons, const std::size_t num_threads)
+{
+  const auto outer = [](const alt::Polygon2d & polygon) -> const auto & { return polygon.outer(); };
+  compute_boxes(polygons, outer, count_threads(polygons.size(), num_threads), items_);
+  pack(num_threads);
+}
+
+void PackedRTree::build(
+  const std::vector<alt::ConvexPolygon2d> & polygons, const std::size_t num_threads)
+{
+  const auto vertices = [](const alt::ConvexPolygon2d & polygon) -> const auto & {
+    return polygon.vertices();
+  };
+  compute_boxes(polygons, vertices, count_threads(polygons.size(), num_threads), items_);
+  pack(num_threads);
+}
+
+void PackedRTree::build(const std::vector<Box2d> & boxes, const std::size_t num_threads)
+{
+  items_.resize(boxes.size());
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    const auto & min = boxes[i].min_corner();
+    const auto & max = boxes[i].max_corner();
+    items_[i] = Box{min.x(), min.y(), max.x(), max.y()};
+  }
+  pack(num_threads);
+}
+
+void PackedRTree::clear()
+{
+  items_.clear();
+  keys_.clear();
+  boxes_.clear();
+  indices_.clear();
+  level_offsets_.clear();
+}
+
+void PackedRTree::pack(const std::size_t num_threads)
+{
+  const std::size_t n = items_.size();
+  boxes_.clear();
+  indices_.clear();
+  level_offsets_.clear();
+  if (n == 0) {
+    return;
+  }
+
+  // sort by x in chunks, one per thread, merged in place
+  const std::size_t threads = count_threads(n, num_threads);
+  const auto by_value = [](const Key & a, const Key & b) { return a.value < b.value; };
+  keys_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys_[i] = Key{items_[i].min_x + items_[i].max_x, i};
+  }
+  const std::size_t chunk = (n + threads - 1) / threads;
+  parallel_for(threads, threads, [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t t = begin; t < end; ++t) {
+      std::sort(
+        keys_.begin() + std::min(n, t * chunk), keys_.begin() + std::min(n, (t + 1) * chunk),
+        by_value);
+    }
+  });
+  for (std::size_t t = 1; t * chunk < n; ++t) {
+    std::inplace_merge(
+      keys_.begin(), keys_.begin() + t * chunk, keys_.begin() + std::min(n, (t + 1) * chunk),
+      by_value);
+  }
+
+  // cut into slices of whole leaves, sorted by y
+  const std::size_t leaves = (n + node_size - 1) / node_size;
+  const auto slices = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(leaves))));
+  const std::size_t slice_size = (leaves + slices - 1) / slices * node_size;
+  const std::size_t num_slices = (n + slice_size - 1) / slice_size;
+  parallel_for(num_slices, threads, [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t s = begin; s < end; ++s) {
+      const auto first = keys_.begin() + s * slice_size;
+      const auto last = keys_.begin() + std::min(n, (s + 1) * slice_size);
+      for (auto it = first; it != last; ++it) {
+        it->value = items_[it->index].min_y + items_[it->index].max_y;
+      }
+      std::sort(first, last, by_value);
+    }
+  });
+
+  // the levels up to the root, which is above the items even if there is only one
+  level_offsets_.push_back(0);
+  level_offsets_.push_back(n);
+  std::size_t level_size = n;
+  do {
+    level_size = (level_size + node_size - 1) / node_size;
+    level_offsets_.push_back(level_offsets_.back() + level_size);
+  } while (1 < level_size);
+  boxes_.resize(level_offsets_.back());
+  indices_.resize(n);
+
+  parallel_for(n, threads, [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      boxes_[i] = items_[keys_[i].index];
+      indices_[i] = keys_[i].index;
+    }
+  });
+  for (std::size_t level = 1; level + 1 < level_offsets_.size(); ++level) {
+    const std::size_t nodes = level_offsets_[level + 1] - level_offsets_[level];
+    const std::size_t level_threads = count_threads(nodes * node_size, num_threads);
+    parallel_for(nodes, level_threads, [&](const std::size_t begin, const std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node) {
+        const auto [first, last] = children(level, node);
+        const std::size_t offset = level_offsets_[level - 1];
+        Box box = boxes_[offset + first];
+        for (std::size_t child = first + 1; child < last; ++child) {
+          const auto & b = boxes_[offset + child];
+          box = Box{std::min(box.min_x, b.min_x), std::min(box.min_y, b.min_y),
+                    std::max(box.max_x, b.max_x), std::max(box.max_y, b.max_y)};
+        }
+        boxes_[level_offsets_[level] + node] = box;
+      }
+    });
+  }
+}
+
+template <class Visit>
+void PackedRTree::search(const Box & box, const Visit & visit) const
+{
+  if (empty()) {
+    return;
+  }
+  const auto overlaps = [&box](const Box & b) {
+    return b.min_x <= box.max_x && box.min_x <= b.max_x && b.min_y <= box.max_y &&
+           box.min_y <= b.max_y;
+  };
+
+  // the depth is logarithmic, so the pending nodes fit in the inline storage in practice
+  struct Node
+  {
+    std::size_t level;
+    std::size_t index;
+  };
+  SmallVector<Node, 128> stack;
+  const std::size_t root_level = level_offsets_.size() - 2;
+  if (overlaps(boxes_.back())) {
+    stack.push_back(Node{root_level, 0});
+  }
+  while (!stack.empty()) {
+    const auto [level, index] = stack.back();
+    stack.pop_back();
+    const auto [begin, end] = children(level, index);
+    const std::size_t offset = level_offsets_[level - 1];
+    for (std::size_t child = begin; child < end; ++child) {
+      if (!overlaps(boxes_[offset + child])) {
+        continue;
+      }
+      if (level == 1) {
+        visit(indices_[child]);
+      } else {
+        stack.push_back(Node{level - 1, child});
+      }
+    }
+  }
+}
+
+void PackedRTree::intersecting(const Box2d & box, std::vector<std::size_t> & indices) const
+{
+  indices.clear();
+  const auto & min = box.min_corner();
+  const auto & max = box.max_corner();
+  search(Box{min.x(), min.y(), max.x(), max.y()}, [&indices](const std::size_t index) {
+    indices.push_back(index);
+  });
+}
+
+void PackedRTree::containing(const Point2d & point, std::vector<std::size_t> & indices) const
+{
+  indices.clear();
+  search(Box{point.x(), point.y(), point.x(), point.y()}, [&indices](const std::size_t index) {
+    indices.push_back(index);
+  });
+}
+
+void PackedRTree::nearest(
+  const Point2d & point, const std::size_t k, std::vector<std::size_t> & indices) const
+{
+  nearest(point, k, indices, [](const std::size_t) { return 0.0; });
+}
+
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,64 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/path_profile.hpp"
+
+#include <cmath>
+
+namespace autoware_utils_geometry
+{
+
+void PathProfile::recompute(const std::size_t begin)
+{
+  const std::size_t size = x_.size();
+  const std::size_t num_segments = size == 0 ? 0 : size - 1;
+  // The segment and the curvature before the first changed point also use that point.
+  const std::size_t prev = begin == 0 ? 0 : begin - 1;
+
+  segment_lengths_.resize(num_segments);
+  headings_.resize(num_segments);
+  for (std::size_t i = prev; i < num_segments; ++i) {
+    const double dx = x_[i + 1] - x_[i];
+    const double dy = y_[i + 1] - y_[i];
+    segment_lengths_[i] = std::hypot(dx, dy);
+    headings_[i] = std::atan2(dy, dx);
+  }
+
+  arc_lengths_.resize(size);
+  if (begin == 0 && size != 0) {
+    arc_lengths_[0] = 0.0;
+  }
+  for (std::size_t i = std::max<std::size_t>(begin, 1); i < size; ++i) {
+    arc_lengths_[i] = arc_lengths_[i - 1] + segment_lengths_[i - 1];
+  }
+
+  // Menger curvature, see calc_curvature. Only the edge between the two neighbors is new.
+  curvatures_.resize(size);
+  for (std::size_t i = prev; i < size; ++i) {
+    if (i == 0 || i + 1 == size) {
+      curvatures_[i] = 0.0;
+      continue;
+    }
+    const double dx01 = x_[i] - x_[i - 1];
+    const double dy01 = y_[i] - y_[i - 1];
+    const double dx02 = x_[i + 1] - x_[i - 1];
+    const double dy02 = y_[i + 1] - y_[i - 1];
+    const double denominator =
+      segment_lengths_[i - 1] * segment_lengths_[i] * std::hypot(dx02, dy02);
+    curvatures_[i] =
+      std::fabs(denominator) < 1e-10 ? 0.0 : 2.0 * (dx01 * dy02 - dy01 * dx02) / denominator;
+  }
+}
+
+}  // namespace autoware_utils_geometry
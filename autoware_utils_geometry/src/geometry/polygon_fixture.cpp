@@ -0,0 +1,213 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/polygon_fixture.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <utility>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr char fixture_magic[8] = {'A', 'W', 'P', 'O', 'L', 'Y', '0', '1'};
+
+/// @brief header of a fixture file, followed by the offsets and the interleaved coordinates
+struct FixtureHeader
+{
+  char magic[8];
+  std::uint64_t polygons;
+  std::uint64_t vertices;
+  double max;
+  std::uint64_t seed;
+  std::uint64_t points;
+};
+
+bool same_params(const PolygonFixtureParams & a, const PolygonFixtureParams & b)
+{
+  return a.polygons == b.polygons && a.vertices == b.vertices && a.max == b.max &&
+         a.seed == b.seed;
+}
+}  // namespace
+
+void generate_polygon_fixture(const PolygonFixtureParams & params, PolygonArray2d & polygons)
+{
+  std::mt19937_64 random_engine(params.seed);
+  polygons.points.clear();
+  polygons.offsets.assign(1, 0);
+  polygons.points.reserve(params.polygons * (params.vertices + 1));
+  polygons.offsets.reserve(params.polygons + 1);
+  for (std::size_t i = 0; i < params.polygons; ++i) {
+    const auto polygon = random_star_polygon(params.vertices, params.max, random_engine);
+    for (const auto & point : polygon.outer()) {
+      polygons.points.push_back(to_plain(point));
+    }
+    polygons.offsets.push_back(polygons.points.size());
+  }
+}
+
+bool save_polygon_fixture(
+  const std::string & path, const PolygonFixtureParams & params, const PolygonArray2d & polygons)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+
+  FixtureHeader header{};
+  std::memcpy(header.magic, fixture_magic, sizeof(fixture_magic));
+  header.polygons = polygons.size();
+  header.vertices = params.vertices;
+  header.max = params.max;
+  header.seed = params.seed;
+  header.points = polygons.points.size();
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (const auto offset : polygons.offsets) {
+    const auto value = static_cast<std::uint64_t>(offset);
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  // the points are interleaved x and y as in the file
+  file.write(
+    reinterpret_cast<const char *>(polygons.points.data()),
+    static_cast<std::streamsize>(polygons.points.size() * sizeof(PlainPoint2d)));
+  return static_cast<bool>(file);
+}
+
+std::optional<MappedPolygonArray> MappedPolygonArray::open(const std::string & path)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  struct stat file_stat;
+  if (
+    ::fstat(fd, &file_stat) != 0 ||
+    file_stat.st_size < static_cast<off_t>(sizeof(FixtureHeader))) {
+    ::close(fd);
+    return std::nullopt;
+  }
+  const auto length = static_cast<std::size_t>(file_stat.st_size);
+  void * data = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return std::nullopt;
+  }
+
+  MappedPolygonArray mapped;
+  mapped.data_ = data;
+  mapped.length_ = length;
+
+  FixtureHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  const std::size_t expected_length = sizeof(header) +
+                                      (header.polygons + 1) * sizeof(std::uint64_t) +
+                                      header.points * 2 * sizeof(double);
+  if (
+    std::memcmp(header.magic, fixture_magic, sizeof(fixture_magic)) != 0 ||
+    length != expected_length) {
+    return std::nullopt;
+  }
+
+  mapped.params_.polygons = header.polygons;
+  mapped.params_.vertices = header.vertices;
+  mapped.params_.max = header.max;
+  mapped.params_.seed = header.seed;
+  const auto * bytes = static_cast<const char *>(data);
+  mapped.offsets_ = reinterpret_cast<const std::uint64_t *>(bytes + sizeof(header));
+  mapped.coordinates_ = reinterpret_cast<const double *>(
+    bytes + sizeof(header) + (header.polygons + 1) * sizeof(std::uint64_t));
+  if (mapped.offsets_[header.polygons] != header.points) {
+    return std::nullopt;
+  }
+  return mapped;
+}
+
+MappedPolygonArray::MappedPolygonArray(MappedPolygonArray && other) noexcept
+: data_(std::exchange(other.data_, nullptr)),
+  length_(std::exchange(other.length_, 0)),
+  params_(other.params_),
+  offsets_(std::exchange(other.offsets_, nullptr)),
+  coordinates_(std::exchange(other.coordinates_, nullptr))
+{
+}
+
+MappedPolygonArray & MappedPolygonArray::operator=(MappedPolygonArray && other) noexcept
+{
+  if (this != &other) {
+    if (data_) {
+      ::munmap(data_, length_);
+    }
+    data_ = std::exchange(other.data_, nullptr);
+    length_ = std::exchange(other.length_, 0);
+    params_ = other.params_;
+    offsets_ = std::exchange(other.offsets_, nullptr);
+    coordinates_ = std::exchange(other.coordinates_, nullptr);
+  }
+  return *this;
+}
+
+MappedPolygonArray::~MappedPolygonArray()
+{
+  if (data_) {
+    ::munmap(data_, length_);
+  }
+}
+
+Polygon2d MappedPolygonArray::polygon(const std::size_t i) const
+{
+  Polygon2d polygon;
+  const auto * coordinates = ring_coordinates(i);
+  const auto size = ring_size(i);
+  polygon.outer().reserve(size);
+  for (std::size_t j = 0; j < size; ++j) {
+    polygon.outer().emplace_back(coordinates[2 * j], coordinates[2 * j + 1]);
+  }
+  return polygon;
+}
+
+void MappedPolygonArray::polygon(const std::size_t i, PlainPolygon2d & polygon) const
+{
+  polygon.inners().clear();
+  polygon.outer().resize(ring_size(i));
+  std::memcpy(
+    polygon.outer().data(), ring_coordinates(i), polygon.outer().size() * sizeof(PlainPoint2d));
+}
+
+std::optional<MappedPolygonArray> load_or_generate_polygon_fixture(
+  const std::string & path, const PolygonFixtureParams & params)
+{
+  auto mapped = MappedPolygonArray::open(path);
+  if (mapped && same_params(mapped->params(), params)) {
+    return mapped;
+  }
+  mapped.reset();
+
+  PolygonArray2d polygons;
+  generate_polygon_fixture(params, polygons);
+  if (!save_polygon_fixture(path, params, polygons)) {
+    return std::nullopt;
+  }
+  return MappedPolygonArray::open(path);
+}
+
+}  // namespace autoware_utils_geometry
@@ -28,6 +28,9 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <cmath>
+#include <limits>
+
 namespace autoware_utils_geometry
 {
 
@@ -82,4 +85,49 @@ PoseDeviation calc_pose_deviation(
 
   return deviation;
 }
+
+void PoseDeviationArray::resize(const std::size_t size, const bool with_yaw)
+{
+  lateral.resize(size);
+  longitudinal.resize(size);
+  yaw.resize(with_yaw ? size : 0);
+}
+
+PoseDeviationFrame::PoseDeviationFrame(const geometry_msgs::msg::Pose & base_pose)
+: x_(base_pose.position.x),
+  y_(base_pose.position.y),
+  yaw_(tf2::getYaw(base_pose.orientation)),
+  cos_(std::cos(yaw_)),
+  sin_(std::sin(yaw_))
+{
+}
+
+double PoseDeviationFrame::yaw(const geometry_msgs::msg::Quaternion & target_orientation) const
+{
+  return autoware_utils_math::normalize_radian(tf2::getYaw(target_orientation) - yaw_);
+}
+
+std::optional<std::size_t> find_min_deviation_index(
+  const PoseDeviationArray & deviations, const double max_dist, const double max_yaw)
+{
+  const bool check_yaw = !deviations.yaw.empty();
+  const double max_squared_dist = max_dist * max_dist;
+
+  std::optional<std::size_t> min_index;
+  double min_squared_dist = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < deviations.size(); ++i) {
+    const double squared_dist = deviations.lateral[i] * deviations.lateral[i] +
+                                deviations.longitudinal[i] * deviations.longitudinal[i];
+    if (max_squared_dist < squared_dist || (min_index && min_squared_dist <= squared_dist)) {
+      continue;
+    }
+    if (check_yaw && max_yaw < std::abs(deviations.yaw[i])) {
+      continue;
+    }
+    min_squared_dist = squared_dist;
+    min_index = i;
+  }
+
+  return min_index;
+}
 }  // namespace autoware_utils_geometry
@@ -0,0 +1,79 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/prepared_convex_polygon.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+std::vector<Point2d> edge_normals(const Polygon2d & polygon)
+{
+  std::vector<Point2d> normals;
+  const auto & outer = polygon.outer();
+  normals.reserve(outer.size());
+  for (std::size_t i = 0; i < outer.size(); ++i) {
+    const auto & p1 = outer[i];
+    const auto & p2 = outer[(i + 1) % outer.size()];
+    const Point2d normal(p2.y() - p1.y(), p1.x() - p2.x());
+    if (normal.x() != 0.0 || normal.y() != 0.0) {  // the closing point makes an empty edge
+      normals.push_back(normal);
+    }
+  }
+  return normals;
+}
+}  // namespace
+
+PreparedConvexPolygon2d::PreparedConvexPolygon2d(const Polygon2d & convex_polygon)
+: PreparedConvexPolygon2d(convex_polygon, edge_normals(convex_polygon))
+{
+}
+
+PreparedConvexPolygon2d::PreparedConvexPolygon2d(
+  const Polygon2d & convex_polygon, std::vector<Point2d> axes)
+: polygon_(convex_polygon), axes_(std::move(axes))
+{
+  if (polygon_.outer().empty()) {
+    throw std::invalid_argument("The polygon must not be empty.");
+  }
+  projections_.reserve(axes_.size());
+  for (const auto & axis : axes_) {
+    double min = polygon_.outer().front().dot(axis);
+    double max = min;
+    for (const auto & point : polygon_.outer()) {
+      const double projection = point.dot(axis);
+      min = std::min(min, projection);
+      max = std::max(max, projection);
+    }
+    projections_.emplace_back(min, max);
+  }
+  boost::geometry::envelope(polygon_, box_);
+}
+
+bool boxes_disjoint(const Box2d & box1, const Box2d & box2)
+{
+  return box1.max_corner().x() < box2.min_corner().x() ||
+         box2.max_corner().x() < box1.min_corner().x() ||
+         box1.max_corner().y() < box2.min_corner().y() ||
+         box2.max_corner().y() < box1.min_corner().y();
+}
+
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,310 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/prepared_polygon.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr double epsilon = 1e-6;
+
+using Edge = std::pair<alt::Point2d, alt::Point2d>;
+
+template <class Ring>
+void append_edges(const Ring & ring, std::vector<Edge> & edges)
+{
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    const alt::Point2d p1(ring[i]);
+    const alt::Point2d p2(ring[(i + 1) % ring.size()]);
+    if (p1.x() != p2.x() || p1.y() != p2.y()) {  // the closing point makes an empty edge
+      edges.emplace_back(p1, p2);
+    }
+  }
+}
+
+/// @brief same boundary tolerance as covered_by() with a convex polygon
+bool on_edge(const alt::Point2d & point, const Edge & edge)
+{
+  const auto start_vec = point - edge.first;
+  const auto end_vec = point - edge.second;
+  return std::abs(start_vec.cross(end_vec)) < epsilon && start_vec.dot(end_vec) <= 0.;
+}
+
+bool is_left(const alt::Point2d & a, const alt::Point2d & b, const alt::Point2d & point)
+{
+  return (b - a).cross(point - a) > 0.0;
+}
+
+/**
+ * @brief check if the segment from a to b crosses the edge
+ * @details the points on the line of the segment are on its right side, so that an edge ending on
+ *          the segment is counted with exactly one of its neighbors
+ */
+bool crosses(const alt::Point2d & a, const alt::Point2d & b, const Edge & edge)
+{
+  return is_left(a, b, edge.first) != is_left(a, b, edge.second) &&
+         is_left(edge.first, edge.second, a) != is_left(edge.first, edge.second, b);
+}
+}  // namespace
+
+PreparedPolygon2d::PreparedPolygon2d(const Polygon2d & polygon)
+{
+  append_edges(polygon.outer(), edges_);
+  if (edges_.empty()) {
+    throw std::invalid_argument("The outer ring of the polygon must have edges.");
+  }
+  for (const auto & inner : polygon.inners()) {
+    append_edges(inner, edges_);
+  }
+  build();
+}
+
+PreparedPolygon2d::PreparedPolygon2d(const alt::Polygon2d & polygon)
+{
+  append_edges(polygon.outer(), edges_);
+  if (edges_.empty()) {
+    throw std::invalid_argument("The outer ring of the polygon must have edges.");
+  }
+  for (const auto & inner : polygon.inners()) {
+    append_edges(inner, edges_);
+  }
+  build();
+}
+
+void PreparedPolygon2d::build()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  min_corner_ = alt::Point2d(inf, inf);
+  max_corner_ = alt::Point2d(-inf, -inf);
+  for (const auto & [p1, p2] : edges_) {
+    min_corner_ = alt::Point2d(
+      std::min({min_corner_.x(), p1.x(), p2.x()}), std::min({min_corner_.y(), p1.y(), p2.y()}));
+    max_corner_ = alt::Point2d(
+      std::max({max_corner_.x(), p1.x(), p2.x()}), std::max({max_corner_.y(), p1.y(), p2.y()}));
+  }
+
+  // about one edge per cell, with cells as square as possible
+  const double num_edges = static_cast<double>(edges_.size());
+  const double width = std::max(max_corner_.x() - min_corner_.x(), epsilon);
+  const double height = std::max(max_corner_.y() - min_corner_.y(), epsilon);
+  const auto cells = [&](const double ratio) {
+    return std::clamp<std::size_t>(std::lround(std::sqrt(num_edges * ratio)), 1, edges_.size());
+  };
+  cols_ = cells(width / height);
+  rows_ = cells(height / width);
+  cell_width_ = width / static_cast<double>(cols_);
+  cell_height_ = height / static_cast<double>(rows_);
+
+  // bucket the edges in the cells they pass through, row by row, with a margin for the rounding
+  const auto for_each_cell = [&](const Edge & edge, const auto & callback) {
+    const auto & [p1, p2] = edge;
+    const std::size_t row_begin = cell_row(std::min(p1.y(), p2.y()) - epsilon);
+    const std::size_t row_end = cell_row(std::max(p1.y(), p2.y()) + epsilon);
+    for (std::size_t row = row_begin; row <= row_end; ++row) {
+      double x_min = std::min(p1.x(), p2.x());
+      double x_max = std::max(p1.x(), p2.x());
+      if (p1.y() != p2.y()) {
+        const double y0 = min_corner_.y() + static_cast<double>(row) * cell_height_;
+        const double t0 = std::clamp((y0 - p1.y()) / (p2.y() - p1.y()), 0.0, 1.0);
+        const double t1 = std::clamp((y0 + cell_height_ - p1.y()) / (p2.y() - p1.y()), 0.0, 1.0);
+        const double x0 = p1.x() + t0 * (p2.x() - p1.x());
+        const double x1 = p1.x() + t1 * (p2.x() - p1.x());
+        x_min = std::min(x0, x1);
+        x_max = std::max(x0, x1);
+      }
+      const std::size_t col_end = cell_col(x_max + epsilon);
+      for (std::size_t col = cell_col(x_min - epsilon); col <= col_end; ++col) {
+        callback(row * cols_ + col);
+      }
+    }
+  };
+
+  const std::size_t num_cells = cols_ * rows_;
+  cell_offsets_.assign(num_cells + 1, 0);
+  for (const auto & edge : edges_) {
+    for_each_cell(edge, [&](const std::size_t cell) { ++cell_offsets_[cell + 1]; });
+  }
+  for (std::size_t cell = 0; cell < num_cells; ++cell) {
+    cell_offsets_[cell + 1] += cell_offsets_[cell];
+  }
+  cell_edges_.resize(cell_offsets_.back());
+  std::vector<std::size_t> fill(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  for (std::size_t i = 0; i < edges_.size(); ++i) {
+    for_each_cell(edges_[i], [&](const std::size_t cell) { cell_edges_[fill[cell]++] = i; });
+  }
+
+  // reference points away from the edges, the center of the cell if possible
+  constexpr std::array<std::pair<double, double>, 5> candidates{
+    {{0.5, 0.5}, {0.25, 0.25}, {0.75, 0.75}, {0.25, 0.75}, {0.75, 0.25}}};
+  references_.resize(num_cells);
+  for (std::size_t cell = 0; cell < num_cells; ++cell) {
+    const double x0 = min_corner_.x() + static_cast<double>(cell % cols_) * cell_width_;
+    const double y0 = min_corner_.y() + static_cast<double>(cell / cols_) * cell_height_;
+    for (const auto & [u, v] : candidates) {
+      references_[cell] = alt::Point2d(x0 + u * cell_width_, y0 + v * cell_height_);
+      const bool near_edge = std::any_of(
+        cell_edges_.begin() + cell_offsets_[cell], cell_edges_.begin() + cell_offsets_[cell + 1],
+        [&](const std::size_t i) { return on_edge(references_[cell], edges_[i]); });
+      if (!near_edge) {
+        break;
+      }
+    }
+  }
+
+  // containment of the first reference with a ray cast over all the edges, then propagated to the
+  // neighboring cells by counting the edges crossed between their references
+  reference_inside_.assign(num_cells, 0);
+  const auto & first = references_.front();
+  bool inside = false;
+  for (const auto & [p1, p2] : edges_) {
+    if (
+      (p1.y() > first.y()) != (p2.y() > first.y()) &&
+      first.x() < p1.x() + (first.y() - p1.y()) * (p2.x() - p1.x()) / (p2.y() - p1.y())) {
+      inside = !inside;
+    }
+  }
+  reference_inside_.front() = inside;
+
+  std::vector<std::size_t> stamps(edges_.size(), num_cells);
+  const auto propagate = [&](const std::size_t from, const std::size_t to) {
+    bool to_inside = reference_inside_[from];
+    for (const auto cell : {from, to}) {
+      for (std::size_t k = cell_offsets_[cell]; k < cell_offsets_[cell + 1]; ++k) {
+        const std::size_t i = cell_edges_[k];
+        if (stamps[i] != to && crosses(references_[from], references_[to], edges_[i])) {
+          to_inside = !to_inside;
+        }
+        stamps[i] = to;
+      }
+    }
+    reference_inside_[to] = to_inside;
+  };
+  for (std::size_t row = 0; row < rows_; ++row) {
+    if (row > 0) {
+      propagate((row - 1) * cols_, row * cols_);
+    }
+    for (std::size_t col = 1; col < cols_; ++col) {
+      propagate(row * cols_ + col - 1, row * cols_ + col);
+    }
+  }
+}
+
+std::size_t PreparedPolygon2d::cell_col(const double x) const
+{
+  const double col = std::floor((x - min_corner_.x()) / cell_width_);
+  return static_cast<std::size_t>(std::clamp(col, 0.0, static_cast<double>(cols_ - 1)));
+}
+
+std::size_t PreparedPolygon2d::cell_row(const double y) const
+{
+  const double row = std::floor((y - min_corner_.y()) / cell_height_);
+  return static_cast<std::size_t>(std::clamp(row, 0.0, static_cast<double>(rows_ - 1)));
+}
+
+PreparedPolygon2d::Location PreparedPolygon2d::locate(const alt::Point2d & point) const
+{
+  if (
+    point.x() < min_corner_.x() - epsilon || point.x() > max_corner_.x() + epsilon ||
+    point.y() < min_corner_.y() - epsilon || point.y() > max_corner_.y() + epsilon) {
+    return Location::outside;
+  }
+
+  const std::size_t cell = cell_row(point.y()) * cols_ + cell_col(point.x());
+  const auto & reference = references_[cell];
+  bool inside = reference_inside_[cell];
+  for (std::size_t k = cell_offsets_[cell]; k < cell_offsets_[cell + 1]; ++k) {
+    const auto & edge = edges_[cell_edges_[k]];
+    if (on_edge(point, edge)) {
+      return Location::boundary;
+    }
+    if (crosses(point, reference, edge)) {
+      inside = !inside;
+    }
+  }
+  return inside ? Location::inside : Location::outside;
+}
+
+bool covered_by(const alt::Point2d & point, const PreparedPolygon2d & poly)
+{
+  return poly.locate(point) != PreparedPolygon2d::Location::outside;
+}
+
+double distance(const alt::Point2d & point, const PreparedPolygon2d & poly)
+{
+  if (covered_by(point, poly)) {
+    return 0.0;
+  }
+
+  // visit the rings of cells around the cell of the point until the unvisited cells are farther
+  // than the closest edge found
+  const std::size_t col = poly.cell_col(point.x());
+  const std::size_t row = poly.cell_row(point.y());
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (std::size_t radius = 0;; ++radius) {
+    const std::size_t col_begin = col - std::min(col, radius);
+    const std::size_t col_end = std::min(col + radius, poly.cols_ - 1);
+    const std::size_t row_begin = row - std::min(row, radius);
+    const std::size_t row_end = std::min(row + radius, poly.rows_ - 1);
+    for (std::size_t r = row_begin; r <= row_end; ++r) {
+      const bool border_row = r + radius == row || r == row + radius;
+      for (std::size_t c = col_begin; c <= col_end; ++c) {
+        if (!border_row && c + radius != col && c != col + radius) {
+          continue;  // visited with a smaller radius
+        }
+        const std::size_t cell = r * poly.cols_ + c;
+        for (std::size_t k = poly.cell_offsets_[cell]; k < poly.cell_offsets_[cell + 1]; ++k) {
+          const auto & [p1, p2] = poly.edges_[poly.cell_edges_[k]];
+          min_distance = std::min(min_distance, distance(point, p1, p2));
+        }
+      }
+    }
+
+    double unvisited_distance = std::numeric_limits<double>::infinity();
+    if (col_begin > 0) {
+      const double x = poly.min_corner_.x() + static_cast<double>(col_begin) * poly.cell_width_;
+      unvisited_distance = std::min(unvisited_distance, point.x() - x);
+    }
+    if (col_end + 1 < poly.cols_) {
+      const double x = poly.min_corner_.x() + static_cast<double>(col_end + 1) * poly.cell_width_;
+      unvisited_distance = std::min(unvisited_distance, x - point.x());
+    }
+    if (row_begin > 0) {
+      const double y = poly.min_corner_.y() + static_cast<double>(row_begin) * poly.cell_height_;
+      unvisited_distance = std::min(unvisited_distance, point.y() - y);
+    }
+    if (row_end + 1 < poly.rows_) {
+      const double y = poly.min_corner_.y() + static_cast<double>(row_end + 1) * poly.cell_height_;
+      unvisited_distance = std::min(unvisited_distance, y - point.y());
+    }
+    if (min_distance <= unvisited_distance) {
+      return min_distance;
+    }
+  }
+}
+
+bool within(const alt::Point2d & point, const PreparedPolygon2d & poly)
+{
+  return poly.locate(point) == PreparedPolygon2d::Location::inside;
+}
+
+}  // namespace autoware_utils_geometry
@@ -16,6 +16,8 @@
 
 #include "autoware_utils_geometry/boost_geometry.hpp"
 
+#include <autoware_utils_system/thread_pool.hpp>
+
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
@@ -23,6 +25,8 @@
 #include <boost/version.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <limits>
 #include <list>
 #include <random>
@@ -347,6 +351,60 @@ bool test_intersection(
   return false;
 }
 
+IntersectionReport compare_intersection_predicates(
+  const std::vector<Polygon2d> & polygons1, const std::vector<Polygon2d> & polygons2,
+  const std::vector<IntersectionPredicate> & predicates, const std::size_t num_threads,
+  const std::size_t max_disagreements)
+{
+  IntersectionReport report;
+  const std::size_t num_pairs = polygons1.size() * polygons2.size();
+  report.pairs = num_pairs;
+
+  // results[k][i * polygons2.size() + j] of the k-th predicate on polygons1[i] and polygons2[j]
+  std::vector<std::vector<char>> results(predicates.size(), std::vector<char>(num_pairs));
+  const std::size_t threads = std::max<std::size_t>(1, std::min(num_threads, polygons1.size()));
+  const std::size_t chunk = (polygons1.size() + threads - 1) / threads;
+  for (std::size_t k = 0; k < predicates.size(); ++k) {
+    const auto & predicate = predicates[k];
+    auto & predicate_results = results[k];
+    const auto run = [&](const std::size_t begin, const std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        for (std::size_t j = 0; j < polygons2.size(); ++j) {
+          predicate_results[i * polygons2.size() + j] =
+            predicate.intersects(polygons1[i], polygons2[j]) ? 1 : 0;
+        }
+      }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    if (threads <= 1) {
+      run(0, polygons1.size());
+    } else {
+      autoware_utils_system::ThreadPool::shared().parallel_for(0, polygons1.size(), chunk, run);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    IntersectionReport::PredicateResult result;
+    result.name = predicate.name;
+    result.intersections = static_cast<std::size_t>(
+      std::count(predicate_results.begin(), predicate_results.end(), 1));
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    result.pairs_per_second =
+      result.elapsed_ms > 0.0 ? static_cast<double>(num_pairs) * 1e3 / result.elapsed_ms : 0.0;
+    report.results.push_back(result);
+  }
+
+  for (std::size_t p = 0; p < num_pairs && report.disagreements.size() < max_disagreements; ++p) {
+    for (std::size_t k = 1; k < results.size(); ++k) {
+      if (results[k][p] != results[0][p]) {
+        report.disagreements.emplace_back(p / polygons2.size(), p % polygons2.size());
+        break;
+      }
+    }
+  }
+  return report;
+}
+
 std::optional<Polygon2d> random_concave_polygon(const size_t vertices, const double max)
 {
   if (vertices < 4) {
@@ -412,4 +470,55 @@ std::optional<Polygon2d> random_concave_polygon(const size_t vertices, const dou
   }
   return poly;
 }
+
+Polygon2d random_star_polygon(
+  const size_t vertices, const double max, std::mt19937_64 & random_engine)
+{
+  Polygon2d poly;
+  if (vertices < 4) {
+    return poly;
+  }
+
+  // one vertex per angular sector, the vertex to dent is in the middle of its sector and its
+  // neighbors are kept close enough so that the angle between them is less than pi
+  const auto dented = std::uniform_int_distribution<size_t>(0, vertices - 1)(random_engine);
+  const size_t prev_index = (dented + vertices - 1) % vertices;
+  const size_t next_index = (dented + 1) % vertices;
+  std::uniform_real_distribution<double> radius_dist(0.5 * max, max);
+  const double sector = 2.0 * M_PI / static_cast<double>(vertices);
+  auto & ring = poly.outer();
+  ring.reserve(vertices + 1);
+  std::vector<double> angles(vertices);
+  for (size_t i = 0; i < vertices; ++i) {
+    double jitter = 0.5;
+    if (i == prev_index) {
+      jitter = std::uniform_real_distribution<double>(0.55, 0.9)(random_engine);
+    } else if (i == next_index) {
+      jitter = std::uniform_real_distribution<double>(0.1, 0.45)(random_engine);
+    } else if (i != dented) {
+      jitter = std::uniform_real_distribution<double>(0.1, 0.9)(random_engine);
+    }
+    // counter-clockwise, reversed at the end
+    angles[i] = (static_cast<double>(i) + jitter) * sector;
+    const double radius = radius_dist(random_engine);
+    ring.emplace_back(radius * std::cos(angles[i]), radius * std::sin(angles[i]));
+  }
+
+  // move the vertex to half of the distance to the segment between its neighbors along its ray,
+  // inside the triangle of the neighbors and the origin, so it is reflex and the polygon stays
+  // star-shaped around the origin
+  const auto & prev = ring[prev_index];
+  const auto & next = ring[next_index];
+  const double dir_x = std::cos(angles[dented]);
+  const double dir_y = std::sin(angles[dented]);
+  const double edge_x = next.x() - prev.x();
+  const double edge_y = next.y() - prev.y();
+  const double ray_dist =
+    (prev.x() * edge_y - prev.y() * edge_x) / (dir_x * edge_y - dir_y * edge_x);
+  ring[dented] = Point2d(0.5 * ray_dist * dir_x, 0.5 * ray_dist * dir_y);
+
+  ring.push_back(ring.front());
+  std::reverse(ring.begin(), ring.end());
+  return poly;
+}
 }  // namespace autoware_utils_geometry
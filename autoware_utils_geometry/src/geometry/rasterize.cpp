@@ -0,0 +1,255 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/rasterize.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+void check_size(const std::size_t size, const GridLayout & layout)
+{
+  if (size != layout.size()) {
+    throw std::invalid_argument("The size of the cells does not match the layout of the grid.");
+  }
+}
+
+/// @brief first index whose cell center is at or after a coordinate, clamped to [0, size]
+std::size_t first_center_at_or_after(
+  const double coordinate, const double origin, const double resolution, const std::size_t size)
+{
+  const double index = std::ceil((coordinate - origin) / resolution - 0.5);
+  return static_cast<std::size_t>(std::clamp(index, 0.0, static_cast<double>(size)));
+}
+
+/// @brief add the edges of a ring crossing the center line of a row, closed or not
+template <class Ring>
+void add_edges(const Ring & ring, const GridLayout & layout, RasterizeBuffer & buffer)
+{
+  const std::size_t size = ring.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto & p1 = ring[i];
+    const auto & p2 = ring[i + 1 == size ? 0 : i + 1];
+    if (p1.y() == p2.y()) {
+      continue;
+    }
+    // the rows whose centers are in [min y, max y), so that a vertex is crossed once
+    const double min_y = std::min(p1.y(), p2.y());
+    const double max_y = std::max(p1.y(), p2.y());
+    const std::size_t first_row =
+      first_center_at_or_after(min_y, layout.origin_y, layout.resolution, layout.height);
+    const std::size_t last_row =
+      first_center_at_or_after(max_y, layout.origin_y, layout.resolution, layout.height);
+    if (last_row <= first_row) {
+      continue;
+    }
+    const double slope = (p2.x() - p1.x()) / (p2.y() - p1.y());
+    const double first_y =
+      layout.origin_y + (static_cast<double>(first_row) + 0.5) * layout.resolution;
+    buffer.edges.push_back(RasterizeBuffer::Edge{
+      first_row, last_row, p1.x() + (first_y - p1.y()) * slope, slope * layout.resolution});
+  }
+}
+
+/// @brief fill the cells between the pairs of crossings of the edges in the buffer
+void fill_edges(
+  const GridLayout & layout, std::vector<std::uint8_t> & cells, const std::uint8_t value,
+  RasterizeBuffer & buffer)
+{
+  auto & edges = buffer.edges;
+  auto & active = buffer.active;
+  auto & crossings = buffer.crossings;
+  if (edges.empty()) {
+    return;
+  }
+  std::sort(edges.begin(), edges.end(), [](const auto & a, const auto & b) {
+    return a.first_row < b.first_row;
+  });
+
+  active.clear();
+  std::size_t next = 0;
+  std::size_t row = edges.front().first_row;
+  while (next < edges.size() || !active.empty()) {
+    if (active.empty()) {
+      row = edges[next].first_row;
+    }
+    for (; next < edges.size() && edges[next].first_row == row; ++next) {
+      active.push_back(next);
+    }
+
+    crossings.clear();
+    for (const auto e : active) {
+      const auto & edge = edges[e];
+      crossings.push_back(edge.x + static_cast<double>(row - edge.first_row) * edge.dx);
+    }
+    std::sort(crossings.begin(), crossings.end());
+    auto * cells_row = cells.data() + row * layout.width;
+    for (std::size_t k = 0; k + 1 < crossings.size(); k += 2) {
+      const std::size_t begin = first_center_at_or_after(
+        crossings[k], layout.origin_x, layout.resolution, layout.width);
+      const std::size_t end = first_center_at_or_after(
+        crossings[k + 1], layout.origin_x, layout.resolution, layout.width);
+      std::fill(cells_row + begin, cells_row + std::max(begin, end), value);
+    }
+
+    ++row;
+    active.erase(
+      std::remove_if(
+        active.begin(), active.end(), [&](const auto e) { return edges[e].last_row <= row; }),
+      active.end());
+  }
+}
+
+/// @brief squared distance transform of a line in place, Felzenszwalb and Huttenlocher
+void distance_transform_1d(
+  std::vector<double> & f, std::vector<double> & d, std::vector<std::size_t> & v,
+  std::vector<double> & z)
+{
+  const std::size_t n = f.size();
+  d.resize(n);
+  v.resize(n);
+  z.resize(n + 1);
+  constexpr double inf = std::numeric_limits<double>::infinity();
+
+  // lower envelope of the parabolas rooted at the cells
+  std::size_t k = 0;
+  v[0] = 0;
+  z[0] = -inf;
+  z[1] = inf;
+  for (std::size_t q = 1; q < n; ++q) {
+    const auto qd = static_cast<double>(q);
+    // z[0] is -inf, and the values are finite, so that the first parabola is never removed
+    double s = 0.0;
+    while (true) {
+      const auto vk = static_cast<double>(v[k]);
+      s = ((f[q] + qd * qd) - (f[v[k]] + vk * vk)) / (2.0 * qd - 2.0 * vk);
+      if (z[k] < s) {
+        break;
+      }
+      --k;
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = inf;
+  }
+
+  k = 0;
+  for (std::size_t q = 0; q < n; ++q) {
+    while (z[k + 1] < static_cast<double>(q)) {
+      ++k;
+    }
+    const double dq = static_cast<double>(q) - static_cast<double>(v[k]);
+    d[q] = dq * dq + f[v[k]];
+  }
+  f.swap(d);
+}
+}  // namespace
+
+void rasterize(
+  const Polygon2d & polygon, const GridLayout & layout, std::vector<std::uint8_t> & cells,
+  const std::uint8_t value, RasterizeBuffer & buffer)
+{
+  check_size(cells.size(), layout);
+  buffer.edges.clear();
+  add_edges(polygon.outer(), layout, buffer);
+  for (const auto & inner : polygon.inners()) {
+    add_edges(inner, layout, buffer);
+  }
+  fill_edges(layout, cells, value, buffer);
+}
+
+void rasterize(
+  const alt::Polygon2d & polygon, const GridLayout & layout, std::vector<std::uint8_t> & cells,
+  const std::uint8_t value, RasterizeBuffer & buffer)
+{
+  check_size(cells.size(), layout);
+  buffer.edges.clear();
+  add_edges(polygon.outer(), layout, buffer);
+  for (const auto & inner : polygon.inners()) {
+    add_edges(inner, layout, buffer);
+  }
+  fill_edges(layout, cells, value, buffer);
+}
+
+void rasterize(
+  const std::vector<Polygon2d> & polygons, const GridLayout & layout,
+  std::vector<std::uint8_t> & cells, const std::uint8_t value)
+{
+  RasterizeBuffer buffer;
+  for (const auto & polygon : polygons) {
+    rasterize(polygon, layout, cells, value, buffer);
+  }
+}
+
+void rasterize(
+  const std::vector<alt::Polygon2d> & polygons, const GridLayout & layout,
+  std::vector<std::uint8_t> & cells, const std::uint8_t value)
+{
+  RasterizeBuffer buffer;
+  for (const auto & polygon : polygons) {
+    rasterize(polygon, layout, cells, value, buffer);
+  }
+}
+
+void distance_transform(
+  const std::vector<std::uint8_t> & cells, const GridLayout & layout,
+  const std::uint8_t threshold, std::vector<float> & distances)
+{
+  check_size(cells.size(), layout);
+  const std::size_t width = layout.width;
+  const std::size_t height = layout.height;
+  distances.assign(cells.size(), std::numeric_limits<float>::infinity());
+  if (cells.empty()) {
+    return;
+  }
+
+  // large enough for any squared distance in the grid, and finite for the envelope
+  const double far = 2.0 * static_cast<double>(width * width + height * height) + 1.0;
+  std::vector<double> squared(cells.size());
+  std::vector<double> f;
+  std::vector<double> d;
+  std::vector<std::size_t> v;
+  std::vector<double> z;
+
+  // the columns, then the rows of the column distances
+  f.resize(height);
+  for (std::size_t column = 0; column < width; ++column) {
+    for (std::size_t row = 0; row < height; ++row) {
+      f[row] = threshold <= cells[row * width + column] ? 0.0 : far;
+    }
+    distance_transform_1d(f, d, v, z);
+    for (std::size_t row = 0; row < height; ++row) {
+      squared[row * width + column] = f[row];
+    }
+  }
+  for (std::size_t row = 0; row < height; ++row) {
+    f.assign(squared.begin() + row * width, squared.begin() + (row + 1) * width);
+    distance_transform_1d(f, d, v, z);
+    for (std::size_t column = 0; column < width; ++column) {
+      if (f[column] < far) {
+        distances[row * width + column] =
+          static_cast<float>(std::sqrt(f[column]) * layout.resolution);
+      }
+    }
+  }
+}
+
+}  // namespace autoware_utils_geometry
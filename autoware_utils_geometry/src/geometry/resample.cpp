@@ -0,0 +1,163 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/resample.hpp"
+
+#include "autoware_utils_math/constants.hpp"
+#include "autoware_utils_math/normalization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+double get_yaw(const geometry_msgs::msg::Quaternion & q)
+{
+  return std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+}
+
+// Same as create_quaternion_from_rpy(0.0, pitch, yaw) without going through tf2.
+geometry_msgs::msg::Quaternion quaternion_from_pitch_yaw(const double pitch, const double yaw)
+{
+  const double cp = std::cos(pitch * 0.5);
+  const double sp = std::sin(pitch * 0.5);
+  const double cy = std::cos(yaw * 0.5);
+  const double sy = std::sin(yaw * 0.5);
+
+  geometry_msgs::msg::Quaternion q;
+  q.x = -sy * sp;
+  q.y = cy * sp;
+  q.z = sy * cp;
+  q.w = cy * cp;
+  return q;
+}
+
+// Same as tf2::slerp, which keeps the shortest path and does not normalize the output.
+geometry_msgs::msg::Quaternion slerp(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b,
+  const double t)
+{
+  const double magnitude = std::sqrt(
+    (a.x * a.x + a.y * a.y + a.z * a.z + a.w * a.w) *
+    (b.x * b.x + b.y * b.y + b.z * b.z + b.w * b.w));
+  const double product = (a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) / magnitude;
+  const double abs_product = std::fabs(product);
+  if (1.0 - 1e-15 <= abs_product) {
+    return a;
+  }
+
+  const double theta = std::acos(abs_product);
+  const double d = std::sin(theta);
+  const double s0 = std::sin((1.0 - t) * theta) / d;
+  const double s1 = std::sin(t * theta) / d * (product < 0.0 ? -1.0 : 1.0);
+
+  geometry_msgs::msg::Quaternion q;
+  q.x = a.x * s0 + b.x * s1;
+  q.y = a.y * s0 + b.y * s1;
+  q.z = a.z * s0 + b.z * s1;
+  q.w = a.w * s0 + b.w * s1;
+  return q;
+}
+
+// Values of calc_interpolated_pose that only depend on the segment.
+struct Segment
+{
+  double length;
+  bool is_driving_forward;
+  geometry_msgs::msg::Quaternion orientation;
+};
+
+Segment make_segment(const geometry_msgs::msg::Pose & src, const geometry_msgs::msg::Pose & dst)
+{
+  const double dx = dst.position.x - src.position.x;
+  const double dy = dst.position.y - src.position.y;
+  const double dz = dst.position.z - src.position.z;
+  const double length = std::hypot(dx, dy);
+  const double azimuth = std::atan2(dy, dx);
+  const bool is_driving_forward =
+    std::fabs(autoware_utils_math::normalize_radian(get_yaw(src.orientation) - azimuth)) <
+    autoware_utils_math::pi / 2.0;
+
+  // The direction is from the interpolated point to dst, or to src when driving backward, whose
+  // yaw is wrapped as the azimuth so that the quaternion has the same sign.
+  const auto orientation =
+    is_driving_forward
+      ? quaternion_from_pitch_yaw(std::atan2(dz, length), azimuth)
+      : quaternion_from_pitch_yaw(
+          std::atan2(-dz, length),
+          autoware_utils_math::normalize_radian(azimuth + autoware_utils_math::pi));
+  return Segment{length, is_driving_forward, orientation};
+}
+}  // namespace
+
+void resample_poses(
+  const std::vector<geometry_msgs::msg::Pose> & poses, const std::vector<double> & arc_lengths,
+  std::vector<geometry_msgs::msg::Pose> & output,
+  const bool set_orientation_from_position_direction)
+{
+  output.resize(arc_lengths.size());
+  if (poses.empty()) {
+    output.clear();
+    return;
+  }
+  if (poses.size() == 1) {
+    std::fill(output.begin(), output.end(), poses.front());
+    return;
+  }
+
+  const std::size_t num_segments = poses.size() - 1;
+  std::size_t index = 0;
+  double segment_start = 0.0;
+  Segment segment = make_segment(poses[0], poses[1]);
+
+  for (std::size_t i = 0; i < arc_lengths.size(); ++i) {
+    const double s = arc_lengths[i];
+    while (index + 1 < num_segments && segment_start + segment.length < s) {
+      segment_start += segment.length;
+      ++index;
+      segment = make_segment(poses[index], poses[index + 1]);
+    }
+    // Unsorted input is still handled, by walking back.
+    while (0 < index && s < segment_start) {
+      --index;
+      segment = make_segment(poses[index], poses[index + 1]);
+      segment_start -= segment.length;
+    }
+
+    const auto & src = poses[index];
+    const auto & dst = poses[index + 1];
+    const double ratio =
+      segment.length < 1e-12 ? 0.0 : std::clamp((s - segment_start) / segment.length, 0.0, 1.0);
+
+    auto & pose = output[i];
+    pose.position.x = src.position.x + ratio * (dst.position.x - src.position.x);
+    pose.position.y = src.position.y + ratio * (dst.position.y - src.position.y);
+    pose.position.z = src.position.z + ratio * (dst.position.z - src.position.z);
+
+    if (!set_orientation_from_position_direction) {
+      pose.orientation = slerp(src.orientation, dst.orientation, ratio);
+    } else if ((segment.is_driving_forward && ratio > 1.0 - (1e-6)) || segment.length < 1e-3) {
+      pose.orientation = dst.orientation;
+    } else if (!segment.is_driving_forward && ratio < 1e-6) {
+      pose.orientation = src.orientation;
+    } else {
+      pose.orientation = segment.orientation;
+    }
+  }
+}
+
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,146 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/rigid_transform.hpp"
+
+#include <cmath>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+Eigen::Quaterniond to_eigen(const geometry_msgs::msg::Quaternion & q)
+{
+  return Eigen::Quaterniond(q.w, q.x, q.y, q.z);
+}
+
+geometry_msgs::msg::Quaternion to_quaternion_msg(const Eigen::Quaterniond & q)
+{
+  geometry_msgs::msg::Quaternion msg;
+  msg.x = q.x();
+  msg.y = q.y();
+  msg.z = q.z();
+  msg.w = q.w();
+  return msg;
+}
+
+double to_yaw(const geometry_msgs::msg::Quaternion & q)
+{
+  return std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+}
+}  // namespace
+
+RigidTransform3d::RigidTransform3d(
+  const Eigen::Quaterniond & rotation, const Eigen::Vector3d & translation)
+: rotation_(rotation.normalized().toRotationMatrix()),
+  translation_(translation),
+  quaternion_(rotation.normalized()),
+  inverse_translation_(-(rotation_.transpose() * translation_))
+{
+}
+
+RigidTransform3d::RigidTransform3d(const geometry_msgs::msg::Transform & transform)
+: RigidTransform3d(
+    to_eigen(transform.rotation),
+    Eigen::Vector3d(transform.translation.x, transform.translation.y, transform.translation.z))
+{
+}
+
+RigidTransform3d::RigidTransform3d(const geometry_msgs::msg::TransformStamped & transform)
+: RigidTransform3d(transform.transform)
+{
+}
+
+RigidTransform3d::RigidTransform3d(const geometry_msgs::msg::Pose & pose)
+: RigidTransform3d(
+    to_eigen(pose.orientation), Eigen::Vector3d(pose.position.x, pose.position.y, pose.position.z))
+{
+}
+
+RigidTransform3d RigidTransform3d::inverse() const
+{
+  RigidTransform3d inv;
+  inv.rotation_ = rotation_.transpose();
+  inv.translation_ = inverse_translation_;
+  inv.quaternion_ = quaternion_.conjugate();
+  inv.inverse_translation_ = translation_;
+  return inv;
+}
+
+RigidTransform3d RigidTransform3d::operator*(const RigidTransform3d & other) const
+{
+  return RigidTransform3d(quaternion_ * other.quaternion_, apply(other.translation_));
+}
+
+geometry_msgs::msg::Quaternion RigidTransform3d::apply(
+  const geometry_msgs::msg::Quaternion & orientation) const
+{
+  return to_quaternion_msg((quaternion_ * to_eigen(orientation)).normalized());
+}
+
+geometry_msgs::msg::Quaternion RigidTransform3d::apply_inverse(
+  const geometry_msgs::msg::Quaternion & orientation) const
+{
+  return to_quaternion_msg((quaternion_.conjugate() * to_eigen(orientation)).normalized());
+}
+
+geometry_msgs::msg::Transform RigidTransform3d::to_msg() const
+{
+  geometry_msgs::msg::Transform transform;
+  transform.translation.x = translation_.x();
+  transform.translation.y = translation_.y();
+  transform.translation.z = translation_.z();
+  transform.rotation = to_quaternion_msg(quaternion_);
+  return transform;
+}
+
+RigidTransform2d::RigidTransform2d(const double yaw, const double x, const double y)
+: cos_(std::cos(yaw)), sin_(std::sin(yaw)), x_(x), y_(y)
+{
+}
+
+RigidTransform2d::RigidTransform2d(const geometry_msgs::msg::Transform & transform)
+: RigidTransform2d(to_yaw(transform.rotation), transform.translation.x, transform.translation.y)
+{
+}
+
+RigidTransform2d::RigidTransform2d(const geometry_msgs::msg::TransformStamped & transform)
+: RigidTransform2d(transform.transform)
+{
+}
+
+RigidTransform2d::RigidTransform2d(const geometry_msgs::msg::Pose & pose)
+: RigidTransform2d(to_yaw(pose.orientation), pose.position.x, pose.position.y)
+{
+}
+
+double RigidTransform2d::yaw() const
+{
+  return std::atan2(sin_, cos_);
+}
+
+RigidTransform2d RigidTransform2d::inverse() const
+{
+  return {cos_, -sin_, -(cos_ * x_ + sin_ * y_), sin_ * x_ - cos_ * y_};
+}
+
+RigidTransform2d RigidTransform2d::operator*(const RigidTransform2d & other) const
+{
+  const auto origin = apply(Eigen::Vector2d(other.x_, other.y_));
+  return {
+    cos_ * other.cos_ - sin_ * other.sin_, sin_ * other.cos_ + cos_ * other.sin_, origin.x(),
+    origin.y()};
+}
+
+}  // namespace autoware_utils_geometry
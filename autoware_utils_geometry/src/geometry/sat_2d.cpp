@@ -14,6 +14,8 @@
 
 #include <autoware_utils_geometry/sat_2d.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
+
 #include <utility>
 
 namespace autoware_utils_geometry::sat
@@ -66,6 +68,18 @@ bool has_no_separating_axis(const Polygon2d & polygon, const Polygon2d & other)
   }
   return true;
 }
+
+/// @brief check if the projections of a polygon overlap the precomputed ones on all their axes
+bool has_no_separating_axis(const PreparedConvexPolygon2d & prepared, const Polygon2d & other)
+{
+  for (size_t i = 0; i < prepared.axes().size(); ++i) {
+    const auto projection = project_polygon(other, prepared.axes()[i]);
+    if (!projections_overlap(prepared.projections()[i], projection)) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
 /// @brief check if two convex polygons intersect using the SAT algorithm
@@ -79,4 +93,22 @@ bool intersects(const Polygon2d & convex_polygon1, const Polygon2d & convex_poly
          has_no_separating_axis(convex_polygon2, convex_polygon1);
 }
 
+bool intersects(const PreparedConvexPolygon2d & prepared, const Polygon2d & convex_polygon)
+{
+  if (convex_polygon.outer().empty()) {
+    return false;
+  }
+  return !boxes_disjoint(prepared.box(), boost::geometry::return_envelope<Box2d>(convex_polygon)) &&
+         has_no_separating_axis(prepared, convex_polygon) &&
+         has_no_separating_axis(convex_polygon, prepared.polygon());
+}
+
+bool intersects(
+  const PreparedConvexPolygon2d & prepared1, const PreparedConvexPolygon2d & prepared2)
+{
+  return !boxes_disjoint(prepared1.box(), prepared2.box()) &&
+         has_no_separating_axis(prepared1, prepared2.polygon()) &&
+         has_no_separating_axis(prepared2, prepared1.polygon());
+}
+
 }  // namespace autoware_utils_geometry::sat
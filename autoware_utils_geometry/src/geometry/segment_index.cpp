@@ -0,0 +1,216 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/segment_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+double squared_distance_to_box(
+  const double x, const double y, const double min_x, const double min_y, const double max_x,
+  const double max_y)
+{
+  const double dx = std::max({min_x - x, 0.0, x - max_x});
+  const double dy = std::max({min_y - y, 0.0, y - max_y});
+  return dx * dx + dy * dy;
+}
+}  // namespace
+
+void PathSegmentIndex::clear()
+{
+  x_.clear();
+  y_.clear();
+  nodes_.clear();
+  num_leaves_capacity_ = 0;
+}
+
+void PathSegmentIndex::reserve(const std::size_t num_points)
+{
+  x_.reserve(num_points);
+  y_.reserve(num_points);
+}
+
+void PathSegmentIndex::push_back(const double x, const double y)
+{
+  x_.push_back(x);
+  y_.push_back(y);
+  if (x_.size() < 2) {
+    return;
+  }
+
+  const std::size_t segment_index = x_.size() - 2;
+  const std::size_t leaf = segment_index / leaf_size;
+  if (num_leaves_capacity_ <= leaf) {
+    grow(leaf + 1);
+    return;
+  }
+  const double prev_x = x_[segment_index];
+  const double prev_y = y_[segment_index];
+  expand(
+    num_leaves_capacity_ + leaf,
+    Box{std::min(prev_x, x), std::min(prev_y, y), std::max(prev_x, x), std::max(prev_y, y)});
+}
+
+void PathSegmentIndex::grow(const std::size_t num_leaves)
+{
+  std::size_t capacity = std::max<std::size_t>(num_leaves_capacity_, 1);
+  while (capacity < num_leaves) {
+    capacity *= 2;
+  }
+
+  // Rebuild all the boxes, which is amortized O(1) per segment since the capacity doubles.
+  num_leaves_capacity_ = capacity;
+  nodes_.assign(2 * capacity, Box{inf, inf, -inf, -inf});
+  for (std::size_t i = 0; i < num_segments(); ++i) {
+    auto & box = nodes_[capacity + i / leaf_size];
+    box.min_x = std::min({box.min_x, x_[i], x_[i + 1]});
+    box.min_y = std::min({box.min_y, y_[i], y_[i + 1]});
+    box.max_x = std::max({box.max_x, x_[i], x_[i + 1]});
+    box.max_y = std::max({box.max_y, y_[i], y_[i + 1]});
+  }
+  for (std::size_t n = capacity - 1; n >= 1; --n) {
+    const auto & l = nodes_[2 * n];
+    const auto & r = nodes_[2 * n + 1];
+    nodes_[n] = Box{
+      std::min(l.min_x, r.min_x), std::min(l.min_y, r.min_y), std::max(l.max_x, r.max_x),
+      std::max(l.max_y, r.max_y)};
+  }
+}
+
+void PathSegmentIndex::expand(std::size_t node, const Box & box)
+{
+  for (; node >= 1; node /= 2) {
+    auto & b = nodes_[node];
+    b.min_x = std::min(b.min_x, box.min_x);
+    b.min_y = std::min(b.min_y, box.min_y);
+    b.max_x = std::max(b.max_x, box.max_x);
+    b.max_y = std::max(b.max_y, box.max_y);
+  }
+}
+
+PathSegmentIndex::Result PathSegmentIndex::to_result(
+  const std::size_t segment_index, const double x, const double y) const
+{
+  const double sx = x_[segment_index];
+  const double sy = y_[segment_index];
+  const double dx = x_[segment_index + 1] - sx;
+  const double dy = y_[segment_index + 1] - sy;
+  const double length2 = dx * dx + dy * dy;
+  const double ratio =
+    length2 < 1e-20 ? 0.0 : std::clamp(((x - sx) * dx + (y - sy) * dy) / length2, 0.0, 1.0);
+  // The distance is kept squared until the query finishes.
+  const double ex = sx + ratio * dx - x;
+  const double ey = sy + ratio * dy - y;
+  return Result{segment_index, ratio, ex * ex + ey * ey};
+}
+
+std::optional<PathSegmentIndex::Result> PathSegmentIndex::nearest_segment(
+  const double x, const double y) const
+{
+  const auto results = nearest_segments(x, y, 1);
+  if (results.empty()) {
+    return std::nullopt;
+  }
+  return results.front();
+}
+
+std::optional<PathSegmentIndex::Result> PathSegmentIndex::nearest_segment(
+  const double x, const double y, const double max_distance) const
+{
+  const auto results = nearest_segments(x, y, 1, max_distance * max_distance);
+  if (results.empty()) {
+    return std::nullopt;
+  }
+  return results.front();
+}
+
+std::vector<PathSegmentIndex::Result> PathSegmentIndex::nearest_segments(
+  const double x, const double y, const std::size_t k) const
+{
+  return nearest_segments(x, y, k, inf);
+}
+
+std::vector<PathSegmentIndex::Result> PathSegmentIndex::nearest_segments(
+  const double x, const double y, const std::size_t k, const double max_squared_distance) const
+{
+  std::vector<Result> results;
+  if (k == 0 || num_segments() == 0) {
+    return results;
+  }
+  results.reserve(std::min(k, num_segments()) + 1);
+
+  const auto threshold = [&]() {
+    return results.size() < k ? max_squared_distance : results.back().distance;
+  };
+  const auto box_distance = [&](const std::size_t n) {
+    const auto & b = nodes_[n];
+    return squared_distance_to_box(x, y, b.min_x, b.min_y, b.max_x, b.max_y);
+  };
+
+  std::vector<std::pair<std::size_t, double>> stack;
+  stack.reserve(64);
+  stack.emplace_back(1, box_distance(1));
+  while (!stack.empty()) {
+    const auto [node, distance] = stack.back();
+    stack.pop_back();
+    if (threshold() <= distance) {
+      continue;
+    }
+
+    if (node < num_leaves_capacity_) {
+      const double dl = box_distance(2 * node);
+      const double dr = box_distance(2 * node + 1);
+      // Visit the closer child first, which tightens the threshold earlier.
+      if (dl < dr) {
+        stack.emplace_back(2 * node + 1, dr);
+        stack.emplace_back(2 * node, dl);
+      } else {
+        stack.emplace_back(2 * node, dl);
+        stack.emplace_back(2 * node + 1, dr);
+      }
+      continue;
+    }
+
+    const std::size_t begin = (node - num_leaves_capacity_) * leaf_size;
+    const std::size_t end = std::min(begin + leaf_size, num_segments());
+    for (std::size_t i = begin; i < end; ++i) {
+      const auto result = to_result(i, x, y);
+      if (threshold() <= result.distance) {
+        continue;
+      }
+      const auto it = std::upper_bound(
+        results.begin(), results.end(), result,
+        [](const Result & a, const Result & b) { return a.distance < b.distance; });
+      results.insert(it, result);
+      if (k < results.size()) {
+        results.pop_back();
+      }
+    }
+  }
+
+  for (auto & result : results) {
+    result.distance = std::sqrt(result.distance);
+  }
+  return results;
+}
+
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,249 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/spatial_hash_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr std::size_t min_capacity = 64;
+
+/// @brief bounding box of a polygon, the same as envelope
+std::pair<alt::Point2d, alt::Point2d> get_box(const alt::ConvexPolygon2dView & polygon)
+{
+  alt::Point2d min = polygon.front();
+  alt::Point2d max = polygon.front();
+  for (const auto & vertex : polygon) {
+    min = {std::min(min.x(), vertex.x()), std::min(min.y(), vertex.y())};
+    max = {std::max(max.x(), vertex.x()), std::max(max.y(), vertex.y())};
+  }
+  return {min, max};
+}
+}  // namespace
+
+SpatialHashGrid::SpatialHashGrid(const double cell_size)
+: cell_size_(cell_size), inverse_cell_size_(1.0 / cell_size)
+{
+  if (!(0.0 < cell_size)) {
+    throw std::invalid_argument("The cell size of the grid is not positive.");
+  }
+  rehash(min_capacity);
+}
+
+void SpatialHashGrid::clear()
+{
+  items_.clear();
+  entries_.clear();
+  if (used_slots_ != 0) {
+    for (auto & slot : slots_) {
+      slot.head = npos;
+    }
+    used_slots_ = 0;
+  }
+}
+
+void SpatialHashGrid::insert(const std::size_t id, const alt::Point2d & point)
+{
+  insert(id, point, point);
+}
+
+void SpatialHashGrid::insert(const std::size_t id, const alt::ConvexPolygon2dView & polygon)
+{
+  if (polygon.size() != 0) {
+    const auto [min, max] = get_box(polygon);
+    insert(id, min, max);
+  }
+}
+
+void SpatialHashGrid::insert(
+  const std::size_t id, const alt::Point2d & min, const alt::Point2d & max)
+{
+  const auto item = static_cast<std::uint32_t>(items_.size());
+  items_.push_back(Item{id, min.x(), min.y(), max.x(), max.y()});
+  const std::int32_t max_x = to_cell(max.x());
+  const std::int32_t max_y = to_cell(max.y());
+  for (std::int32_t x = to_cell(min.x()); x <= max_x; ++x) {
+    for (std::int32_t y = to_cell(min.y()); y <= max_y; ++y) {
+      std::size_t slot = find_slot(x, y);
+      if (slots_[slot].head == npos) {
+        // at most half of the slots are used, so that the probes stay short
+        if (slots_.size() < 2 * (used_slots_ + 1)) {
+          rehash(2 * slots_.size());
+          slot = find_slot(x, y);
+        }
+        slots_[slot].x = x;
+        slots_[slot].y = y;
+        ++used_slots_;
+      }
+      entries_.push_back(Entry{item, slots_[slot].head});
+      slots_[slot].head = static_cast<std::uint32_t>(entries_.size() - 1);
+    }
+  }
+}
+
+void SpatialHashGrid::build(const alt::Points2d & points)
+{
+  clear();
+  items_.reserve(points.size());
+  entries_.reserve(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    insert(i, points[i]);
+  }
+}
+
+void SpatialHashGrid::build(const std::vector<alt::ConvexPolygon2dView> & polygons)
+{
+  clear();
+  items_.reserve(polygons.size());
+  for (std::size_t i = 0; i < polygons.size(); ++i) {
+    insert(i, polygons[i]);
+  }
+}
+
+void SpatialHashGrid::query_box(
+  const alt::Point2d & min, const alt::Point2d & max, std::vector<std::size_t> & ids) const
+{
+  ids.clear();
+  visit_box(min.x(), min.y(), max.x(), max.y(), [&ids](const Item & item) {
+    ids.push_back(item.id);
+  });
+}
+
+void SpatialHashGrid::query_radius(
+  const alt::Point2d & center, const double radius, std::vector<std::size_t> & ids) const
+{
+  ids.clear();
+  const double squared_radius = radius * radius;
+  visit_box(
+    center.x() - radius, center.y() - radius, center.x() + radius, center.y() + radius,
+    [&](const Item & item) {
+      const double dx = std::max({item.min_x - center.x(), 0.0, center.x() - item.max_x});
+      const double dy = std::max({item.min_y - center.y(), 0.0, center.y() - item.max_y});
+      if (dx * dx + dy * dy <= squared_radius) {
+        ids.push_back(item.id);
+      }
+    });
+}
+
+std::int32_t SpatialHashGrid::to_cell(const double coordinate) const
+{
+  constexpr double min = std::numeric_limits<std::int32_t>::min();
+  constexpr double max = std::numeric_limits<std::int32_t>::max();
+  const double cell = std::floor(coordinate * inverse_cell_size_);
+  return static_cast<std::int32_t>(std::clamp(cell, min, max));
+}
+
+std::size_t SpatialHashGrid::find_slot(const std::int32_t x, const std::int32_t y) const
+{
+  const std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+                            static_cast<std::uint32_t>(y);
+  const std::size_t mask = slots_.size() - 1;
+  std::size_t slot = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift_);
+  while (slots_[slot].head != npos && (slots_[slot].x != x || slots_[slot].y != y)) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+void SpatialHashGrid::rehash(const std::size_t capacity)
+{
+  auto old_slots = std::move(slots_);
+  slots_.assign(capacity, Slot{0, 0, npos});
+  shift_ = 64;
+  for (std::size_t c = capacity; 1 < c; c /= 2) {
+    --shift_;
+  }
+  for (const auto & slot : old_slots) {
+    if (slot.head != npos) {
+      slots_[find_slot(slot.x, slot.y)] = slot;
+    }
+  }
+}
+
+template <class Visit>
+void SpatialHashGrid::visit_box(
+  const double min_x, const double min_y, const double max_x, const double max_y,
+  const Visit & visit) const
+{
+  const std::int32_t cell_min_x = to_cell(min_x);
+  const std::int32_t cell_min_y = to_cell(min_y);
+  const std::int32_t cell_max_x = to_cell(max_x);
+  const std::int32_t cell_max_y = to_cell(max_y);
+
+  const auto visit_cell = [&](const std::int32_t x, const std::int32_t y, const Slot & slot) {
+    for (auto e = slot.head; e != npos; e = entries_[e].next) {
+      const auto & item = items_[entries_[e].item];
+      if (
+        item.max_x < min_x || max_x < item.min_x || item.max_y < min_y || max_y < item.min_y) {
+        continue;
+      }
+      // an item in several cells is visited in the first cell shared with the query
+      if (
+        x == std::max(to_cell(item.min_x), cell_min_x) &&
+        y == std::max(to_cell(item.min_y), cell_min_y)) {
+        visit(item);
+      }
+    }
+  };
+
+  // a query larger than the grid scans the used slots instead of the cells
+  const double cells = (static_cast<double>(cell_max_x) - cell_min_x + 1.0) *
+                       (static_cast<double>(cell_max_y) - cell_min_y + 1.0);
+  if (static_cast<double>(used_slots_) < cells) {
+    for (const auto & slot : slots_) {
+      if (
+        slot.head != npos && cell_min_x <= slot.x && slot.x <= cell_max_x && cell_min_y <= slot.y &&
+        slot.y <= cell_max_y) {
+        visit_cell(slot.x, slot.y, slot);
+      }
+    }
+    return;
+  }
+  for (std::int32_t x = cell_min_x; x <= cell_max_x; ++x) {
+    for (std::int32_t y = cell_min_y; y <= cell_max_y; ++y) {
+      const auto & slot = slots_[find_slot(x, y)];
+      if (slot.head != npos) {
+        visit_cell(x, y, slot);
+      }
+    }
+  }
+}
+
+void covered_by(
+  const SpatialHashGrid & grid, const alt::Points2d & points, const alt::ConvexPolygon2dView & poly,
+  std::vector<std::size_t> & indices)
+{
+  indices.clear();
+  if (poly.size() == 0) {
+    return;
+  }
+  const auto [min, max] = get_box(poly);
+  grid.query_box(min, max, indices);
+  indices.erase(
+    std::remove_if(
+      indices.begin(), indices.end(),
+      [&](const std::size_t i) { return !covered_by(points[i], poly); }),
+    indices.end());
+  std::sort(indices.begin(), indices.end());
+}
+
+}  // namespace autoware_utils_geometry
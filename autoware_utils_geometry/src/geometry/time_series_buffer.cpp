@@ -0,0 +1,70 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/time_series_buffer.hpp"
+
+#include "autoware_utils_geometry/msg/operation.hpp"
+
+namespace autoware_utils_geometry
+{
+
+geometry_msgs::msg::Point TimeSeriesInterpolation::operator()(
+  const geometry_msgs::msg::Point & a, const geometry_msgs::msg::Point & b,
+  const double ratio) const
+{
+  geometry_msgs::msg::Point point;
+  point.x = a.x + ratio * (b.x - a.x);
+  point.y = a.y + ratio * (b.y - a.y);
+  point.z = a.z + ratio * (b.z - a.z);
+  return point;
+}
+
+geometry_msgs::msg::Vector3 TimeSeriesInterpolation::operator()(
+  const geometry_msgs::msg::Vector3 & a, const geometry_msgs::msg::Vector3 & b,
+  const double ratio) const
+{
+  geometry_msgs::msg::Vector3 vector;
+  vector.x = a.x + ratio * (b.x - a.x);
+  vector.y = a.y + ratio * (b.y - a.y);
+  vector.z = a.z + ratio * (b.z - a.z);
+  return vector;
+}
+
+geometry_msgs::msg::Quaternion TimeSeriesInterpolation::operator()(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b,
+  const double ratio) const
+{
+  return slerp(a, b, ratio);
+}
+
+geometry_msgs::msg::Pose TimeSeriesInterpolation::operator()(
+  const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b, const double ratio) const
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position = (*this)(a.position, b.position, ratio);
+  pose.orientation = slerp(a.orientation, b.orientation, ratio);
+  return pose;
+}
+
+geometry_msgs::msg::Twist TimeSeriesInterpolation::operator()(
+  const geometry_msgs::msg::Twist & a, const geometry_msgs::msg::Twist & b,
+  const double ratio) const
+{
+  geometry_msgs::msg::Twist twist;
+  twist.linear = (*this)(a.linear, b.linear, ratio);
+  twist.angular = (*this)(a.angular, b.angular, ratio);
+  return twist;
+}
+
+}  // namespace autoware_utils_geometry
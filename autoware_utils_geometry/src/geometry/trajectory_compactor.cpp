@@ -0,0 +1,284 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_geometry/trajectory_compactor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+constexpr std::uint8_t encoding_version = 1;
+constexpr std::uint8_t velocity_flag = 1;
+
+std::uint64_t zigzag(const std::int64_t value)
+{
+  return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t unzigzag(const std::uint64_t value)
+{
+  return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+void write_varint(std::vector<std::uint8_t> & bytes, std::uint64_t value)
+{
+  while (value >= 0x80) {
+    bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+void write_double(std::vector<std::uint8_t> & bytes, const double value)
+{
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i) {
+    bytes.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+  }
+}
+
+// writes the difference of a rounded value with the previous one
+void write_delta(
+  std::vector<std::uint8_t> & bytes, const double value, const double resolution,
+  std::int64_t & previous)
+{
+  const std::int64_t rounded = std::llround(value / resolution);
+  write_varint(bytes, zigzag(rounded - previous));
+  previous = rounded;
+}
+
+// reads the encoded fields in order, and throws if the bytes end early
+class Reader
+{
+public:
+  explicit Reader(const std::vector<std::uint8_t> & bytes) : bytes_(bytes) {}
+
+  std::uint8_t byte()
+  {
+    if (position_ == bytes_.size()) {
+      throw std::invalid_argument("The encoded trajectory is truncated.");
+    }
+    return bytes_[position_++];
+  }
+
+  std::uint64_t varint()
+  {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const std::uint8_t b = byte();
+      value |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        return value;
+      }
+    }
+    throw std::invalid_argument("The encoded trajectory has an invalid integer.");
+  }
+
+  double real()
+  {
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+      bits |= static_cast<std::uint64_t>(byte()) << (8 * i);
+    }
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // reads the difference with the previous rounded value
+  double delta(const double resolution, std::int64_t & previous)
+  {
+    previous += unzigzag(varint());
+    return static_cast<double>(previous) * resolution;
+  }
+
+  std::size_t remaining() const { return bytes_.size() - position_; }
+
+private:
+  const std::vector<std::uint8_t> & bytes_;
+  std::size_t position_ = 0;
+};
+}  // namespace
+
+TrajectoryCompactor::TrajectoryCompactor(const Parameters & parameters) : parameters_(parameters)
+{
+  if (!(0.0 <= parameters.max_lateral_error) || !(0.0 <= parameters.max_velocity_error)) {
+    throw std::invalid_argument("The errors of the trajectory compactor must not be negative.");
+  }
+  if (
+    !(0.0 < parameters.position_resolution) || !(0.0 < parameters.yaw_resolution) ||
+    !(0.0 < parameters.velocity_resolution)) {
+    throw std::invalid_argument("The resolutions of the trajectory compactor must be positive.");
+  }
+}
+
+void TrajectoryCompactor::compact_loaded()
+{
+  const std::size_t size = xy_.size();
+  kept_indices_.clear();
+  if (size == 0) {
+    return;
+  }
+
+  if (has_velocity_) {
+    arc_lengths_.resize(size);
+    arc_lengths_[0] = 0.0;
+    for (std::size_t i = 1; i < size; ++i) {
+      arc_lengths_[i] = arc_lengths_[i - 1] + (xy_[i] - xy_[i - 1]).norm();
+    }
+  }
+
+  // the points where the vehicle stops or starts split the path into pieces simplified apart
+  kept_indices_.push_back(0);
+  std::size_t first = 0;
+  for (std::size_t i = 1; i < size && has_velocity_; ++i) {
+    const bool stopped = velocities_[i] == 0.0;
+    const bool stops = stopped && velocities_[i - 1] != 0.0;
+    const bool starts = !stopped && velocities_[i - 1] == 0.0;
+    const std::size_t split = starts ? i - 1 : i;
+    if ((stops || starts) && first < split && split < size - 1) {
+      compact_piece(first, split);
+      first = split;
+    }
+  }
+  if (first < size - 1) {
+    compact_piece(first, size - 1);
+  }
+}
+
+void TrajectoryCompactor::compact_piece(const std::size_t first, const std::size_t last)
+{
+  // without velocity, the piece is simplified by the lateral error only
+  if (!has_velocity_ || std::isinf(parameters_.max_velocity_error)) {
+    simplify_douglas_peucker(
+      xy_.data() + first, last - first + 1, parameters_.max_lateral_error, piece_indices_,
+      buffer_);
+    for (std::size_t i = 1; i < piece_indices_.size(); ++i) {
+      kept_indices_.push_back(first + piece_indices_[i]);
+    }
+    return;
+  }
+
+  // as simplify_douglas_peucker, splitting at the point whose lateral or velocity error exceeds
+  // its tolerance the most, so that both errors are bounded
+  const auto excess = [](const double error, const double tolerance) {
+    return error <= tolerance ? 0.0 : error / tolerance;
+  };
+  auto & stack = buffer_.stack;
+  stack.clear();
+  stack.push_back(last);
+  while (!stack.empty()) {
+    const std::size_t start = kept_indices_.back();
+    const std::size_t end = stack.back();
+    const double length = arc_lengths_[end] - arc_lengths_[start];
+    const double velocity_slope =
+      0.0 < length ? (velocities_[end] - velocities_[start]) / length : 0.0;
+
+    double max_excess = 0.0;
+    std::size_t farthest = start;
+    for (std::size_t i = start + 1; i < end; ++i) {
+      const double lateral_error = distance(xy_[i], xy_[start], xy_[end]);
+      const double interpolated =
+        velocities_[start] + velocity_slope * (arc_lengths_[i] - arc_lengths_[start]);
+      const double velocity_error = std::abs(velocities_[i] - interpolated);
+      const double point_excess = std::max(
+        excess(lateral_error, parameters_.max_lateral_error),
+        excess(velocity_error, parameters_.max_velocity_error));
+      if (max_excess < point_excess) {
+        max_excess = point_excess;
+        farthest = i;
+      }
+    }
+
+    if (0.0 < max_excess) {
+      stack.push_back(farthest);
+    } else {
+      kept_indices_.push_back(end);
+      stack.pop_back();
+    }
+  }
+}
+
+void TrajectoryCompactor::encode_loaded()
+{
+  bytes_.clear();
+  bytes_.push_back(encoding_version);
+  bytes_.push_back(has_velocity_ ? velocity_flag : 0);
+  write_double(bytes_, parameters_.position_resolution);
+  write_double(bytes_, parameters_.yaw_resolution);
+  write_double(bytes_, parameters_.velocity_resolution);
+  write_varint(bytes_, kept_indices_.size());
+
+  std::int64_t x = 0;
+  std::int64_t y = 0;
+  std::int64_t z = 0;
+  std::int64_t yaw = 0;
+  std::int64_t velocity = 0;
+  for (const auto i : kept_indices_) {
+    write_delta(bytes_, xy_[i].x(), parameters_.position_resolution, x);
+    write_delta(bytes_, xy_[i].y(), parameters_.position_resolution, y);
+    write_delta(bytes_, z_[i], parameters_.position_resolution, z);
+    write_delta(bytes_, yaws_[i], parameters_.yaw_resolution, yaw);
+    if (has_velocity_) {
+      write_delta(bytes_, velocities_[i], parameters_.velocity_resolution, velocity);
+    }
+  }
+}
+
+void TrajectoryCompactor::decode_loaded(const std::vector<std::uint8_t> & bytes)
+{
+  Reader reader(bytes);
+  if (reader.byte() != encoding_version) {
+    throw std::invalid_argument("The bytes are not an encoded trajectory.");
+  }
+  has_velocity_ = (reader.byte() & velocity_flag) != 0;
+  const double position_resolution = reader.real();
+  const double yaw_resolution = reader.real();
+  const double velocity_resolution = reader.real();
+  const std::uint64_t size = reader.varint();
+  // each point takes at least a byte per field, which bounds the size before the allocation
+  if (reader.remaining() / (has_velocity_ ? 5 : 4) < size) {
+    throw std::invalid_argument("The encoded trajectory is truncated.");
+  }
+
+  xy_.resize(size);
+  z_.resize(size);
+  yaws_.resize(size);
+  velocities_.resize(has_velocity_ ? size : 0);
+  std::int64_t x = 0;
+  std::int64_t y = 0;
+  std::int64_t z = 0;
+  std::int64_t yaw = 0;
+  std::int64_t velocity = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double point_x = reader.delta(position_resolution, x);
+    const double point_y = reader.delta(position_resolution, y);
+    xy_[i] = alt::Point2d(point_x, point_y);
+    z_[i] = reader.delta(position_resolution, z);
+    yaws_[i] = reader.delta(yaw_resolution, yaw);
+    if (has_velocity_) {
+      velocities_[i] = reader.delta(velocity_resolution, velocity);
+    }
+  }
+}
+
+}  // namespace autoware_utils_geometry
@@ -0,0 +1,124 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/msg/covariance_ops.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+template <class Objects, class GetCovariance>
+void rotate_objects_covariances(
+  Objects & objects, const Eigen::Matrix3d & rotation, const GetCovariance & get_covariance)
+{
+  for (auto & object : objects.objects) {
+    rotate_covariance(get_covariance(object), rotation);
+  }
+}
+
+template <class Objects, class GetCovariance>
+void objects_to_ellipses(
+  const Objects & objects, std::vector<CovarianceEllipse2d> & ellipses,
+  const GetCovariance & get_covariance)
+{
+  ellipses.resize(objects.objects.size());
+  for (std::size_t i = 0; i < objects.objects.size(); ++i) {
+    ellipses[i] = calc_covariance_ellipse(get_covariance(objects.objects[i]));
+  }
+}
+}  // namespace
+
+void rotate_covariance(std::array<double, 36> & covariance, const Eigen::Matrix3d & rotation)
+{
+  auto matrix = covariance_view(covariance);
+  for (const int row : {0, 3}) {
+    for (const int col : {0, 3}) {
+      const Eigen::Matrix3d block = matrix.block<3, 3>(row, col);
+      matrix.block<3, 3>(row, col).noalias() = rotation * block * rotation.transpose();
+    }
+  }
+}
+
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::DetectedObjects & objects, const Eigen::Matrix3d & rotation)
+{
+  rotate_objects_covariances(objects, rotation, [](auto & object) -> auto & {
+    return object.kinematics.pose_with_covariance.covariance;
+  });
+}
+
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::TrackedObjects & objects, const Eigen::Matrix3d & rotation)
+{
+  rotate_objects_covariances(objects, rotation, [](auto & object) -> auto & {
+    return object.kinematics.pose_with_covariance.covariance;
+  });
+}
+
+void rotate_pose_covariances(
+  autoware_perception_msgs::msg::PredictedObjects & objects, const Eigen::Matrix3d & rotation)
+{
+  rotate_objects_covariances(objects, rotation, [](auto & object) -> auto & {
+    return object.kinematics.initial_pose_with_covariance.covariance;
+  });
+}
+
+CovarianceEllipse2d calc_covariance_ellipse(const std::array<double, 36> & covariance)
+{
+  using xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  const double xx = covariance[XYZRPY_COV_IDX::X_X];
+  const double xy = 0.5 * (covariance[XYZRPY_COV_IDX::X_Y] + covariance[XYZRPY_COV_IDX::Y_X]);
+  const double yy = covariance[XYZRPY_COV_IDX::Y_Y];
+
+  const double mean = 0.5 * (xx + yy);
+  const double radius = std::hypot(0.5 * (xx - yy), xy);
+
+  CovarianceEllipse2d ellipse;
+  ellipse.semi_major = std::sqrt(std::max(0.0, mean + radius));
+  ellipse.semi_minor = std::sqrt(std::max(0.0, mean - radius));
+  ellipse.yaw = 0.5 * std::atan2(2.0 * xy, xx - yy);
+  return ellipse;
+}
+
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::DetectedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses)
+{
+  objects_to_ellipses(objects, ellipses, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.covariance;
+  });
+}
+
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::TrackedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses)
+{
+  objects_to_ellipses(objects, ellipses, [](const auto & object) -> const auto & {
+    return object.kinematics.pose_with_covariance.covariance;
+  });
+}
+
+void calc_position_ellipses(
+  const autoware_perception_msgs::msg::PredictedObjects & objects,
+  std::vector<CovarianceEllipse2d> & ellipses)
+{
+  objects_to_ellipses(objects, ellipses, [](const auto & object) -> const auto & {
+    return object.kinematics.initial_pose_with_covariance.covariance;
+  });
+}
+}  // namespace autoware_utils_geometry
@@ -18,6 +18,10 @@
 
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 // NOTE: Do not use autoware_utils namespace
 namespace geometry_msgs
 {
@@ -47,5 +51,100 @@ Quaternion operator-(Quaternion a, Quaternion b) noexcept
   tf2::fromMsg(b, quat_b);
   return tf2::toMsg(quat_a * quat_b.inverse());
 }
+
+Quaternion operator*(Quaternion a, Quaternion b) noexcept
+{
+  Quaternion q;
+  q.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+  q.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+  q.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+  q.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+  return q;
+}
 }  // namespace msg
 }  // namespace geometry_msgs
+
+namespace autoware_utils_geometry
+{
+namespace
+{
+using geometry_msgs::msg::Quaternion;
+
+double dot(const Quaternion & a, const Quaternion & b) noexcept
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+Quaternion weighted_sum(
+  const Quaternion & a, const double weight_a, const Quaternion & b, const double weight_b) noexcept
+{
+  Quaternion q;
+  q.x = weight_a * a.x + weight_b * b.x;
+  q.y = weight_a * a.y + weight_b * b.y;
+  q.z = weight_a * a.z + weight_b * b.z;
+  q.w = weight_a * a.w + weight_b * b.w;
+  return q;
+}
+}  // namespace
+
+Quaternion conjugate(const Quaternion & q) noexcept
+{
+  Quaternion conjugated;
+  conjugated.x = -q.x;
+  conjugated.y = -q.y;
+  conjugated.z = -q.z;
+  conjugated.w = q.w;
+  return conjugated;
+}
+
+Quaternion normalize(const Quaternion & q) noexcept
+{
+  const double norm = std::sqrt(dot(q, q));
+  if (norm == 0.0) {
+    return q;
+  }
+  Quaternion normalized;
+  normalized.x = q.x / norm;
+  normalized.y = q.y / norm;
+  normalized.z = q.z / norm;
+  normalized.w = q.w / norm;
+  return normalized;
+}
+
+Quaternion nlerp(const Quaternion & a, const Quaternion & b, const double ratio) noexcept
+{
+  const double sign = dot(a, b) < 0.0 ? -1.0 : 1.0;
+  return normalize(weighted_sum(a, 1.0 - ratio, b, sign * ratio));
+}
+
+Quaternion slerp(const Quaternion & a, const Quaternion & b, const double ratio) noexcept
+{
+  // below this angle between the quaternions, sin(theta) loses precision and nlerp is as accurate
+  constexpr double nlerp_threshold = 1e-3;
+
+  const double cos_theta = dot(a, b);
+  const double sign = cos_theta < 0.0 ? -1.0 : 1.0;
+  const double theta = std::acos(std::min(1.0, std::abs(cos_theta)));
+  if (theta < nlerp_threshold) {
+    return nlerp(a, b, ratio);
+  }
+  const double sin_theta = std::sin(theta);
+  const double weight_a = std::sin((1.0 - ratio) * theta) / sin_theta;
+  const double weight_b = sign * std::sin(ratio * theta) / sin_theta;
+  return weighted_sum(a, weight_a, b, weight_b);
+}
+
+void rotate_quaternions(const Quaternion & rotation, std::vector<Quaternion> & quaternions) noexcept
+{
+  for (auto & q : quaternions) {
+    q = rotation * q;
+  }
+}
+
+void normalize_quaternions(std::vector<Quaternion> & quaternions) noexcept
+{
+  for (auto & q : quaternions) {
+    q = normalize(q);
+  }
+}
+}  // namespace autoware_utils_geometry
@@ -14,11 +14,13 @@
 
 #include "autoware_utils_geometry/alt_geometry.hpp"
 
+#include "autoware_utils_geometry/gjk_2d.hpp"
 #include "autoware_utils_geometry/random_convex_polygon.hpp"
 #include "autoware_utils_system/stop_watch.hpp"
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
 #include <boost/geometry/algorithms/touches.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
 #if BOOST_VERSION < 107600  // Header removed in version 1.76.0 (Humble)
@@ -27,9 +29,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
+#include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -83,6 +89,28 @@ TEST(alt_geometry, convexHull)
       EXPECT_NEAR(alt_it->x(), ground_truth_it->x(), epsilon);
       EXPECT_NEAR(alt_it->y(), ground_truth_it->y(), epsilon);
     }
+
+    // same hull in the buffer, with a collinear point and a duplicate
+    points.push_back({2.0, 1.3});
+    points.push_back({3.25, 2.35});
+    PointList2d hull;
+    ASSERT_TRUE(convex_hull(points, hull));
+    ASSERT_EQ(hull.size(), ground_truth.size());
+    for (std::size_t i = 0; i < hull.size(); ++i) {
+      EXPECT_NEAR(hull[i].x(), ground_truth[i].x(), epsilon);
+      EXPECT_NEAR(hull[i].y(), ground_truth[i].y(), epsilon);
+    }
+
+    // the sort is skipped
+    ASSERT_TRUE(convex_hull(points, hull, true));
+    EXPECT_EQ(hull.size(), ground_truth.size());
+  }
+
+  {  // degenerate
+    Points2d points = {{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}, {1.0, 1.0}};
+    PointList2d hull;
+    EXPECT_FALSE(convex_hull(points, hull));
+    EXPECT_TRUE(hull.empty());
   }
 }
 
@@ -499,6 +527,63 @@ TEST(alt_geometry, intersects)
   }
 }
 
+TEST(alt_geometry, intersection)
+{
+  using autoware_utils_geometry::area;
+  using autoware_utils_geometry::intersection;
+  using autoware_utils_geometry::intersection_area;
+  using autoware_utils_geometry::iou;
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::PointList2d;
+
+  const auto square = [](const double x, const double y, const double size) {
+    return ConvexPolygon2d::create(
+             PointList2d{{x, y}, {x, y + size}, {x + size, y + size}, {x + size, y}})
+      .value();
+  };
+
+  {  // overlapping squares
+    const auto poly1 = square(0.0, 0.0, 2.0);
+    const auto poly2 = square(1.0, 1.0, 2.0);
+    const auto result = intersection(poly1, poly2);
+    ASSERT_TRUE(result);
+    EXPECT_NEAR(area(*result), 1.0, epsilon);
+    EXPECT_NEAR(intersection_area(poly1, poly2), 1.0, epsilon);
+    EXPECT_NEAR(iou(poly1, poly2), 1.0 / 7.0, epsilon);
+  }
+
+  {  // contained square, at map coordinates
+    const auto poly1 = square(80000.0, 40000.0, 4.0);
+    const auto poly2 = square(80001.0, 40001.0, 1.0);
+    EXPECT_NEAR(intersection_area(poly1, poly2), 1.0, epsilon);
+    EXPECT_NEAR(intersection_area(poly2, poly1), 1.0, epsilon);
+    EXPECT_NEAR(iou(poly1, poly2), 1.0 / 16.0, epsilon);
+  }
+
+  {  // disjoint squares
+    const auto poly1 = square(0.0, 0.0, 1.0);
+    const auto poly2 = square(2.0, 0.0, 1.0);
+    EXPECT_FALSE(intersection(poly1, poly2));
+    EXPECT_NEAR(intersection_area(poly1, poly2), 0.0, epsilon);
+    EXPECT_NEAR(iou(poly1, poly2), 0.0, epsilon);
+  }
+
+  {  // matrix of the pairs
+    const std::vector<ConvexPolygon2d> polys1 = {square(0.0, 0.0, 2.0), square(10.0, 0.0, 1.0)};
+    const std::vector<ConvexPolygon2d> polys2 = {
+      square(1.0, 1.0, 2.0), square(0.0, 0.0, 2.0), square(10.0, 0.0, 1.0)};
+    std::vector<double> ious;
+    iou(polys1, polys2, ious);
+    ASSERT_EQ(ious.size(), 6u);
+    EXPECT_NEAR(ious[0], 1.0 / 7.0, epsilon);
+    EXPECT_NEAR(ious[1], 1.0, epsilon);
+    EXPECT_NEAR(ious[2], 0.0, epsilon);
+    EXPECT_NEAR(ious[3], 0.0, epsilon);
+    EXPECT_NEAR(ious[4], 0.0, epsilon);
+    EXPECT_NEAR(ious[5], 1.0, epsilon);
+  }
+}
+
 TEST(alt_geometry, isAbove)
 {
   using autoware_utils_geometry::is_above;
@@ -560,6 +645,149 @@ TEST(alt_geometry, isClockwise)
   }
 }
 
+TEST(alt_geometry, minAreaRectangle)
+{
+  using autoware_utils_geometry::min_area_rectangle;
+  using autoware_utils_geometry::min_width_rectangle;
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+
+  {  // rotated box
+    const auto box = StaticConvexPolygon2d<4>::create_box({1.0, 2.0}, 0.3, 4.0, 2.0);
+    for (const auto & result : {min_area_rectangle(box), min_width_rectangle(box)}) {
+      EXPECT_NEAR(result.center.x(), 1.0, epsilon);
+      EXPECT_NEAR(result.center.y(), 2.0, epsilon);
+      EXPECT_NEAR(std::sin(result.yaw - 0.3), 0.0, epsilon);  // the yaw is defined modulo pi
+      EXPECT_NEAR(result.length, 4.0, epsilon);
+      EXPECT_NEAR(result.width, 2.0, epsilon);
+    }
+  }
+
+  {  // the minimum width and the minimum area differ
+    const auto poly =
+      StaticConvexPolygon2d<4>::create({{0.0, 0.0}, {10.0, 0.0}, {10.0, 1.0}, {0.0, 3.0}});
+    const auto area = min_area_rectangle(poly.value());
+    EXPECT_NEAR(area.length * area.width, 30.0, epsilon);
+    const auto width = min_width_rectangle(poly.value());
+    EXPECT_NEAR(width.width, 30.0 / std::hypot(10.0, 2.0), epsilon);
+    EXPECT_LT(width.width, area.width);
+  }
+
+  {  // random polygons against the brute force over the edges
+    for (auto vertices = 3UL; vertices < 20UL; ++vertices) {
+      for (auto i = 0; i < 50; ++i) {
+        const auto poly = ConvexPolygon2d::create(
+                            autoware_utils_geometry::random_convex_polygon(vertices, 100.0))
+                            .value();
+        const auto & ring = poly.vertices();
+        double min_area = std::numeric_limits<double>::max();
+        double min_width = std::numeric_limits<double>::max();
+        for (std::size_t j = 0; j + 1 < ring.size(); ++j) {
+          const auto edge = ring[j + 1] - ring[j];
+          const auto u = (1.0 / edge.norm()) * edge;
+          double min_u = std::numeric_limits<double>::max();
+          double max_u = std::numeric_limits<double>::lowest();
+          double height = 0.0;
+          for (const auto & p : ring) {
+            min_u = std::min(min_u, u.dot(p - ring[j]));
+            max_u = std::max(max_u, u.dot(p - ring[j]));
+            height = std::max(height, std::abs(u.cross(p - ring[j])));
+          }
+          min_area = std::min(min_area, (max_u - min_u) * height);
+          min_width = std::min(min_width, height);
+        }
+
+        const auto area = min_area_rectangle(poly);
+        EXPECT_NEAR(area.length * area.width, min_area, epsilon);
+        EXPECT_LE(area.width, area.length);
+        const auto width = min_width_rectangle(poly);
+        EXPECT_NEAR(width.width, min_width, epsilon);
+
+        // every vertex is in the rectangle
+        const auto box =
+          StaticConvexPolygon2d<4>::create_box(area.center, area.yaw, area.length, area.width);
+        for (const auto & p : ring) {
+          EXPECT_LT(autoware_utils_geometry::distance(p, box), epsilon);
+        }
+      }
+    }
+  }
+}
+
+TEST(alt_geometry, minkowskiSum)
+{
+  using autoware_utils_geometry::area;
+  using autoware_utils_geometry::convex_hull;
+  using autoware_utils_geometry::covered_by;
+  using autoware_utils_geometry::distance;
+  using autoware_utils_geometry::intersects;
+  using autoware_utils_geometry::minkowski_sum;
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::Point2d;
+  using autoware_utils_geometry::alt::PointList2d;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+
+  {  // square and triangle
+    const auto square =
+      ConvexPolygon2d::create(PointList2d{{0.0, 0.0}, {0.0, 2.0}, {2.0, 2.0}, {2.0, 0.0}}).value();
+    const auto triangle =
+      ConvexPolygon2d::create(PointList2d{{0.0, 0.0}, {0.0, 1.0}, {1.0, 0.0}}).value();
+    const auto result = minkowski_sum(square, triangle);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->vertices().size(), 6u);  // the parallel edges are merged
+    EXPECT_NEAR(area(*result), 4.0 + 2.0 * 2.0 + 0.5, epsilon);
+  }
+
+  {  // random polygons against the convex hull of the sums of the vertices
+    std::vector<ConvexPolygon2d> polys;
+    for (auto vertices = 3UL; vertices < 10UL; ++vertices) {
+      polys.push_back(
+        ConvexPolygon2d::create(autoware_utils_geometry::random_convex_polygon(vertices, 100))
+          .value());
+    }
+    for (const auto & poly1 : polys) {
+      for (const auto & poly2 : polys) {
+        autoware_utils_geometry::alt::Points2d points;
+        for (const auto & p1 : poly1.vertices()) {
+          for (const auto & p2 : poly2.vertices()) {
+            points.push_back(p1 + p2);
+          }
+        }
+        const auto hull = convex_hull(points).value();
+        const auto result = minkowski_sum(poly1, poly2).value();
+        EXPECT_NEAR(area(result), area(hull), epsilon * area(hull));
+        for (const auto & vertex : result.vertices()) {
+          EXPECT_TRUE(covered_by(vertex, hull) || distance(vertex, hull) < epsilon);
+        }
+      }
+    }
+
+    // the same sums in the batch, reusing the storage of the previous sums
+    std::vector<ConvexPolygon2d> sums;
+    minkowski_sum(polys, polys.front(), sums);
+    minkowski_sum(polys, polys.back(), sums);
+    ASSERT_EQ(sums.size(), polys.size());
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+      EXPECT_TRUE(
+        autoware_utils_geometry::equals(sums[i], minkowski_sum(polys[i], polys.back()).value()));
+    }
+  }
+
+  {  // the footprint at a position intersects the obstacle iff the position is in the sum
+    const double yaw = 0.4;
+    const auto obstacle = StaticConvexPolygon2d<4>::create_box({5.0, 1.0}, -0.2, 2.0, 1.0);
+    const auto reflected = StaticConvexPolygon2d<4>::create_box({0.0, 0.0}, yaw, 1.0, 3.0, 2.0);
+    const auto inflated =
+      minkowski_sum(ConvexPolygon2d::create(obstacle.to_boost()).value(), reflected).value();
+    for (double x = 0.0; x < 10.0; x += 0.37) {
+      for (double y = -4.0; y < 6.0; y += 0.41) {
+        const auto footprint = StaticConvexPolygon2d<4>::create_box({x, y}, yaw, 3.0, 1.0, 2.0);
+        EXPECT_EQ(intersects(footprint, obstacle), covered_by(Point2d(x, y), inflated));
+      }
+    }
+  }
+}
+
 TEST(geometry, simplify)
 {
   using autoware_utils_geometry::simplify;
@@ -581,6 +809,97 @@ TEST(geometry, simplify)
   }
 }
 
+TEST(geometry, simplifyDouglasPeucker)
+{
+  using autoware_utils_geometry::distance;
+  using autoware_utils_geometry::simplify_douglas_peucker;
+  using autoware_utils_geometry::SimplifyBuffer;
+  using autoware_utils_geometry::alt::Points2d;
+
+  SimplifyBuffer buffer;
+  std::vector<std::size_t> kept_indices;
+
+  {
+    const Points2d points = {{1.1, 1.1}, {2.5, 2.1}, {3.1, 3.1}, {4.9, 1.1}, {3.1, 1.9}};
+    simplify_douglas_peucker(points.data(), points.size(), 0.5, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 2, 3, 4}));
+  }
+
+  {  // end points only
+    const Points2d points = {{0.0, 0.0}, {1.0, 0.1}, {2.0, -0.1}, {3.0, 0.0}};
+    simplify_douglas_peucker(points.data(), points.size(), 0.5, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 3}));
+  }
+
+  {  // too short
+    const Points2d points = {{0.0, 0.0}};
+    simplify_douglas_peucker(points.data(), points.size(), 0.5, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0}));
+    simplify_douglas_peucker(points.data(), 0, 0.5, kept_indices, buffer);
+    EXPECT_TRUE(kept_indices.empty());
+  }
+
+  {  // every removed point is close to its simplified segment
+    std::mt19937 gen(0);
+    std::normal_distribution<double> noise(0.0, 0.3);
+    Points2d points;
+    for (auto i = 0; i < 5000; ++i) {
+      points.emplace_back(0.1 * i, std::sin(0.01 * i) * 10.0 + noise(gen));
+    }
+    constexpr double max_distance = 0.5;
+    simplify_douglas_peucker(points.data(), points.size(), max_distance, kept_indices, buffer);
+    ASSERT_LE(2UL, kept_indices.size());
+    EXPECT_LT(kept_indices.size(), points.size());
+    EXPECT_EQ(kept_indices.front(), 0UL);
+    EXPECT_EQ(kept_indices.back(), points.size() - 1);
+    for (std::size_t k = 0; k + 1 < kept_indices.size(); ++k) {
+      const auto & start = points[kept_indices[k]];
+      const auto & end = points[kept_indices[k + 1]];
+      for (auto i = kept_indices[k] + 1; i < kept_indices[k + 1]; ++i) {
+        EXPECT_LE(distance(points[i], start, end), max_distance);
+      }
+    }
+  }
+}
+
+TEST(geometry, simplifyVisvalingam)
+{
+  using autoware_utils_geometry::simplify_visvalingam;
+  using autoware_utils_geometry::SimplifyBuffer;
+  using autoware_utils_geometry::alt::Points2d;
+
+  SimplifyBuffer buffer;
+  std::vector<std::size_t> kept_indices;
+
+  {  // the collinear points are removed
+    const Points2d points = {{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {2.0, 1.0}, {2.0, 2.0}};
+    simplify_visvalingam(points.data(), points.size(), 1e-6, 100, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 2, 4}));
+  }
+
+  {  // the smallest triangles are removed first until the size is bounded
+    const Points2d points = {{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {3.0, 2.0}, {4.0, 0.0}};
+    simplify_visvalingam(points.data(), points.size(), 0.0, 4, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 2, 3, 4}));
+    simplify_visvalingam(points.data(), points.size(), 0.0, 3, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 3, 4}));
+    simplify_visvalingam(points.data(), points.size(), 0.0, 0, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 4}));
+  }
+
+  {  // the area threshold
+    const Points2d points = {{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {3.0, 2.0}, {4.0, 0.0}};
+    simplify_visvalingam(points.data(), points.size(), 0.5, 100, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 2, 3, 4}));
+  }
+
+  {  // too short
+    const Points2d points = {{0.0, 0.0}, {1.0, 0.0}};
+    simplify_visvalingam(points.data(), points.size(), 1.0, 0, kept_indices, buffer);
+    EXPECT_EQ(kept_indices, (std::vector<std::size_t>{0, 1}));
+  }
+}
+
 TEST(alt_geometry, touches)
 {
   using autoware_utils_geometry::touches;
@@ -748,6 +1067,102 @@ TEST(alt_geometry, within)
   }
 }
 
+TEST(alt_geometry, staticConvexPolygon)
+{
+  using autoware_utils_geometry::area;
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::Point2d;
+  using autoware_utils_geometry::alt::PointList2d;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+
+  {  // Corrected as ConvexPolygon2d
+    const PointList2d vertices = {{-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+    const auto poly = StaticConvexPolygon2d<4>::create(vertices);
+    const auto ground_truth = ConvexPolygon2d::create(vertices);
+    ASSERT_TRUE(poly);
+    ASSERT_TRUE(ground_truth);
+    ASSERT_EQ(poly->size(), ground_truth->vertices().size());
+    auto alt_it = poly->begin();
+    auto ground_truth_it = ground_truth->vertices().begin();
+    for (; alt_it != poly->end(); ++alt_it, ++ground_truth_it) {
+      EXPECT_NEAR(alt_it->x(), ground_truth_it->x(), epsilon);
+      EXPECT_NEAR(alt_it->y(), ground_truth_it->y(), epsilon);
+    }
+    EXPECT_NEAR(area(*poly), 4.0, epsilon);
+  }
+
+  {  // Closed ring with N vertices
+    const auto poly = StaticConvexPolygon2d<3>::create(
+      {Point2d{0.0, 0.0}, Point2d{1.0, 0.0}, Point2d{0.0, 1.0}, Point2d{0.0, 0.0}});
+    ASSERT_TRUE(poly);
+    EXPECT_EQ(poly->size(), 4u);
+  }
+
+  {  // Too many vertices
+    const auto poly = StaticConvexPolygon2d<3>::create(
+      {Point2d{0.0, 0.0}, Point2d{1.0, 0.0}, Point2d{1.0, 1.0}, Point2d{0.0, 1.0}});
+    EXPECT_FALSE(poly);
+  }
+
+  {  // Concave
+    const PointList2d vertices = {{0.0, 0.0}, {2.0, 0.0}, {1.0, 0.5}, {2.0, 2.0}, {0.0, 2.0}};
+    EXPECT_FALSE(StaticConvexPolygon2d<5>::create(vertices));
+    EXPECT_FALSE(ConvexPolygon2d::create(vertices));
+  }
+
+  {  // Box
+    const auto box =
+      StaticConvexPolygon2d<4>::create_box(Point2d{1.0, 2.0}, M_PI_2, 3.0, 1.0, 2.0);
+    const auto ground_truth = StaticConvexPolygon2d<4>::create(
+      {Point2d{0.0, 5.0}, Point2d{2.0, 5.0}, Point2d{2.0, 1.0}, Point2d{0.0, 1.0}});
+    ASSERT_TRUE(ground_truth);
+    ASSERT_EQ(box.size(), 5u);
+    for (std::size_t i = 0; i < box.size(); ++i) {
+      EXPECT_NEAR(box.begin()[i].x(), ground_truth->begin()[i].x(), epsilon);
+      EXPECT_NEAR(box.begin()[i].y(), ground_truth->begin()[i].y(), epsilon);
+    }
+    EXPECT_NEAR(area(box), 8.0, epsilon);
+  }
+}
+
+TEST(alt_geometry, staticConvexPolygonRand)
+{
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+
+  constexpr auto polygons_nb = 100;
+  constexpr auto max_vertices = 10;
+  constexpr auto max_values = 1000;
+
+  for (auto vertices = 3UL; vertices < max_vertices; ++vertices) {
+    std::vector<ConvexPolygon2d> polygons;
+    std::vector<StaticConvexPolygon2d<max_vertices>> static_polygons;
+    for (auto i = 0; i < polygons_nb; ++i) {
+      const auto polygon = autoware_utils_geometry::random_convex_polygon(vertices, max_values);
+      polygons.push_back(ConvexPolygon2d::create(polygon).value());
+      static_polygons.push_back(
+        StaticConvexPolygon2d<max_vertices>::create(polygons.back().vertices()).value());
+    }
+
+    for (auto i = 0UL; i < polygons.size(); ++i) {
+      for (auto j = 0UL; j < polygons.size(); ++j) {
+        const auto & p1 = polygons[i];
+        const auto & p2 = polygons[j];
+        const auto & s1 = static_polygons[i];
+        const auto & s2 = static_polygons[j];
+        EXPECT_EQ(
+          autoware_utils_geometry::intersects(p1, p2), autoware_utils_geometry::intersects(s1, s2));
+        EXPECT_EQ(
+          autoware_utils_geometry::disjoint(p1, p2), autoware_utils_geometry::disjoint(s1, p2));
+        EXPECT_EQ(autoware_utils_geometry::within(p1, p2), autoware_utils_geometry::within(p1, s2));
+        EXPECT_DOUBLE_EQ(
+          autoware_utils_geometry::distance(p1.vertices().front(), p2),
+          autoware_utils_geometry::distance(s1.begin()[0], s2));
+      }
+    }
+  }
+}
+
 TEST(alt_geometry, areaRand)
 {
   std::vector<autoware_utils_geometry::Polygon2d> polygons;
@@ -836,6 +1251,48 @@ TEST(alt_geometry, convexHullRand)
   }
 }
 
+TEST(alt_geometry, convexHullLargeRand)
+{
+  constexpr auto clouds_nb = 20;
+  constexpr auto points_nb = 20000;
+
+  std::mt19937 gen(0);
+  std::normal_distribution<double> dist(0.0, 10.0);
+  autoware_utils_system::StopWatch<std::chrono::nanoseconds, std::chrono::nanoseconds> sw;
+  double ground_truth_hull_ns = 0.0;
+  double alt_hull_ns = 0.0;
+  autoware_utils_geometry::alt::Points2d points;
+  autoware_utils_geometry::alt::PointList2d hull;
+  for (auto i = 0; i < clouds_nb; ++i) {
+    autoware_utils_geometry::MultiPoint2d cloud;
+    points.clear();
+    for (auto j = 0; j < points_nb; ++j) {
+      const double x = dist(gen);
+      const double y = dist(gen);
+      cloud.emplace_back(x, y);
+      points.emplace_back(x, y);
+    }
+    autoware_utils_geometry::Polygon2d ground_truth;
+    sw.tic();
+    boost::geometry::convex_hull(cloud, ground_truth);
+    ground_truth_hull_ns += sw.toc();
+
+    sw.tic();
+    ASSERT_TRUE(autoware_utils_geometry::convex_hull(points, hull));
+    alt_hull_ns += sw.toc();
+
+    ASSERT_EQ(ground_truth.outer().size(), hull.size());
+    for (std::size_t j = 0; j < hull.size(); ++j) {
+      EXPECT_NEAR(ground_truth.outer()[j].x(), hull[j].x(), epsilon);
+      EXPECT_NEAR(ground_truth.outer()[j].y(), hull[j].y(), epsilon);
+    }
+  }
+  std::printf("clouds_nb = %d, points = %d\n", clouds_nb, points_nb);
+  std::printf(
+    "\tConvex Hull:\n\t\tBoost::geometry = %2.2f ms\n\t\tAlt (buffer) = %2.2f ms\n",
+    ground_truth_hull_ns / 1e6, alt_hull_ns / 1e6);
+}
+
 TEST(alt_geometry, coveredByRand)
 {
   std::vector<autoware_utils_geometry::Polygon2d> polygons;
@@ -903,6 +1360,42 @@ TEST(alt_geometry, coveredByRand)
   }
 }
 
+TEST(alt_geometry, coveredByBatchRand)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+  autoware_utils_geometry::alt::Points2d points;
+  for (auto i = 0; i < 1003; ++i) {  // not a multiple of the block size
+    points.emplace_back(coordinate(gen) + 80000.0, coordinate(gen) + 40000.0);
+  }
+
+  std::vector<std::size_t> covered_indices;
+  std::vector<std::size_t> within_indices;
+  for (auto vertices = 3UL; vertices < 20UL; ++vertices) {
+    auto polygon = autoware_utils_geometry::random_convex_polygon(vertices, 1000.0);
+    for (auto & point : polygon.outer()) {
+      point = autoware_utils_geometry::Point2d(point.x() + 80000.0, point.y() + 40000.0);
+    }
+    const auto alt_poly = autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon).value();
+
+    autoware_utils_geometry::covered_by(points, alt_poly, covered_indices);
+    autoware_utils_geometry::within(points, alt_poly, within_indices);
+
+    std::vector<std::size_t> expected_covered_indices;
+    std::vector<std::size_t> expected_within_indices;
+    for (auto i = 0UL; i < points.size(); ++i) {
+      if (autoware_utils_geometry::covered_by(points[i], alt_poly)) {
+        expected_covered_indices.push_back(i);
+      }
+      if (autoware_utils_geometry::within(points[i], alt_poly)) {
+        expected_within_indices.push_back(i);
+      }
+    }
+    EXPECT_EQ(covered_indices, expected_covered_indices);
+    EXPECT_EQ(within_indices, expected_within_indices);
+  }
+}
+
 TEST(alt_geometry, disjointRand)
 {
   std::vector<autoware_utils_geometry::Polygon2d> polygons;
@@ -1035,6 +1528,61 @@ TEST(alt_geometry, intersectsRand)
   }
 }
 
+TEST(alt_geometry, intersectionAreaRand)
+{
+  std::vector<autoware_utils_geometry::Polygon2d> polygons;
+  constexpr auto polygons_nb = 100;
+  constexpr auto max_vertices = 10;
+  constexpr auto max_values = 1000;
+
+  autoware_utils_system::StopWatch<std::chrono::nanoseconds, std::chrono::nanoseconds> sw;
+  for (auto vertices = 3UL; vertices < max_vertices; ++vertices) {
+    double ground_truth_ns = 0.0;
+    double alt_ns = 0.0;
+
+    polygons.clear();
+    std::vector<autoware_utils_geometry::alt::ConvexPolygon2d> alt_polygons;
+    for (auto i = 0; i < polygons_nb; ++i) {
+      polygons.push_back(autoware_utils_geometry::random_convex_polygon(vertices, max_values));
+      alt_polygons.push_back(
+        autoware_utils_geometry::alt::ConvexPolygon2d::create(polygons.back()).value());
+    }
+    std::vector<double> ious;
+    sw.tic();
+    autoware_utils_geometry::iou(alt_polygons, alt_polygons, ious);
+    const double alt_batch_ns = sw.toc();
+
+    for (auto i = 0UL; i < polygons.size(); ++i) {
+      for (auto j = 0UL; j < polygons.size(); ++j) {
+        sw.tic();
+        std::vector<autoware_utils_geometry::Polygon2d> output;
+        boost::geometry::intersection(polygons[i], polygons[j], output);
+        double ground_truth = 0.0;
+        for (const auto & poly : output) {
+          ground_truth += boost::geometry::area(poly);
+        }
+        ground_truth_ns += sw.toc();
+
+        sw.tic();
+        const auto alt =
+          autoware_utils_geometry::intersection_area(alt_polygons[i], alt_polygons[j]);
+        alt_ns += sw.toc();
+
+        const double union_area = boost::geometry::area(polygons[i]) +
+                                  boost::geometry::area(polygons[j]) - ground_truth;
+        // Boost.Geometry rescales the coordinates, so its areas differ by about 1e-7 relatively
+        EXPECT_NEAR(ground_truth / union_area, alt / union_area, epsilon);
+        EXPECT_NEAR(ground_truth / union_area, ious[i * polygons.size() + j], epsilon);
+      }
+    }
+    std::printf("polygons_nb = %d, vertices = %ld\n", polygons_nb, vertices);
+    std::printf(
+      "\tIntersection area:\n\t\tBoost::geometry = %2.2f ms\n\t\tAlt = %2.2f ms\n"
+      "\t\tAlt IoU matrix = %2.2f ms\n",
+      ground_truth_ns / 1e6, alt_ns / 1e6, alt_batch_ns / 1e6);
+  }
+}
+
 TEST(alt_geometry, touchesRand)
 {
   std::vector<autoware_utils_geometry::Polygon2d> polygons;
@@ -1167,3 +1715,80 @@ TEST(alt_geometry, withinPolygonRand)
       (alt_not_within_ns + alt_within_ns) / 1e6);
   }
 }
+
+TEST(alt_geometry, singlePrecisionRand)
+{
+  using autoware_utils_geometry::alt::ConvexPolygon2d;
+  using autoware_utils_geometry::alt::Point2d;
+  using autoware_utils_geometry::alt::Point2f;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+  using autoware_utils_geometry::alt::StaticConvexPolygon2f;
+
+  constexpr auto polygons_nb = 100;
+  constexpr auto max_vertices = 10;
+  constexpr auto max_values = 200;
+  // the rounding to single precision moves the vertices by at most this much at 200 m
+  constexpr double rounding = 1e-4;
+
+  std::vector<ConvexPolygon2d> polygons;
+  std::vector<StaticConvexPolygon2f<max_vertices>> polygons_f;
+  for (auto i = 0; i < polygons_nb; ++i) {
+    const auto polygon = autoware_utils_geometry::random_convex_polygon(max_vertices, max_values);
+    polygons.push_back(ConvexPolygon2d::create(polygon).value());
+    polygons_f.push_back(
+      StaticConvexPolygon2f<max_vertices>::create(polygons.back().vertices()).value());
+  }
+
+  const auto distance = [](const ConvexPolygon2d & p1, const ConvexPolygon2d & p2) {
+    return std::abs(autoware_utils_geometry::gjk::signed_distance(p1, p2).distance);
+  };
+  for (auto i = 0UL; i < polygons.size(); ++i) {
+    EXPECT_NEAR(
+      autoware_utils_geometry::area(polygons_f[i]), autoware_utils_geometry::area(polygons[i]),
+      1e-3 * autoware_utils_geometry::area(polygons[i]));
+    for (auto j = 0UL; j < polygons.size(); ++j) {
+      if (distance(polygons[i], polygons[j]) < rounding) {
+        continue;  // touching within the rounding
+      }
+      EXPECT_EQ(
+        autoware_utils_geometry::intersects(polygons_f[i], polygons_f[j]),
+        autoware_utils_geometry::intersects(polygons[i], polygons[j]));
+      EXPECT_EQ(
+        autoware_utils_geometry::disjoint(polygons_f[i], polygons_f[j]),
+        autoware_utils_geometry::disjoint(polygons[i], polygons[j]));
+    }
+  }
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> coordinate(-max_values, max_values);
+  autoware_utils_geometry::alt::Points2d points;
+  autoware_utils_geometry::alt::Points2f points_f;
+  for (auto i = 0; i < 1000; ++i) {
+    points.emplace_back(coordinate(generator), coordinate(generator));
+    points_f.emplace_back(points.back());
+  }
+  std::vector<std::size_t> indices;
+  std::vector<std::size_t> indices_f;
+  for (auto i = 0UL; i < polygons.size(); ++i) {
+    autoware_utils_geometry::covered_by(points, polygons[i], indices);
+    autoware_utils_geometry::covered_by(points_f, polygons_f[i], indices_f);
+    EXPECT_EQ(indices, indices_f);
+    for (auto k = 0UL; k < points.size(); k += 100) {
+      EXPECT_EQ(
+        autoware_utils_geometry::covered_by(points_f[k], polygons_f[i]),
+        autoware_utils_geometry::covered_by(points[k], polygons[i]));
+    }
+  }
+
+  // the footprints are the same as in double precision up to the rounding
+  const auto box = StaticConvexPolygon2d<4>::create_box(Point2d{10.0, -20.0}, 0.3, 4.0, 1.0, 2.0);
+  const auto box_f =
+    StaticConvexPolygon2f<4>::create_box(Point2f{10.0f, -20.0f}, 0.3, 4.0, 1.0, 2.0);
+  ASSERT_EQ(box.size(), box_f.size());
+  for (auto i = 0UL; i < box.size(); ++i) {
+    EXPECT_NEAR(box_f.begin()[i].x(), box.begin()[i].x(), rounding);
+    EXPECT_NEAR(box_f.begin()[i].y(), box.begin()[i].y(), rounding);
+  }
+  EXPECT_NEAR(autoware_utils_geometry::area(box_f), 10.0, rounding);
+  EXPECT_TRUE(autoware_utils_geometry::within(Point2f{10.0f, -20.0f}, box_f));
+}
@@ -0,0 +1,144 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/batch_transform.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_math/unit_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr double epsilon = 1e-9;
+
+geometry_msgs::msg::Transform make_transform()
+{
+  using autoware_utils_geometry::create_quaternion_from_rpy;
+  using autoware_utils_math::deg2rad;
+
+  geometry_msgs::msg::Transform transform;
+  transform.translation.x = 1.0;
+  transform.translation.y = -2.0;
+  transform.translation.z = 0.5;
+  transform.rotation = create_quaternion_from_rpy(deg2rad(5), deg2rad(-10), deg2rad(30));
+  return transform;
+}
+
+void expect_same_orientation(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b)
+{
+  // q and -q represent the same rotation.
+  const double dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+  EXPECT_NEAR(std::abs(dot), 1.0, epsilon);
+}
+}  // namespace
+
+TEST(batch_transform, transform_points)
+{
+  using autoware_utils_geometry::create_point;
+  using autoware_utils_geometry::transform2pose;
+  using autoware_utils_geometry::transform_point;
+  using autoware_utils_geometry::transform_points;
+
+  const auto transform = make_transform();
+  const auto pose = transform2pose(transform);
+
+  std::vector<geometry_msgs::msg::Point> points;
+  for (int i = 0; i < 100; ++i) {
+    points.push_back(create_point(0.1 * i, std::sin(0.1 * i), -0.05 * i));
+  }
+
+  auto transformed = points;
+  transform_points(transformed, transform);
+  ASSERT_EQ(transformed.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto expected = transform_point(points.at(i), pose);
+    EXPECT_NEAR(transformed.at(i).x, expected.x, epsilon);
+    EXPECT_NEAR(transformed.at(i).y, expected.y, epsilon);
+    EXPECT_NEAR(transformed.at(i).z, expected.z, epsilon);
+  }
+
+  // Point32 and the pose overload
+  std::vector<geometry_msgs::msg::Point32> points32(3);
+  points32.at(1).x = 1.0f;
+  points32.at(2).y = 1.0f;
+  auto transformed32 = points32;
+  transform_points(transformed32, pose);
+  for (size_t i = 0; i < points32.size(); ++i) {
+    const auto expected = transform_point(points32.at(i), pose);
+    EXPECT_NEAR(transformed32.at(i).x, expected.x, 1e-5);
+    EXPECT_NEAR(transformed32.at(i).y, expected.y, 1e-5);
+    EXPECT_NEAR(transformed32.at(i).z, expected.z, 1e-5);
+  }
+
+  // Empty input
+  std::vector<geometry_msgs::msg::Point> empty;
+  transform_points(empty, transform);
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(batch_transform, transform_poses)
+{
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+  using autoware_utils_geometry::PoseArraySoA;
+  using autoware_utils_geometry::transform2pose;
+  using autoware_utils_geometry::transform_pose;
+  using autoware_utils_geometry::transform_poses;
+
+  const auto transform = make_transform();
+
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> trajectory(50);
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    auto & p = trajectory.at(i).pose;
+    p.position.x = 0.5 * i;
+    p.position.y = 0.1 * i * i;
+    p.position.z = 0.01 * i;
+    p.orientation = create_quaternion_from_yaw(0.05 * i);
+    trajectory.at(i).longitudinal_velocity_mps = static_cast<float>(i);
+  }
+
+  // Reusing the same buffer for several calls
+  PoseArraySoA buffer;
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    auto transformed = trajectory;
+    transform_poses(transformed, transform, buffer);
+    ASSERT_EQ(transformed.size(), trajectory.size());
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+      const auto expected = transform_pose(trajectory.at(i).pose, transform);
+      const auto & actual = transformed.at(i).pose;
+      EXPECT_NEAR(actual.position.x, expected.position.x, epsilon);
+      EXPECT_NEAR(actual.position.y, expected.position.y, epsilon);
+      EXPECT_NEAR(actual.position.z, expected.position.z, epsilon);
+      expect_same_orientation(actual.orientation, expected.orientation);
+      EXPECT_FLOAT_EQ(
+        transformed.at(i).longitudinal_velocity_mps, trajectory.at(i).longitudinal_velocity_mps);
+    }
+  }
+
+  // Path points and the pose overload
+  std::vector<autoware_planning_msgs::msg::PathPoint> path(1);
+  path.front().pose.position.x = 1.0;
+  path.front().pose.orientation = create_quaternion_from_yaw(1.0);
+  const auto pose = transform2pose(transform);
+  const auto expected = transform_pose(path.front().pose, pose);
+  transform_poses(path, pose);
+  EXPECT_NEAR(path.front().pose.position.x, expected.position.x, epsilon);
+  EXPECT_NEAR(path.front().pose.position.y, expected.position.y, epsilon);
+  EXPECT_NEAR(path.front().pose.position.z, expected.position.z, epsilon);
+  expect_same_orientation(path.front().pose.orientation, expected.orientation);
+}
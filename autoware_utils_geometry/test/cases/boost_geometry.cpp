@@ -18,6 +18,8 @@
 
 #include <gtest/gtest.h>
 
+#include <type_traits>
+
 namespace bg = boost::geometry;
 
 using autoware_utils_geometry::Point2d;
@@ -81,3 +83,53 @@ TEST(boost_geometry, from_msg)
   EXPECT_DOUBLE_EQ(p.y(), 2.0);
   EXPECT_DOUBLE_EQ(p.z(), 3.0);
 }
+
+TEST(boost_geometry, to_float)
+{
+  using autoware_utils_geometry::Point2f;
+  using autoware_utils_geometry::Polygon2d;
+  using autoware_utils_geometry::Polygon2f;
+
+  const Point2d p_2d(1.0, 2.0);
+  const Point2f p_2f(p_2d);
+  EXPECT_FLOAT_EQ(p_2f.x(), 1.0f);
+  EXPECT_FLOAT_EQ(p_2f.y(), 2.0f);
+  EXPECT_TRUE(p_2f.to_double() == p_2d);
+
+  Polygon2d polygon;
+  polygon.outer() = {{0.0, 0.0}, {0.0, 4.0}, {4.0, 4.0}, {4.0, 0.0}, {0.0, 0.0}};
+  polygon.inners().push_back({{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}, {1.0, 2.0}, {1.0, 1.0}});
+  const Polygon2f polygon_f = autoware_utils_geometry::to_float(polygon);
+  ASSERT_EQ(polygon_f.outer().size(), 5u);
+  ASSERT_EQ(polygon_f.inners().size(), 1u);
+  EXPECT_FLOAT_EQ(bg::area(polygon_f), 15.0f);
+  EXPECT_TRUE(bg::within(Point2f(0.5f, 0.5f), polygon_f));
+  EXPECT_FALSE(bg::within(Point2f(1.5f, 1.5f), polygon_f));
+
+  const Polygon2d round_trip = autoware_utils_geometry::to_double(polygon_f);
+  EXPECT_TRUE(bg::equals(round_trip, polygon));
+}
+
+TEST(boost_geometry, plain_point)
+{
+  using autoware_utils_geometry::PlainPoint2d;
+  using autoware_utils_geometry::PlainPolygon2d;
+
+  static_assert(std::is_trivially_copyable_v<PlainPoint2d>);
+
+  PlainPoint2d p{1.0, 2.0};
+  EXPECT_DOUBLE_EQ(bg::distance(p, PlainPoint2d{2.0, 4.0}), std::sqrt(5));
+  autoware_utils_geometry::as_eigen(p) += Eigen::Vector2d(1.0, 1.0);
+  EXPECT_DOUBLE_EQ(p.x, 2.0);
+  EXPECT_DOUBLE_EQ(p.y, 3.0);
+  EXPECT_TRUE(autoware_utils_geometry::from_plain(p) == Point2d(2.0, 3.0));
+
+  PlainPolygon2d polygon;
+  polygon.outer() = {{0.0, 0.0}, {0.0, 2.0}, {3.0, 2.0}, {3.0, 0.0}, {0.0, 0.0}};
+  EXPECT_DOUBLE_EQ(bg::area(polygon), 6.0);
+  const auto columns =
+    autoware_utils_geometry::as_eigen(polygon.outer().data(), polygon.outer().size());
+  EXPECT_EQ(columns.cols(), 5);
+  EXPECT_DOUBLE_EQ(columns.row(0).maxCoeff(), 3.0);
+  EXPECT_DOUBLE_EQ(columns(1, 2), 2.0);
+}
@@ -20,6 +20,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 using autoware_utils_geometry::Polygon2d;
 
 namespace
@@ -206,6 +209,98 @@ TEST(boost_geometry, boost_to_polygon2d)
   }
 }
 
+TEST(boost_geometry, boost_to_polygon2d_array)
+{
+  using autoware_utils_geometry::to_polygon2d;
+
+  autoware_perception_msgs::msg::PredictedObjects objects;
+  for (int i = 0; i < 250; ++i) {  // enough objects to use several threads
+    autoware_perception_msgs::msg::PredictedObject object;
+    object.kinematics.initial_pose_with_covariance.pose = create_pose(i, -0.5 * i, 0.1 * i);
+    object.shape.type = i % 3;
+    object.shape.dimensions.x = 1.0 + 0.01 * i;
+    object.shape.dimensions.y = 2.0;
+    if (object.shape.type == autoware_perception_msgs::msg::Shape::POLYGON) {
+      object.shape.footprint.points.push_back(create_point32(-0.5, -0.5));
+      object.shape.footprint.points.push_back(create_point32(-0.5, 0.5));
+      object.shape.footprint.points.push_back(create_point32(0.5, 0.5));
+    }
+    objects.objects.push_back(object);
+  }
+
+  autoware_utils_geometry::PolygonArray2d polygons;
+  autoware_utils_geometry::PlainPolygon2d plain_polygon;
+  for (const auto num_threads : {1UL, 4UL}) {
+    to_polygon2d(objects, polygons, num_threads);
+    ASSERT_EQ(polygons.size(), objects.objects.size());
+    for (size_t i = 0; i < objects.objects.size(); ++i) {
+      const auto expected = to_polygon2d(objects.objects.at(i));
+      const auto polygon = polygons.polygon(i);
+      polygons.polygon(i, plain_polygon);
+      ASSERT_EQ(polygon.outer().size(), expected.outer().size());
+      ASSERT_EQ(plain_polygon.outer().size(), expected.outer().size());
+      for (size_t j = 0; j < expected.outer().size(); ++j) {
+        // to_polygon2d() rounds the rotated footprints to float
+        EXPECT_NEAR(polygon.outer().at(j).x(), expected.outer().at(j).x(), 1e-6);
+        EXPECT_NEAR(polygon.outer().at(j).y(), expected.outer().at(j).y(), 1e-6);
+        EXPECT_DOUBLE_EQ(plain_polygon.outer().at(j).x, polygon.outer().at(j).x());
+        EXPECT_DOUBLE_EQ(plain_polygon.outer().at(j).y, polygon.outer().at(j).y());
+      }
+    }
+  }
+
+  objects.objects.front().shape.type = 100;
+  EXPECT_THROW(to_polygon2d(objects, polygons), std::logic_error);
+}
+
+TEST(boost_geometry, boost_to_swept_footprint)
+{
+  using autoware_utils_geometry::to_polygon2d;
+  using autoware_utils_geometry::to_swept_footprint;
+
+  autoware_perception_msgs::msg::PredictedObject object;
+  object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+  object.shape.dimensions.x = 4.0;
+  object.shape.dimensions.y = 2.0;
+  autoware_perception_msgs::msg::PredictedPath path;
+  path.time_step.sec = 0;
+  path.time_step.nanosec = 500000000;
+  for (int i = 0; i < 5; ++i) {
+    path.path.push_back(create_pose(2.0 * i, 0.5 * i * i, 0.2 * i));
+  }
+
+  autoware_utils_geometry::SweptFootprint swept;
+  to_swept_footprint(object, path, swept);
+  ASSERT_EQ(swept.times.size(), path.path.size());
+  ASSERT_EQ(swept.footprints.size(), path.path.size());
+  EXPECT_TRUE(swept.segment_hulls.empty());
+  for (size_t i = 0; i < path.path.size(); ++i) {
+    EXPECT_DOUBLE_EQ(swept.times.at(i), 0.5 * i);
+    const auto expected = to_polygon2d(path.path.at(i), object.shape);
+    const auto & footprint = swept.footprints.at(i);
+    ASSERT_EQ(footprint.outer().size(), expected.outer().size());
+    for (size_t j = 0; j < expected.outer().size(); ++j) {
+      EXPECT_NEAR(footprint.outer().at(j).x(), expected.outer().at(j).x(), 1e-9);
+      EXPECT_NEAR(footprint.outer().at(j).y(), expected.outer().at(j).y(), 1e-9);
+    }
+  }
+
+  to_swept_footprint(object, path, swept, true);
+  ASSERT_EQ(swept.segment_hulls.size(), path.path.size() - 1);
+  for (size_t i = 0; i + 1 < path.path.size(); ++i) {
+    const auto & hull = swept.segment_hulls.at(i);
+    EXPECT_TRUE(autoware_utils_geometry::is_clockwise(hull));
+    EXPECT_TRUE(boost::geometry::covered_by(swept.footprints.at(i), hull));
+    EXPECT_TRUE(boost::geometry::covered_by(swept.footprints.at(i + 1), hull));
+    EXPECT_GT(boost::geometry::area(hull), boost::geometry::area(swept.footprints.at(i)));
+  }
+
+  path.path.resize(1);
+  to_swept_footprint(object, path, swept, true);
+  EXPECT_EQ(swept.footprints.size(), 1u);
+  EXPECT_TRUE(swept.segment_hulls.empty());
+}
+
 TEST(boost_geometry, boost_to_footprint)
 {
   using autoware_utils_geometry::to_footprint;
@@ -290,6 +385,89 @@ TEST(boost_geometry, boost_get_area)
   }
 }
 
+TEST(boost_geometry, boost_get_shape_stats)
+{
+  using autoware_utils_geometry::get_area;
+  using autoware_utils_geometry::get_shape_stats;
+
+  {  // bounding box
+    autoware_perception_msgs::msg::Shape shape;
+    shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    shape.dimensions.x = 1.0;
+    shape.dimensions.y = 2.0;
+
+    const auto stats = get_shape_stats(shape);
+    EXPECT_DOUBLE_EQ(stats.area, get_area(shape));
+    EXPECT_DOUBLE_EQ(stats.perimeter, 6.0);
+    EXPECT_DOUBLE_EQ(stats.centroid.x(), 0.0);
+    EXPECT_DOUBLE_EQ(stats.centroid.y(), 0.0);
+  }
+
+  {  // cylinder
+    autoware_perception_msgs::msg::Shape shape;
+    shape.type = autoware_perception_msgs::msg::Shape::CYLINDER;
+    shape.dimensions.x = 2.0;
+
+    const auto stats = get_shape_stats(shape);
+    EXPECT_DOUBLE_EQ(stats.area, get_area(shape));
+    EXPECT_DOUBLE_EQ(stats.perimeter, 2.0 * M_PI);
+  }
+
+  {  // polygon, anti clock wise
+    autoware_perception_msgs::msg::Shape shape;
+    shape.type = autoware_perception_msgs::msg::Shape::POLYGON;
+    shape.footprint.points.push_back(create_point32(0.0, 0.0));
+    shape.footprint.points.push_back(create_point32(2.0, 0.0));
+    shape.footprint.points.push_back(create_point32(2.0, 1.0));
+    shape.footprint.points.push_back(create_point32(0.0, 1.0));
+
+    const auto stats = get_shape_stats(shape);
+    EXPECT_DOUBLE_EQ(stats.area, get_area(shape));
+    EXPECT_DOUBLE_EQ(stats.area, 2.0);
+    EXPECT_DOUBLE_EQ(stats.perimeter, 6.0);
+    EXPECT_DOUBLE_EQ(stats.centroid.x(), 1.0);
+    EXPECT_DOUBLE_EQ(stats.centroid.y(), 0.5);
+
+    std::reverse(shape.footprint.points.begin(), shape.footprint.points.end());
+    const auto clock_wise_stats = get_shape_stats(shape);
+    EXPECT_DOUBLE_EQ(clock_wise_stats.area, -2.0);
+    EXPECT_DOUBLE_EQ(clock_wise_stats.centroid.x(), 1.0);
+    EXPECT_DOUBLE_EQ(clock_wise_stats.centroid.y(), 0.5);
+  }
+
+  {  // objects
+    autoware_perception_msgs::msg::DetectedObjects objects;
+    for (int i = 0; i < 3; ++i) {
+      autoware_perception_msgs::msg::DetectedObject object;
+      object.kinematics.pose_with_covariance.pose = create_pose(1.0, 2.0, M_PI_2);
+      object.shape.type = i;
+      object.shape.dimensions.x = 1.0;
+      object.shape.dimensions.y = 1.0;
+      object.shape.footprint.points.push_back(create_point32(0.0, 0.0));
+      object.shape.footprint.points.push_back(create_point32(2.0, 0.0));
+      object.shape.footprint.points.push_back(create_point32(2.0, 1.0));
+      object.shape.footprint.points.push_back(create_point32(0.0, 1.0));
+      objects.objects.push_back(object);
+    }
+
+    std::vector<autoware_utils_geometry::ShapeStats> stats;
+    get_shape_stats(objects, stats);
+    ASSERT_EQ(stats.size(), objects.objects.size());
+    for (size_t i = 0; i < stats.size(); ++i) {
+      const auto expected = get_shape_stats(objects.objects.at(i).shape);
+      EXPECT_DOUBLE_EQ(stats.at(i).area, expected.area);
+      EXPECT_DOUBLE_EQ(stats.at(i).perimeter, expected.perimeter);
+    }
+    EXPECT_DOUBLE_EQ(stats.at(0).centroid.x(), 1.0);
+    EXPECT_DOUBLE_EQ(stats.at(0).centroid.y(), 2.0);
+    EXPECT_NEAR(stats.at(2).centroid.x(), 0.5, 1e-9);
+    EXPECT_NEAR(stats.at(2).centroid.y(), 3.0, 1e-9);
+
+    objects.objects.front().shape.type = 100;
+    EXPECT_THROW(get_shape_stats(objects, stats), std::logic_error);
+  }
+}
+
 TEST(boost_geometry, boost_expand_polygon)
 {
   using autoware_utils_geometry::expand_polygon;
@@ -331,3 +509,75 @@ TEST(boost_geometry, boost_expand_polygon)
     EXPECT_THROW(expand_polygon(empty_poly, 1.0), std::out_of_range);
   }
 }
+
+TEST(boost_geometry, boost_expand_convex_polygon)
+{
+  using autoware_utils_geometry::expand_convex_polygon;
+  using autoware_utils_geometry::ExpandJoin;
+  constexpr double epsilon = 1e-6;
+
+  const Polygon2d box_poly{{{-1.0, -1.0}, {-1.0, 1.0}, {1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}}};
+  Polygon2d expanded_poly;
+
+  {  // mitre, same as expand_polygon
+    expand_convex_polygon(box_poly, 1.0, expanded_poly);
+    const auto expected_poly = autoware_utils_geometry::expand_polygon(box_poly, 1.0);
+    ASSERT_EQ(expanded_poly.outer().size(), expected_poly.outer().size());
+    for (size_t i = 0; i < expected_poly.outer().size(); ++i) {
+      EXPECT_NEAR(expanded_poly.outer().at(i).x(), expected_poly.outer().at(i).x(), epsilon);
+      EXPECT_NEAR(expanded_poly.outer().at(i).y(), expected_poly.outer().at(i).y(), epsilon);
+    }
+  }
+
+  {  // round with 2 segments per corner, the buffer is reused
+    expand_convex_polygon(box_poly, 1.0, expanded_poly, ExpandJoin::round, 8);
+    EXPECT_EQ(expanded_poly.outer().size(), 13UL);
+    EXPECT_TRUE(boost::geometry::is_valid(expanded_poly));
+    const double corner_area = 4.0 * std::sin(M_PI / 4.0);  // 8 triangles of apex angle pi/4
+    EXPECT_NEAR(boost::geometry::area(expanded_poly), 4.0 + 8.0 + corner_area, epsilon);
+  }
+
+  {  // round converges to the exact area
+    expand_convex_polygon(box_poly, 1.0, expanded_poly, ExpandJoin::round, 1024);
+    EXPECT_NEAR(boost::geometry::area(expanded_poly), 4.0 + 8.0 + M_PI, 1e-4);
+  }
+
+  {  // open ring and no offset
+    Polygon2d open_poly{{{-1.0, -1.0}, {-1.0, 1.0}, {1.0, 1.0}, {1.0, -1.0}}};
+    expand_convex_polygon(open_poly, 0.0, expanded_poly, ExpandJoin::round);
+    EXPECT_EQ(expanded_poly.outer().size(), 5UL);
+    EXPECT_NEAR(boost::geometry::area(expanded_poly), 4.0, epsilon);
+  }
+
+  {  // consecutive duplicate points, also across the closing point
+    const Polygon2d duplicate_poly{
+      {{-1.0, -1.0}, {-1.0, 1.0}, {-1.0, 1.0}, {1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}}};
+    for (const auto join : {ExpandJoin::mitre, ExpandJoin::round}) {
+      Polygon2d expected_poly;
+      expand_convex_polygon(box_poly, 1.0, expected_poly, join);
+      expand_convex_polygon(duplicate_poly, 1.0, expanded_poly, join);
+      ASSERT_EQ(expanded_poly.outer().size(), expected_poly.outer().size());
+      for (size_t i = 0; i < expected_poly.outer().size(); ++i) {
+        EXPECT_NEAR(expanded_poly.outer().at(i).x(), expected_poly.outer().at(i).x(), epsilon);
+        EXPECT_NEAR(expanded_poly.outer().at(i).y(), expected_poly.outer().at(i).y(), epsilon);
+      }
+    }
+
+    const Polygon2d open_duplicate_poly{
+      {{-1.0, -1.0}, {-1.0, 1.0}, {1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, -1.0}}};
+    expand_convex_polygon(open_duplicate_poly, 1.0, expanded_poly);
+    EXPECT_EQ(expanded_poly.outer().size(), 5UL);
+    EXPECT_NEAR(boost::geometry::area(expanded_poly), 16.0, epsilon);
+  }
+
+  {  // less than 3 distinct points
+    const Polygon2d segment_poly{{{-1.0, -1.0}, {-1.0, -1.0}, {1.0, 1.0}, {1.0, 1.0}}};
+    expand_convex_polygon(segment_poly, 1.0, expanded_poly);
+    EXPECT_TRUE(expanded_poly.outer().empty());
+  }
+
+  {  // empty polygon
+    expand_convex_polygon(Polygon2d{}, 1.0, expanded_poly);
+    EXPECT_TRUE(expanded_poly.outer().empty());
+  }
+}
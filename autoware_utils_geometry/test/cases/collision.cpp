@@ -0,0 +1,168 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/collision.hpp"
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::CollisionPair;
+using autoware_utils_geometry::find_collisions;
+using autoware_utils_geometry::find_first_collision;
+using autoware_utils_geometry::alt::ConvexPolygon2d;
+using autoware_utils_geometry::alt::Point2d;
+using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+
+template <class Polygons1, class Polygons2>
+std::vector<CollisionPair> find_collisions_brute_force(
+  const Polygons1 & polygons1, const Polygons2 & polygons2)
+{
+  std::vector<CollisionPair> collisions;
+  for (std::size_t i = 0; i < polygons1.size(); ++i) {
+    for (std::size_t j = 0; j < polygons2.size(); ++j) {
+      if (autoware_utils_geometry::intersects(polygons1[i], polygons2[j])) {
+        collisions.push_back({i, j});
+      }
+    }
+  }
+  return collisions;
+}
+}  // namespace
+
+TEST(collision, find_collisions)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> position(0.0, 100.0);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+
+  // footprints along a curve and random objects
+  std::vector<StaticConvexPolygon2d<4>> footprints;
+  for (int i = 0; i < 200; ++i) {
+    const double t = 0.5 * i;
+    footprints.push_back(StaticConvexPolygon2d<4>::create_box(
+      Point2d{t, 50.0 + 20.0 * std::sin(0.05 * t)}, std::atan(std::cos(0.05 * t)), 3.8, 1.0, 1.9));
+  }
+  std::vector<ConvexPolygon2d> objects;
+  for (int i = 0; i < 100; ++i) {
+    const auto polygon = autoware_utils_geometry::random_convex_polygon(6, 5.0);
+    autoware_utils_geometry::alt::PointList2d vertices;
+    const Point2d offset{position(gen), position(gen)};
+    for (const auto & p : polygon.outer()) {
+      vertices.push_back(Point2d(p) + offset);
+    }
+    objects.push_back(ConvexPolygon2d::create(vertices).value());
+  }
+
+  const auto expected = find_collisions_brute_force(footprints, objects);
+  const auto collisions = find_collisions(footprints, objects);
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(collisions.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(collisions.at(i).index1, expected.at(i).index1);
+    EXPECT_EQ(collisions.at(i).index2, expected.at(i).index2);
+  }
+
+  // the same pairs with the grid as the broad phase, reused
+  autoware_utils_geometry::SpatialHashGrid grid(5.0);
+  for (int k = 0; k < 2; ++k) {
+    const auto grid_collisions = find_collisions(footprints, objects, grid);
+    ASSERT_EQ(grid_collisions.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(grid_collisions.at(i).index1, expected.at(i).index1);
+      EXPECT_EQ(grid_collisions.at(i).index2, expected.at(i).index2);
+    }
+  }
+
+  const auto first = find_first_collision(footprints, objects);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first->index1, expected.front().index1);
+  EXPECT_EQ(first->index2, expected.front().index2);
+}
+
+TEST(collision, no_collision)
+{
+  const std::vector<StaticConvexPolygon2d<4>> polygons1 = {
+    StaticConvexPolygon2d<4>::create_box(Point2d{0.0, 0.0}, 0.0, 2.0, 2.0),
+    StaticConvexPolygon2d<4>::create_box(Point2d{0.0, 3.0}, 0.0, 2.0, 2.0)};
+  const std::vector<StaticConvexPolygon2d<4>> polygons2 = {
+    StaticConvexPolygon2d<4>::create_box(Point2d{3.0, 0.0}, 0.0, 2.0, 2.0),
+    // overlaps in x with polygons1 but not in y
+    StaticConvexPolygon2d<4>::create_box(Point2d{0.5, 6.0}, 0.0, 2.0, 2.0)};
+
+  EXPECT_TRUE(find_collisions(polygons1, polygons2).empty());
+  EXPECT_FALSE(find_first_collision(polygons1, polygons2));
+  EXPECT_TRUE(find_collisions(polygons1, std::vector<StaticConvexPolygon2d<4>>{}).empty());
+}
+
+TEST(collision, find_first_collision_along_path)
+{
+  using autoware_utils_geometry::find_first_collision_along_path;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> position(0.0, 100.0);
+  for (const std::size_t footprint_count : {1UL, 2UL, 3UL, 37UL, 200UL}) {
+    std::vector<StaticConvexPolygon2d<4>> footprints;
+    for (std::size_t i = 0; i < footprint_count; ++i) {
+      const double t = 0.5 * static_cast<double>(i);
+      footprints.push_back(StaticConvexPolygon2d<4>::create_box(
+        Point2d{t, 50.0 + 20.0 * std::sin(0.05 * t)}, std::atan(std::cos(0.05 * t)), 3.8, 1.0,
+        1.9));
+    }
+    for (const std::size_t object_count : {1UL, 10UL, 100UL}) {
+      std::vector<ConvexPolygon2d> objects;
+      for (std::size_t i = 0; i < object_count; ++i) {
+        const auto polygon = autoware_utils_geometry::random_convex_polygon(6, 5.0);
+        autoware_utils_geometry::alt::PointList2d vertices;
+        const Point2d offset{position(gen), position(gen)};
+        for (const auto & p : polygon.outer()) {
+          vertices.push_back(Point2d(p) + offset);
+        }
+        objects.push_back(ConvexPolygon2d::create(vertices).value());
+      }
+
+      const auto expected = find_first_collision(footprints, objects);
+      const auto first = find_first_collision_along_path(footprints, objects);
+      ASSERT_EQ(first.has_value(), expected.has_value());
+      if (expected) {
+        EXPECT_EQ(first->index1, expected->index1);
+        EXPECT_EQ(first->index2, expected->index2);
+      }
+    }
+  }
+
+  const std::vector<StaticConvexPolygon2d<4>> footprints = {
+    StaticConvexPolygon2d<4>::create_box(Point2d{0.0, 0.0}, 0.0, 2.0, 2.0),
+    StaticConvexPolygon2d<4>::create_box(Point2d{1.0, 0.0}, 0.0, 2.0, 2.0),
+    StaticConvexPolygon2d<4>::create_box(Point2d{2.0, 0.0}, 0.0, 2.0, 2.0)};
+  const std::vector<StaticConvexPolygon2d<4>> objects = {
+    StaticConvexPolygon2d<4>::create_box(Point2d{3.5, 0.0}, 0.0, 2.0, 2.0),
+    StaticConvexPolygon2d<4>::create_box(Point2d{2.5, 0.5}, 0.0, 2.0, 2.0),
+    // away from all the footprints
+    StaticConvexPolygon2d<4>::create_box(Point2d{1.0, 5.0}, 0.0, 2.0, 2.0)};
+  const auto first = find_first_collision_along_path(footprints, objects);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first->index1, 1UL);
+  EXPECT_EQ(first->index2, 1UL);
+  EXPECT_FALSE(find_first_collision_along_path(
+    footprints, std::vector<StaticConvexPolygon2d<4>>{objects.back()}));
+  EXPECT_FALSE(find_first_collision_along_path(objects, std::vector<ConvexPolygon2d>{}));
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/decomposed_polygon.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::DecomposedPolygon2d;
+using autoware_utils_geometry::Polygon2d;
+
+Polygon2d translate(const Polygon2d & polygon, const double dx, const double dy)
+{
+  Polygon2d translated;
+  boost::geometry::transform(
+    polygon, translated,
+    boost::geometry::strategy::transform::translate_transformer<double, 2, 2>(dx, dy));
+  return translated;
+}
+}  // namespace
+
+TEST(decomposed_polygon, intersectsHole)
+{
+  Polygon2d polygon;
+  polygon.outer().emplace_back(0.0, 0.0);
+  polygon.outer().emplace_back(4.0, 0.0);
+  polygon.outer().emplace_back(4.0, 4.0);
+  polygon.outer().emplace_back(0.0, 4.0);
+  polygon.inners().emplace_back();
+  polygon.inners().back().emplace_back(1.0, 1.0);
+  polygon.inners().back().emplace_back(3.0, 1.0);
+  polygon.inners().back().emplace_back(3.0, 3.0);
+  polygon.inners().back().emplace_back(1.0, 3.0);
+  boost::geometry::correct(polygon);
+  const DecomposedPolygon2d decomposed(polygon);
+
+  Polygon2d square;
+  square.outer().emplace_back(1.5, 1.5);
+  square.outer().emplace_back(1.5, 2.5);
+  square.outer().emplace_back(2.5, 2.5);
+  square.outer().emplace_back(2.5, 1.5);
+  square.outer().emplace_back(1.5, 1.5);
+  EXPECT_FALSE(intersects(decomposed, square));                        // inside the hole
+  EXPECT_TRUE(intersects(decomposed, translate(square, 1.0, 0.0)));    // across the hole border
+  EXPECT_FALSE(intersects(decomposed, translate(square, 10.0, 0.0)));  // outside
+  EXPECT_TRUE(intersects(decomposed, DecomposedPolygon2d(translate(square, -1.2, 0.0))));
+
+  EXPECT_THROW(DecomposedPolygon2d(Polygon2d{}), std::invalid_argument);
+}
+
+TEST(decomposed_polygon, intersectsRand)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> offset(-15.0, 15.0);
+  for (auto vertices = 4UL; vertices < 20UL; ++vertices) {
+    std::vector<Polygon2d> concave_polygons;
+    for (auto i = 0; i < 10; ++i) {
+      const auto polygon = autoware_utils_geometry::random_concave_polygon(vertices, 10.0);
+      if (polygon && !polygon->outer().empty()) {
+        concave_polygons.push_back(translate(*polygon, offset(gen), offset(gen)));
+      }
+    }
+    std::vector<DecomposedPolygon2d> decomposed_polygons;
+    for (const auto & polygon : concave_polygons) {
+      decomposed_polygons.emplace_back(polygon);
+    }
+
+    for (auto i = 0; i < 20; ++i) {
+      const auto convex_polygon = translate(
+        autoware_utils_geometry::random_convex_polygon(vertices, 5.0), offset(gen), offset(gen));
+      for (std::size_t j = 0; j < concave_polygons.size(); ++j) {
+        EXPECT_EQ(
+          intersects(decomposed_polygons[j], convex_polygon),
+          boost::geometry::intersects(concave_polygons[j], convex_polygon));
+      }
+    }
+    for (std::size_t i = 0; i < concave_polygons.size(); ++i) {
+      for (std::size_t j = 0; j < concave_polygons.size(); ++j) {
+        EXPECT_EQ(
+          intersects(decomposed_polygons[i], decomposed_polygons[j]),
+          boost::geometry::intersects(concave_polygons[i], concave_polygons[j]));
+      }
+    }
+  }
+}
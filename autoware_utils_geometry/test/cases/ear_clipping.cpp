@@ -0,0 +1,279 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/ear_clipping.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr double epsilon = 1e-6;
+
+double triangles_area(const autoware_utils_geometry::Triangulator & triangulator)
+{
+  const auto & points = triangulator.points();
+  const auto & indices = triangulator.indices();
+  double area = 0.0;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const auto & a = points[indices[i]].pt;
+    const auto & b = points[indices[i + 1]].pt;
+    const auto & c = points[indices[i + 2]].pt;
+    area += std::abs((b - a).cross(c - a)) / 2;
+  }
+  return area;
+}
+
+/// @brief star shaped ring around the center, with coordinates rounded to 0.1
+autoware_utils_geometry::LinearRing2d random_star_ring(
+  std::mt19937 & gen, const std::size_t vertices, const double cx, const double cy,
+  const double min_radius, const double max_radius)
+{
+  std::uniform_real_distribution<double> radius(min_radius, max_radius);
+  autoware_utils_geometry::LinearRing2d ring;
+  for (std::size_t i = 0; i < vertices; ++i) {
+    const double angle = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(vertices);
+    const double r = radius(gen);
+    ring.emplace_back(
+      std::round((cx + r * std::cos(angle)) * 10.0) / 10.0,
+      std::round((cy + r * std::sin(angle)) * 10.0) / 10.0);
+  }
+  return ring;
+}
+}  // namespace
+
+TEST(ear_clipping, triangulator)
+{
+  using autoware_utils_geometry::Polygon2d;
+  using autoware_utils_geometry::Triangulator;
+
+  Polygon2d poly;
+  poly.outer().emplace_back(0.0, 0.0);
+  poly.outer().emplace_back(4.0, 0.0);
+  poly.outer().emplace_back(4.0, 4.0);
+  poly.outer().emplace_back(2.0, 2.0);
+  poly.outer().emplace_back(0.0, 4.0);
+  poly.inners().emplace_back();
+  poly.inners().back().emplace_back(1.0, 1.0);
+  poly.inners().back().emplace_back(1.5, 1.0);
+  poly.inners().back().emplace_back(1.5, 1.5);
+  poly.inners().back().emplace_back(1.0, 1.5);
+  boost::geometry::correct(poly);
+  const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(poly).value();
+
+  Triangulator triangulator;
+  for (int i = 0; i < 2; ++i) {  // the second call reuses the buffers
+    const auto & indices = triangulator.triangulate(alt_poly);
+    EXPECT_EQ(indices.size() % 3, 0UL);
+    EXPECT_EQ(indices.size(), 3 * autoware_utils_geometry::triangulate(alt_poly).size());
+    EXPECT_NEAR(triangles_area(triangulator), boost::geometry::area(poly), epsilon);
+  }
+}
+
+TEST(ear_clipping, triangulatorRand)
+{
+  autoware_utils_geometry::Triangulator triangulator;
+  for (auto vertices = 4UL; vertices < 30UL; ++vertices) {
+    for (auto i = 0; i < 20; ++i) {
+      const auto poly = autoware_utils_geometry::random_concave_polygon(vertices, 100.0);
+      if (!poly || poly->outer().empty()) {
+        continue;
+      }
+      const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(*poly);
+      if (!alt_poly) {
+        continue;
+      }
+      triangulator.triangulate(*alt_poly);
+      EXPECT_NEAR(triangles_area(triangulator), std::abs(boost::geometry::area(*poly)), epsilon);
+    }
+  }
+}
+
+TEST(ear_clipping, triangulatorHole)
+{
+  autoware_utils_geometry::Polygon2d poly;
+  boost::geometry::read_wkt(
+    "POLYGON((3.6 0,2.1 -2.7,-0.9 -3.9,-3.9 -1.9,-3.2 1.6,-0.5 2.3,2.9 3.7,3.6 0),"
+    "(-0.8 -0.5,0.2 -0.5,0.2 0.5,-0.8 0.5,-0.8 -0.5))",
+    poly);
+  boost::geometry::correct(poly);
+  const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(poly).value();
+
+  autoware_utils_geometry::Triangulator triangulator;
+  triangulator.triangulate(alt_poly);
+  EXPECT_NEAR(triangles_area(triangulator), boost::geometry::area(poly), epsilon);
+}
+
+TEST(ear_clipping, triangulatorHolesRand)
+{
+  using autoware_utils_geometry::Polygon2d;
+  using autoware_utils_geometry::Triangulator;
+
+  // the holes are bridged in both the linear and the z-order hashed ear tests
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::size_t> num_holes(1, 3);
+  std::uniform_int_distribution<std::size_t> hole_vertices(3, 8);
+  Triangulator hashed(8);
+  Triangulator linear(std::numeric_limits<std::size_t>::max());
+  for (auto vertices = 3UL; vertices < 60UL; ++vertices) {
+    for (auto i = 0; i < 10; ++i) {
+      Polygon2d poly;
+      poly.outer() = random_star_ring(gen, vertices, 0.0, 0.0, 30.0, 60.0);
+      const auto holes = num_holes(gen);
+      for (std::size_t h = 0; h < holes; ++h) {
+        const double angle = 2.0 * M_PI * static_cast<double>(h) / static_cast<double>(holes);
+        const double distance = holes == 1 ? 0.0 : 15.0;
+        poly.inners().push_back(random_star_ring(
+          gen, hole_vertices(gen), distance * std::cos(angle), distance * std::sin(angle), 2.0,
+          6.0));
+      }
+      boost::geometry::correct(poly);
+      if (!boost::geometry::is_valid(poly)) {
+        continue;
+      }
+      const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(poly).value();
+      const auto expected_area = boost::geometry::area(poly);
+
+      linear.triangulate(alt_poly);
+      EXPECT_NEAR(triangles_area(linear), expected_area, epsilon);
+      hashed.triangulate(alt_poly);
+      EXPECT_NEAR(triangles_area(hashed), expected_area, epsilon);
+    }
+  }
+}
+
+TEST(ear_clipping, triangulatorZOrderHash)
+{
+  using autoware_utils_geometry::Polygon2d;
+  using autoware_utils_geometry::Triangulator;
+
+  // star with a square hole, above the default threshold of the z-order hashing
+  constexpr std::size_t num_vertices = 400;
+  Polygon2d poly;
+  for (std::size_t i = 0; i < num_vertices; ++i) {
+    const double angle = 2.0 * M_PI * static_cast<double>(i) / num_vertices;
+    const double radius = i % 2 == 0 ? 100.0 : 50.0;
+    poly.outer().emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+  }
+  poly.inners().emplace_back();
+  poly.inners().back().emplace_back(-10.0, -10.0);
+  poly.inners().back().emplace_back(10.0, -10.0);
+  poly.inners().back().emplace_back(10.0, 10.0);
+  poly.inners().back().emplace_back(-10.0, 10.0);
+  boost::geometry::correct(poly);
+  const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(poly).value();
+  const auto expected_area = boost::geometry::area(poly);
+
+  Triangulator hashed;
+  Triangulator linear(std::numeric_limits<std::size_t>::max());
+  const auto num_indices = linear.triangulate(alt_poly).size();
+  EXPECT_NEAR(triangles_area(linear), expected_area, epsilon);
+  EXPECT_EQ(hashed.triangulate(alt_poly).size(), num_indices);
+  EXPECT_NEAR(triangles_area(hashed), expected_area, epsilon);
+}
+
+TEST(ear_clipping, convexDecompose)
+{
+  using autoware_utils_geometry::convex_decompose;
+  using autoware_utils_geometry::Polygon2d;
+
+  {  // convex polygon
+    Polygon2d poly;
+    poly.outer().emplace_back(0.0, 0.0);
+    poly.outer().emplace_back(4.0, 0.0);
+    poly.outer().emplace_back(5.0, 2.0);
+    poly.outer().emplace_back(4.0, 4.0);
+    poly.outer().emplace_back(0.0, 4.0);
+    boost::geometry::correct(poly);
+
+    const auto pieces = convex_decompose(poly);
+    ASSERT_EQ(pieces.size(), 1UL);
+    EXPECT_NEAR(boost::geometry::area(pieces.front()), boost::geometry::area(poly), epsilon);
+  }
+
+  {  // L-shape
+    Polygon2d poly;
+    poly.outer().emplace_back(0.0, 0.0);
+    poly.outer().emplace_back(4.0, 0.0);
+    poly.outer().emplace_back(4.0, 1.0);
+    poly.outer().emplace_back(1.0, 1.0);
+    poly.outer().emplace_back(1.0, 4.0);
+    poly.outer().emplace_back(0.0, 4.0);
+    boost::geometry::correct(poly);
+
+    const auto pieces = convex_decompose(poly);
+    EXPECT_EQ(pieces.size(), 2UL);
+    double area = 0.0;
+    for (const auto & piece : pieces) {
+      area += boost::geometry::area(piece);
+    }
+    EXPECT_NEAR(area, boost::geometry::area(poly), epsilon);
+  }
+
+  {  // square with a square hole
+    Polygon2d poly;
+    poly.outer().emplace_back(0.0, 0.0);
+    poly.outer().emplace_back(4.0, 0.0);
+    poly.outer().emplace_back(4.0, 4.0);
+    poly.outer().emplace_back(0.0, 4.0);
+    poly.inners().emplace_back();
+    poly.inners().back().emplace_back(1.0, 1.0);
+    poly.inners().back().emplace_back(3.0, 1.0);
+    poly.inners().back().emplace_back(3.0, 3.0);
+    poly.inners().back().emplace_back(1.0, 3.0);
+    boost::geometry::correct(poly);
+
+    const auto pieces = convex_decompose(poly);
+    EXPECT_LT(pieces.size(), autoware_utils_geometry::triangulate(poly).size());
+    double area = 0.0;
+    for (const auto & piece : pieces) {
+      area += boost::geometry::area(piece);
+    }
+    EXPECT_NEAR(area, boost::geometry::area(poly), epsilon);
+  }
+}
+
+TEST(ear_clipping, convexDecomposeRand)
+{
+  for (auto vertices = 4UL; vertices < 30UL; ++vertices) {
+    for (auto i = 0; i < 20; ++i) {
+      const auto poly = autoware_utils_geometry::random_concave_polygon(vertices, 100.0);
+      if (!poly || poly->outer().empty()) {
+        continue;
+      }
+      const auto alt_poly = autoware_utils_geometry::alt::Polygon2d::create(*poly);
+      if (!alt_poly) {
+        continue;
+      }
+      const auto pieces = autoware_utils_geometry::convex_decompose(*alt_poly);
+      EXPECT_LE(pieces.size(), autoware_utils_geometry::triangulate(*alt_poly).size());
+      double area = 0.0;
+      for (const auto & piece : pieces) {
+        area += autoware_utils_geometry::area(piece);
+      }
+      EXPECT_NEAR(area, std::abs(boost::geometry::area(*poly)), epsilon);
+    }
+  }
+}
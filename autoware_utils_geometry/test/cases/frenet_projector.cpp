@@ -0,0 +1,187 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/frenet_projector.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::FrenetPoint;
+using autoware_utils_geometry::FrenetProjector;
+
+std::vector<autoware_planning_msgs::msg::TrajectoryPoint> make_path(const size_t size)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double t = 0.05 * static_cast<double>(i);
+    points.at(i).pose.position.x = 10.0 * std::cos(t) + t;
+    points.at(i).pose.position.y = 10.0 * std::sin(2.0 * t);
+  }
+  return points;
+}
+
+// Brute force reference of the distance to the nearest segment.
+double nearest_distance(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points, const double x,
+  const double y)
+{
+  double nearest = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    const auto & a = points.at(i).pose.position;
+    const auto & b = points.at(i + 1).pose.position;
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double t = std::clamp(((x - a.x) * dx + (y - a.y) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+    nearest = std::min(nearest, std::hypot(a.x + t * dx - x, a.y + t * dy - y));
+  }
+  return nearest;
+}
+}  // namespace
+
+TEST(frenet_projector, straight)
+{
+  using autoware_utils_geometry::create_point;
+
+  FrenetProjector projector;
+  EXPECT_FALSE(projector.project(create_point(0.0, 0.0, 0.0)));
+  EXPECT_FALSE(projector.to_pose(0.0, 0.0));
+
+  // the repeated point makes a degenerate segment
+  const std::vector<geometry_msgs::msg::Point> points{
+    create_point(0.0, 0.0, 0.0), create_point(0.0, 0.0, 0.0), create_point(2.0, 0.0, 1.0),
+    create_point(2.0, 2.0, 1.0)};
+  projector.build(points);
+  EXPECT_DOUBLE_EQ(projector.length(), 4.0);
+
+  const auto left = projector.project(create_point(1.0, 0.5, 0.0));
+  ASSERT_TRUE(left);
+  EXPECT_DOUBLE_EQ(left->s, 1.0);
+  EXPECT_DOUBLE_EQ(left->d, 0.5);
+
+  const auto right = projector.project(create_point(3.0, 1.5, 0.0));
+  ASSERT_TRUE(right);
+  EXPECT_DOUBLE_EQ(right->s, 3.5);
+  EXPECT_DOUBLE_EQ(right->d, -1.0);
+
+  // the arc length is extrapolated beyond the ends
+  const auto before = projector.project(create_point(-1.0, -0.5, 0.0));
+  ASSERT_TRUE(before);
+  EXPECT_DOUBLE_EQ(before->s, -1.0);
+  EXPECT_DOUBLE_EQ(before->d, -0.5);
+  const auto after = projector.project(create_point(2.0, 3.0, 0.0));
+  ASSERT_TRUE(after);
+  EXPECT_DOUBLE_EQ(after->s, 5.0);
+  EXPECT_DOUBLE_EQ(after->d, 0.0);
+
+  const auto pose = projector.to_pose(1.0, 0.5);
+  ASSERT_TRUE(pose);
+  EXPECT_DOUBLE_EQ(pose->position.x, 1.0);
+  EXPECT_DOUBLE_EQ(pose->position.y, 0.5);
+  EXPECT_DOUBLE_EQ(pose->position.z, 0.5);
+  EXPECT_NEAR(autoware_utils_geometry::get_yaw(pose->orientation), 0.0, 1e-12);
+
+  const auto end = projector.to_pose(5.0, -1.0);
+  ASSERT_TRUE(end);
+  EXPECT_DOUBLE_EQ(end->position.x, 3.0);
+  EXPECT_DOUBLE_EQ(end->position.y, 3.0);
+  EXPECT_NEAR(autoware_utils_geometry::get_yaw(end->orientation), M_PI / 2.0, 1e-12);
+}
+
+TEST(frenet_projector, random)
+{
+  const auto points = make_path(300);
+  const FrenetProjector projector(points);
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> x_distribution(-12.0, 28.0);
+  std::uniform_real_distribution<double> y_distribution(-12.0, 12.0);
+  std::vector<geometry_msgs::msg::Point> queries;
+  for (int i = 0; i < 500; ++i) {
+    const double x = x_distribution(generator);
+    const double y = y_distribution(generator);
+    queries.push_back(autoware_utils_geometry::create_point(x, y, 0.0));
+
+    const auto result = projector.project(x, y);
+    ASSERT_TRUE(result);
+    const auto pose = projector.to_pose(result->s, 0.0);
+    ASSERT_TRUE(pose);
+    const double distance = std::hypot(pose->position.x - x, pose->position.y - y);
+    const bool at_end = result->s <= 0.0 || projector.length() <= result->s;
+    if (!at_end) {
+      EXPECT_NEAR(std::abs(result->d), nearest_distance(points, x, y), 1e-9);
+      EXPECT_NEAR(distance, std::abs(result->d), 1e-9);
+    }
+  }
+
+  // the walks between unrelated points stop at local minima, which the index corrects
+  std::vector<FrenetPoint> results;
+  ASSERT_TRUE(projector.project(queries, results));
+  ASSERT_EQ(results.size(), queries.size());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    const auto expected = projector.project(queries.at(i));
+    EXPECT_NEAR(std::abs(results.at(i).d), std::abs(expected->d), 1e-9);
+    const auto hinted = projector.project(queries.at(i).x, queries.at(i).y, 299);
+    ASSERT_TRUE(hinted);
+    EXPECT_NEAR(std::abs(hinted->d), std::abs(expected->d), 1e-9);
+  }
+}
+
+TEST(frenet_projector, round_trip)
+{
+  const auto points = make_path(300);
+  const FrenetProjector projector(points);
+
+  // the poses at a small offset of the middle of the segments project back to the same coordinates
+  const auto & arc_lengths = projector.arc_lengths();
+  std::vector<FrenetPoint> frenet_points;
+  for (size_t i = 0; i + 1 < arc_lengths.size(); ++i) {
+    const double s = 0.5 * (arc_lengths.at(i) + arc_lengths.at(i + 1));
+    frenet_points.push_back(FrenetPoint{s, 0.05 * std::sin(s), 0});
+  }
+  std::vector<geometry_msgs::msg::Pose> poses;
+  ASSERT_TRUE(projector.to_poses(frenet_points, poses));
+  ASSERT_EQ(poses.size(), frenet_points.size());
+
+  std::vector<FrenetPoint> results;
+  ASSERT_TRUE(projector.project(poses, results));
+  for (size_t i = 0; i < poses.size(); ++i) {
+    const auto pose = projector.to_pose(frenet_points.at(i).s, frenet_points.at(i).d);
+    EXPECT_DOUBLE_EQ(pose->position.x, poses.at(i).position.x);
+    EXPECT_DOUBLE_EQ(pose->position.y, poses.at(i).position.y);
+    // except where the path crosses itself
+    const auto & p = poses.at(i).position;
+    if (nearest_distance(points, p.x, p.y) < std::abs(frenet_points.at(i).d) - 1e-9) {
+      continue;
+    }
+    EXPECT_NEAR(results.at(i).s, frenet_points.at(i).s, 1e-9);
+    EXPECT_NEAR(results.at(i).d, frenet_points.at(i).d, 1e-9);
+
+    // the hinted walk from the next segment finds the same coordinates
+    const auto hinted = projector.project(
+      poses.at(i).position.x, poses.at(i).position.y, results.at(i).segment_index + 1);
+    ASSERT_TRUE(hinted);
+    EXPECT_EQ(hinted->segment_index, results.at(i).segment_index);
+  }
+}
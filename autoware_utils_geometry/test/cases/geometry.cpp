@@ -14,8 +14,10 @@
 
 #include "autoware_utils_geometry/geometry.hpp"
 
+#include "autoware_utils_geometry/alt_geometry.hpp"
 #include "autoware_utils_geometry/boost_geometry.hpp"
 #include "autoware_utils_geometry/ear_clipping.hpp"
+#include "autoware_utils_geometry/gjk_2d.hpp"
 #include "autoware_utils_geometry/random_concave_polygon.hpp"
 #include "autoware_utils_geometry/random_convex_polygon.hpp"
 #include "autoware_utils_geometry/sat_2d.hpp"
@@ -29,10 +31,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <iostream>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -215,6 +221,43 @@ TEST(geometry, get_pose)
   }
 }
 
+TEST(geometry, get_point_view)
+{
+  using autoware_utils_geometry::get_point_ref;
+  using autoware_utils_geometry::get_point_view;
+  using autoware_utils_geometry::get_pose_ref;
+  using autoware_utils_geometry::get_pose_view;
+  using autoware_utils_geometry::has_point_ref;
+  using autoware_utils_geometry::has_pose_ref;
+
+  static_assert(has_point_ref<geometry_msgs::msg::Point>::value);
+  static_assert(has_point_ref<autoware_planning_msgs::msg::TrajectoryPoint>::value);
+  static_assert(!has_point_ref<geometry_msgs::msg::Point32>::value);
+  static_assert(has_pose_ref<autoware_planning_msgs::msg::PathPoint>::value);
+  static_assert(!has_pose_ref<geometry_msgs::msg::Point>::value);
+
+  {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position.x = 1.0;
+    EXPECT_EQ(&get_point_ref(p), &p.pose.position);
+    EXPECT_EQ(&get_point_view(p), &p.pose.position);
+    EXPECT_EQ(&get_pose_ref(p), &p.pose);
+    EXPECT_EQ(&get_pose_view(p), &p.pose);
+  }
+
+  {
+    geometry_msgs::msg::Point32 p;
+    p.x = 1.0;
+    p.y = 2.0;
+    p.z = 3.0;
+    static_assert(std::is_same_v<decltype(get_point_view(p)), geometry_msgs::msg::Point>);
+    const auto & p_out = get_point_view(p);
+    EXPECT_DOUBLE_EQ(p_out.x, 1.0);
+    EXPECT_DOUBLE_EQ(p_out.y, 2.0);
+    EXPECT_DOUBLE_EQ(p_out.z, 3.0);
+  }
+}
+
 TEST(geometry, get_longitudinal_velocity)
 {
   using autoware_utils_geometry::get_longitudinal_velocity;
@@ -339,6 +382,78 @@ TEST(geometry, set_longitudinal_velocity)
   }
 }
 
+TEST(geometry, set_longitudinal_velocities)
+{
+  using autoware_utils_geometry::get_longitudinal_velocity;
+  using autoware_utils_geometry::set_longitudinal_velocities;
+
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(3);
+
+  set_longitudinal_velocities(2.0f, points);
+  for (const auto & p : points) {
+    EXPECT_DOUBLE_EQ(get_longitudinal_velocity(p), 2.0);
+  }
+
+  set_longitudinal_velocities(std::vector<float>{1.0f, 2.0f, 3.0f}, points);
+  EXPECT_DOUBLE_EQ(points.at(0).longitudinal_velocity_mps, 1.0);
+  EXPECT_DOUBLE_EQ(points.at(1).longitudinal_velocity_mps, 2.0);
+  EXPECT_DOUBLE_EQ(points.at(2).longitudinal_velocity_mps, 3.0);
+
+  EXPECT_THROW(
+    set_longitudinal_velocities(std::vector<float>{1.0f}, points), std::invalid_argument);
+}
+
+namespace
+{
+struct CustomPoint
+{
+  geometry_msgs::msg::Pose pose;
+  float velocity;
+};
+}  // namespace
+
+namespace autoware_utils_geometry
+{
+template <>
+struct PointTraits<CustomPoint>
+{
+  static geometry_msgs::msg::Pose & pose(CustomPoint & p) { return p.pose; }
+  static const geometry_msgs::msg::Pose & pose(const CustomPoint & p) { return p.pose; }
+  static float & longitudinal_velocity(CustomPoint & p) { return p.velocity; }
+  static const float & longitudinal_velocity(const CustomPoint & p) { return p.velocity; }
+};
+}  // namespace autoware_utils_geometry
+
+TEST(geometry, point_traits)
+{
+  using autoware_utils_geometry::get_longitudinal_velocity;
+  using autoware_utils_geometry::get_point_view;
+  using autoware_utils_geometry::get_pose;
+  using autoware_utils_geometry::has_longitudinal_velocity_trait;
+  using autoware_utils_geometry::has_pose_trait;
+  using autoware_utils_geometry::set_longitudinal_velocity;
+  using autoware_utils_geometry::set_pose;
+
+  static_assert(has_pose_trait<geometry_msgs::msg::Pose>::value);
+  static_assert(!has_longitudinal_velocity_trait<geometry_msgs::msg::Pose>::value);
+  static_assert(has_longitudinal_velocity_trait<autoware_planning_msgs::msg::PathPoint>::value);
+  static_assert(!has_pose_trait<geometry_msgs::msg::Point>::value);
+  static_assert(has_pose_trait<CustomPoint>::value);
+
+  CustomPoint p{};
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = 1.0;
+  pose.position.y = 2.0;
+  set_pose(pose, p);
+  set_longitudinal_velocity(3.0f, p);
+
+  EXPECT_DOUBLE_EQ(get_pose(p).position.x, 1.0);
+  EXPECT_DOUBLE_EQ(get_longitudinal_velocity(p), 3.0);
+
+  static_assert(std::is_reference_v<decltype(get_point_view(p))>);
+  EXPECT_EQ(&get_point_view(p), &p.pose.position);
+}
+
 TEST(geometry, create_point)
 {
   using autoware_utils_geometry::create_point;
@@ -432,6 +547,53 @@ TEST(geometry, create_quaternion_from_yaw)
   }
 }
 
+TEST(geometry, get_yaw)
+{
+  using autoware_utils_geometry::create_quaternion_from_rpy;
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+  using autoware_utils_geometry::create_quaternions_from_yaws;
+  using autoware_utils_geometry::get_rpy;
+  using autoware_utils_geometry::get_yaw;
+  using autoware_utils_geometry::get_yaws;
+  using autoware_utils_geometry::TrigonometryMode;
+  using autoware_utils_math::deg2rad;
+
+  for (double yaw = -180.0; yaw <= 180.0; yaw += 7.5) {
+    const auto quat = create_quaternion_from_rpy(deg2rad(10), deg2rad(-20), deg2rad(yaw));
+    EXPECT_NEAR(get_yaw(quat), get_rpy(quat).z, 1e-12);
+    const double fast_yaw = get_yaw(quat, TrigonometryMode::fast);
+    EXPECT_NEAR(autoware_utils_math::normalize_radian(fast_yaw - get_rpy(quat).z), 0.0, 2e-4);
+    EXPECT_LE(fast_yaw, M_PI);
+    EXPECT_GE(fast_yaw, -M_PI);
+
+    const auto expected = create_quaternion_from_rpy(0.0, 0.0, deg2rad(yaw));
+    const auto accurate_quat = create_quaternion_from_yaw(deg2rad(yaw));
+    const auto fast_quat = create_quaternion_from_yaw(deg2rad(yaw), TrigonometryMode::fast);
+    EXPECT_DOUBLE_EQ(accurate_quat.x, 0.0);
+    EXPECT_DOUBLE_EQ(accurate_quat.y, 0.0);
+    EXPECT_NEAR(accurate_quat.z, expected.z, 1e-12);
+    EXPECT_NEAR(accurate_quat.w, expected.w, 1e-12);
+    EXPECT_NEAR(fast_quat.z, expected.z, 1e-4);
+    EXPECT_NEAR(fast_quat.w, expected.w, 1e-4);
+  }
+
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(3);
+  const std::vector<double> answers{deg2rad(-90), deg2rad(30), deg2rad(179)};
+  std::vector<geometry_msgs::msg::Quaternion> quaternions;
+  create_quaternions_from_yaws(answers, quaternions);
+  ASSERT_EQ(quaternions.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points.at(i).pose.orientation = quaternions.at(i);
+  }
+
+  std::vector<double> yaws;
+  get_yaws(points, yaws);
+  ASSERT_EQ(yaws.size(), answers.size());
+  for (size_t i = 0; i < answers.size(); ++i) {
+    EXPECT_NEAR(yaws.at(i), answers.at(i), 1e-12);
+  }
+}
+
 TEST(geometry, calc_elevation_angle)
 {
   using autoware_utils_geometry::calc_elevation_angle;
@@ -1237,6 +1399,48 @@ TEST(geometry, calc_offset_pose)
   }
 }
 
+TEST(geometry, calc_offset_poses)
+{
+  using autoware_utils_geometry::calc_offset_pose;
+  using autoware_utils_geometry::calc_offset_poses;
+  using autoware_utils_geometry::create_quaternion_from_rpy;
+  using autoware_utils_geometry::PoseOffset;
+  using autoware_utils_geometry::TrigonometryMode;
+  using autoware_utils_math::deg2rad;
+
+  geometry_msgs::msg::Pose p_in;
+  p_in.position.x = 1.0;
+  p_in.position.y = -2.0;
+  p_in.position.z = 0.5;
+  p_in.orientation = create_quaternion_from_rpy(deg2rad(10), deg2rad(-20), deg2rad(70));
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<PoseOffset> offsets;
+  for (int i = 0; i < 100; ++i) {
+    offsets.push_back({dist(gen), dist(gen), dist(gen), dist(gen)});
+  }
+
+  const auto expect_poses = [&](const auto & poses, const double epsilon) {
+    ASSERT_EQ(poses.size(), offsets.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+      const auto & o = offsets.at(i);
+      const auto expected = calc_offset_pose(p_in, o.x, o.y, o.z, o.yaw);
+      EXPECT_NEAR(poses.at(i).position.x, expected.position.x, epsilon);
+      EXPECT_NEAR(poses.at(i).position.y, expected.position.y, epsilon);
+      EXPECT_NEAR(poses.at(i).position.z, expected.position.z, epsilon);
+      // q and -q are the same rotation.
+      const auto & q1 = poses.at(i).orientation;
+      const auto & q2 = expected.orientation;
+      const double dot = q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+      EXPECT_NEAR(std::abs(dot), 1.0, epsilon);
+    }
+  };
+
+  expect_poses(calc_offset_poses(p_in, offsets), 1e-9);
+  expect_poses(calc_offset_poses(p_in, offsets, TrigonometryMode::fast), 1e-4);
+}
+
 TEST(geometry, is_driving_forward)
 {
   using autoware_utils_geometry::calc_interpolated_point;
@@ -1299,6 +1503,57 @@ TEST(geometry, is_driving_forward)
   }
 }
 
+TEST(geometry, split_by_driving_direction)
+{
+  using autoware_utils_geometry::create_point;
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+  using autoware_utils_geometry::DrivingDirectionRange;
+  using autoware_utils_geometry::split_by_driving_direction;
+
+  const auto make_point = [](const double x, const double yaw) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position = create_point(x, 0.0, 0.0);
+    p.pose.orientation = create_quaternion_from_yaw(yaw);
+    return p;
+  };
+  const auto expect_ranges = [](
+                               const std::vector<DrivingDirectionRange> & ranges,
+                               const std::vector<DrivingDirectionRange> & expected) {
+    ASSERT_EQ(ranges.size(), expected.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_EQ(ranges.at(i).begin, expected.at(i).begin);
+      EXPECT_EQ(ranges.at(i).end, expected.at(i).end);
+      EXPECT_EQ(ranges.at(i).is_driving_forward, expected.at(i).is_driving_forward);
+    }
+  };
+
+  {
+    std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points;
+    EXPECT_TRUE(split_by_driving_direction(points).empty());
+    points.push_back(make_point(0.0, 0.0));
+    EXPECT_TRUE(split_by_driving_direction(points).empty());
+  }
+
+  // forward to x = 2, reverse back to x = 0, then forward again
+  {
+    const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points{
+      make_point(0.0, 0.0), make_point(1.0, 0.0), make_point(2.0, 0.0),
+      make_point(1.0, 0.0), make_point(0.0, 0.0), make_point(1.0, 0.0)};
+    expect_ranges(
+      split_by_driving_direction(points), {{0, 3, true}, {2, 5, false}, {4, 6, true}});
+  }
+
+  // the repeated point at the cusp and at the start keeps the direction of its neighbors
+  {
+    const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points{
+      make_point(0.0, M_PI), make_point(0.0, M_PI), make_point(1.0, M_PI), make_point(2.0, M_PI),
+      make_point(2.0, M_PI), make_point(1.0, M_PI)};
+    std::vector<DrivingDirectionRange> ranges;
+    split_by_driving_direction(points, ranges);
+    expect_ranges(ranges, {{0, 5, false}, {4, 6, true}});
+  }
+}
+
 TEST(geometry, calc_interpolated_point)
 {
   using autoware_utils_geometry::calc_interpolated_point;
@@ -1845,6 +2100,68 @@ TEST(geometry, intersect)
   }
 }
 
+TEST(geometry, intersect_polylines)
+{
+  using autoware_utils_geometry::create_point;
+  using autoware_utils_geometry::intersect;
+  using autoware_utils_geometry::intersect_polylines;
+
+  {  // Empty and single point polylines
+    const std::vector<geometry_msgs::msg::Point> line{
+      create_point(0.0, 0.0, 0.0), create_point(1.0, 1.0, 0.0)};
+    EXPECT_TRUE(intersect_polylines(line, std::vector<geometry_msgs::msg::Point>{}).empty());
+    EXPECT_TRUE(intersect_polylines(line, std::vector{create_point(0.5, 0.5, 0.0)}).empty());
+  }
+
+  {  // Crossing at a shared vertex is reported for each pair of segments, as intersect()
+    const std::vector<geometry_msgs::msg::Point> line1{
+      create_point(-1.0, 0.0, 0.0), create_point(0.0, 0.0, 0.0), create_point(1.0, 0.0, 0.0)};
+    const std::vector<geometry_msgs::msg::Point> line2{
+      create_point(0.0, -1.0, 0.0), create_point(0.0, 1.0, 0.0)};
+    const auto result = intersect_polylines(line1, line2);
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result.at(0).segment_index1, 0u);
+    EXPECT_EQ(result.at(1).segment_index1, 1u);
+    EXPECT_NEAR(result.at(0).point.x, 0.0, epsilon);
+    EXPECT_NEAR(result.at(0).point.y, 0.0, epsilon);
+  }
+
+  // Same as the double loop
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  for (int trial = 0; trial < 20; ++trial) {
+    std::vector<autoware_planning_msgs::msg::PathPoint> path(50);
+    for (auto & p : path) {
+      p.pose.position = create_point(dist(engine), dist(engine), 0.0);
+    }
+    std::vector<geometry_msgs::msg::Point> border(30);
+    for (auto & p : border) {
+      p = create_point(dist(engine), dist(engine), 0.0);
+    }
+
+    std::vector<autoware_utils_geometry::PolylineIntersection> expected;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+      for (size_t j = 0; j + 1 < border.size(); ++j) {
+        const auto point = intersect(
+          path.at(i).pose.position, path.at(i + 1).pose.position, border.at(j), border.at(j + 1));
+        if (point) {
+          expected.push_back({i, j, *point});
+        }
+      }
+    }
+
+    const auto result = intersect_polylines(path, border);
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+      EXPECT_EQ(result.at(i).segment_index1, expected.at(i).segment_index1);
+      EXPECT_EQ(result.at(i).segment_index2, expected.at(i).segment_index2);
+      EXPECT_EQ(result.at(i).point.x, expected.at(i).point.x);
+      EXPECT_EQ(result.at(i).point.y, expected.at(i).point.y);
+      EXPECT_EQ(result.at(i).point.z, expected.at(i).point.z);
+    }
+  }
+}
+
 TEST(
   geometry,
   DISABLED_intersectPolygon)  // GJK give different result for edge test (point sharing and edge
@@ -2425,3 +2742,64 @@ TEST(geometry, intersectConcavePolygonRand)
     std::printf("\tTotal:\n\t\tTriangulation = %2.2f ms\n", triangulation_ns / 1e6);
   }
 }
+
+TEST(geometry, compareIntersectionPredicates)
+{
+  using autoware_utils_geometry::IntersectionPredicate;
+  using autoware_utils_geometry::Polygon2d;
+
+  std::vector<Polygon2d> polygons1;
+  std::vector<Polygon2d> polygons2;
+  for (auto i = 0; i < 40; ++i) {
+    polygons1.push_back(autoware_utils_geometry::random_convex_polygon(5, 10.0));
+    polygons2.push_back(autoware_utils_geometry::random_convex_polygon(8, 10.0));
+  }
+
+  const std::vector<IntersectionPredicate> predicates{
+    {"boost",
+     [](const Polygon2d & p1, const Polygon2d & p2) {
+       return boost::geometry::intersects(p1, p2);
+     }},
+    {"sat",
+     [](const Polygon2d & p1, const Polygon2d & p2) {
+       return autoware_utils_geometry::sat::intersects(p1, p2);
+     }},
+    {"gjk",
+     [](const Polygon2d & p1, const Polygon2d & p2) {
+       return autoware_utils_geometry::gjk::intersects(p1, p2);
+     }},
+    {"alt",
+     [](const Polygon2d & p1, const Polygon2d & p2) {
+       return autoware_utils_geometry::intersects(
+         autoware_utils_geometry::alt::ConvexPolygon2d::create(p1).value(),
+         autoware_utils_geometry::alt::ConvexPolygon2d::create(p2).value());
+     }},
+    {"never", [](const Polygon2d &, const Polygon2d &) { return false; }}};
+
+  const auto report =
+    autoware_utils_geometry::compare_intersection_predicates(polygons1, polygons2, predicates, 4);
+  ASSERT_EQ(report.pairs, polygons1.size() * polygons2.size());
+  ASSERT_EQ(report.results.size(), predicates.size());
+  for (size_t k = 0; k < report.results.size(); ++k) {
+    const auto & result = report.results.at(k);
+    EXPECT_EQ(result.name, predicates.at(k).name);
+    const auto expected_intersections =
+      k + 1 < report.results.size() ? report.results.front().intersections : 0UL;
+    EXPECT_EQ(result.intersections, expected_intersections);
+    std::printf(
+      "%s: %zu / %zu pairs with intersects, %.1f pairs/s\n", result.name.c_str(),
+      result.intersections, report.pairs, result.pairs_per_second);
+  }
+
+  // only "never" disagrees with the others
+  ASSERT_GT(report.results.front().intersections, 0UL);
+  EXPECT_EQ(
+    report.disagreements.size(), std::min<size_t>(100, report.results.front().intersections));
+  for (const auto & [i, j] : report.disagreements) {
+    EXPECT_TRUE(boost::geometry::intersects(polygons1.at(i), polygons2.at(j)));
+  }
+
+  const auto single_thread_report = autoware_utils_geometry::compare_intersection_predicates(
+    polygons1, polygons2, predicates, 1, report.pairs);
+  EXPECT_EQ(single_thread_report.disagreements.size(), report.results.front().intersections);
+}
@@ -0,0 +1,283 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/gjk_2d.hpp"
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+
+constexpr double epsilon = 1e-6;
+
+Polygon2d translate(const Polygon2d & polygon, const double x, const double y)
+{
+  Polygon2d translated;
+  for (const auto & p : polygon.outer()) {
+    translated.outer().emplace_back(p.x() + x, p.y() + y);
+  }
+  return translated;
+}
+
+// The penetration depth is the minimum of the support function of the Minkowski difference over
+// the edge normals of both polygons.
+double penetration_depth(const Polygon2d & polygon1, const Polygon2d & polygon2)
+{
+  const auto support = [](const Polygon2d & polygon, const double nx, const double ny) {
+    double max = std::numeric_limits<double>::lowest();
+    for (const auto & p : polygon.outer()) {
+      max = std::max(max, nx * p.x() + ny * p.y());
+    }
+    return max;
+  };
+  double depth = std::numeric_limits<double>::max();
+  for (const auto * polygon : {&polygon1, &polygon2}) {
+    const auto & outer = polygon->outer();
+    for (std::size_t i = 0; i + 1 < outer.size(); ++i) {
+      const double ex = outer[i + 1].x() - outer[i].x();
+      const double ey = outer[i + 1].y() - outer[i].y();
+      const double norm = std::hypot(ex, ey);
+      if (norm == 0.0) {
+        continue;
+      }
+      for (const double sign : {1.0, -1.0}) {
+        const double nx = sign * ey / norm;
+        const double ny = -sign * ex / norm;
+        depth = std::min(depth, support(polygon1, nx, ny) + support(polygon2, -nx, -ny));
+      }
+    }
+  }
+  return depth;
+}
+}  // namespace
+
+TEST(gjk_2d, signed_distance)
+{
+  using autoware_utils_geometry::gjk::signed_distance;
+
+  Polygon2d square;
+  square.outer() = {{1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, 1.0}, {1.0, 1.0}};
+
+  {  // separated
+    const auto result = signed_distance(square, translate(square, 5.0, 0.5));
+    EXPECT_NEAR(result.distance, 3.0, epsilon);
+    EXPECT_NEAR(result.point1.x(), 1.0, epsilon);
+    EXPECT_NEAR(result.point2.x(), 4.0, epsilon);
+  }
+
+  {  // overlapping
+    const auto result = signed_distance(square, translate(square, 1.5, 0.2));
+    EXPECT_NEAR(result.distance, -0.5, epsilon);
+    EXPECT_NEAR(result.point1.x() - result.point2.x(), 0.5, epsilon);
+    EXPECT_NEAR(result.point1.y() - result.point2.y(), 0.0, epsilon);
+  }
+
+  {  // same polygons
+    const auto result = signed_distance(square, square);
+    EXPECT_NEAR(result.distance, -2.0, epsilon);
+  }
+
+  {  // touching
+    const auto result = signed_distance(square, translate(square, 2.0, 0.0));
+    EXPECT_NEAR(result.distance, 0.0, epsilon);
+  }
+
+  EXPECT_THROW(signed_distance(square, Polygon2d{}), std::invalid_argument);
+}
+
+TEST(gjk_2d, signed_distance_rand)
+{
+  using autoware_utils_geometry::gjk::signed_distance;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> offset(-15.0, 15.0);
+  for (auto vertices = 3UL; vertices < 10UL; ++vertices) {
+    for (int i = 0; i < 200; ++i) {
+      const auto polygon1 = autoware_utils_geometry::random_convex_polygon(vertices, 10.0);
+      const auto polygon2 = translate(
+        autoware_utils_geometry::random_convex_polygon(vertices, 10.0), offset(gen), offset(gen));
+
+      const auto result = signed_distance(polygon1, polygon2);
+      const double witness_distance = std::hypot(
+        result.point1.x() - result.point2.x(), result.point1.y() - result.point2.y());
+      EXPECT_NEAR(witness_distance, std::abs(result.distance), epsilon);
+
+      if (boost::geometry::intersects(polygon1, polygon2)) {
+        EXPECT_NEAR(result.distance, -penetration_depth(polygon1, polygon2), epsilon);
+        // moving the first polygon by the penetration vector makes the polygons touch
+        const auto moved = translate(
+          polygon1, result.point2.x() - result.point1.x(), result.point2.y() - result.point1.y());
+        EXPECT_NEAR(signed_distance(moved, polygon2).distance, 0.0, epsilon);
+      } else {
+        EXPECT_NEAR(result.distance, boost::geometry::distance(polygon1, polygon2), epsilon);
+      }
+
+      // same result with the alt polygons
+      const auto alt1 = autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon1).value();
+      const auto alt2 = autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon2).value();
+      EXPECT_NEAR(signed_distance(alt1, alt2).distance, result.distance, epsilon);
+    }
+  }
+}
+
+TEST(gjk_2d, time_of_impact)
+{
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+  using autoware_utils_geometry::alt::Vector2d;
+  using autoware_utils_geometry::gjk::Motion2d;
+  using autoware_utils_geometry::gjk::time_of_impact;
+
+  const auto square =
+    StaticConvexPolygon2d<4>::create({{1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, 1.0}}).value();
+  const auto far_square =
+    StaticConvexPolygon2d<4>::create({{11.0, 1.0}, {11.0, -1.0}, {9.0, -1.0}, {9.0, 1.0}}).value();
+  constexpr double tolerance = 1e-3;
+
+  {  // moving towards each other
+    const Motion2d motion1{Vector2d(1.0, 0.0), 0.0, {}};
+    const Motion2d motion2{Vector2d(-1.0, 0.0), 0.0, {}};
+    const auto time = time_of_impact(square, motion1, far_square, motion2, 10.0, tolerance);
+    ASSERT_TRUE(time);
+    EXPECT_LE(*time, 4.0);
+    EXPECT_NEAR(*time, 4.0, tolerance);
+  }
+
+  {  // too slow to collide within the interval
+    const Motion2d motion1{Vector2d(1.0, 0.0), 0.0, {}};
+    EXPECT_FALSE(time_of_impact(square, motion1, far_square, Motion2d{}, 7.0, tolerance));
+  }
+
+  {  // moving away from each other
+    const Motion2d motion1{Vector2d(-1.0, 0.0), 0.0, {}};
+    EXPECT_FALSE(time_of_impact(square, motion1, far_square, Motion2d{}, 100.0, tolerance));
+  }
+
+  {  // passing by without contact
+    const Motion2d motion1{Vector2d(1.0, 3.0), 0.0, {}};
+    EXPECT_FALSE(time_of_impact(square, motion1, far_square, Motion2d{}, 100.0, tolerance));
+  }
+
+  {  // initially intersecting
+    EXPECT_EQ(time_of_impact(square, Motion2d{}, square, Motion2d{}, 1.0, tolerance), 0.0);
+  }
+
+  {  // rotating bar hitting the corner (4, 2) of a box
+    const auto bar =
+      StaticConvexPolygon2d<4>::create({{5.0, 0.1}, {5.0, -0.1}, {0.0, -0.1}, {0.0, 0.1}}).value();
+    const auto box =
+      StaticConvexPolygon2d<4>::create({{4.0, 3.0}, {4.0, 2.0}, {3.0, 2.0}, {3.0, 3.0}}).value();
+    const Motion2d rotation{Vector2d(), 1.0, {0.0, 0.0}};
+    const double expected = std::atan2(2.0, 4.0) - std::asin(0.1 / std::hypot(4.0, 2.0));
+    const auto time = time_of_impact(bar, rotation, box, Motion2d{}, 1.0, tolerance);
+    ASSERT_TRUE(time);
+    EXPECT_LE(*time, expected);
+    EXPECT_NEAR(*time, expected, tolerance);
+
+    const Motion2d reverse_rotation{Vector2d(), -1.0, {0.0, 0.0}};
+    EXPECT_FALSE(time_of_impact(bar, reverse_rotation, box, Motion2d{}, 1.0, tolerance));
+  }
+
+  {  // fast rotating bar hitting the corner (4, 2) of a box
+    const auto bar =
+      StaticConvexPolygon2d<4>::create({{5.0, 0.1}, {5.0, -0.1}, {0.0, -0.1}, {0.0, 0.1}}).value();
+    const auto box =
+      StaticConvexPolygon2d<4>::create({{4.0, 3.0}, {4.0, 2.0}, {3.0, 2.0}, {3.0, 3.0}}).value();
+    const Motion2d rotation{Vector2d(), 20.0, {0.0, 0.0}};
+    const double expected = (std::atan2(2.0, 4.0) - std::asin(0.1 / std::hypot(4.0, 2.0))) / 20.0;
+    const auto time = time_of_impact(bar, rotation, box, Motion2d{}, 1.0, tolerance);
+    ASSERT_TRUE(time);
+    EXPECT_LE(*time, expected);
+    EXPECT_NEAR(*time, expected, tolerance);
+  }
+
+  {  // fast spinning square next to a box, the corners pass at 1.5 - sqrt(2) without contact
+    const auto box =
+      StaticConvexPolygon2d<4>::create({{2.5, 1.0}, {2.5, -1.0}, {1.5, -1.0}, {1.5, 1.0}}).value();
+    const Motion2d spin{Vector2d(), 50.0, {0.0, 0.0}};
+    // the steps run out long before the duration, the time reached is a possible contact
+    const auto time = time_of_impact(square, spin, box, Motion2d{}, 100.0, tolerance);
+    ASSERT_TRUE(time);
+    EXPECT_GT(*time, 0.0);
+    EXPECT_LT(*time, 100.0);
+  }
+}
+
+TEST(gjk_2d, intersection_query)
+{
+  using autoware_utils_geometry::gjk::IntersectionQuery;
+
+  Polygon2d square;
+  square.outer() = {{1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, 1.0}, {1.0, 1.0}};
+  IntersectionQuery query(square);
+
+  // footprints along a straight path going through the square
+  std::vector<Polygon2d> footprints;
+  for (int i = 0; i <= 200; ++i) {
+    footprints.push_back(translate(square, -10.05 + 0.1 * i, 0.5));
+  }
+  std::size_t support_count = 0;
+  for (const auto & footprint : footprints) {
+    EXPECT_EQ(
+      query.intersects(footprint), autoware_utils_geometry::gjk::intersects(square, footprint));
+    support_count += query.support_count();
+  }
+  // one support point for most separated footprints and three for most intersecting ones, where
+  // the loop from scratch takes at least two and three
+  EXPECT_LT(support_count, 2 * footprints.size());
+
+  query.reset();
+  const auto first = query.first_intersection(footprints);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(*first, 81UL);  // the first footprint with x > -2
+  EXPECT_FALSE(query.first_intersection({translate(square, 5.0, 5.0)}));
+  EXPECT_FALSE(query.intersects(Polygon2d{}));
+  EXPECT_TRUE(query.intersects(square));
+}
+
+TEST(gjk_2d, intersection_query_rand)
+{
+  using autoware_utils_geometry::gjk::IntersectionQuery;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> offset(-15.0, 15.0);
+  std::uniform_real_distribution<double> step(-0.3, 0.3);
+  for (auto vertices = 3UL; vertices < 10UL; ++vertices) {
+    const auto polygon = autoware_utils_geometry::random_convex_polygon(vertices, 10.0);
+    const auto moving = autoware_utils_geometry::random_convex_polygon(vertices, 10.0);
+    IntersectionQuery query(polygon);
+    double x = offset(gen);
+    double y = offset(gen);
+    for (int i = 0; i < 500; ++i) {
+      x += step(gen);
+      y += step(gen);
+      const auto footprint = translate(moving, x, y);
+      EXPECT_EQ(
+        query.intersects(footprint), autoware_utils_geometry::gjk::intersects(polygon, footprint));
+    }
+  }
+}
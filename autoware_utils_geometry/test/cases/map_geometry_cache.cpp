@@ -0,0 +1,166 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/map_geometry_cache.hpp"
+
+#include "autoware_utils_geometry/ear_clipping.hpp"
+#include "autoware_utils_geometry/packed_rtree.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace alt = autoware_utils_geometry::alt;
+
+/// @brief star-shaped polygons spread over a map, and a square with a square hole
+std::vector<alt::Polygon2d> make_map_polygons(const std::size_t size)
+{
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> position(-500.0, 500.0);
+  std::uniform_real_distribution<double> radius(1.0, 5.0);
+  std::vector<alt::Polygon2d> polygons;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double x = position(random);
+    const double y = position(random);
+    alt::PointList2d outer;
+    for (int k = 0; k < 12; ++k) {  // clockwise
+      const double angle = -2.0 * M_PI * k / 12;
+      const double r = radius(random);
+      outer.emplace_back(x + r * std::cos(angle), y + r * std::sin(angle));
+    }
+    outer.push_back(outer.front());
+    polygons.push_back(alt::Polygon2d::create(outer, {}).value());
+  }
+  const alt::PointList2d outer{{0.0, 0.0}, {0.0, 10.0}, {10.0, 10.0}, {10.0, 0.0}, {0.0, 0.0}};
+  const alt::PointList2d inner{{4.0, 4.0}, {6.0, 4.0}, {6.0, 6.0}, {4.0, 6.0}, {4.0, 4.0}};
+  polygons.push_back(alt::Polygon2d::create(outer, {inner}).value());
+  return polygons;
+}
+
+double area(const std::vector<alt::ConvexPolygon2d> & triangles)
+{
+  double sum = 0.0;
+  for (const auto & triangle : triangles) {
+    sum += autoware_utils_geometry::area(triangle);
+  }
+  return sum;
+}
+}  // namespace
+
+TEST(map_geometry_cache, mapHash)
+{
+  using autoware_utils_geometry::map_hash;
+
+  const std::string a = "lanelet2 map";
+  const std::string b = "lanelet2 map ";
+  EXPECT_EQ(map_hash(a.data(), a.size()), map_hash(a.data(), a.size()));
+  EXPECT_NE(map_hash(a.data(), a.size()), map_hash(b.data(), b.size()));
+
+  const std::string path = testing::TempDir() + "map_geometry_cache_test.osm";
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << a;
+  }
+  EXPECT_EQ(autoware_utils_geometry::map_file_hash(path), map_hash(a.data(), a.size()));
+  std::remove(path.c_str());
+  EXPECT_FALSE(autoware_utils_geometry::map_file_hash(path));
+}
+
+TEST(map_geometry_cache, saveAndMap)
+{
+  using autoware_utils_geometry::Box2d;
+  using autoware_utils_geometry::load_or_build_map_geometry_cache;
+  using autoware_utils_geometry::MappedMapGeometry;
+  using autoware_utils_geometry::Point2d;
+
+  const std::string path = testing::TempDir() + "map_geometry_cache_test.bin";
+  std::remove(path.c_str());
+  EXPECT_FALSE(MappedMapGeometry::open(path, 1));
+
+  const auto polygons = make_map_polygons(600);
+  autoware_utils_geometry::PackedRTree tree(polygons);
+
+  // built on the first call, then mapped back
+  for (int call = 0; call < 2; ++call) {
+    const auto mapped = load_or_build_map_geometry_cache(path, 1, polygons);
+    ASSERT_TRUE(mapped);
+    ASSERT_EQ(mapped->size(), polygons.size());
+    EXPECT_EQ(mapped->map_hash(), 1U);
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+      const auto polygon = mapped->polygon(i);
+      ASSERT_EQ(mapped->ring_count(i), 1 + polygons[i].inners().size());
+      ASSERT_EQ(polygon.outer().size(), polygons[i].outer().size());
+      ASSERT_EQ(polygon.inners().size(), polygons[i].inners().size());
+      for (std::size_t j = 0; j < polygon.outer().size(); ++j) {
+        EXPECT_EQ(polygon.outer()[j].x(), polygons[i].outer()[j].x());
+        EXPECT_EQ(polygon.outer()[j].y(), polygons[i].outer()[j].y());
+      }
+
+      const auto triangles = autoware_utils_geometry::triangulate(polygons[i]);
+      ASSERT_EQ(mapped->triangle_count(i), triangles.size());
+      EXPECT_DOUBLE_EQ(area(mapped->triangles(i)), area(triangles));
+    }
+    EXPECT_DOUBLE_EQ(area(mapped->triangles(polygons.size() - 1)), 96.0);
+
+    std::vector<std::size_t> expected;
+    std::vector<std::size_t> actual;
+    for (const auto & box : {Box2d({-100.0, -100.0}, {100.0, 50.0}), Box2d({0.0, 0.0}, {1.0, 1.0}),
+                             Box2d({600.0, 600.0}, {700.0, 700.0})}) {
+      tree.intersecting(box, expected);
+      mapped->intersecting(box, actual);
+      std::sort(expected.begin(), expected.end());
+      std::sort(actual.begin(), actual.end());
+      EXPECT_EQ(actual, expected);
+    }
+    mapped->containing(Point2d(5.0, 5.0), actual);
+    EXPECT_NE(std::find(actual.begin(), actual.end(), polygons.size() - 1), actual.end());
+
+    const auto prepared = mapped->prepared_polygon(polygons.size() - 1);
+    EXPECT_TRUE(covered_by(alt::Point2d(1.0, 1.0), prepared));
+    EXPECT_FALSE(covered_by(alt::Point2d(5.0, 5.0), prepared));
+  }
+
+  {  // the cache of another map is rebuilt
+    EXPECT_FALSE(MappedMapGeometry::open(path, 2));
+    const std::vector<alt::Polygon2d> others(polygons.begin(), polygons.begin() + 3);
+    const auto mapped = load_or_build_map_geometry_cache(path, 2, others);
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ(mapped->size(), 3U);
+    EXPECT_FALSE(MappedMapGeometry::open(path, 1));
+  }
+
+  {  // an empty map has an empty tree
+    ASSERT_TRUE(autoware_utils_geometry::save_map_geometry_cache(path, 3, {}));
+    const auto mapped = MappedMapGeometry::open(path, 3);
+    ASSERT_TRUE(mapped);
+    std::vector<std::size_t> indices{0};
+    mapped->containing(Point2d(0.0, 0.0), indices);
+    EXPECT_TRUE(indices.empty());
+  }
+
+  {  // a truncated file is rejected
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "AWMAPGEO";
+  }
+  EXPECT_FALSE(MappedMapGeometry::open(path, 3));
+  std::remove(path.c_str());
+}
@@ -0,0 +1,137 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/msg/covariance.hpp"
+#include "autoware_utils_geometry/msg/covariance_ops.hpp"
+
+#include <Eigen/Geometry>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace
+{
+std::array<double, 36> create_covariance(const double seed)
+{
+  // symmetric positive definite
+  Eigen::Matrix<double, 6, 6> a;
+  for (int i = 0; i < 36; ++i) {
+    a(i / 6, i % 6) = std::sin(seed * (i + 1));
+  }
+  std::array<double, 36> covariance;
+  autoware_utils_geometry::covariance_view(covariance) =
+    a * a.transpose() + Eigen::Matrix<double, 6, 6>::Identity();
+  return covariance;
+}
+}  // namespace
+
+TEST(covariance, covariance_view)
+{
+  using autoware_utils_geometry::covariance_view;
+  namespace idx = autoware_utils_geometry::xyzrpy_covariance_index;
+
+  std::array<double, 36> covariance{};
+  covariance_view(covariance)(0, 1) = 2.0;
+  covariance_view(covariance)(5, 5) = 3.0;
+  EXPECT_DOUBLE_EQ(covariance[idx::X_Y], 2.0);
+  EXPECT_DOUBLE_EQ(covariance[idx::YAW_YAW], 3.0);
+  EXPECT_EQ(covariance_view(std::as_const(covariance)).data(), covariance.data());
+
+  std::array<double, 9> covariance3{};
+  covariance_view(covariance3)(2, 1) = 4.0;
+  EXPECT_DOUBLE_EQ(covariance3[autoware_utils_geometry::xyz_covariance_index::Z_Y], 4.0);
+}
+
+TEST(covariance, rotate_covariance)
+{
+  using autoware_utils_geometry::covariance_view;
+  using autoware_utils_geometry::rotate_covariance;
+
+  const Eigen::Matrix3d rotation =
+    (Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ()) *
+     Eigen::AngleAxisd(-0.2, Eigen::Vector3d::UnitY()) *
+     Eigen::AngleAxisd(0.1, Eigen::Vector3d::UnitX()))
+      .toRotationMatrix();
+  Eigen::Matrix<double, 6, 6> rotation6 = Eigen::Matrix<double, 6, 6>::Zero();
+  rotation6.block<3, 3>(0, 0) = rotation;
+  rotation6.block<3, 3>(3, 3) = rotation;
+
+  auto covariance = create_covariance(0.7);
+  const Eigen::Matrix<double, 6, 6> expected =
+    rotation6 * covariance_view(covariance) * rotation6.transpose();
+  rotate_covariance(covariance, rotation);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      EXPECT_NEAR(covariance_view(covariance)(i, j), expected(i, j), 1e-12);
+    }
+  }
+
+  // objects
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  for (int i = 0; i < 3; ++i) {
+    autoware_perception_msgs::msg::DetectedObject object;
+    object.kinematics.pose_with_covariance.covariance = create_covariance(0.1 * (i + 1));
+    objects.objects.push_back(object);
+  }
+  const auto original_objects = objects;
+  autoware_utils_geometry::rotate_pose_covariances(objects, rotation);
+  for (size_t i = 0; i < objects.objects.size(); ++i) {
+    const auto & kinematics = objects.objects.at(i).kinematics;
+    auto expected_covariance =
+      original_objects.objects.at(i).kinematics.pose_with_covariance.covariance;
+    rotate_covariance(expected_covariance, rotation);
+    EXPECT_EQ(kinematics.pose_with_covariance.covariance, expected_covariance);
+  }
+}
+
+TEST(covariance, calc_covariance_ellipse)
+{
+  using autoware_utils_geometry::calc_covariance_ellipse;
+  using autoware_utils_geometry::covariance_view;
+
+  std::array<double, 36> covariance{};
+  covariance_view(covariance)(0, 0) = 4.0;
+  covariance_view(covariance)(1, 1) = 1.0;
+  {
+    const auto ellipse = calc_covariance_ellipse(covariance);
+    EXPECT_DOUBLE_EQ(ellipse.semi_major, 2.0);
+    EXPECT_DOUBLE_EQ(ellipse.semi_minor, 1.0);
+    EXPECT_DOUBLE_EQ(ellipse.yaw, 0.0);
+  }
+
+  const Eigen::Matrix3d rotation =
+    Eigen::AngleAxisd(M_PI / 6.0, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  autoware_utils_geometry::rotate_covariance(covariance, rotation);
+  {
+    const auto ellipse = calc_covariance_ellipse(covariance);
+    EXPECT_NEAR(ellipse.semi_major, 2.0, 1e-12);
+    EXPECT_NEAR(ellipse.semi_minor, 1.0, 1e-12);
+    EXPECT_NEAR(ellipse.yaw, M_PI / 6.0, 1e-12);
+  }
+
+  autoware_perception_msgs::msg::PredictedObjects objects;
+  objects.objects.resize(2);
+  objects.objects.at(1).kinematics.initial_pose_with_covariance.covariance = covariance;
+  std::vector<autoware_utils_geometry::CovarianceEllipse2d> ellipses;
+  autoware_utils_geometry::calc_position_ellipses(objects, ellipses);
+  ASSERT_EQ(ellipses.size(), 2u);
+  EXPECT_DOUBLE_EQ(ellipses.at(0).semi_major, 0.0);
+  EXPECT_DOUBLE_EQ(ellipses.at(0).semi_minor, 0.0);
+  EXPECT_NEAR(ellipses.at(1).semi_major, 2.0, 1e-12);
+  EXPECT_NEAR(ellipses.at(1).yaw, M_PI / 6.0, 1e-12);
+}
@@ -15,3 +15,102 @@
 #include "autoware_utils_geometry/msg/operation.hpp"
 
 #include <gtest/gtest.h>
+
+#include <Eigen/Geometry>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+geometry_msgs::msg::Quaternion to_msg(const Eigen::Quaterniond & q)
+{
+  geometry_msgs::msg::Quaternion msg;
+  msg.x = q.x();
+  msg.y = q.y();
+  msg.z = q.z();
+  msg.w = q.w();
+  return msg;
+}
+
+Eigen::Quaterniond create_quaternion(const double roll, const double pitch, const double yaw)
+{
+  return Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitZ()) *
+         Eigen::AngleAxisd(pitch, Eigen::Vector3d::UnitY()) *
+         Eigen::AngleAxisd(roll, Eigen::Vector3d::UnitX());
+}
+
+void expect_near(
+  const geometry_msgs::msg::Quaternion & actual, const Eigen::Quaterniond & expected)
+{
+  // q and -q are the same rotation
+  const double sign =
+    actual.x * expected.x() + actual.y * expected.y() + actual.z * expected.z() +
+        actual.w * expected.w() <
+      0.0
+      ? -1.0
+      : 1.0;
+  EXPECT_NEAR(actual.x, sign * expected.x(), 1e-12);
+  EXPECT_NEAR(actual.y, sign * expected.y(), 1e-12);
+  EXPECT_NEAR(actual.z, sign * expected.z(), 1e-12);
+  EXPECT_NEAR(actual.w, sign * expected.w(), 1e-12);
+}
+}  // namespace
+
+TEST(operation, quaternion_multiply)
+{
+  const auto a = create_quaternion(0.1, -0.4, 2.0);
+  const auto b = create_quaternion(-1.2, 0.3, -0.7);
+  expect_near(to_msg(a) * to_msg(b), a * b);
+  expect_near(autoware_utils_geometry::conjugate(to_msg(a)), a.conjugate());
+  expect_near(
+    to_msg(a) * autoware_utils_geometry::conjugate(to_msg(a)), Eigen::Quaterniond::Identity());
+
+  std::vector<geometry_msgs::msg::Quaternion> quaternions{to_msg(b), to_msg(a)};
+  autoware_utils_geometry::rotate_quaternions(to_msg(a), quaternions);
+  expect_near(quaternions.at(0), a * b);
+  expect_near(quaternions.at(1), a * a);
+}
+
+TEST(operation, quaternion_normalize)
+{
+  geometry_msgs::msg::Quaternion q;
+  q.x = 1.0;
+  q.y = 2.0;
+  q.z = -2.0;
+  q.w = 4.0;
+  expect_near(
+    autoware_utils_geometry::normalize(q), Eigen::Quaterniond(4.0, 1.0, 2.0, -2.0).normalized());
+
+  geometry_msgs::msg::Quaternion zero;
+  zero.w = 0.0;
+  const auto normalized_zero = autoware_utils_geometry::normalize(zero);
+  EXPECT_DOUBLE_EQ(normalized_zero.w, 0.0);
+
+  std::vector<geometry_msgs::msg::Quaternion> quaternions{q, q};
+  autoware_utils_geometry::normalize_quaternions(quaternions);
+  expect_near(quaternions.at(1), Eigen::Quaterniond(4.0, 1.0, 2.0, -2.0).normalized());
+}
+
+TEST(operation, quaternion_slerp)
+{
+  const auto a = create_quaternion(0.1, -0.4, 2.0);
+  const auto b = create_quaternion(-1.2, 0.3, -0.7);
+  // the same rotation as b with the opposite sign, the interpolation still takes the shortest path
+  const Eigen::Quaterniond negative_b(-b.w(), -b.x(), -b.y(), -b.z());
+  for (const double ratio : {0.0, 0.25, 0.5, 1.0}) {
+    expect_near(autoware_utils_geometry::slerp(to_msg(a), to_msg(b), ratio), a.slerp(ratio, b));
+    expect_near(
+      autoware_utils_geometry::slerp(to_msg(a), to_msg(negative_b), ratio), a.slerp(ratio, b));
+
+    // nlerp is on the same arc but not at the same angle
+    const auto nlerp = autoware_utils_geometry::nlerp(to_msg(a), to_msg(b), ratio);
+    EXPECT_NEAR(
+      std::hypot(std::hypot(nlerp.x, nlerp.y), std::hypot(nlerp.z, nlerp.w)), 1.0, 1e-12);
+  }
+  expect_near(autoware_utils_geometry::nlerp(to_msg(a), to_msg(b), 0.5), a.slerp(0.5, b));
+
+  // nearly identical quaternions
+  const auto c = create_quaternion(0.1, -0.4, 2.0 + 1e-6);
+  expect_near(autoware_utils_geometry::slerp(to_msg(a), to_msg(c), 0.5), a.slerp(0.5, c));
+}
@@ -0,0 +1,155 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/oriented_box_2d.hpp"
+
+#include "autoware_utils_geometry/sat_2d.hpp"
+
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::OrientedBox2d;
+
+geometry_msgs::msg::Pose make_pose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation.z = std::sin(yaw / 2.0);
+  pose.orientation.w = std::cos(yaw / 2.0);
+  return pose;
+}
+
+std::vector<OrientedBox2d> make_boxes(const std::size_t size, const unsigned int seed)
+{
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> position(-10.0, 10.0);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  std::uniform_real_distribution<double> length(0.5, 6.0);
+  std::vector<OrientedBox2d> boxes;
+  for (std::size_t i = 0; i < size; ++i) {
+    autoware_perception_msgs::msg::Shape shape;
+    shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    shape.dimensions.x = length(random);
+    shape.dimensions.y = 0.5 * length(random);
+    boxes.push_back(
+      OrientedBox2d::from_shape(make_pose(position(random), position(random), yaw(random)), shape));
+  }
+  return boxes;
+}
+}  // namespace
+
+TEST(oriented_box_2d, construction)
+{
+  // the corners of to_footprint(), front left first and clockwise
+  const auto box = OrientedBox2d::from_footprint(make_pose(1.0, 2.0, M_PI / 2.0), 4.0, 1.0, 2.0);
+  EXPECT_NEAR(box.center_x, 1.0, 1e-12);
+  EXPECT_NEAR(box.center_y, 3.5, 1e-12);
+  EXPECT_DOUBLE_EQ(box.half_length, 2.5);
+  EXPECT_DOUBLE_EQ(box.half_width, 1.0);
+  const auto polygon = box.to_polygon();
+  const std::vector<std::pair<double, double>> expected{
+    {0.0, 6.0}, {2.0, 6.0}, {2.0, 1.0}, {0.0, 1.0}, {0.0, 6.0}};
+  ASSERT_EQ(polygon.outer().size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(polygon.outer()[i].x(), expected[i].first, 1e-12);
+    EXPECT_NEAR(polygon.outer()[i].y(), expected[i].second, 1e-12);
+  }
+
+  // the norm of the quaternion does not matter
+  auto pose = make_pose(0.0, 0.0, 0.3);
+  pose.orientation.z *= 2.0;
+  pose.orientation.w *= 2.0;
+  autoware_perception_msgs::msg::Shape shape;
+  shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+  shape.dimensions.x = 4.0;
+  shape.dimensions.y = 2.0;
+  const auto shape_box = OrientedBox2d::from_shape(pose, shape);
+  EXPECT_NEAR(shape_box.axis_x, std::cos(0.3), 1e-12);
+  EXPECT_NEAR(shape_box.axis_y, std::sin(0.3), 1e-12);
+  EXPECT_DOUBLE_EQ(shape_box.half_length, 2.0);
+  EXPECT_DOUBLE_EQ(shape_box.half_width, 1.0);
+
+  shape.type = autoware_perception_msgs::msg::Shape::CYLINDER;
+  EXPECT_THROW(OrientedBox2d::from_shape(pose, shape), std::logic_error);
+}
+
+TEST(oriented_box_2d, intersects)
+{
+  using autoware_utils_geometry::sat::intersects;
+
+  // touching boxes intersect, as the polygons in sat::intersects
+  const auto box = OrientedBox2d::from_footprint(make_pose(0.0, 0.0, 0.0), 1.0, 1.0, 2.0);
+  EXPECT_TRUE(
+    intersects(box, OrientedBox2d::from_footprint(make_pose(2.0, 0.0, 0.0), 1.0, 1.0, 2.0)));
+  EXPECT_FALSE(
+    intersects(box, OrientedBox2d::from_footprint(make_pose(2.1, 0.0, 0.0), 1.0, 1.0, 2.0)));
+  // separated only by an axis of the rotated box
+  EXPECT_FALSE(
+    intersects(box, OrientedBox2d::from_footprint(make_pose(2.0, 2.0, M_PI / 4.0), 1.0, 1.0, 1.0)));
+
+  const auto boxes1 = make_boxes(100, 0);
+  const auto boxes2 = make_boxes(100, 1);
+  std::size_t hits = 0;
+  for (const auto & box1 : boxes1) {
+    for (const auto & box2 : boxes2) {
+      const bool expected = boost::geometry::intersects(box1.to_polygon(), box2.to_polygon());
+      EXPECT_EQ(intersects(box1, box2), expected);
+      EXPECT_EQ(intersects(box2, box1), expected);
+      EXPECT_EQ(intersects(box1.to_polygon(), box2.to_polygon()), expected);
+      hits += expected;
+    }
+  }
+  EXPECT_LT(0U, hits);
+  EXPECT_LT(hits, boxes1.size() * boxes2.size());
+}
+
+TEST(oriented_box_2d, batchIntersects)
+{
+  using autoware_utils_geometry::sat::intersects;
+
+  const auto boxes1 = make_boxes(20, 2);
+  const auto boxes2 = make_boxes(101, 3);
+  autoware_utils_geometry::OrientedBoxArray2d array;
+  for (const auto & box : boxes2) {
+    array.push_back(box);
+  }
+  ASSERT_EQ(array.size(), boxes2.size());
+  EXPECT_DOUBLE_EQ(array[7].center_x, boxes2[7].center_x);
+  EXPECT_DOUBLE_EQ(array[7].half_width, boxes2[7].half_width);
+
+  std::vector<char> results{1, 1};
+  for (const auto & box : boxes1) {
+    std::size_t expected_count = 0;
+    const std::size_t count = intersects(box, array, results);
+    ASSERT_EQ(results.size(), boxes2.size());
+    for (std::size_t i = 0; i < boxes2.size(); ++i) {
+      EXPECT_EQ(results[i] != 0, intersects(box, boxes2[i]));
+      expected_count += intersects(box, boxes2[i]);
+    }
+    EXPECT_EQ(count, expected_count);
+  }
+
+  array.clear();
+  EXPECT_EQ(intersects(boxes1.front(), array, results), 0U);
+  EXPECT_TRUE(results.empty());
+}
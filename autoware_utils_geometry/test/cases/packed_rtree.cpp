@@ -0,0 +1,163 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/packed_rtree.hpp"
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::Box2d;
+using autoware_utils_geometry::PackedRTree;
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+
+std::vector<Polygon2d> make_polygons(const std::size_t size, const unsigned int seed)
+{
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> position(-500.0, 500.0);
+  std::vector<Polygon2d> polygons;
+  for (std::size_t i = 0; i < size; ++i) {
+    auto polygon = autoware_utils_geometry::random_convex_polygon(5, 5.0);
+    const double x = position(random);
+    const double y = position(random);
+    for (auto & point : polygon.outer()) {
+      point = Point2d(point.x() + x, point.y() + y);
+    }
+    polygons.push_back(polygon);
+  }
+  return polygons;
+}
+
+std::vector<std::size_t> brute_force_intersecting(
+  const std::vector<Polygon2d> & polygons, const Box2d & box)
+{
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < polygons.size(); ++i) {
+    if (boost::geometry::intersects(boost::geometry::return_envelope<Box2d>(polygons[i]), box)) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+}  // namespace
+
+TEST(PackedRTree, Empty)
+{
+  PackedRTree tree(std::vector<Polygon2d>{});
+  std::vector<std::size_t> indices{1};
+  tree.intersecting(Box2d(Point2d(-1.0, -1.0), Point2d(1.0, 1.0)), indices);
+  EXPECT_TRUE(indices.empty());
+  tree.nearest(Point2d(0.0, 0.0), 3, indices);
+  EXPECT_TRUE(indices.empty());
+  EXPECT_TRUE(tree.empty());
+}
+
+TEST(PackedRTree, Boxes)
+{
+  std::vector<Box2d> boxes;
+  for (int i = 0; i < 40; ++i) {
+    boxes.emplace_back(Point2d(i, 0.0), Point2d(i + 0.5, 1.0));
+  }
+  PackedRTree tree(boxes);
+  EXPECT_EQ(tree.size(), 40u);
+
+  std::vector<std::size_t> indices;
+  tree.containing(Point2d(3.25, 0.5), indices);
+  EXPECT_EQ(indices, std::vector<std::size_t>{3});
+  tree.containing(Point2d(3.75, 0.5), indices);
+  EXPECT_TRUE(indices.empty());
+
+  tree.intersecting(Box2d(Point2d(10.2, 0.2), Point2d(12.2, 0.4)), indices);
+  std::sort(indices.begin(), indices.end());
+  EXPECT_EQ(indices, (std::vector<std::size_t>{10, 11, 12}));
+
+  tree.nearest(Point2d(20.9, 3.0), 2, indices);
+  EXPECT_EQ(indices, (std::vector<std::size_t>{21, 20}));
+
+  // a single item
+  tree.build(std::vector<Box2d>{boxes.front()});
+  tree.containing(Point2d(0.25, 0.5), indices);
+  EXPECT_EQ(indices, std::vector<std::size_t>{0});
+}
+
+TEST(PackedRTree, Random)
+{
+  const auto polygons = make_polygons(20000, 0);
+  std::vector<autoware_utils_geometry::alt::ConvexPolygon2d> alt_polygons;
+  for (const auto & polygon : polygons) {
+    alt_polygons.push_back(autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon).value());
+  }
+  const PackedRTree tree(polygons);
+  const PackedRTree parallel_tree(polygons, 4);
+
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> position(-520.0, 520.0);
+  std::vector<std::size_t> indices;
+  std::vector<std::size_t> parallel_indices;
+  for (int i = 0; i < 100; ++i) {
+    const double x = position(random);
+    const double y = position(random);
+    const Box2d box(Point2d(x, y), Point2d(x + 20.0, y + 10.0));
+    tree.intersecting(box, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, brute_force_intersecting(polygons, box));
+    parallel_tree.intersecting(box, parallel_indices);
+    std::sort(parallel_indices.begin(), parallel_indices.end());
+    EXPECT_EQ(parallel_indices, indices);
+
+    // the exact nearest polygons
+    const autoware_utils_geometry::alt::Point2d point(x, y);
+    const auto distance = [&](const std::size_t index) {
+      return autoware_utils_geometry::distance(point, alt_polygons[index]);
+    };
+    tree.nearest(Point2d(x, y), 5, indices, distance);
+    std::vector<double> distances;
+    for (std::size_t j = 0; j < alt_polygons.size(); ++j) {
+      distances.push_back(distance(j));
+    }
+    std::sort(distances.begin(), distances.end());
+    ASSERT_EQ(indices.size(), 5u);
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+      EXPECT_DOUBLE_EQ(distance(indices[k]), distances[k]);
+    }
+  }
+}
+
+TEST(PackedRTree, AltPolygons)
+{
+  const auto polygons = make_polygons(100, 2);
+  std::vector<autoware_utils_geometry::alt::ConvexPolygon2d> alt_polygons;
+  for (const auto & polygon : polygons) {
+    alt_polygons.push_back(autoware_utils_geometry::alt::ConvexPolygon2d::create(polygon).value());
+  }
+  PackedRTree tree(alt_polygons);
+
+  const Box2d box(Point2d(-100.0, -100.0), Point2d(100.0, 50.0));
+  std::vector<std::size_t> indices;
+  tree.intersecting(box, indices);
+  std::sort(indices.begin(), indices.end());
+  EXPECT_EQ(indices, brute_force_intersecting(polygons, box));
+}
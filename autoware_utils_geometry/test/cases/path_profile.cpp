@@ -0,0 +1,134 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/path_profile.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr double epsilon = 1e-9;
+
+std::vector<autoware_planning_msgs::msg::TrajectoryPoint> make_arc(
+  const size_t size, const double radius)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double theta = 0.1 * static_cast<double>(i);
+    points.at(i).pose.position.x = radius * std::sin(theta);
+    points.at(i).pose.position.y = radius * (1.0 - std::cos(theta));
+  }
+  return points;
+}
+
+void expect_same_profile(
+  const autoware_utils_geometry::PathProfile & a, const autoware_utils_geometry::PathProfile & b)
+{
+  ASSERT_EQ(a.size(), b.size());
+  ASSERT_EQ(a.segment_lengths().size(), b.segment_lengths().size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    EXPECT_NEAR(a.arc_lengths().at(i), b.arc_lengths().at(i), epsilon);
+    EXPECT_NEAR(a.curvatures().at(i), b.curvatures().at(i), epsilon);
+  }
+  for (size_t i = 0; i < a.segment_lengths().size(); ++i) {
+    EXPECT_NEAR(a.segment_lengths().at(i), b.segment_lengths().at(i), epsilon);
+    EXPECT_NEAR(a.headings().at(i), b.headings().at(i), epsilon);
+  }
+}
+}  // namespace
+
+TEST(path_profile, build)
+{
+  using autoware_utils_geometry::calc_azimuth_angle;
+  using autoware_utils_geometry::calc_curvature;
+  using autoware_utils_geometry::calc_distance2d;
+  using autoware_utils_geometry::get_point;
+  using autoware_utils_geometry::PathProfile;
+
+  {
+    const PathProfile profile(std::vector<geometry_msgs::msg::Point>{});
+    EXPECT_TRUE(profile.empty());
+    EXPECT_DOUBLE_EQ(profile.length(), 0.0);
+    EXPECT_TRUE(profile.headings().empty());
+  }
+
+  const auto points = make_arc(20, 5.0);
+  const PathProfile profile(points);
+  ASSERT_EQ(profile.size(), points.size());
+  ASSERT_EQ(profile.segment_lengths().size(), points.size() - 1);
+  ASSERT_EQ(profile.headings().size(), points.size() - 1);
+
+  double length = 0.0;
+  EXPECT_DOUBLE_EQ(profile.arc_lengths().front(), 0.0);
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    const auto p1 = get_point(points.at(i));
+    const auto p2 = get_point(points.at(i + 1));
+    length += calc_distance2d(p1, p2);
+    EXPECT_NEAR(profile.segment_lengths().at(i), calc_distance2d(p1, p2), epsilon);
+    EXPECT_NEAR(profile.headings().at(i), calc_azimuth_angle(p1, p2), epsilon);
+    EXPECT_NEAR(profile.arc_lengths().at(i + 1), length, epsilon);
+  }
+  EXPECT_NEAR(profile.length(), length, epsilon);
+
+  EXPECT_DOUBLE_EQ(profile.curvatures().front(), 0.0);
+  EXPECT_DOUBLE_EQ(profile.curvatures().back(), 0.0);
+  for (size_t i = 1; i + 1 < points.size(); ++i) {
+    const auto expected = calc_curvature(
+      get_point(points.at(i - 1)), get_point(points.at(i)), get_point(points.at(i + 1)));
+    EXPECT_NEAR(profile.curvatures().at(i), expected, epsilon);
+    EXPECT_NEAR(profile.curvatures().at(i), 0.2, 1e-6);
+  }
+
+  // Degenerate triplets have zero curvature instead of throwing.
+  const std::vector<geometry_msgs::msg::Point> same_points(3);
+  EXPECT_DOUBLE_EQ(PathProfile(same_points).curvatures().at(1), 0.0);
+}
+
+TEST(path_profile, update)
+{
+  using autoware_utils_geometry::PathProfile;
+
+  auto points = make_arc(30, 5.0);
+  PathProfile profile(points);
+
+  // Modify the tail.
+  for (size_t i = 20; i < points.size(); ++i) {
+    points.at(i).pose.position.y += 0.5;
+  }
+  profile.update(points, 20);
+  expect_same_profile(profile, PathProfile(points));
+
+  // Detect the changed point automatically.
+  points.at(10).pose.position.x += 0.3;
+  profile.update(points);
+  expect_same_profile(profile, PathProfile(points));
+
+  // Append and remove points.
+  const auto longer = make_arc(40, 5.0);
+  profile.update(longer);
+  expect_same_profile(profile, PathProfile(longer));
+
+  auto shorter = longer;
+  shorter.resize(15);
+  profile.update(shorter, shorter.size());
+  expect_same_profile(profile, PathProfile(shorter));
+  EXPECT_DOUBLE_EQ(profile.curvatures().back(), 0.0);
+}
@@ -64,6 +64,17 @@ TEST(geometry, get_pose_PathWithLaneId)
   EXPECT_DOUBLE_EQ(p_out.orientation.w, q_w_ans);
 }
 
+TEST(geometry, get_point_view_PathWithLaneId)
+{
+  using autoware_utils_geometry::get_point_view;
+  using autoware_utils_geometry::get_pose_view;
+
+  autoware_internal_planning_msgs::msg::PathPointWithLaneId p;
+  p.lane_ids = {1, 2, 3};
+  EXPECT_EQ(&get_point_view(p), &p.point.pose.position);
+  EXPECT_EQ(&get_pose_view(p), &p.point.pose);
+}
+
 TEST(geometry, get_longitudinal_velocity_PathWithLaneId)
 {
   using autoware_utils_geometry::get_longitudinal_velocity;
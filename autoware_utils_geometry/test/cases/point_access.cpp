@@ -0,0 +1,59 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+#include "autoware_utils_geometry/point_access.hpp"
+
+#include <autoware_planning_msgs/msg/path_point.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+// point_access.hpp compiles without geometry.hpp, i.e. without tf2, Boost.Geometry and Eigen
+TEST(point_access, getPointWithoutGeometry)
+{
+  autoware_planning_msgs::msg::PathPoint path_point;
+  path_point.pose.position.x = 1.0;
+  path_point.pose.position.y = 2.0;
+  path_point.pose.position.z = 3.0;
+
+  const auto point = autoware_utils_geometry::get_point(path_point);
+  EXPECT_DOUBLE_EQ(point.x, 1.0);
+  EXPECT_DOUBLE_EQ(point.y, 2.0);
+  EXPECT_DOUBLE_EQ(point.z, 3.0);
+  EXPECT_EQ(&autoware_utils_geometry::get_point_view(path_point), &path_point.pose.position);
+}
+
+TEST(point_access, calcDistanceWithoutGeometry)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = 3.0;
+  pose.position.y = 4.0;
+  pose.position.z = 12.0;
+  const geometry_msgs::msg::Point origin;
+
+  EXPECT_DOUBLE_EQ(autoware_utils_geometry::calc_distance2d(origin, pose), 5.0);
+  EXPECT_DOUBLE_EQ(autoware_utils_geometry::calc_squared_distance2d(origin, pose), 25.0);
+  EXPECT_DOUBLE_EQ(autoware_utils_geometry::calc_distance3d(origin, pose), 13.0);
+}
+
+TEST(point_access, setVelocityWithoutGeometry)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(3);
+  autoware_utils_geometry::set_longitudinal_velocities(2.5f, points);
+  for (const auto & p : points) {
+    EXPECT_DOUBLE_EQ(autoware_utils_geometry::get_longitudinal_velocity(p), 2.5);
+  }
+}
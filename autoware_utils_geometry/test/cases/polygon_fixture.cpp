@@ -0,0 +1,108 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/polygon_fixture.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+
+TEST(polygon_fixture, randomStarPolygon)
+{
+  using autoware_utils_geometry::Polygon2d;
+  using autoware_utils_geometry::random_star_polygon;
+
+  std::mt19937_64 random_engine(42);
+  EXPECT_TRUE(random_star_polygon(3, 1.0, random_engine).outer().empty());
+  for (const auto vertices : {4UL, 5UL, 10UL, 100UL}) {
+    for (int i = 0; i < 100; ++i) {
+      const auto polygon = random_star_polygon(vertices, 2.0, random_engine);
+      ASSERT_EQ(polygon.outer().size(), vertices + 1);
+      EXPECT_TRUE(boost::geometry::is_valid(polygon));  // simple and clockwise
+      for (const auto & point : polygon.outer()) {
+        EXPECT_LE(std::abs(point.x()), 2.0);
+        EXPECT_LE(std::abs(point.y()), 2.0);
+      }
+      Polygon2d hull;
+      boost::geometry::convex_hull(polygon, hull);
+      EXPECT_LT(boost::geometry::area(polygon), boost::geometry::area(hull));  // not convex
+    }
+  }
+
+  std::mt19937_64 engine1(7);
+  std::mt19937_64 engine2(7);
+  EXPECT_TRUE(boost::geometry::equals(
+    random_star_polygon(20, 1.0, engine1), random_star_polygon(20, 1.0, engine2)));
+}
+
+TEST(polygon_fixture, saveAndMap)
+{
+  using autoware_utils_geometry::load_or_generate_polygon_fixture;
+  using autoware_utils_geometry::MappedPolygonArray;
+  using autoware_utils_geometry::PolygonArray2d;
+  using autoware_utils_geometry::PolygonFixtureParams;
+
+  const std::string path = testing::TempDir() + "polygon_fixture_test.bin";
+  std::remove(path.c_str());
+  EXPECT_FALSE(MappedPolygonArray::open(path));
+
+  PolygonFixtureParams params;
+  params.polygons = 50;
+  params.vertices = 12;
+  params.max = 3.0;
+  params.seed = 1234;
+  PolygonArray2d polygons;
+  generate_polygon_fixture(params, polygons);
+  ASSERT_EQ(polygons.size(), params.polygons);
+
+  {  // generated on the first call, then mapped back
+    for (int call = 0; call < 2; ++call) {
+      const auto mapped = load_or_generate_polygon_fixture(path, params);
+      ASSERT_TRUE(mapped);
+      ASSERT_EQ(mapped->size(), params.polygons);
+      EXPECT_EQ(mapped->params().seed, params.seed);
+      autoware_utils_geometry::PlainPolygon2d plain_polygon;
+      for (size_t i = 0; i < polygons.size(); ++i) {
+        ASSERT_EQ(mapped->ring_size(i), params.vertices + 1);
+        EXPECT_TRUE(boost::geometry::equals(mapped->polygon(i), polygons.polygon(i)));
+        mapped->polygon(i, plain_polygon);
+        ASSERT_EQ(plain_polygon.outer().size(), params.vertices + 1);
+        EXPECT_DOUBLE_EQ(
+          boost::geometry::area(plain_polygon), boost::geometry::area(polygons.polygon(i)));
+      }
+    }
+  }
+
+  {  // other parameters overwrite the file
+    params.seed = 5678;
+    const auto mapped = load_or_generate_polygon_fixture(path, params);
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ(mapped->params().seed, params.seed);
+    EXPECT_FALSE(boost::geometry::equals(mapped->polygon(0), polygons.polygon(0)));
+  }
+
+  {  // a truncated file is rejected
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "AWPOLY01";
+  }
+  EXPECT_FALSE(MappedPolygonArray::open(path));
+  std::remove(path.c_str());
+}
@@ -19,6 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 TEST(geometry, pose_deviation)
 {
   using autoware_utils_geometry::calc_pose_deviation;
@@ -42,3 +45,66 @@ TEST(geometry, pose_deviation)
   EXPECT_DOUBLE_EQ(deviation.longitudinal, 2.1213203435596428);
   EXPECT_DOUBLE_EQ(deviation.yaw, deg2rad(15));
 }
+
+TEST(geometry, pose_deviations)
+{
+  using autoware_utils_geometry::calc_point_deviations;
+  using autoware_utils_geometry::calc_pose_deviation;
+  using autoware_utils_geometry::calc_pose_deviations;
+  using autoware_utils_geometry::create_quaternion_from_rpy;
+  using autoware_utils_geometry::find_min_deviation_index;
+  using autoware_utils_math::deg2rad;
+
+  geometry_msgs::msg::Pose base_pose;
+  base_pose.position.x = 1.0;
+  base_pose.position.y = 2.0;
+  base_pose.orientation = create_quaternion_from_rpy(0, 0, deg2rad(45));
+
+  std::vector<geometry_msgs::msg::Pose> target_poses;
+  for (int i = 0; i < 20; ++i) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = 0.5 * i;
+    pose.position.y = 3.0 - 0.1 * i * i;
+    pose.orientation = create_quaternion_from_rpy(0, 0, deg2rad(20 * i));
+    target_poses.push_back(pose);
+  }
+
+  autoware_utils_geometry::PoseDeviationArray deviations;
+  calc_pose_deviations(base_pose, target_poses, deviations);
+  ASSERT_EQ(deviations.size(), target_poses.size());
+  ASSERT_EQ(deviations.yaw.size(), target_poses.size());
+  for (size_t i = 0; i < target_poses.size(); ++i) {
+    const auto expected = calc_pose_deviation(base_pose, target_poses.at(i));
+    EXPECT_NEAR(deviations.lateral.at(i), expected.lateral, 1e-12);
+    EXPECT_NEAR(deviations.longitudinal.at(i), expected.longitudinal, 1e-12);
+    EXPECT_DOUBLE_EQ(deviations.yaw.at(i), expected.yaw);
+  }
+
+  // the nearest target is the closest to the base position
+  size_t nearest_index = 0;
+  for (size_t i = 0; i < target_poses.size(); ++i) {
+    const auto & p = target_poses.at(i).position;
+    const auto & nearest = target_poses.at(nearest_index).position;
+    if (
+      std::hypot(p.x - base_pose.position.x, p.y - base_pose.position.y) <
+      std::hypot(nearest.x - base_pose.position.x, nearest.y - base_pose.position.y)) {
+      nearest_index = i;
+    }
+  }
+  EXPECT_EQ(find_min_deviation_index(deviations), nearest_index);
+  EXPECT_FALSE(find_min_deviation_index(deviations, 0.1));
+
+  // the yaw condition skips the nearest target
+  const auto index = find_min_deviation_index(deviations, 10.0, deg2rad(10));
+  ASSERT_TRUE(index);
+  EXPECT_LE(std::abs(deviations.yaw.at(*index)), deg2rad(10));
+  EXPECT_NE(*index, nearest_index);
+
+  calc_point_deviations(base_pose, target_poses, deviations);
+  ASSERT_EQ(deviations.size(), target_poses.size());
+  EXPECT_TRUE(deviations.yaw.empty());
+  EXPECT_EQ(find_min_deviation_index(deviations, 10.0, 0.0), nearest_index);
+
+  calc_pose_deviations(base_pose, std::vector<geometry_msgs::msg::Pose>{}, deviations);
+  EXPECT_FALSE(find_min_deviation_index(deviations));
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/prepared_convex_polygon.hpp"
+
+#include "autoware_utils_geometry/gjk_2d.hpp"
+#include "autoware_utils_geometry/random_convex_polygon.hpp"
+#include "autoware_utils_geometry/sat_2d.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+using autoware_utils_geometry::PreparedConvexPolygon2d;
+
+Polygon2d rectangle(const double x, const double y, const double yaw)
+{
+  Polygon2d polygon;
+  const double c = std::cos(yaw);
+  const double s = std::sin(yaw);
+  for (const auto & [lx, ly] : {std::pair{2.0, 1.0}, {2.0, -1.0}, {-2.0, -1.0}, {-2.0, 1.0}}) {
+    polygon.outer().emplace_back(x + c * lx - s * ly, y + s * lx + c * ly);
+  }
+  polygon.outer().push_back(polygon.outer().front());
+  return polygon;
+}
+}  // namespace
+
+TEST(prepared_convex_polygon, construction)
+{
+  const auto polygon = rectangle(0.0, 0.0, 0.0);
+  const PreparedConvexPolygon2d prepared(polygon);
+  EXPECT_EQ(prepared.axes().size(), 4UL);
+  ASSERT_EQ(prepared.projections().size(), prepared.axes().size());
+  EXPECT_DOUBLE_EQ(prepared.box().min_corner().x(), -2.0);
+  EXPECT_DOUBLE_EQ(prepared.box().min_corner().y(), -1.0);
+  EXPECT_DOUBLE_EQ(prepared.box().max_corner().x(), 2.0);
+  EXPECT_DOUBLE_EQ(prepared.box().max_corner().y(), 1.0);
+
+  const PreparedConvexPolygon2d with_axes(polygon, {Point2d(1.0, 0.0), Point2d(0.0, 1.0)});
+  ASSERT_EQ(with_axes.projections().size(), 2UL);
+  EXPECT_DOUBLE_EQ(with_axes.projections()[0].first, -2.0);
+  EXPECT_DOUBLE_EQ(with_axes.projections()[0].second, 2.0);
+  EXPECT_DOUBLE_EQ(with_axes.projections()[1].first, -1.0);
+  EXPECT_DOUBLE_EQ(with_axes.projections()[1].second, 1.0);
+
+  EXPECT_THROW(PreparedConvexPolygon2d(Polygon2d{}), std::invalid_argument);
+}
+
+TEST(prepared_convex_polygon, intersectsRand)
+{
+  namespace sat = autoware_utils_geometry::sat;
+  namespace gjk = autoware_utils_geometry::gjk;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> offset(-15.0, 15.0);
+  for (auto vertices = 3UL; vertices < 10UL; ++vertices) {
+    std::vector<Polygon2d> polygons;
+    for (auto i = 0; i < 50; ++i) {
+      auto polygon = autoware_utils_geometry::random_convex_polygon(vertices, 5.0);
+      const double dx = offset(gen);
+      const double dy = offset(gen);
+      for (auto & point : polygon.outer()) {
+        point = Point2d(point.x() + dx, point.y() + dy);
+      }
+      polygons.push_back(polygon);
+    }
+    std::vector<PreparedConvexPolygon2d> prepared(polygons.begin(), polygons.end());
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+      for (std::size_t j = 0; j < polygons.size(); ++j) {
+        const bool expected = sat::intersects(polygons[i], polygons[j]);
+        EXPECT_EQ(sat::intersects(prepared[i], polygons[j]), expected);
+        EXPECT_EQ(sat::intersects(prepared[i], prepared[j]), expected);
+        EXPECT_EQ(
+          gjk::intersects(prepared[i], polygons[j]), gjk::intersects(polygons[i], polygons[j]));
+      }
+    }
+  }
+}
+
+TEST(prepared_convex_polygon, intersectsWithAxes)
+{
+  namespace sat = autoware_utils_geometry::sat;
+
+  // the footprints share the 2 axes of the rectangle
+  constexpr double yaw = 0.4;
+  const std::vector<Point2d> axes{
+    Point2d(std::cos(yaw), std::sin(yaw)), Point2d(-std::sin(yaw), std::cos(yaw))};
+  const auto obstacle = rectangle(0.0, 0.0, 1.0);
+  for (double x = -6.0; x <= 6.0; x += 0.25) {
+    for (double y = -6.0; y <= 6.0; y += 0.25) {
+      const auto footprint = rectangle(x, y, yaw);
+      const PreparedConvexPolygon2d prepared(footprint, axes);
+      EXPECT_EQ(sat::intersects(prepared, obstacle), sat::intersects(footprint, obstacle));
+    }
+  }
+}
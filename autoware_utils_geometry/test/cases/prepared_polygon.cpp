@@ -0,0 +1,100 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/prepared_polygon.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+
+namespace
+{
+constexpr double epsilon = 1e-6;
+
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+using autoware_utils_geometry::PreparedPolygon2d;
+
+void expect_same_as_boost(const Polygon2d & polygon, const Point2d & point)
+{
+  const PreparedPolygon2d prepared(polygon);
+  const autoware_utils_geometry::alt::Point2d alt_point(point);
+  EXPECT_EQ(covered_by(alt_point, prepared), boost::geometry::covered_by(point, polygon));
+  EXPECT_EQ(within(alt_point, prepared), boost::geometry::within(point, polygon));
+  EXPECT_NEAR(distance(alt_point, prepared), boost::geometry::distance(point, polygon), epsilon);
+}
+}  // namespace
+
+TEST(prepared_polygon, hole)
+{
+  Polygon2d polygon;
+  polygon.outer().emplace_back(0.0, 0.0);
+  polygon.outer().emplace_back(4.0, 0.0);
+  polygon.outer().emplace_back(4.0, 4.0);
+  polygon.outer().emplace_back(2.0, 2.0);
+  polygon.outer().emplace_back(0.0, 4.0);
+  polygon.inners().emplace_back();
+  polygon.inners().back().emplace_back(0.5, 0.5);
+  polygon.inners().back().emplace_back(1.5, 0.5);
+  polygon.inners().back().emplace_back(1.5, 1.5);
+  polygon.inners().back().emplace_back(0.5, 1.5);
+  boost::geometry::correct(polygon);
+
+  const PreparedPolygon2d prepared(polygon);
+  EXPECT_EQ(prepared.edges().size(), 9UL);
+
+  expect_same_as_boost(polygon, Point2d(1.0, 1.0));   // in the hole
+  expect_same_as_boost(polygon, Point2d(3.0, 1.0));   // inside
+  expect_same_as_boost(polygon, Point2d(2.0, 3.0));   // in the notch
+  expect_same_as_boost(polygon, Point2d(-2.0, 7.0));  // outside
+  expect_same_as_boost(polygon, Point2d(4.0, 2.0));   // on the outer ring
+  expect_same_as_boost(polygon, Point2d(1.5, 1.0));   // on the inner ring
+  expect_same_as_boost(polygon, Point2d(2.0, 2.0));   // on a vertex
+
+  EXPECT_THROW(PreparedPolygon2d(Polygon2d{}), std::invalid_argument);
+}
+
+TEST(prepared_polygon, rand)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> coordinate(-20.0, 120.0);
+  for (auto vertices = 4UL; vertices < 30UL; ++vertices) {
+    for (auto i = 0; i < 10; ++i) {
+      const auto polygon = autoware_utils_geometry::random_concave_polygon(vertices, 100.0);
+      if (!polygon || polygon->outer().empty()) {
+        continue;
+      }
+      const PreparedPolygon2d prepared(*polygon);
+      for (auto j = 0; j < 100; ++j) {
+        const Point2d point(coordinate(gen), coordinate(gen));
+        const autoware_utils_geometry::alt::Point2d alt_point(point);
+        EXPECT_EQ(covered_by(alt_point, prepared), boost::geometry::covered_by(point, *polygon));
+        EXPECT_EQ(within(alt_point, prepared), boost::geometry::within(point, *polygon));
+        EXPECT_NEAR(
+          distance(alt_point, prepared), boost::geometry::distance(point, *polygon), epsilon);
+      }
+      // the vertices are on the boundary
+      for (const auto & point : polygon->outer()) {
+        const autoware_utils_geometry::alt::Point2d alt_point(point);
+        EXPECT_TRUE(covered_by(alt_point, prepared));
+        EXPECT_FALSE(within(alt_point, prepared));
+      }
+    }
+  }
+}
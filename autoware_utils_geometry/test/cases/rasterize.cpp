@@ -0,0 +1,182 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/rasterize.hpp"
+
+#include "autoware_utils_geometry/random_concave_polygon.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::GridLayout;
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+
+Polygon2d make_polygon(
+  const std::vector<Point2d> & outer, const std::vector<std::vector<Point2d>> & inners = {})
+{
+  Polygon2d polygon;
+  polygon.outer().assign(outer.begin(), outer.end());
+  for (const auto & inner : inners) {
+    polygon.inners().emplace_back(inner.begin(), inner.end());
+  }
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+
+Point2d cell_center(const GridLayout & layout, const std::size_t row, const std::size_t column)
+{
+  return {
+    layout.origin_x + (static_cast<double>(column) + 0.5) * layout.resolution,
+    layout.origin_y + (static_cast<double>(row) + 0.5) * layout.resolution};
+}
+}  // namespace
+
+TEST(Rasterize, Square)
+{
+  GridLayout layout;
+  layout.resolution = 0.5;
+  layout.origin_x = -2.0;
+  layout.origin_y = -2.0;
+  layout.width = 8;
+  layout.height = 8;
+  std::vector<std::uint8_t> cells(layout.size(), 0);
+  autoware_utils_geometry::RasterizeBuffer buffer;
+
+  // the centers of 2 x 2 cells are in [-0.6, 0.6] x [-0.6, 0.6]
+  const auto square = make_polygon({{-0.6, -0.6}, {-0.6, 0.6}, {0.6, 0.6}, {0.6, -0.6}});
+  autoware_utils_geometry::rasterize(square, layout, cells, 100, buffer);
+  EXPECT_EQ(std::count(cells.begin(), cells.end(), 100), 4);
+  EXPECT_EQ(cells[3 * 8 + 3], 100);
+  EXPECT_EQ(cells[4 * 8 + 4], 100);
+
+  // the cells outside the grid are ignored, and the alt polygon gives the same cells
+  std::vector<std::uint8_t> large(layout.size(), 0);
+  const auto cover = make_polygon({{-10.0, -10.0}, {-10.0, 10.0}, {10.0, 10.0}, {10.0, -10.0}});
+  autoware_utils_geometry::rasterize(
+    *autoware_utils_geometry::alt::Polygon2d::create(cover), layout, large, 1, buffer);
+  EXPECT_EQ(std::count(large.begin(), large.end(), 1), 64);
+
+  std::vector<std::uint8_t> wrong(3);
+  EXPECT_THROW(
+    autoware_utils_geometry::rasterize(square, layout, wrong, 1, buffer), std::invalid_argument);
+}
+
+TEST(Rasterize, Hole)
+{
+  GridLayout layout;
+  layout.width = 10;
+  layout.height = 10;
+  std::vector<std::uint8_t> cells(layout.size(), 0);
+
+  const auto polygon = make_polygon(
+    {{1.0, 1.0}, {1.0, 9.0}, {9.0, 9.0}, {9.0, 1.0}},
+    {{{3.0, 3.0}, {7.0, 3.0}, {7.0, 7.0}, {3.0, 7.0}}});
+  autoware_utils_geometry::rasterize(std::vector<Polygon2d>{polygon}, layout, cells, 1);
+  EXPECT_EQ(std::count(cells.begin(), cells.end(), 1), 64 - 16);
+  EXPECT_EQ(cells[5 * 10 + 5], 0);
+  EXPECT_EQ(cells[2 * 10 + 5], 1);
+}
+
+TEST(Rasterize, Random)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> offset(-3.0, 3.0);
+  GridLayout layout;
+  layout.resolution = 0.1;
+  layout.origin_x = -4.0;
+  layout.origin_y = -4.0;
+  layout.width = 80;
+  layout.height = 80;
+
+  autoware_utils_geometry::RasterizeBuffer buffer;
+  std::vector<std::uint8_t> cells;
+  for (int i = 0; i < 50; ++i) {
+    auto polygon = autoware_utils_geometry::random_concave_polygon(12, 3.0);
+    if (!polygon) {
+      continue;
+    }
+    const double dx = offset(generator);
+    const double dy = offset(generator);
+    for (auto & p : polygon->outer()) {
+      p = Point2d(p.x() + dx, p.y() + dy);
+    }
+
+    cells.assign(layout.size(), 0);
+    autoware_utils_geometry::rasterize(*polygon, layout, cells, 1, buffer);
+    for (std::size_t row = 0; row < layout.height; ++row) {
+      for (std::size_t column = 0; column < layout.width; ++column) {
+        const bool inside =
+          boost::geometry::within(cell_center(layout, row, column), *polygon);
+        EXPECT_EQ(cells[row * layout.width + column], inside ? 1 : 0) << row << ", " << column;
+      }
+    }
+  }
+}
+
+TEST(Rasterize, DistanceTransform)
+{
+  GridLayout layout;
+  layout.resolution = 0.5;
+  layout.width = 23;
+  layout.height = 17;
+  std::vector<float> distances;
+
+  // no occupied cell
+  std::vector<std::uint8_t> cells(layout.size(), 0);
+  autoware_utils_geometry::distance_transform(cells, layout, 50, distances);
+  ASSERT_EQ(distances.size(), layout.size());
+  EXPECT_TRUE(std::all_of(distances.begin(), distances.end(), [](const float d) {
+    return std::isinf(d);
+  }));
+
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<int> value(0, 99);
+  for (auto & cell : cells) {
+    cell = value(generator) < 3 ? 100 : 10;
+  }
+  autoware_utils_geometry::distance_transform(cells, layout, 50, distances);
+  for (std::size_t row = 0; row < layout.height; ++row) {
+    for (std::size_t column = 0; column < layout.width; ++column) {
+      double expected = std::numeric_limits<double>::infinity();
+      for (std::size_t r = 0; r < layout.height; ++r) {
+        for (std::size_t c = 0; c < layout.width; ++c) {
+          if (50 <= cells[r * layout.width + c]) {
+            const double dr = static_cast<double>(r) - static_cast<double>(row);
+            const double dc = static_cast<double>(c) - static_cast<double>(column);
+            expected = std::min(expected, std::hypot(dr, dc) * layout.resolution);
+          }
+        }
+      }
+      EXPECT_NEAR(distances[row * layout.width + column], expected, 1e-5);
+    }
+  }
+
+  EXPECT_THROW(
+    autoware_utils_geometry::distance_transform(
+      std::vector<std::uint8_t>(3), layout, 50, distances),
+    std::invalid_argument);
+}
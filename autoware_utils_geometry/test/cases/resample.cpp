@@ -0,0 +1,133 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/resample.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr double epsilon = 1e-9;
+
+std::vector<autoware_planning_msgs::msg::TrajectoryPoint> make_trajectory()
+{
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(10);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double t = 0.3 * static_cast<double>(i);
+    points.at(i).pose.position.x = 4.0 * std::sin(t);
+    points.at(i).pose.position.y = 4.0 * (1.0 - std::cos(t));
+    points.at(i).pose.position.z = 0.1 * static_cast<double>(i);
+    points.at(i).pose.orientation = create_quaternion_from_yaw(t);
+  }
+  return points;
+}
+
+void expect_near(const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b)
+{
+  EXPECT_NEAR(a.position.x, b.position.x, epsilon);
+  EXPECT_NEAR(a.position.y, b.position.y, epsilon);
+  EXPECT_NEAR(a.position.z, b.position.z, epsilon);
+  EXPECT_NEAR(a.orientation.x, b.orientation.x, epsilon);
+  EXPECT_NEAR(a.orientation.y, b.orientation.y, epsilon);
+  EXPECT_NEAR(a.orientation.z, b.orientation.z, epsilon);
+  EXPECT_NEAR(a.orientation.w, b.orientation.w, epsilon);
+}
+}  // namespace
+
+TEST(resample, resample_poses)
+{
+  using autoware_utils_geometry::calc_distance2d;
+  using autoware_utils_geometry::calc_interpolated_pose;
+  using autoware_utils_geometry::resample_poses;
+
+  const auto points = make_trajectory();
+  std::vector<double> segment_starts{0.0};
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    const double length = calc_distance2d(points.at(i), points.at(i + 1));
+    segment_starts.push_back(segment_starts.back() + length);
+  }
+
+  std::vector<double> arc_lengths;
+  for (double s = 0.05; s < segment_starts.back(); s += 0.37) {
+    arc_lengths.push_back(s);
+  }
+
+  for (const bool from_direction : {true, false}) {
+    std::vector<geometry_msgs::msg::Pose> output;
+    resample_poses(points, arc_lengths, output, from_direction);
+    ASSERT_EQ(output.size(), arc_lengths.size());
+
+    size_t index = 0;
+    for (size_t i = 0; i < arc_lengths.size(); ++i) {
+      while (segment_starts.at(index + 1) < arc_lengths.at(i)) {
+        ++index;
+      }
+      const double ratio = (arc_lengths.at(i) - segment_starts.at(index)) /
+                           (segment_starts.at(index + 1) - segment_starts.at(index));
+      const auto expected =
+        calc_interpolated_pose(points.at(index), points.at(index + 1), ratio, from_direction);
+      expect_near(output.at(i), expected);
+    }
+  }
+
+  // Out of range arc lengths are clamped.
+  const auto clamped = resample_poses(points, {-1.0, 100.0});
+  ASSERT_EQ(clamped.size(), 2u);
+  expect_near(clamped.at(0), calc_interpolated_pose(points.at(0), points.at(1), 0.0));
+  expect_near(clamped.at(1), points.back().pose);
+
+  // Degenerate inputs
+  EXPECT_TRUE(
+    resample_poses(std::vector<geometry_msgs::msg::Pose>{}, std::vector<double>{1.0}).empty());
+  const std::vector<geometry_msgs::msg::Pose> single_pose{points.at(3).pose};
+  const auto single = resample_poses(single_pose, {0.0, 1.0});
+  ASSERT_EQ(single.size(), 2u);
+  expect_near(single.at(1), points.at(3).pose);
+}
+
+TEST(resample, resample_poses_backward)
+{
+  using autoware_utils_geometry::calc_interpolated_pose;
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+  using autoware_utils_geometry::resample_poses;
+
+  // Driving backward to the north east, so the yaw from the position direction is around -3/4 pi.
+  std::vector<geometry_msgs::msg::Pose> poses(3);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    poses.at(i).position.x = static_cast<double>(i);
+    poses.at(i).position.y = 1.2 * static_cast<double>(i);
+    poses.at(i).position.z = 0.1 * static_cast<double>(i);
+    poses.at(i).orientation = create_quaternion_from_yaw(-2.3);
+  }
+  const double length = std::hypot(1.0, 1.2);
+  const std::vector<double> arc_lengths{0.3, 0.5 * length, 1.2 * length, 1.9 * length};
+
+  std::vector<geometry_msgs::msg::Pose> output;
+  resample_poses(poses, arc_lengths, output);
+  ASSERT_EQ(output.size(), arc_lengths.size());
+  for (size_t i = 0; i < arc_lengths.size(); ++i) {
+    const size_t index = arc_lengths.at(i) < length ? 0 : 1;
+    const double ratio = arc_lengths.at(i) / length - static_cast<double>(index);
+    expect_near(output.at(i), calc_interpolated_pose(poses.at(index), poses.at(index + 1), ratio));
+  }
+}
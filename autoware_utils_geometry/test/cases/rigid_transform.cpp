@@ -0,0 +1,148 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/rigid_transform.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+#include "autoware_utils_math/unit_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace
+{
+constexpr double epsilon = 1e-9;
+
+geometry_msgs::msg::Pose make_pose()
+{
+  using autoware_utils_geometry::create_quaternion_from_rpy;
+  using autoware_utils_math::deg2rad;
+
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = 3.0;
+  pose.position.y = -1.0;
+  pose.position.z = 0.2;
+  pose.orientation = create_quaternion_from_rpy(deg2rad(3), deg2rad(7), deg2rad(-120));
+  return pose;
+}
+
+void expect_near(const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b)
+{
+  EXPECT_NEAR(a.position.x, b.position.x, epsilon);
+  EXPECT_NEAR(a.position.y, b.position.y, epsilon);
+  EXPECT_NEAR(a.position.z, b.position.z, epsilon);
+  const double dot = a.orientation.x * b.orientation.x + a.orientation.y * b.orientation.y +
+                     a.orientation.z * b.orientation.z + a.orientation.w * b.orientation.w;
+  EXPECT_NEAR(std::abs(dot), 1.0, epsilon);
+}
+}  // namespace
+
+TEST(rigid_transform, transform_3d)
+{
+  using autoware_utils_geometry::create_point;
+  using autoware_utils_geometry::inverse_transform_point;
+  using autoware_utils_geometry::inverse_transform_pose;
+  using autoware_utils_geometry::pose2transform;
+  using autoware_utils_geometry::RigidTransform3d;
+  using autoware_utils_geometry::transform_point;
+  using autoware_utils_geometry::transform_pose;
+
+  const auto pose_transform = make_pose();
+  const auto transform_msg = pose2transform(pose_transform);
+  const RigidTransform3d transform(transform_msg);
+
+  geometry_msgs::msg::TransformStamped transform_stamped;
+  transform_stamped.transform = transform_msg;
+  const RigidTransform3d from_stamped(transform_stamped);
+  const RigidTransform3d from_pose(pose_transform);
+  EXPECT_TRUE(transform.rotation().isApprox(from_stamped.rotation()));
+  EXPECT_TRUE(transform.rotation().isApprox(from_pose.rotation()));
+  EXPECT_TRUE(transform.translation().isApprox(from_pose.translation()));
+
+  const auto point = create_point(1.0, 2.0, 3.0);
+  {
+    const auto expected = transform_point(point, pose_transform);
+    const auto actual = transform_point(point, transform);
+    EXPECT_NEAR(actual.x, expected.x, epsilon);
+    EXPECT_NEAR(actual.y, expected.y, epsilon);
+    EXPECT_NEAR(actual.z, expected.z, epsilon);
+  }
+  {
+    const auto expected = inverse_transform_point(point, pose_transform);
+    const auto actual = inverse_transform_point(point, transform);
+    EXPECT_NEAR(actual.x, expected.x, epsilon);
+    EXPECT_NEAR(actual.y, expected.y, epsilon);
+    EXPECT_NEAR(actual.z, expected.z, epsilon);
+  }
+
+  geometry_msgs::msg::Pose pose;
+  pose.position = point;
+  pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(0.3);
+  expect_near(transform_pose(pose, transform), transform_pose(pose, transform_msg));
+  expect_near(inverse_transform_pose(pose, transform), inverse_transform_pose(pose, transform_msg));
+
+  // inverse and composition
+  expect_near(transform_pose(pose, transform.inverse()), inverse_transform_pose(pose, transform));
+  expect_near(transform_pose(pose, transform * transform.inverse()), pose);
+  expect_near(
+    transform_pose(pose, transform * from_pose),
+    transform_pose(transform_pose(pose, from_pose), transform));
+}
+
+TEST(rigid_transform, transform_2d)
+{
+  using autoware_utils_geometry::create_quaternion_from_yaw;
+  using autoware_utils_geometry::LinearRing2d;
+  using autoware_utils_geometry::Point2d;
+  using autoware_utils_geometry::RigidTransform2d;
+  using autoware_utils_geometry::transform_point;
+  using autoware_utils_geometry::transform_vector;
+
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = 1.0;
+  pose.position.y = 2.0;
+  pose.position.z = 5.0;
+  pose.orientation = create_quaternion_from_yaw(M_PI / 2.0);
+
+  const RigidTransform2d transform(pose);
+  EXPECT_NEAR(transform.yaw(), M_PI / 2.0, epsilon);
+
+  const auto transformed = transform_point(Point2d{1.0, 0.0}, transform);
+  EXPECT_NEAR(transformed.x(), 1.0, epsilon);
+  EXPECT_NEAR(transformed.y(), 3.0, epsilon);
+
+  const auto restored = transform.inverse().apply(transformed);
+  EXPECT_NEAR(restored.x(), 1.0, epsilon);
+  EXPECT_NEAR(restored.y(), 0.0, epsilon);
+
+  const auto back = transform.apply_inverse(transformed);
+  EXPECT_NEAR(back.x(), 1.0, epsilon);
+  EXPECT_NEAR(back.y(), 0.0, epsilon);
+
+  const auto composed = transform * RigidTransform2d(M_PI / 2.0, 1.0, 0.0);
+  EXPECT_NEAR(std::abs(composed.yaw()), M_PI, epsilon);
+  EXPECT_NEAR(composed.x(), 1.0, epsilon);
+  EXPECT_NEAR(composed.y(), 3.0, epsilon);
+
+  // Same result as the message based overload
+  LinearRing2d ring{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 0.0}};
+  const auto expected = transform_vector(ring, autoware_utils_geometry::pose2transform(pose));
+  const auto actual = transform_vector(ring, transform);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(actual.at(i).x(), expected.at(i).x(), epsilon);
+    EXPECT_NEAR(actual.at(i).y(), expected.at(i).y(), epsilon);
+  }
+}
@@ -0,0 +1,156 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/segment_index.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::PathSegmentIndex;
+
+std::vector<autoware_planning_msgs::msg::TrajectoryPoint> make_path(const size_t size)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> points(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double t = 0.05 * static_cast<double>(i);
+    points.at(i).pose.position.x = 10.0 * std::cos(t) + t;
+    points.at(i).pose.position.y = 10.0 * std::sin(2.0 * t);
+  }
+  return points;
+}
+
+// Brute force reference using the same definition of the distance to a segment.
+std::vector<double> distances_to_segments(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
+  const geometry_msgs::msg::Point & p)
+{
+  std::vector<double> distances;
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    const auto a = autoware_utils_geometry::get_point(points.at(i));
+    const auto b = autoware_utils_geometry::get_point(points.at(i + 1));
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double t =
+      std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+    distances.push_back(std::hypot(a.x + t * dx - p.x, a.y + t * dy - p.y));
+  }
+  return distances;
+}
+}  // namespace
+
+TEST(segment_index, nearest_segment)
+{
+  using autoware_utils_geometry::create_point;
+
+  {
+    PathSegmentIndex index;
+    EXPECT_FALSE(index.nearest_segment(create_point(0.0, 0.0, 0.0)));
+    index.push_back(1.0, 1.0);
+    EXPECT_FALSE(index.nearest_segment(create_point(0.0, 0.0, 0.0)));
+    EXPECT_TRUE(index.nearest_segments(create_point(0.0, 0.0, 0.0), 3).empty());
+  }
+
+  {
+    const std::vector<geometry_msgs::msg::Point> points{
+      create_point(0.0, 0.0, 0.0), create_point(2.0, 0.0, 0.0), create_point(2.0, 2.0, 0.0)};
+    const PathSegmentIndex index(points);
+    const auto result = index.nearest_segment(create_point(1.5, -1.0, 0.0));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->segment_index, 0u);
+    EXPECT_DOUBLE_EQ(result->ratio, 0.75);
+    EXPECT_DOUBLE_EQ(result->distance, 1.0);
+  }
+
+  const auto points = make_path(1000);
+  const PathSegmentIndex index(points);
+  EXPECT_EQ(index.size(), points.size());
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-15.0, 15.0);
+  for (int i = 0; i < 200; ++i) {
+    const auto p = create_point(dist(engine), dist(engine), 0.0);
+    const auto distances = distances_to_segments(points, p);
+    const auto result = index.nearest_segment(p);
+    ASSERT_TRUE(result);
+    EXPECT_NEAR(result->distance, *std::min_element(distances.begin(), distances.end()), 1e-9);
+    EXPECT_NEAR(result->distance, distances.at(result->segment_index), 1e-9);
+  }
+}
+
+TEST(segment_index, nearest_segments)
+{
+  using autoware_utils_geometry::create_point;
+
+  const auto points = make_path(500);
+  const PathSegmentIndex index(points);
+
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> dist(-15.0, 15.0);
+  for (int i = 0; i < 50; ++i) {
+    const auto p = create_point(dist(engine), dist(engine), 0.0);
+    auto distances = distances_to_segments(points, p);
+    std::sort(distances.begin(), distances.end());
+
+    const auto results = index.nearest_segments(p, 5);
+    ASSERT_EQ(results.size(), 5u);
+    for (size_t j = 0; j < results.size(); ++j) {
+      EXPECT_NEAR(results.at(j).distance, distances.at(j), 1e-9);
+    }
+
+    // bounded just above and below the distance of the nearest
+    const auto bounded = index.nearest_segment(p.x, p.y, distances.at(0) + 1e-9);
+    ASSERT_TRUE(bounded);
+    EXPECT_NEAR(bounded->distance, distances.at(0), 1e-9);
+    EXPECT_FALSE(index.nearest_segment(p.x, p.y, distances.at(0) * (1.0 - 1e-9)));
+  }
+
+  // k larger than the number of segments
+  const std::vector<geometry_msgs::msg::Point> small{
+    create_point(0.0, 0.0, 0.0), create_point(1.0, 0.0, 0.0), create_point(2.0, 0.0, 0.0)};
+  EXPECT_EQ(PathSegmentIndex(small).nearest_segments(create_point(0.0, 1.0, 0.0), 10).size(), 2u);
+}
+
+TEST(segment_index, extend)
+{
+  using autoware_utils_geometry::create_point;
+
+  const auto points = make_path(700);
+  PathSegmentIndex index;
+  for (size_t size = 1; size <= points.size(); size += 37) {
+    const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> prefix(
+      points.begin(), points.begin() + size);
+    index.extend(prefix);
+    ASSERT_EQ(index.size(), size);
+
+    const auto p = create_point(3.0, -2.0, 0.0);
+    const auto result = index.nearest_segment(p);
+    if (size < 2) {
+      EXPECT_FALSE(result);
+      continue;
+    }
+    ASSERT_TRUE(result);
+    const auto distances = distances_to_segments(prefix, p);
+    EXPECT_NEAR(result->distance, *std::min_element(distances.begin(), distances.end()), 1e-9);
+  }
+}
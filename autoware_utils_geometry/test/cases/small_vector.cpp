@@ -0,0 +1,118 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/small_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::SmallVector;
+using Vector = SmallVector<int, 4>;
+
+std::vector<int> to_std(const Vector & v)
+{
+  return {v.begin(), v.end()};
+}
+}  // namespace
+
+TEST(small_vector, inline_and_heap)
+{
+  Vector v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4u);
+
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_TRUE(v.is_inline());
+
+  // Push an element of the container itself while it moves to the heap.
+  v.push_back(v.front());
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(to_std(v), (std::vector<int>{0, 1, 2, 3, 0}));
+
+  v.emplace_back(5);
+  EXPECT_EQ(v.back(), 5);
+  v.pop_back();
+  EXPECT_EQ(v.size(), 5u);
+}
+
+TEST(small_vector, copy_and_move)
+{
+  for (const auto & init : {std::vector<int>{1, 2, 3}, std::vector<int>{1, 2, 3, 4, 5, 6}}) {
+    const Vector original(init.begin(), init.end());
+
+    Vector copied(original);
+    EXPECT_EQ(to_std(copied), init);
+    EXPECT_NE(copied.data(), original.data());
+
+    Vector moved(std::move(copied));
+    EXPECT_EQ(to_std(moved), init);
+    EXPECT_TRUE(copied.empty());
+
+    Vector assigned{9};
+    assigned = original;
+    EXPECT_EQ(to_std(assigned), init);
+
+    Vector move_assigned{9, 9, 9, 9, 9};
+    move_assigned = std::move(assigned);
+    EXPECT_EQ(to_std(move_assigned), init);
+    EXPECT_TRUE(assigned.empty());
+    EXPECT_TRUE(assigned.is_inline());
+
+    Vector swapped{7};
+    swapped.swap(move_assigned);
+    EXPECT_EQ(to_std(swapped), init);
+    EXPECT_EQ(to_std(move_assigned), std::vector<int>{7});
+  }
+}
+
+TEST(small_vector, modifiers)
+{
+  Vector v{1, 2, 3};
+
+  v.insert(v.begin() + 1, 4);
+  EXPECT_EQ(to_std(v), (std::vector<int>{1, 4, 2, 3}));
+
+  const std::vector<int> values{5, 6};
+  v.insert(v.end(), values.begin(), values.end());
+  EXPECT_EQ(to_std(v), (std::vector<int>{1, 4, 2, 3, 5, 6}));
+
+  v.erase(v.begin());
+  EXPECT_EQ(to_std(v), (std::vector<int>{4, 2, 3, 5, 6}));
+
+  v.erase(v.begin() + 1, v.begin() + 3);
+  EXPECT_EQ(to_std(v), (std::vector<int>{4, 5, 6}));
+
+  std::reverse(v.begin(), v.end());
+  EXPECT_EQ(to_std(v), (std::vector<int>{6, 5, 4}));
+  EXPECT_EQ(std::vector<int>(v.rbegin(), v.rend()), (std::vector<int>{4, 5, 6}));
+
+  v.resize(5, 1);
+  EXPECT_EQ(to_std(v), (std::vector<int>{6, 5, 4, 1, 1}));
+  v.resize(2);
+  EXPECT_EQ(to_std(v), (std::vector<int>{6, 5}));
+
+  EXPECT_EQ(v, (Vector{6, 5}));
+  EXPECT_NE(v, (Vector{6}));
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
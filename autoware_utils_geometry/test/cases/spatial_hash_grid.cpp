@@ -0,0 +1,124 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/spatial_hash_grid.hpp"
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_utils_geometry::SpatialHashGrid;
+using autoware_utils_geometry::alt::Point2d;
+using autoware_utils_geometry::alt::Points2d;
+
+std::vector<std::size_t> sorted(std::vector<std::size_t> ids)
+{
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+}  // namespace
+
+TEST(SpatialHashGrid, Points)
+{
+  std::mt19937 random(0);
+  std::uniform_real_distribution<double> position(-100.0, 100.0);
+  Points2d points;
+  for (int i = 0; i < 5000; ++i) {
+    points.emplace_back(position(random), position(random));
+  }
+  SpatialHashGrid grid(2.0);
+  grid.build(points);
+  EXPECT_EQ(grid.size(), points.size());
+
+  std::vector<std::size_t> ids;
+  for (int k = 0; k < 50; ++k) {
+    const Point2d center(position(random), position(random));
+    const double radius = 0.1 * k;
+    std::vector<std::size_t> expected_box;
+    std::vector<std::size_t> expected_radius;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      const auto d = points[i] - center;
+      if (std::abs(d.x()) <= radius && std::abs(d.y()) <= radius) {
+        expected_box.push_back(i);
+      }
+      if (d.norm() <= radius) {
+        expected_radius.push_back(i);
+      }
+    }
+    grid.query_box(center - Point2d(radius, radius), center + Point2d(radius, radius), ids);
+    EXPECT_EQ(sorted(ids), expected_box);
+    grid.query_radius(center, radius, ids);
+    EXPECT_EQ(sorted(ids), expected_radius);
+  }
+
+  // a query larger than the grid
+  grid.query_box({-200.0, -200.0}, {200.0, 200.0}, ids);
+  EXPECT_EQ(ids.size(), points.size());
+}
+
+TEST(SpatialHashGrid, Polygons)
+{
+  using autoware_utils_geometry::alt::StaticConvexPolygon2d;
+  // boxes spanning several cells are returned once
+  const auto large = StaticConvexPolygon2d<4>::create_box({0.0, 0.0}, 0.3, 10.0, 4.0);
+  const auto small = StaticConvexPolygon2d<4>::create_box({20.0, 0.0}, 0.0, 1.0, 1.0);
+  SpatialHashGrid grid(1.0);
+  grid.insert(7, large);
+  grid.insert(8, small);
+
+  std::vector<std::size_t> ids;
+  grid.query_box({-3.0, -3.0}, {21.0, 3.0}, ids);
+  EXPECT_EQ(sorted(ids), (std::vector<std::size_t>{7, 8}));
+  grid.query_radius({19.0, 0.0}, 0.6, ids);
+  EXPECT_EQ(ids, std::vector<std::size_t>{8});
+  grid.query_radius({19.0, 0.0}, 0.4, ids);
+  EXPECT_TRUE(ids.empty());
+
+  grid.clear();
+  EXPECT_TRUE(grid.empty());
+  grid.query_box({-3.0, -3.0}, {21.0, 3.0}, ids);
+  EXPECT_TRUE(ids.empty());
+
+  EXPECT_THROW(SpatialHashGrid(0.0), std::invalid_argument);
+}
+
+TEST(SpatialHashGrid, CoveredBy)
+{
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> position(-20.0, 20.0);
+  Points2d points;
+  for (int i = 0; i < 1000; ++i) {
+    points.emplace_back(position(random), position(random));
+  }
+  SpatialHashGrid grid(1.0);
+  grid.build(points);
+
+  const auto area = autoware_utils_geometry::alt::ConvexPolygon2d::create(
+                      autoware_utils_geometry::alt::PointList2d{
+                        {-5.0, -5.0}, {-5.0, 5.0}, {8.0, 3.0}, {6.0, -6.0}})
+                      .value();
+  std::vector<std::size_t> expected;
+  autoware_utils_geometry::covered_by(points, area, expected);
+  std::vector<std::size_t> indices;
+  autoware_utils_geometry::covered_by(grid, points, area, indices);
+  EXPECT_FALSE(indices.empty());
+  EXPECT_EQ(indices, expected);
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_geometry/time_series_buffer.hpp"
+
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <gtest/gtest.h>
+#include <tf2/utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+geometry_msgs::msg::Pose create_pose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+  return pose;
+}
+}  // namespace
+
+TEST(time_series_buffer, push_back)
+{
+  using autoware_utils_geometry::TimeSeriesBuffer;
+  EXPECT_THROW(TimeSeriesBuffer<double>(1), std::invalid_argument);
+
+  TimeSeriesBuffer<double> buffer(3);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_FALSE(buffer.interpolate(0).has_value());
+
+  EXPECT_TRUE(buffer.push_back(10, 1.0));
+  EXPECT_FALSE(buffer.push_back(10, 2.0));
+  EXPECT_FALSE(buffer.push_back(5, 2.0));
+  EXPECT_EQ(buffer.size(), 1u);
+  EXPECT_DOUBLE_EQ(*buffer.interpolate(10), 1.0);
+
+  // the oldest values are dropped beyond the capacity, also when the storage is compacted
+  for (std::int64_t stamp = 20; stamp <= 100; stamp += 10) {
+    EXPECT_TRUE(buffer.push_back(stamp, stamp / 10.0));
+    EXPECT_EQ(buffer.size(), std::min<std::size_t>(stamp / 10, 3));
+    EXPECT_EQ(buffer.back_stamp(), stamp);
+    EXPECT_EQ(buffer.front_stamp(), std::max<std::int64_t>(10, stamp - 20));
+    EXPECT_DOUBLE_EQ(*buffer.interpolate(stamp - 5), stamp / 10.0 - 0.5);
+  }
+  EXPECT_FALSE(buffer.interpolate(79).has_value());
+  EXPECT_FALSE(buffer.interpolate(101).has_value());
+  EXPECT_DOUBLE_EQ(*buffer.interpolate(80), 8.0);
+  EXPECT_DOUBLE_EQ(*buffer.interpolate(100), 10.0);
+
+  buffer.erase_before(95);
+  EXPECT_EQ(buffer.size(), 2u);
+  EXPECT_DOUBLE_EQ(*buffer.interpolate(95), 9.5);
+  buffer.erase_before(200);
+  EXPECT_EQ(buffer.size(), 1u);
+  EXPECT_DOUBLE_EQ(buffer.front(), 10.0);
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_TRUE(buffer.push_back(0, 0.0));
+}
+
+TEST(time_series_buffer, interpolate_pose)
+{
+  autoware_utils_geometry::TimeSeriesBuffer<geometry_msgs::msg::Pose> buffer(10);
+  builtin_interfaces::msg::Time stamp;
+  stamp.sec = 100;
+  stamp.nanosec = 900000000;
+  EXPECT_TRUE(buffer.push_back(stamp, create_pose(0.0, 0.0, 0.0)));
+  stamp.sec = 101;
+  stamp.nanosec = 100000000;
+  EXPECT_TRUE(buffer.push_back(stamp, create_pose(2.0, 4.0, 0.4)));
+
+  stamp.sec = 101;
+  stamp.nanosec = 0;
+  const auto pose = buffer.interpolate(stamp);
+  ASSERT_TRUE(pose.has_value());
+  EXPECT_NEAR(pose->position.x, 1.0, 1e-9);
+  EXPECT_NEAR(pose->position.y, 2.0, 1e-9);
+  EXPECT_NEAR(tf2::getYaw(pose->orientation), 0.2, 1e-9);
+  EXPECT_EQ(buffer.front_stamp(), 100900000000);
+}
+
+TEST(time_series_buffer, interpolate_twists)
+{
+  // the twists of a vehicle accelerating and turning, sampled at 50 Hz with jitter
+  autoware_utils_geometry::TimeSeriesBuffer<geometry_msgs::msg::Twist> buffer(64);
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<std::int64_t> jitter(-2000000, 2000000);
+  for (int i = 0; i < 200; ++i) {
+    const std::int64_t stamp = std::int64_t{20000000} * i + jitter(generator);
+    geometry_msgs::msg::Twist twist;
+    twist.linear.x = 1e-9 * stamp;
+    twist.angular.z = -2e-9 * stamp;
+    EXPECT_TRUE(buffer.push_back(stamp, twist));
+  }
+  EXPECT_EQ(buffer.size(), 64u);
+
+  // the stamps of the points of a scan, sorted, and random ones, with some outside of the buffer
+  std::vector<std::int64_t> sorted_stamps;
+  for (std::int64_t stamp = buffer.front_stamp() - 5000000; stamp < buffer.back_stamp() + 5000000;
+       stamp += 100000) {
+    sorted_stamps.push_back(stamp);
+  }
+  std::vector<std::int64_t> random_stamps = sorted_stamps;
+  std::shuffle(random_stamps.begin(), random_stamps.end(), generator);
+
+  for (const auto & stamps : {sorted_stamps, random_stamps}) {
+    std::vector<geometry_msgs::msg::Twist> twists;
+    const auto num_outside = buffer.interpolate(stamps, twists);
+    ASSERT_EQ(twists.size(), stamps.size());
+    std::size_t expected_outside = 0;
+    for (std::size_t i = 0; i < stamps.size(); ++i) {
+      const auto twist = buffer.interpolate(stamps[i]);
+      if (!twist) {
+        ++expected_outside;
+        const auto & end = stamps[i] < buffer.front_stamp() ? buffer.front() : buffer.back();
+        EXPECT_DOUBLE_EQ(twists[i].linear.x, end.linear.x);
+        continue;
+      }
+      EXPECT_NEAR(twists[i].linear.x, 1e-9 * stamps[i], 1e-9);
+      EXPECT_NEAR(twists[i].angular.z, -2e-9 * stamps[i], 1e-9);
+      EXPECT_DOUBLE_EQ(twists[i].linear.x, twist->linear.x);
+    }
+    EXPECT_EQ(num_outside, expected_outside);
+    EXPECT_LT(0u, num_outside);
+  }
+
+  autoware_utils_geometry::TimeSeriesBuffer<geometry_msgs::msg::Twist> empty(2);
+  std::vector<geometry_msgs::msg::Twist> twists(3);
+  EXPECT_EQ(empty.interpolate(sorted_stamps, twists), sorted_stamps.size());
+  EXPECT_TRUE(twists.empty());
+}
@@ -0,0 +1,171 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_geometry/trajectory_compactor.hpp"
+
+#include "autoware_utils_geometry/alt_geometry.hpp"
+#include "autoware_utils_geometry/geometry.hpp"
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware_planning_msgs::msg::TrajectoryPoint;
+using autoware_utils_geometry::TrajectoryCompactor;
+
+// a straight line, then a turn of radius 20 m while braking to a stop, then a start
+std::vector<TrajectoryPoint> make_trajectory()
+{
+  std::vector<TrajectoryPoint> points(300);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double s = 0.5 * static_cast<double>(i);
+    auto & pose = points[i].pose;
+    if (s < 50.0) {
+      pose.position.x = s;
+      pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(0.0);
+    } else {
+      const double angle = (s - 50.0) / 20.0;
+      pose.position.x = 50.0 + 20.0 * std::sin(angle);
+      pose.position.y = 20.0 * (1.0 - std::cos(angle));
+      pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(angle);
+    }
+    pose.position.z = 0.01 * s;
+    const double velocity = s < 60.0 ? 10.0 : std::max(0.0, 10.0 - 0.2 * (s - 60.0));
+    points[i].longitudinal_velocity_mps = static_cast<float>(i < 250 ? velocity : 2.0);
+  }
+  return points;
+}
+
+autoware_utils_geometry::alt::Point2d to_point(const TrajectoryPoint & point)
+{
+  return {point.pose.position.x, point.pose.position.y};
+}
+
+double arc_length(const std::vector<TrajectoryPoint> & points, const size_t index)
+{
+  double length = 0.0;
+  for (size_t i = 1; i <= index; ++i) {
+    length += (to_point(points[i]) - to_point(points[i - 1])).norm();
+  }
+  return length;
+}
+}  // namespace
+
+TEST(trajectory_compactor, straightLine)
+{
+  std::vector<geometry_msgs::msg::Pose> poses(100);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    poses[i].position.x = static_cast<double>(i);
+    poses[i].position.y = 2.0 * static_cast<double>(i);
+  }
+  TrajectoryCompactor compactor;
+  EXPECT_EQ(compactor.compact_indices(poses), (std::vector<size_t>{0, 99}));
+
+  EXPECT_TRUE(compactor.compact_indices(std::vector<geometry_msgs::msg::Pose>{}).empty());
+  EXPECT_EQ(
+    compactor.compact_indices(std::vector<geometry_msgs::msg::Pose>(1)), (std::vector<size_t>{0}));
+}
+
+TEST(trajectory_compactor, boundedErrors)
+{
+  const auto points = make_trajectory();
+  TrajectoryCompactor::Parameters parameters;
+  parameters.max_lateral_error = 0.05;
+  parameters.max_velocity_error = 0.1;
+  TrajectoryCompactor compactor(parameters);
+  const auto kept = compactor.compact_indices(points);
+  ASSERT_LT(kept.size(), points.size() / 3);
+  EXPECT_EQ(kept.front(), 0u);
+  EXPECT_EQ(kept.back(), points.size() - 1);
+
+  // the point where the vehicle stops, the last stopped point and the start are kept
+  EXPECT_TRUE(std::binary_search(kept.begin(), kept.end(), 220u));
+  EXPECT_TRUE(std::binary_search(kept.begin(), kept.end(), 249u));
+
+  for (size_t k = 0; k + 1 < kept.size(); ++k) {
+    const size_t start = kept[k];
+    const size_t end = kept[k + 1];
+    const double start_s = arc_length(points, start);
+    const double length = arc_length(points, end) - start_s;
+    const double start_v = points[start].longitudinal_velocity_mps;
+    const double end_v = points[end].longitudinal_velocity_mps;
+    for (size_t i = start + 1; i < end; ++i) {
+      const double lateral = autoware_utils_geometry::distance(
+        to_point(points[i]), to_point(points[start]), to_point(points[end]));
+      EXPECT_LE(lateral, parameters.max_lateral_error);
+      const double interpolated =
+        start_v + (end_v - start_v) * (arc_length(points, i) - start_s) / length;
+      EXPECT_LE(std::abs(points[i].longitudinal_velocity_mps - interpolated), 0.1 + 1e-6);
+    }
+  }
+
+  std::vector<TrajectoryPoint> compacted;
+  compactor.compact(points, compacted);
+  ASSERT_EQ(compacted.size(), kept.size());
+  EXPECT_EQ(compacted.back().pose.position.x, points.back().pose.position.x);
+}
+
+TEST(trajectory_compactor, encodeDecode)
+{
+  const auto points = make_trajectory();
+  TrajectoryCompactor compactor;
+  const auto kept = compactor.compact_indices(points);
+  const auto bytes = compactor.encode(points);
+  EXPECT_LT(bytes.size(), 32 + 12 * kept.size());
+
+  std::vector<TrajectoryPoint> decoded;
+  compactor.decode(bytes, decoded);
+  ASSERT_EQ(decoded.size(), kept.size());
+  for (size_t k = 0; k < kept.size(); ++k) {
+    const auto & expected = points[kept[k]];
+    EXPECT_NEAR(decoded[k].pose.position.x, expected.pose.position.x, 0.5e-3 + 1e-9);
+    EXPECT_NEAR(decoded[k].pose.position.y, expected.pose.position.y, 0.5e-3 + 1e-9);
+    EXPECT_NEAR(decoded[k].pose.position.z, expected.pose.position.z, 0.5e-3 + 1e-9);
+    EXPECT_NEAR(
+      autoware_utils_geometry::get_yaw(decoded[k].pose.orientation),
+      autoware_utils_geometry::get_yaw(expected.pose.orientation), 0.5e-4 + 1e-9);
+    EXPECT_NEAR(
+      decoded[k].longitudinal_velocity_mps, expected.longitudinal_velocity_mps, 0.5e-3 + 1e-6);
+  }
+
+  // the poses without a velocity decode the positions and the yaws of a trajectory
+  std::vector<geometry_msgs::msg::Pose> poses;
+  compactor.decode(bytes, poses);
+  ASSERT_EQ(poses.size(), kept.size());
+  EXPECT_NEAR(poses.back().position.x, decoded.back().pose.position.x, 1e-9);
+
+  auto truncated = bytes;
+  truncated.resize(bytes.size() - 3);
+  EXPECT_THROW(compactor.decode(truncated, decoded), std::invalid_argument);
+  EXPECT_THROW(compactor.decode(std::vector<uint8_t>{7}, decoded), std::invalid_argument);
+}
+
+TEST(trajectory_compactor, invalidParameters)
+{
+  TrajectoryCompactor::Parameters parameters;
+  parameters.max_lateral_error = -1.0;
+  EXPECT_THROW(TrajectoryCompactor{parameters}, std::invalid_argument);
+  parameters = TrajectoryCompactor::Parameters{};
+  parameters.yaw_resolution = 0.0;
+  EXPECT_THROW(TrajectoryCompactor{parameters}, std::invalid_argument);
+}
@@ -0,0 +1,260 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_LOGGING__ASYNC_LOGGER_HPP_
+#define AUTOWARE_UTILS_LOGGING__ASYNC_LOGGER_HPP_
+
+#include <rclcpp/logger.hpp>
+#include <rcutils/logging.h>
+#include <rcutils/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace autoware_utils_logging
+{
+
+/**
+ * @brief Argument of a log record, of which the strings are copied to the text of the record
+ */
+struct AsyncLogArg
+{
+  enum class Type : uint8_t {
+    boolean,
+    character,
+    signed_integer,
+    unsigned_integer,
+    floating,
+    string,
+  };
+
+  struct Span
+  {
+    uint16_t offset;
+    uint16_t size;
+  };
+
+  Type type;
+  union {
+    bool boolean;
+    char character;
+    int64_t signed_integer;
+    uint64_t unsigned_integer;
+    double floating;
+    Span string;
+  } value;
+};
+
+/**
+ * @brief Binary log record, formatted by the background thread of AsyncLogger
+ */
+struct AsyncLogRecord
+{
+  static constexpr size_t max_args = 8;         //!< Maximum number of arguments
+  static constexpr size_t text_capacity = 256;  //!< Bytes of the logger name and the strings
+
+  int severity;
+  const char * format;  //!< Format string of fmt, a string literal
+  rcutils_log_location_t location;
+  rcutils_time_point_value_t stamp;
+  uint16_t name_size;  //!< Size of the logger name, at the start of the text
+  uint8_t arg_count;
+  AsyncLogArg args[max_args];
+  uint16_t text_size;
+  char text[text_capacity];
+
+  /**
+   * @brief Copy a string to the text, truncated to the remaining capacity
+   */
+  AsyncLogArg::Span append(std::string_view str)
+  {
+    const auto size = std::min(str.size(), text_capacity - text_size);
+    std::memcpy(text + text_size, str.data(), size);
+    const AsyncLogArg::Span span{text_size, static_cast<uint16_t>(size)};
+    text_size = static_cast<uint16_t>(text_size + size);
+    return span;
+  }
+};
+
+/**
+ * @brief Asynchronous sink of log messages for hot paths
+ *
+ * A call only checks the level of the logger, which LoggerLevelConfigure still sets, and copies
+ * the arguments to a binary record in a lock-free ring of the calling thread, dropping the record
+ * if the ring is full. A background thread formats the records with fmt and passes them to the
+ * output handler of rcutils with the time of the call. Use the AUTOWARE_UTILS_LOGGING_ASYNC_*
+ * macros, e.g.
+ *
+ * @code
+ * AUTOWARE_UTILS_LOGGING_ASYNC_WARN(async_logger_, get_logger(), "{} points dropped", count);
+ * @endcode
+ */
+class AsyncLogger
+{
+public:
+  /**
+   * @brief Construct a new AsyncLogger object and start its background thread
+   *
+   * @param capacity Number of records of the ring of each thread
+   * @param period Period at which the background thread drains the rings
+   * @throw std::invalid_argument if the capacity is 0
+   */
+  explicit AsyncLogger(
+    size_t capacity = 1024, std::chrono::milliseconds period = std::chrono::milliseconds(10));
+
+  /**
+   * @brief Destroy the AsyncLogger object, writing the remaining records
+   */
+  ~AsyncLogger();
+
+  AsyncLogger(const AsyncLogger &) = delete;
+  AsyncLogger & operator=(const AsyncLogger &) = delete;
+
+  /**
+   * @brief Log a message unless the logger is disabled for the severity
+   *
+   * @param severity Severity of rcutils, e.g. RCUTILS_LOG_SEVERITY_WARN
+   * @param logger Logger whose level applies
+   * @param location Location of the call
+   * @param format Format string of fmt, a string literal
+   * @param args Arguments, of arithmetic or string types
+   * @return bool true if the record is queued
+   */
+  template <size_t N, typename... Args>
+  bool log(
+    int severity, const rclcpp::Logger & logger, const rcutils_log_location_t & location,
+    const char (&format)[N], const Args &... args);
+
+  /**
+   * @brief Write the queued records on the calling thread
+   */
+  void flush();
+
+  /**
+   * @brief Get the number of records dropped because a ring was full
+   */
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  class Ring;
+  struct ThreadRings;
+
+  static thread_local ThreadRings thread_rings_;  //!< Rings of the calling thread
+
+  AsyncLogRecord * begin_record(Ring *& ring);
+  static void commit_record(Ring * ring);
+  void drain();
+  void run(std::chrono::milliseconds period);
+
+  static void encode(AsyncLogRecord & record, AsyncLogArg & arg, bool value);
+  static void encode(AsyncLogRecord & record, AsyncLogArg & arg, char value);
+  static void encode(AsyncLogRecord & record, AsyncLogArg & arg, std::string_view value);
+  template <typename T>
+  static void encode(AsyncLogRecord & record, AsyncLogArg & arg, const T & value);
+
+  const uint64_t id_;       //!< Identifier of the logger in the thread local rings
+  const size_t capacity_;   //!< Number of records per ring
+  std::atomic<uint64_t> dropped_{0};
+  std::mutex rings_mutex_;  //!< Mutex of the list of the rings
+  std::vector<std::shared_ptr<Ring>> rings_;  //!< Rings of the threads, only owned by the logger
+  std::mutex drain_mutex_;  //!< Mutex making the drains the single consumer of the rings
+  std::mutex stop_mutex_;
+  std::condition_variable stop_cv_;
+  bool stop_{false};
+  std::thread thread_;
+};
+
+template <size_t N, typename... Args>
+bool AsyncLogger::log(
+  const int severity, const rclcpp::Logger & logger, const rcutils_log_location_t & location,
+  const char (&format)[N], const Args &... args)
+{
+  static_assert(sizeof...(Args) <= AsyncLogRecord::max_args, "Too many arguments to log.");
+  const char * name = logger.get_name();
+  if (name == nullptr || !rcutils_logging_logger_is_enabled_for(name, severity)) {
+    return false;
+  }
+  Ring * ring = nullptr;
+  AsyncLogRecord * record = begin_record(ring);
+  if (record == nullptr) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  record->severity = severity;
+  record->format = format;
+  record->location = location;
+  if (rcutils_system_time_now(&record->stamp) != RCUTILS_RET_OK) {
+    record->stamp = 0;
+  }
+  record->text_size = 0;
+  record->name_size = record->append(name).size;
+  record->arg_count = 0;
+  (encode(*record, record->args[record->arg_count++], args), ...);
+  commit_record(ring);
+  return true;
+}
+
+template <typename T>
+void AsyncLogger::encode(AsyncLogRecord & record, AsyncLogArg & arg, const T & value)
+{
+  if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+    encode(record, arg, std::string_view(value));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    arg.type = AsyncLogArg::Type::floating;
+    arg.value.floating = static_cast<double>(value);
+  } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+    arg.type = AsyncLogArg::Type::signed_integer;
+    arg.value.signed_integer = static_cast<int64_t>(value);
+  } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+    arg.type = AsyncLogArg::Type::unsigned_integer;
+    arg.value.unsigned_integer = static_cast<uint64_t>(value);
+  } else {
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic and string types can be logged.");
+  }
+}
+
+}  // namespace autoware_utils_logging
+
+/**
+ * @brief Log a message of a severity through an AsyncLogger, with the location of the call
+ */
+#define AUTOWARE_UTILS_LOGGING_ASYNC_LOG(async_logger, severity, logger, ...)               \
+  do {                                                                                      \
+    static const rcutils_log_location_t autoware_utils_logging_location = {                 \
+      __func__, __FILE__, static_cast<size_t>(__LINE__)};                                   \
+    (async_logger).log((severity), (logger), autoware_utils_logging_location, __VA_ARGS__); \
+  } while (0)
+
+#define AUTOWARE_UTILS_LOGGING_ASYNC_DEBUG(async_logger, logger, ...) \
+  AUTOWARE_UTILS_LOGGING_ASYNC_LOG(async_logger, RCUTILS_LOG_SEVERITY_DEBUG, logger, __VA_ARGS__)
+#define AUTOWARE_UTILS_LOGGING_ASYNC_INFO(async_logger, logger, ...) \
+  AUTOWARE_UTILS_LOGGING_ASYNC_LOG(async_logger, RCUTILS_LOG_SEVERITY_INFO, logger, __VA_ARGS__)
+#define AUTOWARE_UTILS_LOGGING_ASYNC_WARN(async_logger, logger, ...) \
+  AUTOWARE_UTILS_LOGGING_ASYNC_LOG(async_logger, RCUTILS_LOG_SEVERITY_WARN, logger, __VA_ARGS__)
+#define AUTOWARE_UTILS_LOGGING_ASYNC_ERROR(async_logger, logger, ...) \
+  AUTOWARE_UTILS_LOGGING_ASYNC_LOG(async_logger, RCUTILS_LOG_SEVERITY_ERROR, logger, __VA_ARGS__)
+
+#endif  // AUTOWARE_UTILS_LOGGING__ASYNC_LOGGER_HPP_
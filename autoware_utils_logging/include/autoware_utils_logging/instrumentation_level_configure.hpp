@@ -0,0 +1,106 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_LOGGING__INSTRUMENTATION_LEVEL_CONFIGURE_HPP_
+#define AUTOWARE_UTILS_LOGGING__INSTRUMENTATION_LEVEL_CONFIGURE_HPP_
+
+#include <logging_demo/srv/config_logger.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_logging
+{
+
+/**
+ * @brief A sibling of LoggerLevelConfigure switching the instrumentation of a node at runtime
+ *
+ * The `~/config_instrumentation` service takes the ConfigLogger request of `~/config_logger`, the
+ * logger name being the name of an instrumentation and the level one of its levels, e.g.
+ *
+ * @code
+ * ros2 service call /node/config_instrumentation logging_demo/srv/ConfigLogger \
+ *   "{logger_name: time_keeper, level: aggregate}"
+ * @endcode
+ *
+ * The levels are applied by handlers, which should only flip flags read on the hot path, such as
+ * TimeKeeper::set_enabled(), TimeKeeper::request_aggregation() or DebugPublisher::set_enabled(),
+ * or a switch owned by this object.
+ */
+class InstrumentationLevelConfigure
+{
+private:
+  using ConfigLogger = logging_demo::srv::ConfigLogger;
+
+public:
+  using Handler = std::function<void(const std::string & level)>;
+
+  explicit InstrumentationLevelConfigure(rclcpp::Node * node);
+
+  /**
+   * @brief Add an instrumentation, of which the handler is called with each requested level
+   *
+   * @param name Name of the instrumentation
+   * @param levels Levels accepted by the service
+   * @param handler Function applying a level, which may throw to reject it
+   * @throw std::invalid_argument if the name is already added or there is no level
+   */
+  void add(const std::string & name, const std::vector<std::string> & levels, Handler handler);
+
+  /**
+   * @brief Add an instrumentation with the levels "off" and "on", kept in an atomic flag
+   *
+   * @param name Name of the instrumentation
+   * @param enabled Initial value of the flag
+   * @return const std::atomic<bool>& Flag to be read on the hot path, valid as long as this object
+   * @throw std::invalid_argument if the name is already added
+   */
+  const std::atomic<bool> & add_switch(const std::string & name, bool enabled = false);
+
+  /**
+   * @brief Apply a level, as the service does
+   *
+   * @param name Name of the instrumentation
+   * @param level Level of the instrumentation
+   * @return bool true if the instrumentation and the level exist and the handler did not throw
+   */
+  bool set_level(const std::string & name, const std::string & level);
+
+private:
+  struct Instrumentation
+  {
+    std::vector<std::string> levels;
+    Handler handler;
+  };
+
+  rclcpp::Logger ros_logger_;
+  rclcpp::Service<ConfigLogger>::SharedPtr srv_config_instrumentation_;
+  std::mutex mutex_;
+  std::map<std::string, Instrumentation> instrumentations_;
+  std::deque<std::atomic<bool>> switches_;  //!< Flags of add_switch(), which are never moved
+
+  void on_instrumentation_config_service(
+    const ConfigLogger::Request::SharedPtr request,
+    const ConfigLogger::Response::SharedPtr response);
+};
+
+}  // namespace autoware_utils_logging
+
+#endif  // AUTOWARE_UTILS_LOGGING__INSTRUMENTATION_LEVEL_CONFIGURE_HPP_
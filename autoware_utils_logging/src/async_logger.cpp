@@ -0,0 +1,273 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_logging/async_logger.hpp"
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdarg>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_logging
+{
+
+/**
+ * @brief Lock-free ring of the records of one thread, drained by the background thread
+ */
+class AsyncLogger::Ring
+{
+public:
+  explicit Ring(const size_t capacity) : slots_(capacity + 1) {}
+
+  AsyncLogRecord * claim()
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if ((tail + 1) % slots_.size() == head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &slots_[tail];
+  }
+
+  void commit()
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    tail_.store((tail + 1) % slots_.size(), std::memory_order_release);
+  }
+
+  const AsyncLogRecord * front() const
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    return head == tail_.load(std::memory_order_acquire) ? nullptr : &slots_[head];
+  }
+
+  void pop()
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    head_.store((head + 1) % slots_.size(), std::memory_order_release);
+  }
+
+  /// @brief mark the ring to be released once drained, after the last commit of its thread
+  void release() { released_.store(true, std::memory_order_release); }
+  bool released() const { return released_.load(std::memory_order_acquire); }
+
+private:
+  std::vector<AsyncLogRecord> slots_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<bool> released_{false};
+};
+
+namespace
+{
+std::atomic<uint64_t> next_logger_id{0};
+
+void output_impl(
+  const rcutils_log_location_t * location, int severity, const char * name,
+  rcutils_time_point_value_t stamp, const char * format, ...)
+{
+  const auto handler = rcutils_logging_get_output_handler();
+  if (handler == nullptr) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  handler(location, severity, name, stamp, format, &args);
+  va_end(args);
+}
+
+std::string format_impl(const AsyncLogRecord & record)
+{
+  fmt::dynamic_format_arg_store<fmt::format_context> store;
+  for (size_t i = 0; i < record.arg_count; ++i) {
+    const auto & arg = record.args[i];
+    switch (arg.type) {
+      case AsyncLogArg::Type::boolean:
+        store.push_back(arg.value.boolean);
+        break;
+      case AsyncLogArg::Type::character:
+        store.push_back(arg.value.character);
+        break;
+      case AsyncLogArg::Type::signed_integer:
+        store.push_back(arg.value.signed_integer);
+        break;
+      case AsyncLogArg::Type::unsigned_integer:
+        store.push_back(arg.value.unsigned_integer);
+        break;
+      case AsyncLogArg::Type::floating:
+        store.push_back(arg.value.floating);
+        break;
+      case AsyncLogArg::Type::string:
+        store.push_back(
+          std::string_view(record.text + arg.value.string.offset, arg.value.string.size));
+        break;
+    }
+  }
+  try {
+    return fmt::vformat(record.format, store);
+  } catch (const fmt::format_error & e) {
+    return fmt::format("{} (invalid format: {})", record.format, e.what());
+  }
+}
+}  // namespace
+
+/**
+ * @brief Rings of the loggers a thread logged to, which the loggers own
+ *
+ * The ring of a destroyed logger is freed with it, and only the expired entry of the thread
+ * remains until the thread logs to a new logger. The rings of the loggers alive when the thread
+ * exits are released to their loggers, which free them once drained.
+ */
+struct AsyncLogger::ThreadRings
+{
+  struct Entry
+  {
+    uint64_t logger_id;
+    Ring * ring;                 //!< Ring used while the logger is alive
+    std::weak_ptr<Ring> owned;  //!< Ring of the logger, expired once the logger is destroyed
+  };
+
+  ~ThreadRings()
+  {
+    for (const auto & entry : entries) {
+      if (const auto ring = entry.owned.lock()) {
+        ring->release();
+      }
+    }
+  }
+
+  std::vector<Entry> entries;
+};
+
+thread_local AsyncLogger::ThreadRings AsyncLogger::thread_rings_;
+
+AsyncLogger::AsyncLogger(const size_t capacity, const std::chrono::milliseconds period)
+: id_(next_logger_id.fetch_add(1)), capacity_(capacity)
+{
+  if (capacity == 0) {
+    throw std::invalid_argument("The capacity of the rings must be positive.");
+  }
+  thread_ = std::thread([this, period] { run(period); });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+  {
+    std::lock_guard<std::mutex> lock(stop_mutex_);
+    stop_ = true;
+  }
+  stop_cv_.notify_one();
+  thread_.join();
+  drain();
+}
+
+AsyncLogRecord * AsyncLogger::begin_record(Ring *& ring)
+{
+  auto & entries = thread_rings_.entries;
+  for (const auto & entry : entries) {
+    if (entry.logger_id == id_) {
+      ring = entry.ring;
+      return ring->claim();
+    }
+  }
+  // the entries of the destroyed loggers are removed before adding the one of this logger
+  entries.erase(
+    std::remove_if(
+      entries.begin(), entries.end(), [](const auto & entry) { return entry.owned.expired(); }),
+    entries.end());
+  auto new_ring = std::make_shared<Ring>(capacity_);
+  {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.push_back(new_ring);
+  }
+  ring = new_ring.get();
+  entries.push_back({id_, ring, new_ring});
+  return ring->claim();
+}
+
+void AsyncLogger::commit_record(Ring * ring)
+{
+  ring->commit();
+}
+
+void AsyncLogger::flush()
+{
+  drain();
+}
+
+void AsyncLogger::drain()
+{
+  std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+  std::vector<std::shared_ptr<Ring>> rings;
+  {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings = rings_;
+  }
+
+  std::string name;
+  for (const auto & ring : rings) {
+    while (const auto * record = ring->front()) {
+      name.assign(record->text, record->name_size);
+      const auto message = format_impl(*record);
+      output_impl(
+        &record->location, record->severity, name.c_str(), record->stamp, "%s", message.c_str());
+      ring->pop();
+    }
+  }
+
+  // the rings of the threads which exited are freed once drained
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  rings_.erase(
+    std::remove_if(
+      rings_.begin(), rings_.end(),
+      [](const auto & ring) { return ring->released() && ring->front() == nullptr; }),
+    rings_.end());
+}
+
+void AsyncLogger::run(const std::chrono::milliseconds period)
+{
+  std::unique_lock<std::mutex> lock(stop_mutex_);
+  while (!stop_) {
+    stop_cv_.wait_for(lock, period, [this] { return stop_; });
+    lock.unlock();
+    drain();
+    lock.lock();
+  }
+}
+
+void AsyncLogger::encode(AsyncLogRecord &, AsyncLogArg & arg, const bool value)
+{
+  arg.type = AsyncLogArg::Type::boolean;
+  arg.value.boolean = value;
+}
+
+void AsyncLogger::encode(AsyncLogRecord &, AsyncLogArg & arg, const char value)
+{
+  arg.type = AsyncLogArg::Type::character;
+  arg.value.character = value;
+}
+
+void AsyncLogger::encode(AsyncLogRecord & record, AsyncLogArg & arg, const std::string_view value)
+{
+  arg.type = AsyncLogArg::Type::string;
+  arg.value.string = record.append(value);
+}
+
+}  // namespace autoware_utils_logging
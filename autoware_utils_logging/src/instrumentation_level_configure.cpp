@@ -0,0 +1,98 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_logging/instrumentation_level_configure.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_logging
+{
+
+InstrumentationLevelConfigure::InstrumentationLevelConfigure(rclcpp::Node * node)
+: ros_logger_(node->get_logger())
+{
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+
+  srv_config_instrumentation_ = node->create_service<ConfigLogger>(
+    "~/config_instrumentation",
+    std::bind(&InstrumentationLevelConfigure::on_instrumentation_config_service, this, _1, _2));
+}
+
+void InstrumentationLevelConfigure::add(
+  const std::string & name, const std::vector<std::string> & levels, Handler handler)
+{
+  if (levels.empty()) {
+    throw std::invalid_argument("The instrumentation " + name + " has no level.");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!instrumentations_.emplace(name, Instrumentation{levels, std::move(handler)}).second) {
+    throw std::invalid_argument("The instrumentation " + name + " is already added.");
+  }
+}
+
+const std::atomic<bool> & InstrumentationLevelConfigure::add_switch(
+  const std::string & name, const bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (instrumentations_.count(name) != 0) {
+    throw std::invalid_argument("The instrumentation " + name + " is already added.");
+  }
+  auto & flag = switches_.emplace_back(enabled);
+  Handler handler = [&flag](const std::string & level) {
+    flag.store(level == "on", std::memory_order_relaxed);
+  };
+  instrumentations_.emplace(name, Instrumentation{{"off", "on"}, std::move(handler)});
+  return flag;
+}
+
+bool InstrumentationLevelConfigure::set_level(const std::string & name, const std::string & level)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = instrumentations_.find(name);
+  if (it == instrumentations_.end()) {
+    RCLCPP_WARN_STREAM(ros_logger_, "Unknown instrumentation " << name);
+    return false;
+  }
+  const auto & levels = it->second.levels;
+  if (std::find(levels.begin(), levels.end(), level) == levels.end()) {
+    RCLCPP_WARN_STREAM(
+      ros_logger_, "Failed to change instrumentation level for "
+                     << name << " due to an invalid level: " << level);
+    return false;
+  }
+
+  try {
+    it->second.handler(level);
+  } catch (const std::exception & e) {
+    RCLCPP_WARN_STREAM(
+      ros_logger_, "Failed to set instrumentation level for " << name << ": " << e.what());
+    return false;
+  }
+  RCLCPP_INFO_STREAM(ros_logger_, "Instrumentation level [" << level << "] is set for " << name);
+  return true;
+}
+
+void InstrumentationLevelConfigure::on_instrumentation_config_service(
+  const ConfigLogger::Request::SharedPtr request, const ConfigLogger::Response::SharedPtr response)
+{
+  response->success = set_level(request->logger_name, request->level);
+}
+
+}  // namespace autoware_utils_logging
@@ -0,0 +1,116 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_logging/async_logger.hpp"
+
+#include <gtest/gtest.h>
+#include <malloc.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::mutex output_mutex;
+std::vector<std::string> outputs;
+
+void capture_output(
+  const rcutils_log_location_t *, int severity, const char * name, rcutils_time_point_value_t,
+  const char * format, va_list * args)
+{
+  char message[512];
+  std::vsnprintf(message, sizeof(message), format, *args);
+  std::lock_guard<std::mutex> lock(output_mutex);
+  outputs.push_back(std::to_string(severity) + " " + name + " " + message);
+}
+
+class TestAsyncLogger : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    handler_ = rcutils_logging_get_output_handler();
+    rcutils_logging_set_output_handler(capture_output);
+    outputs.clear();
+  }
+  void TearDown() override { rcutils_logging_set_output_handler(handler_); }
+
+  rcutils_logging_output_handler_t handler_;
+};
+}  // namespace
+
+TEST_F(TestAsyncLogger, Format)
+{
+  const auto logger = rclcpp::get_logger("async_logger_format");
+  // drained only by flush(), so that the records of the threads are written in a known order
+  autoware_utils_logging::AsyncLogger async_logger(16, std::chrono::hours(1));
+  const std::string name = "lidar";
+  AUTOWARE_UTILS_LOGGING_ASYNC_INFO(
+    async_logger, logger, "{} dropped {} points in {:.1f}ms: {}", name, 3u, 1.5, true);
+  std::thread([&] {
+    AUTOWARE_UTILS_LOGGING_ASYNC_ERROR(async_logger, logger, "worker {}", -1);
+  }).join();
+  AUTOWARE_UTILS_LOGGING_ASYNC_WARN(async_logger, logger, "invalid {}");
+  async_logger.flush();
+
+  ASSERT_EQ(outputs.size(), 3u);
+  EXPECT_EQ(outputs[0], "20 async_logger_format lidar dropped 3 points in 1.5ms: true");
+  EXPECT_EQ(outputs[1].rfind("30 async_logger_format invalid {} (invalid format", 0), 0u);
+  EXPECT_EQ(outputs[2], "40 async_logger_format worker -1");
+}
+
+TEST_F(TestAsyncLogger, LevelAndDrops)
+{
+  const auto logger = rclcpp::get_logger("async_logger_level");
+  rcutils_logging_set_logger_level(logger.get_name(), RCUTILS_LOG_SEVERITY_WARN);
+  autoware_utils_logging::AsyncLogger async_logger(2, std::chrono::hours(1));
+  const rcutils_log_location_t location{"test", __FILE__, 0};
+  EXPECT_FALSE(async_logger.log(RCUTILS_LOG_SEVERITY_INFO, logger, location, "below the level"));
+
+  EXPECT_TRUE(async_logger.log(RCUTILS_LOG_SEVERITY_WARN, logger, location, "{}", 1));
+  EXPECT_TRUE(async_logger.log(RCUTILS_LOG_SEVERITY_WARN, logger, location, "{}", 2));
+  EXPECT_FALSE(async_logger.log(RCUTILS_LOG_SEVERITY_WARN, logger, location, "{}", 3));
+  EXPECT_EQ(async_logger.dropped(), 1u);
+
+  // the strings are truncated to the capacity of the record
+  async_logger.flush();
+  const std::string long_text(1000, 'x');
+  EXPECT_TRUE(async_logger.log(RCUTILS_LOG_SEVERITY_WARN, logger, location, "{}", long_text));
+  async_logger.flush();
+  ASSERT_EQ(outputs.size(), 3u);
+  EXPECT_EQ(outputs[1], "30 async_logger_level 2");
+  EXPECT_LT(outputs[2].size(), 300u);
+}
+
+TEST_F(TestAsyncLogger, DestroyedLoggers)
+{
+  const auto logger = rclcpp::get_logger("async_logger_destroyed");
+  const auto allocated = [] {
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+  };
+  // the rings of the destroyed loggers are freed although this thread logged to them
+  const auto before = allocated();
+  for (int i = 0; i < 20; ++i) {
+    autoware_utils_logging::AsyncLogger async_logger(4096, std::chrono::hours(1));
+    AUTOWARE_UTILS_LOGGING_ASYNC_WARN(async_logger, logger, "logger {}", i);
+  }
+  EXPECT_LT(allocated() - before, 4096 * sizeof(autoware_utils_logging::AsyncLogRecord));
+  EXPECT_EQ(outputs.size(), 20u);
+}
@@ -0,0 +1,50 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_logging/instrumentation_level_configure.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+TEST(TestInstrumentationLevelConfigure, SetLevel)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_node");
+  autoware_utils_logging::InstrumentationLevelConfigure configure(node.get());
+
+  const auto & debug = configure.add_switch("debug_publisher", true);
+  EXPECT_TRUE(debug.load());
+  EXPECT_TRUE(configure.set_level("debug_publisher", "off"));
+  EXPECT_FALSE(debug.load());
+  EXPECT_FALSE(configure.set_level("debug_publisher", "aggregate"));
+  EXPECT_FALSE(debug.load());
+
+  std::string time_keeper_level;
+  configure.add(
+    "time_keeper", {"off", "on", "aggregate"},
+    [&time_keeper_level](const std::string & level) { time_keeper_level = level; });
+  EXPECT_TRUE(configure.set_level("time_keeper", "aggregate"));
+  EXPECT_EQ(time_keeper_level, "aggregate");
+
+  // the handler can reject a level
+  configure.add("profiler", {"on"}, [](const std::string &) {
+    throw std::runtime_error("Another profiler is running.");
+  });
+  EXPECT_FALSE(configure.set_level("profiler", "on"));
+  EXPECT_FALSE(configure.set_level("unknown", "on"));
+  EXPECT_THROW(configure.add_switch("time_keeper"), std::invalid_argument);
+  EXPECT_THROW(configure.add("empty", {}, [](const std::string &) {}), std::invalid_argument);
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Count the allocations of the measured code by replacing the global operator new. The operators
+// are not inlined, otherwise GCC warns about malloc and free being mixed with new and delete.
+// AUTOWARE_UTILS_DEBUG_COUNT_ALLOCATIONS() is not used as autoware_utils_debug depends on this
+// package.
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+}  // namespace
+
+__attribute__((noinline)) void * operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace benchmark_support
+{
+std::size_t allocation_count()
+{
+  return allocations.load(std::memory_order_relaxed);
+}
+}  // namespace benchmark_support
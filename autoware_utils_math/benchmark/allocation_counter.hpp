@@ -0,0 +1,43 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ALLOCATION_COUNTER_HPP_
+#define ALLOCATION_COUNTER_HPP_
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace benchmark_support
+{
+/// @brief number of calls to the global operator new since the start of the program
+std::size_t allocation_count();
+
+/**
+ * @brief Report the heap allocations per call of the measured code.
+ * @param allocations_before allocation_count() before the benchmark loop
+ * @param calls_per_iteration calls of the measured function in one iteration of the loop
+ */
+inline void report_allocations(
+  benchmark::State & state, const std::size_t allocations_before,
+  const std::size_t calls_per_iteration)
+{
+  const auto calls = static_cast<double>(state.iterations() * calls_per_iteration);
+  state.SetItemsProcessed(static_cast<int64_t>(calls));
+  state.counters["allocs/call"] =
+    static_cast<double>(allocation_count() - allocations_before) / calls;
+}
+}  // namespace benchmark_support
+
+#endif  // ALLOCATION_COUNTER_HPP_
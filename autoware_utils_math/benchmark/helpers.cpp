@@ -0,0 +1,230 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "allocation_counter.hpp"
+#include "autoware_utils_math/constants.hpp"
+#include "autoware_utils_math/normalization.hpp"
+#include "autoware_utils_math/range.hpp"
+#include "autoware_utils_math/unit_conversion.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Scalar helpers of normalization.hpp, range.hpp and unit_conversion.hpp next to their batch or
+// lazy variants, at the sizes of the per-point loops of a planning cycle.
+namespace
+{
+using benchmark_support::allocation_count;
+using benchmark_support::report_allocations;
+
+/// @brief yaws of a trajectory which are mostly in one or two turns, as accumulated headings
+std::vector<double> make_angles(const std::size_t size)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> angle(-4.0 * autoware_utils_math::pi,
+                                               4.0 * autoware_utils_math::pi);
+  std::vector<double> angles(size);
+  std::generate(angles.begin(), angles.end(), [&] { return angle(gen); });
+  return angles;
+}
+
+/// @brief args: number of angles
+void normalize_radian_scalar(benchmark::State & state)
+{
+  const auto angles = make_angles(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> normalized(angles.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      normalized[i] = autoware_utils_math::normalize_radian(angles[i]);
+    }
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, angles.size());
+}
+
+/// @brief args: number of angles
+void normalize_radian_fast(benchmark::State & state)
+{
+  const auto angles = make_angles(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> normalized(angles.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      normalized[i] = autoware_utils_math::normalize_radian_fast(angles[i]);
+    }
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, angles.size());
+}
+
+/// @brief args: number of angles
+void normalize_radian_batch(benchmark::State & state)
+{
+  const auto angles = make_angles(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> normalized(angles.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    autoware_utils_math::normalize_radian(angles.data(), angles.size(), normalized.data());
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, angles.size());
+}
+
+/// @brief args: number of angles
+void normalize_degree_scalar(benchmark::State & state)
+{
+  auto angles = make_angles(static_cast<std::size_t>(state.range(0)));
+  for (auto & angle : angles) angle = autoware_utils_math::rad2deg(angle);
+  std::vector<double> normalized(angles.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      normalized[i] = autoware_utils_math::normalize_degree(angles[i]);
+    }
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, angles.size());
+}
+
+/// @brief args: number of angles
+void normalize_degree_batch(benchmark::State & state)
+{
+  auto angles = make_angles(static_cast<std::size_t>(state.range(0)));
+  for (auto & angle : angles) angle = autoware_utils_math::rad2deg(angle);
+  std::vector<double> normalized(angles.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    autoware_utils_math::normalize_degree(angles.data(), angles.size(), normalized.data());
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, angles.size());
+}
+
+/// @brief args: number of values, the loop sums them as a sampler would visit them
+void arange_vector(benchmark::State & state)
+{
+  const double stop = static_cast<double>(state.range(0)) * 0.1;
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const double value : autoware_utils_math::arange(0.0, stop, 0.1)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of values
+void arange_view(benchmark::State & state)
+{
+  const double stop = static_cast<double>(state.range(0)) * 0.1;
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const double value : autoware_utils_math::arange_view(0.0, stop, 0.1)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of values
+void linspace_vector(benchmark::State & state)
+{
+  const auto num = static_cast<std::size_t>(state.range(0));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const double value : autoware_utils_math::linspace(-2.0, 2.0, num)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of values
+void linspace_view(benchmark::State & state)
+{
+  const auto num = static_cast<std::size_t>(state.range(0));
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const double value : autoware_utils_math::linspace_view(-2.0, 2.0, num)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+void linspace_array(benchmark::State & state)
+{
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    constexpr auto values = autoware_utils_math::linspace<101>(-2.0, 2.0);
+    double sum = 0.0;
+    for (const double value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  report_allocations(state, allocations_before, 1);
+}
+
+/// @brief args: number of values
+void deg2rad_scalar(benchmark::State & state)
+{
+  const auto degrees = make_angles(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> radians(degrees.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < degrees.size(); ++i) {
+      radians[i] = autoware_utils_math::deg2rad(degrees[i]);
+    }
+    benchmark::DoNotOptimize(radians.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, degrees.size());
+}
+
+/// @brief args: number of values
+void deg2rad_bulk(benchmark::State & state)
+{
+  const auto degrees = make_angles(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> radians(degrees.size());
+  const auto allocations_before = allocation_count();
+  for (auto _ : state) {
+    autoware_utils_math::deg2rad(degrees.data(), degrees.size(), radians.data());
+    benchmark::DoNotOptimize(radians.data());
+    benchmark::ClobberMemory();
+  }
+  report_allocations(state, allocations_before, degrees.size());
+}
+}  // namespace
+
+BENCHMARK(normalize_radian_scalar)->Arg(100)->Arg(10000)->ArgName("angles");
+BENCHMARK(normalize_radian_fast)->Arg(100)->Arg(10000)->ArgName("angles");
+BENCHMARK(normalize_radian_batch)->Arg(100)->Arg(10000)->ArgName("angles");
+BENCHMARK(normalize_degree_scalar)->Arg(100)->Arg(10000)->ArgName("angles");
+BENCHMARK(normalize_degree_batch)->Arg(100)->Arg(10000)->ArgName("angles");
+BENCHMARK(arange_vector)->Arg(20)->Arg(1000)->ArgName("values");
+BENCHMARK(arange_view)->Arg(20)->Arg(1000)->ArgName("values");
+BENCHMARK(linspace_vector)->Arg(21)->Arg(1001)->ArgName("values");
+BENCHMARK(linspace_view)->Arg(21)->Arg(1001)->ArgName("values");
+BENCHMARK(linspace_array);
+BENCHMARK(deg2rad_scalar)->Arg(100)->Arg(10000)->ArgName("values");
+BENCHMARK(deg2rad_bulk)->Arg(100)->Arg(10000)->ArgName("values");
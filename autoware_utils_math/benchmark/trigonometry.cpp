@@ -0,0 +1,322 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/constants.hpp"
+#include "autoware_utils_math/trigonometry.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// Latency and accuracy of the approximations of trigonometry.hpp next to the std functions. Each
+// benchmark reports the time per call and the max and mean absolute errors over the inputs,
+// measured against the std function in double precision.
+namespace
+{
+using autoware_utils_math::pi;
+
+constexpr std::size_t input_size = 4096;
+
+/// @brief angles spread over [-2 pi, 2 pi], the range of the headings normalized or not
+std::vector<float> make_angles()
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> angle(-2.f * pi, 2.f * pi);
+  std::vector<float> angles(input_size);
+  std::generate(angles.begin(), angles.end(), [&] { return angle(gen); });
+  return angles;
+}
+
+/// @brief coordinates of vectors in all the octants, with the magnitudes of normals and tangents
+template <class T>
+std::vector<T> make_coordinates(const unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> coordinate(-10.0, 10.0);
+  std::vector<T> coordinates(input_size);
+  std::generate(coordinates.begin(), coordinates.end(), [&] { return coordinate(gen); });
+  return coordinates;
+}
+
+template <class T>
+void report(
+  benchmark::State & state, const std::vector<T> & values, const std::vector<double> & references,
+  const bool periodic = false)
+{
+  double max_error = 0.0;
+  double sum_error = 0.0;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    double error = static_cast<double>(values[i]) - references[i];
+    if (periodic) {
+      error = std::remainder(error, 2.0 * pi);
+    }
+    max_error = std::max(max_error, std::abs(error));
+    sum_error += std::abs(error);
+  }
+  const auto calls = static_cast<double>(values.size());
+  state.counters["time/call"] =
+    benchmark::Counter(calls, benchmark::Counter::kIsIterationInvariantRate |
+                                benchmark::Counter::kInvert);
+  state.counters["max_error"] = max_error;
+  state.counters["mean_error"] = sum_error / calls;
+}
+
+std::vector<double> sin_references(const std::vector<float> & angles)
+{
+  std::vector<double> references;
+  for (const float angle : angles) references.push_back(std::sin(static_cast<double>(angle)));
+  return references;
+}
+
+std::vector<double> cos_references(const std::vector<float> & angles)
+{
+  std::vector<double> references;
+  for (const float angle : angles) references.push_back(std::cos(static_cast<double>(angle)));
+  return references;
+}
+
+template <class T>
+std::vector<double> atan2_references(const std::vector<T> & dy, const std::vector<T> & dx)
+{
+  std::vector<double> references;
+  for (std::size_t i = 0; i < dy.size(); ++i) {
+    references.push_back(std::atan2(static_cast<double>(dy[i]), static_cast<double>(dx[i])));
+  }
+  return references;
+}
+
+void sin_std(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) sins[i] = std::sin(angles[i]);
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, sins, sin_references(angles));
+}
+
+void sin_table(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) sins[i] = autoware_utils_math::sin(angles[i]);
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, sins, sin_references(angles));
+}
+
+void sin_table_batch(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  for (auto _ : state) {
+    autoware_utils_math::sin(angles.data(), angles.size(), sins.data());
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, sins, sin_references(angles));
+}
+
+void cos_std(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) coss[i] = std::cos(angles[i]);
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+void cos_table(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) coss[i] = autoware_utils_math::cos(angles[i]);
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+void cos_table_batch(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    autoware_utils_math::cos(angles.data(), angles.size(), coss.data());
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+// the errors are reported for the cos, the sin being covered by the sin benchmarks
+void sin_and_cos_std(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      sins[i] = std::sin(angles[i]);
+      coss[i] = std::cos(angles[i]);
+    }
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+void sin_and_cos_table(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      std::tie(sins[i], coss[i]) = autoware_utils_math::sin_and_cos(angles[i]);
+    }
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+void sin_and_cos_table_batch(benchmark::State & state)
+{
+  const auto angles = make_angles();
+  std::vector<float> sins(angles.size());
+  std::vector<float> coss(angles.size());
+  for (auto _ : state) {
+    autoware_utils_math::sin_and_cos(angles.data(), angles.size(), sins.data(), coss.data());
+    benchmark::DoNotOptimize(sins.data());
+    benchmark::DoNotOptimize(coss.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, coss, cos_references(angles));
+}
+
+void atan2_std_float(benchmark::State & state)
+{
+  const auto dy = make_coordinates<float>(1);
+  const auto dx = make_coordinates<float>(2);
+  std::vector<float> angles(dy.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < dy.size(); ++i) angles[i] = std::atan2(dy[i], dx[i]);
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, angles, atan2_references(dy, dx), true);
+}
+
+void atan2_opencv(benchmark::State & state)
+{
+  const auto dy = make_coordinates<float>(1);
+  const auto dx = make_coordinates<float>(2);
+  std::vector<float> angles(dy.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < dy.size(); ++i) {
+      angles[i] = autoware_utils_math::opencv_fast_atan2(dy[i], dx[i]);
+    }
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  // opencv_fast_atan2() is in [0, 2 pi)
+  report(state, angles, atan2_references(dy, dx), true);
+}
+
+void atan2_opencv_batch(benchmark::State & state)
+{
+  const auto dy = make_coordinates<float>(1);
+  const auto dx = make_coordinates<float>(2);
+  std::vector<float> angles(dy.size());
+  for (auto _ : state) {
+    autoware_utils_math::opencv_fast_atan2(dy.data(), dx.data(), dy.size(), angles.data());
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, angles, atan2_references(dy, dx), true);
+}
+
+void atan2_std_double(benchmark::State & state)
+{
+  const auto dy = make_coordinates<double>(1);
+  const auto dx = make_coordinates<double>(2);
+  std::vector<double> angles(dy.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < dy.size(); ++i) angles[i] = std::atan2(dy[i], dx[i]);
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, angles, atan2_references(dy, dx), true);
+}
+
+void atan2_fast(benchmark::State & state)
+{
+  const auto dy = make_coordinates<double>(1);
+  const auto dx = make_coordinates<double>(2);
+  std::vector<double> angles(dy.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < dy.size(); ++i) {
+      angles[i] = autoware_utils_math::fast_atan2(dy[i], dx[i]);
+    }
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, angles, atan2_references(dy, dx), true);
+}
+
+void atan2_fast_batch(benchmark::State & state)
+{
+  const auto dy = make_coordinates<double>(1);
+  const auto dx = make_coordinates<double>(2);
+  std::vector<double> angles(dy.size());
+  for (auto _ : state) {
+    autoware_utils_math::fast_atan2(dy.data(), dx.data(), dy.size(), angles.data());
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  report(state, angles, atan2_references(dy, dx), true);
+}
+}  // namespace
+
+BENCHMARK(sin_std);
+BENCHMARK(sin_table);
+BENCHMARK(sin_table_batch);
+BENCHMARK(cos_std);
+BENCHMARK(cos_table);
+BENCHMARK(cos_table_batch);
+BENCHMARK(sin_and_cos_std);
+BENCHMARK(sin_and_cos_table);
+BENCHMARK(sin_and_cos_table_batch);
+BENCHMARK(atan2_std_float);
+BENCHMARK(atan2_opencv);
+BENCHMARK(atan2_opencv_batch);
+BENCHMARK(atan2_std_double);
+BENCHMARK(atan2_fast);
+BENCHMARK(atan2_fast_batch);
@@ -0,0 +1,60 @@
+# Copyright 2026 The Autoware Contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Fail when GCC does not vectorize a batch loop of a source file, i.e. a line with
+# `for (std::size_t i = 0; i < size; ++i)`, which -fopt-info-vec-optimized then does not report.
+#
+# cmake -DCOMPILER=<g++> -DSOURCE=<file> -DINCLUDE_DIRS=<dirs> -DDEFINITIONS=<names>
+#       -DOUTPUT=<object file> -P check_vectorization.cmake
+
+cmake_minimum_required(VERSION 3.14)
+
+set(flags -std=c++17 -O3 -fopt-info-vec-optimized)
+foreach(dir IN LISTS INCLUDE_DIRS)
+  list(APPEND flags "-I${dir}")
+endforeach()
+foreach(definition IN LISTS DEFINITIONS)
+  list(APPEND flags "-D${definition}")
+endforeach()
+
+execute_process(
+  COMMAND ${COMPILER} ${flags} -c ${SOURCE} -o ${OUTPUT}
+  RESULT_VARIABLE result
+  ERROR_VARIABLE report)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "Failed to compile ${SOURCE}:\n${report}")
+endif()
+
+# the characters which are special in a list are replaced before splitting the lines
+file(READ ${SOURCE} content)
+string(REPLACE ";" "_" content "${content}")
+string(REPLACE "[" "_" content "${content}")
+string(REPLACE "]" "_" content "${content}")
+string(REPLACE "\n" ";" lines "${content}")
+
+get_filename_component(name ${SOURCE} NAME)
+set(line_number 0)
+set(scalar_lines)
+foreach(line IN LISTS lines)
+  math(EXPR line_number "${line_number} + 1")
+  if(line MATCHES "for \\(std::size_t i = 0_ i < size_ \\+\\+i\\)"
+     AND NOT report MATCHES "${name}:${line_number}:[0-9]+: optimized: loop vectorized")
+    list(APPEND scalar_lines ${line_number})
+  endif()
+endforeach()
+
+if(scalar_lines)
+  string(REPLACE ";" ", " scalar_lines "${scalar_lines}")
+  message(FATAL_ERROR "The batch loops of ${name} at the lines ${scalar_lines} are not vectorized.")
+endif()
@@ -15,13 +15,22 @@
 #ifndef AUTOWARE_UTILS_MATH__ACCUMULATOR_HPP_
 #define AUTOWARE_UTILS_MATH__ACCUMULATOR_HPP_
 
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 namespace autoware_utils_math
 {
 /**
- * @brief class to accumulate statistical data, supporting min, max and mean.
+ * @brief class to accumulate statistical data, supporting min, max, mean and variance.
+ * @details the variance is updated with the Welford algorithm, and accumulators filled separately,
+ * e.g. one per thread, can be combined with merge().
  * @typedef T type of the values (default to double)
  */
 template <typename T = double>
@@ -41,7 +50,35 @@ public:
       max_ = value;
     }
     ++count_;
-    mean_ = mean_ + (value - mean_) / count_;
+    const long double delta = value - mean_;
+    mean_ = mean_ + delta / count_;
+    m2_ += delta * (value - mean_);
+  }
+
+  /**
+   * @brief add the values accumulated by another accumulator
+   * @details the result is the same as adding all the values to this accumulator, up to rounding
+   */
+  void merge(const Accumulator & other)
+  {
+    if (other.count_ == 0) {
+      return;
+    }
+    if (count_ == 0) {
+      *this = other;
+      return;
+    }
+    if (other.min_ < min_) {
+      min_ = other.min_;
+    }
+    if (other.max_ > max_) {
+      max_ = other.max_;
+    }
+    const long double count = static_cast<long double>(count_) + other.count_;
+    const long double delta = other.mean_ - mean_;
+    mean_ = mean_ + delta * other.count_ / count;
+    m2_ += other.m2_ + delta * delta * count_ * other.count_ / count;
+    count_ += other.count_;
   }
 
   /**
@@ -49,6 +86,16 @@ public:
    */
   long double mean() const { return mean_; }
 
+  /**
+   * @brief get the population variance, 0 if there is no value
+   */
+  long double variance() const { return count_ == 0 ? 0.0L : m2_ / count_; }
+
+  /**
+   * @brief get the population standard deviation, 0 if there is no value
+   */
+  long double stddev() const { return std::sqrt(variance()); }
+
   /**
    * @brief get the minimum value
    */
@@ -62,7 +109,7 @@ public:
   /**
    * @brief get the number of values used to build this statistic
    */
-  unsigned int count() const { return count_; }
+  std::size_t count() const { return count_; }
 
   template <typename U>
   friend std::ostream & operator<<(std::ostream & os, const Accumulator<U> & accumulator);
@@ -71,7 +118,308 @@ private:
   T min_ = std::numeric_limits<T>::max();
   T max_ = std::numeric_limits<T>::lowest();
   long double mean_ = 0.0;
-  unsigned int count_ = 0;
+  long double m2_ = 0.0;  // sum of the squared deviations from the mean
+  std::size_t count_ = 0;
+};
+
+/**
+ * @brief lock-free accumulator of min, max, mean and variance for values added by several threads
+ * @details each add() is a few relaxed atomic operations. The statistics read while values are
+ * being added may mix values which are not all counted yet. The variance is computed from the sums
+ * of the values and their squares, both relative to a shift, so set the shift near the expected
+ * mean to avoid the cancellation when the deviations are small compared to the mean. For the best
+ * accuracy with few threads, prefer one Accumulator per thread combined with merge().
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class AtomicAccumulator
+{
+public:
+  explicit AtomicAccumulator(const double shift = 0.0) : shift_(shift) {}
+
+  /**
+   * @brief add a value, can be called concurrently
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    const double shifted = static_cast<double>(value) - shift_;
+    add_impl(sum_, shifted);
+    add_impl(sum_squares_, shifted * shifted);
+    T min = min_.load(std::memory_order_relaxed);
+    while (value < min && !min_.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+    }
+    T max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+    count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief get the mean value, 0 if there is no value
+   */
+  double mean() const
+  {
+    const auto count = count_.load(std::memory_order_relaxed);
+    return count == 0 ? 0.0 : shift_ + sum_.load(std::memory_order_relaxed) / count;
+  }
+
+  /**
+   * @brief get the population variance, 0 if there is no value
+   */
+  double variance() const
+  {
+    const auto count = count_.load(std::memory_order_relaxed);
+    if (count == 0) {
+      return 0.0;
+    }
+    const double mean = sum_.load(std::memory_order_relaxed) / count;
+    const double variance = sum_squares_.load(std::memory_order_relaxed) / count - mean * mean;
+    return variance < 0.0 ? 0.0 : variance;
+  }
+
+  /**
+   * @brief get the minimum value
+   */
+  T min() const { return min_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief get the maximum value
+   */
+  T max() const { return max_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+private:
+  // std::atomic<double>::fetch_add is only available from C++20
+  static void add_impl(std::atomic<double> & sum, const double value)
+  {
+    double expected = sum.load(std::memory_order_relaxed);
+    while (!sum.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed)) {
+    }
+  }
+
+  const double shift_;
+  std::atomic<T> min_{std::numeric_limits<T>::max()};
+  std::atomic<T> max_{std::numeric_limits<T>::lowest()};
+  std::atomic<double> sum_{0.0};
+  std::atomic<double> sum_squares_{0.0};
+  std::atomic<std::uint64_t> count_{0};
+};
+
+namespace detail
+{
+/**
+ * @brief monotonic queue of the sequence numbers of the values of a window, in a ring buffer
+ * @details the values of the queued numbers are sorted by Compare from the front, so that the front
+ * is the min or the max of the window. Each number is pushed and popped once.
+ */
+template <typename T, typename Compare>
+class MonotonicQueue
+{
+public:
+  explicit MonotonicQueue(const std::size_t capacity) : sequences_(capacity) {}
+
+  void push(const std::size_t sequence, const std::vector<T> & window)
+  {
+    const T & value = window[sequence % window.size()];
+    while (size_ > 0 && !Compare{}(window[back() % window.size()], value)) {
+      --size_;
+    }
+    sequences_[(head_ + size_) % sequences_.size()] = sequence;
+    ++size_;
+  }
+
+  /// @brief pop the numbers which are older than the oldest one of the window
+  void expire(const std::size_t oldest)
+  {
+    while (size_ > 0 && sequences_[head_] < oldest) {
+      head_ = (head_ + 1) % sequences_.size();
+      --size_;
+    }
+  }
+
+  bool empty() const { return size_ == 0; }
+
+  std::size_t front() const { return sequences_[head_]; }
+
+private:
+  std::size_t back() const { return sequences_[(head_ + size_ - 1) % sequences_.size()]; }
+
+  std::vector<std::size_t> sequences_;
+  std::size_t head_ = 0;
+  std::size_t size_ = 0;
+};
+}  // namespace detail
+
+/**
+ * @brief class to accumulate the statistics of the last values only, in a window of fixed size
+ * @details add() is O(1) amortized and does not allocate: the values are kept in a ring buffer, the
+ * mean and variance are updated with the Welford formulas for the replacement of a value, and the
+ * min and max are the fronts of monotonic queues.
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class WindowAccumulator
+{
+public:
+  /**
+   * @param window_size number of the last values used to build the statistics
+   * @throw std::invalid_argument if the window size is 0
+   */
+  explicit WindowAccumulator(const std::size_t window_size)
+  : window_(window_size), min_queue_(window_size), max_queue_(window_size)
+  {
+    if (window_size == 0) {
+      throw std::invalid_argument("window size must be positive.");
+    }
+  }
+
+  /**
+   * @brief add a value, removing the oldest one if the window is full
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    const std::size_t sequence = total_++;
+    T & slot = window_[sequence % window_.size()];
+    if (count_ < window_.size()) {
+      ++count_;
+      const long double delta = value - mean_;
+      mean_ = mean_ + delta / count_;
+      m2_ += delta * (value - mean_);
+    } else {
+      const long double removed = slot;
+      const long double previous_mean = mean_;
+      mean_ = mean_ + (value - removed) / count_;
+      m2_ += (value - removed) * (value - mean_ + removed - previous_mean);
+      if (m2_ < 0.0L) {
+        m2_ = 0.0L;
+      }
+    }
+    slot = value;
+
+    const std::size_t oldest = total_ - count_;
+    min_queue_.expire(oldest);
+    max_queue_.expire(oldest);
+    min_queue_.push(sequence, window_);
+    max_queue_.push(sequence, window_);
+  }
+
+  /**
+   * @brief get the mean value of the window
+   */
+  long double mean() const { return mean_; }
+
+  /**
+   * @brief get the population variance of the window, 0 if there is no value
+   */
+  long double variance() const { return count_ == 0 ? 0.0L : m2_ / count_; }
+
+  /**
+   * @brief get the population standard deviation of the window, 0 if there is no value
+   */
+  long double stddev() const { return std::sqrt(variance()); }
+
+  /**
+   * @brief get the minimum value of the window
+   */
+  T min() const
+  {
+    return min_queue_.empty() ? std::numeric_limits<T>::max()
+                              : window_[min_queue_.front() % window_.size()];
+  }
+
+  /**
+   * @brief get the maximum value of the window
+   */
+  T max() const
+  {
+    return max_queue_.empty() ? std::numeric_limits<T>::lowest()
+                              : window_[max_queue_.front() % window_.size()];
+  }
+
+  /**
+   * @brief get the number of values in the window
+   */
+  std::size_t count() const { return count_; }
+
+  std::size_t window_size() const { return window_.size(); }
+
+private:
+  std::vector<T> window_;
+  detail::MonotonicQueue<T, std::less<T>> min_queue_;
+  detail::MonotonicQueue<T, std::greater<T>> max_queue_;
+  long double mean_ = 0.0;
+  long double m2_ = 0.0;
+  std::size_t count_ = 0;
+  std::size_t total_ = 0;
+};
+
+/**
+ * @brief class to accumulate the exponentially weighted moving mean and variance of values
+ * @details the weight of a value is divided by 2 after ln(2) / alpha values approximately, so use
+ * alpha = 1 - exp(-ln(2) / n) for a half-life of n values. add() is O(1).
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class EwmaAccumulator
+{
+public:
+  /**
+   * @param alpha weight of a new value
+   * @throw std::invalid_argument if alpha is not in (0, 1]
+   */
+  explicit EwmaAccumulator(const double alpha) : alpha_(alpha)
+  {
+    if (!(0.0 < alpha && alpha <= 1.0)) {
+      throw std::invalid_argument("alpha must be in (0, 1].");
+    }
+  }
+
+  /**
+   * @brief add a value
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    if (count_++ == 0) {
+      mean_ = value;
+      return;
+    }
+    const double delta = value - mean_;
+    mean_ += alpha_ * delta;
+    variance_ = (1.0 - alpha_) * (variance_ + alpha_ * delta * delta);
+  }
+
+  /**
+   * @brief get the moving mean, 0 if there is no value
+   */
+  double mean() const { return mean_; }
+
+  /**
+   * @brief get the moving variance, 0 if there are less than 2 values
+   */
+  double variance() const { return variance_; }
+
+  /**
+   * @brief get the moving standard deviation, 0 if there are less than 2 values
+   */
+  double stddev() const { return std::sqrt(variance_); }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  std::size_t count() const { return count_; }
+
+private:
+  double alpha_;
+  double mean_ = 0.0;
+  double variance_ = 0.0;
+  std::size_t count_ = 0;
 };
 
 /**
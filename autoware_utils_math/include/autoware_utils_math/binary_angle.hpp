@@ -0,0 +1,108 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_MATH__BINARY_ANGLE_HPP_
+#define AUTOWARE_UTILS_MATH__BINARY_ANGLE_HPP_
+
+#include "autoware_utils_math/constants.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace autoware_utils_math
+{
+/**
+ * @brief angle stored as a 32 bits fraction of a turn (binary angular measurement)
+ * @details the arithmetic wraps around the turn with the unsigned integer overflow, so the angles
+ * are always normalized without branches. The resolution is 2 pi / 2^32, about 1.5e-9 rad. The
+ * table lookups of trigonometry.hpp take a BinaryAngle directly, with a shift instead of the float
+ * rounding and the modulo of the radian versions.
+ */
+class BinaryAngle
+{
+public:
+  /// @brief number of units in a turn, as a double since it does not fit in 32 bits
+  static constexpr double units_per_turn = 4294967296.0;
+
+  constexpr BinaryAngle() = default;
+
+  static constexpr BinaryAngle from_raw(const std::uint32_t raw) { return BinaryAngle(raw); }
+
+  /// @brief nearest binary angle of a radian value, any multiple of 2 pi being removed
+  static BinaryAngle from_radian(const double radian)
+  {
+    constexpr double scale = units_per_turn / (2.0 * pi);
+    // the conversion of the signed value to unsigned wraps it into [0, 2^32)
+    return BinaryAngle(static_cast<std::uint32_t>(std::llround(radian * scale)));
+  }
+
+  static BinaryAngle from_degree(const double degree)
+  {
+    return from_radian(degree * (pi / 180.0));
+  }
+
+  constexpr std::uint32_t raw() const { return raw_; }
+
+  /// @brief angle in [-pi, pi)
+  constexpr double to_radian() const
+  {
+    return static_cast<double>(static_cast<std::int32_t>(raw_)) * (2.0 * pi / units_per_turn);
+  }
+
+  /// @brief angle in [-180, 180)
+  constexpr double to_degree() const
+  {
+    return static_cast<double>(static_cast<std::int32_t>(raw_)) * (360.0 / units_per_turn);
+  }
+
+  constexpr BinaryAngle & operator+=(const BinaryAngle other)
+  {
+    raw_ += other.raw_;
+    return *this;
+  }
+
+  constexpr BinaryAngle & operator-=(const BinaryAngle other)
+  {
+    raw_ -= other.raw_;
+    return *this;
+  }
+
+  friend constexpr BinaryAngle operator+(BinaryAngle a, const BinaryAngle b) { return a += b; }
+  friend constexpr BinaryAngle operator-(BinaryAngle a, const BinaryAngle b) { return a -= b; }
+  friend constexpr BinaryAngle operator-(const BinaryAngle a) { return BinaryAngle(0u - a.raw_); }
+
+  /// @brief multiple of the angle, wrapped around the turn
+  friend constexpr BinaryAngle operator*(const BinaryAngle a, const std::int32_t n)
+  {
+    return BinaryAngle(a.raw_ * static_cast<std::uint32_t>(n));
+  }
+
+  friend constexpr bool operator==(const BinaryAngle a, const BinaryAngle b)
+  {
+    return a.raw_ == b.raw_;
+  }
+  friend constexpr bool operator!=(const BinaryAngle a, const BinaryAngle b)
+  {
+    return a.raw_ != b.raw_;
+  }
+
+private:
+  explicit constexpr BinaryAngle(const std::uint32_t raw) : raw_(raw) {}
+
+  std::uint32_t raw_ = 0;
+};
+
+}  // namespace autoware_utils_math
+
+#endif  // AUTOWARE_UTILS_MATH__BINARY_ANGLE_HPP_
@@ -0,0 +1,143 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_MATH__HDR_HISTOGRAM_HPP_
+#define AUTOWARE_UTILS_MATH__HDR_HISTOGRAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_math
+{
+/**
+ * @brief histogram of non-negative values with a bounded relative error, as HdrHistogram
+ * @details the values are counted in integer multiples of the resolution, in buckets whose width
+ * doubles with each power of two and which are split into enough sub-buckets for the significant
+ * digits, so that record() is a few integer operations and the memory is fixed by the range.
+ * A quantile is within a relative error of 10^-significant_digits. The histograms with the same
+ * parameters can be merged, e.g. the histograms of several threads or of several periods, and are
+ * encoded in a few bytes per used bucket for a message. With the values of StopWatch in
+ * milliseconds and a resolution of 0.001, the histogram reports the p99.9 of the cycle times:
+ * @code
+ * autoware_utils_math::HdrHistogram histogram(1000.0, 3, 0.001);
+ * histogram.record(stop_watch.toc("cycle", true));
+ * const double p999 = histogram.quantile(0.999);
+ * @endcode
+ */
+class HdrHistogram
+{
+public:
+  /**
+   * @param highest_value highest value distinguished, the higher values are counted as it
+   * @param significant_digits number of significant decimal digits of the values, from 1 to 5
+   * @param resolution lowest value distinguished from 0, the values are rounded to its multiples
+   * @throw std::invalid_argument if the parameters are out of range
+   */
+  explicit HdrHistogram(
+    double highest_value, int significant_digits = 3, double resolution = 1.0);
+
+  /**
+   * @brief add a value, negative values are counted as 0
+   * @param value value to add
+   * @param count number of times the value is added
+   */
+  void record(double value, std::uint64_t count = 1);
+
+  /**
+   * @brief get the value below which the given fraction of the values are, 0 if there is no value
+   * @param probability probability of the quantile in [0, 1], e.g. 0.999 for the p99.9
+   */
+  double quantile(double probability) const;
+
+  double min() const { return count_ == 0 ? 0.0 : min_; }
+  double max() const { return count_ == 0 ? 0.0 : max_; }
+  double mean() const { return count_ == 0 ? 0.0 : sum_ / static_cast<double>(count_); }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  std::uint64_t count() const { return count_; }
+
+  /**
+   * @brief get the number of values higher than the highest value, counted as it
+   */
+  std::uint64_t saturated() const { return saturated_; }
+
+  /**
+   * @brief add the values of another histogram
+   * @throw std::invalid_argument if the parameters of the histograms differ
+   */
+  void merge(const HdrHistogram & other);
+
+  /**
+   * @brief remove all the values, the memory is kept
+   */
+  void reset();
+
+  /**
+   * @brief encode the parameters and the counts, with the runs of empty buckets compressed
+   * @return bytes for e.g. a uint8[] field of a message
+   */
+  std::vector<std::uint8_t> encode() const;
+
+  /**
+   * @brief decode a histogram encoded by encode()
+   * @throw std::invalid_argument if the bytes are not an encoded histogram
+   */
+  static HdrHistogram decode(const std::vector<std::uint8_t> & bytes);
+
+  /**
+   * @brief get the count, the min, the mean, the max and the p50, p90, p99 and p99.9 as texts, for
+   * e.g. the key values of a diagnostic status
+   * @param prefix prefix of the keys
+   */
+  std::vector<std::pair<std::string, std::string>> to_key_values(
+    const std::string & prefix = "") const;
+
+  double highest_value() const;
+  int significant_digits() const { return significant_digits_; }
+  double resolution() const { return resolution_; }
+
+private:
+  struct Units
+  {
+    std::uint64_t value;
+  };
+
+  HdrHistogram(Units highest, int significant_digits, double resolution);
+  static std::uint64_t to_units(double highest_value, double resolution);
+  std::size_t index_of(std::uint64_t value) const;
+  std::uint64_t highest_equivalent(std::size_t index) const;
+
+  int significant_digits_;
+  double resolution_;
+  std::uint64_t highest_;
+  int sub_bucket_half_count_magnitude_;
+  std::uint64_t sub_bucket_half_count_;
+  std::uint64_t sub_bucket_mask_;
+  std::vector<std::uint64_t> counts_;
+
+  std::uint64_t count_ = 0;
+  std::uint64_t saturated_ = 0;
+  double sum_ = 0.0;
+  double min_ = 0.0;
+  double max_ = 0.0;
+};
+
+}  // namespace autoware_utils_math
+
+#endif  // AUTOWARE_UTILS_MATH__HDR_HISTOGRAM_HPP_
@@ -18,6 +18,7 @@
 #include "autoware_utils_math/constants.hpp"
 
 #include <cmath>
+#include <cstddef>
 
 namespace autoware_utils_math
 {
@@ -45,6 +46,109 @@ inline double normalize_radian(const double rad, const double min_rad = -pi)
   return value - std::copysign(2 * pi, value);
 }
 
+namespace detail
+{
+// 2 pi split in 2 parts with few significant bits, so that k * pi_2_hi and k * pi_2_lo are exact
+// for |k| up to max_exact_turns (Cody-Waite reduction)
+constexpr double pi_2_hi = 0x1.921fb544p+2;
+constexpr double pi_2_lo = 0x1.0b46p-32;
+constexpr double max_exact_turns = 1048576.0;  // 2^20
+static_assert(pi_2_hi + pi_2_lo == 2 * pi);
+
+/// @brief the result of normalize_radian() if |turns| <= max_exact_turns
+inline double reduce_radian(const double rad, const double min_rad, const double turns)
+{
+  const double value = (rad - turns * pi_2_hi) - turns * pi_2_lo;
+  // the rounded turns can be off by one at the bounds, the selects compile to blends
+  const double above_min = value < min_rad ? value + 2 * pi : value;
+  return above_min >= min_rad + 2 * pi ? above_min - 2 * pi : above_min;
+}
+
+inline double reduce_degree(const double deg, const double min_deg, const double turns)
+{
+  const double value = deg - turns * 360.0;
+  const double above_min = value < min_deg ? value + 360.0 : value;
+  return above_min >= min_deg + 360.0 ? above_min - 360.0 : above_min;
+}
+}  // namespace detail
+
+/**
+ * @brief normalize_radian() without std::fmod, for the loops over many angles
+ * @details The number of turns is rounded from a multiplication and removed exactly, so the result
+ *          is the same as normalize_radian() for |rad| up to 2^20 turns. Larger inputs take the
+ *          std::fmod path.
+ */
+inline double normalize_radian_fast(const double rad, const double min_rad = -pi)
+{
+  const double turns = std::floor((rad - min_rad) * (1.0 / (2 * pi)));
+  if (detail::max_exact_turns < std::abs(turns)) {
+    return normalize_radian(rad, min_rad);
+  }
+  return detail::reduce_radian(rad, min_rad, turns);
+}
+
+/// @brief normalize_degree() without std::fmod, see normalize_radian_fast()
+inline double normalize_degree_fast(const double deg, const double min_deg = -180)
+{
+  const double turns = std::floor((deg - min_deg) * (1.0 / 360.0));
+  if (detail::max_exact_turns < std::abs(turns)) {
+    return normalize_degree(deg, min_deg);
+  }
+  return detail::reduce_degree(deg, min_deg, turns);
+}
+
+/**
+ * @brief normalize_radian_fast() of size angles, e.g. the yaws of a trajectory
+ * @details The loop over the angles is vectorized, only the angles beyond 2^20 turns are
+ *          normalized in a second pass with std::fmod.
+ * @param normalized output of size angles, it can be the same array as rads
+ */
+inline void normalize_radian(
+  const double * rads, const std::size_t size, double * normalized, const double min_rad = -pi)
+{
+  bool has_large = false;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double rad = rads[i];
+    const double turns = std::floor((rad - min_rad) * (1.0 / (2 * pi)));
+    const bool large = detail::max_exact_turns < std::abs(turns);
+    has_large |= large;
+    normalized[i] = large ? rad : detail::reduce_radian(rad, min_rad, turns);
+  }
+  if (!has_large) {
+    return;
+  }
+  // the large angles were copied as is, they are the only ones out of the range
+  for (std::size_t i = 0; i < size; ++i) {
+    const double value = normalized[i];
+    if (value < min_rad || min_rad + 2 * pi <= value) {
+      normalized[i] = normalize_radian(value, min_rad);
+    }
+  }
+}
+
+/// @brief normalize_degree_fast() of size angles, see the batched normalize_radian()
+inline void normalize_degree(
+  const double * degs, const std::size_t size, double * normalized, const double min_deg = -180)
+{
+  bool has_large = false;
+  for (std::size_t i = 0; i < size; ++i) {
+    const double deg = degs[i];
+    const double turns = std::floor((deg - min_deg) * (1.0 / 360.0));
+    const bool large = detail::max_exact_turns < std::abs(turns);
+    has_large |= large;
+    normalized[i] = large ? deg : detail::reduce_degree(deg, min_deg, turns);
+  }
+  if (!has_large) {
+    return;
+  }
+  // the large angles were copied as is, they are the only ones out of the range
+  for (std::size_t i = 0; i < size; ++i) {
+    const double value = normalized[i];
+    if (value < min_deg || min_deg + 360.0 <= value) {
+      normalized[i] = normalize_degree(value, min_deg);
+    }
+  }
+}
 }  // namespace autoware_utils_math
 
 #endif  // AUTOWARE_UTILS_MATH__NORMALIZATION_HPP_
@@ -0,0 +1,71 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_MATH__QUANTILE_HPP_
+#define AUTOWARE_UTILS_MATH__QUANTILE_HPP_
+
+#include <array>
+#include <cstddef>
+
+namespace autoware_utils_math
+{
+/**
+ * @brief streaming estimation of a quantile with the P-square algorithm (Jain and Chlamtac, 1985)
+ * @details keeps 5 markers whose heights are adjusted with a piecewise parabolic interpolation, so
+ * that the memory and the cost of add() are constant. The estimate is exact up to 5 values. The
+ * sketches cannot be merged: use one instance per quantile and per producer of the values, e.g.
+ * next to an Accumulator for the latency tail.
+ */
+class P2Quantile
+{
+public:
+  /**
+   * @param probability probability of the quantile, e.g. 0.99 for the 99th percentile
+   * @throw std::invalid_argument if the probability is not in (0, 1)
+   */
+  explicit P2Quantile(double probability);
+
+  /**
+   * @brief add a value
+   * @param value value to add
+   */
+  void add(double value);
+
+  /**
+   * @brief get the estimate of the quantile, 0 if there is no value
+   */
+  double quantile() const;
+
+  double probability() const { return probability_; }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  std::size_t count() const { return count_; }
+
+private:
+  double parabolic(std::size_t i, double direction) const;
+  double linear(std::size_t i, double direction) const;
+
+  double probability_;
+  std::size_t count_ = 0;
+  std::array<double, 5> heights_{};
+  std::array<double, 5> positions_{};
+  std::array<double, 5> desired_positions_{};
+  std::array<double, 5> increments_{};
+};
+
+}  // namespace autoware_utils_math
+
+#endif  // AUTOWARE_UTILS_MATH__QUANTILE_HPP_
@@ -15,15 +15,128 @@
 #ifndef AUTOWARE_UTILS_MATH__RANGE_HPP_
 #define AUTOWARE_UTILS_MATH__RANGE_HPP_
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <vector>
 
 namespace autoware_utils_math
 {
+/**
+ * @brief lazy view of the values start + i * step for i in [0, size), returned by arange_view() and
+ * linspace_view()
+ * @details the values are computed on access, so the view does not allocate. Its iterators are
+ * random access and return the values by copy, which is enough for range-for and the standard
+ * algorithms.
+ */
 template <class T>
-std::vector<T> arange(const T start, const T stop, const T step = 1)
+class LinearRange
+{
+public:
+  class iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = T;
+
+    iterator() = default;
+    iterator(const T start, const T step, const size_t index)
+    : start_(start), step_(step), index_(index)
+    {
+    }
+
+    T operator*() const { return start_ + static_cast<T>(index_) * step_; }
+    T operator[](const difference_type n) const { return *(*this + n); }
+
+    iterator & operator++()
+    {
+      ++index_;
+      return *this;
+    }
+    iterator operator++(int)
+    {
+      auto copy = *this;
+      ++index_;
+      return copy;
+    }
+    iterator & operator--()
+    {
+      --index_;
+      return *this;
+    }
+    iterator operator--(int)
+    {
+      auto copy = *this;
+      --index_;
+      return copy;
+    }
+    iterator & operator+=(const difference_type n)
+    {
+      index_ += n;
+      return *this;
+    }
+    iterator & operator-=(const difference_type n)
+    {
+      index_ -= n;
+      return *this;
+    }
+    friend iterator operator+(iterator it, const difference_type n) { return it += n; }
+    friend iterator operator+(const difference_type n, iterator it) { return it += n; }
+    friend iterator operator-(iterator it, const difference_type n) { return it -= n; }
+    friend difference_type operator-(const iterator & a, const iterator & b)
+    {
+      return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+    }
+
+    friend bool operator==(const iterator & a, const iterator & b) { return a.index_ == b.index_; }
+    friend bool operator!=(const iterator & a, const iterator & b) { return a.index_ != b.index_; }
+    friend bool operator<(const iterator & a, const iterator & b) { return a.index_ < b.index_; }
+    friend bool operator>(const iterator & a, const iterator & b) { return a.index_ > b.index_; }
+    friend bool operator<=(const iterator & a, const iterator & b) { return a.index_ <= b.index_; }
+    friend bool operator>=(const iterator & a, const iterator & b) { return a.index_ >= b.index_; }
+
+  private:
+    T start_{};
+    T step_{};
+    size_t index_{0};
+  };
+
+  using value_type = T;
+  using size_type = size_t;
+  using const_iterator = iterator;
+
+  LinearRange(const T start, const T step, const size_t size)
+  : start_(start), step_(step), size_(size)
+  {
+  }
+
+  iterator begin() const { return iterator(start_, step_, 0); }
+  iterator end() const { return iterator(start_, step_, size_); }
+
+  T operator[](const size_t i) const { return start_ + static_cast<T>(i) * step_; }
+  T front() const { return (*this)[0]; }
+  T back() const { return (*this)[size_ - 1]; }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+private:
+  T start_;
+  T step_;
+  size_t size_;
+};
+
+/**
+ * @brief lazy version of arange(), with the same values and the same exceptions
+ */
+template <class T>
+LinearRange<T> arange_view(const T start, const T stop, const T step = 1)
 {
   if (step == 0) {
     throw std::invalid_argument("step must be non-zero value.");
@@ -38,38 +151,62 @@ std::vector<T> arange(const T start, const T stop, const T step = 1)
   }
 
   const double max_i_double = std::ceil(static_cast<double>(stop - start) / step);
-  const auto max_i = static_cast<size_t>(max_i_double);
-
-  std::vector<T> out;
-  out.reserve(max_i);
-  for (size_t i = 0; i < max_i; ++i) {
-    out.push_back(start + i * step);
-  }
+  return LinearRange<T>(start, step, static_cast<size_t>(max_i_double));
+}
 
-  return out;
+template <class T>
+std::vector<T> arange(const T start, const T stop, const T step = 1)
+{
+  const auto range = arange_view(start, stop, step);
+  return std::vector<T>(range.begin(), range.end());
 }
 
+/**
+ * @brief lazy version of linspace(), with the same values
+ */
 template <class T>
-std::vector<double> linspace(const T start, const T stop, const size_t num)
+LinearRange<double> linspace_view(const T start, const T stop, const size_t num)
 {
   const auto start_double = static_cast<double>(start);
   const auto stop_double = static_cast<double>(stop);
+  const double step = num < 2 ? 0.0 : (stop_double - start_double) / static_cast<double>(num - 1);
+  return LinearRange<double>(start_double, step, num);
+}
 
-  if (num == 0) {
-    return {};
-  }
+template <class T>
+std::vector<double> linspace(const T start, const T stop, const size_t num)
+{
+  const auto range = linspace_view(start, stop, num);
+  return std::vector<double>(range.begin(), range.end());
+}
 
-  if (num == 1) {
-    return {start_double};
+/**
+ * @brief compile-time version of arange(), with N values from start by step
+ * @details the number of values is a template parameter as std::ceil is not constexpr
+ */
+template <size_t N, class T>
+constexpr std::array<T, N> arange(const T start, const T step)
+{
+  std::array<T, N> out{};
+  for (size_t i = 0; i < N; ++i) {
+    out[i] = start + static_cast<T>(i) * step;
   }
+  return out;
+}
 
-  std::vector<double> out;
-  out.reserve(num);
-  const double step = (stop_double - start_double) / static_cast<double>(num - 1);
-  for (size_t i = 0; i < num; i++) {
-    out.push_back(start_double + static_cast<double>(i) * step);
+/**
+ * @brief compile-time version of linspace(), with the same values
+ */
+template <size_t N, class T>
+constexpr std::array<double, N> linspace(const T start, const T stop)
+{
+  const auto start_double = static_cast<double>(start);
+  const auto stop_double = static_cast<double>(stop);
+  const double step = N < 2 ? 0.0 : (stop_double - start_double) / static_cast<double>(N - 1);
+  std::array<double, N> out{};
+  for (size_t i = 0; i < N; ++i) {
+    out[i] = start_double + static_cast<double>(i) * step;
   }
-
   return out;
 }
 
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE_UTILS_MATH__SIN_TABLE_HPP_
 #define AUTOWARE_UTILS_MATH__SIN_TABLE_HPP_
 
+#include <array>
 #include <cstddef>
 
 namespace autoware_utils_math
@@ -25,6 +26,17 @@ constexpr size_t discrete_arcs_num_90 = 32768;
 constexpr size_t discrete_arcs_num_360 = 131072;
 extern const float g_sin_table[sin_table_size];
 
+/**
+ * @brief sin on [0, pi/2] sampled every pi/2/1024, generated at compile time
+ * @details 4 KB instead of 128 KB. The linear interpolation of this table is used by the functions
+ * of trigonometry.hpp when the package is built with AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE. The
+ * error is below 1e-6 for angles within a few turns, against 2.4e-5 for the nearest value of
+ * g_sin_table.
+ */
+constexpr size_t compact_sin_table_size = 1025;
+constexpr size_t compact_discrete_arcs_num_90 = 1024;
+extern const std::array<float, compact_sin_table_size> g_compact_sin_table;
+
 }  // namespace autoware_utils_math
 
 #endif  // AUTOWARE_UTILS_MATH__SIN_TABLE_HPP_
@@ -15,6 +15,9 @@
 #ifndef AUTOWARE_UTILS_MATH__TRIGONOMETRY_HPP_
 #define AUTOWARE_UTILS_MATH__TRIGONOMETRY_HPP_
 
+#include "autoware_utils_math/binary_angle.hpp"
+
+#include <cstddef>
 #include <utility>
 
 namespace autoware_utils_math
@@ -26,8 +29,43 @@ float cos(float radian);
 
 std::pair<float, float> sin_and_cos(float radian);
 
+/**
+ * @brief batch versions of the table lookups, giving the same results as the scalar functions
+ * @details the quadrant is resolved without branches and the index is rounded without std::round()
+ * so that the loops over the angles can be vectorized, using gathers for the table reads where the
+ * target supports them, which the check_vectorization test verifies with GCC. The output arrays
+ * may alias the input array.
+ */
+void sin(const float * radians, std::size_t size, float * sins);
+
+void cos(const float * radians, std::size_t size, float * coss);
+
+void sin_and_cos(const float * radians, std::size_t size, float * sins, float * coss);
+
+/**
+ * @brief table lookups of a binary angle, where the index is a shift of the angle
+ */
+float sin(BinaryAngle angle);
+
+float cos(BinaryAngle angle);
+
+std::pair<float, float> sin_and_cos(BinaryAngle angle);
+
 float opencv_fast_atan2(float dy, float dx);
 
+/// @brief batch version of opencv_fast_atan2() without branches, so that the loop is vectorized
+void opencv_fast_atan2(const float * dy, const float * dx, std::size_t size, float * angles);
+
+/**
+ * @brief polynomial approximation of std::atan2 in double precision
+ * @details the absolute error is below 1e-9 rad for finite inputs. The result is in [-pi, pi] like
+ * std::atan2, but the signs of the zeros are ignored: the angle of (0, 0) is 0.
+ */
+double fast_atan2(double dy, double dx);
+
+/// @brief batch version of fast_atan2(), the output array may alias the input arrays
+void fast_atan2(const double * dy, const double * dx, std::size_t size, double * angles);
+
 }  // namespace autoware_utils_math
 
 #endif  // AUTOWARE_UTILS_MATH__TRIGONOMETRY_HPP_
@@ -17,6 +17,9 @@
 
 #include "autoware_utils_math/constants.hpp"
 
+#include <array>
+#include <cstddef>
+
 namespace autoware_utils_math
 {
 constexpr double deg2rad(const double deg)
@@ -38,6 +41,82 @@ constexpr double mps2kmph(const double mps)
 {
   return mps * 3600.0 / 1000.0;
 }
+
+// The overloads below convert whole arrays with the same rounding as the scalar functions. The
+// loops have no dependency between the elements, so the compiler vectorizes them, and the
+// std::array versions are constexpr for the constant tables.
+
+template <std::size_t N>
+constexpr std::array<double, N> deg2rad(const std::array<double, N> & degs)
+{
+  std::array<double, N> rads{};
+  for (std::size_t i = 0; i < N; ++i) {
+    rads[i] = deg2rad(degs[i]);
+  }
+  return rads;
+}
+
+/// @param rads output of size values, it can be the same array as degs
+inline void deg2rad(const double * degs, const std::size_t size, double * rads)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    rads[i] = deg2rad(degs[i]);
+  }
+}
+
+template <std::size_t N>
+constexpr std::array<double, N> rad2deg(const std::array<double, N> & rads)
+{
+  std::array<double, N> degs{};
+  for (std::size_t i = 0; i < N; ++i) {
+    degs[i] = rad2deg(rads[i]);
+  }
+  return degs;
+}
+
+/// @param degs output of size values, it can be the same array as rads
+inline void rad2deg(const double * rads, const std::size_t size, double * degs)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    degs[i] = rad2deg(rads[i]);
+  }
+}
+
+template <std::size_t N>
+constexpr std::array<double, N> kmph2mps(const std::array<double, N> & kmphs)
+{
+  std::array<double, N> mpss{};
+  for (std::size_t i = 0; i < N; ++i) {
+    mpss[i] = kmph2mps(kmphs[i]);
+  }
+  return mpss;
+}
+
+/// @param mpss output of size values, it can be the same array as kmphs
+inline void kmph2mps(const double * kmphs, const std::size_t size, double * mpss)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    mpss[i] = kmph2mps(kmphs[i]);
+  }
+}
+
+template <std::size_t N>
+constexpr std::array<double, N> mps2kmph(const std::array<double, N> & mpss)
+{
+  std::array<double, N> kmphs{};
+  for (std::size_t i = 0; i < N; ++i) {
+    kmphs[i] = mps2kmph(mpss[i]);
+  }
+  return kmphs;
+}
+
+/// @param kmphs output of size values, it can be the same array as mpss
+inline void mps2kmph(const double * mpss, const std::size_t size, double * kmphs)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    kmphs[i] = mps2kmph(mpss[i]);
+  }
+}
 }  // namespace autoware_utils_math
 
 #endif  // AUTOWARE_UTILS_MATH__UNIT_CONVERSION_HPP_
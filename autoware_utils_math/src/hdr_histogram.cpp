@@ -0,0 +1,332 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/hdr_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_math
+{
+
+namespace
+{
+constexpr std::uint8_t encoding_magic = 'H';
+constexpr std::uint8_t encoding_version = 1;
+
+int bit_length(std::uint64_t value)
+{
+  int length = 0;
+  for (; value != 0; value >>= 1) {
+    ++length;
+  }
+  return length;
+}
+
+void write_varint(std::vector<std::uint8_t> & bytes, std::uint64_t value)
+{
+  while (value >= 0x80) {
+    bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+void write_double(std::vector<std::uint8_t> & bytes, const double value)
+{
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i) {
+    bytes.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+  }
+}
+
+// reads the encoded fields in order, and throws if the bytes end early
+class Reader
+{
+public:
+  explicit Reader(const std::vector<std::uint8_t> & bytes) : bytes_(bytes) {}
+
+  bool done() const { return position_ == bytes_.size(); }
+
+  std::uint8_t byte()
+  {
+    if (done()) {
+      throw std::invalid_argument("the encoded histogram is truncated.");
+    }
+    return bytes_[position_++];
+  }
+
+  std::uint64_t varint()
+  {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const std::uint8_t b = byte();
+      value |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        return value;
+      }
+    }
+    throw std::invalid_argument("the encoded histogram has an invalid integer.");
+  }
+
+  double real()
+  {
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+      bits |= static_cast<std::uint64_t>(byte()) << (8 * i);
+    }
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+private:
+  const std::vector<std::uint8_t> & bytes_;
+  std::size_t position_ = 0;
+};
+}  // namespace
+
+HdrHistogram::HdrHistogram(double highest_value, int significant_digits, double resolution)
+: HdrHistogram(Units{to_units(highest_value, resolution)}, significant_digits, resolution)
+{
+}
+
+std::uint64_t HdrHistogram::to_units(double highest_value, double resolution)
+{
+  if (!(resolution > 0.0 && std::isfinite(resolution))) {
+    throw std::invalid_argument("resolution must be positive.");
+  }
+  const double highest = std::ceil(highest_value / resolution);
+  if (!(2.0 <= highest && highest <= 1e18)) {
+    throw std::invalid_argument("highest value must be in [2, 1e18] times the resolution.");
+  }
+  return static_cast<std::uint64_t>(highest);
+}
+
+HdrHistogram::HdrHistogram(Units highest, int significant_digits, double resolution)
+: significant_digits_(significant_digits), resolution_(resolution), highest_(highest.value)
+{
+  if (!(1 <= significant_digits && significant_digits <= 5)) {
+    throw std::invalid_argument("significant digits must be in [1, 5].");
+  }
+  if (!(resolution > 0.0 && 2 <= highest_ && static_cast<double>(highest_) <= 1e18)) {
+    throw std::invalid_argument("the range of the histogram is invalid.");
+  }
+
+  // sub-buckets enough for a relative error of 10^-digits in the upper half of each bucket
+  std::uint64_t largest_single_unit = 2;
+  for (int i = 0; i < significant_digits; ++i) {
+    largest_single_unit *= 10;
+  }
+  const int sub_bucket_count_magnitude = bit_length(largest_single_unit - 1);
+  const std::uint64_t sub_bucket_count = std::uint64_t{1} << sub_bucket_count_magnitude;
+  sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+  sub_bucket_half_count_ = sub_bucket_count / 2;
+  sub_bucket_mask_ = sub_bucket_count - 1;
+
+  std::size_t bucket_count = 1;
+  for (std::uint64_t smallest_untrackable = sub_bucket_count; smallest_untrackable <= highest_;
+       smallest_untrackable <<= 1) {
+    ++bucket_count;
+  }
+  counts_.assign((bucket_count + 1) * sub_bucket_half_count_, 0);
+}
+
+std::size_t HdrHistogram::index_of(std::uint64_t value) const
+{
+  const int bucket_index =
+    bit_length(value | sub_bucket_mask_) - (sub_bucket_half_count_magnitude_ + 1);
+  const std::uint64_t sub_bucket_index = value >> bucket_index;
+  return (static_cast<std::size_t>(bucket_index + 1) << sub_bucket_half_count_magnitude_) +
+         (sub_bucket_index - sub_bucket_half_count_);
+}
+
+std::uint64_t HdrHistogram::highest_equivalent(std::size_t index) const
+{
+  int bucket_index = static_cast<int>(index >> sub_bucket_half_count_magnitude_) - 1;
+  std::uint64_t sub_bucket_index = (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+  if (bucket_index < 0) {
+    sub_bucket_index -= sub_bucket_half_count_;
+    bucket_index = 0;
+  }
+  return (sub_bucket_index << bucket_index) + (std::uint64_t{1} << bucket_index) - 1;
+}
+
+void HdrHistogram::record(double value, std::uint64_t count)
+{
+  if (count == 0) {
+    return;
+  }
+  value = value > 0.0 ? value : 0.0;
+  const double units = value / resolution_;
+  std::uint64_t unit_value = highest_;
+  if (units > static_cast<double>(highest_)) {
+    saturated_ += count;
+  } else {
+    unit_value = static_cast<std::uint64_t>(std::llround(units));
+  }
+  counts_[index_of(unit_value)] += count;
+
+  min_ = count_ == 0 ? value : std::min(min_, value);
+  max_ = count_ == 0 ? value : std::max(max_, value);
+  sum_ += value * static_cast<double>(count);
+  count_ += count;
+}
+
+double HdrHistogram::quantile(double probability) const
+{
+  if (count_ == 0) {
+    return 0.0;
+  }
+  const double target = std::ceil(std::clamp(probability, 0.0, 1.0) * static_cast<double>(count_));
+  const auto rank = std::max<std::uint64_t>(static_cast<std::uint64_t>(target), 1);
+  std::uint64_t cumulative = 0;
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    cumulative += counts_[i];
+    if (rank <= cumulative) {
+      const double value = static_cast<double>(highest_equivalent(i)) * resolution_;
+      return std::clamp(value, min_, max_);
+    }
+  }
+  return max_;
+}
+
+void HdrHistogram::merge(const HdrHistogram & other)
+{
+  if (
+    other.significant_digits_ != significant_digits_ || other.resolution_ != resolution_ ||
+    other.highest_ != highest_) {
+    throw std::invalid_argument("the histograms to merge have different parameters.");
+  }
+  if (other.count_ == 0) {
+    return;
+  }
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+  max_ = count_ == 0 ? other.max_ : std::max(max_, other.max_);
+  sum_ += other.sum_;
+  count_ += other.count_;
+  saturated_ += other.saturated_;
+}
+
+void HdrHistogram::reset()
+{
+  std::fill(counts_.begin(), counts_.end(), 0);
+  count_ = 0;
+  saturated_ = 0;
+  sum_ = 0.0;
+  min_ = 0.0;
+  max_ = 0.0;
+}
+
+double HdrHistogram::highest_value() const
+{
+  return static_cast<double>(highest_) * resolution_;
+}
+
+std::vector<std::uint8_t> HdrHistogram::encode() const
+{
+  std::vector<std::uint8_t> bytes{
+    encoding_magic, encoding_version, static_cast<std::uint8_t>(significant_digits_)};
+  write_double(bytes, resolution_);
+  write_varint(bytes, highest_);
+  write_varint(bytes, count_);
+  write_varint(bytes, saturated_);
+  write_double(bytes, sum_);
+  write_double(bytes, min_);
+  write_double(bytes, max_);
+
+  // a count n is written as 2n and a run of n empty buckets as 2n - 1, the trailing run is omitted
+  std::uint64_t zeros = 0;
+  for (const auto count : counts_) {
+    if (count == 0) {
+      ++zeros;
+      continue;
+    }
+    if (zeros != 0) {
+      write_varint(bytes, 2 * zeros - 1);
+      zeros = 0;
+    }
+    write_varint(bytes, 2 * count);
+  }
+  return bytes;
+}
+
+HdrHistogram HdrHistogram::decode(const std::vector<std::uint8_t> & bytes)
+{
+  Reader reader(bytes);
+  if (reader.byte() != encoding_magic || reader.byte() != encoding_version) {
+    throw std::invalid_argument("the bytes are not an encoded histogram.");
+  }
+  const int significant_digits = reader.byte();
+  const double resolution = reader.real();
+  const std::uint64_t highest = reader.varint();
+  HdrHistogram histogram(Units{highest}, significant_digits, resolution);
+  histogram.count_ = reader.varint();
+  histogram.saturated_ = reader.varint();
+  histogram.sum_ = reader.real();
+  histogram.min_ = reader.real();
+  histogram.max_ = reader.real();
+
+  std::size_t index = 0;
+  std::uint64_t total = 0;
+  while (!reader.done()) {
+    const std::uint64_t value = reader.varint();
+    const std::uint64_t length = value % 2 == 0 ? 1 : (value + 1) / 2;
+    if (histogram.counts_.size() - index < length) {
+      throw std::invalid_argument("the encoded histogram has too many buckets.");
+    }
+    if (value % 2 == 0) {
+      histogram.counts_[index] = value / 2;
+      total += value / 2;
+    }
+    index += length;
+  }
+  if (total != histogram.count_) {
+    throw std::invalid_argument("the encoded histogram has inconsistent counts.");
+  }
+  return histogram;
+}
+
+std::vector<std::pair<std::string, std::string>> HdrHistogram::to_key_values(
+  const std::string & prefix) const
+{
+  const auto to_string = [](const double value) {
+    std::ostringstream ss;
+    ss << value;
+    return ss.str();
+  };
+  return {
+    {prefix + "count", std::to_string(count_)},
+    {prefix + "min", to_string(min())},
+    {prefix + "mean", to_string(mean())},
+    {prefix + "p50", to_string(quantile(0.5))},
+    {prefix + "p90", to_string(quantile(0.9))},
+    {prefix + "p99", to_string(quantile(0.99))},
+    {prefix + "p99.9", to_string(quantile(0.999))},
+    {prefix + "max", to_string(max())},
+  };
+}
+
+}  // namespace autoware_utils_math
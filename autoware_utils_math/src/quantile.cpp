@@ -0,0 +1,118 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/quantile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace autoware_utils_math
+{
+
+P2Quantile::P2Quantile(double probability) : probability_(probability)
+{
+  if (!(0.0 < probability && probability < 1.0)) {
+    throw std::invalid_argument("probability must be in (0, 1).");
+  }
+  const double p = probability;
+  positions_ = {0.0, 1.0, 2.0, 3.0, 4.0};
+  desired_positions_ = {0.0, 2.0 * p, 4.0 * p, 2.0 + 2.0 * p, 4.0};
+  increments_ = {0.0, p / 2.0, p, (1.0 + p) / 2.0, 1.0};
+}
+
+void P2Quantile::add(double value)
+{
+  // the first values are kept sorted as the initial heights of the markers
+  if (count_ < heights_.size()) {
+    heights_[count_] = value;
+    ++count_;
+    std::sort(heights_.begin(), heights_.begin() + count_);
+    return;
+  }
+  ++count_;
+
+  // cell of the value, extending the extreme markers if it is out of them
+  std::size_t k = 0;
+  if (value < heights_[0]) {
+    heights_[0] = value;
+  } else if (value >= heights_[4]) {
+    heights_[4] = value;
+    k = 3;
+  } else {
+    while (value >= heights_[k + 1]) {
+      ++k;
+    }
+  }
+  for (std::size_t i = k + 1; i < positions_.size(); ++i) {
+    positions_[i] += 1.0;
+  }
+  for (std::size_t i = 0; i < desired_positions_.size(); ++i) {
+    desired_positions_[i] += increments_[i];
+  }
+
+  // move the middle markers toward their desired positions by one at most
+  for (std::size_t i = 1; i < 4; ++i) {
+    const double d = desired_positions_[i] - positions_[i];
+    if (
+      (d >= 1.0 && positions_[i + 1] - positions_[i] > 1.0) ||
+      (d <= -1.0 && positions_[i - 1] - positions_[i] < -1.0)) {
+      const double direction = d > 0.0 ? 1.0 : -1.0;
+      const double height = parabolic(i, direction);
+      if (heights_[i - 1] < height && height < heights_[i + 1]) {
+        heights_[i] = height;
+      } else {
+        heights_[i] = linear(i, direction);
+      }
+      positions_[i] += direction;
+    }
+  }
+}
+
+double P2Quantile::quantile() const
+{
+  if (count_ == 0) {
+    return 0.0;
+  }
+  if (count_ <= heights_.size()) {
+    // exact quantile with a linear interpolation between the sorted values
+    const double rank = probability_ * static_cast<double>(count_ - 1);
+    const auto lower = static_cast<std::size_t>(rank);
+    const std::size_t upper = std::min(lower + 1, count_ - 1);
+    const double t = rank - static_cast<double>(lower);
+    return heights_[lower] + t * (heights_[upper] - heights_[lower]);
+  }
+  return heights_[2];
+}
+
+double P2Quantile::parabolic(std::size_t i, double direction) const
+{
+  const double n_prev = positions_[i - 1];
+  const double n = positions_[i];
+  const double n_next = positions_[i + 1];
+  const double q_prev = heights_[i - 1];
+  const double q = heights_[i];
+  const double q_next = heights_[i + 1];
+  return q + direction / (n_next - n_prev) *
+               ((n - n_prev + direction) * (q_next - q) / (n_next - n) +
+                (n_next - n - direction) * (q - q_prev) / (n - n_prev));
+}
+
+double P2Quantile::linear(std::size_t i, double direction) const
+{
+  const std::size_t j = direction > 0.0 ? i + 1 : i - 1;
+  return heights_[i] + direction * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+}
+
+}  // namespace autoware_utils_math
@@ -14,9 +14,41 @@
 
 #include "autoware_utils_math/sin_table.hpp"
 
+#include "autoware_utils_math/constants.hpp"
+
+#include <array>
+
 namespace autoware_utils_math
 {
 
+namespace
+{
+// Taylor series, accurate to double precision on [0, pi/2]
+constexpr double sin_series_impl(const double x)
+{
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 14; ++n) {
+    term *= -x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr std::array<float, compact_sin_table_size> make_compact_sin_table_impl()
+{
+  std::array<float, compact_sin_table_size> table{};
+  for (size_t i = 0; i < compact_sin_table_size; ++i) {
+    const double radian = (pi / 2.0) * static_cast<double>(i) / compact_discrete_arcs_num_90;
+    table[i] = static_cast<float>(sin_series_impl(radian));
+  }
+  return table;
+}
+}  // namespace
+
+constexpr std::array<float, compact_sin_table_size> g_compact_sin_table =
+  make_compact_sin_table_impl();
+
 const float g_sin_table[sin_table_size] = {
   0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f,
   0.0001917475973107f, 0.0002396844958122f, 0.0002876213937629f, 0.0003355582910527f,
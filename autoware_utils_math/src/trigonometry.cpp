@@ -17,14 +17,154 @@
 #include "autoware_utils_math/constants.hpp"
 #include "autoware_utils_math/sin_table.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <utility>
 
 namespace autoware_utils_math
 {
 
+namespace
+{
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+constexpr float radian_to_compact_arc =
+  (2.f / static_cast<float>(autoware_utils_math::pi)) * compact_discrete_arcs_num_90;
+
+// linear interpolation of g_compact_sin_table between the index idx of the turn and the next one
+float compact_sin_at_impl(const std::uint32_t idx, const float t)
+{
+  constexpr auto n90 = static_cast<std::uint32_t>(compact_discrete_arcs_num_90);
+  const std::uint32_t quadrant = idx / n90;
+  const std::uint32_t r = idx % n90;
+  // the table is walked backward in the odd quadrants
+  const std::uint32_t i0 = (quadrant & 1u) ? n90 - r : r;
+  const std::uint32_t i1 = (quadrant & 1u) ? n90 - r - 1u : r + 1u;
+  const float sign = (quadrant & 2u) ? -1.f : 1.f;
+  const float v0 = g_compact_sin_table[i0];
+  const float v1 = g_compact_sin_table[i1];
+  return sign * (v0 + t * (v1 - v0));
+}
+
+// the angle is shifted by some quarter turns
+float compact_sin_impl(const float radian, const std::uint32_t quarter_turns)
+{
+  constexpr auto n90 = static_cast<std::uint32_t>(compact_discrete_arcs_num_90);
+  const float position = radian * radian_to_compact_arc;
+  // floor, as std::floor() is not vectorized without the strict math flags
+  const int truncated = static_cast<int>(position);
+  const int index = truncated - (position < static_cast<float>(truncated) ? 1 : 0);
+  const float t = position - static_cast<float>(index);
+  return compact_sin_at_impl(static_cast<std::uint32_t>(index) + quarter_turns * n90, t);
+}
+
+// the index is the high bits of the binary angle and the interpolation ratio the low bits
+float compact_sin_impl(const BinaryAngle angle, const std::uint32_t quarter_turns)
+{
+  constexpr auto n90 = static_cast<std::uint32_t>(compact_discrete_arcs_num_90);
+  constexpr int index_bits = 12;
+  static_assert(4 * compact_discrete_arcs_num_90 == (1u << index_bits));
+  constexpr int fraction_bits = 32 - index_bits;
+  constexpr float fraction_scale = 1.f / static_cast<float>(1u << fraction_bits);
+  const std::uint32_t index = angle.raw() >> fraction_bits;
+  const float t = static_cast<float>(angle.raw() & ((1u << fraction_bits) - 1u)) * fraction_scale;
+  return compact_sin_at_impl(index + quarter_turns * n90, t);
+}
+
+float sin_impl(const float radian)
+{
+  return compact_sin_impl(radian, 0u);
+}
+
+float cos_impl(const float radian)
+{
+  return compact_sin_impl(radian, 1u);
+}
+
+void sin_and_cos_impl(const float radian, float & sin, float & cos)
+{
+  sin = compact_sin_impl(radian, 0u);
+  cos = compact_sin_impl(radian, 1u);
+}
+#else
+// the constant folded in the scalar sin_and_cos(), whose rounding differs from the two products
+// of the scalar sin()
+constexpr float radian_to_arc =
+  (180.f / static_cast<float>(autoware_utils_math::pi)) * (discrete_arcs_num_360 / 360.f);
+
+// same index as ((round(degree) % 360 + 360) % 360) as discrete_arcs_num_360 is a power of 2
+std::uint32_t arc_index_impl(const float degree)
+{
+  static_assert((discrete_arcs_num_360 & (discrete_arcs_num_360 - 1)) == 0);
+  static_assert(discrete_arcs_num_360 == 4 * discrete_arcs_num_90);
+  // std::round() is not vectorized, so the truncation is moved away from 0 at the half steps,
+  // which is the same rounding as the fraction is exact
+  const int truncated = static_cast<int>(degree);
+  const float fraction = degree - static_cast<float>(truncated);
+  const int rounded = truncated + (fraction >= 0.5f ? 1 : 0) - (fraction <= -0.5f ? 1 : 0);
+  return static_cast<std::uint32_t>(rounded) &
+         static_cast<std::uint32_t>(discrete_arcs_num_360 - 1);
+}
+
+// nearest index of a binary angle, a shift as discrete_arcs_num_360 is a power of 2
+std::uint32_t arc_index_impl(const BinaryAngle angle)
+{
+  constexpr int shift = 32 - 17;
+  static_assert(discrete_arcs_num_360 == (1u << 17));
+  return ((angle.raw() + (1u << (shift - 1))) >> shift) &
+         static_cast<std::uint32_t>(discrete_arcs_num_360 - 1);
+}
+
+// the table is read at r or discrete_arcs_num_90 - r, r being the index in the quadrant
+float sin_from_arc_index_impl(const std::uint32_t idx)
+{
+  constexpr auto n90 = static_cast<std::uint32_t>(discrete_arcs_num_90);
+  const std::uint32_t quadrant = idx / n90;
+  const std::uint32_t r = idx % n90;
+  const std::uint32_t i = (quadrant & 1u) ? n90 - r : r;
+  const float sign = (quadrant & 2u) ? -1.f : 1.f;
+  return sign * g_sin_table[i];
+}
+
+float cos_from_arc_index_impl(const std::uint32_t idx)
+{
+  constexpr auto n90 = static_cast<std::uint32_t>(discrete_arcs_num_90);
+  const std::uint32_t quadrant = idx / n90;
+  const std::uint32_t r = idx % n90;
+  const std::uint32_t i = (quadrant & 1u) ? r : n90 - r;
+  const float sign = ((quadrant + 1u) & 2u) ? -1.f : 1.f;
+  return sign * g_sin_table[i];
+}
+
+float sin_impl(const float radian)
+{
+  // same products as the scalar sin(), so that the index is rounded from the same value
+  return sin_from_arc_index_impl(arc_index_impl(
+    radian * (180.f / static_cast<float>(autoware_utils_math::pi)) *
+    (discrete_arcs_num_360 / 360.f)));
+}
+
+float cos_impl(const float radian)
+{
+  // same rounding as the scalar cos(), which is sin() shifted by a quarter turn
+  return sin_impl(radian + static_cast<float>(autoware_utils_math::pi) / 2.f);
+}
+
+void sin_and_cos_impl(const float radian, float & sin, float & cos)
+{
+  const std::uint32_t idx = arc_index_impl(radian * radian_to_arc);
+  sin = sin_from_arc_index_impl(idx);
+  cos = cos_from_arc_index_impl(idx);
+}
+#endif
+}  // namespace
+
 float sin(float radian)
 {
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  return sin_impl(radian);
+#else
   float degree = radian * (180.f / static_cast<float>(autoware_utils_math::pi)) *
                  (discrete_arcs_num_360 / 360.f);
   size_t idx =
@@ -43,15 +183,25 @@ float sin(float radian)
   }
 
   return mul * g_sin_table[idx];
+#endif
 }
 
 float cos(float radian)
 {
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  return cos_impl(radian);
+#else
   return sin(radian + static_cast<float>(autoware_utils_math::pi) / 2.f);
+#endif
 }
 
 std::pair<float, float> sin_and_cos(float radian)
 {
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  std::pair<float, float> result;
+  sin_and_cos_impl(radian, result.first, result.second);
+  return result;
+#else
   constexpr float tmp =
     (180.f / static_cast<float>(autoware_utils_math::pi)) * (discrete_arcs_num_360 / 360.f);
   const float degree = radian * tmp;
@@ -71,6 +221,60 @@ std::pair<float, float> sin_and_cos(float radian)
     idx = 4 * discrete_arcs_num_90 - idx;
     return {-g_sin_table[idx], g_sin_table[discrete_arcs_num_90 - idx]};
   }
+#endif
+}
+
+float sin(BinaryAngle angle)
+{
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  return compact_sin_impl(angle, 0u);
+#else
+  return sin_from_arc_index_impl(arc_index_impl(angle));
+#endif
+}
+
+float cos(BinaryAngle angle)
+{
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  return compact_sin_impl(angle, 1u);
+#else
+  return cos_from_arc_index_impl(arc_index_impl(angle));
+#endif
+}
+
+std::pair<float, float> sin_and_cos(BinaryAngle angle)
+{
+#ifdef AUTOWARE_UTILS_MATH_COMPACT_SIN_TABLE
+  return {compact_sin_impl(angle, 0u), compact_sin_impl(angle, 1u)};
+#else
+  const std::uint32_t idx = arc_index_impl(angle);
+  return {sin_from_arc_index_impl(idx), cos_from_arc_index_impl(idx)};
+#endif
+}
+
+void sin(const float * radians, std::size_t size, float * sins)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    sins[i] = sin_impl(radians[i]);
+  }
+}
+
+void cos(const float * radians, std::size_t size, float * coss)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    coss[i] = cos_impl(radians[i]);
+  }
+}
+
+void sin_and_cos(const float * radians, std::size_t size, float * sins, float * coss)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    float s;
+    float c;
+    sin_and_cos_impl(radians[i], s, c);
+    sins[i] = s;
+    coss[i] = c;
+  }
 }
 
 // This code is modified from a part of the OpenCV project
@@ -126,4 +330,77 @@ float opencv_fast_atan2(float dy, float dx)
   return a;
 }
 
+void opencv_fast_atan2(const float * dy, const float * dx, std::size_t size, float * angles)
+{
+  using detail_fast_atan2::atan2_DBL_EPSILON;
+  using detail_fast_atan2::atan2_p1;
+  using detail_fast_atan2::atan2_p3;
+  using detail_fast_atan2::atan2_p5;
+  using detail_fast_atan2::atan2_p7;
+  // same operations as the scalar version, with selects instead of branches
+  for (std::size_t i = 0; i < size; ++i) {
+    const float ax = std::abs(dx[i]);
+    const float ay = std::abs(dy[i]);
+    const float c = std::min(ax, ay) / (std::max(ax, ay) + atan2_DBL_EPSILON);
+    const float c2 = c * c;
+    const float p = (((atan2_p7 * c2 + atan2_p5) * c2 + atan2_p3) * c2 + atan2_p1) * c;
+    // the selects are on constants as GCC does not if-convert the arithmetic of the branches
+    float a = (ax >= ay ? 0.f : 90.f) + (ax >= ay ? 1.f : -1.f) * p;
+    a = (dx[i] < 0 ? 180.f : 0.f) + (dx[i] < 0 ? -1.f : 1.f) * a;
+    a = (dy[i] < 0 ? 360.f : 0.f) + (dy[i] < 0 ? -1.f : 1.f) * a;
+    angles[i] = a * autoware_utils_math::pi / 180.f;
+  }
+}
+
+namespace
+{
+// minimax odd polynomial of atan on [0, 1], in powers of x^2
+constexpr double atan_c1 = 0.99999998056026069;
+constexpr double atan_c3 = -0.33333180376344426;
+constexpr double atan_c5 = 0.19996436800505781;
+constexpr double atan_c7 = -0.14247222561423646;
+constexpr double atan_c9 = 0.10878009360834249;
+constexpr double atan_c11 = -0.082137601025264285;
+constexpr double atan_c13 = 0.055028074286463336;
+constexpr double atan_c15 = -0.028490749641319234;
+constexpr double atan_c17 = 0.0095673260688609068;
+constexpr double atan_c19 = -0.0015092999810956287;
+
+double fast_atan2_impl(const double dy, const double dx)
+{
+  const double ax = std::abs(dx);
+  const double ay = std::abs(dy);
+  // the denominator is not 0 for (0, 0), where the angle is then 0
+  const double max = std::max(std::max(ax, ay), std::numeric_limits<double>::denorm_min());
+  const double c = std::min(ax, ay) / max;
+  const double c2 = c * c;
+  double p = atan_c19;
+  p = p * c2 + atan_c17;
+  p = p * c2 + atan_c15;
+  p = p * c2 + atan_c13;
+  p = p * c2 + atan_c11;
+  p = p * c2 + atan_c9;
+  p = p * c2 + atan_c7;
+  p = p * c2 + atan_c5;
+  p = p * c2 + atan_c3;
+  p = (p * c2 + atan_c1) * c;
+  // the selects are on constants as GCC does not if-convert the arithmetic of the branches
+  double a = (ax >= ay ? 0.0 : pi / 2.0) + (ax >= ay ? 1.0 : -1.0) * p;
+  a = (dx < 0.0 ? pi : 0.0) + (dx < 0.0 ? -1.0 : 1.0) * a;
+  return (dy < 0.0 ? -1.0 : 1.0) * a;
+}
+}  // namespace
+
+double fast_atan2(double dy, double dx)
+{
+  return fast_atan2_impl(dy, dx);
+}
+
+void fast_atan2(const double * dy, const double * dx, std::size_t size, double * angles)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    angles[i] = fast_atan2_impl(dy[i], dx[i]);
+  }
+}
+
 }  // namespace autoware_utils_math
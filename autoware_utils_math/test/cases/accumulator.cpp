@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 TEST(TestAccumulator, Case1)
 {
   autoware_utils_math::Accumulator a;
@@ -39,3 +44,106 @@ TEST(TestAccumulator, Case2)
   EXPECT_DOUBLE_EQ(a.max(), 10.0);
   EXPECT_DOUBLE_EQ(a.mean(), 5.5);
 }
+
+TEST(TestAccumulator, Variance)
+{
+  autoware_utils_math::Accumulator a;
+  EXPECT_DOUBLE_EQ(a.variance(), 0.0);
+  for (const double value : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0}) {
+    a.add(value + 1e9);  // the Welford update does not cancel with a large mean
+  }
+  EXPECT_DOUBLE_EQ(a.mean(), 5.0 + 1e9);
+  EXPECT_DOUBLE_EQ(a.variance(), 4.0);
+  EXPECT_DOUBLE_EQ(a.stddev(), 2.0);
+}
+
+TEST(TestAccumulator, Merge)
+{
+  autoware_utils_math::Accumulator all;
+  autoware_utils_math::Accumulator a;
+  autoware_utils_math::Accumulator b;
+  autoware_utils_math::Accumulator empty;
+  for (int i = 0; i < 100; ++i) {
+    const double value = (i * 37) % 101 * 0.1;
+    all.add(value);
+    (i < 30 ? a : b).add(value);
+  }
+  a.merge(empty);
+  empty.merge(a);
+  EXPECT_EQ(empty.count(), 30u);
+  a.merge(b);
+  EXPECT_EQ(a.count(), all.count());
+  EXPECT_DOUBLE_EQ(a.min(), all.min());
+  EXPECT_DOUBLE_EQ(a.max(), all.max());
+  EXPECT_DOUBLE_EQ(a.mean(), all.mean());
+  EXPECT_DOUBLE_EQ(a.variance(), all.variance());
+}
+
+TEST(TestAccumulator, Atomic)
+{
+  autoware_utils_math::AtomicAccumulator a(4.5);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&a] {
+      for (int i = 0; i < 10000; ++i) {
+        a.add(i % 10);
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(a.count(), 40000u);
+  EXPECT_DOUBLE_EQ(a.min(), 0.0);
+  EXPECT_DOUBLE_EQ(a.max(), 9.0);
+  EXPECT_DOUBLE_EQ(a.mean(), 4.5);
+  EXPECT_DOUBLE_EQ(a.variance(), 8.25);
+}
+
+TEST(TestAccumulator, Window)
+{
+  EXPECT_THROW(autoware_utils_math::WindowAccumulator<double>(0), std::invalid_argument);
+
+  constexpr size_t window_size = 7;
+  autoware_utils_math::WindowAccumulator<double> window(window_size);
+  EXPECT_EQ(window.count(), 0u);
+  std::vector<double> values;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(std::sin(i * 0.7) * 10.0 + i * 0.1);
+    window.add(values.back());
+
+    autoware_utils_math::Accumulator<double> expected;
+    const size_t begin = values.size() > window_size ? values.size() - window_size : 0;
+    for (size_t j = begin; j < values.size(); ++j) {
+      expected.add(values[j]);
+    }
+    EXPECT_EQ(window.count(), expected.count());
+    EXPECT_DOUBLE_EQ(window.min(), expected.min());
+    EXPECT_DOUBLE_EQ(window.max(), expected.max());
+    EXPECT_NEAR(window.mean(), expected.mean(), 1e-12);
+    EXPECT_NEAR(window.variance(), expected.variance(), 1e-9);
+  }
+}
+
+TEST(TestAccumulator, Ewma)
+{
+  EXPECT_THROW(autoware_utils_math::EwmaAccumulator<double>(0.0), std::invalid_argument);
+  EXPECT_THROW(autoware_utils_math::EwmaAccumulator<double>(1.5), std::invalid_argument);
+
+  autoware_utils_math::EwmaAccumulator<double> a(0.5);
+  a.add(2.0);
+  EXPECT_DOUBLE_EQ(a.mean(), 2.0);
+  EXPECT_DOUBLE_EQ(a.variance(), 0.0);
+  a.add(4.0);
+  EXPECT_DOUBLE_EQ(a.mean(), 3.0);
+  EXPECT_DOUBLE_EQ(a.variance(), 1.0);
+
+  // the statistics follow a change of the values
+  autoware_utils_math::EwmaAccumulator<double> b(0.1);
+  for (int i = 0; i < 1000; ++i) {
+    b.add(i < 500 ? 1.0 : 5.0);
+  }
+  EXPECT_NEAR(b.mean(), 5.0, 1e-9);
+  EXPECT_NEAR(b.stddev(), 0.0, 1e-9);
+  EXPECT_EQ(b.count(), 1000u);
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/binary_angle.hpp"
+
+#include "autoware_utils_math/constants.hpp"
+#include "autoware_utils_math/normalization.hpp"
+#include "autoware_utils_math/trigonometry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using autoware_utils_math::BinaryAngle;
+using autoware_utils_math::pi;
+
+TEST(TestBinaryAngle, Conversion)
+{
+  constexpr double resolution = 2.0 * pi / BinaryAngle::units_per_turn;
+  EXPECT_EQ(BinaryAngle::from_radian(0.0).raw(), 0u);
+  EXPECT_EQ(BinaryAngle::from_radian(pi / 2).raw(), 1u << 30);
+  EXPECT_EQ(BinaryAngle::from_radian(-pi / 2).raw(), 3u << 30);
+  EXPECT_EQ(BinaryAngle::from_degree(180.0).raw(), 1u << 31);
+  EXPECT_DOUBLE_EQ(BinaryAngle::from_raw(1u << 31).to_radian(), -pi);
+  EXPECT_DOUBLE_EQ(BinaryAngle::from_raw(1u << 30).to_degree(), 90.0);
+
+  // the conversion normalizes the angle
+  for (double radian = -20.0; radian < 20.0; radian += 0.37) {
+    const auto angle = BinaryAngle::from_radian(radian);
+    EXPECT_NEAR(
+      angle.to_radian(), autoware_utils_math::normalize_radian(radian), resolution + 1e-15);
+    EXPECT_NEAR(
+      angle.to_degree(), autoware_utils_math::normalize_degree(radian * 180.0 / pi), 1e-6);
+  }
+}
+
+TEST(TestBinaryAngle, Arithmetic)
+{
+  constexpr auto quarter = BinaryAngle::from_raw(1u << 30);
+  static_assert(quarter * 4 == BinaryAngle());
+  static_assert(quarter + quarter * 3 == BinaryAngle());
+  static_assert(BinaryAngle() - quarter == quarter * 3);
+  static_assert(-quarter == quarter * -1);
+  static_assert(quarter != -quarter);
+
+  auto angle = BinaryAngle::from_degree(170.0);
+  angle += BinaryAngle::from_degree(20.0);
+  EXPECT_NEAR(angle.to_degree(), -170.0, 1e-6);
+  angle -= BinaryAngle::from_degree(30.0);
+  EXPECT_NEAR(angle.to_degree(), 160.0, 1e-6);
+}
+
+TEST(TestBinaryAngle, SinCos)
+{
+  for (double radian = -10.0; radian < 10.0; radian += 0.01) {
+    const auto angle = BinaryAngle::from_radian(radian);
+    const auto [sin, cos] = autoware_utils_math::sin_and_cos(angle);
+    constexpr double eps = 3e-5;
+    EXPECT_NEAR(autoware_utils_math::sin(angle), std::sin(radian), eps);
+    EXPECT_NEAR(autoware_utils_math::cos(angle), std::cos(radian), eps);
+    EXPECT_NEAR(sin, std::sin(radian), eps);
+    EXPECT_NEAR(cos, std::cos(radian), eps);
+  }
+}
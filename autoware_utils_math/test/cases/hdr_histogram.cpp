@@ -0,0 +1,135 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/hdr_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(TestHdrHistogram, Invalid)
+{
+  using autoware_utils_math::HdrHistogram;
+  EXPECT_THROW(HdrHistogram(1000.0, 0), std::invalid_argument);
+  EXPECT_THROW(HdrHistogram(1000.0, 6), std::invalid_argument);
+  EXPECT_THROW(HdrHistogram(1000.0, 3, 0.0), std::invalid_argument);
+  EXPECT_THROW(HdrHistogram(1.0, 3, 1.0), std::invalid_argument);
+  EXPECT_THROW(HdrHistogram(1000.0).merge(HdrHistogram(2000.0)), std::invalid_argument);
+  EXPECT_THROW(HdrHistogram::decode({1, 2, 3}), std::invalid_argument);
+}
+
+TEST(TestHdrHistogram, Quantiles)
+{
+  autoware_utils_math::HdrHistogram histogram(1000.0, 3, 0.001);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.5), 0.0);
+
+  // latencies in milliseconds with a long tail
+  std::mt19937 generator(0);
+  std::lognormal_distribution<double> distribution(1.0, 1.0);
+  std::vector<double> values;
+  for (int i = 0; i < 100000; ++i) {
+    values.push_back(distribution(generator));
+    histogram.record(values.back());
+  }
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(histogram.count(), values.size());
+  EXPECT_DOUBLE_EQ(histogram.min(), values.front());
+  EXPECT_DOUBLE_EQ(histogram.max(), values.back());
+  EXPECT_DOUBLE_EQ(histogram.quantile(1.0), values.back());
+
+  for (const double probability : {0.01, 0.5, 0.9, 0.99, 0.999}) {
+    const double exact = values[static_cast<size_t>(probability * values.size()) - 1];
+    // the relative error of 10^-3 and the rounding to the resolution
+    EXPECT_NEAR(histogram.quantile(probability), exact, 1e-3 * exact + 1e-3) << probability;
+  }
+}
+
+TEST(TestHdrHistogram, Saturated)
+{
+  autoware_utils_math::HdrHistogram histogram(100.0);
+  histogram.record(-1.0);
+  histogram.record(50.0, 3);
+  histogram.record(1000.0);
+  EXPECT_EQ(histogram.count(), 5u);
+  EXPECT_EQ(histogram.saturated(), 1u);
+  EXPECT_DOUBLE_EQ(histogram.min(), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.2), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.8), 50.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(1.0), 100.0);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 1150.0 / 5.0);
+
+  histogram.reset();
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.9), 0.0);
+}
+
+TEST(TestHdrHistogram, MergeAndEncode)
+{
+  autoware_utils_math::HdrHistogram all(10000.0, 2);
+  autoware_utils_math::HdrHistogram first(10000.0, 2);
+  autoware_utils_math::HdrHistogram second(10000.0, 2);
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(0.0, 20000.0);
+  for (int i = 0; i < 1000; ++i) {
+    const double value = distribution(generator);
+    all.record(value);
+    (i % 3 == 0 ? first : second).record(value);
+  }
+  first.merge(second);
+
+  const auto bytes = first.encode();
+  const auto decoded = autoware_utils_math::HdrHistogram::decode(bytes);
+  const std::vector<const autoware_utils_math::HdrHistogram *> histograms{&first, &decoded};
+  for (const auto * histogram : histograms) {
+    EXPECT_EQ(histogram->count(), all.count());
+    EXPECT_EQ(histogram->saturated(), all.saturated());
+    EXPECT_DOUBLE_EQ(histogram->min(), all.min());
+    EXPECT_DOUBLE_EQ(histogram->max(), all.max());
+    EXPECT_NEAR(histogram->mean(), all.mean(), 1e-9 * all.mean());
+    for (const double probability : {0.0, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+      EXPECT_DOUBLE_EQ(histogram->quantile(probability), all.quantile(probability));
+    }
+  }
+  EXPECT_EQ(decoded.encode(), bytes);
+
+  // the decoded histogram can be merged with the others
+  autoware_utils_math::HdrHistogram merged(10000.0, 2);
+  merged.merge(decoded);
+  EXPECT_EQ(merged.count(), all.count());
+
+  // the truncated bytes are rejected
+  EXPECT_THROW(
+    autoware_utils_math::HdrHistogram::decode({bytes.begin(), bytes.end() - 1}),
+    std::invalid_argument);
+}
+
+TEST(TestHdrHistogram, KeyValues)
+{
+  autoware_utils_math::HdrHistogram histogram(100.0);
+  for (int i = 1; i <= 10; ++i) {
+    histogram.record(i);
+  }
+  const auto key_values = histogram.to_key_values("cycle_time_");
+  ASSERT_EQ(key_values.size(), 8u);
+  EXPECT_EQ(key_values.front().first, "cycle_time_count");
+  EXPECT_EQ(key_values.front().second, "10");
+  EXPECT_EQ(key_values.at(3).first, "cycle_time_p50");
+  EXPECT_EQ(key_values.at(3).second, "5");
+  EXPECT_EQ(key_values.back().second, "10");
+}
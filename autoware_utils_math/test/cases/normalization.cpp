@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <random>
+#include <vector>
 
 // The arguments a and b must be normalized.
 double diff_radian(const double a, const double b)
@@ -118,3 +120,43 @@ TEST(normalization, normalize_radian)  // NOLINT for gtest
     EXPECT_DOUBLE_EQ(normalize_radian(v_max, 0), v_min);
   }
 }
+
+TEST(normalization, normalize_fast)  // NOLINT for gtest
+{
+  using autoware_utils_math::normalize_degree;
+  using autoware_utils_math::normalize_degree_fast;
+  using autoware_utils_math::normalize_radian;
+  using autoware_utils_math::normalize_radian_fast;
+  using autoware_utils_math::pi;
+
+  std::mt19937 generator(0);
+  // the last range is beyond 2^20 turns, where the std::fmod path is taken
+  for (const double range : {10.0, 1e4, 1e8}) {
+    std::uniform_real_distribution<double> distribution(-range, range);
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i) {
+      values.push_back(distribution(generator));
+    }
+    values.push_back(-pi);
+    values.push_back(pi);
+    values.push_back(0.0);
+
+    for (const double min : {-pi, 0.0}) {
+      std::vector<double> normalized(values.size());
+      normalize_radian(values.data(), values.size(), normalized.data(), min);
+      for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(normalize_radian_fast(values[i], min), normalize_radian(values[i], min));
+        EXPECT_EQ(normalized[i], normalize_radian(values[i], min));
+      }
+    }
+
+    for (const double min : {-180.0, 0.0}) {
+      auto normalized = values;  // in place
+      normalize_degree(normalized.data(), normalized.size(), normalized.data(), min);
+      for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(normalize_degree_fast(values[i], min), normalize_degree(values[i], min));
+        EXPECT_EQ(normalized[i], normalize_degree(values[i], min));
+      }
+    }
+  }
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_math/quantile.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+TEST(TestQuantile, Invalid)
+{
+  EXPECT_THROW(autoware_utils_math::P2Quantile(0.0), std::invalid_argument);
+  EXPECT_THROW(autoware_utils_math::P2Quantile(1.0), std::invalid_argument);
+}
+
+TEST(TestQuantile, FewValues)
+{
+  autoware_utils_math::P2Quantile median(0.5);
+  EXPECT_DOUBLE_EQ(median.quantile(), 0.0);
+  for (const double value : {5.0, 1.0, 3.0, 2.0}) {
+    median.add(value);
+  }
+  EXPECT_EQ(median.count(), 4u);
+  EXPECT_DOUBLE_EQ(median.quantile(), 2.5);
+}
+
+TEST(TestQuantile, Distributions)
+{
+  std::mt19937 generator(0);
+  std::exponential_distribution<double> exponential(1.0);
+  std::normal_distribution<double> normal(10.0, 2.0);
+
+  for (const double probability : {0.5, 0.95, 0.99}) {
+    for (int distribution = 0; distribution < 2; ++distribution) {
+      autoware_utils_math::P2Quantile sketch(probability);
+      std::vector<double> values;
+      for (int i = 0; i < 100000; ++i) {
+        values.push_back(distribution == 0 ? exponential(generator) : normal(generator));
+        sketch.add(values.back());
+      }
+      std::sort(values.begin(), values.end());
+      const double exact = values[static_cast<size_t>(probability * (values.size() - 1))];
+      EXPECT_NEAR(sketch.quantile(), exact, 0.02 * exact) << probability << " " << distribution;
+    }
+  }
+}
@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <vector>
 
 template <class T>
@@ -233,3 +236,66 @@ TEST(range, linspace_int)  // NOLINT for gtest
     expect_near_vector(linspace(10, 5, 6), std::vector<double>{10.0, 9.0, 8.0, 7.0, 6.0, 5.0});
   }
 }
+
+TEST(range, views)  // NOLINT for gtest
+{
+  using autoware_utils_math::arange;
+  using autoware_utils_math::arange_view;
+  using autoware_utils_math::linspace;
+  using autoware_utils_math::linspace_view;
+
+  const auto expect_same = [](const auto & view, const auto & vector) {
+    ASSERT_EQ(view.size(), vector.size());
+    ASSERT_EQ(static_cast<size_t>(std::distance(view.begin(), view.end())), vector.size());
+    size_t i = 0;
+    for (const auto value : view) {
+      EXPECT_EQ(value, vector[i]);
+      EXPECT_EQ(view[i], vector[i]);
+      ++i;
+    }
+  };
+  expect_same(arange_view(0.1, 2.0, 0.2), arange(0.1, 2.0, 0.2));
+  expect_same(arange_view(1.0, 0.0, -0.3), arange(1.0, 0.0, -0.3));
+  expect_same(arange_view(3, -4, -2), arange(3, -4, -2));
+  expect_same(arange_view(0.0, 0.0, 1.0), arange(0.0, 0.0, 1.0));
+  expect_same(linspace_view(-1.0, 2.0, 7), linspace(-1.0, 2.0, 7));
+  expect_same(linspace_view(5, 5, 1), linspace(5, 5, 1));
+  expect_same(linspace_view(0.0, 1.0, 0), linspace(0.0, 1.0, 0));
+  EXPECT_THROW(arange_view(0.0, 1.0, 0.0), std::invalid_argument);
+  EXPECT_THROW(arange_view(0.0, 1.0, -0.1), std::invalid_argument);
+
+  // random access with the standard algorithms
+  const auto range = linspace_view(0.0, 10.0, 101);
+  EXPECT_DOUBLE_EQ(range.front(), 0.0);
+  EXPECT_DOUBLE_EQ(range.back(), 10.0);
+  const auto it = std::lower_bound(range.begin(), range.end(), 2.55);
+  EXPECT_EQ(it - range.begin(), 26);
+  EXPECT_DOUBLE_EQ(*(range.end() - 1), 10.0);
+  EXPECT_DOUBLE_EQ(std::accumulate(range.begin(), range.end(), 0.0), 505.0);
+}
+
+TEST(range, constexpr_array)  // NOLINT for gtest
+{
+  using autoware_utils_math::arange;
+  using autoware_utils_math::linspace;
+
+  constexpr auto offsets = linspace<11>(-1.0, 1.0);
+  static_assert(offsets.size() == 11);
+  static_assert(offsets.front() == -1.0 && offsets.back() == 1.0);
+  const auto expected_offsets = linspace(-1.0, 1.0, 11);
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    EXPECT_EQ(offsets[i], expected_offsets[i]);
+  }
+
+  constexpr auto velocities = arange<5>(0.0, 2.5);
+  static_assert(velocities[4] == 10.0);
+  const auto expected_velocities = arange(0.0, 12.5, 2.5);
+  for (size_t i = 0; i < velocities.size(); ++i) {
+    EXPECT_EQ(velocities[i], expected_velocities[i]);
+  }
+
+  constexpr auto indices = arange<4>(3, -2);
+  static_assert(indices[3] == -3);
+  static_assert(linspace<1>(2, 5)[0] == 2.0);
+  static_assert(linspace<0>(2, 5).empty());
+}
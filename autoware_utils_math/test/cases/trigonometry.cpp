@@ -15,10 +15,13 @@
 #include "autoware_utils_math/trigonometry.hpp"
 
 #include "autoware_utils_math/constants.hpp"
+#include "autoware_utils_math/sin_table.hpp"
 
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <random>
 #include <vector>
 
 struct ParamSinCos
@@ -76,6 +79,87 @@ TEST(TestTrigonometry, SinCos)
   }
 }
 
+TEST(TestTrigonometry, SinCosBatch)
+{
+  // random angles, which are rounded to the table from both sides of the half steps
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(
+    -4 * autoware_utils_math::pi, 4 * autoware_utils_math::pi);
+  std::vector<float> radians(100000);
+  for (auto & radian : radians) radian = dist(gen);
+  radians.push_back(-0.85306108f);
+
+  std::vector<float> sins(radians.size());
+  std::vector<float> coss(radians.size());
+  autoware_utils_math::sin(radians.data(), radians.size(), sins.data());
+  autoware_utils_math::cos(radians.data(), radians.size(), coss.data());
+  for (size_t i = 0; i < radians.size(); ++i) {
+    EXPECT_EQ(sins[i], autoware_utils_math::sin(radians[i])) << radians[i];
+    EXPECT_EQ(coss[i], autoware_utils_math::cos(radians[i])) << radians[i];
+  }
+
+  auto values = radians;  // sin in place
+  autoware_utils_math::sin_and_cos(values.data(), values.size(), values.data(), coss.data());
+  for (size_t i = 0; i < radians.size(); ++i) {
+    const auto [sin, cos] = autoware_utils_math::sin_and_cos(radians[i]);
+    EXPECT_EQ(values[i], sin) << radians[i];
+    EXPECT_EQ(coss[i], cos) << radians[i];
+  }
+}
+
+TEST(TestTrigonometry, SinCosBatchHalfSteps)
+{
+  using autoware_utils_math::discrete_arcs_num_360;
+  using autoware_utils_math::pi;
+
+  // the angles at the half steps of the table over 4 turns in both directions and their
+  // neighbouring floats, where the rounding of the index differs the most
+  std::vector<float> radians;
+  const auto turns = static_cast<std::int64_t>(4 * discrete_arcs_num_360);
+  for (std::int64_t k = -turns; k < turns; ++k) {
+    const auto radian = static_cast<float>((k + 0.5) * 2.0 * pi / discrete_arcs_num_360);
+    radians.push_back(std::nextafter(radian, -INFINITY));
+    radians.push_back(radian);
+    radians.push_back(std::nextafter(radian, INFINITY));
+  }
+
+  std::vector<float> sins(radians.size());
+  std::vector<float> coss(radians.size());
+  std::vector<float> pair_sins(radians.size());
+  std::vector<float> pair_coss(radians.size());
+  autoware_utils_math::sin(radians.data(), radians.size(), sins.data());
+  autoware_utils_math::cos(radians.data(), radians.size(), coss.data());
+  autoware_utils_math::sin_and_cos(
+    radians.data(), radians.size(), pair_sins.data(), pair_coss.data());
+
+  // counted so that a regression does not print millions of failures
+  std::size_t mismatches = 0;
+  for (std::size_t i = 0; i < radians.size(); ++i) {
+    const auto [sin, cos] = autoware_utils_math::sin_and_cos(radians[i]);
+    const bool equal = sins[i] == autoware_utils_math::sin(radians[i]) &&
+                       coss[i] == autoware_utils_math::cos(radians[i]) &&
+                       pair_sins[i] == sin && pair_coss[i] == cos;
+    if (!equal && mismatches++ == 0) {
+      ADD_FAILURE() << "first mismatch at " << radians[i];
+    }
+  }
+  EXPECT_EQ(mismatches, 0u);
+}
+
+TEST(TestTrigonometry, CompactSinTable)
+{
+  using autoware_utils_math::compact_discrete_arcs_num_90;
+  using autoware_utils_math::g_compact_sin_table;
+  using autoware_utils_math::pi;
+
+  EXPECT_EQ(g_compact_sin_table.front(), 0.f);
+  EXPECT_EQ(g_compact_sin_table.back(), 1.f);
+  for (size_t i = 0; i < g_compact_sin_table.size(); ++i) {
+    const double radian = (pi / 2) * i / compact_discrete_arcs_num_90;
+    EXPECT_NEAR(g_compact_sin_table[i], std::sin(radian), 1e-7);
+  }
+}
+
 TEST(TestTrigonometry, Atan2)
 {
   for (const auto & p : make_normalized_cases()) {
@@ -89,3 +173,46 @@ TEST(TestTrigonometry, Atan2)
     EXPECT_NEAR(r3, r0, eps);
   }
 }
+
+TEST(TestTrigonometry, Atan2Batch)
+{
+  std::vector<float> dy;
+  std::vector<float> dx;
+  for (const auto & p : make_normalized_cases()) {
+    for (const float scale : {0.5f, 1.0f, 1.5f}) {
+      dy.push_back(p.sin * scale);
+      dx.push_back(p.cos * scale);
+    }
+  }
+  std::vector<float> angles(dy.size());
+  autoware_utils_math::opencv_fast_atan2(dy.data(), dx.data(), dy.size(), angles.data());
+  for (size_t i = 0; i < dy.size(); ++i) {
+    EXPECT_FLOAT_EQ(angles[i], autoware_utils_math::opencv_fast_atan2(dy[i], dx[i]));
+  }
+}
+
+TEST(TestTrigonometry, FastAtan2)
+{
+  std::vector<double> dy;
+  std::vector<double> dx;
+  for (const auto & p : make_test_cases(-autoware_utils_math::pi, autoware_utils_math::pi, 10000)) {
+    for (const double scale : {1e-3, 1.0, 1e3}) {
+      dy.push_back(std::sin(static_cast<double>(p.radian)) * scale);
+      dx.push_back(std::cos(static_cast<double>(p.radian)) * scale);
+    }
+  }
+  for (const double v : {-1.0, 0.0, 1.0}) {
+    for (const double u : {-1.0, 0.0, 1.0}) {
+      dy.push_back(v);
+      dx.push_back(u);
+    }
+  }
+
+  std::vector<double> angles(dy.size());
+  autoware_utils_math::fast_atan2(dy.data(), dx.data(), dy.size(), angles.data());
+  for (size_t i = 0; i < dy.size(); ++i) {
+    const double expected = std::atan2(dy[i], dx[i]);
+    EXPECT_NEAR(autoware_utils_math::fast_atan2(dy[i], dx[i]), expected, 1e-9);
+    EXPECT_EQ(angles[i], autoware_utils_math::fast_atan2(dy[i], dx[i]));
+  }
+}
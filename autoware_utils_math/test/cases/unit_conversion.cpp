@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <vector>
 
 struct ParamAngle
@@ -132,3 +133,54 @@ TEST(unit_conversion, mps2kmph)  // NOLINT for gtest
   EXPECT_DOUBLE_EQ(mps2kmph(20), 72);
   EXPECT_DOUBLE_EQ(mps2kmph(50), 180);
 }
+
+TEST(unit_conversion, constexpr_array)  // NOLINT for gtest
+{
+  using autoware_utils_math::deg2rad;
+  using autoware_utils_math::pi;
+
+  constexpr std::array<double, 3> degrees{0.0, 90.0, 180.0};
+  constexpr auto radians = deg2rad(degrees);
+  static_assert(radians[0] == 0.0);
+  static_assert(radians[2] == deg2rad(180.0));
+  EXPECT_DOUBLE_EQ(radians[1], pi / 2);
+
+  constexpr auto speeds = autoware_utils_math::kmph2mps(std::array<double, 2>{36.0, 72.0});
+  static_assert(speeds[1] == autoware_utils_math::kmph2mps(72.0));
+  EXPECT_DOUBLE_EQ(speeds[0], 10.0);
+}
+
+TEST(unit_conversion, bulk)  // NOLINT for gtest
+{
+  std::vector<double> degrees;
+  std::vector<double> kmph;
+  for (const auto & p : make_angle_cases()) {
+    degrees.push_back(p.degree);
+  }
+  for (const auto & p : make_speed_cases()) {
+    kmph.push_back(p.kmph);
+  }
+
+  std::vector<double> radians(degrees.size());
+  autoware_utils_math::deg2rad(degrees.data(), degrees.size(), radians.data());
+  std::vector<double> mps(kmph.size());
+  autoware_utils_math::kmph2mps(kmph.data(), kmph.size(), mps.data());
+  for (size_t i = 0; i < degrees.size(); ++i) {
+    EXPECT_EQ(radians[i], autoware_utils_math::deg2rad(degrees[i]));
+  }
+  for (size_t i = 0; i < kmph.size(); ++i) {
+    EXPECT_EQ(mps[i], autoware_utils_math::kmph2mps(kmph[i]));
+  }
+
+  // in place
+  auto values = radians;
+  autoware_utils_math::rad2deg(values.data(), values.size(), values.data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], autoware_utils_math::rad2deg(radians[i]));
+  }
+  values = mps;
+  autoware_utils_math::mps2kmph(values.data(), values.size(), values.data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], autoware_utils_math::mps2kmph(mps[i]));
+  }
+}
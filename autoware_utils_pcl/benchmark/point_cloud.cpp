@@ -0,0 +1,308 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/deskew.hpp"
+#include "autoware_utils_pcl/pcl_conversion.hpp"
+#include "autoware_utils_pcl/point_cloud_filter.hpp"
+#include "autoware_utils_pcl/range_image.hpp"
+#include "autoware_utils_pcl/transforms.hpp"
+#include "autoware_utils_pcl/voxel_grid.hpp"
+
+#include <Eigen/Geometry>
+#include <autoware_utils_geometry/alt_geometry.hpp>
+#include <benchmark/benchmark.h>
+
+#include <pcl/point_types.h>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Point cloud stages on clouds shaped as the scans of a spinning lidar, for the layouts of the
+// Autoware drivers. Each benchmark reports the points per second.
+namespace
+{
+using sensor_msgs::msg::PointCloud2;
+using sensor_msgs::msg::PointField;
+
+enum Layout : int64_t {
+  xyzi,       // x, y, z and intensity in FLOAT32, 16 bytes
+  xyzirc,     // x, y, z, intensity, return type and channel, 16 bytes
+  xyzircaedt  // and azimuth, elevation, distance and time stamp, 32 bytes
+};
+
+void add_field(PointCloud2 & cloud, const std::string & name, const uint8_t datatype)
+{
+  static constexpr uint32_t sizes[] = {0, 1, 1, 2, 2, 4, 4, 4, 8};
+  PointField field;
+  field.name = name;
+  field.offset = cloud.point_step;
+  field.datatype = datatype;
+  field.count = 1;
+  cloud.fields.push_back(field);
+  cloud.point_step += sizes[datatype];
+}
+
+template <typename T>
+void write(uint8_t * point, const PointField & field, const T value)
+{
+  std::memcpy(point + field.offset, &value, sizeof(T));
+}
+
+/**
+ * @brief scan of 128 channels over a turn of 100 ms, hitting a flat ground 2 m below the sensor
+ * and walls 20 to 60 m away, with a few points without a return
+ */
+PointCloud2 make_cloud(const size_t size, const Layout layout)
+{
+  PointCloud2 cloud;
+  cloud.header.frame_id = "lidar";
+  add_field(cloud, "x", PointField::FLOAT32);
+  add_field(cloud, "y", PointField::FLOAT32);
+  add_field(cloud, "z", PointField::FLOAT32);
+  if (layout == xyzi) {
+    add_field(cloud, "intensity", PointField::FLOAT32);
+  } else {
+    add_field(cloud, "intensity", PointField::UINT8);
+    add_field(cloud, "return_type", PointField::UINT8);
+    add_field(cloud, "channel", PointField::UINT16);
+  }
+  if (layout == xyzircaedt) {
+    add_field(cloud, "azimuth", PointField::FLOAT32);
+    add_field(cloud, "elevation", PointField::FLOAT32);
+    add_field(cloud, "distance", PointField::FLOAT32);
+    add_field(cloud, "time_stamp", PointField::UINT32);
+  }
+  cloud.height = 1;
+  cloud.width = static_cast<uint32_t>(size);
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.is_dense = false;
+  cloud.data.resize(cloud.row_step);
+
+  constexpr size_t channels = 128;
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> wall(20.0f, 60.0f);
+  std::uniform_real_distribution<float> noise(-0.02f, 0.02f);
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const size_t firings = (size + channels - 1) / channels;
+  for (size_t i = 0; i < size; ++i) {
+    const size_t firing = i / channels;
+    const size_t channel = i % channels;
+    const float azimuth = 2.0f * static_cast<float>(M_PI) * firing / firings;
+    const float elevation = (-25.0f + 40.0f * channel / channels) * static_cast<float>(M_PI) / 180;
+    float distance = elevation < -0.05f ? std::min(-2.0f / std::sin(elevation), 100.0f) : wall(gen);
+    distance += noise(gen);
+    const bool hit = i % 97 != 0;
+    const float horizontal = distance * std::cos(elevation);
+
+    uint8_t * point = cloud.data.data() + i * cloud.point_step;
+    write(point, cloud.fields[0], hit ? horizontal * std::cos(azimuth) : nan);
+    write(point, cloud.fields[1], hit ? horizontal * std::sin(azimuth) : nan);
+    write(point, cloud.fields[2], hit ? distance * std::sin(elevation) : nan);
+    if (layout == xyzi) {
+      write(point, cloud.fields[3], static_cast<float>(i % 256));
+      continue;
+    }
+    write(point, cloud.fields[3], static_cast<uint8_t>(i % 256));
+    write(point, cloud.fields[4], static_cast<uint8_t>(1));
+    write(point, cloud.fields[5], static_cast<uint16_t>(channel));
+    if (layout == xyzircaedt) {
+      write(point, cloud.fields[6], azimuth);
+      write(point, cloud.fields[7], elevation);
+      write(point, cloud.fields[8], distance);
+      write(point, cloud.fields[9], static_cast<uint32_t>(100'000'000ull * firing / firings));
+    }
+  }
+  return cloud;
+}
+
+/// @brief lidar to base_link, with a small rotation so that no shortcut applies
+Eigen::Matrix4f make_transform()
+{
+  Eigen::Affine3f transform = Eigen::Translation3f(1.2f, 0.0f, 2.0f) *
+                              Eigen::AngleAxisf(0.01f, Eigen::Vector3f::UnitY()) *
+                              Eigen::AngleAxisf(0.02f, Eigen::Vector3f::UnitZ());
+  return transform.matrix();
+}
+
+void report_points(benchmark::State & state, const size_t points)
+{
+  state.counters["points/s"] = benchmark::Counter(
+    static_cast<double>(points) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+autoware_utils_system::ThreadPool & pool()
+{
+  return autoware_utils_system::ThreadPool::shared();
+}
+
+/// @brief args: number of points, layout, 1 to run on the thread pool
+void from_ros_msg(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), static_cast<Layout>(state.range(1)));
+  const auto transform = make_transform();
+  pcl::PointCloud<pcl::PointXYZ> pcl_cloud;
+  for (auto _ : state) {
+    if (state.range(2)) {
+      autoware_utils_pcl::transform_point_cloud_from_ros_msg(cloud, pcl_cloud, transform, pool());
+    } else {
+      autoware_utils_pcl::transform_point_cloud_from_ros_msg(cloud, pcl_cloud, transform);
+    }
+    benchmark::DoNotOptimize(pcl_cloud.points.data());
+  }
+  report_points(state, cloud.width);
+}
+
+/// @brief args: number of points, layout, 1 to run on the thread pool
+void point_cloud2(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), static_cast<Layout>(state.range(1)));
+  const auto transform = make_transform();
+  PointCloud2 out;
+  for (auto _ : state) {
+    if (state.range(2)) {
+      autoware_utils_pcl::transform_pointcloud(cloud, out, transform, pool());
+    } else {
+      autoware_utils_pcl::transform_pointcloud(cloud, out, transform);
+    }
+    benchmark::DoNotOptimize(out.data.data());
+  }
+  report_points(state, cloud.width);
+}
+
+/// @brief args: number of points, layout, 1 to run on the thread pool
+void point_cloud2_in_place(benchmark::State & state)
+{
+  auto cloud = make_cloud(state.range(0), static_cast<Layout>(state.range(1)));
+  const auto transform = make_transform();
+  for (auto _ : state) {
+    if (state.range(2)) {
+      autoware_utils_pcl::transform_pointcloud(cloud, transform, pool());
+    } else {
+      autoware_utils_pcl::transform_pointcloud(cloud, transform);
+    }
+    benchmark::DoNotOptimize(cloud.data.data());
+  }
+  report_points(state, cloud.width);
+}
+
+/// @brief args: number of points, 1 to run on the thread pool
+void pcl_cloud(benchmark::State & state)
+{
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  autoware_utils_pcl::transform_point_cloud_from_ros_msg(
+    make_cloud(state.range(0), xyzi), cloud, Eigen::Matrix4f::Identity().eval());
+  const auto transform = make_transform();
+  pcl::PointCloud<pcl::PointXYZI> out;
+  for (auto _ : state) {
+    if (state.range(1)) {
+      autoware_utils_pcl::transform_pointcloud(cloud, out, transform, pool());
+    } else {
+      autoware_utils_pcl::transform_pointcloud(cloud, out, transform);
+    }
+    benchmark::DoNotOptimize(out.points.data());
+  }
+  report_points(state, cloud.size());
+}
+
+/// @brief args: number of points, layout
+void filter(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), static_cast<Layout>(state.range(1)));
+  const auto transform = make_transform();
+  namespace alt = autoware_utils_geometry::alt;
+  const auto polygon = alt::StaticConvexPolygon2f<8>::create(
+    {alt::Point2f(-20.0f, -10.0f), alt::Point2f(-20.0f, 10.0f), alt::Point2f(0.0f, 20.0f),
+     alt::Point2f(40.0f, 20.0f), alt::Point2f(40.0f, -20.0f), alt::Point2f(0.0f, -20.0f)});
+  autoware_utils_pcl::PointCloudFilter predicates;
+  predicates.max_range = 50.0f;
+  predicates.box = Eigen::AlignedBox3f(Eigen::Vector3f(-50, -50, 0.2f), Eigen::Vector3f(50, 50, 3));
+  predicates.polygon = *polygon;
+  pcl::PointCloud<pcl::PointXYZ> out;
+  for (auto _ : state) {
+    autoware_utils_pcl::transform_filter_point_cloud_from_ros_msg(
+      cloud, out, transform, predicates);
+    benchmark::DoNotOptimize(out.points.data());
+  }
+  report_points(state, cloud.width);
+}
+
+/// @brief args: number of points
+void deskew(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), xyzircaedt);
+  autoware_utils_pcl::SensorMotion motion;
+  motion.start = make_transform();
+  motion.end = (Eigen::Translation3f(1.0f, 0.0f, 0.0f) * Eigen::Affine3f(motion.start) *
+                Eigen::AngleAxisf(0.05f, Eigen::Vector3f::UnitZ()))
+                 .matrix();
+  motion.end_time = 0.1;
+  PointCloud2 out;
+  for (auto _ : state) {
+    autoware_utils_pcl::transform_pointcloud(cloud, out, motion);
+    benchmark::DoNotOptimize(out.data.data());
+  }
+  report_points(state, cloud.width);
+}
+
+/// @brief args: number of points, layout, leaf size in centimeters
+void voxel_grid(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), static_cast<Layout>(state.range(1)));
+  autoware_utils_pcl::VoxelGrid voxel_grid(0.01f * state.range(2));
+  PointCloud2 out;
+  for (auto _ : state) {
+    voxel_grid.filter(cloud, out);
+    benchmark::DoNotOptimize(out.data.data());
+  }
+  report_points(state, cloud.width);
+  state.counters["voxels"] = static_cast<double>(voxel_grid.size());
+}
+
+/// @brief args: number of points, number of rings
+void range_image(benchmark::State & state)
+{
+  const auto cloud = make_cloud(state.range(0), xyzi);
+  constexpr float deg = 3.14159265f / 180.0f;
+  autoware_utils_pcl::RangeImage image(state.range(1), 0.2f * deg, -25.0f * deg, 15.0f * deg);
+  for (auto _ : state) {
+    image.project(cloud);
+    benchmark::DoNotOptimize(image.indices().data());
+  }
+  report_points(state, cloud.width);
+}
+
+const std::vector<int64_t> sizes = {100'000, 500'000, 2'000'000};
+const std::vector<int64_t> layouts = {xyzi, xyzirc, xyzircaedt};
+
+BENCHMARK(from_ros_msg)->ArgsProduct({sizes, layouts, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(point_cloud2)->ArgsProduct({sizes, layouts, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(point_cloud2_in_place)
+  ->ArgsProduct({sizes, layouts, {0, 1}})
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(pcl_cloud)->ArgsProduct({sizes, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(filter)->ArgsProduct({sizes, layouts})->Unit(benchmark::kMillisecond);
+BENCHMARK(deskew)->ArgsProduct({sizes})->Unit(benchmark::kMillisecond);
+BENCHMARK(voxel_grid)->ArgsProduct({sizes, layouts, {10, 50}})->Unit(benchmark::kMillisecond);
+BENCHMARK(range_image)->ArgsProduct({sizes, {32, 128}})->Unit(benchmark::kMillisecond);
+}  // namespace
@@ -0,0 +1,217 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_PCL__DESKEW_HPP_
+#define AUTOWARE_UTILS_PCL__DESKEW_HPP_
+
+#include "autoware_utils_pcl/transforms.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace autoware_utils_pcl
+{
+/**
+ * @brief Transforms from the sensor frame to the target frame at the start and the end of a scan
+ *
+ * The times are in seconds relative to the stamp of the cloud, as the times of the points.
+ */
+struct SensorMotion
+{
+  Eigen::Matrix<float, 4, 4> start{Eigen::Matrix<float, 4, 4>::Identity()};
+  Eigen::Matrix<float, 4, 4> end{Eigen::Matrix<float, 4, 4>::Identity()};
+  double start_time{0.0};
+  double end_time{0.0};
+};
+
+namespace detail
+{
+/**
+ * @brief transforms of a SensorMotion sampled at regular times, of which the rotations are
+ * interpolated by slerp, and interpolated linearly between the samples
+ *
+ * The linear interpolation of the rotation matrices between close samples errs by the square of
+ * their angle, so that the points are deskewed with a few multiplications.
+ */
+class MotionSamples
+{
+public:
+  static constexpr size_t intervals = 64;
+
+  explicit MotionSamples(const SensorMotion & motion) : start_time_(motion.start_time)
+  {
+    if (motion.end_time < motion.start_time) {
+      throw std::invalid_argument("The end of the motion is before its start.");
+    }
+    const Eigen::Affine3f start(motion.start);
+    const Eigen::Affine3f end(motion.end);
+    const Eigen::Quaternionf start_rotation(start.rotation());
+    const Eigen::Quaternionf end_rotation(end.rotation());
+    for (size_t k = 0; k <= intervals; ++k) {
+      const float ratio = static_cast<float>(k) / intervals;
+      Eigen::Matrix<float, 3, 4> sample;
+      sample.leftCols<3>() = start_rotation.slerp(ratio, end_rotation).toRotationMatrix();
+      sample.col(3) = (1.0f - ratio) * start.translation() + ratio * end.translation();
+      Eigen::Map<Eigen::Matrix<float, 3, 4, Eigen::RowMajor>>(samples_[k].data()) = sample;
+    }
+    const double duration = motion.end_time - motion.start_time;
+    scale_ = 0.0 < duration ? intervals / duration : 0.0;
+  }
+
+  /// @brief transform at a time, clamped to the motion, as a row-major 3x4 matrix
+  void at(const double time, float (&transform)[12]) const
+  {
+    const double position =
+      std::clamp((time - start_time_) * scale_, 0.0, static_cast<double>(intervals));
+    const size_t k = std::min(static_cast<size_t>(position), intervals - 1);
+    const float ratio = static_cast<float>(position - k);
+    for (size_t j = 0; j < 12; ++j) {
+      transform[j] = samples_[k][j] + ratio * (samples_[k + 1][j] - samples_[k][j]);
+    }
+  }
+
+private:
+  double start_time_;
+  double scale_;
+  std::array<std::array<float, 12>, intervals + 1> samples_;
+};
+
+/// @brief transform the x, y and z of the points of a buffer in place, each at its time
+template <typename TimeT>
+void deskew_points(
+  uint8_t * data, const size_t count, const size_t point_step, const size_t (&offsets)[3],
+  const size_t time_offset, const double time_scale, const MotionSamples & samples)
+{
+  float m[12];
+  for (size_t i = 0; i < count; ++i) {
+    uint8_t * point = data + i * point_step;
+    TimeT time;
+    std::memcpy(&time, point + time_offset, sizeof(TimeT));
+    samples.at(static_cast<double>(time) * time_scale, m);
+    float x;
+    float y;
+    float z;
+    std::memcpy(&x, point + offsets[0], sizeof(float));
+    std::memcpy(&y, point + offsets[1], sizeof(float));
+    std::memcpy(&z, point + offsets[2], sizeof(float));
+    const float tx = m[0] * x + m[1] * y + m[2] * z + m[3];
+    const float ty = m[4] * x + m[5] * y + m[6] * z + m[7];
+    const float tz = m[8] * x + m[9] * y + m[10] * z + m[11];
+    std::memcpy(point + offsets[0], &tx, sizeof(float));
+    std::memcpy(point + offsets[1], &ty, sizeof(float));
+    std::memcpy(point + offsets[2], &tz, sizeof(float));
+  }
+}
+
+/**
+ * @brief deskew the points of a cloud in place, or into the output which is prepared once the
+ * fields are checked, dispatching on the datatype of the time field
+ */
+inline void deskew_cloud(
+  sensor_msgs::msg::PointCloud2 & cloud, const sensor_msgs::msg::PointCloud2 * cloud_in,
+  const SensorMotion & motion, const std::string & time_field)
+{
+  using sensor_msgs::msg::PointField;
+  const auto & source = cloud_in != nullptr ? *cloud_in : cloud;
+  size_t offsets[3];
+  xyz_offsets(source, offsets);
+  const auto field = std::find_if(source.fields.begin(), source.fields.end(), [&](const auto & f) {
+    return f.name == time_field;
+  });
+  if (field == source.fields.end()) {
+    throw std::invalid_argument("The point cloud has no field " + time_field + ".");
+  }
+  const MotionSamples samples(motion);
+  const size_t size = static_cast<size_t>(source.width) * source.height;
+
+  const auto deskew = [&](auto time_type, const double time_scale) {
+    using TimeT = decltype(time_type);
+    if (field->offset + sizeof(TimeT) > source.point_step) {
+      throw std::invalid_argument("The field " + time_field + " exceeds the point step.");
+    }
+    const uint8_t * in_data = nullptr;
+    if (cloud_in != nullptr) {
+      prepare_output(*cloud_in, cloud);
+      in_data = cloud_in->data.data();
+    }
+    transform_range(source, in_data, cloud.data.data(), 0, size, [&](uint8_t * data, size_t n) {
+      deskew_points<TimeT>(data, n, source.point_step, offsets, field->offset, time_scale, samples);
+    });
+  };
+  switch (field->datatype) {
+    case PointField::FLOAT32:
+      return deskew(float{}, 1.0);
+    case PointField::FLOAT64:
+      return deskew(double{}, 1.0);
+    case PointField::UINT32:
+      return deskew(uint32_t{}, 1e-9);
+    default:
+      throw std::invalid_argument(
+        "The field " + time_field + " is not FLOAT32, FLOAT64 or UINT32.");
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 in place, each point by the transform of the
+ * sensor at its time, correcting the motion distortion in the same pass
+ *
+ * @param cloud Cloud with the FLOAT32 fields x, y and z
+ * @param motion Transforms of the sensor at the start and the end of the scan, clamped outside
+ * @param time_field Time of the points relative to the stamp of the cloud, in seconds if it is
+ * FLOAT32 or FLOAT64, or in nanoseconds if it is UINT32
+ * @throw std::invalid_argument if a field is missing or has another datatype, the data of the
+ * cloud does not match its steps, or the motion ends before its start
+ */
+inline void transform_pointcloud(
+  sensor_msgs::msg::PointCloud2 & cloud, const SensorMotion & motion,
+  const std::string & time_field = "time_stamp")
+{
+  detail::deskew_cloud(cloud, nullptr, motion, time_field);
+}
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 into another PointCloud2, each point by the
+ * transform of the sensor at its time, correcting the motion distortion in the same pass
+ *
+ * @param cloud_in Cloud with the FLOAT32 fields x, y and z
+ * @param cloud_out Transformed cloud, which must not be the input
+ * @param motion Transforms of the sensor at the start and the end of the scan, clamped outside
+ * @param time_field Time of the points relative to the stamp of the cloud, in seconds if it is
+ * FLOAT32 or FLOAT64, or in nanoseconds if it is UINT32
+ * @throw std::invalid_argument if a field is missing or has another datatype, the data of the
+ * cloud does not match its steps, or the motion ends before its start
+ */
+inline void transform_pointcloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, sensor_msgs::msg::PointCloud2 & cloud_out,
+  const SensorMotion & motion, const std::string & time_field = "time_stamp")
+{
+  detail::deskew_cloud(cloud_out, &cloud_in, motion, time_field);
+}
+
+}  // namespace autoware_utils_pcl
+
+#endif  // AUTOWARE_UTILS_PCL__DESKEW_HPP_
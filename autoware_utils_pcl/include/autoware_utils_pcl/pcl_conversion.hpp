@@ -15,6 +15,10 @@
 #ifndef AUTOWARE_UTILS_PCL__PCL_CONVERSION_HPP_
 #define AUTOWARE_UTILS_PCL__PCL_CONVERSION_HPP_
 
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <autoware_utils_system/thread_pool.hpp>
+
 #include <pcl/common/transforms.h>
 #include <pcl_conversions/pcl_conversions.h>
 
@@ -24,47 +28,76 @@ namespace autoware_utils_pcl
 {
 /**
  * @brief a faster implementation of converting sensor_msgs::msg::PointCloud2 to
- * pcl::PointCloud<pcl::PointXYZ> and transform the cloud
+ * pcl::PointCloud<PointT> and transform the cloud, in a single pass
+ *
+ * The fields of PointT are copied as pcl::fromROSMsg does, and x, y and z are transformed.
  *
  * @tparam Scalar
+ * @tparam PointT    point type with x, y and z, e.g. pcl::PointXYZ or pcl::PointXYZI
  * @param cloud      input PointCloud2 message
  * @param pcl_cloud  output transformed pcl cloud
  * @param transform  eigen transformation matrix
+ * @throw std::invalid_argument if the data of the message does not match its steps
  */
-template <typename Scalar>
+template <typename Scalar, typename PointT>
 void transform_point_cloud_from_ros_msg(
-  const sensor_msgs::msg::PointCloud2 & cloud, pcl::PointCloud<pcl::PointXYZ> & pcl_cloud,
+  const sensor_msgs::msg::PointCloud2 & cloud, pcl::PointCloud<PointT> & pcl_cloud,
   const Eigen::Matrix<Scalar, 4, 4> & transform)
 {
+  const PointCloud2View<PointT> points(cloud);
+
   // Copy info fields
   pcl_conversions::toPCL(cloud.header, pcl_cloud.header);
   pcl_cloud.width = cloud.width;
   pcl_cloud.height = cloud.height;
   pcl_cloud.is_dense = cloud.is_dense == 1;
 
-  pcl::MsgFieldMap field_map;
-  std::vector<pcl::PCLPointField> msg_fields;
-  pcl_conversions::toPCL(cloud.fields, msg_fields);
-  pcl::createMapping<pcl::PointXYZ>(msg_fields, field_map);
-
-  // transform point data
-  std::uint32_t num_points = cloud.width * cloud.height;
-  pcl_cloud.points.resize(num_points);
-  std::uint8_t * cloud_data = reinterpret_cast<std::uint8_t *>(&pcl_cloud.points[0]);
+  // copy the fields and transform the point data
+  pcl_cloud.points.resize(points.size());
   pcl::detail::Transformer<Scalar> tf(transform);
+  auto out = pcl_cloud.points.begin();
+  for (const PointT & point : points) {
+    *out = point;
+    tf.se3(point.data, out->data);
+    ++out;
+  }
+}
+
+/**
+ * @brief transform_point_cloud_from_ros_msg() in chunks run by a thread pool
+ *
+ * @tparam Scalar
+ * @tparam PointT    point type with x, y and z, e.g. pcl::PointXYZ or pcl::PointXYZI
+ * @param cloud      input PointCloud2 message
+ * @param pcl_cloud  output transformed pcl cloud
+ * @param transform  eigen transformation matrix
+ * @param pool       threads running the chunks, e.g. autoware_utils_system::ThreadPool::shared()
+ * @param grain_size number of points per chunk, whose data should fit in the L2 cache
+ * @throw std::invalid_argument if the data of the message does not match its steps
+ */
+template <typename Scalar, typename PointT>
+void transform_point_cloud_from_ros_msg(
+  const sensor_msgs::msg::PointCloud2 & cloud, pcl::PointCloud<PointT> & pcl_cloud,
+  const Eigen::Matrix<Scalar, 4, 4> & transform, autoware_utils_system::ThreadPool & pool,
+  const size_t grain_size = 8192)
+{
+  const PointCloud2View<PointT> points(cloud);
+
+  // Copy info fields
+  pcl_conversions::toPCL(cloud.header, pcl_cloud.header);
+  pcl_cloud.width = cloud.width;
+  pcl_cloud.height = cloud.height;
+  pcl_cloud.is_dense = cloud.is_dense == 1;
 
-  for (std::uint32_t row = 0; row < cloud.height; ++row) {
-    const std::uint8_t * row_data = &cloud.data[row * cloud.row_step];
-    for (std::uint32_t col = 0; col < cloud.width; ++col) {
-      const std::uint8_t * msg_data = row_data + col * cloud.point_step;
-      for (const pcl::detail::FieldMapping & mapping : field_map) {
-        const float * msg_ptr = reinterpret_cast<const float *>(msg_data);
-        float * pcl_ptr = reinterpret_cast<float *>(cloud_data + mapping.struct_offset);
-        tf.se3(msg_ptr, pcl_ptr);
-      }
-      cloud_data += sizeof(pcl::PointXYZ);
+  pcl_cloud.points.resize(points.size());
+  const pcl::detail::Transformer<Scalar> tf(transform);
+  pool.parallel_for(0, points.size(), grain_size, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const PointT point = points[i];
+      pcl_cloud.points[i] = point;
+      tf.se3(point.data, pcl_cloud.points[i].data);
     }
-  }
+  });
 }
 
 }  // namespace autoware_utils_pcl
@@ -0,0 +1,278 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_PCL__POINT_CLOUD2_VIEW_HPP_
+#define AUTOWARE_UTILS_PCL__POINT_CLOUD2_VIEW_HPP_
+
+#include <pcl/conversions.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_pcl
+{
+
+/**
+ * @brief Datatype of sensor_msgs::msg::PointField storing a type
+ */
+template <typename T>
+struct point_field_datatype;
+
+#define AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(type, datatype)              \
+  template <>                                                                \
+  struct point_field_datatype<type>                                          \
+  {                                                                          \
+    static constexpr uint8_t value = sensor_msgs::msg::PointField::datatype; \
+  };
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(int8_t, INT8)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(uint8_t, UINT8)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(int16_t, INT16)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(uint16_t, UINT16)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(int32_t, INT32)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(uint32_t, UINT32)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(float, FLOAT32)
+AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE(double, FLOAT64)
+#undef AUTOWARE_UTILS_PCL_POINT_FIELD_DATATYPE
+
+/**
+ * @brief Forward iterator over the points of a view, reading each point in place
+ */
+template <typename View>
+class PointCloud2ViewIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename View::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+
+  PointCloud2ViewIterator(const View * view, const uint8_t * row)
+  : view_(view), row_(row), point_(row)
+  {
+  }
+
+  value_type operator*() const { return view_->read(point_); }
+
+  PointCloud2ViewIterator & operator++()
+  {
+    // the padding at the end of the rows is skipped
+    point_ += view_->point_step();
+    if (++col_ == view_->width()) {
+      row_ += view_->row_step();
+      point_ = row_;
+      col_ = 0;
+    }
+    return *this;
+  }
+
+  PointCloud2ViewIterator operator++(int)
+  {
+    auto it = *this;
+    ++*this;
+    return it;
+  }
+
+  bool operator==(const PointCloud2ViewIterator & other) const { return point_ == other.point_; }
+  bool operator!=(const PointCloud2ViewIterator & other) const { return point_ != other.point_; }
+
+private:
+  const View * view_;
+  const uint8_t * row_;
+  const uint8_t * point_;
+  uint32_t col_{0};
+};
+
+/**
+ * @brief Layout of the points of a PointCloud2, shared by the views
+ */
+class PointCloud2Layout
+{
+public:
+  /**
+   * @brief Construct a layout, checking that the data holds all the points
+   *
+   * @param cloud Cloud, which must outlive the layout
+   * @throw std::invalid_argument if the steps or the size of the data do not match the points
+   */
+  explicit PointCloud2Layout(const sensor_msgs::msg::PointCloud2 & cloud)
+  : data_(cloud.data.data()),
+    width_(cloud.width),
+    height_(cloud.height),
+    point_step_(cloud.point_step),
+    row_step_(cloud.row_step)
+  {
+    if (
+      static_cast<size_t>(row_step_) < static_cast<size_t>(width_) * point_step_ ||
+      cloud.data.size() < static_cast<size_t>(row_step_) * height_) {
+      throw std::invalid_argument("The data of the point cloud does not match its steps.");
+    }
+  }
+
+  size_t size() const { return static_cast<size_t>(width_) * height_; }
+  bool empty() const { return size() == 0; }
+  uint32_t width() const { return width_; }
+  uint32_t point_step() const { return point_step_; }
+  uint32_t row_step() const { return row_step_; }
+
+protected:
+  const uint8_t * point_data(const size_t index) const
+  {
+    return data_ + (index / width_) * row_step_ + (index % width_) * point_step_;
+  }
+  const uint8_t * begin_data() const { return empty() ? end_data() : data_; }
+  const uint8_t * end_data() const { return data_ + static_cast<size_t>(row_step_) * height_; }
+
+  /**
+   * @brief Find a field by name
+   *
+   * @throw std::invalid_argument if the cloud has no field of the name
+   */
+  static const sensor_msgs::msg::PointField & find_field(
+    const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+  {
+    for (const auto & field : cloud.fields) {
+      if (field.name == name) {
+        return field;
+      }
+    }
+    throw std::invalid_argument("The point cloud has no field " + name + ".");
+  }
+
+private:
+  const uint8_t * data_;
+  uint32_t width_;
+  uint32_t height_;
+  uint32_t point_step_;
+  uint32_t row_step_;
+};
+
+/**
+ * @brief Typed view of a field of the points of a PointCloud2, read in place without a copy of
+ * the cloud
+ *
+ * @code
+ * for (const float intensity : PointCloud2FieldView<float>(cloud, "intensity")) { ... }
+ * @endcode
+ *
+ * @tparam T Type of the field, matching its datatype
+ */
+template <typename T>
+class PointCloud2FieldView : public PointCloud2Layout
+{
+public:
+  using value_type = T;
+  using iterator = PointCloud2ViewIterator<PointCloud2FieldView>;
+
+  /**
+   * @brief Construct a view of a field
+   *
+   * @param cloud Cloud, which must outlive the view
+   * @param name Name of the field
+   * @throw std::invalid_argument if the field does not exist, has another datatype or exceeds the
+   * point step
+   */
+  PointCloud2FieldView(const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+  : PointCloud2Layout(cloud), offset_(find_field(cloud, name).offset)
+  {
+    if (find_field(cloud, name).datatype != point_field_datatype<T>::value) {
+      throw std::invalid_argument("The field " + name + " has another datatype.");
+    }
+    if (offset_ + sizeof(T) > point_step()) {
+      throw std::invalid_argument("The field " + name + " exceeds the point step.");
+    }
+  }
+
+  T operator[](const size_t index) const { return read(point_data(index)); }
+  iterator begin() const { return iterator(this, begin_data()); }
+  iterator end() const { return iterator(this, end_data()); }
+
+  /**
+   * @brief Read the field of a point, which may be unaligned
+   */
+  T read(const uint8_t * point) const
+  {
+    T value;
+    std::memcpy(&value, point + offset_, sizeof(T));
+    return value;
+  }
+
+private:
+  size_t offset_;
+};
+
+/**
+ * @brief View of the points of a PointCloud2 as a registered PCL point type, each point being
+ * read in place without converting the cloud to a pcl::PointCloud
+ *
+ * The fields of the point type are mapped to the fields of the message as pcl::fromROSMsg does,
+ * the adjacent fields being copied at once. The fields missing in the message keep the values of
+ * the default constructed point.
+ *
+ * @tparam PointT Point type registered with POINT_CLOUD_REGISTER_POINT_STRUCT
+ */
+template <typename PointT>
+class PointCloud2View : public PointCloud2Layout
+{
+public:
+  using value_type = PointT;
+  using iterator = PointCloud2ViewIterator<PointCloud2View>;
+
+  /**
+   * @brief Construct a view of the points
+   *
+   * @param cloud Cloud, which must outlive the view
+   * @throw std::invalid_argument if the steps or the size of the data do not match the points
+   */
+  explicit PointCloud2View(const sensor_msgs::msg::PointCloud2 & cloud) : PointCloud2Layout(cloud)
+  {
+    std::vector<pcl::PCLPointField> msg_fields;
+    pcl_conversions::toPCL(cloud.fields, msg_fields);
+    pcl::createMapping<PointT>(msg_fields, field_map_);
+  }
+
+  PointT operator[](const size_t index) const { return read(point_data(index)); }
+  iterator begin() const { return iterator(this, begin_data()); }
+  iterator end() const { return iterator(this, end_data()); }
+
+  /**
+   * @brief Read the mapped fields of a point
+   */
+  PointT read(const uint8_t * point) const
+  {
+    PointT value;
+    auto * value_data = reinterpret_cast<uint8_t *>(&value);
+    for (const auto & mapping : field_map_) {
+      std::memcpy(
+        value_data + mapping.struct_offset, point + mapping.serialized_offset, mapping.size);
+    }
+    return value;
+  }
+
+private:
+  pcl::MsgFieldMap field_map_;
+};
+
+}  // namespace autoware_utils_pcl
+
+#endif  // AUTOWARE_UTILS_PCL__POINT_CLOUD2_VIEW_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_PCL__POINT_CLOUD_FILTER_HPP_
+#define AUTOWARE_UTILS_PCL__POINT_CLOUD_FILTER_HPP_
+
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <autoware_utils_geometry/alt_geometry.hpp>
+
+#include <pcl/common/point_tests.h>
+#include <pcl/common/transforms.h>
+#include <pcl/point_cloud.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_pcl
+{
+/**
+ * @brief Predicates keeping the points of a cloud, all of which must hold
+ *
+ * The range is measured in the input frame, from the sensor, and the box and the polygon are in
+ * the output frame. The points with a NaN coordinate fail the predicates which are set.
+ */
+struct PointCloudFilter
+{
+  bool remove_nan{true};  //!< Remove the points with a NaN or infinite coordinate
+  float min_range{0.0f};  //!< Minimum distance of the points to the origin of the input frame
+  float max_range{std::numeric_limits<float>::infinity()};  //!< Maximum distance, ditto
+  std::optional<Eigen::AlignedBox3f> box;                   //!< Box of the output frame
+
+  //! Polygon of the output frame covering the points in x and y, which must outlive the filter
+  std::optional<autoware_utils_geometry::alt::ConvexPolygon2fView> polygon;
+};
+
+/**
+ * @brief Convert a PointCloud2 message to a PCL cloud, transform it and filter it, in a single pass
+ *
+ * Only the points kept by the filter are written to the output, which is not organized. It saves
+ * the intermediate cloud and the second pass of a transform followed by a crop. The points are
+ * processed by blocks, so that the polygon is tested by the batched covered_by().
+ *
+ * @tparam Scalar
+ * @tparam PointT    point type with x, y and z, e.g. pcl::PointXYZ or pcl::PointXYZI
+ * @param cloud      input PointCloud2 message
+ * @param pcl_cloud  output transformed and filtered pcl cloud
+ * @param transform  eigen transformation matrix
+ * @param filter     predicates keeping the points
+ * @throw std::invalid_argument if the data of the message does not match its steps, or the
+ * minimum range is greater than the maximum range
+ */
+template <typename Scalar, typename PointT>
+void transform_filter_point_cloud_from_ros_msg(
+  const sensor_msgs::msg::PointCloud2 & cloud, pcl::PointCloud<PointT> & pcl_cloud,
+  const Eigen::Matrix<Scalar, 4, 4> & transform, const PointCloudFilter & filter)
+{
+  if (filter.max_range < filter.min_range) {
+    throw std::invalid_argument("The minimum range is greater than the maximum range.");
+  }
+  const PointCloud2View<PointT> points(cloud);
+  const bool check_range = 0.0f < filter.min_range || std::isfinite(filter.max_range);
+  const float min_range2 = filter.min_range * filter.min_range;
+  const float max_range2 = filter.max_range * filter.max_range;
+
+  pcl_conversions::toPCL(cloud.header, pcl_cloud.header);
+  pcl_cloud.points.clear();
+  pcl_cloud.points.reserve(points.size());
+
+  // the block of the points transformed and kept by the other predicates, before the polygon
+  constexpr size_t block_size = 256;
+  std::vector<PointT> block(block_size);
+  autoware_utils_geometry::alt::Points2f block_xy;
+  std::vector<size_t> covered;
+  if (filter.polygon) {
+    block_xy.reserve(block_size);
+    covered.reserve(block_size);
+  }
+
+  const pcl::detail::Transformer<Scalar> tf(transform);
+  for (size_t begin = 0; begin < points.size(); begin += block_size) {
+    const size_t end = std::min(begin + block_size, points.size());
+    size_t kept = 0;
+    for (size_t i = begin; i < end; ++i) {
+      const PointT point = points[i];
+      if (check_range) {
+        const float range2 = point.x * point.x + point.y * point.y + point.z * point.z;
+        if (!(min_range2 <= range2 && range2 <= max_range2)) {
+          continue;
+        }
+      }
+      PointT & out = block[kept];
+      out = point;
+      tf.se3(point.data, out.data);
+      if (filter.remove_nan && !pcl::isXYZFinite(out)) {
+        continue;
+      }
+      if (filter.box && !filter.box->contains(out.getVector3fMap())) {
+        continue;
+      }
+      ++kept;
+    }
+
+    if (!filter.polygon) {
+      pcl_cloud.points.insert(pcl_cloud.points.end(), block.begin(), block.begin() + kept);
+      continue;
+    }
+    block_xy.clear();
+    for (size_t i = 0; i < kept; ++i) {
+      block_xy.emplace_back(block[i].x, block[i].y);
+    }
+    autoware_utils_geometry::covered_by(block_xy, *filter.polygon, covered);
+    for (const size_t i : covered) {
+      pcl_cloud.points.push_back(block[i]);
+    }
+  }
+
+  pcl_cloud.width = static_cast<uint32_t>(pcl_cloud.points.size());
+  pcl_cloud.height = 1;
+  pcl_cloud.is_dense = filter.remove_nan || cloud.is_dense == 1;
+}
+
+}  // namespace autoware_utils_pcl
+
+#endif  // AUTOWARE_UTILS_PCL__POINT_CLOUD_FILTER_HPP_
@@ -0,0 +1,209 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_PCL__RANGE_IMAGE_HPP_
+#define AUTOWARE_UTILS_PCL__RANGE_IMAGE_HPP_
+
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <autoware_utils_math/constants.hpp>
+#include <autoware_utils_math/trigonometry.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_pcl
+{
+/**
+ * @brief Projection of PointCloud2 messages into an image of rings and azimuth columns, reusing
+ * its buffers across the clouds
+ *
+ * The azimuths and the elevations of all the points are computed in two passes of the vectorized
+ * autoware_utils_math::opencv_fast_atan2(), whose error is below 2e-4 rad, instead of std::atan2
+ * per point in double precision. The rows are the rings, the first one at the highest elevation,
+ * and the columns start at the azimuth 0, i.e. the x axis, counterclockwise. Each pixel keeps the
+ * index of the nearest of its points. The points with a NaN coordinate, at the origin or outside
+ * of the elevations of the rings are not projected.
+ */
+class RangeImage
+{
+public:
+  static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();  //!< No point or pixel
+
+  /**
+   * @brief Construct a new RangeImage object
+   *
+   * @param rings Number of rows
+   * @param azimuth_resolution Width of the columns, in radians
+   * @param min_elevation Lowest elevation of the last row, in radians
+   * @param max_elevation Highest elevation of the first row, in radians
+   * @throw std::invalid_argument if there is no ring, the resolution is not positive, or the
+   * elevations are not increasing within [-pi / 2, pi / 2]
+   */
+  RangeImage(
+    const uint32_t rings, const float azimuth_resolution, const float min_elevation,
+    const float max_elevation)
+  : rings_(rings),
+    inverse_resolution_(1.0f / azimuth_resolution),
+    max_elevation_(max_elevation),
+    row_scale_(static_cast<float>(rings) / (max_elevation - min_elevation))
+  {
+    if (rings == 0 || !(0.0f < azimuth_resolution)) {
+      throw std::invalid_argument("The range image has no ring or no azimuth resolution.");
+    }
+    if (!(-autoware_utils_math::pi / 2 <= min_elevation && min_elevation < max_elevation &&
+          max_elevation <= autoware_utils_math::pi / 2)) {
+      throw std::invalid_argument("The elevations of the range image are not increasing.");
+    }
+    // a resolution dividing the turn up to the rounding of the float gives whole columns
+    cols_ = static_cast<uint32_t>(
+      std::ceil(2.0 * autoware_utils_math::pi / azimuth_resolution - 1e-3));
+    indices_.resize(static_cast<size_t>(rings_) * cols_);
+    ranges_.resize(indices_.size());
+  }
+
+  /**
+   * @brief Project a cloud, overwriting the image
+   *
+   * @param cloud Cloud with the FLOAT32 fields x, y and z
+   * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+   * does not match its steps
+   */
+  void project(const sensor_msgs::msg::PointCloud2 & cloud)
+  {
+    const PointCloud2FieldView<float> xs(cloud, "x");
+    const PointCloud2FieldView<float> ys(cloud, "y");
+    const PointCloud2FieldView<float> zs(cloud, "z");
+    const size_t size = xs.size();
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+    std::copy(xs.begin(), xs.end(), x_.begin());
+    std::copy(ys.begin(), ys.end(), y_.begin());
+    std::copy(zs.begin(), zs.end(), z_.begin());
+
+    horizontal_.resize(size);
+    point_ranges_.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      const float horizontal_squared = x_[i] * x_[i] + y_[i] * y_[i];
+      horizontal_[i] = std::sqrt(horizontal_squared);
+      point_ranges_[i] = std::sqrt(horizontal_squared + z_[i] * z_[i]);
+    }
+    azimuths_.resize(size);
+    elevations_.resize(size);
+    autoware_utils_math::opencv_fast_atan2(y_.data(), x_.data(), size, azimuths_.data());
+    autoware_utils_math::opencv_fast_atan2(z_.data(), horizontal_.data(), size, elevations_.data());
+
+    // the pixels of all the points, with selects on constants and clamps instead of branches so
+    // that the loop is vectorized, and the members copied to locals which the stores cannot alias
+    pixels_.resize(size);
+    {
+      constexpr auto pi = static_cast<float>(autoware_utils_math::pi);
+      const float * azimuths = azimuths_.data();
+      const float * elevations = elevations_.data();
+      const float * point_ranges = point_ranges_.data();
+      uint32_t * pixels = pixels_.data();
+      const auto rings = static_cast<float>(rings_);
+      const auto last_col = static_cast<float>(cols_ - 1);
+      const uint32_t cols = cols_;
+      const float max_elevation = max_elevation_;
+      const float row_scale = row_scale_;
+      const float inverse_resolution = inverse_resolution_;
+      for (size_t i = 0; i < size; ++i) {
+        // the elevations below the horizon are in (3 pi / 2, 2 pi)
+        const float elevation = elevations[i] + (pi < elevations[i] ? -2.0f * pi : 0.0f);
+        const float row = (max_elevation - elevation) * row_scale;
+        // false for NaN, and for the points at the origin or with a NaN coordinate
+        const bool valid = (0.0f <= row) & (row < rings) & (0.0f < point_ranges[i]);
+        // the clamps also replace the NaN by 0 before the conversions
+        const float col = azimuths[i] * inverse_resolution;
+        const auto row_index = static_cast<int32_t>(std::max(0.0f, std::min(row, rings - 1.0f)));
+        const auto col_index = static_cast<int32_t>(std::max(0.0f, std::min(col, last_col)));
+        pixels[i] = (static_cast<uint32_t>(row_index) * cols + static_cast<uint32_t>(col_index)) |
+                    (valid ? 0u : none);
+      }
+    }
+
+    std::fill(indices_.begin(), indices_.end(), none);
+    std::fill(ranges_.begin(), ranges_.end(), std::numeric_limits<float>::infinity());
+    for (size_t i = 0; i < size; ++i) {
+      const uint32_t pixel = pixels_[i];
+      if (pixel != none && point_ranges_[i] < ranges_[pixel]) {
+        ranges_[pixel] = point_ranges_[i];
+        indices_[pixel] = static_cast<uint32_t>(i);
+      }
+    }
+  }
+
+  uint32_t rows() const { return rings_; }
+  uint32_t cols() const { return cols_; }
+
+  /**
+   * @brief Get the index of the nearest point of a pixel in the last cloud, or none
+   */
+  uint32_t index(const uint32_t row, const uint32_t col) const
+  {
+    return indices_[row * cols_ + col];
+  }
+
+  /**
+   * @brief Get the range of the nearest point of a pixel in the last cloud, or infinity
+   */
+  float range(const uint32_t row, const uint32_t col) const { return ranges_[row * cols_ + col]; }
+
+  /**
+   * @brief Get the indices of the nearest points of the pixels, row by row
+   */
+  const std::vector<uint32_t> & indices() const { return indices_; }
+
+  /**
+   * @brief Get the ranges of the nearest points of the pixels, row by row
+   */
+  const std::vector<float> & ranges() const { return ranges_; }
+
+  /**
+   * @brief Get the pixel of each point of the last cloud, row * cols() + col, or none
+   */
+  const std::vector<uint32_t> & pixels() const { return pixels_; }
+
+private:
+  uint32_t rings_;
+  uint32_t cols_{0};
+  float inverse_resolution_;
+  float max_elevation_;
+  float row_scale_;  //!< Rows per radian of elevation
+  std::vector<uint32_t> indices_;
+  std::vector<float> ranges_;
+
+  // buffers of the points, reused across the clouds
+  std::vector<float> x_;
+  std::vector<float> y_;
+  std::vector<float> z_;
+  std::vector<float> horizontal_;
+  std::vector<float> point_ranges_;
+  std::vector<float> azimuths_;
+  std::vector<float> elevations_;
+  std::vector<uint32_t> pixels_;
+};
+
+}  // namespace autoware_utils_pcl
+
+#endif  // AUTOWARE_UTILS_PCL__RANGE_IMAGE_HPP_
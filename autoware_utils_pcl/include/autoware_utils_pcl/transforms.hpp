@@ -15,21 +15,176 @@
 #ifndef AUTOWARE_UTILS_PCL__TRANSFORMS_HPP_
 #define AUTOWARE_UTILS_PCL__TRANSFORMS_HPP_
 
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <autoware_utils_system/thread_pool.hpp>
+
 #include <Eigen/Core>
 #include <rclcpp/rclcpp.hpp>
 
 #include <pcl/common/transforms.h>
 #include <pcl/point_cloud.h>
 
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
 namespace autoware_utils_pcl
 {
+namespace detail
+{
+/// @brief warn that the input is empty, at most once per period as all the clouds may be empty
+inline void warn_empty_input()
+{
+  using std::chrono::steady_clock;
+  constexpr auto period =
+    std::chrono::duration_cast<steady_clock::duration>(std::chrono::seconds(5)).count();
+  static std::atomic<steady_clock::rep> next_warning{
+    std::numeric_limits<steady_clock::rep>::min()};
+  const auto now = steady_clock::now().time_since_epoch().count();
+  auto next = next_warning.load(std::memory_order_relaxed);
+  if (now < next || !next_warning.compare_exchange_strong(next, now + period)) {
+    return;
+  }
+  RCLCPP_WARN(rclcpp::get_logger("transform_pointcloud"), "input point cloud is empty!");
+}
+
+/// @brief offset of a FLOAT32 field of a point, checking the layout of the cloud
+inline size_t float_field_offset(
+  const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+{
+  const PointCloud2Layout layout(cloud);
+  for (const auto & field : cloud.fields) {
+    if (field.name == name) {
+      if (field.datatype != sensor_msgs::msg::PointField::FLOAT32) {
+        throw std::invalid_argument("The field " + name + " is not FLOAT32.");
+      }
+      if (field.offset + sizeof(float) > layout.point_step()) {
+        throw std::invalid_argument("The field " + name + " exceeds the point step.");
+      }
+      return field.offset;
+    }
+  }
+  throw std::invalid_argument("The point cloud has no field " + name + ".");
+}
+
+/// @brief transform the x, y and z of the points of a buffer in place
+inline void transform_points(
+  uint8_t * data, const size_t count, const size_t point_step, const size_t (&offsets)[3],
+  const Eigen::Matrix<float, 4, 4> & transform)
+{
+  // the elements in locals, so that they stay in registers across the points
+  const float r00 = transform(0, 0), r01 = transform(0, 1), r02 = transform(0, 2);
+  const float r10 = transform(1, 0), r11 = transform(1, 1), r12 = transform(1, 2);
+  const float r20 = transform(2, 0), r21 = transform(2, 1), r22 = transform(2, 2);
+  const float t0 = transform(0, 3), t1 = transform(1, 3), t2 = transform(2, 3);
+  for (size_t i = 0; i < count; ++i) {
+    uint8_t * point = data + i * point_step;
+    float x;
+    float y;
+    float z;
+    std::memcpy(&x, point + offsets[0], sizeof(float));
+    std::memcpy(&y, point + offsets[1], sizeof(float));
+    std::memcpy(&z, point + offsets[2], sizeof(float));
+    const float tx = r00 * x + r01 * y + r02 * z + t0;
+    const float ty = r10 * x + r11 * y + r12 * z + t1;
+    const float tz = r20 * x + r21 * y + r22 * z + t2;
+    std::memcpy(point + offsets[0], &tx, sizeof(float));
+    std::memcpy(point + offsets[1], &ty, sizeof(float));
+    std::memcpy(point + offsets[2], &tz, sizeof(float));
+  }
+}
+
+/// @brief offsets of the x, y and z of a point, checking the layout of the cloud
+inline void xyz_offsets(const sensor_msgs::msg::PointCloud2 & cloud, size_t (&offsets)[3])
+{
+  offsets[0] = float_field_offset(cloud, "x");
+  offsets[1] = float_field_offset(cloud, "y");
+  offsets[2] = float_field_offset(cloud, "z");
+}
+
+/**
+ * @brief copy the points of a range of indices, unless in_data is null, and transform them by
+ * blocks with kernel(data, count)
+ */
+template <typename Kernel>
+void transform_range(
+  const sensor_msgs::msg::PointCloud2 & cloud, const uint8_t * in_data, uint8_t * out_data,
+  size_t begin, const size_t end, const Kernel & kernel)
+{
+  constexpr size_t block_size = 256;  // points, a few KB which stay in L1 cache
+
+  // the blocks do not cross the rows, which may be padded
+  while (begin < end) {
+    const size_t row = begin / cloud.width;
+    const size_t col = begin % cloud.width;
+    const size_t count = std::min({block_size, cloud.width - col, end - begin});
+    const size_t offset = row * cloud.row_step + col * cloud.point_step;
+    if (in_data != nullptr) {
+      std::memcpy(out_data + offset, in_data + offset, count * cloud.point_step);
+    }
+    kernel(out_data + offset, count);
+    begin += count;
+  }
+}
+
+/// @brief transform_range() with a single transform
+inline void transform_range(
+  const sensor_msgs::msg::PointCloud2 & cloud, const uint8_t * in_data, uint8_t * out_data,
+  const size_t begin, const size_t end, const size_t (&offsets)[3],
+  const Eigen::Matrix<float, 4, 4> & transform)
+{
+  transform_range(cloud, in_data, out_data, begin, end, [&](uint8_t * data, size_t count) {
+    transform_points(data, count, cloud.point_step, offsets, transform);
+  });
+}
+
+/// @brief copy the metadata of a cloud and resize the data of the output, reusing its memory
+inline void prepare_output(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, sensor_msgs::msg::PointCloud2 & cloud_out)
+{
+  cloud_out.header = cloud_in.header;
+  cloud_out.height = cloud_in.height;
+  cloud_out.width = cloud_in.width;
+  cloud_out.fields = cloud_in.fields;
+  cloud_out.is_bigendian = cloud_in.is_bigendian;
+  cloud_out.point_step = cloud_in.point_step;
+  cloud_out.row_step = cloud_in.row_step;
+  cloud_out.is_dense = cloud_in.is_dense;
+  cloud_out.data.resize(cloud_in.data.size());
+}
+}  // namespace detail
+
+/**
+ * @brief Transform a point cloud into another point cloud
+ *
+ * The input is copied without the arithmetic if the transform is within the epsilon of the
+ * identity. An empty input is warned about, at most every 5 seconds, and leaves the output as is.
+ *
+ * @param cloud_in Input cloud
+ * @param cloud_out Transformed cloud
+ * @param transform Transformation matrix
+ * @param identity_epsilon Tolerance of the elements of the transform, under which it is the
+ * identity
+ */
 template <typename PointT>
 void transform_pointcloud(
   const pcl::PointCloud<PointT> & cloud_in, pcl::PointCloud<PointT> & cloud_out,
-  const Eigen::Matrix<float, 4, 4> & transform)
+  const Eigen::Matrix<float, 4, 4> & transform, const float identity_epsilon = 0.0f)
 {
   if (cloud_in.empty() || cloud_in.width == 0) {
-    RCLCPP_WARN(rclcpp::get_logger("transform_pointcloud"), "input point cloud is empty!");
+    detail::warn_empty_input();
+  } else if (transform.isIdentity(identity_epsilon)) {
+    cloud_out = cloud_in;
   } else {
     pcl::transformPointCloud(cloud_in, cloud_out, transform);
   }
@@ -38,13 +193,177 @@ void transform_pointcloud(
 template <typename PointT>
 void transform_pointcloud(
   const pcl::PointCloud<PointT> & cloud_in, pcl::PointCloud<PointT> & cloud_out,
-  const Eigen::Affine3f & transform)
+  const Eigen::Affine3f & transform, const float identity_epsilon = 0.0f)
 {
-  if (cloud_in.empty() || cloud_in.width == 0) {
-    RCLCPP_WARN(rclcpp::get_logger("transform_pointcloud"), "input point cloud is empty!");
-  } else {
-    pcl::transformPointCloud(cloud_in, cloud_out, transform);
+  transform_pointcloud(cloud_in, cloud_out, transform.matrix(), identity_epsilon);
+}
+
+/**
+ * @brief Transform a point cloud in place, without the copy of an output cloud
+ *
+ * The pass is skipped if the transform is within the epsilon of the identity. An empty cloud is
+ * warned about, at most every 5 seconds.
+ *
+ * @param cloud Cloud to transform
+ * @param transform Transformation matrix
+ * @param identity_epsilon Tolerance of the elements of the transform, under which it is the
+ * identity
+ */
+template <typename PointT>
+void transform_pointcloud(
+  pcl::PointCloud<PointT> & cloud, const Eigen::Matrix<float, 4, 4> & transform,
+  const float identity_epsilon = 0.0f)
+{
+  if (cloud.empty() || cloud.width == 0) {
+    detail::warn_empty_input();
+    return;
+  }
+  if (transform.isIdentity(identity_epsilon)) {
+    return;
+  }
+  const pcl::detail::Transformer<float> tf(transform);
+  for (auto & point : cloud.points) {
+    // se3() reads its input after writing its output
+    float xyz[4];
+    std::memcpy(xyz, point.data, sizeof(xyz));
+    tf.se3(xyz, point.data);
+  }
+}
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 in place, without converting it to PCL
+ *
+ * @param cloud Cloud with the FLOAT32 fields x, y and z
+ * @param transform Transformation matrix
+ * @param identity_epsilon Tolerance of the elements of the transform, under which it is the
+ * identity and the pass is skipped
+ * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+ * does not match its steps
+ */
+inline void transform_pointcloud(
+  sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix<float, 4, 4> & transform,
+  const float identity_epsilon = 0.0f)
+{
+  size_t offsets[3];
+  detail::xyz_offsets(cloud, offsets);
+  if (transform.isIdentity(identity_epsilon)) {
+    return;
   }
+  const size_t size = static_cast<size_t>(cloud.width) * cloud.height;
+  detail::transform_range(cloud, nullptr, cloud.data.data(), 0, size, offsets, transform);
+}
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 in place, in chunks run by a thread pool
+ *
+ * @param cloud Cloud with the FLOAT32 fields x, y and z
+ * @param transform Transformation matrix
+ * @param pool Threads running the chunks, e.g. autoware_utils_system::ThreadPool::shared()
+ * @param grain_size Number of points per chunk, whose data should fit in the L2 cache
+ * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+ * does not match its steps
+ */
+inline void transform_pointcloud(
+  sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix<float, 4, 4> & transform,
+  autoware_utils_system::ThreadPool & pool, const size_t grain_size = 8192)
+{
+  size_t offsets[3];
+  detail::xyz_offsets(cloud, offsets);
+  pool.parallel_for(
+    0, static_cast<size_t>(cloud.width) * cloud.height, grain_size,
+    [&](const size_t begin, const size_t end) {
+      detail::transform_range(cloud, nullptr, cloud.data.data(), begin, end, offsets, transform);
+    });
+}
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 into another PointCloud2, without converting
+ * them to PCL
+ *
+ * The other fields are copied with memcpy by blocks of points, each block being transformed
+ * while it is in cache. The data of the output is resized, reusing its memory, and its header
+ * is the header of the input, of which the caller sets the frame.
+ *
+ * @param cloud_in Cloud with the FLOAT32 fields x, y and z
+ * @param cloud_out Transformed cloud, which must not be the input
+ * @param transform Transformation matrix
+ * @param identity_epsilon Tolerance of the elements of the transform, under which it is the
+ * identity and the data is copied as is
+ * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+ * does not match its steps
+ */
+inline void transform_pointcloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, sensor_msgs::msg::PointCloud2 & cloud_out,
+  const Eigen::Matrix<float, 4, 4> & transform, const float identity_epsilon = 0.0f)
+{
+  size_t offsets[3];
+  detail::xyz_offsets(cloud_in, offsets);
+  detail::prepare_output(cloud_in, cloud_out);
+  if (transform.isIdentity(identity_epsilon)) {
+    std::copy(cloud_in.data.begin(), cloud_in.data.end(), cloud_out.data.begin());
+    return;
+  }
+  const size_t size = static_cast<size_t>(cloud_in.width) * cloud_in.height;
+  detail::transform_range(
+    cloud_in, cloud_in.data.data(), cloud_out.data.data(), 0, size, offsets, transform);
+}
+
+/**
+ * @brief Transform the x, y and z of a PointCloud2 into another PointCloud2, in chunks run by a
+ * thread pool
+ *
+ * @param cloud_in Cloud with the FLOAT32 fields x, y and z
+ * @param cloud_out Transformed cloud, which must not be the input
+ * @param transform Transformation matrix
+ * @param pool Threads running the chunks, e.g. autoware_utils_system::ThreadPool::shared()
+ * @param grain_size Number of points per chunk, whose data should fit in the L2 cache
+ * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+ * does not match its steps
+ */
+inline void transform_pointcloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, sensor_msgs::msg::PointCloud2 & cloud_out,
+  const Eigen::Matrix<float, 4, 4> & transform, autoware_utils_system::ThreadPool & pool,
+  const size_t grain_size = 8192)
+{
+  size_t offsets[3];
+  detail::xyz_offsets(cloud_in, offsets);
+  detail::prepare_output(cloud_in, cloud_out);
+  pool.parallel_for(
+    0, static_cast<size_t>(cloud_in.width) * cloud_in.height, grain_size,
+    [&](const size_t begin, const size_t end) {
+      detail::transform_range(
+        cloud_in, cloud_in.data.data(), cloud_out.data.data(), begin, end, offsets, transform);
+    });
+}
+
+/**
+ * @brief Transform a point cloud, in chunks run by a thread pool
+ *
+ * @param cloud_in Input cloud
+ * @param cloud_out Transformed cloud, which must not be the input
+ * @param transform Transformation matrix
+ * @param pool Threads running the chunks, e.g. autoware_utils_system::ThreadPool::shared()
+ * @param grain_size Number of points per chunk, whose data should fit in the L2 cache
+ */
+template <typename PointT>
+void transform_pointcloud(
+  const pcl::PointCloud<PointT> & cloud_in, pcl::PointCloud<PointT> & cloud_out,
+  const Eigen::Matrix<float, 4, 4> & transform, autoware_utils_system::ThreadPool & pool,
+  const size_t grain_size = 8192)
+{
+  cloud_out.header = cloud_in.header;
+  cloud_out.width = cloud_in.width;
+  cloud_out.height = cloud_in.height;
+  cloud_out.is_dense = cloud_in.is_dense;
+  cloud_out.points.resize(cloud_in.points.size());
+  const pcl::detail::Transformer<float> tf(transform);
+  pool.parallel_for(
+    0, cloud_in.points.size(), grain_size, [&](const size_t begin, const size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        cloud_out.points[i] = cloud_in.points[i];
+        tf.se3(cloud_in.points[i].data, cloud_out.points[i].data);
+      }
+    });
 }
 }  // namespace autoware_utils_pcl
 
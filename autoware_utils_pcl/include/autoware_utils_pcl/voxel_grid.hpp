@@ -0,0 +1,243 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_PCL__VOXEL_GRID_HPP_
+#define AUTOWARE_UTILS_PCL__VOXEL_GRID_HPP_
+
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_pcl
+{
+/**
+ * @brief Point written for each voxel
+ */
+enum class VoxelPoint {
+  centroid,  //!< First point of the voxel, with the x, y and z of the centroid of its points
+  first,     //!< First point of the voxel, unchanged
+};
+
+/**
+ * @brief Voxel grid downsampling of PointCloud2 messages, reusing its buffers across the clouds
+ *
+ * The voxels are found in an open-addressing hash table in a single pass over the points, which
+ * are read in place, instead of sorting the indices of the points as pcl::VoxelGrid does. The
+ * voxels are written in the order of their first point. The points with a NaN or infinite
+ * coordinate, or too far for the 32 bits indices of the voxels, are removed. The table and the
+ * sums are kept, so that a downsampler reused for the clouds of a topic does not allocate once it
+ * has seen the largest cloud.
+ */
+class VoxelGrid
+{
+public:
+  /**
+   * @brief Construct a new VoxelGrid object
+   *
+   * @param leaf_size Size of the voxels, in meters
+   * @param mode Point written for each voxel
+   * @throw std::invalid_argument if the leaf size is not positive
+   */
+  explicit VoxelGrid(const float leaf_size, const VoxelPoint mode = VoxelPoint::centroid)
+  : inverse_leaf_size_(1.0f / leaf_size), mode_(mode)
+  {
+    if (!(0.0f < leaf_size)) {
+      throw std::invalid_argument("The leaf size is not positive.");
+    }
+  }
+
+  /**
+   * @brief Downsample a cloud
+   *
+   * The output has the fields and the header of the input, and is not organized.
+   *
+   * @param cloud_in Cloud with the FLOAT32 fields x, y and z
+   * @param cloud_out Downsampled cloud, which must not be the input
+   * @throw std::invalid_argument if a field is missing or is not FLOAT32, or the data of the cloud
+   * does not match its steps
+   */
+  void filter(
+    const sensor_msgs::msg::PointCloud2 & cloud_in, sensor_msgs::msg::PointCloud2 & cloud_out)
+  {
+    const PointCloud2FieldView<float> xs(cloud_in, "x");
+    const PointCloud2FieldView<float> ys(cloud_in, "y");
+    const PointCloud2FieldView<float> zs(cloud_in, "z");
+    reset(xs.size());
+
+    auto x = xs.begin();
+    auto y = ys.begin();
+    auto z = zs.begin();
+    for (size_t i = 0; i < xs.size(); ++i, ++x, ++y, ++z) {
+      const float px = *x;
+      const float py = *y;
+      const float pz = *z;
+      const float vx = std::floor(px * inverse_leaf_size_);
+      const float vy = std::floor(py * inverse_leaf_size_);
+      const float vz = std::floor(pz * inverse_leaf_size_);
+      // false for NaN, and for the indices beyond 32 bits
+      constexpr float limit = 2147483648.0f;
+      if (!(std::abs(vx) < limit && std::abs(vy) < limit && std::abs(vz) < limit)) {
+        continue;
+      }
+      const Key key{static_cast<int32_t>(vx), static_cast<int32_t>(vy), static_cast<int32_t>(vz)};
+      Voxel & voxel = find_or_add(key, i);
+      voxel.sum_x += px;
+      voxel.sum_y += py;
+      voxel.sum_z += pz;
+      ++voxel.count;
+    }
+
+    write(cloud_in, xs, cloud_out);
+  }
+
+  /**
+   * @brief Get the number of voxels of the last cloud
+   */
+  size_t size() const { return voxels_.size(); }
+
+private:
+  struct Key
+  {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    bool operator==(const Key & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  struct Slot
+  {
+    Key key;
+    uint32_t voxel;       //!< Index of the voxel
+    uint32_t generation;  //!< Cloud which set the slot, so that the table is not cleared
+  };
+
+  struct Voxel
+  {
+    double sum_x;
+    double sum_y;
+    double sum_z;
+    uint32_t count;
+    size_t first;  //!< Index of the first point
+  };
+
+  static size_t hash(const Key & key)
+  {
+    // the primes of the spatial hashing of Teschner et al.
+    return (static_cast<uint32_t>(key.x) * 73856093u) ^
+           (static_cast<uint32_t>(key.y) * 19349663u) ^
+           (static_cast<uint32_t>(key.z) * 83492791u);
+  }
+
+  void reset(const size_t points)
+  {
+    voxels_.clear();
+    // at most half full, so that the probes stay short
+    size_t capacity = 16;
+    while (capacity < 2 * points) {
+      capacity *= 2;
+    }
+    if (slots_.size() < capacity) {
+      slots_.assign(capacity, Slot{Key{0, 0, 0}, 0, 0});
+      generation_ = 0;
+    }
+    mask_ = capacity - 1;
+    if (++generation_ == 0) {
+      std::fill(slots_.begin(), slots_.end(), Slot{Key{0, 0, 0}, 0, 0});
+      generation_ = 1;
+    }
+  }
+
+  Voxel & find_or_add(const Key & key, const size_t point)
+  {
+    for (size_t index = hash(key) & mask_;; index = (index + 1) & mask_) {
+      Slot & slot = slots_[index];
+      if (slot.generation != generation_) {
+        slot = Slot{key, static_cast<uint32_t>(voxels_.size()), generation_};
+        return voxels_.emplace_back(Voxel{0.0, 0.0, 0.0, 0, point});
+      }
+      if (slot.key == key) {
+        return voxels_[slot.voxel];
+      }
+    }
+  }
+
+  void write(
+    const sensor_msgs::msg::PointCloud2 & cloud_in, const PointCloud2Layout & layout,
+    sensor_msgs::msg::PointCloud2 & cloud_out) const
+  {
+    cloud_out.header = cloud_in.header;
+    cloud_out.fields = cloud_in.fields;
+    cloud_out.is_bigendian = cloud_in.is_bigendian;
+    cloud_out.point_step = cloud_in.point_step;
+    cloud_out.height = 1;
+    cloud_out.width = static_cast<uint32_t>(voxels_.size());
+    cloud_out.row_step = cloud_out.width * cloud_out.point_step;
+    cloud_out.is_dense = true;
+    cloud_out.data.resize(static_cast<size_t>(cloud_out.row_step));
+
+    const size_t offsets[] = {
+      field_offset(cloud_in, "x"), field_offset(cloud_in, "y"), field_offset(cloud_in, "z")};
+    uint8_t * out = cloud_out.data.data();
+    for (const Voxel & voxel : voxels_) {
+      const size_t row = voxel.first / layout.width();
+      const size_t col = voxel.first % layout.width();
+      std::memcpy(
+        out, cloud_in.data.data() + row * layout.row_step() + col * layout.point_step(),
+        layout.point_step());
+      if (mode_ == VoxelPoint::centroid) {
+        const float centroid[] = {
+          static_cast<float>(voxel.sum_x / voxel.count),
+          static_cast<float>(voxel.sum_y / voxel.count),
+          static_cast<float>(voxel.sum_z / voxel.count)};
+        for (size_t k = 0; k < 3; ++k) {
+          std::memcpy(out + offsets[k], &centroid[k], sizeof(float));
+        }
+      }
+      out += layout.point_step();
+    }
+  }
+
+  static size_t field_offset(const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+  {
+    for (const auto & field : cloud.fields) {
+      if (field.name == name) {
+        return field.offset;
+      }
+    }
+    return 0;  // checked by the views
+  }
+
+  float inverse_leaf_size_;
+  VoxelPoint mode_;
+  std::vector<Slot> slots_;
+  std::vector<Voxel> voxels_;
+  size_t mask_{0};
+  uint32_t generation_{0};
+};
+
+}  // namespace autoware_utils_pcl
+
+#endif  // AUTOWARE_UTILS_PCL__VOXEL_GRID_HPP_
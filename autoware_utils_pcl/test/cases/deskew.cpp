@@ -0,0 +1,101 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/deskew.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 create_cloud(const uint8_t time_datatype)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.height = 1;
+  cloud.width = 4;
+  const char * names[] = {"x", "y", "z", "time_stamp"};
+  for (uint32_t i = 0; i < 4; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = i < 3 ? PointField::FLOAT32 : time_datatype;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 16;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step);
+  return cloud;
+}
+
+void expect_point(
+  const sensor_msgs::msg::PointCloud2 & cloud, const size_t i, const float x, const float y,
+  const float z)
+{
+  float point[3];
+  std::memcpy(point, cloud.data.data() + i * cloud.point_step, sizeof(point));
+  EXPECT_NEAR(point[0], x, 1e-5) << i;
+  EXPECT_NEAR(point[1], y, 1e-5) << i;
+  EXPECT_NEAR(point[2], z, 1e-5) << i;
+}
+}  // namespace
+
+TEST(deskew, transform_point_cloud2)
+{
+  // the sensor turns by 90 degrees and moves by 1 meter in 0.1 second
+  autoware_utils_pcl::SensorMotion motion;
+  motion.end.block<3, 3>(0, 0) =
+    Eigen::AngleAxisf(static_cast<float>(M_PI_2), Eigen::Vector3f::UnitZ()).toRotationMatrix();
+  motion.end(0, 3) = 1.0f;
+  motion.end_time = 0.1;
+
+  auto cloud = create_cloud(sensor_msgs::msg::PointField::UINT32);
+  const uint32_t times[] = {0, 50'000'000, 100'000'000, 200'000'000};
+  for (size_t i = 0; i < 4; ++i) {
+    const float point[] = {1.0f, 0.0f, 2.0f};
+    std::memcpy(cloud.data.data() + i * cloud.point_step, point, sizeof(point));
+    std::memcpy(cloud.data.data() + i * cloud.point_step + 12, &times[i], sizeof(uint32_t));
+  }
+
+  sensor_msgs::msg::PointCloud2 cloud_out;
+  autoware_utils_pcl::transform_pointcloud(cloud, cloud_out, motion);
+  const float half = static_cast<float>(M_SQRT1_2);
+  expect_point(cloud_out, 0, 1.0f, 0.0f, 2.0f);
+  expect_point(cloud_out, 1, 0.5f + half, half, 2.0f);
+  expect_point(cloud_out, 2, 1.0f, 1.0f, 2.0f);
+  // the times after the end of the motion are clamped
+  expect_point(cloud_out, 3, 1.0f, 1.0f, 2.0f);
+
+  autoware_utils_pcl::transform_pointcloud(cloud, motion);
+  EXPECT_EQ(cloud.data, cloud_out.data);
+
+  // the times in seconds
+  auto seconds = create_cloud(sensor_msgs::msg::PointField::FLOAT32);
+  const float point[] = {1.0f, 0.0f, 2.0f, 0.05f};
+  std::memcpy(seconds.data.data(), point, sizeof(point));
+  autoware_utils_pcl::transform_pointcloud(seconds, motion);
+  expect_point(seconds, 0, 0.5f + half, half, 2.0f);
+
+  EXPECT_THROW(
+    autoware_utils_pcl::transform_pointcloud(seconds, motion, "time"), std::invalid_argument);
+  seconds.fields[3].datatype = sensor_msgs::msg::PointField::INT8;
+  EXPECT_THROW(autoware_utils_pcl::transform_pointcloud(seconds, motion), std::invalid_argument);
+  motion.end_time = -1.0;
+  EXPECT_THROW(autoware_utils_pcl::transform_pointcloud(cloud, motion), std::invalid_argument);
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/pcl_conversion.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <cstring>
+
+TEST(pcl_conversion, transform_point_cloud_from_ros_msg)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  cloud.height = 1;
+  cloud.width = 2;
+  // the intensity comes first, so that x, y and z are not at the start of the point
+  const char * names[] = {"intensity", "x", "y", "z"};
+  for (uint32_t i = 0; i < 4; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 16;
+  cloud.row_step = 32;
+  const float data[] = {5.0f, 1.0f, 2.0f, 3.0f, 6.0f, -1.0f, 0.0f, 1.0f};
+  cloud.data.resize(sizeof(data));
+  std::memcpy(cloud.data.data(), data, sizeof(data));
+
+  Eigen::Matrix4f transform = Eigen::Matrix4f::Identity();
+  transform(0, 3) = 10.0f;
+  transform(2, 3) = -1.0f;
+  pcl::PointCloud<pcl::PointXYZI> pcl_cloud;
+  autoware_utils_pcl::transform_point_cloud_from_ros_msg(cloud, pcl_cloud, transform);
+
+  ASSERT_EQ(pcl_cloud.points.size(), 2u);
+  EXPECT_EQ(pcl_cloud.header.frame_id, "base_link");
+  EXPECT_FLOAT_EQ(pcl_cloud.points[0].x, 11.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[0].y, 2.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[0].z, 2.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[0].intensity, 5.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[1].x, 9.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[1].intensity, 6.0f);
+
+  // the chunks of one point are run by the threads of the pool
+  autoware_utils_system::ThreadPool pool({1, {}, 0});
+  pcl::PointCloud<pcl::PointXYZI> parallel_cloud;
+  autoware_utils_pcl::transform_point_cloud_from_ros_msg(
+    cloud, parallel_cloud, transform, pool, 1);
+  ASSERT_EQ(parallel_cloud.points.size(), 2u);
+  EXPECT_FLOAT_EQ(parallel_cloud.points[0].x, 11.0f);
+  EXPECT_FLOAT_EQ(parallel_cloud.points[1].intensity, 6.0f);
+}
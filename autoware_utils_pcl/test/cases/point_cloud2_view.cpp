@@ -0,0 +1,102 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/point_cloud2_view.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+sensor_msgs::msg::PointField make_field(const std::string & name, uint32_t offset, uint8_t datatype)
+{
+  sensor_msgs::msg::PointField field;
+  field.name = name;
+  field.offset = offset;
+  field.datatype = datatype;
+  field.count = 1;
+  return field;
+}
+
+/// @brief 2 rows of 2 points of x, y, z, intensity and ring, with a padded point step and row step
+sensor_msgs::msg::PointCloud2 make_cloud()
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.height = 2;
+  cloud.width = 2;
+  cloud.fields = {
+    make_field("x", 0, PointField::FLOAT32), make_field("y", 4, PointField::FLOAT32),
+    make_field("z", 8, PointField::FLOAT32), make_field("intensity", 12, PointField::FLOAT32),
+    make_field("ring", 16, PointField::UINT16)};
+  cloud.point_step = 20;
+  cloud.row_step = 48;
+  cloud.data.resize(cloud.row_step * cloud.height);
+  for (uint32_t i = 0; i < 4; ++i) {
+    uint8_t * point = cloud.data.data() + (i / 2) * cloud.row_step + (i % 2) * cloud.point_step;
+    const float values[] = {1.0f * i, 2.0f * i, 3.0f * i, 10.0f + i};
+    const uint16_t ring = static_cast<uint16_t>(i);
+    std::memcpy(point, values, sizeof(values));
+    std::memcpy(point + 16, &ring, sizeof(ring));
+  }
+  return cloud;
+}
+}  // namespace
+
+TEST(point_cloud2_view, field_view)
+{
+  const auto cloud = make_cloud();
+  const autoware_utils_pcl::PointCloud2FieldView<uint16_t> rings(cloud, "ring");
+  ASSERT_EQ(rings.size(), 4u);
+  EXPECT_EQ(rings[3], 3u);
+
+  using autoware_utils_pcl::PointCloud2FieldView;
+  std::vector<float> intensities;
+  for (const float intensity : PointCloud2FieldView<float>(cloud, "intensity")) {
+    intensities.push_back(intensity);
+  }
+  EXPECT_EQ(intensities, (std::vector<float>{10.0f, 11.0f, 12.0f, 13.0f}));
+
+  EXPECT_THROW(PointCloud2FieldView<float>(cloud, "ring"), std::invalid_argument);
+  EXPECT_THROW(PointCloud2FieldView<float>(cloud, "time"), std::invalid_argument);
+  auto truncated = cloud;
+  truncated.data.resize(10);
+  EXPECT_THROW(PointCloud2FieldView<float>(truncated, "x"), std::invalid_argument);
+}
+
+TEST(point_cloud2_view, point_view)
+{
+  const auto cloud = make_cloud();
+  const autoware_utils_pcl::PointCloud2View<pcl::PointXYZI> points(cloud);
+  ASSERT_EQ(points.size(), 4u);
+  EXPECT_FLOAT_EQ(points[2].y, 4.0f);
+
+  size_t count = 0;
+  for (const auto & point : points) {
+    EXPECT_FLOAT_EQ(point.z, 3.0f * count);
+    EXPECT_FLOAT_EQ(point.intensity, 10.0f + count);
+    ++count;
+  }
+  EXPECT_EQ(count, 4u);
+
+  sensor_msgs::msg::PointCloud2 empty;
+  const autoware_utils_pcl::PointCloud2View<pcl::PointXYZI> empty_points(empty);
+  EXPECT_TRUE(empty_points.begin() == empty_points.end());
+}
@@ -0,0 +1,110 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/point_cloud_filter.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/point_types.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 create_cloud(const size_t size)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  cloud.height = 1;
+  cloud.width = size;
+  const char * names[] = {"x", "y", "z", "intensity"};
+  for (uint32_t i = 0; i < 4; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 16;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step);
+  return cloud;
+}
+
+void set_point(sensor_msgs::msg::PointCloud2 & cloud, const size_t i, const float (&point)[4])
+{
+  std::memcpy(cloud.data.data() + i * cloud.point_step, point, sizeof(point));
+}
+}  // namespace
+
+TEST(point_cloud_filter, transform_filter_point_cloud_from_ros_msg)
+{
+  // the points are on a line in the input frame, spanning more than one block
+  auto cloud = create_cloud(1000);
+  for (size_t i = 0; i < 1000; ++i) {
+    set_point(cloud, i, {0.1f * i, 0.0f, 0.0f, 1.0f * i});
+  }
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  set_point(cloud, 10, {nan, 0.0f, 0.0f, 10.0f});
+
+  Eigen::Matrix4f transform = Eigen::Matrix4f::Identity();
+  transform(1, 3) = 2.0f;
+  pcl::PointCloud<pcl::PointXYZI> pcl_cloud;
+
+  autoware_utils_pcl::PointCloudFilter filter;
+  autoware_utils_pcl::transform_filter_point_cloud_from_ros_msg(
+    cloud, pcl_cloud, transform, filter);
+  ASSERT_EQ(pcl_cloud.points.size(), 999u);
+  EXPECT_EQ(pcl_cloud.width, 999u);
+  EXPECT_EQ(pcl_cloud.height, 1u);
+  EXPECT_TRUE(pcl_cloud.is_dense);
+  EXPECT_EQ(pcl_cloud.header.frame_id, "base_link");
+  EXPECT_FLOAT_EQ(pcl_cloud.points[10].intensity, 11.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points[10].y, 2.0f);
+
+  // the range is measured in the input frame, and the box in the output frame
+  filter.min_range = 1.0f;
+  filter.max_range = 80.0f;
+  filter.box =
+    Eigen::AlignedBox3f(Eigen::Vector3f(-1.0f, 1.0f, -1.0f), Eigen::Vector3f(50.0f, 3.0f, 1.0f));
+  autoware_utils_pcl::transform_filter_point_cloud_from_ros_msg(
+    cloud, pcl_cloud, transform, filter);
+  ASSERT_EQ(pcl_cloud.points.size(), 490u);
+  EXPECT_FLOAT_EQ(pcl_cloud.points.front().intensity, 11.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points.back().intensity, 500.0f);
+
+  // the polygon keeps the points of the output frame in x and y
+  namespace alt = autoware_utils_geometry::alt;
+  const auto polygon = alt::StaticConvexPolygon2f<4>::create(
+    {alt::Point2f(20.0f, 0.0f), alt::Point2f(20.0f, 4.0f), alt::Point2f(30.0f, 4.0f),
+     alt::Point2f(30.0f, 0.0f)});
+  ASSERT_TRUE(polygon);
+  filter.polygon = *polygon;
+  autoware_utils_pcl::transform_filter_point_cloud_from_ros_msg(
+    cloud, pcl_cloud, transform, filter);
+  ASSERT_EQ(pcl_cloud.points.size(), 101u);
+  EXPECT_FLOAT_EQ(pcl_cloud.points.front().intensity, 200.0f);
+  EXPECT_FLOAT_EQ(pcl_cloud.points.back().intensity, 300.0f);
+
+  filter.min_range = 100.0f;
+  EXPECT_THROW(
+    autoware_utils_pcl::transform_filter_point_cloud_from_ros_msg(
+      cloud, pcl_cloud, transform, filter),
+    std::invalid_argument);
+}
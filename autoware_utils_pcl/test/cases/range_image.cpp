@@ -0,0 +1,147 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/range_image.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+constexpr float deg = 3.14159265358979f / 180.0f;
+
+sensor_msgs::msg::PointCloud2 create_cloud(const std::vector<std::vector<float>> & points)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.height = 1;
+  cloud.width = points.size();
+  const char * names[] = {"x", "y", "z"};
+  for (uint32_t i = 0; i < 3; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 12;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step);
+  for (size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(cloud.data.data() + i * cloud.point_step, points[i].data(), 12);
+  }
+  return cloud;
+}
+
+std::vector<float> spherical_point(const float range, const float azimuth, const float elevation)
+{
+  const float horizontal = range * std::cos(elevation);
+  return {
+    horizontal * std::cos(azimuth), horizontal * std::sin(azimuth), range * std::sin(elevation)};
+}
+}  // namespace
+
+TEST(range_image, project)
+{
+  using autoware_utils_pcl::RangeImage;
+  EXPECT_THROW(RangeImage(0, 1.0f * deg, -15.0f * deg, 15.0f * deg), std::invalid_argument);
+  EXPECT_THROW(RangeImage(4, 0.0f, -15.0f * deg, 15.0f * deg), std::invalid_argument);
+  EXPECT_THROW(RangeImage(4, 1.0f * deg, 15.0f * deg, -15.0f * deg), std::invalid_argument);
+
+  // rows of 7.5 degrees from 15 to -15 degrees, and columns of 1 degree
+  RangeImage image(4, 1.0f * deg, -15.0f * deg, 15.0f * deg);
+  ASSERT_EQ(image.rows(), 4u);
+  ASSERT_EQ(image.cols(), 360u);
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const auto cloud = create_cloud({
+    spherical_point(10.0f, 45.5f * deg, 11.0f * deg),
+    spherical_point(5.0f, 45.5f * deg, 11.0f * deg),
+    spherical_point(20.0f, 45.5f * deg, 11.0f * deg),
+    spherical_point(3.0f, 270.5f * deg, -11.0f * deg),
+    spherical_point(3.0f, 0.5f * deg, -4.0f * deg),
+    spherical_point(3.0f, 359.5f * deg, 4.0f * deg),
+    spherical_point(3.0f, 0.0f, 20.0f * deg),
+    {nan, 0.0f, 0.0f},
+    {0.0f, 0.0f, 0.0f},
+  });
+  image.project(cloud);
+
+  EXPECT_EQ(image.index(0, 45), 1u);
+  EXPECT_FLOAT_EQ(image.range(0, 45), 5.0f);
+  EXPECT_EQ(image.index(3, 270), 3u);
+  EXPECT_EQ(image.index(2, 0), 4u);
+  EXPECT_EQ(image.index(1, 359), 5u);
+  const std::vector<uint32_t> pixels = {
+    45, 45, 45, 3 * 360 + 270, 2 * 360, 360 + 359, RangeImage::none, RangeImage::none,
+    RangeImage::none};
+  EXPECT_EQ(image.pixels(), pixels);
+
+  size_t filled = 0;
+  for (const auto index : image.indices()) {
+    filled += index != RangeImage::none;
+  }
+  EXPECT_EQ(filled, 4u);
+  EXPECT_TRUE(std::isinf(image.range(0, 0)));
+
+  // the buffers are reused for the next cloud
+  image.project(create_cloud({spherical_point(7.0f, 90.5f * deg, 0.5f * deg)}));
+  EXPECT_EQ(image.index(0, 45), RangeImage::none);
+  EXPECT_EQ(image.index(1, 90), 0u);
+}
+
+TEST(range_image, atan2)
+{
+  // the pixels are the same as with std::atan2, except within the error of the fast atan2 from
+  // the edges of the pixels
+  autoware_utils_pcl::RangeImage image(32, 0.2f * deg, -25.0f * deg, 15.0f * deg);
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+  std::uniform_real_distribution<float> height(-5.0f, 5.0f);
+  std::vector<std::vector<float>> points;
+  for (int i = 0; i < 10000; ++i) {
+    points.push_back({coordinate(generator), coordinate(generator), height(generator)});
+  }
+  image.project(create_cloud(points));
+
+  size_t checked = 0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double x = points[i][0];
+    const double y = points[i][1];
+    const double z = points[i][2];
+    double azimuth = std::atan2(y, x);
+    azimuth += azimuth < 0.0 ? 2.0 * M_PI : 0.0;
+    const double col = azimuth / (0.2 * M_PI / 180.0);
+    const double row =
+      (15.0 * M_PI / 180.0 - std::atan2(z, std::hypot(x, y))) * 32.0 / (40.0 * M_PI / 180.0);
+    // the error of 2e-4 rad is 0.06 columns and 0.01 rows
+    if (
+      std::abs(col - std::round(col)) < 0.1 || std::abs(row - std::round(row)) < 0.1 ||
+      row < 0.0 || 32.0 <= row) {
+      continue;
+    }
+    const auto expected = static_cast<uint32_t>(row) * image.cols() + static_cast<uint32_t>(col);
+    EXPECT_EQ(image.pixels()[i], expected) << i;
+    ++checked;
+  }
+  EXPECT_LT(5000u, checked);
+}
@@ -18,6 +18,9 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
 #include <thread>
 
 TEST(system, transform_point_cloud)
@@ -57,3 +60,149 @@ TEST(system, empty_point_cloud)
     autoware_utils_pcl::transform_pointcloud(cloud, cloud_transformed, transform));
   EXPECT_EQ(cloud_transformed.size(), 0ul);
 }
+
+TEST(system, transform_point_cloud2)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.height = 2;
+  cloud.width = 300;
+  const char * names[] = {"x", "y", "z", "intensity"};
+  for (uint32_t i = 0; i < 4; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 16;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step * cloud.height);
+  for (size_t i = 0; i < 600; ++i) {
+    const float point[] = {1.0f * i, 2.0f, 3.0f, 0.5f * i};
+    std::memcpy(cloud.data.data() + i * cloud.point_step, point, sizeof(point));
+  }
+
+  Eigen::Matrix<float, 4, 4> transform;
+  transform << 0.0, -1.0, 0.0, 10.0, 1.0, 0.0, 0.0, 20.0, 0.0, 0.0, 1.0, 30.0, 0.0, 0.0, 0.0, 1.0;
+  sensor_msgs::msg::PointCloud2 cloud_transformed;
+  autoware_utils_pcl::transform_pointcloud(cloud, cloud_transformed, transform);
+  ASSERT_EQ(cloud_transformed.data.size(), cloud.data.size());
+  autoware_utils_pcl::transform_pointcloud(cloud, transform);
+  EXPECT_EQ(cloud_transformed.data, cloud.data);
+
+  float point[4];
+  std::memcpy(point, cloud.data.data() + 599 * cloud.point_step, sizeof(point));
+  EXPECT_FLOAT_EQ(point[0], 8.0f);
+  EXPECT_FLOAT_EQ(point[1], 619.0f);
+  EXPECT_FLOAT_EQ(point[2], 33.0f);
+  EXPECT_FLOAT_EQ(point[3], 299.5f);
+
+  // the identity skips the pass, and copies the data as is
+  const auto data = cloud.data;
+  autoware_utils_pcl::transform_pointcloud(cloud, Eigen::Matrix<float, 4, 4>::Identity());
+  EXPECT_EQ(cloud.data, data);
+  autoware_utils_pcl::transform_pointcloud(
+    cloud, cloud_transformed, Eigen::Matrix<float, 4, 4>::Identity());
+  EXPECT_EQ(cloud_transformed.data, data);
+
+  cloud.fields[1].datatype = PointField::FLOAT64;
+  EXPECT_THROW(autoware_utils_pcl::transform_pointcloud(cloud, transform), std::invalid_argument);
+}
+
+TEST(system, transform_point_cloud2_parallel)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.height = 3;
+  cloud.width = 500;
+  const char * names[] = {"x", "y", "z"};
+  for (uint32_t i = 0; i < 3; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  // the rows are padded, so that the chunks cross the ends of the rows
+  cloud.point_step = 12;
+  cloud.row_step = cloud.width * cloud.point_step + 8;
+  cloud.data.resize(cloud.row_step * cloud.height);
+  for (size_t row = 0; row < cloud.height; ++row) {
+    for (size_t col = 0; col < cloud.width; ++col) {
+      const float point[] = {1.0f * col, 2.0f * row, 0.5f * col};
+      std::memcpy(
+        cloud.data.data() + row * cloud.row_step + col * cloud.point_step, point, sizeof(point));
+    }
+  }
+
+  Eigen::Matrix<float, 4, 4> transform;
+  transform << 0.0, -1.0, 0.0, 10.0, 1.0, 0.0, 0.0, 20.0, 0.0, 0.0, 1.0, 30.0, 0.0, 0.0, 0.0, 1.0;
+  autoware_utils_system::ThreadPool pool({2, {}, 0});
+
+  sensor_msgs::msg::PointCloud2 serial;
+  sensor_msgs::msg::PointCloud2 parallel;
+  autoware_utils_pcl::transform_pointcloud(cloud, serial, transform);
+  autoware_utils_pcl::transform_pointcloud(cloud, parallel, transform, pool, 64);
+  EXPECT_EQ(parallel.row_step, cloud.row_step);
+  for (size_t row = 0; row < cloud.height; ++row) {
+    const auto offset = row * cloud.row_step;
+    const auto size = cloud.width * cloud.point_step;
+    EXPECT_EQ(std::memcmp(parallel.data.data() + offset, serial.data.data() + offset, size), 0);
+  }
+  autoware_utils_pcl::transform_pointcloud(cloud, transform, pool, 64);
+  EXPECT_EQ(cloud.data, serial.data);
+
+  pcl::PointCloud<pcl::PointXYZI> points;
+  for (int i = 0; i < 1000; ++i) {
+    points.push_back(pcl::PointXYZI(1.0f * i, -2.0f * i, 3.0f, i));
+  }
+  pcl::PointCloud<pcl::PointXYZI> serial_points;
+  pcl::PointCloud<pcl::PointXYZI> parallel_points;
+  autoware_utils_pcl::transform_pointcloud(points, serial_points, transform);
+  autoware_utils_pcl::transform_pointcloud(points, parallel_points, transform, pool, 64);
+  ASSERT_EQ(parallel_points.size(), serial_points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_FLOAT_EQ(parallel_points[i].x, serial_points[i].x);
+    EXPECT_FLOAT_EQ(parallel_points[i].y, serial_points[i].y);
+    EXPECT_FLOAT_EQ(parallel_points[i].z, serial_points[i].z);
+    EXPECT_FLOAT_EQ(parallel_points[i].intensity, serial_points[i].intensity);
+  }
+}
+
+TEST(system, transform_point_cloud_in_place)
+{
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  cloud.push_back(pcl::PointXYZI(10.055880, -42.758892, -10.636949, 4));
+  cloud.push_back(pcl::PointXYZI(23.282284, -29.485722, -11.468469, 5));
+
+  Eigen::Matrix<float, 4, 4> transform;
+  transform << 0.0, -1.0, 0.0, 10.0, 1.0, 0.0, 0.0, 20.0, 0.0, 0.0, 1.0, 30.0, 0.0, 0.0, 0.0, 1.0;
+  pcl::PointCloud<pcl::PointXYZI> cloud_transformed;
+  autoware_utils_pcl::transform_pointcloud(cloud, cloud_transformed, transform);
+  autoware_utils_pcl::transform_pointcloud(cloud, transform);
+  ASSERT_EQ(cloud.size(), 2u);
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    EXPECT_FLOAT_EQ(cloud[i].x, cloud_transformed[i].x);
+    EXPECT_FLOAT_EQ(cloud[i].y, cloud_transformed[i].y);
+    EXPECT_FLOAT_EQ(cloud[i].z, cloud_transformed[i].z);
+    EXPECT_FLOAT_EQ(cloud[i].intensity, cloud_transformed[i].intensity);
+  }
+
+  // a transform within the epsilon of the identity leaves the points as they are
+  Eigen::Matrix<float, 4, 4> almost_identity = Eigen::Matrix<float, 4, 4>::Identity();
+  almost_identity(0, 3) = 1e-3f;
+  const auto x = cloud[0].x;
+  autoware_utils_pcl::transform_pointcloud(cloud, almost_identity, 1e-2f);
+  EXPECT_EQ(cloud[0].x, x);
+  autoware_utils_pcl::transform_pointcloud(cloud, cloud_transformed, almost_identity, 1e-2f);
+  EXPECT_EQ(cloud_transformed[0].x, x);
+  autoware_utils_pcl::transform_pointcloud(cloud, almost_identity);
+  EXPECT_NE(cloud[0].x, x);
+
+  pcl::PointCloud<pcl::PointXYZI> empty;
+  EXPECT_NO_THROW(autoware_utils_pcl::transform_pointcloud(empty, transform));
+  EXPECT_TRUE(empty.empty());
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_pcl/voxel_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 create_cloud(const std::vector<std::vector<float>> & points)
+{
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  cloud.height = 1;
+  cloud.width = points.size();
+  const char * names[] = {"x", "y", "z", "intensity"};
+  for (uint32_t i = 0; i < 4; ++i) {
+    PointField field;
+    field.name = names[i];
+    field.offset = 4 * i;
+    field.datatype = PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  }
+  cloud.point_step = 16;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step);
+  for (size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(cloud.data.data() + i * cloud.point_step, points[i].data(), 16);
+  }
+  return cloud;
+}
+
+std::vector<float> get_point(const sensor_msgs::msg::PointCloud2 & cloud, const size_t i)
+{
+  std::vector<float> point(4);
+  std::memcpy(point.data(), cloud.data.data() + i * cloud.point_step, 16);
+  return point;
+}
+}  // namespace
+
+TEST(voxel_grid, filter)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const auto cloud = create_cloud({
+    {0.1f, 0.1f, 0.1f, 1.0f},
+    {2.1f, 0.1f, 0.1f, 2.0f},
+    {0.3f, 0.5f, 0.9f, 3.0f},
+    {nan, 0.0f, 0.0f, 4.0f},
+    {-0.5f, 0.1f, 0.1f, 5.0f},
+    {2.9f, 0.3f, 0.1f, 6.0f},
+  });
+
+  autoware_utils_pcl::VoxelGrid centroid(1.0f);
+  sensor_msgs::msg::PointCloud2 out;
+  centroid.filter(cloud, out);
+  ASSERT_EQ(centroid.size(), 3u);
+  EXPECT_EQ(out.width, 3u);
+  EXPECT_EQ(out.height, 1u);
+  EXPECT_EQ(out.row_step, 48u);
+  EXPECT_EQ(out.header.frame_id, "base_link");
+  EXPECT_EQ(get_point(out, 0), (std::vector<float>{0.2f, 0.3f, 0.5f, 1.0f}));
+  EXPECT_EQ(get_point(out, 1), (std::vector<float>{2.5f, 0.2f, 0.1f, 2.0f}));
+  EXPECT_EQ(get_point(out, 2), (std::vector<float>{-0.5f, 0.1f, 0.1f, 5.0f}));
+
+  autoware_utils_pcl::VoxelGrid first(1.0f, autoware_utils_pcl::VoxelPoint::first);
+  first.filter(cloud, out);
+  ASSERT_EQ(out.width, 3u);
+  EXPECT_EQ(get_point(out, 1), (std::vector<float>{2.1f, 0.1f, 0.1f, 2.0f}));
+
+  // the buffers are reused for the next cloud
+  first.filter(create_cloud({{0.1f, 0.1f, 0.1f, 1.0f}}), out);
+  EXPECT_EQ(first.size(), 1u);
+  EXPECT_EQ(get_point(out, 0), (std::vector<float>{0.1f, 0.1f, 0.1f, 1.0f}));
+
+  EXPECT_THROW(autoware_utils_pcl::VoxelGrid(0.0f), std::invalid_argument);
+}
+
+TEST(voxel_grid, many_voxels)
+{
+  // enough voxels to grow the table, each one of two points
+  std::vector<std::vector<float>> points;
+  for (int i = 0; i < 1000; ++i) {
+    points.push_back({0.5f * i, -0.5f, 0.0f, 0.0f});
+  }
+  autoware_utils_pcl::VoxelGrid voxel_grid(1.0f);
+  sensor_msgs::msg::PointCloud2 out;
+  voxel_grid.filter(create_cloud(points), out);
+  ASSERT_EQ(out.width, 500u);
+  for (size_t i = 0; i < 500; ++i) {
+    EXPECT_FLOAT_EQ(get_point(out, i)[0], 1.0f * i + 0.25f);
+  }
+}
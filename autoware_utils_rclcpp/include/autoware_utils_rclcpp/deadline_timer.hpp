@@ -0,0 +1,300 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE_UTILS_RCLCPP__DEADLINE_TIMER_HPP_
+#define AUTOWARE_UTILS_RCLCPP__DEADLINE_TIMER_HPP_
+
+#include <autoware_utils_math/accumulator.hpp>
+#include <autoware_utils_math/hdr_histogram.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace autoware_utils_rclcpp
+{
+
+/**
+ * @brief What a deadline timer does with the periods which passed during an overrun.
+ */
+enum class DeadlinePolicy {
+  skip,      ///< Run once, the missed periods are counted as skipped
+  catch_up,  ///< Run once per missed period, up to a limit, back to back
+};
+
+/**
+ * @brief Statistics of the calls of a periodic callback, to find the overruns and the drift.
+ *
+ * The jitter of a call is its start minus the time it was due, and it overruns when it ends after
+ * the next period is due. The histograms count up to 10 periods, the longer values are saturated.
+ */
+struct DeadlineStatistics
+{
+  explicit DeadlineStatistics(const std::chrono::nanoseconds period)
+  : jitter_histogram(highest_ms(period), 2, 0.001),
+    execution_histogram(highest_ms(period), 2, 0.001)
+  {
+  }
+
+  uint64_t calls{0};            ///< Number of calls
+  uint64_t overruns{0};         ///< Number of calls which ended after the next period was due
+  uint64_t skipped_periods{0};  ///< Number of periods without a call
+  uint64_t caught_up_calls{0};  ///< Number of calls for periods which were already missed
+  autoware_utils_math::Accumulator<double> jitter_ms;     ///< Start minus due time of the calls
+  autoware_utils_math::Accumulator<double> execution_ms;  ///< Durations of the calls
+  autoware_utils_math::HdrHistogram jitter_histogram;     ///< Jitters in milliseconds
+  autoware_utils_math::HdrHistogram execution_histogram;  ///< Durations in milliseconds
+
+  /**
+   * @brief Get the ratio of the calls which overran, or 0 without calls.
+   */
+  double overrun_rate() const
+  {
+    return calls == 0 ? 0.0 : static_cast<double>(overruns) / static_cast<double>(calls);
+  }
+
+  /**
+   * @brief Add a call.
+   *
+   * @param jitter The start minus the due time of the call.
+   * @param execution The duration of the call.
+   * @param overrun Whether the call ended after the next period was due.
+   */
+  void add(
+    const std::chrono::nanoseconds jitter, const std::chrono::nanoseconds execution,
+    const bool overrun)
+  {
+    const double jitter_value = static_cast<double>(jitter.count()) * 1e-6;
+    const double execution_value = static_cast<double>(execution.count()) * 1e-6;
+    ++calls;
+    overruns += overrun ? 1 : 0;
+    jitter_ms.add(jitter_value);
+    execution_ms.add(execution_value);
+    jitter_histogram.record(jitter_value);
+    execution_histogram.record(execution_value);
+  }
+
+  /**
+   * @brief Reset the statistics, e.g. after each report. The memory of the histograms is kept.
+   */
+  void clear()
+  {
+    calls = overruns = skipped_periods = caught_up_calls = 0;
+    jitter_ms = {};
+    execution_ms = {};
+    jitter_histogram.reset();
+    execution_histogram.reset();
+  }
+
+  /**
+   * @brief Add the statistics as key values of a diagnostic status.
+   *
+   * @tparam Diagnostics A type with add_key_value(key, value), e.g.
+   * autoware_utils_diagnostics::DiagnosticsInterface.
+   * @param diagnostics The diagnostic status to add to.
+   */
+  template <typename Diagnostics>
+  void add_key_values(Diagnostics & diagnostics) const
+  {
+    diagnostics.add_key_value("calls", calls);
+    diagnostics.add_key_value("overruns", overruns);
+    diagnostics.add_key_value("overrun_rate", overrun_rate());
+    diagnostics.add_key_value("skipped_periods", skipped_periods);
+    diagnostics.add_key_value("caught_up_calls", caught_up_calls);
+    diagnostics.add_key_value(
+      "mean_jitter_ms", calls == 0 ? 0.0 : static_cast<double>(jitter_ms.mean()));
+    diagnostics.add_key_value("max_jitter_ms", calls == 0 ? 0.0 : jitter_ms.max());
+    for (const auto & [key, value] : execution_histogram.to_key_values("execution_ms_")) {
+      diagnostics.add_key_value(key, value);
+    }
+  }
+
+private:
+  static double highest_ms(const std::chrono::nanoseconds period)
+  {
+    return std::max(10.0 * static_cast<double>(period.count()) * 1e-6, 1.0);
+  }
+};
+
+/**
+ * @brief Schedule of a periodic callback, which measures its calls against their due times.
+ *
+ * The periods are due at a fixed rate from the start, as the periods of an rclcpp timer, so that
+ * the jitter does not accumulate. A tick late by more than a period has missed the periods in
+ * between, which are skipped or run back to back after the due one as set by the policy. With the
+ * catch-up policy, the oldest missed periods beyond the limit are skipped.
+ *
+ * @tparam Clock The clock of the due times and the measures, e.g. a fake clock for the tests.
+ */
+template <typename Clock = std::chrono::steady_clock>
+class DeadlineSchedule
+{
+public:
+  using time_point = typename Clock::time_point;
+
+  /**
+   * @brief Construct a schedule, started by start().
+   *
+   * @param period The period of the calls.
+   * @param policy What is done with the missed periods.
+   * @param max_catch_up The maximum number of calls for the missed periods in a tick.
+   * @throw std::invalid_argument if the period is not positive.
+   */
+  explicit DeadlineSchedule(
+    const std::chrono::nanoseconds period, const DeadlinePolicy policy = DeadlinePolicy::skip,
+    const size_t max_catch_up = 1)
+  : period_(period), policy_(policy), max_catch_up_(max_catch_up), statistics_(period)
+  {
+    if (period.count() <= 0) {
+      throw std::invalid_argument("The period of the deadline timer is not positive.");
+    }
+  }
+
+  /**
+   * @brief Start the schedule, the first period is due one period later.
+   */
+  void start(const time_point now) { next_ = now + period_; }
+
+  /**
+   * @brief Run the callback for a tick of the timer, and for the missed periods with the catch-up
+   * policy.
+   *
+   * @param callback The callback, invoked without arguments.
+   * @return size_t The number of calls.
+   */
+  template <typename Callback>
+  size_t tick(Callback && callback)
+  {
+    const time_point now = Clock::now();
+    const time_point due = next_;
+    const int64_t missed = due < now ? (now - due) / period_ : 0;
+    const int64_t caught_up = policy_ == DeadlinePolicy::catch_up
+                                ? std::min<int64_t>(missed, static_cast<int64_t>(max_catch_up_))
+                                : 0;
+    statistics_.skipped_periods += static_cast<uint64_t>(missed - caught_up);
+    statistics_.caught_up_calls += static_cast<uint64_t>(caught_up);
+    next_ = due + (missed + 1) * period_;
+
+    // the last periods are run, the oldest ones after the limit are skipped
+    for (int64_t i = missed - caught_up; i <= missed; ++i) {
+      const time_point call_due = due + i * period_;
+      const time_point start = Clock::now();
+      callback();
+      const time_point end = Clock::now();
+      statistics_.add(start - call_due, end - start, call_due + period_ < end);
+    }
+    return static_cast<size_t>(caught_up + 1);
+  }
+
+  /**
+   * @brief Get the due time of the next period.
+   */
+  time_point next_due() const { return next_; }
+
+  std::chrono::nanoseconds period() const { return period_; }
+
+  /**
+   * @brief Get the statistics of the calls. They can be cleared after each report.
+   */
+  DeadlineStatistics & statistics() { return statistics_; }
+  const DeadlineStatistics & statistics() const { return statistics_; }
+
+private:
+  std::chrono::nanoseconds period_;
+  DeadlinePolicy policy_;
+  size_t max_catch_up_;
+  time_point next_{};
+  DeadlineStatistics statistics_;
+};
+
+/**
+ * @brief A wall timer of a node which measures the jitter and the duration of its callback,
+ * counts the overruns and skips or catches up the missed periods.
+ *
+ * The statistics are updated by the callback, so read them from the same callback group, e.g. in
+ * the callback of a diagnostic timer of a mutually exclusive group.
+ */
+class DeadlineTimer
+{
+public:
+  using SharedPtr = std::shared_ptr<DeadlineTimer>;
+
+  /**
+   * @brief Create a timer.
+   *
+   * @param node The node to attach the timer to.
+   * @param period The period of the calls.
+   * @param callback The callback, invoked without arguments.
+   * @param policy What is done with the missed periods.
+   * @param max_catch_up The maximum number of calls for the missed periods in a tick.
+   * @param group The callback group of the timer, or nullptr for the default one.
+   * @throw std::invalid_argument if the period is not positive.
+   */
+  DeadlineTimer(
+    rclcpp::Node * node, const std::chrono::nanoseconds period, std::function<void()> callback,
+    const DeadlinePolicy policy = DeadlinePolicy::skip, const size_t max_catch_up = 1,
+    rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  : schedule_(period, policy, max_catch_up), callback_(std::move(callback))
+  {
+    // started before the timer, so that its ticks are not due before the schedule
+    schedule_.start(std::chrono::steady_clock::now());
+    timer_ = node->create_wall_timer(period, [this]() { schedule_.tick(callback_); }, group);
+  }
+
+  /**
+   * @brief Create a timer, as the constructor.
+   */
+  static SharedPtr create(
+    rclcpp::Node * node, const std::chrono::nanoseconds period, std::function<void()> callback,
+    const DeadlinePolicy policy = DeadlinePolicy::skip, const size_t max_catch_up = 1,
+    rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  {
+    return std::make_shared<DeadlineTimer>(
+      node, period, std::move(callback), policy, max_catch_up, std::move(group));
+  }
+
+  DeadlineTimer(const DeadlineTimer &) = delete;
+  DeadlineTimer & operator=(const DeadlineTimer &) = delete;
+
+  /**
+   * @brief Restart the timer and its schedule, the first period is due one period later.
+   */
+  void reset()
+  {
+    schedule_.start(std::chrono::steady_clock::now());
+    timer_->reset();
+  }
+
+  rclcpp::TimerBase::SharedPtr timer() { return timer_; }
+
+  /**
+   * @brief Get the statistics of the calls. They can be cleared after each report.
+   */
+  DeadlineStatistics & statistics() { return schedule_.statistics(); }
+  const DeadlineStatistics & statistics() const { return schedule_.statistics(); }
+
+private:
+  DeadlineSchedule<> schedule_;
+  std::function<void()> callback_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+
+}  // namespace autoware_utils_rclcpp
+
+#endif  // AUTOWARE_UTILS_RCLCPP__DEADLINE_TIMER_HPP_
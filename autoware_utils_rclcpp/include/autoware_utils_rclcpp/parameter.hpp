@@ -18,8 +18,12 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware_utils_rclcpp
@@ -35,6 +39,71 @@ T get_or_declare_parameter(rclcpp::Node & node, const std::string & name)
   return node.declare_parameter<T>(name);
 }
 
+/**
+ * @brief A parameter bound to a member of a struct, for declare_parameters().
+ */
+template <class Params, class T>
+struct ParameterField
+{
+  std::string name;   ///< Name of the parameter
+  T Params::*member;  ///< Member of the struct
+};
+
+template <class Params, class T>
+ParameterField<Params, T> parameter_field(std::string name, T Params::*member)
+{
+  return ParameterField<Params, T>{std::move(name), member};
+}
+
+/**
+ * @brief Declare the parameters of a list of fields, or get them if they are declared, in bulk.
+ *
+ * The declared parameters are read by a single get_parameters() call, and the others are declared
+ * by a single declare_parameters() call, with the values of the members as their defaults and
+ * types, instead of three calls per parameter as by get_or_declare_parameter().
+ *
+ * @param node The node of the parameters.
+ * @param params The struct, whose members are the defaults and are set to the parameters.
+ * @param fields The fields, e.g. made by parameter_field("name", &Params::name).
+ * @throw rclcpp::exceptions::InvalidParameterTypeException If an override has the wrong type.
+ */
+template <class Params, class... Ts>
+void declare_parameters(
+  rclcpp::Node & node, Params & params, const ParameterField<Params, Ts> &... fields)
+{
+  std::vector<std::string> declared;
+  std::map<std::string, std::pair<rclcpp::ParameterValue, rcl_interfaces::msg::ParameterDescriptor>>
+    undeclared;
+  const auto collect = [&node, &params, &declared, &undeclared](const auto & field) {
+    if (node.has_parameter(field.name)) {
+      declared.push_back(field.name);
+    } else {
+      undeclared.emplace(
+        field.name, std::make_pair(
+                      rclcpp::ParameterValue(params.*(field.member)),
+                      rcl_interfaces::msg::ParameterDescriptor{}));
+    }
+  };
+  (collect(fields), ...);
+
+  std::unordered_map<std::string, rclcpp::ParameterValue> values;
+  for (const auto & parameter : node.get_parameters(declared)) {
+    values.emplace(parameter.get_name(), parameter.get_parameter_value());
+  }
+  // the values are declared in the order of the map
+  const auto declared_values = node.declare_parameters<rclcpp::ParameterValue>("", undeclared);
+  auto name = undeclared.cbegin();
+  for (const auto & value : declared_values) {
+    values.emplace((name++)->first, value);
+  }
+
+  const auto assign = [&params, &values](const auto & field) {
+    using T = std::decay_t<decltype(params.*(field.member))>;
+    params.*(field.member) = values.at(field.name).template get<T>();
+  };
+  (assign(fields), ...);
+}
+
 template <class T>
 bool update_param(
   const std::vector<rclcpp::Parameter> & params, const std::string & name, T & value)
@@ -52,7 +121,8 @@ bool update_param(
   return true;
 }
 
-// NOTE: This function does not appear to be used.
+// NOTE: This function does not appear to be used. RemoteParameterFetcher of
+// remote_parameter_fetcher.hpp fetches the parameters without blocking.
 template <class T>
 [[deprecated]] T wait_for_param(
   rclcpp::Node * node, const std::string & remote_node_name, const std::string & param_name)
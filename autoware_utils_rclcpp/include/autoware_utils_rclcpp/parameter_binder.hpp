@@ -0,0 +1,192 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_RCLCPP__PARAMETER_BINDER_HPP_
+#define AUTOWARE_UTILS_RCLCPP__PARAMETER_BINDER_HPP_
+
+#include "autoware_utils_rclcpp/parameter.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <rcl_interfaces/msg/set_parameters_result.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_rclcpp
+{
+
+/**
+ * @brief Binds parameters to the members of a struct, and applies their updates in one pass.
+ *
+ * The names are registered once in a hash index, so that a batch of m parameters is applied with
+ * m lookups instead of a scan of the batch per bound parameter as by update_param(). The updated
+ * struct is published as an immutable snapshot, which the readers on other threads load
+ * atomically without locking the writer.
+ *
+ * The binding and the updates are not thread-safe, and are done from one thread, e.g. in the
+ * callback of the parameter changes registered by attach().
+ *
+ * @tparam Params The struct of the parameters, copyable.
+ */
+template <typename Params>
+class ParameterBinder
+{
+public:
+  /**
+   * @brief Construct a new ParameterBinder object.
+   *
+   * @param params The initial values.
+   */
+  explicit ParameterBinder(Params params = Params{})
+  : params_(std::move(params)), snapshot_(std::make_shared<const Params>(params_))
+  {
+  }
+
+  /**
+   * @brief Bind a parameter to a member.
+   *
+   * @param name The name of the parameter.
+   * @param member The member of the struct.
+   * @return ParameterBinder & This binder, to chain the bindings.
+   * @throw std::invalid_argument If the name is already bound.
+   */
+  template <typename T>
+  ParameterBinder & bind(const std::string & name, T Params::*member)
+  {
+    if (!index_.emplace(name, bindings_.size()).second) {
+      throw std::invalid_argument("The parameter " + name + " is already bound.");
+    }
+    bindings_.push_back(Binding{
+      [member](Params & params, const rclcpp::Parameter & parameter) {
+        params.*member = parameter.get_value<T>();
+      },
+      [member, name](Params & params, rclcpp::Node & node) {
+        params.*member = get_or_declare_parameter<T>(node, name);
+      }});
+    return *this;
+  }
+
+  /**
+   * @brief Apply a batch of parameters, ignoring the names which are not bound.
+   *
+   * The batch is applied to a copy of the parameters, which are unchanged if a value has the wrong
+   * type, and the snapshot is published once per batch with a bound name.
+   *
+   * @param parameters The parameters, e.g. passed to the callback of the parameter changes.
+   * @return std::size_t The number of bound parameters updated.
+   * @throw rclcpp::exceptions::InvalidParameterTypeException If a value has the wrong type.
+   */
+  std::size_t update(const std::vector<rclcpp::Parameter> & parameters)
+  {
+    Params next = params_;
+    std::size_t updated = 0;
+    for (const auto & parameter : parameters) {
+      const auto it = index_.find(parameter.get_name());
+      if (it != index_.end()) {
+        bindings_[it->second].set(next, parameter);
+        ++updated;
+      }
+    }
+    if (updated != 0) {
+      publish(std::move(next));
+    }
+    return updated;
+  }
+
+  /**
+   * @brief Declare the bound parameters, or get them if they are declared, and publish them.
+   *
+   * @param node The node of the parameters.
+   */
+  void declare(rclcpp::Node & node)
+  {
+    Params next = params_;
+    for (const auto & binding : bindings_) {
+      binding.declare(next, node);
+    }
+    publish(std::move(next));
+  }
+
+  /**
+   * @brief Declare the bound parameters and apply their changes, rejecting the values of the wrong
+   * type.
+   *
+   * @param node The node of the parameters.
+   * @return The handle of the callback, which must be kept to apply the changes, and must not
+   * outlive this binder.
+   */
+  rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr attach(rclcpp::Node & node)
+  {
+    declare(node);
+    return node.add_on_set_parameters_callback(
+      [this](const std::vector<rclcpp::Parameter> & parameters) {
+        rcl_interfaces::msg::SetParametersResult result;
+        result.successful = true;
+        try {
+          update(parameters);
+        } catch (const std::exception & e) {
+          result.successful = false;
+          result.reason = e.what();
+        }
+        return result;
+      });
+  }
+
+  /**
+   * @brief Get the parameters, from the thread which updates them.
+   */
+  const Params & params() const { return params_; }
+
+  /**
+   * @brief Get the last published parameters, from any thread.
+   *
+   * @return std::shared_ptr<const Params> The parameters, unchanged by the later updates.
+   */
+  std::shared_ptr<const Params> snapshot() const { return std::atomic_load(&snapshot_); }
+
+  /**
+   * @brief Get the number of bound parameters.
+   */
+  std::size_t size() const { return bindings_.size(); }
+
+private:
+  struct Binding
+  {
+    std::function<void(Params &, const rclcpp::Parameter &)> set;  ///< Sets the member
+    std::function<void(Params &, rclcpp::Node &)> declare;         ///< Declares the parameter
+  };
+
+  void publish(Params next)
+  {
+    params_ = std::move(next);
+    std::atomic_store(&snapshot_, std::make_shared<const Params>(params_));
+  }
+
+  Params params_;                                       ///< Parameters of the updating thread
+  std::shared_ptr<const Params> snapshot_;              ///< Parameters of the readers
+  std::vector<Binding> bindings_;                       ///< Bindings in their order
+  std::unordered_map<std::string, std::size_t> index_;  ///< Index of the bindings by name
+};
+
+}  // namespace autoware_utils_rclcpp
+
+#endif  // AUTOWARE_UTILS_RCLCPP__PARAMETER_BINDER_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_RCLCPP__POLLING_STATISTICS_HPP_
+#define AUTOWARE_UTILS_RCLCPP__POLLING_STATISTICS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace autoware_utils_rclcpp
+{
+
+/**
+ * @brief Counters of the polls of a subscriber, to size its poll rate and its depth.
+ *
+ * The take time is the duration of a poll, and the age of a message is the time of the node clock
+ * minus its header stamp when it is taken.
+ */
+struct PollingStatistics
+{
+  uint64_t polls{0};            ///< Number of polls
+  uint64_t hits{0};             ///< Number of polls which took at least one message
+  uint64_t takes{0};            ///< Number of messages taken
+  int64_t take_time_sum_ns{0};  ///< Sum of the durations of the polls
+  int64_t take_time_max_ns{0};  ///< Longest poll
+  uint64_t ages{0};             ///< Number of messages taken with a header stamp
+  int64_t age_sum_ns{0};        ///< Sum of the ages of the messages
+  int64_t age_max_ns{0};        ///< Oldest message
+  int64_t age_last_ns{0};       ///< Age of the last message
+
+  /**
+   * @brief Get the ratio of the polls which took at least one message, or 0 without polls.
+   */
+  double hit_rate() const { return polls == 0 ? 0.0 : static_cast<double>(hits) / polls; }
+
+  /**
+   * @brief Get the mean duration of the polls in milliseconds, or 0 without polls.
+   */
+  double mean_take_time_ms() const
+  {
+    return polls == 0 ? 0.0 : static_cast<double>(take_time_sum_ns) / polls * 1e-6;
+  }
+
+  /**
+   * @brief Get the mean age of the messages in milliseconds, or 0 without messages.
+   */
+  double mean_age_ms() const
+  {
+    return ages == 0 ? 0.0 : static_cast<double>(age_sum_ns) / ages * 1e-6;
+  }
+
+  /**
+   * @brief Add the age of a message taken.
+   *
+   * @param age_ns The age in nanoseconds.
+   */
+  void add_age(const int64_t age_ns)
+  {
+    ++ages;
+    age_sum_ns += age_ns;
+    age_max_ns = std::max(age_max_ns, age_ns);
+    age_last_ns = age_ns;
+  }
+
+  /**
+   * @brief Reset the counters, e.g. after each report.
+   */
+  void clear() { *this = PollingStatistics{}; }
+
+  /**
+   * @brief Add the counters as key values of a diagnostic status.
+   *
+   * @tparam Diagnostics A type with add_key_value(key, value), e.g.
+   * autoware_utils_diagnostics::DiagnosticsInterface.
+   * @param diagnostics The diagnostic status to add to.
+   */
+  template <typename Diagnostics>
+  void add_key_values(Diagnostics & diagnostics) const
+  {
+    diagnostics.add_key_value("polls", polls);
+    diagnostics.add_key_value("takes", takes);
+    diagnostics.add_key_value("hit_rate", hit_rate());
+    diagnostics.add_key_value("mean_take_time_ms", mean_take_time_ms());
+    diagnostics.add_key_value("max_take_time_ms", take_time_max_ns * 1e-6);
+    diagnostics.add_key_value("mean_age_ms", mean_age_ms());
+    diagnostics.add_key_value("max_age_ms", age_max_ns * 1e-6);
+  }
+};
+
+namespace polling_policy::detail
+{
+/**
+ * @brief Measures a poll, recorded when the scope ends. Nothing is measured without statistics.
+ */
+class PollScope
+{
+public:
+  explicit PollScope(PollingStatistics * statistics) : statistics_(statistics)
+  {
+    if (statistics_) {
+      takes_ = statistics_->takes;
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  PollScope(const PollScope &) = delete;
+  PollScope & operator=(const PollScope &) = delete;
+
+  ~PollScope()
+  {
+    if (!statistics_) {
+      return;
+    }
+    const auto duration = std::chrono::steady_clock::now() - start_;
+    const int64_t duration_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    ++statistics_->polls;
+    statistics_->hits += statistics_->takes != takes_ ? 1 : 0;
+    statistics_->take_time_sum_ns += duration_ns;
+    statistics_->take_time_max_ns = std::max(statistics_->take_time_max_ns, duration_ns);
+  }
+
+private:
+  PollingStatistics * statistics_;
+  uint64_t takes_{0};
+  std::chrono::steady_clock::time_point start_{};
+};
+}  // namespace polling_policy::detail
+
+}  // namespace autoware_utils_rclcpp
+
+#endif  // AUTOWARE_UTILS_RCLCPP__POLLING_STATISTICS_HPP_
@@ -14,11 +14,26 @@
 #ifndef AUTOWARE_UTILS_RCLCPP__POLLING_SUBSCRIBER_HPP_
 #define AUTOWARE_UTILS_RCLCPP__POLLING_SUBSCRIBER_HPP_
 
+#include "autoware_utils_rclcpp/polling_statistics.hpp"
+
 #include <rclcpp/rclcpp.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+
+#include <rcl/subscription.h>
+#include <rcl/wait.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace autoware_utils_rclcpp
@@ -38,6 +53,44 @@ inline rclcpp::SensorDataQoS single_depth_sensor_qos()
 namespace polling_policy
 {
 
+namespace detail
+{
+template <typename MessageT, typename = void>
+struct has_header_stamp : std::false_type
+{
+};
+
+template <typename MessageT>
+struct has_header_stamp<
+  MessageT, std::void_t<decltype(std::declval<const MessageT &>().header.stamp)>>
+: std::true_type
+{
+};
+
+template <typename PolicyT>
+struct is_intra_process : std::false_type
+{
+};
+
+/**
+ * @brief Check if a waitable has data, whose wait set is a pointer until Humble and a reference
+ * after. The intra-process waitables check their buffer only.
+ */
+template <typename WaitableT>
+auto is_ready(WaitableT & waitable, int)
+  -> decltype(waitable.is_ready(std::declval<const rcl_wait_set_t &>()))
+{
+  const rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  return waitable.is_ready(wait_set);
+}
+
+template <typename WaitableT>
+bool is_ready(WaitableT & waitable, long)  // NOLINT(runtime/int)
+{
+  return waitable.is_ready(nullptr);
+}
+}  // namespace detail
+
 /**
  * @brief Polling policy that keeps the latest received message.
  *
@@ -50,7 +103,8 @@ template <typename MessageT>
 class Latest
 {
 private:
-  typename MessageT::ConstSharedPtr data_{nullptr};  ///< Data pointer to store the latest data
+  std::shared_ptr<MessageT> data_{nullptr};   ///< Data pointer to store the latest data
+  std::shared_ptr<MessageT> spare_{nullptr};  ///< Message taken into, reused until a take succeeds
 
 protected:
   /**
@@ -85,6 +139,9 @@ public:
 template <typename MessageT>
 class Newest
 {
+private:
+  std::shared_ptr<MessageT> spare_{nullptr};  ///< Message taken into, reused until a take succeeds
+
 protected:
   /**
    * @brief Check the QoS settings for the subscription.
@@ -118,6 +175,9 @@ public:
 template <typename MessageT>
 class All
 {
+private:
+  std::shared_ptr<MessageT> spare_{nullptr};  ///< Message taken into, reused until a take succeeds
+
 protected:
   /**
    * @brief Check the QoS settings for the subscription.
@@ -135,6 +195,311 @@ public:
   std::vector<typename MessageT::ConstSharedPtr> take_data();
 };
 
+/**
+ * @brief Polling policy that keeps the newest received message, loaned by the middleware.
+ *
+ * The message is read in place when the middleware supports loans, e.g. with a shared memory
+ * transport, and it is returned to the middleware when the last pointer to it is released. The
+ * message is taken as by Newest otherwise.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class Loaned
+{
+private:
+  std::shared_ptr<MessageT> spare_{nullptr};  ///< Message taken into without loans
+
+protected:
+  /**
+   * @brief Check the QoS settings for the subscription.
+   *
+   * @param qos The QoS profile to check.
+   * @throws std::invalid_argument If the QoS depth is greater than 1.
+   */
+  void check_qos(const rclcpp::QoS & qos)
+  {
+    if (qos.get_rmw_qos_profile().depth > 1) {
+      throw std::invalid_argument(
+        "InterProcessPollingSubscriber with the Loaned policy takes one loaned message per poll, "
+        "which would be a stale one of a deeper queue, the QoS depth must be 1");
+    }
+  }
+
+public:
+  /**
+   * @brief Retrieve the newest data. If no new data has been received, nullptr is returned.
+   *
+   * @return typename MessageT::ConstSharedPtr The newest data, which holds the loan.
+   */
+  typename MessageT::ConstSharedPtr take_data();
+};
+
+/**
+ * @brief Message taken serialized, and deserialized on the first access to its fields.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class DeferredMessage
+{
+public:
+  explicit DeferredMessage(std::shared_ptr<const rclcpp::SerializedMessage> serialized)
+  : serialized_(std::move(serialized))
+  {
+  }
+
+  /**
+   * @brief Get the serialized message, e.g. to forward it without deserializing it.
+   */
+  const rclcpp::SerializedMessage & serialized() const { return *serialized_; }
+
+  /**
+   * @brief Get the message, deserialized on the first call, which is not thread-safe.
+   */
+  typename MessageT::ConstSharedPtr get() const
+  {
+    if (!message_) {
+      auto message = std::make_shared<MessageT>();
+      rclcpp::Serialization<MessageT>().deserialize_message(serialized_.get(), message.get());
+      message_ = std::move(message);
+    }
+    return message_;
+  }
+
+  const MessageT & operator*() const { return *get(); }
+  const MessageT * operator->() const { return get().get(); }
+
+private:
+  std::shared_ptr<const rclcpp::SerializedMessage> serialized_;
+  mutable typename MessageT::ConstSharedPtr message_{nullptr};
+};
+
+/**
+ * @brief Polling policy that keeps the newest received message, serialized until it is read.
+ *
+ * The polled messages of which the fields are not read are not deserialized.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class Serialized
+{
+private:
+  std::shared_ptr<rclcpp::SerializedMessage> spare_{nullptr};  ///< Message taken into
+
+protected:
+  /**
+   * @brief Check the QoS settings for the subscription.
+   *
+   * @param qos The QoS profile to check.
+   * @throws std::invalid_argument If the QoS depth is greater than 1.
+   */
+  void check_qos(const rclcpp::QoS & qos)
+  {
+    if (qos.get_rmw_qos_profile().depth > 1) {
+      throw std::invalid_argument(
+        "InterProcessPollingSubscriber with the Serialized policy takes one serialized message per "
+        "poll, which would be a stale one of a deeper queue, the QoS depth must be 1");
+    }
+  }
+
+public:
+  /**
+   * @brief Retrieve the newest data. If no new data has been received, nullptr is returned.
+   *
+   * @return std::shared_ptr<const DeferredMessage<MessageT>> The newest data, not deserialized.
+   */
+  std::shared_ptr<const DeferredMessage<MessageT>> take_data();
+};
+
+/**
+ * @brief Polling policy that keeps the latest received message, draining a queue of any depth.
+ *
+ * The queued messages are taken serialized and only the newest one is deserialized, so that a
+ * bursty publisher can be subscribed with a depth > 1 without deserializing the stale messages.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class DrainLatest
+{
+private:
+  std::shared_ptr<MessageT> data_{nullptr};   ///< Data pointer to store the latest data
+  std::shared_ptr<MessageT> spare_{nullptr};  ///< Message deserialized into
+  rclcpp::SerializedMessage newest_;          ///< Newest message taken by the current poll
+  rclcpp::SerializedMessage taken_;           ///< Message taken into, swapped with newest_
+
+protected:
+  /**
+   * @brief Check the QoS settings for the subscription.
+   *
+   * @param qos The QoS profile to check.
+   */
+  void check_qos(const rclcpp::QoS &) {}
+
+public:
+  /**
+   * @brief Retrieve the latest data. If no new data has been received, the previously received data
+   *
+   * @return typename MessageT::ConstSharedPtr The latest data.
+   */
+  typename MessageT::ConstSharedPtr take_data();
+};
+
+/**
+ * @brief Polling policy that keeps the latest received message, shared with the publishers of the
+ * same process without a copy.
+ *
+ * The subscription enables the intra-process communication, whose messages are handed over by
+ * the publishers in the same process, e.g. the composable nodes of a container, as pointers to the
+ * published messages. They are polled from the intra-process buffer by take_data(), and the
+ * messages of the other processes are taken as by Latest. The copies sent to the other processes
+ * by the publishers of the same process are dropped. The publishers need the intra-process
+ * communication enabled too, and publish without a copy with a std::unique_ptr. The QoS must be
+ * volatile, as required by the intra-process communication, and the subscriber, whose callback
+ * refers to it, must not be copied.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class IntraProcess
+{
+private:
+  typename MessageT::ConstSharedPtr data_{nullptr};  ///< Latest data, maybe held by the publisher
+  std::shared_ptr<MessageT> spare_{nullptr};         ///< Message taken into from other processes
+
+protected:
+  /**
+   * @brief Check the QoS settings for the subscription.
+   *
+   * @param qos The QoS profile to check.
+   * @throws std::invalid_argument If the QoS depth is greater than 1 or the durability is not
+   * volatile.
+   */
+  void check_qos(const rclcpp::QoS & qos)
+  {
+    if (qos.get_rmw_qos_profile().depth > 1) {
+      throw std::invalid_argument(
+        "InterProcessPollingSubscriber with the IntraProcess policy keeps only the latest message, "
+        "the QoS depth must be 1");
+    }
+    if (qos.get_rmw_qos_profile().durability != RMW_QOS_POLICY_DURABILITY_VOLATILE) {
+      throw std::invalid_argument(
+        "InterProcessPollingSubscriber with the IntraProcess policy requires a volatile QoS "
+        "durability for the intra-process communication");
+    }
+  }
+
+  /**
+   * @brief Keep a message delivered by the intra-process communication.
+   */
+  void receive(typename MessageT::ConstSharedPtr message);
+
+public:
+  /**
+   * @brief Retrieve the latest data. If no new data has been received, the previously received data
+   *
+   * @return typename MessageT::ConstSharedPtr The latest data.
+   */
+  typename MessageT::ConstSharedPtr take_data();
+};
+
+namespace detail
+{
+template <typename MessageT>
+struct is_intra_process<IntraProcess<MessageT>> : std::true_type
+{
+};
+}  // namespace detail
+
+/**
+ * @brief Polling policies that keep the last N received messages across the polls.
+ *
+ * The new messages are drained into a ring of N messages, overwriting the oldest ones, by each
+ * take. The lookups by stamp need a message with a header, and do not remove the messages.
+ *
+ * @tparam N The number of messages kept.
+ */
+template <std::size_t N>
+struct Buffered
+{
+  static_assert(0 < N, "The buffer keeps at least one message.");
+
+  /**
+   * @brief Polling policy that keeps the last N received messages.
+   *
+   * @tparam MessageT The message type.
+   */
+  template <typename MessageT>
+  class Policy
+  {
+  private:
+    std::array<std::shared_ptr<MessageT>, N> ring_{};  ///< Messages from the oldest at begin_
+    std::size_t begin_{0};                              ///< Index of the oldest message
+    std::size_t size_{0};                               ///< Number of messages kept
+    std::shared_ptr<MessageT> spare_{nullptr};          ///< Message taken into
+
+    void drain();
+
+    const std::shared_ptr<MessageT> & at(const std::size_t i) const
+    {
+      return ring_[(begin_ + i) % N];
+    }
+
+  protected:
+    /**
+     * @brief Check the QoS settings for the subscription.
+     *
+     * @param qos The QoS profile to check.
+     */
+    void check_qos(const rclcpp::QoS &) {}
+
+  public:
+    /**
+     * @brief Retrieve the newest data kept. If no data has been received, nullptr is returned.
+     *
+     * @return typename MessageT::ConstSharedPtr The newest data.
+     */
+    typename MessageT::ConstSharedPtr take_data();
+
+    /**
+     * @brief Retrieve the data kept whose header stamp is at or after a stamp.
+     *
+     * @param stamp The earliest stamp.
+     * @param data The data from the oldest, cleared first so that its capacity is reused.
+     */
+    void take_since(
+      const rclcpp::Time & stamp, std::vector<typename MessageT::ConstSharedPtr> & data);
+
+    /**
+     * @brief Retrieve the data kept whose header stamp is at or after a stamp.
+     *
+     * @param stamp The earliest stamp.
+     * @return std::vector<typename MessageT::ConstSharedPtr> The data from the oldest.
+     */
+    std::vector<typename MessageT::ConstSharedPtr> take_since(const rclcpp::Time & stamp)
+    {
+      std::vector<typename MessageT::ConstSharedPtr> data;
+      take_since(stamp, data);
+      return data;
+    }
+
+    /**
+     * @brief Retrieve the data kept whose header stamp is the closest to a stamp.
+     *
+     * @param stamp The stamp to look up.
+     * @return typename MessageT::ConstSharedPtr The closest data, or nullptr if none is kept.
+     */
+    typename MessageT::ConstSharedPtr take_closest(const rclcpp::Time & stamp);
+
+    /**
+     * @brief Get the number of messages kept, without draining the new ones.
+     */
+    std::size_t size() const { return size_; }
+  };
+};
+
 }  // namespace polling_policy
 
 /**
@@ -150,6 +515,88 @@ class InterProcessPollingSubscriber : public PollingPolicy<MessageT>
 
 private:
   typename rclcpp::Subscription<MessageT>::SharedPtr subscriber_;  ///< Subscription object
+  rclcpp::Clock::SharedPtr clock_;                                 ///< Clock of the message ages
+  std::optional<PollingStatistics> statistics_;                    ///< Counters, if enabled
+
+  /**
+   * @brief Take a message into the spare one, which is allocated only if the previous one was
+   * handed out, so that the polls without a new message do not allocate.
+   *
+   * @return true if a message was taken.
+   */
+  bool take(std::shared_ptr<MessageT> & spare)
+  {
+    if (!spare) {
+      spare = std::make_shared<MessageT>();
+    }
+    rclcpp::MessageInfo message_info;
+    if (!subscriber_->take(*spare, message_info)) {
+      return false;
+    }
+    record_take(spare.get());
+    return true;
+  }
+
+  /**
+   * @brief Same as take(), dropping the messages of the publishers of the same process that use
+   * the intra-process communication, since they are delivered by it too, as done by the executor.
+   *
+   * @return true if a message from another publisher was taken.
+   */
+  bool take_inter_process(std::shared_ptr<MessageT> & spare)
+  {
+    if (!spare) {
+      spare = std::make_shared<MessageT>();
+    }
+    rclcpp::MessageInfo message_info;
+    while (subscriber_->take(*spare, message_info)) {
+      if (!subscriber_->matches_any_intra_process_publishers(
+            &message_info.get_rmw_message_info().publisher_gid)) {
+        record_take(spare.get());
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Get the statistics measuring a poll, or nullptr if they are not enabled.
+   */
+  PollingStatistics * poll_statistics() { return statistics_ ? &*statistics_ : nullptr; }
+
+  /**
+   * @brief Count a message taken, with its age if it is given and has a header.
+   */
+  void record_take(const MessageT * message = nullptr)
+  {
+    if (!statistics_) {
+      return;
+    }
+    ++statistics_->takes;
+    if (message) {
+      record_age(*message);
+    }
+  }
+
+  /**
+   * @brief Add the age of a message taken, if it has a header.
+   */
+  void record_age(const MessageT & message)
+  {
+    if constexpr (polling_policy::detail::has_header_stamp<MessageT>::value) {
+      record_age(rclcpp::Time(message.header.stamp).nanoseconds());
+    }
+  }
+
+  /**
+   * @brief Add the age of a message taken, from its header stamp in nanoseconds.
+   */
+  void record_age(const int64_t stamp_ns)
+  {
+    if (statistics_) {
+      statistics_->add_age(clock_->now().nanoseconds() - stamp_ns);
+    }
+  }
 
 public:
   using SharedPtr = std::shared_ptr<InterProcessPollingSubscriber<MessageT, PollingPolicy>>;
@@ -163,6 +610,7 @@ public:
    */
   explicit InterProcessPollingSubscriber(
     rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1})
+  : clock_(node->get_clock())
   {
     this->check_qos(qos);
 
@@ -172,10 +620,19 @@ public:
     auto noexec_subscription_options = rclcpp::SubscriptionOptions();
     noexec_subscription_options.callback_group = noexec_callback_group;
 
-    subscriber_ = node->create_subscription<MessageT>(
-      topic_name, qos,
-      [node]([[maybe_unused]] const typename MessageT::ConstSharedPtr msg) { assert(false); },
-      noexec_subscription_options);
+    if constexpr (polling_policy::detail::is_intra_process<PollingPolicy<MessageT>>::value) {
+      // the callback is executed by take_data(), which polls the intra-process buffer
+      noexec_subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+      subscriber_ = node->create_subscription<MessageT>(
+        topic_name, qos,
+        [this](const typename MessageT::ConstSharedPtr msg) { this->receive(msg); },
+        noexec_subscription_options);
+    } else {
+      subscriber_ = node->create_subscription<MessageT>(
+        topic_name, qos,
+        [node]([[maybe_unused]] const typename MessageT::ConstSharedPtr msg) { assert(false); },
+        noexec_subscription_options);
+    }
   }
 
   /**
@@ -194,6 +651,23 @@ public:
   }
 
   typename rclcpp::Subscription<MessageT>::SharedPtr subscriber() { return subscriber_; }
+
+  /**
+   * @brief Enable or disable the statistics of the polls, which are reset.
+   *
+   * @param enabled Whether the polls are measured.
+   */
+  void enable_statistics(const bool enabled)
+  {
+    statistics_ = enabled ? std::optional<PollingStatistics>(PollingStatistics{}) : std::nullopt;
+  }
+
+  /**
+   * @brief Get the statistics of the polls, or std::nullopt if they are not enabled. They can be
+   * cleared after each report.
+   */
+  std::optional<PollingStatistics> & statistics() { return statistics_; }
+  const std::optional<PollingStatistics> & statistics() const { return statistics_; }
 };
 
 namespace polling_policy
@@ -202,28 +676,26 @@ namespace polling_policy
 template <typename MessageT>
 typename MessageT::ConstSharedPtr Latest<MessageT>::take_data()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, Latest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
-  rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
-  if (success) {
-    data_ = new_data;
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, Latest> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  if (self.take(spare_)) {
+    // the previous message is reused if no one holds it anymore, with the capacity of its arrays
+    auto previous = std::move(data_);
+    data_ = std::move(spare_);
+    if (previous.use_count() == 1) {
+      spare_ = std::move(previous);
+    }
   }
-
   return data_;
 }
 
 template <typename MessageT>
 typename MessageT::ConstSharedPtr Newest<MessageT>::take_data()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, Newest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
-  rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
-  if (success) {
-    return new_data;
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, Newest> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  if (self.take(spare_)) {
+    return std::move(spare_);
   }
   return nullptr;
 }
@@ -231,19 +703,183 @@ typename MessageT::ConstSharedPtr Newest<MessageT>::take_data()
 template <typename MessageT>
 std::vector<typename MessageT::ConstSharedPtr> All<MessageT>::take_data()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, All> *>(this)->subscriber_;
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, All> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
   std::vector<typename MessageT::ConstSharedPtr> data;
+  while (self.take(spare_)) {
+    data.push_back(std::move(spare_));
+  }
+  return data;
+}
+
+template <typename MessageT>
+typename MessageT::ConstSharedPtr Loaned<MessageT>::take_data()
+{
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, Loaned> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  auto & subscriber = self.subscriber_;
+  if (!subscriber->can_loan_messages()) {
+    if (self.take(spare_)) {
+      return std::move(spare_);
+    }
+    return nullptr;
+  }
+
+  void * loaned_message = nullptr;
+  rclcpp::MessageInfo message_info;
+  const rcl_ret_t ret = rcl_take_loaned_message(
+    subscriber->get_subscription_handle().get(), &loaned_message,
+    &message_info.get_rmw_message_info(), nullptr);
+  if (ret == RCL_RET_SUBSCRIPTION_TAKE_FAILED) {
+    return nullptr;
+  }
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "failed to take a loaned message");
+  }
+  self.record_take(static_cast<const MessageT *>(loaned_message));
+
+  // the subscription is kept alive until the loan is returned
+  return typename MessageT::ConstSharedPtr(
+    static_cast<const MessageT *>(loaned_message), [subscriber](const MessageT * message) {
+      rcl_return_loaned_message_from_subscription(
+        subscriber->get_subscription_handle().get(), const_cast<MessageT *>(message));
+    });
+}
+
+template <typename MessageT>
+std::shared_ptr<const DeferredMessage<MessageT>> Serialized<MessageT>::take_data()
+{
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, Serialized> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  auto & subscriber = self.subscriber_;
+  if (!spare_) {
+    spare_ = std::make_shared<rclcpp::SerializedMessage>();
+  }
+  rclcpp::MessageInfo message_info;
+  if (subscriber->take_serialized(*spare_, message_info)) {
+    self.record_take();
+    return std::make_shared<DeferredMessage<MessageT>>(std::move(spare_));
+  }
+  return nullptr;
+}
+
+template <typename MessageT>
+typename MessageT::ConstSharedPtr DrainLatest<MessageT>::take_data()
+{
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, DrainLatest> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  auto & subscriber = self.subscriber_;
+  bool taken = false;
   rclcpp::MessageInfo message_info;
-  for (;;) {
-    auto datum = std::make_shared<MessageT>();
-    if (subscriber->take(*datum, message_info)) {
-      data.push_back(datum);
+  while (subscriber->take_serialized(taken_, message_info)) {
+    std::swap(newest_, taken_);
+    taken = true;
+    self.record_take();
+  }
+  if (!taken) {
+    return data_;
+  }
+
+  if (!spare_) {
+    spare_ = std::make_shared<MessageT>();
+  }
+  rclcpp::Serialization<MessageT>().deserialize_message(&newest_, spare_.get());
+  self.record_age(*spare_);
+  // the previous message is reused if no one holds it anymore, with the capacity of its arrays
+  auto previous = std::move(data_);
+  data_ = std::move(spare_);
+  if (previous.use_count() == 1) {
+    spare_ = std::move(previous);
+  }
+  return data_;
+}
+
+template <typename MessageT>
+void IntraProcess<MessageT>::receive(typename MessageT::ConstSharedPtr message)
+{
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, IntraProcess> *>(this);
+  data_ = std::move(message);
+  self.record_take(data_.get());
+}
+
+template <typename MessageT>
+typename MessageT::ConstSharedPtr IntraProcess<MessageT>::take_data()
+{
+  auto & self = *static_cast<InterProcessPollingSubscriber<MessageT, IntraProcess> *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  if (self.take_inter_process(spare_)) {
+    data_ = std::move(spare_);
+  }
+  // the messages of the same process are handed to receive() by the callback, the newest last
+  const auto waitable = self.subscriber_->get_intra_process_waitable();
+  while (waitable && detail::is_ready(*waitable, 0)) {
+    auto data = waitable->take_data();
+    waitable->execute(data);
+  }
+  return data_;
+}
+
+template <std::size_t N>
+template <typename MessageT>
+void Buffered<N>::Policy<MessageT>::drain()
+{
+  using Subscriber = InterProcessPollingSubscriber<MessageT, Buffered<N>::template Policy>;
+  auto & self = *static_cast<Subscriber *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  while (self.take(spare_)) {
+    auto & slot = ring_[(begin_ + size_) % N];
+    if (size_ < N) {
+      ++size_;
     } else {
-      break;
+      begin_ = (begin_ + 1) % N;
+    }
+    // the overwritten message is reused if no one holds it anymore
+    std::swap(slot, spare_);
+    if (spare_.use_count() != 1) {
+      spare_ = nullptr;
     }
   }
-  return data;
+}
+
+template <std::size_t N>
+template <typename MessageT>
+typename MessageT::ConstSharedPtr Buffered<N>::Policy<MessageT>::take_data()
+{
+  drain();
+  return size_ == 0 ? nullptr : at(size_ - 1);
+}
+
+template <std::size_t N>
+template <typename MessageT>
+void Buffered<N>::Policy<MessageT>::take_since(
+  const rclcpp::Time & stamp, std::vector<typename MessageT::ConstSharedPtr> & data)
+{
+  drain();
+  data.clear();
+  for (std::size_t i = 0; i < size_; ++i) {
+    if (stamp.nanoseconds() <= rclcpp::Time(at(i)->header.stamp).nanoseconds()) {
+      data.push_back(at(i));
+    }
+  }
+}
+
+template <std::size_t N>
+template <typename MessageT>
+typename MessageT::ConstSharedPtr Buffered<N>::Policy<MessageT>::take_closest(
+  const rclcpp::Time & stamp)
+{
+  drain();
+  typename MessageT::ConstSharedPtr closest{nullptr};
+  int64_t closest_distance = std::numeric_limits<int64_t>::max();
+  for (std::size_t i = 0; i < size_; ++i) {
+    const int64_t distance =
+      std::abs(rclcpp::Time(at(i)->header.stamp).nanoseconds() - stamp.nanoseconds());
+    if (distance < closest_distance) {
+      closest = at(i);
+      closest_distance = distance;
+    }
+  }
+  return closest;
 }
 
 }  // namespace polling_policy
@@ -0,0 +1,311 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_RCLCPP__POLLING_SYNCHRONIZER_HPP_
+#define AUTOWARE_UTILS_RCLCPP__POLLING_SYNCHRONIZER_HPP_
+
+#include "autoware_utils_rclcpp/polling_subscriber.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace autoware_utils_rclcpp
+{
+
+namespace polling_policy
+{
+
+namespace detail
+{
+/**
+ * @brief Read the header stamp of a serialized message without deserializing it.
+ *
+ * The message must start with a std_msgs/Header, whose stamp follows the 4 bytes of the CDR
+ * encapsulation, in the byte order given by its representation identifier.
+ *
+ * @return int64_t The stamp in nanoseconds.
+ * @throw std::runtime_error If the message is not CDR encoded or too short for a stamp.
+ */
+inline int64_t serialized_header_stamp(const rclcpp::SerializedMessage & message)
+{
+  const auto & serialized = message.get_rcl_serialized_message();
+  if (serialized.buffer_length < 12 || serialized.buffer[0] != 0) {
+    throw std::runtime_error("The serialized message has no CDR encoded header stamp.");
+  }
+  // the identifiers of the little endian representations are odd
+  const bool little_endian = (serialized.buffer[1] & 1) != 0;
+  const auto read_uint32 = [&serialized, little_endian](const std::size_t offset) {
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+      const uint32_t byte = serialized.buffer[offset + (little_endian ? i : 3 - i)];
+      value |= byte << (8 * i);
+    }
+    return value;
+  };
+  const auto sec = static_cast<int32_t>(read_uint32(4));
+  const auto nanosec = read_uint32(8);
+  return static_cast<int64_t>(sec) * 1'000'000'000 + nanosec;
+}
+}  // namespace detail
+
+/**
+ * @brief Polling policies that keep the last N received messages serialized, for
+ * PollingSynchronizer.
+ *
+ * The header stamps are read from the serialized messages, and a message is deserialized only
+ * when it is chosen, once for all the sets it is part of.
+ *
+ * @tparam N The number of messages kept.
+ */
+template <std::size_t N>
+struct Synchronized
+{
+  static_assert(0 < N, "The buffer keeps at least one message.");
+
+  /**
+   * @brief Polling policy that keeps the last N received messages serialized.
+   *
+   * @tparam MessageT The message type, starting with a header.
+   */
+  template <typename MessageT>
+  class Policy
+  {
+  private:
+    struct Entry
+    {
+      rclcpp::SerializedMessage message;        ///< Serialized message
+      int64_t stamp{0};                         ///< Header stamp in nanoseconds
+      std::shared_ptr<MessageT> data{nullptr};  ///< Message deserialized when chosen
+    };
+
+    std::array<Entry, N> ring_{};               ///< Messages from the oldest at begin_
+    std::size_t begin_{0};                      ///< Index of the oldest message
+    std::size_t size_{0};                       ///< Number of messages kept
+    rclcpp::SerializedMessage taken_;           ///< Message taken into, swapped into the ring
+    std::shared_ptr<MessageT> spare_{nullptr};  ///< Message deserialized into
+
+    Entry & at(const std::size_t i) { return ring_[(begin_ + i) % N]; }
+    const Entry & at(const std::size_t i) const { return ring_[(begin_ + i) % N]; }
+
+  protected:
+    /**
+     * @brief Check the QoS settings for the subscription.
+     *
+     * @param qos The QoS profile to check.
+     */
+    void check_qos(const rclcpp::QoS &) {}
+
+  public:
+    /**
+     * @brief Take the new messages into the ring, overwriting the oldest ones.
+     *
+     * @throw std::runtime_error If the header stamp of a message cannot be read.
+     */
+    void drain();
+
+    /**
+     * @brief Get the number of messages kept.
+     */
+    std::size_t size() const { return size_; }
+
+    /**
+     * @brief Get the header stamp of a message kept, in nanoseconds.
+     *
+     * @param i The index of the message from the oldest.
+     */
+    int64_t stamp(const std::size_t i) const { return at(i).stamp; }
+
+    /**
+     * @brief Get the index of the message kept whose header stamp is the closest to a stamp.
+     *
+     * @param stamp The stamp in nanoseconds.
+     * @return std::size_t The index from the oldest, or size() if no message is kept.
+     */
+    std::size_t closest(const int64_t stamp) const;
+
+    /**
+     * @brief Retrieve a message kept, deserialized on the first retrieval.
+     *
+     * @param i The index of the message from the oldest.
+     * @return typename MessageT::ConstSharedPtr The message.
+     */
+    typename MessageT::ConstSharedPtr take_data(const std::size_t i);
+  };
+};
+
+template <std::size_t N>
+template <typename MessageT>
+void Synchronized<N>::Policy<MessageT>::drain()
+{
+  using Subscriber = InterProcessPollingSubscriber<MessageT, Synchronized<N>::template Policy>;
+  auto & self = *static_cast<Subscriber *>(this);
+  const detail::PollScope poll(self.poll_statistics());
+  rclcpp::MessageInfo message_info;
+  while (self.subscriber_->take_serialized(taken_, message_info)) {
+    const int64_t stamp = detail::serialized_header_stamp(taken_);
+    self.record_take();
+    self.record_age(stamp);
+    auto & slot = ring_[(begin_ + size_) % N];
+    if (size_ < N) {
+      ++size_;
+    } else {
+      begin_ = (begin_ + 1) % N;
+    }
+    std::swap(slot.message, taken_);
+    slot.stamp = stamp;
+    // the overwritten message is reused if no one holds it anymore
+    if (slot.data.use_count() == 1) {
+      spare_ = std::move(slot.data);
+    }
+    slot.data = nullptr;
+  }
+}
+
+template <std::size_t N>
+template <typename MessageT>
+std::size_t Synchronized<N>::Policy<MessageT>::closest(const int64_t stamp) const
+{
+  std::size_t closest = size_;
+  int64_t closest_distance = std::numeric_limits<int64_t>::max();
+  for (std::size_t i = 0; i < size_; ++i) {
+    const int64_t distance = std::abs(at(i).stamp - stamp);
+    if (distance < closest_distance) {
+      closest = i;
+      closest_distance = distance;
+    }
+  }
+  return closest;
+}
+
+template <std::size_t N>
+template <typename MessageT>
+typename MessageT::ConstSharedPtr Synchronized<N>::Policy<MessageT>::take_data(const std::size_t i)
+{
+  auto & entry = at(i);
+  if (!entry.data) {
+    entry.data = spare_ ? std::move(spare_) : std::make_shared<MessageT>();
+    rclcpp::Serialization<MessageT>().deserialize_message(&entry.message, entry.data.get());
+  }
+  return entry.data;
+}
+
+}  // namespace polling_policy
+
+/**
+ * @brief Polls several subscribers together and returns their messages aligned by header stamp.
+ *
+ * The first subscriber is the reference, e.g. the topic with the lowest rate. Its messages are
+ * matched from the newest to the closest message of each other subscriber, within a tolerance,
+ * which is zero for exact matching. A set is returned once, and only its messages are
+ * deserialized.
+ *
+ * @tparam N The number of messages kept per subscriber.
+ * @tparam MessageTs The message types, starting with a header.
+ */
+template <std::size_t N, typename... MessageTs>
+class PollingSynchronizer
+{
+  static_assert(0 < sizeof...(MessageTs), "The synchronizer polls at least one subscriber.");
+
+public:
+  template <typename MessageT>
+  using Subscriber = InterProcessPollingSubscriber<
+    MessageT, polling_policy::Synchronized<N>::template Policy>;
+  using Messages = std::tuple<typename MessageTs::ConstSharedPtr...>;
+
+  /**
+   * @brief Construct a new PollingSynchronizer object.
+   *
+   * @param tolerance The largest difference to the stamp of the reference message.
+   * @param subscribers The subscribers, created with the synchronized polling policy.
+   * @throw std::invalid_argument If the tolerance is negative or a subscriber is null.
+   */
+  explicit PollingSynchronizer(
+    const rclcpp::Duration & tolerance, typename Subscriber<MessageTs>::SharedPtr... subscribers)
+  : tolerance_(tolerance.nanoseconds()), subscribers_(std::move(subscribers)...)
+  {
+    if (tolerance_ < 0) {
+      throw std::invalid_argument("The tolerance must not be negative.");
+    }
+    if (!std::apply([](const auto &... s) { return (s && ...); }, subscribers_)) {
+      throw std::invalid_argument("The subscribers must not be null.");
+    }
+  }
+
+  /**
+   * @brief Retrieve the newest set of messages aligned by stamp, newer than the previous set.
+   *
+   * @return std::optional<Messages> The messages, or std::nullopt if no new set is complete.
+   */
+  std::optional<Messages> take_data()
+  {
+    return take_data(std::index_sequence_for<MessageTs...>{});
+  }
+
+  /**
+   * @brief Get a subscriber.
+   *
+   * @tparam I The index of the subscriber.
+   */
+  template <std::size_t I>
+  const auto & subscriber() const
+  {
+    return std::get<I>(subscribers_);
+  }
+
+private:
+  int64_t tolerance_;                                                     ///< In nanoseconds
+  std::tuple<typename Subscriber<MessageTs>::SharedPtr...> subscribers_;  ///< Reference first
+  int64_t last_stamp_{std::numeric_limits<int64_t>::min()};               ///< Previous set
+
+  template <std::size_t... Is>
+  std::optional<Messages> take_data(std::index_sequence<Is...>)
+  {
+    (std::get<Is>(subscribers_)->drain(), ...);
+    const auto & reference = std::get<0>(subscribers_);
+    for (std::size_t i = reference->size(); 0 < i--;) {
+      const int64_t stamp = reference->stamp(i);
+      if (stamp <= last_stamp_) {
+        break;
+      }
+      const std::array<std::size_t, sizeof...(MessageTs)> indices{
+        (Is == 0 ? i : std::get<Is>(subscribers_)->closest(stamp))...};
+      const bool matched =
+        ((indices[Is] < std::get<Is>(subscribers_)->size() &&
+          std::abs(std::get<Is>(subscribers_)->stamp(indices[Is]) - stamp) <= tolerance_) &&
+         ...);
+      if (matched) {
+        last_stamp_ = stamp;
+        return Messages{std::get<Is>(subscribers_)->take_data(indices[Is])...};
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+}  // namespace autoware_utils_rclcpp
+
+#endif  // AUTOWARE_UTILS_RCLCPP__POLLING_SYNCHRONIZER_HPP_
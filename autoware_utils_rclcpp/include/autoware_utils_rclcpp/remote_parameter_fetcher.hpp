@@ -0,0 +1,220 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_RCLCPP__REMOTE_PARAMETER_FETCHER_HPP_
+#define AUTOWARE_UTILS_RCLCPP__REMOTE_PARAMETER_FETCHER_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <rcl_interfaces/msg/parameter_event.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_rclcpp
+{
+
+/**
+ * @brief Fetches parameters of a remote node without blocking, replacing wait_for_param().
+ *
+ * A timer checks for the parameter service of the remote node, then all the names are fetched by a
+ * single asynchronous request, whose response is handled by the executor of the node. The request
+ * is sent again at the next period if it fails or if its response does not have all the names, and
+ * the timer is canceled only after a complete response. The values can be kept up to date from the
+ * parameter events of the remote node.
+ *
+ * The values are read from any thread, and the callback is called from the executor.
+ */
+class RemoteParameterFetcher
+{
+public:
+  using Callback = std::function<void(const std::vector<rclcpp::Parameter> &)>;
+
+  /**
+   * @brief Construct a new RemoteParameterFetcher object, which starts to fetch the parameters.
+   *
+   * @param node The node whose executor handles the requests.
+   * @param remote_node_name The name of the remote node, relative to the namespace of the node.
+   * @param names The names of the parameters.
+   * @param callback Called with the parameters fetched, then with the parameters updated.
+   * @param subscribe_events Whether the parameters are updated from the parameter events.
+   * @param retry_period The period of the checks for the parameter service and of the requests.
+   */
+  RemoteParameterFetcher(
+    rclcpp::Node * node, const std::string & remote_node_name, std::vector<std::string> names,
+    Callback callback = nullptr, const bool subscribe_events = false,
+    const std::chrono::milliseconds retry_period = std::chrono::milliseconds(100))
+  : client_(std::make_shared<rclcpp::AsyncParametersClient>(node, remote_node_name)),
+    logger_(node->get_logger()),
+    remote_node_name_(fully_qualified_name(*node, remote_node_name)),
+    names_(std::move(names)),
+    callback_(std::move(callback))
+  {
+    if (subscribe_events) {
+      events_ = client_->on_parameter_event(
+        [this](const rcl_interfaces::msg::ParameterEvent::SharedPtr event) { on_event(*event); });
+    }
+    timer_ = node->create_wall_timer(retry_period, [this] { on_timer(); });
+  }
+
+  /**
+   * @brief Check whether the parameters have been fetched.
+   */
+  bool is_ready() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ready_;
+  }
+
+  /**
+   * @brief Get a parameter fetched, or std::nullopt if it is not fetched or not declared.
+   *
+   * @param name The name of the parameter.
+   */
+  std::optional<rclcpp::Parameter> get_parameter(const std::string & name) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = values_.find(name);
+    if (it == values_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Get the value of a parameter fetched, or std::nullopt if it is not fetched.
+   *
+   * @param name The name of the parameter.
+   * @throw rclcpp::exceptions::InvalidParameterTypeException If the value has another type.
+   */
+  template <class T>
+  std::optional<T> get(const std::string & name) const
+  {
+    const auto parameter = get_parameter(name);
+    if (!parameter) {
+      return std::nullopt;
+    }
+    return parameter->get_value<T>();
+  }
+
+private:
+  static std::string fully_qualified_name(const rclcpp::Node & node, const std::string & name)
+  {
+    if (!name.empty() && name.front() == '/') {
+      return name;
+    }
+    const std::string ns = node.get_namespace();
+    return ns == "/" ? "/" + name : ns + "/" + name;
+  }
+
+  void on_timer()
+  {
+    if (pending_ || !client_->service_is_ready()) {
+      return;
+    }
+    pending_ = true;
+    client_->get_parameters(
+      names_, [this](std::shared_future<std::vector<rclcpp::Parameter>> future) {
+        on_response(future);
+      });
+  }
+
+  void on_response(const std::shared_future<std::vector<rclcpp::Parameter>> & future)
+  {
+    std::vector<rclcpp::Parameter> parameters;
+    try {
+      parameters = future.get();
+    } catch (const std::exception & e) {
+      RCLCPP_WARN(
+        logger_, "Failed to get the parameters of %s, retrying: %s", remote_node_name_.c_str(),
+        e.what());
+      pending_ = false;
+      return;
+    }
+    // the undeclared parameters are in the response with no value, so a missing one is a failure
+    if (parameters.size() != names_.size()) {
+      RCLCPP_WARN(
+        logger_, "Got %zu of the %zu parameters of %s, retrying", parameters.size(), names_.size(),
+        remote_node_name_.c_str());
+      pending_ = false;
+      return;
+    }
+    timer_->cancel();
+    update(parameters, true);
+  }
+
+  void on_event(const rcl_interfaces::msg::ParameterEvent & event)
+  {
+    if (event.node != remote_node_name_) {
+      return;
+    }
+    std::vector<rclcpp::Parameter> parameters;
+    for (const auto * messages : {&event.new_parameters, &event.changed_parameters}) {
+      for (const auto & message : *messages) {
+        if (std::find(names_.begin(), names_.end(), message.name) != names_.end()) {
+          parameters.push_back(rclcpp::Parameter::from_parameter_msg(message));
+        }
+      }
+    }
+    if (!parameters.empty()) {
+      update(parameters, false);
+    }
+  }
+
+  void update(const std::vector<rclcpp::Parameter> & parameters, const bool fetched)
+  {
+    std::vector<rclcpp::Parameter> declared;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto & parameter : parameters) {
+        if (parameter.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET) {
+          values_.insert_or_assign(parameter.get_name(), parameter);
+          declared.push_back(parameter);
+        }
+      }
+      ready_ = ready_ || fetched;
+    }
+    if (callback_ && !declared.empty()) {
+      callback_(declared);
+    }
+  }
+
+  using EventSubscription = rclcpp::Subscription<rcl_interfaces::msg::ParameterEvent>;
+
+  rclcpp::AsyncParametersClient::SharedPtr client_;            ///< Client of the remote node
+  rclcpp::Logger logger_;                                      ///< Logger of the node
+  std::string remote_node_name_;                               ///< Fully qualified remote name
+  std::vector<std::string> names_;                             ///< Names of the parameters
+  Callback callback_;                                          ///< Called with the new values
+  rclcpp::TimerBase::SharedPtr timer_;                         ///< Checks for the service
+  std::atomic<bool> pending_{false};                           ///< Whether a request is sent
+  EventSubscription::SharedPtr events_;                        ///< Parameter events, if any
+  mutable std::mutex mutex_;                                   ///< Guards the values
+  std::unordered_map<std::string, rclcpp::Parameter> values_;  ///< Values by name
+  bool ready_{false};                                          ///< Whether fetched
+};
+
+}  // namespace autoware_utils_rclcpp
+
+#endif  // AUTOWARE_UTILS_RCLCPP__REMOTE_PARAMETER_FETCHER_HPP_
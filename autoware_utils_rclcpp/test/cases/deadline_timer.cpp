@@ -0,0 +1,173 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_rclcpp/deadline_timer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+using autoware_utils_rclcpp::DeadlinePolicy;
+using autoware_utils_rclcpp::DeadlineSchedule;
+using std::chrono::milliseconds;
+
+namespace
+{
+struct FakeClock
+{
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() { return current; }
+  static inline time_point current{};
+};
+
+struct FakeDiagnostics
+{
+  template <typename T>
+  void add_key_value(const std::string & key, const T & value)
+  {
+    values[key] = std::to_string(value);
+  }
+  void add_key_value(const std::string & key, const std::string & value) { values[key] = value; }
+
+  std::map<std::string, std::string> values;
+};
+
+// a callback which takes the given duration of the fake clock
+auto work(const milliseconds duration)
+{
+  return [duration] { FakeClock::current += duration; };
+}
+}  // namespace
+
+TEST(TestDeadlineTimer, OnTime)
+{
+  FakeClock::current = FakeClock::time_point{};
+  DeadlineSchedule<FakeClock> schedule(milliseconds(10));
+  schedule.start(FakeClock::now());
+
+  FakeClock::current += milliseconds(10);
+  EXPECT_EQ(schedule.tick(work(milliseconds(2))), 1u);
+  FakeClock::current += milliseconds(9);
+  EXPECT_EQ(schedule.tick(work(milliseconds(2))), 1u);
+
+  const auto & statistics = schedule.statistics();
+  EXPECT_EQ(statistics.calls, 2u);
+  EXPECT_EQ(statistics.overruns, 0u);
+  EXPECT_EQ(statistics.skipped_periods, 0u);
+  EXPECT_DOUBLE_EQ(statistics.jitter_ms.max(), 1.0);
+  EXPECT_DOUBLE_EQ(statistics.execution_ms.mean(), 2.0);
+  EXPECT_EQ(schedule.next_due(), FakeClock::time_point{} + milliseconds(30));
+}
+
+TEST(TestDeadlineTimer, SkipAfterOverrun)
+{
+  FakeClock::current = FakeClock::time_point{};
+  DeadlineSchedule<FakeClock> schedule(milliseconds(10), DeadlinePolicy::skip);
+  schedule.start(FakeClock::now());
+
+  // the call due at 10 ends at 35, the periods due at 20 and 30 have passed
+  FakeClock::current += milliseconds(10);
+  EXPECT_EQ(schedule.tick(work(milliseconds(25))), 1u);
+  EXPECT_EQ(schedule.statistics().overruns, 1u);
+
+  // the call is for the period due at 30, the one due at 20 is skipped
+  EXPECT_EQ(schedule.tick(work(milliseconds(1))), 1u);
+  const auto & statistics = schedule.statistics();
+  EXPECT_EQ(statistics.calls, 2u);
+  EXPECT_EQ(statistics.overruns, 1u);
+  EXPECT_EQ(statistics.skipped_periods, 1u);
+  EXPECT_EQ(statistics.caught_up_calls, 0u);
+  EXPECT_DOUBLE_EQ(statistics.jitter_ms.max(), 5.0);
+  EXPECT_DOUBLE_EQ(statistics.overrun_rate(), 0.5);
+  EXPECT_EQ(schedule.next_due(), FakeClock::time_point{} + milliseconds(40));
+}
+
+TEST(TestDeadlineTimer, CatchUpAfterOverrun)
+{
+  FakeClock::current = FakeClock::time_point{};
+  DeadlineSchedule<FakeClock> schedule(milliseconds(10), DeadlinePolicy::catch_up, 2);
+  schedule.start(FakeClock::now());
+
+  // the periods due at 20, 30, 40 and 50 have passed, the last two are caught up
+  FakeClock::current += milliseconds(10);
+  EXPECT_EQ(schedule.tick(work(milliseconds(45))), 1u);
+  EXPECT_EQ(schedule.tick(work(milliseconds(1))), 3u);
+
+  const auto & statistics = schedule.statistics();
+  EXPECT_EQ(statistics.calls, 4u);
+  EXPECT_EQ(statistics.skipped_periods, 1u);
+  EXPECT_EQ(statistics.caught_up_calls, 2u);
+  // the calls due at 30, 40 and 50 start at 55, 56 and 57, the first two end after their deadline
+  EXPECT_EQ(statistics.overruns, 3u);
+  EXPECT_DOUBLE_EQ(statistics.jitter_ms.max(), 25.0);
+  EXPECT_DOUBLE_EQ(statistics.jitter_ms.min(), 0.0);
+  EXPECT_EQ(schedule.next_due(), FakeClock::time_point{} + milliseconds(60));
+}
+
+TEST(TestDeadlineTimer, KeyValues)
+{
+  FakeClock::current = FakeClock::time_point{};
+  DeadlineSchedule<FakeClock> schedule(milliseconds(10));
+  schedule.start(FakeClock::now());
+
+  FakeDiagnostics empty;
+  schedule.statistics().add_key_values(empty);
+  EXPECT_EQ(empty.values.at("calls"), "0");
+  EXPECT_EQ(empty.values.at("max_jitter_ms"), std::to_string(0.0));
+
+  FakeClock::current += milliseconds(10);
+  schedule.tick(work(milliseconds(12)));
+  FakeDiagnostics diagnostics;
+  schedule.statistics().add_key_values(diagnostics);
+  EXPECT_EQ(diagnostics.values.at("calls"), "1");
+  EXPECT_EQ(diagnostics.values.at("overruns"), "1");
+  EXPECT_EQ(diagnostics.values.count("execution_ms_p99"), 1u);
+
+  schedule.statistics().clear();
+  EXPECT_EQ(schedule.statistics().calls, 0u);
+  EXPECT_EQ(schedule.statistics().execution_histogram.count(), 0u);
+}
+
+TEST(TestDeadlineTimer, InvalidPeriod)
+{
+  EXPECT_THROW(DeadlineSchedule<>(milliseconds(0)), std::invalid_argument);
+}
+
+TEST(TestDeadlineTimer, Timer)
+{
+  const auto node = std::make_shared<rclcpp::Node>("deadline_timer_node");
+  int callbacks = 0;
+  const auto timer = autoware_utils_rclcpp::DeadlineTimer::create(
+    node.get(), milliseconds(10), [&callbacks] { ++callbacks; });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  const auto end = std::chrono::steady_clock::now() + milliseconds(100);
+  while (std::chrono::steady_clock::now() < end) {
+    executor.spin_some(milliseconds(10));
+    std::this_thread::sleep_for(milliseconds(1));
+  }
+
+  EXPECT_GT(callbacks, 0);
+  EXPECT_EQ(timer->statistics().calls, static_cast<uint64_t>(callbacks));
+  EXPECT_GE(timer->statistics().jitter_ms.min(), 0.0);
+}
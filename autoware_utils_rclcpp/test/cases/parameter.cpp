@@ -54,3 +54,30 @@ TEST(TestParameter, Update)
   EXPECT_FALSE(autoware_utils_rclcpp::update_param(params, "baz", baz));
   EXPECT_EQ(baz, "default");
 }
+
+TEST(TestParameter, DeclareParameters)
+{
+  struct Params
+  {
+    int foo{0};
+    double bar{1.5};
+    std::string baz{"default"};
+  };
+
+  rclcpp::NodeOptions options;
+  options.append_parameter_override("foo", 12345);
+  options.append_parameter_override("baz", "str");
+  const auto node = std::make_shared<rclcpp::Node>("param_declare_parameters", options);
+  node->declare_parameter<int>("foo");
+
+  // the declared parameters are read, the others are declared with the defaults of the struct
+  Params params;
+  using autoware_utils_rclcpp::parameter_field;
+  autoware_utils_rclcpp::declare_parameters(
+    *node, params, parameter_field("foo", &Params::foo), parameter_field("bar", &Params::bar),
+    parameter_field("baz", &Params::baz));
+  EXPECT_EQ(params.foo, 12345);
+  EXPECT_EQ(params.bar, 1.5);
+  EXPECT_EQ(params.baz, "str");
+  EXPECT_TRUE(node->has_parameter("bar"));
+}
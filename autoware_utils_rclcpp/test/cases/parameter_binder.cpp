@@ -0,0 +1,80 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_rclcpp/parameter_binder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct Params
+{
+  int foo{0};
+  double bar{0.0};
+  std::string baz{"default"};
+};
+}  // namespace
+
+TEST(TestParameterBinder, Update)
+{
+  autoware_utils_rclcpp::ParameterBinder<Params> binder;
+  binder.bind("foo", &Params::foo).bind("bar", &Params::bar).bind("baz", &Params::baz);
+  EXPECT_EQ(binder.size(), 3u);
+  EXPECT_THROW(binder.bind("foo", &Params::foo), std::invalid_argument);
+
+  const auto before = binder.snapshot();
+  const std::vector<rclcpp::Parameter> params = {
+    rclcpp::Parameter("foo", 12345),
+    rclcpp::Parameter("qux", 1.0),
+    rclcpp::Parameter("baz", "str"),
+  };
+  EXPECT_EQ(binder.update(params), 2u);
+  EXPECT_EQ(binder.params().foo, 12345);
+  EXPECT_EQ(binder.snapshot()->baz, "str");
+  EXPECT_EQ(before->foo, 0);
+
+  // a batch with a value of the wrong type is not applied
+  const std::vector<rclcpp::Parameter> invalid = {
+    rclcpp::Parameter("bar", 1.0),
+    rclcpp::Parameter("foo", "str"),
+  };
+  EXPECT_ANY_THROW(binder.update(invalid));
+  EXPECT_EQ(binder.snapshot()->bar, 0.0);
+  EXPECT_EQ(binder.params().foo, 12345);
+}
+
+TEST(TestParameterBinder, Attach)
+{
+  rclcpp::NodeOptions options;
+  options.append_parameter_override("foo", 1);
+  options.append_parameter_override("bar", 2.0);
+  options.append_parameter_override("baz", "str");
+  const auto node = std::make_shared<rclcpp::Node>("param_binder", options);
+
+  autoware_utils_rclcpp::ParameterBinder<Params> binder;
+  binder.bind("foo", &Params::foo).bind("bar", &Params::bar).bind("baz", &Params::baz);
+  const auto handle = binder.attach(*node);
+  EXPECT_EQ(binder.snapshot()->foo, 1);
+  EXPECT_EQ(binder.snapshot()->baz, "str");
+
+  EXPECT_TRUE(node->set_parameter(rclcpp::Parameter("bar", 3.0)).successful);
+  EXPECT_EQ(binder.snapshot()->bar, 3.0);
+  EXPECT_FALSE(node->set_parameter(rclcpp::Parameter("bar", "str")).successful);
+  EXPECT_EQ(binder.snapshot()->bar, 3.0);
+}
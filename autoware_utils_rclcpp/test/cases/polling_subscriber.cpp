@@ -14,12 +14,14 @@
 
 #include "autoware_utils_rclcpp/polling_subscriber.hpp"
 
+#include <geometry_msgs/msg/point_stamped.hpp>
 #include <std_msgs/msg/string.hpp>
 
 #include <gtest/gtest.h>
 
 #include <chrono>
 #include <memory>
+#include <stdexcept>
 #include <thread>
 
 TEST(TestPollingSubscriber, PubSub)
@@ -51,3 +53,276 @@ TEST(TestPollingSubscriber, PubSub)
   executor.cancel();
   thread.join();
 }
+
+TEST(TestPollingSubscriber, NoNewData)
+{
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+  const auto latest = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String>::create_subscription(sub_node.get(), "/test/no_data", 1);
+  const auto newest = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::Newest>::
+    create_subscription(sub_node.get(), "/test/no_data", 1);
+  const auto all = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::All>::
+    create_subscription(sub_node.get(), "/test/no_data", 1);
+
+  // the polls without a message reuse the spare message
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(latest->take_data(), nullptr);
+    EXPECT_EQ(newest->take_data(), nullptr);
+    EXPECT_TRUE(all->take_data().empty());
+  }
+}
+
+TEST(TestPollingSubscriber, SerializedAndLoaned)
+{
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node");
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<std_msgs::msg::String>("/test/deferred", 1);
+  const auto serialized = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::Serialized>::
+    create_subscription(sub_node.get(), "/test/deferred", 1);
+  const auto loaned = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::Loaned>::
+    create_subscription(sub_node.get(), "/test/deferred", 1);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(pub_node);
+  executor.add_node(sub_node);
+
+  std::thread thread([&executor] { executor.spin(); });
+  while (rclcpp::ok() && !executor.is_spinning()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std_msgs::msg::String pub_msg;
+  pub_msg.data = "foo-bar";
+  pub->publish(pub_msg);
+
+  const auto deferred = serialized->take_data();
+  ASSERT_NE(deferred, nullptr);
+  EXPECT_GT(deferred->serialized().size(), 0u);
+  EXPECT_EQ(deferred->get()->data, pub_msg.data);
+  EXPECT_EQ(serialized->take_data(), nullptr);
+
+  const auto loaned_msg = loaned->take_data();
+  ASSERT_NE(loaned_msg, nullptr);
+  EXPECT_EQ(loaned_msg->data, pub_msg.data);
+
+  executor.cancel();
+  thread.join();
+}
+
+TEST(TestPollingSubscriber, Buffered)
+{
+  using geometry_msgs::msg::PointStamped;
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node");
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<PointStamped>("/test/buffered", 10);
+  const auto sub = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    PointStamped, autoware_utils_rclcpp::polling_policy::Buffered<3>::Policy>::
+    create_subscription(sub_node.get(), "/test/buffered", 10);
+  EXPECT_EQ(sub->take_data(), nullptr);
+  EXPECT_EQ(sub->take_closest(rclcpp::Time(0, 0)), nullptr);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(pub_node);
+  executor.add_node(sub_node);
+
+  std::thread thread([&executor] { executor.spin(); });
+  while (rclcpp::ok() && !executor.is_spinning()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // the oldest message is overwritten
+  for (int sec = 1; sec <= 4; ++sec) {
+    PointStamped msg;
+    msg.header.stamp.sec = sec;
+    pub->publish(msg);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const auto newest = sub->take_data();
+  ASSERT_NE(newest, nullptr);
+  EXPECT_EQ(newest->header.stamp.sec, 4);
+  EXPECT_EQ(sub->size(), 3u);
+
+  const auto since = sub->take_since(rclcpp::Time(3, 0));
+  ASSERT_EQ(since.size(), 2u);
+  EXPECT_EQ(since[0]->header.stamp.sec, 3);
+  EXPECT_EQ(sub->take_closest(rclcpp::Time(0, 0))->header.stamp.sec, 2);
+  EXPECT_EQ(sub->take_closest(rclcpp::Time(3, 600'000'000))->header.stamp.sec, 4);
+
+  executor.cancel();
+  thread.join();
+}
+
+TEST(TestPollingSubscriber, DrainLatest)
+{
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node");
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<std_msgs::msg::String>("/test/drain", 5);
+  const auto sub = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::DrainLatest>::
+    create_subscription(sub_node.get(), "/test/drain", 5);
+  EXPECT_EQ(sub->take_data(), nullptr);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(pub_node);
+  executor.add_node(sub_node);
+
+  std::thread thread([&executor] { executor.spin(); });
+  while (rclcpp::ok() && !executor.is_spinning()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // a burst is drained to its last message
+  for (const auto * text : {"foo", "bar", "baz"}) {
+    std_msgs::msg::String msg;
+    msg.data = text;
+    pub->publish(msg);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const auto latest = sub->take_data();
+  ASSERT_NE(latest, nullptr);
+  EXPECT_EQ(latest->data, "baz");
+  EXPECT_EQ(sub->take_data(), latest);
+
+  executor.cancel();
+  thread.join();
+}
+
+TEST(TestPollingSubscriber, Statistics)
+{
+  using geometry_msgs::msg::PointStamped;
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node");
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<PointStamped>("/test/statistics", 1);
+  const auto sub = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    PointStamped, autoware_utils_rclcpp::polling_policy::Newest>::
+    create_subscription(sub_node.get(), "/test/statistics", 1);
+  EXPECT_FALSE(sub->statistics());
+  sub->enable_statistics(true);
+  EXPECT_EQ(sub->take_data(), nullptr);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(pub_node);
+  executor.add_node(sub_node);
+
+  std::thread thread([&executor] { executor.spin(); });
+  while (rclcpp::ok() && !executor.is_spinning()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  PointStamped msg;
+  msg.header.stamp = sub_node->now();
+  pub->publish(msg);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_NE(sub->take_data(), nullptr);
+
+  ASSERT_TRUE(sub->statistics());
+  const auto & statistics = *sub->statistics();
+  EXPECT_EQ(statistics.polls, 2u);
+  EXPECT_EQ(statistics.takes, 1u);
+  EXPECT_DOUBLE_EQ(statistics.hit_rate(), 0.5);
+  EXPECT_EQ(statistics.ages, 1u);
+  EXPECT_GE(statistics.age_last_ns, 100'000'000);
+
+  sub->statistics()->clear();
+  EXPECT_EQ(sub->statistics()->polls, 0u);
+
+  executor.cancel();
+  thread.join();
+}
+
+TEST(TestPollingSubscriber, IntraProcess)
+{
+  const auto options = rclcpp::NodeOptions().use_intra_process_comms(true);
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node", options);
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<std_msgs::msg::String>("/test/intra_process", 1);
+  const auto sub = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::IntraProcess>::
+    create_subscription(sub_node.get(), "/test/intra_process", 1);
+  EXPECT_EQ(sub->take_data(), nullptr);
+
+  // the published message itself is polled, without an executor
+  auto pub_msg = std::make_unique<std_msgs::msg::String>();
+  pub_msg->data = "foo-bar";
+  const auto * address = pub_msg.get();
+  pub->publish(std::move(pub_msg));
+
+  const auto sub_msg = sub->take_data();
+  ASSERT_NE(sub_msg, nullptr);
+  EXPECT_EQ(sub_msg.get(), address);
+  EXPECT_EQ(sub_msg->data, "foo-bar");
+  EXPECT_EQ(sub->take_data(), sub_msg);
+}
+
+TEST(TestPollingSubscriber, IntraProcessWithInterProcessSubscriber)
+{
+  const auto options = rclcpp::NodeOptions().use_intra_process_comms(true);
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node", options);
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto pub = pub_node->create_publisher<std_msgs::msg::String>("/test/intra_and_inter", 1);
+  const auto sub = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::IntraProcess>::
+    create_subscription(sub_node.get(), "/test/intra_and_inter", 1);
+  sub->enable_statistics(true);
+  // the publisher sends a copy through the middleware too, which the poller receives as well
+  const auto inter = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String>::create_subscription(sub_node.get(), "/test/intra_and_inter", 1);
+
+  auto pub_msg = std::make_unique<std_msgs::msg::String>();
+  pub_msg->data = "foo-bar";
+  const auto * address = pub_msg.get();
+  pub->publish(std::move(pub_msg));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const auto inter_msg = inter->take_data();
+  ASSERT_NE(inter_msg, nullptr);
+  EXPECT_EQ(inter_msg->data, "foo-bar");
+
+  // the copy from the middleware is dropped, the message is delivered and counted once
+  const auto sub_msg = sub->take_data();
+  ASSERT_NE(sub_msg, nullptr);
+  EXPECT_EQ(sub_msg.get(), address);
+  EXPECT_EQ(sub->take_data(), sub_msg);
+  EXPECT_EQ(sub->statistics()->takes, 1u);
+}
+
+TEST(TestPollingSubscriber, IntraProcessQoS)
+{
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+  using Subscriber = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::IntraProcess>;
+  EXPECT_THROW(
+    Subscriber::create_subscription(sub_node.get(), "/test/intra_qos", rclcpp::QoS{2}),
+    std::invalid_argument);
+  EXPECT_THROW(
+    Subscriber::create_subscription(
+      sub_node.get(), "/test/intra_qos", rclcpp::QoS{1}.transient_local()),
+    std::invalid_argument);
+}
+
+TEST(TestPollingSubscriber, SerializedAndLoanedQoS)
+{
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+  using SerializedSubscriber = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::Serialized>;
+  using LoanedSubscriber = autoware_utils_rclcpp::InterProcessPollingSubscriber<
+    std_msgs::msg::String, autoware_utils_rclcpp::polling_policy::Loaned>;
+  EXPECT_THROW(
+    SerializedSubscriber::create_subscription(sub_node.get(), "/test/deferred_qos", rclcpp::QoS{2}),
+    std::invalid_argument);
+  EXPECT_THROW(
+    LoanedSubscriber::create_subscription(sub_node.get(), "/test/deferred_qos", rclcpp::QoS{2}),
+    std::invalid_argument);
+}
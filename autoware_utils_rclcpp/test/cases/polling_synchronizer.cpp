@@ -0,0 +1,85 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_rclcpp/polling_synchronizer.hpp"
+
+#include <geometry_msgs/msg/point_stamped.hpp>
+#include <geometry_msgs/msg/vector3_stamped.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+TEST(TestPollingSynchronizer, ExactAndApproximate)
+{
+  using geometry_msgs::msg::PointStamped;
+  using geometry_msgs::msg::Vector3Stamped;
+  using Synchronizer = autoware_utils_rclcpp::PollingSynchronizer<4, PointStamped, Vector3Stamped>;
+  const auto pub_node = std::make_shared<rclcpp::Node>("pub_node");
+  const auto sub_node = std::make_shared<rclcpp::Node>("sub_node");
+
+  const auto point_pub = pub_node->create_publisher<PointStamped>("/test/sync/point", 10);
+  const auto vector_pub = pub_node->create_publisher<Vector3Stamped>("/test/sync/vector", 10);
+  const auto point_sub = Synchronizer::Subscriber<PointStamped>::create_subscription(
+    sub_node.get(), "/test/sync/point", 10);
+  const auto vector_sub = Synchronizer::Subscriber<Vector3Stamped>::create_subscription(
+    sub_node.get(), "/test/sync/vector", 10);
+  EXPECT_THROW(Synchronizer(rclcpp::Duration(0, 0), point_sub, nullptr), std::invalid_argument);
+  EXPECT_THROW(
+    Synchronizer(rclcpp::Duration(-1, 0), point_sub, vector_sub), std::invalid_argument);
+
+  Synchronizer exact(rclcpp::Duration(0, 0), point_sub, vector_sub);
+  EXPECT_FALSE(exact.take_data());
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(pub_node);
+  executor.add_node(sub_node);
+
+  std::thread thread([&executor] { executor.spin(); });
+  while (rclcpp::ok() && !executor.is_spinning()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // only the first stamps are equal, the second ones differ by 5 ms
+  for (int sec = 1; sec <= 2; ++sec) {
+    PointStamped point;
+    point.header.stamp.sec = sec;
+    point_pub->publish(point);
+    Vector3Stamped vector;
+    vector.header.stamp.sec = sec;
+    vector.header.stamp.nanosec = sec == 1 ? 0 : 5'000'000;
+    vector_pub->publish(vector);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const auto exact_set = exact.take_data();
+  ASSERT_TRUE(exact_set);
+  EXPECT_EQ(std::get<0>(*exact_set)->header.stamp.sec, 1);
+  EXPECT_EQ(std::get<1>(*exact_set)->header.stamp.sec, 1);
+  EXPECT_FALSE(exact.take_data());
+
+  // the newest set is returned once
+  Synchronizer approximate(rclcpp::Duration(0, 10'000'000), point_sub, vector_sub);
+  const auto approximate_set = approximate.take_data();
+  ASSERT_TRUE(approximate_set);
+  EXPECT_EQ(std::get<0>(*approximate_set)->header.stamp.sec, 2);
+  EXPECT_EQ(std::get<1>(*approximate_set)->header.stamp.nanosec, 5'000'000u);
+  EXPECT_FALSE(approximate.take_data());
+
+  executor.cancel();
+  thread.join();
+}
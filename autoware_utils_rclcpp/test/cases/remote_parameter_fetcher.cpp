@@ -0,0 +1,113 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_rclcpp/remote_parameter_fetcher.hpp"
+
+#include <rcl_interfaces/srv/get_parameters.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(TestRemoteParameterFetcher, FetchAndUpdate)
+{
+  const auto remote_node = std::make_shared<rclcpp::Node>("remote_node");
+  const auto local_node = std::make_shared<rclcpp::Node>("local_node");
+  remote_node->declare_parameter<int>("foo", 12345);
+
+  std::atomic<int> callbacks{0};
+  autoware_utils_rclcpp::RemoteParameterFetcher fetcher(
+    local_node.get(), "remote_node", {"foo", "bar"},
+    [&callbacks](const std::vector<rclcpp::Parameter> &) { ++callbacks; }, true,
+    std::chrono::milliseconds(10));
+  EXPECT_FALSE(fetcher.is_ready());
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(remote_node);
+  executor.add_node(local_node);
+  std::thread thread([&executor] { executor.spin(); });
+
+  const auto wait_for = [](const auto & condition) {
+    for (int i = 0; i < 500 && !condition(); ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+  };
+
+  // the parameters which are not declared are not fetched
+  ASSERT_TRUE(wait_for([&fetcher] { return fetcher.is_ready(); }));
+  EXPECT_EQ(fetcher.get<int>("foo"), 12345);
+  EXPECT_FALSE(fetcher.get<int>("bar"));
+  EXPECT_EQ(callbacks, 1);
+
+  remote_node->set_parameter(rclcpp::Parameter("foo", 54321));
+  EXPECT_TRUE(wait_for([&fetcher] { return fetcher.get<int>("foo") == 54321; }));
+  EXPECT_EQ(callbacks, 2);
+
+  executor.cancel();
+  thread.join();
+}
+
+TEST(TestRemoteParameterFetcher, RetryShortResponse)
+{
+  using rcl_interfaces::srv::GetParameters;
+
+  // a remote node whose parameter service answers without the values at first
+  const auto remote_node = std::make_shared<rclcpp::Node>(
+    "short_remote_node", rclcpp::NodeOptions().start_parameter_services(false));
+  const auto local_node = std::make_shared<rclcpp::Node>("short_local_node");
+  std::atomic<int> requests{0};
+  const auto service = remote_node->create_service<GetParameters>(
+    "short_remote_node/get_parameters",
+    [&requests](
+      const GetParameters::Request::SharedPtr request,
+      const GetParameters::Response::SharedPtr response) {
+      if (++requests < 3) {
+        return;
+      }
+      for (std::size_t i = 0; i < request->names.size(); ++i) {
+        rcl_interfaces::msg::ParameterValue value;
+        value.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER;
+        value.integer_value = 12345;
+        response->values.push_back(value);
+      }
+    });
+
+  std::atomic<int> callbacks{0};
+  autoware_utils_rclcpp::RemoteParameterFetcher fetcher(
+    local_node.get(), "short_remote_node", {"foo"},
+    [&callbacks](const std::vector<rclcpp::Parameter> &) { ++callbacks; }, false,
+    std::chrono::milliseconds(10));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(remote_node);
+  executor.add_node(local_node);
+  std::thread thread([&executor] { executor.spin(); });
+
+  for (int i = 0; i < 500 && !fetcher.is_ready(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(fetcher.is_ready());
+  EXPECT_EQ(requests, 3);
+  EXPECT_EQ(fetcher.get<int>("foo"), 12345);
+  EXPECT_EQ(callbacks, 1);
+
+  executor.cancel();
+  thread.join();
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/concurrent_lru_cache.hpp"
+#include "autoware_utils_system/lru_cache.hpp"
+#include "autoware_utils_system/two_queue_cache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <vector>
+
+// Hit rates of the eviction policies replaying a trace of keys. The trace is read from the file
+// named by AUTOWARE_UTILS_SYSTEM_CACHE_TRACE, one integer key per line, e.g. the lanelet ids
+// looked up during a drive. Without it, a synthetic trace mixes lookups of a skewed working set
+// with scans of keys used once, like a route replan touching thousands of lanelets.
+namespace
+{
+constexpr size_t capacity = 1024;
+
+std::vector<std::int64_t> make_synthetic_trace()
+{
+  constexpr size_t working_set = 2048;
+  constexpr size_t lookups_between_scans = 20000;
+  constexpr size_t scan_size = 4096;
+
+  // Zipf-like weights, so that half of the lookups go to about a hundred keys
+  std::vector<double> weights(working_set);
+  for (size_t i = 0; i < working_set; ++i) {
+    weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), 0.9);
+  }
+  std::mt19937 gen(0);
+  std::discrete_distribution<std::int64_t> hot(weights.begin(), weights.end());
+
+  std::vector<std::int64_t> trace;
+  std::int64_t next_cold = working_set;
+  for (size_t round = 0; round < 10; ++round) {
+    for (size_t i = 0; i < lookups_between_scans; ++i) {
+      trace.push_back(hot(gen));
+    }
+    for (size_t i = 0; i < scan_size; ++i) {
+      trace.push_back(next_cold++);
+    }
+  }
+  return trace;
+}
+
+const std::vector<std::int64_t> & trace()
+{
+  static const std::vector<std::int64_t> keys = [] {
+    const char * path = std::getenv("AUTOWARE_UTILS_SYSTEM_CACHE_TRACE");
+    if (!path) {
+      return make_synthetic_trace();
+    }
+    std::vector<std::int64_t> recorded;
+    std::ifstream file(path);
+    for (std::int64_t key; file >> key;) {
+      recorded.push_back(key);
+    }
+    return recorded;
+  }();
+  return keys;
+}
+
+/// @brief replay the trace through get() and put() on a miss, and report the hit rate
+template <class Cache>
+void replay(benchmark::State & state)
+{
+  const auto & keys = trace();
+  size_t hits = 0;
+  size_t lookups = 0;
+  for (auto _ : state) {
+    Cache cache(capacity);
+    for (const auto key : keys) {
+      if (cache.get(key)) {
+        ++hits;
+      } else {
+        cache.put(key, key);
+      }
+    }
+    lookups += keys.size();
+  }
+  state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(lookups);
+  state.counters["time/lookup"] = benchmark::Counter(
+    static_cast<double>(keys.size()),
+    benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+BENCHMARK_TEMPLATE(replay, autoware_utils_system::LRUCache<std::int64_t, std::int64_t>);
+BENCHMARK_TEMPLATE(replay, autoware_utils_system::FlatLRUCache<std::int64_t, std::int64_t>);
+BENCHMARK_TEMPLATE(replay, autoware_utils_system::ConcurrentLRUCache<std::int64_t, std::int64_t>);
+BENCHMARK_TEMPLATE(replay, autoware_utils_system::TwoQueueCache<std::int64_t, std::int64_t>);
+}  // namespace
@@ -0,0 +1,158 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/lru_cache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Throughput and latency of LRUCache with the Map of std::unordered_map or std::map, replaying
+// key streams through get() and put() on a miss. The arguments are the workload and the capacity:
+// - uniform: keys drawn uniformly from twice the capacity, half of the lookups hit.
+// - zipf: keys drawn from ten times the capacity with a Zipf exponent of 0.99, the hot keys hit.
+// - scan: keys cycled over 1.5 times the capacity, the worst case of LRU where no lookup hits.
+namespace
+{
+using Key = std::int64_t;
+
+enum Workload : std::int64_t { uniform, zipf, scan };
+
+std::vector<Key> make_keys(const Workload workload, const size_t capacity)
+{
+  // long enough to cycle the large capacities, and whole cycles of the scan so that the replays
+  // continue each other
+  const size_t cycle = capacity + capacity / 2;
+  const size_t stream_size = (std::max<size_t>(1 << 16, 4 * capacity) + cycle - 1) / cycle * cycle;
+  std::mt19937_64 gen(0);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::vector<Key> keys(stream_size);
+  for (size_t i = 0; i < stream_size; ++i) {
+    switch (workload) {
+      case uniform:
+        keys[i] = static_cast<Key>(unit(gen) * static_cast<double>(2 * capacity));
+        break;
+      case zipf: {
+        // inverse of the continuous power law, which is close to the Zipf law for large ranks
+        constexpr double s = 0.99;
+        const double n = static_cast<double>(10 * capacity);
+        const double power = (std::pow(n, 1.0 - s) - 1.0) * unit(gen) + 1.0;
+        const double rank = std::pow(power, 1.0 / (1.0 - s));
+        keys[i] = static_cast<Key>(rank) - 1;
+        break;
+      }
+      case scan:
+        keys[i] = static_cast<Key>(i % cycle);
+        break;
+    }
+  }
+  return keys;
+}
+
+template <class Cache>
+bool access(Cache & cache, const Key key)
+{
+  if (cache.get_ptr(key)) {
+    return true;
+  }
+  cache.put(key, key);
+  return false;
+}
+
+/// @brief a cache filled by a first pass over the keys, so that the measure starts warm
+template <class Cache>
+Cache make_warm_cache(const size_t capacity, const std::vector<Key> & keys)
+{
+  Cache cache(capacity);
+  for (const auto key : keys) {
+    access(cache, key);
+  }
+  for (size_t i = 0; cache.size() < capacity; ++i) {
+    cache.put(-1 - static_cast<Key>(i), 0);
+  }
+  return cache;
+}
+
+template <template <typename...> class Map>
+void lru_cache_throughput(benchmark::State & state)
+{
+  const auto workload = static_cast<Workload>(state.range(0));
+  const auto capacity = static_cast<size_t>(state.range(1));
+  const auto keys = make_keys(workload, capacity);
+  auto cache = make_warm_cache<autoware_utils_system::LRUCache<Key, Key, Map>>(capacity, keys);
+
+  size_t hits = 0;
+  for (auto _ : state) {
+    for (const auto key : keys) {
+      hits += access(cache, key);
+    }
+  }
+  const auto lookups = static_cast<double>(state.iterations()) * static_cast<double>(keys.size());
+  state.counters["hit_rate"] = static_cast<double>(hits) / lookups;
+  state.counters["lookups"] = benchmark::Counter(lookups, benchmark::Counter::kIsRate);
+}
+
+/// @brief the percentiles of the time of each lookup, which includes the overhead of the clock
+template <template <typename...> class Map>
+void lru_cache_latency(benchmark::State & state)
+{
+  const auto workload = static_cast<Workload>(state.range(0));
+  const auto capacity = static_cast<size_t>(state.range(1));
+  const auto keys = make_keys(workload, capacity);
+  auto cache = make_warm_cache<autoware_utils_system::LRUCache<Key, Key, Map>>(capacity, keys);
+
+  std::vector<double> latencies;
+  latencies.reserve(keys.size());
+  for (auto _ : state) {
+    latencies.clear();
+    for (const auto key : keys) {
+      const auto start = std::chrono::steady_clock::now();
+      benchmark::DoNotOptimize(access(cache, key));
+      const auto end = std::chrono::steady_clock::now();
+      latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+  }
+  const auto percentile = [&latencies](const double p) {
+    const auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(p * (latencies.size() - 1));
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return *nth;
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["p999_ns"] = percentile(0.999);
+}
+
+void workloads_and_capacities(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->ArgNames({"workload", "capacity"});
+  for (const auto workload : {uniform, zipf, scan}) {
+    for (std::int64_t capacity = 16; capacity <= (1 << 20); capacity *= 16) {
+      benchmark->Args({workload, capacity});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(lru_cache_throughput, std::unordered_map)->Apply(workloads_and_capacities);
+BENCHMARK_TEMPLATE(lru_cache_throughput, std::map)->Apply(workloads_and_capacities);
+BENCHMARK_TEMPLATE(lru_cache_latency, std::unordered_map)->Apply(workloads_and_capacities);
+BENCHMARK_TEMPLATE(lru_cache_latency, std::map)->Apply(workloads_and_capacities);
+}  // namespace
@@ -0,0 +1,59 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/stop_watch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+// Overhead of a tic() and toc() pair, which bounds the shortest interval worth measuring.
+namespace
+{
+void stop_watch_named(benchmark::State & state)
+{
+  autoware_utils_system::StopWatch<std::chrono::nanoseconds> sw;
+  for (auto _ : state) {
+    sw.tic("stage");
+    benchmark::DoNotOptimize(sw.toc("stage"));
+  }
+}
+
+void stop_watch_default(benchmark::State & state)
+{
+  autoware_utils_system::StopWatch<std::chrono::nanoseconds> sw;
+  for (auto _ : state) {
+    sw.tic();
+    benchmark::DoNotOptimize(sw.toc());
+  }
+}
+
+template <class Clock>
+void fixed_stop_watch(benchmark::State & state)
+{
+  using std::chrono::nanoseconds;
+  autoware_utils_system::FixedStopWatch<4, nanoseconds, nanoseconds, Clock> sw;
+  for (auto _ : state) {
+    sw.template tic<2>();
+    benchmark::DoNotOptimize(sw.template toc<2>());
+  }
+}
+
+BENCHMARK(stop_watch_named);
+BENCHMARK(stop_watch_default);
+BENCHMARK_TEMPLATE(fixed_stop_watch, std::chrono::steady_clock);
+#ifdef CLOCK_MONOTONIC_RAW
+BENCHMARK_TEMPLATE(fixed_stop_watch, autoware_utils_system::MonotonicRawClock);
+#endif
+}  // namespace
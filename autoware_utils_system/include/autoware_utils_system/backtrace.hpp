@@ -15,11 +15,100 @@
 #ifndef AUTOWARE_UTILS_SYSTEM__BACKTRACE_HPP_
 #define AUTOWARE_UTILS_SYSTEM__BACKTRACE_HPP_
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace autoware_utils_system
 {
 
 void print_backtrace();
 
+/**
+ * @brief The return addresses of a call stack, not symbolized.
+ */
+struct RawBacktrace
+{
+  static constexpr size_t max_frames = 64;
+
+  std::array<void *, max_frames> frames{};
+  size_t size = 0;
+};
+
+/**
+ * @brief Symbolize the frames of a backtrace, with the C++ names demangled.
+ *
+ * This allocates and reads the symbol tables, so it should run off the hot threads.
+ *
+ * @param backtrace The backtrace to symbolize.
+ * @return One line per frame, as `binary(function+offset) [address]`.
+ */
+std::vector<std::string> symbolize(const RawBacktrace & backtrace);
+
+/**
+ * @brief A preallocated ring of the last backtraces, recorded without symbolization.
+ *
+ * record() only stores the return addresses in a slot reserved with an atomic counter, so it does
+ * not allocate nor lock and can be called from a hot loop or a signal handler. drain() copies the
+ * backtraces recorded since the previous drain, to be symbolized later, e.g. by a low priority
+ * thread or at shutdown. The backtraces overwritten before being drained are counted as dropped.
+ * The capacity should exceed the number of threads recording concurrently.
+ */
+class BacktraceRing
+{
+public:
+  /**
+   * @brief Construct a ring and load the unwinder, so that record() does not allocate.
+   *
+   * @param capacity The number of backtraces kept.
+   * @throw std::invalid_argument if the capacity is 0.
+   */
+  explicit BacktraceRing(size_t capacity);
+
+  /**
+   * @brief Record the backtrace of the caller, async-signal-safe.
+   *
+   * @param skip The number of innermost frames of the caller to omit, e.g. a signal handler.
+   */
+  void record(size_t skip = 0) noexcept;
+
+  /**
+   * @brief Copy the backtraces recorded since the previous drain, oldest first.
+   *
+   * A backtrace still being recorded is left for the next drain.
+   *
+   * @return The backtraces.
+   */
+  std::vector<RawBacktrace> drain();
+
+  /**
+   * @brief Get the number of backtraces overwritten before being drained.
+   *
+   * @return The number of dropped backtraces.
+   */
+  uint64_t dropped() const;
+
+private:
+  struct Slot
+  {
+    std::atomic<uint64_t> sequence{0};  ///< 2 * (index + 1) once the index is written, odd while.
+    std::array<std::atomic<void *>, RawBacktrace::max_frames> frames{};
+    std::atomic<size_t> size{0};
+  };
+
+  size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> next_{0};
+  mutable std::mutex drain_mutex_;
+  uint64_t read_ = 0;
+  uint64_t dropped_ = 0;
+};
+
 }  // namespace autoware_utils_system
 
 #endif  // AUTOWARE_UTILS_SYSTEM__BACKTRACE_HPP_
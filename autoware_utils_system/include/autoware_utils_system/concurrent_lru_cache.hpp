@@ -0,0 +1,216 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__CONCURRENT_LRU_CACHE_HPP_
+#define AUTOWARE_UTILS_SYSTEM__CONCURRENT_LRU_CACHE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A thread-safe cache which approximates the LRU eviction.
+ *
+ * The keys are distributed by their hash to shards which are locked independently. In a shard, the
+ * eviction follows the CLOCK algorithm: get() only sets a referenced flag of the entry under a
+ * shared lock, so concurrent readers do not block each other, and put() evicts the first entry
+ * whose flag is not set from a rotating hand, clearing the flags on its way. The capacity is
+ * divided between the shards, so an entry may be evicted while another shard has room.
+ *
+ * @tparam Key The type of keys.
+ * @tparam Value The type of values.
+ * @tparam Hash The hash function of the keys.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ConcurrentLRUCache
+{
+private:
+  struct Shard
+  {
+    explicit Shard(const size_t capacity)
+    : capacity(capacity), referenced(std::make_unique<std::atomic<bool>[]>(capacity))
+    {
+      entries.reserve(capacity);
+      index.reserve(capacity);
+    }
+
+    size_t capacity;
+    mutable std::shared_mutex mutex;
+    std::vector<std::pair<Key, Value>> entries;
+    std::unique_ptr<std::atomic<bool>[]> referenced;  ///< Set by get(), cleared by the hand.
+    std::unordered_map<Key, size_t, Hash> index;      ///< Entry of each key.
+    size_t hand = 0;                                  ///< Next eviction candidate.
+  };
+
+  size_t capacity_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  Hash hash_;
+
+  Shard & shard(const Key & key) const
+  {
+    // the high bits of the Fibonacci hashing are independent of the buckets of the shard maps
+    constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    const auto mixed = static_cast<std::uint64_t>(hash_(key)) * multiplier;
+    return *shards_[static_cast<size_t>(mixed >> 32) % shards_.size()];
+  }
+
+public:
+  /**
+   * @brief Construct a new ConcurrentLRUCache object.
+   *
+   * @param size The capacity of the cache.
+   * @param shard_count The number of independently locked shards, e.g. about 4 times the number of
+   * threads sharing the cache.
+   */
+  explicit ConcurrentLRUCache(size_t size, size_t shard_count = 16) : capacity_(size)
+  {
+    shard_count = std::max<size_t>(1, std::min(shard_count, size));
+    for (size_t i = 0; i < shard_count; ++i) {
+      // the first shards take the remainder of the division
+      shards_.push_back(std::make_unique<Shard>(size / shard_count + (i < size % shard_count)));
+    }
+  }
+
+  /**
+   * @brief Get the capacity of the cache.
+   *
+   * @return The capacity of the cache.
+   */
+  [[nodiscard]] size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Insert a key-value pair into the cache.
+   *
+   * If the key already exists, its value is updated and it is marked as referenced.
+   * If the shard of the key is full, an entry which was not referenced recently is replaced.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, const Value & value)
+  {
+    Shard & s = shard(key);
+    std::unique_lock lock(s.mutex);
+    if (const auto it = s.index.find(key); it != s.index.end()) {
+      s.entries[it->second].second = value;
+      s.referenced[it->second].store(true, std::memory_order_relaxed);
+      return;
+    }
+    if (s.capacity == 0) {
+      return;
+    }
+    if (s.entries.size() < s.capacity) {
+      s.index.emplace(key, s.entries.size());
+      s.referenced[s.entries.size()].store(false, std::memory_order_relaxed);
+      s.entries.emplace_back(key, value);
+      return;
+    }
+    // a second chance for the referenced entries, which ends after a turn at most
+    while (s.referenced[s.hand].exchange(false, std::memory_order_relaxed)) {
+      s.hand = (s.hand + 1) % s.capacity;
+    }
+    const size_t victim = s.hand;
+    s.hand = (s.hand + 1) % s.capacity;
+    s.index.erase(s.entries[victim].first);
+    s.entries[victim] = {key, value};
+    s.index.emplace(key, victim);
+  }
+
+  /**
+   * @brief Retrieve a value from the cache.
+   *
+   * If the key does not exist in the cache, std::nullopt is returned.
+   * If the key exists, the value is returned and the element is marked as referenced.
+   *
+   * @param key The key to retrieve.
+   * @return The value associated with the key, or std::nullopt if the key does not exist.
+   */
+  std::optional<Value> get(const Key & key)
+  {
+    Shard & s = shard(key);
+    std::shared_lock lock(s.mutex);
+    const auto it = s.index.find(key);
+    if (it == s.index.end()) {
+      return std::nullopt;
+    }
+    s.referenced[it->second].store(true, std::memory_order_relaxed);
+    return s.entries[it->second].second;
+  }
+
+  /**
+   * @brief Clear the cache.
+   *
+   * This removes all elements from the cache.
+   */
+  void clear()
+  {
+    for (const auto & s : shards_) {
+      std::unique_lock lock(s->mutex);
+      s->entries.clear();
+      s->index.clear();
+      s->hand = 0;
+    }
+  }
+
+  /**
+   * @brief Get the current size of the cache.
+   *
+   * @return The number of elements in the cache, which may be outdated if other threads insert.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    size_t size = 0;
+    for (const auto & s : shards_) {
+      std::shared_lock lock(s->mutex);
+      size += s->entries.size();
+    }
+    return size;
+  }
+
+  /**
+   * @brief Check if the cache is empty.
+   *
+   * @return True if the cache is empty, false otherwise.
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Check if a key exists in the cache.
+   *
+   * @param key The key to check.
+   * @return True if the key exists, false otherwise.
+   */
+  [[nodiscard]] bool contains(const Key & key) const
+  {
+    const Shard & s = shard(key);
+    std::shared_lock lock(s.mutex);
+    return s.index.find(key) != s.index.end();
+  }
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__CONCURRENT_LRU_CACHE_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__CYCLE_ARENA_HPP_
+#define AUTOWARE_UTILS_SYSTEM__CYCLE_ARENA_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A monotonic memory resource whose allocations are all released at once by reset(), e.g.
+ * at the start of each cycle of a node.
+ *
+ * The allocations take consecutive bytes of one buffer, and deallocate() does nothing. When a
+ * cycle needs more than the buffer, the excess is taken from the upstream resource, and reset()
+ * grows the buffer to the peak usage, so that the following cycles of the same size do not call
+ * the upstream resource at all. The memory of a long run is then a single block instead of many
+ * small ones fragmenting the heap. The arena is not thread-safe, use one per thread.
+ *
+ * @code
+ * arena_.reset();
+ * std::pmr::vector<Point2d> points(&arena_);
+ * @endcode
+ */
+class CycleArena : public std::pmr::memory_resource
+{
+public:
+  /**
+   * @brief Create the arena with its first buffer.
+   *
+   * @param initial_size The size of the first buffer in bytes.
+   * @param upstream The resource of the buffers and of the excess of a cycle.
+   */
+  explicit CycleArena(
+    size_t initial_size = 64 * 1024,
+    std::pmr::memory_resource * upstream = std::pmr::get_default_resource());
+
+  ~CycleArena() override;
+
+  CycleArena(const CycleArena &) = delete;
+  CycleArena & operator=(const CycleArena &) = delete;
+
+  /**
+   * @brief Release all the allocations, and grow the buffer to the peak usage if it was exceeded.
+   */
+  void reset();
+
+  /**
+   * @brief Get the size of the buffer in bytes.
+   */
+  size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Get the bytes allocated since the last reset, including the alignment padding.
+   */
+  size_t used() const { return used_; }
+
+  /**
+   * @brief Get the bytes allocated from the upstream resource since the last reset.
+   */
+  size_t overflow() const { return overflow_bytes_; }
+
+private:
+  void * do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *, size_t, size_t) override {}
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+  std::pmr::memory_resource * upstream_;
+  std::byte * buffer_ = nullptr;
+  size_t capacity_ = 0;
+  size_t offset_ = 0;
+  size_t used_ = 0;
+  size_t overflow_bytes_ = 0;
+  std::pmr::monotonic_buffer_resource overflow_;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__CYCLE_ARENA_HPP_
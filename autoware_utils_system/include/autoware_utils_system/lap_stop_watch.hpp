@@ -0,0 +1,169 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__LAP_STOP_WATCH_HPP_
+#define AUTOWARE_UTILS_SYSTEM__LAP_STOP_WATCH_HPP_
+
+#include "autoware_utils_system/stop_watch.hpp"
+
+#include <autoware_utils_math/accumulator.hpp>
+#include <autoware_utils_math/quantile.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief The statistics of the laps of a label.
+ */
+struct LapSummary
+{
+  std::string label;
+  size_t count;
+  double mean;
+  double stddev;
+  double min;
+  double max;
+  double p50;  ///< Estimate of the median.
+  double p99;  ///< Estimate of the 99th percentile.
+};
+
+inline std::ostream & operator<<(std::ostream & os, const LapSummary & summary)
+{
+  return os << summary.label << ": count " << summary.count << ", mean " << summary.mean
+            << ", stddev " << summary.stddev << ", min " << summary.min << ", max "
+            << summary.max << ", p50 " << summary.p50 << ", p99 " << summary.p99;
+}
+
+/**
+ * @brief A stop watch accumulating the statistics of the intervals between the laps of labels.
+ *
+ * lap() returns the time since the last tic() or lap() of the label, like toc(label, true), and
+ * adds it to the statistics of the label. With a report callback, the summaries are passed to it
+ * from lap() once per period and the statistics restart, so each report covers the last period.
+ *
+ * @code
+ * LapStopWatch<> sw;
+ * sw.set_report(std::chrono::seconds(10), [this](const auto & summaries) {
+ *   for (const auto & summary : summaries) RCLCPP_INFO_STREAM(get_logger(), summary);
+ * });
+ * sw.tic("callback");
+ * // ...
+ * sw.lap("callback");
+ * @endcode
+ *
+ * @tparam OutputUnit The unit of the intervals and the statistics.
+ * @tparam InternalUnit The unit the intervals are truncated to.
+ * @tparam Clock The clock of the intervals and of the report period.
+ */
+template <
+  class OutputUnit = std::chrono::milliseconds, class InternalUnit = std::chrono::microseconds,
+  class Clock = std::chrono::steady_clock>
+class LapStopWatch
+{
+public:
+  using ReportCallback = std::function<void(const std::vector<LapSummary> &)>;
+
+  void tic(const std::string & label) { stop_watch_.tic(label); }
+
+  /**
+   * @brief record the interval since the last tic() or lap() of the label and restart it
+   * @return the interval
+   * @throw std::out_of_range if the label was not started
+   */
+  double lap(const std::string & label)
+  {
+    const double interval = stop_watch_.toc(label, true);
+    auto it = statistics_.find(label);
+    if (it == statistics_.end()) {
+      it = statistics_.emplace(label, Statistics{}).first;
+    }
+    it->second.accumulator.add(interval);
+    it->second.p50.add(interval);
+    it->second.p99.add(interval);
+
+    if (callback_ && Clock::now() - last_report_ >= period_) {
+      report();
+    }
+    return interval;
+  }
+
+  /**
+   * @brief call the callback with the summaries every period, from lap()
+   * @param period the period of the reports
+   * @param callback the callback, or an empty function to stop the reports
+   */
+  void set_report(typename Clock::duration period, ReportCallback callback)
+  {
+    period_ = period;
+    callback_ = std::move(callback);
+    last_report_ = Clock::now();
+  }
+
+  /**
+   * @brief get the statistics of the labels since the construction, the last report or reset
+   * @return the summaries, sorted by label
+   */
+  std::vector<LapSummary> summary() const
+  {
+    std::vector<LapSummary> summaries;
+    summaries.reserve(statistics_.size());
+    for (const auto & [label, statistics] : statistics_) {
+      const auto & accumulator = statistics.accumulator;
+      summaries.push_back(LapSummary{
+        label, accumulator.count(), static_cast<double>(accumulator.mean()),
+        static_cast<double>(accumulator.stddev()), accumulator.min(), accumulator.max(),
+        statistics.p50.quantile(), statistics.p99.quantile()});
+    }
+    return summaries;
+  }
+
+  /**
+   * @brief clear the statistics, the running laps are kept
+   */
+  void reset() { statistics_.clear(); }
+
+private:
+  struct Statistics
+  {
+    autoware_utils_math::Accumulator<double> accumulator;
+    autoware_utils_math::P2Quantile p50{0.5};
+    autoware_utils_math::P2Quantile p99{0.99};
+  };
+
+  void report()
+  {
+    callback_(summary());
+    reset();
+    last_report_ = Clock::now();
+  }
+
+  StopWatch<OutputUnit, InternalUnit, Clock> stop_watch_;
+  std::map<std::string, Statistics> statistics_;
+  ReportCallback callback_;
+  typename Clock::duration period_{};
+  typename Clock::time_point last_report_{};
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__LAP_STOP_WATCH_HPP_
@@ -14,11 +14,19 @@
 #ifndef AUTOWARE_UTILS_SYSTEM__LRU_CACHE_HPP_
 #define AUTOWARE_UTILS_SYSTEM__LRU_CACHE_HPP_
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <optional>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace autoware_utils_system
 {
@@ -28,18 +36,126 @@ namespace autoware_utils_system
  *
  * This class implements a simple LRU cache using a combination of a list and a hash map.
  *
+ * By default the capacity bounds the number of elements. When a weigher is given, it bounds the
+ * sum of the weights of the elements instead, e.g. their size in bytes. The elements can also be
+ * given a time to live, after which they are removed by the next lookup.
+ *
  * @tparam Key The type of keys.
  * @tparam Value The type of values.
  * @tparam Map The type of underlying map, defaulted to std::unordered_map.
+ * @tparam Clock The clock of the times to live, defaulted to std::chrono::steady_clock.
  */
-template <typename Key, typename Value, template <typename...> class Map = std::unordered_map>
+template <
+  typename Key, typename Value, template <typename...> class Map = std::unordered_map,
+  typename Clock = std::chrono::steady_clock>
 class LRUCache
 {
+public:
+  /// @brief The function returning the weight of an element.
+  using Weigher = std::function<size_t(const Key &, const Value &)>;
+
+  /// @brief The counters of the cache.
+  struct Stats
+  {
+    size_t hits = 0;         ///< Number of lookups which found the key.
+    size_t misses = 0;       ///< Number of lookups which did not find the key.
+    size_t evictions = 0;    ///< Number of elements removed to fit the capacity.
+    size_t expirations = 0;  ///< Number of elements removed after their time to live.
+  };
+
 private:
-  size_t capacity_;                              ///< The maximum capacity of the cache.
-  std::list<std::pair<Key, Value>> cache_list_;  ///< List to maintain the order of elements.
-  Map<Key, typename std::list<std::pair<Key, Value>>::iterator>
-    cache_map_;  ///< Map for fast access to elements.
+  struct Entry
+  {
+    template <typename... Args>
+    explicit Entry(const Key & key, Args &&... args)
+    : key(key), value(std::forward<Args>(args)...)
+    {
+    }
+
+    Key key;
+    Value value;
+    size_t weight = 1;
+    typename Clock::time_point expiry = Clock::time_point::max();
+  };
+
+  size_t capacity_;                ///< The maximum capacity of the cache.
+  Weigher weigher_;                ///< The weigher of the elements, empty to count them.
+  size_t weight_ = 0;              ///< The sum of the weights of the elements.
+  typename Clock::duration ttl_;   ///< The time to live of the inserted elements.
+  std::list<Entry> cache_list_;    ///< List to maintain the order of elements.
+  Map<Key, typename std::list<Entry>::iterator> cache_map_;  ///< Map for fast access to elements.
+  Stats stats_;
+
+  static bool is_expired(const Entry & entry)
+  {
+    return entry.expiry != Clock::time_point::max() && Clock::now() >= entry.expiry;
+  }
+
+  void erase(typename std::list<Entry>::iterator it)
+  {
+    weight_ -= it->weight;
+    cache_map_.erase(it->key);
+    cache_list_.erase(it);
+  }
+
+  /// @brief return the entry of the key after removing it if expired, without counting the lookup
+  typename std::list<Entry>::iterator find(const Key & key)
+  {
+    auto it = cache_map_.find(key);
+    if (it == cache_map_.end()) {
+      return cache_list_.end();
+    }
+    if (is_expired(*it->second)) {
+      erase(it->second);
+      ++stats_.expirations;
+      return cache_list_.end();
+    }
+    return it->second;
+  }
+
+  /// @brief insert the element at the front, return nullptr if it does not fit the capacity
+  template <typename... Args>
+  Value * emplace_front(const Key & key, typename Clock::duration ttl, Args &&... args)
+  {
+    auto it = cache_map_.find(key);
+    if (it != cache_map_.end()) {
+      erase(it->second);
+    }
+    Entry & entry = cache_list_.emplace_front(key, std::forward<Args>(args)...);
+    if (weigher_) {
+      entry.weight = weigher_(entry.key, entry.value);
+    }
+    if (ttl != Clock::duration::max()) {
+      entry.expiry = Clock::now() + ttl;
+    }
+    weight_ += entry.weight;
+    cache_map_[key] = cache_list_.begin();
+
+    // do not flush the other elements for one which would not fit anyway
+    if (entry.weight > capacity_) {
+      erase(cache_list_.begin());
+      ++stats_.evictions;
+      return nullptr;
+    }
+    while (weight_ > capacity_) {
+      erase(std::prev(cache_list_.end()));
+      ++stats_.evictions;
+    }
+    return &entry.value;
+  }
+
+  template <typename... Args>
+  Value & emplace_or_throw(const Key & key, typename Clock::duration ttl, Args &&... args)
+  {
+    if (capacity_ == 0) {
+      throw std::length_error("the capacity of the cache is 0.");
+    }
+    Value * value = emplace_front(key, ttl, std::forward<Args>(args)...);
+    if (!value) {
+      throw std::length_error("the weight of the value exceeds the capacity of the cache.");
+    }
+    return *value;
+  }
 
 public:
   /**
@@ -47,15 +163,50 @@ public:
    *
    * @param size The capacity of the cache.
    */
-  explicit LRUCache(size_t size) : capacity_(size) {}
+  explicit LRUCache(size_t size) : capacity_(size), ttl_(Clock::duration::max()) {}
+
+  /**
+   * @brief Construct a new LRUCache object bounding the sum of the weights of the elements.
+   *
+   * The weight of an element is computed when it is inserted. If a value is modified through
+   * get_ptr, its weight is not updated until it is inserted again.
+   *
+   * @param budget The maximum sum of the weights of the elements.
+   * @param weigher The function returning the weight of an element.
+   * @throw std::invalid_argument if the weigher is empty.
+   */
+  LRUCache(size_t budget, Weigher weigher)
+  : capacity_(budget), weigher_(std::move(weigher)), ttl_(Clock::duration::max())
+  {
+    if (!weigher_) {
+      throw std::invalid_argument("the weigher is empty.");
+    }
+  }
 
   /**
    * @brief Get the capacity of the cache.
    *
-   * @return The capacity of the cache.
+   * @return The capacity of the cache, in elements, or in weight if the cache has a weigher.
    */
   [[nodiscard]] size_t capacity() const { return capacity_; }
 
+  /**
+   * @brief Get the sum of the weights of the elements, which is the size without a weigher.
+   *
+   * @return The sum of the weights of the elements.
+   */
+  [[nodiscard]] size_t weight() const { return weight_; }
+
+  /**
+   * @brief Set the time to live of the elements inserted from now on.
+   *
+   * The elements already in the cache keep their time to live. An expired element is removed by
+   * the next lookup of its key, or evicted like the others when it is the least recently used.
+   *
+   * @param ttl The time to live, or Clock::duration::max() for elements which do not expire.
+   */
+  void set_time_to_live(typename Clock::duration ttl) { ttl_ = ttl; }
+
   /**
    * @brief Insert a key-value pair into the cache.
    *
@@ -65,20 +216,59 @@ public:
    * @param key The key to insert.
    * @param value The value to insert.
    */
-  void put(const Key & key, const Value & value)
+  void put(const Key & key, const Value & value) { emplace_front(key, ttl_, value); }
+
+  /**
+   * @brief Insert a key-value pair into the cache, moving the value.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, Value && value) { emplace_front(key, ttl_, std::move(value)); }
+
+  /**
+   * @brief Insert a key-value pair into the cache, which expires after the given time.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   * @param ttl The time to live of this element.
+   */
+  void put(const Key & key, Value value, typename Clock::duration ttl)
   {
-    auto it = cache_map_.find(key);
-    if (it != cache_map_.end()) {
-      cache_list_.erase(it->second);
-    }
-    cache_list_.push_front({key, value});
-    cache_map_[key] = cache_list_.begin();
+    emplace_front(key, ttl, std::move(value));
+  }
 
-    if (cache_map_.size() > capacity_) {
-      auto last = cache_list_.back();
-      cache_map_.erase(last.first);
-      cache_list_.pop_back();
+  /**
+   * @brief Construct a value in place in the cache, replacing the value of the key if any.
+   *
+   * @param key The key to insert.
+   * @param args The arguments of the constructor of the value.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the value does not fit the capacity, as it would be evicted
+   * immediately.
+   */
+  template <typename... Args>
+  Value & emplace(const Key & key, Args &&... args)
+  {
+    return emplace_or_throw(key, ttl_, std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Retrieve a value from the cache, computing and inserting it if the key does not exist.
+   *
+   * @param key The key to retrieve.
+   * @param factory The function returning the value of the key, only called on a miss.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the value does not fit the capacity, as it would be evicted
+   * immediately.
+   */
+  template <typename Factory>
+  Value & get_or_compute(const Key & key, Factory && factory)
+  {
+    if (Value * value = get_ptr(key)) {
+      return *value;
     }
+    return emplace_or_throw(key, ttl_, std::forward<Factory>(factory)());
   }
 
   /**
@@ -91,29 +281,68 @@ public:
    * @return The value associated with the key, or std::nullopt if the key does not exist.
    */
   std::optional<Value> get(const Key & key)
+  {
+    if (Value * value = get_ptr(key)) {
+      return *value;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it.
+   *
+   * If the key exists, the element is moved to the front.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, valid until the element is evicted or replaced, or nullptr if
+   * the key does not exist.
+   */
+  Value * get_ptr(const Key & key)
+  {
+    auto it = find(key);
+    if (it == cache_list_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    cache_list_.splice(cache_list_.begin(), cache_list_, it);
+    return &it->value;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it or changing the order of use.
+   *
+   * The lookup is not counted in the statistics.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, or nullptr if the key does not exist or is expired.
+   */
+  const Value * peek(const Key & key) const
   {
     auto it = cache_map_.find(key);
-    if (it == cache_map_.end()) {
-      return std::nullopt;
+    if (it == cache_map_.end() || is_expired(*it->second)) {
+      return nullptr;
     }
-    cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-    return it->second->second;
+    return &it->second->value;
   }
 
   /**
    * @brief Clear the cache.
    *
-   * This removes all elements from the cache.
+   * This removes all elements from the cache. The statistics are kept.
    */
   void clear()
   {
     cache_list_.clear();
     cache_map_.clear();
+    weight_ = 0;
   }
 
   /**
    * @brief Get the current size of the cache.
    *
+   * The expired elements which have not been looked up yet are counted.
+   *
    * @return The number of elements in the cache.
    */
   [[nodiscard]] size_t size() const { return cache_map_.size(); }
@@ -129,12 +358,314 @@ public:
    * @brief Check if a key exists in the cache.
    *
    * @param key The key to check.
-   * @return True if the key exists, false otherwise.
+   * @return True if the key exists and is not expired, false otherwise.
+   */
+  [[nodiscard]] bool contains(const Key & key) const { return peek(key) != nullptr; }
+
+  /**
+   * @brief Get the counters of the lookups and removals since the construction or the last reset.
+   *
+   * @return The counters of the cache.
+   */
+  [[nodiscard]] const Stats & stats() const { return stats_; }
+
+  /**
+   * @brief Reset the counters of the cache.
    */
-  [[nodiscard]] bool contains(const Key & key) const
+  void reset_stats() { stats_ = Stats{}; }
+};
+
+/**
+ * @brief LRU cache which does not allocate once constructed.
+ *
+ * The entries are stored in an array of the capacity, linked in the order of use by indices, and
+ * indexed by an open-addressing hash table with linear probing. The removal of an entry shifts the
+ * following slots back, so the probes stay short without tombstones. The interface is the same as
+ * LRUCache.
+ *
+ * @tparam Key The type of keys.
+ * @tparam Value The type of values.
+ * @tparam Hash The hash function of the keys.
+ * @tparam KeyEqual The equality of the keys.
+ */
+template <
+  typename Key, typename Value, typename Hash = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>>
+class FlatLRUCache
+{
+private:
+  static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+  size_t capacity_;                            ///< The maximum capacity of the cache.
+  std::vector<std::pair<Key, Value>> entries_;  ///< Entries, never reallocated.
+  std::vector<size_t> prev_;                   ///< Previous entry in the order of use.
+  std::vector<size_t> next_;                   ///< Next entry in the order of use.
+  size_t head_ = none;                         ///< Most recently used entry.
+  size_t tail_ = none;                         ///< Least recently used entry.
+  std::vector<size_t> slots_;                  ///< Entry of each slot of the hash table.
+  int shift_;                                  ///< Shift of the hash to the slot index.
+  Hash hash_;
+  KeyEqual equal_;
+
+  size_t home_slot(const Key & key) const
   {
-    return cache_map_.find(key) != cache_map_.end();
+    // Fibonacci hashing spreads the hashes which are not uniform, e.g. the identity of integers
+    constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>((static_cast<std::uint64_t>(hash_(key)) * multiplier) >> shift_);
   }
+
+  size_t mask() const { return slots_.size() - 1; }
+
+  /// @brief slot of the key, or the empty slot where it would be inserted
+  size_t find_slot(const Key & key) const
+  {
+    size_t slot = home_slot(key);
+    while (slots_[slot] != none && !equal_(entries_[slots_[slot]].first, key)) {
+      slot = (slot + 1) & mask();
+    }
+    return slot;
+  }
+
+  void erase_slot(size_t slot)
+  {
+    // move back the entries which are after the slot in their probe sequence
+    for (size_t next = (slot + 1) & mask(); slots_[next] != none; next = (next + 1) & mask()) {
+      const size_t home = home_slot(entries_[slots_[next]].first);
+      const bool between = slot <= next ? (slot < home && home <= next)
+                                        : (slot < home || home <= next);
+      if (!between) {
+        slots_[slot] = slots_[next];
+        slot = next;
+      }
+    }
+    slots_[slot] = none;
+  }
+
+  void unlink(const size_t entry)
+  {
+    (prev_[entry] == none ? head_ : next_[prev_[entry]]) = next_[entry];
+    (next_[entry] == none ? tail_ : prev_[next_[entry]]) = prev_[entry];
+  }
+
+  void push_front(const size_t entry)
+  {
+    prev_[entry] = none;
+    next_[entry] = head_;
+    (head_ == none ? tail_ : prev_[head_]) = entry;
+    head_ = entry;
+  }
+
+  void move_to_front(const size_t entry)
+  {
+    if (entry != head_) {
+      unlink(entry);
+      push_front(entry);
+    }
+  }
+
+  /// @brief insert or replace the value of the key, return its entry or none if the capacity is 0
+  template <typename V>
+  size_t assign(const Key & key, V && value)
+  {
+    size_t slot = find_slot(key);
+    if (slots_[slot] != none) {
+      entries_[slots_[slot]].second = std::forward<V>(value);
+      move_to_front(slots_[slot]);
+      return slots_[slot];
+    }
+    if (capacity_ == 0) {
+      return none;
+    }
+
+    size_t entry;
+    if (entries_.size() < capacity_) {
+      entry = entries_.size();
+      entries_.emplace_back(key, std::forward<V>(value));
+      prev_.push_back(none);
+      next_.push_back(none);
+    } else {
+      entry = tail_;
+      erase_slot(find_slot(entries_[entry].first));
+      unlink(entry);
+      entries_[entry].first = key;
+      entries_[entry].second = std::forward<V>(value);
+      slot = find_slot(key);  // the erase may have moved the empty slot
+    }
+    slots_[slot] = entry;
+    push_front(entry);
+    return entry;
+  }
+
+public:
+  /**
+   * @brief Construct a new FlatLRUCache object, allocating the storage of all the entries.
+   *
+   * @param size The capacity of the cache.
+   */
+  explicit FlatLRUCache(size_t size) : capacity_(size)
+  {
+    entries_.reserve(size);
+    prev_.reserve(size);
+    next_.reserve(size);
+    // the load factor stays below 1/2
+    size_t slot_count = 2;
+    int bits = 1;
+    while (slot_count < 2 * size) {
+      slot_count *= 2;
+      ++bits;
+    }
+    slots_.assign(slot_count, none);
+    shift_ = 64 - bits;
+  }
+
+  /**
+   * @brief Get the capacity of the cache.
+   *
+   * @return The capacity of the cache.
+   */
+  [[nodiscard]] size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Insert a key-value pair into the cache.
+   *
+   * If the key already exists, its value is updated and it is moved to the front.
+   * If the cache is full, the least recently used element is replaced.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, const Value & value) { assign(key, value); }
+
+  /**
+   * @brief Insert a key-value pair into the cache, moving the value.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, Value && value) { assign(key, std::move(value)); }
+
+  /**
+   * @brief Construct a value in the cache, replacing the value of the key if any.
+   *
+   * The value is constructed then moved into the storage of the entry.
+   *
+   * @param key The key to insert.
+   * @param args The arguments of the constructor of the value.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the capacity is 0, as the value would be evicted immediately.
+   */
+  template <typename... Args>
+  Value & emplace(const Key & key, Args &&... args)
+  {
+    if (capacity_ == 0) {
+      throw std::length_error("the capacity of the cache is 0.");
+    }
+    return entries_[assign(key, Value(std::forward<Args>(args)...))].second;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache, computing and inserting it if the key does not exist.
+   *
+   * @param key The key to retrieve.
+   * @param factory The function returning the value of the key, only called on a miss.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the capacity is 0, as the value would be evicted immediately.
+   */
+  template <typename Factory>
+  Value & get_or_compute(const Key & key, Factory && factory)
+  {
+    if (Value * value = get_ptr(key)) {
+      return *value;
+    }
+    return emplace(key, std::forward<Factory>(factory)());
+  }
+
+  /**
+   * @brief Retrieve a value from the cache.
+   *
+   * If the key does not exist in the cache, std::nullopt is returned.
+   * If the key exists, the value is returned and the element is moved to the front.
+   *
+   * @param key The key to retrieve.
+   * @return The value associated with the key, or std::nullopt if the key does not exist.
+   */
+  std::optional<Value> get(const Key & key)
+  {
+    const size_t entry = slots_[find_slot(key)];
+    if (entry == none) {
+      return std::nullopt;
+    }
+    move_to_front(entry);
+    return entries_[entry].second;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it.
+   *
+   * If the key exists, the element is moved to the front.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, valid until the element is evicted or replaced, or nullptr if
+   * the key does not exist.
+   */
+  Value * get_ptr(const Key & key)
+  {
+    const size_t entry = slots_[find_slot(key)];
+    if (entry == none) {
+      return nullptr;
+    }
+    move_to_front(entry);
+    return &entries_[entry].second;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it or changing the order of use.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, or nullptr if the key does not exist.
+   */
+  const Value * peek(const Key & key) const
+  {
+    const size_t entry = slots_[find_slot(key)];
+    return entry == none ? nullptr : &entries_[entry].second;
+  }
+
+  /**
+   * @brief Clear the cache.
+   *
+   * This removes all elements from the cache and keeps the storage.
+   */
+  void clear()
+  {
+    entries_.clear();
+    prev_.clear();
+    next_.clear();
+    std::fill(slots_.begin(), slots_.end(), none);
+    head_ = none;
+    tail_ = none;
+  }
+
+  /**
+   * @brief Get the current size of the cache.
+   *
+   * @return The number of elements in the cache.
+   */
+  [[nodiscard]] size_t size() const { return entries_.size(); }
+
+  /**
+   * @brief Check if the cache is empty.
+   *
+   * @return True if the cache is empty, false otherwise.
+   */
+  [[nodiscard]] bool empty() const { return entries_.empty(); }
+
+  /**
+   * @brief Check if a key exists in the cache.
+   *
+   * @param key The key to check.
+   * @return True if the key exists, false otherwise.
+   */
+  [[nodiscard]] bool contains(const Key & key) const { return slots_[find_slot(key)] != none; }
 };
 
 }  // namespace autoware_utils_system
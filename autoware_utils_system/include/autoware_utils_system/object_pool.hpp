@@ -0,0 +1,114 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__OBJECT_POOL_HPP_
+#define AUTOWARE_UTILS_SYSTEM__OBJECT_POOL_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A pool of objects of one type, which are reused instead of destroyed when released.
+ *
+ * The objects keep their state when they are released, so that the containers among them keep
+ * their capacity, e.g. a pool of marker arrays or point clouds filled every cycle allocates only
+ * until the largest size is reached. The reset function, if given, is applied to the objects when
+ * they are acquired again. The pool must outlive the objects acquired from it, and it is not
+ * thread-safe.
+ *
+ * @tparam T The type of the objects, default constructible.
+ */
+template <typename T>
+class ObjectPool
+{
+public:
+  /// @brief The deleter of the acquired objects, returning them to the pool.
+  struct Release
+  {
+    ObjectPool * pool;
+    void operator()(T * object) const { pool->release(object); }
+  };
+
+  /// @brief The owner of an acquired object.
+  using Pointer = std::unique_ptr<T, Release>;
+
+  /**
+   * @brief Create the pool.
+   *
+   * @param reserve The number of objects created up front.
+   * @param reset The function applied to the reused objects, e.g. calling clear().
+   */
+  explicit ObjectPool(size_t reserve = 0, std::function<void(T &)> reset = nullptr)
+  : reset_(std::move(reset))
+  {
+    free_.reserve(reserve);
+    for (size_t i = 0; i < reserve; ++i) {
+      free_.push_back(std::make_unique<T>());
+    }
+  }
+
+  ObjectPool(const ObjectPool &) = delete;
+  ObjectPool & operator=(const ObjectPool &) = delete;
+
+  /**
+   * @brief Get the last released object, which is likely still cached, or a new one if none.
+   *
+   * @return The object, returned to the pool when the pointer is destroyed.
+   */
+  Pointer acquire()
+  {
+    if (free_.empty()) {
+      ++created_;
+      return Pointer(new T(), Release{this});
+    }
+    T * object = free_.back().release();
+    free_.pop_back();
+    if (reset_) {
+      reset_(*object);
+    }
+    return Pointer(object, Release{this});
+  }
+
+  /**
+   * @brief Get the number of released objects ready to be reused.
+   */
+  size_t available() const { return free_.size(); }
+
+  /**
+   * @brief Get the number of objects created by acquire(), because no released one was available.
+   */
+  size_t created() const { return created_; }
+
+  /**
+   * @brief Destroy the released objects.
+   */
+  void shrink() { free_.clear(); }
+
+private:
+  void release(T * object) { free_.emplace_back(object); }
+
+  std::vector<std::unique_ptr<T>> free_;
+  std::function<void(T &)> reset_;
+  size_t created_ = 0;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__OBJECT_POOL_HPP_
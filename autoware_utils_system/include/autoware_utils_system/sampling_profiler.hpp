@@ -0,0 +1,119 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__SAMPLING_PROFILER_HPP_
+#define AUTOWARE_UTILS_SYSTEM__SAMPLING_PROFILER_HPP_
+
+#include "autoware_utils_system/backtrace.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief An in-process sampling profiler writing folded stacks for flame graphs.
+ *
+ * While the profiler exists, a SIGPROF timer of the CPU time of the process interrupts the running
+ * threads at the given frequency, and the signal handler records the stack of the interrupted
+ * thread in a BacktraceRing. collect() moves the samples out of the ring and counts the identical
+ * stacks, without symbolizing them, so it can be called periodically to avoid drops. write_folded()
+ * symbolizes the stacks and writes one line `outermost;...;innermost count` per stack, the input
+ * of flamegraph.pl. The functions of an executable are named only if it is linked with -rdynamic.
+ * Only one profiler can run at a time, as the timer and the signal are per process.
+ *
+ * @code
+ * // a member of a node, writing the profile when the node is destroyed
+ * autoware_utils_system::SamplingProfiler profiler_{99.0, 4096, "/tmp/node.folded"};
+ * @endcode
+ */
+class SamplingProfiler
+{
+public:
+  /**
+   * @brief Start the profiler.
+   *
+   * @param frequency The number of samples per second of CPU time.
+   * @param capacity The number of samples kept between two collections.
+   * @param path The file the folded stacks are written to on destruction, empty for none.
+   * @throw std::invalid_argument if the frequency is not positive or the capacity is 0.
+   * @throw std::logic_error if another profiler is running.
+   * @throw std::system_error if the signal handler or the timer cannot be set.
+   */
+  explicit SamplingProfiler(
+    double frequency = 99.0, size_t capacity = 4096, const std::string & path = "");
+
+  /**
+   * @brief Stop the profiler, and write the folded stacks if a path is given.
+   *
+   * @details The signals still pending after the timer is stopped are ignored, and the ring is
+   * destroyed only after the handlers running on other threads have returned. A failure to write
+   * the folded stacks is logged.
+   */
+  ~SamplingProfiler();
+
+  SamplingProfiler(const SamplingProfiler &) = delete;
+  SamplingProfiler & operator=(const SamplingProfiler &) = delete;
+
+  /**
+   * @brief Move the samples recorded since the previous collection out of the ring.
+   */
+  void collect();
+
+  /**
+   * @brief Collect the samples and write the folded stacks.
+   *
+   * @param os The stream to write to.
+   */
+  void write_folded(std::ostream & os);
+
+  /**
+   * @brief Collect the samples and write the folded stacks to a file.
+   *
+   * @param path The path of the file.
+   * @throw std::runtime_error if the file cannot be opened.
+   */
+  void write_folded(const std::string & path);
+
+  /**
+   * @brief Get the number of samples collected.
+   *
+   * @return The number of samples.
+   */
+  size_t samples() const { return samples_; }
+
+  /**
+   * @brief Get the number of samples overwritten before being collected.
+   *
+   * @return The number of dropped samples.
+   */
+  uint64_t dropped() const { return ring_.dropped(); }
+
+private:
+  void stop() noexcept;
+
+  BacktraceRing ring_;
+  std::string path_;
+  std::map<std::vector<void *>, size_t> stacks_;
+  size_t samples_ = 0;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__SAMPLING_PROFILER_HPP_
@@ -0,0 +1,193 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__SPSC_QUEUE_HPP_
+#define AUTOWARE_UTILS_SYSTEM__SPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A lock-free bounded queue between one producer thread and one consumer thread.
+ *
+ * The elements are stored in a ring whose size is a power of two. The producer only writes the
+ * tail and the consumer only writes the head, each on its own cache line with a cached copy of the
+ * other index, so that the threads touch the shared indices only when the queue looks full or
+ * empty. A popped element is moved out and destroyed at once, so that a queue of ConstSharedPtr
+ * does not keep the messages alive.
+ *
+ * @code
+ * // the subscription callback
+ * if (!queue_.try_push(msg)) { RCLCPP_WARN(get_logger(), "dropped"); }
+ * // the timer callback
+ * while (auto msg = queue_.try_pop()) { process(*msg); }
+ * @endcode
+ *
+ * @tparam T The type of the elements.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+  /**
+   * @brief Create the queue.
+   *
+   * @param capacity The number of elements, rounded up to a power of two.
+   * @throw std::invalid_argument if the capacity is 0.
+   */
+  explicit SpscQueue(size_t capacity)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("the capacity of the queue is 0.");
+    }
+    size_t size = 1;
+    while (size < capacity) {
+      size *= 2;
+    }
+    mask_ = size - 1;
+    slots_ = std::make_unique<Slot[]>(size);
+  }
+
+  ~SpscQueue()
+  {
+    while (try_pop()) {
+    }
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue & operator=(const SpscQueue &) = delete;
+
+  /**
+   * @brief Construct an element at the tail, called by the producer only.
+   *
+   * @return false if the queue is full, and nothing is constructed.
+   */
+  template <typename... Args>
+  bool try_emplace(Args &&... args)
+  {
+    const size_t tail = producer_.tail.load(std::memory_order_relaxed);
+    if (tail - producer_.cached_head > mask_) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      if (tail - producer_.cached_head > mask_) {
+        return false;
+      }
+    }
+    new (slots_[tail & mask_].storage) T(std::forward<Args>(args)...);
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_push(const T & value) { return try_emplace(value); }
+
+  bool try_push(T && value) { return try_emplace(std::move(value)); }
+
+  /**
+   * @brief Move the element at the head out, called by the consumer only.
+   *
+   * @return false if the queue is empty, and the value is unchanged.
+   */
+  bool try_pop(T & value)
+  {
+    T * element = front();
+    if (!element) {
+      return false;
+    }
+    value = std::move(*element);
+    pop_front(element);
+    return true;
+  }
+
+  std::optional<T> try_pop()
+  {
+    T * element = front();
+    if (!element) {
+      return std::nullopt;
+    }
+    std::optional<T> value(std::move(*element));
+    pop_front(element);
+    return value;
+  }
+
+  /**
+   * @brief Get the number of elements, exact only when called by the producer or the consumer
+   * while the other one is idle.
+   */
+  size_t size() const
+  {
+    const size_t head = consumer_.head.load(std::memory_order_acquire);
+    return producer_.tail.load(std::memory_order_acquire) - head;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  struct Slot
+  {
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  T * front()
+  {
+    const size_t head = consumer_.head.load(std::memory_order_relaxed);
+    if (head == consumer_.cached_tail) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      if (head == consumer_.cached_tail) {
+        return nullptr;
+      }
+    }
+    return std::launder(reinterpret_cast<T *>(slots_[head & mask_].storage));
+  }
+
+  void pop_front(T * element)
+  {
+    element->~T();
+    const size_t head = consumer_.head.load(std::memory_order_relaxed);
+    consumer_.head.store(head + 1, std::memory_order_release);
+  }
+
+  // the size of the padding separating the data written by different threads
+  static constexpr size_t cache_line_size = 64;
+
+  struct alignas(cache_line_size) Producer
+  {
+    std::atomic<size_t> tail{0};
+    size_t cached_head{0};
+  };
+
+  struct alignas(cache_line_size) Consumer
+  {
+    std::atomic<size_t> head{0};
+    size_t cached_tail{0};
+  };
+
+  Producer producer_;
+  Consumer consumer_;
+  size_t mask_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__SPSC_QUEUE_HPP_
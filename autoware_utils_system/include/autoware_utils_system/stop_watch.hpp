@@ -15,8 +15,12 @@
 #ifndef AUTOWARE_UTILS_SYSTEM__STOP_WATCH_HPP_
 #define AUTOWARE_UTILS_SYSTEM__STOP_WATCH_HPP_
 
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <ctime>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 
 namespace autoware_utils_system
@@ -58,6 +62,117 @@ private:
 
   std::unordered_map<std::string, Time> t_start_;
 };
+
+#ifdef CLOCK_MONOTONIC_RAW
+/**
+ * @brief A clock reading CLOCK_MONOTONIC_RAW, which is not slewed by NTP.
+ *
+ * The intervals are in the units of the hardware counter, so it is preferred to measure short
+ * intervals, while std::chrono::steady_clock is adjusted to the frequency of the reference clock.
+ */
+struct MonotonicRawClock
+{
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<MonotonicRawClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() noexcept
+  {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return time_point(std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
+  }
+};
+#endif
+
+/**
+ * @brief A stop watch with a fixed number of timers, indexed by integers or enumerators.
+ *
+ * The start times are stored in an array, so tic() and toc() neither allocate nor hash a name.
+ * A runtime key must be less than N. A key given as template argument is checked at compile time.
+ *
+ * @code
+ * enum class Stage { preprocess, plan, count };
+ * FixedStopWatch<static_cast<size_t>(Stage::count), std::chrono::milliseconds> sw;
+ * sw.tic<Stage::plan>();
+ * const double plan_ms = sw.toc<Stage::plan>();
+ * @endcode
+ *
+ * @tparam N The number of timers.
+ * @tparam OutputUnit The unit of the durations returned by toc().
+ * @tparam InternalUnit The unit the durations are truncated to.
+ * @tparam Clock The clock, e.g. MonotonicRawClock.
+ */
+template <
+  size_t N = 1, class OutputUnit = std::chrono::seconds,
+  class InternalUnit = std::chrono::microseconds, class Clock = std::chrono::steady_clock>
+class FixedStopWatch
+{
+  static_assert(N > 0, "the stop watch needs at least one timer.");
+
+public:
+  FixedStopWatch() { t_start_.fill(Clock::now()); }
+
+  void tic() { t_start_[0] = Clock::now(); }
+
+  template <class Key>
+  void tic(const Key key)
+  {
+    t_start_[to_index(key)] = Clock::now();
+  }
+
+  template <auto Key>
+  void tic()
+  {
+    static_assert(to_index(Key) < N, "the key is out of the timers.");
+    tic(Key);
+  }
+
+  double toc(const bool reset = false) { return toc_impl(0, reset); }
+
+  template <class Key>
+  double toc(const Key key, const bool reset = false)
+  {
+    return toc_impl(to_index(key), reset);
+  }
+
+  template <auto Key>
+  double toc(const bool reset = false)
+  {
+    static_assert(to_index(Key) < N, "the key is out of the timers.");
+    return toc_impl(to_index(Key), reset);
+  }
+
+private:
+  using Time = std::chrono::time_point<Clock>;
+
+  template <class Key>
+  static constexpr size_t to_index(const Key key)
+  {
+    static_assert(
+      std::is_integral_v<Key> || std::is_enum_v<Key>, "the key must be an integer or an enum.");
+    return static_cast<size_t>(key);
+  }
+
+  double toc_impl(const size_t index, const bool reset)
+  {
+    const auto t_end = Clock::now();
+    const auto duration =
+      std::chrono::duration_cast<InternalUnit>(t_end - t_start_[index]).count();
+
+    if (reset) {
+      t_start_[index] = t_end;
+    }
+
+    constexpr auto one_sec = std::chrono::duration_cast<InternalUnit>(OutputUnit(1)).count();
+
+    return static_cast<double>(duration) / one_sec;
+  }
+
+  std::array<Time, N> t_start_;
+};
 }  // namespace autoware_utils_system
 
 #endif  // AUTOWARE_UTILS_SYSTEM__STOP_WATCH_HPP_
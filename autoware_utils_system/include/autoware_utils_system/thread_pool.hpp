@@ -0,0 +1,155 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__THREAD_POOL_HPP_
+#define AUTOWARE_UTILS_SYSTEM__THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A pool of threads running parallel loops over index ranges with work stealing.
+ *
+ * parallel_for() splits the range evenly between the workers and the calling thread, which take
+ * chunks of the grain size from the front of their own part. A thread whose part is empty steals
+ * the back half of the part of another thread, so that uneven chunks are balanced without a shared
+ * queue. The loop runs serially in the calling thread when the range is not larger than the grain
+ * size, when it is called from a loop of the same pool, or when another thread is running a loop,
+ * so that the nodes sharing the pool never oversubscribe the cores.
+ *
+ * @code
+ * autoware_utils_system::ThreadPool::shared().parallel_for(
+ *   0, points.size(), 1024, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; ++i) {
+ *       transform(points[i]);
+ *     }
+ *   });
+ * @endcode
+ */
+class ThreadPool
+{
+public:
+  struct Options
+  {
+    size_t num_threads = 0;  ///< Number of workers besides the caller, 0 for one per other core.
+    std::vector<int> cpus;   ///< CPU each worker is pinned to in turn, empty for no pinning.
+    int priority = 0;        ///< SCHED_FIFO priority of the workers, 0 to keep the default policy.
+  };
+
+  /**
+   * @brief Start one worker per other core, without pinning them.
+   */
+  ThreadPool();
+
+  /**
+   * @brief Start the workers.
+   *
+   * @param options The number of workers, their CPUs and their priority.
+   * @throw std::invalid_argument if a CPU is out of range.
+   * @throw std::system_error if a worker cannot be pinned or its priority cannot be set.
+   */
+  explicit ThreadPool(const Options & options);
+
+  /**
+   * @brief Stop and join the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Get the pool of the process, with one worker per other core, created on first use.
+   */
+  static ThreadPool & shared();
+
+  /**
+   * @brief Get the number of workers, which does not include the calling thread.
+   */
+  size_t num_threads() const { return workers_.size(); }
+
+  /**
+   * @brief Call the body over consecutive chunks covering [begin, end), and wait for all of them.
+   *
+   * @param begin The first index.
+   * @param end The index after the last one.
+   * @param grain_size The number of indices of a chunk, and the range run serially at most.
+   * @param body Called as body(chunk_begin, chunk_end) from any thread of the pool.
+   * @throw The first exception thrown by the body, after the running chunks finished and the
+   * remaining ones were skipped.
+   */
+  template <class Body>
+  void parallel_for(size_t begin, size_t end, size_t grain_size, Body && body)
+  {
+    if (end <= begin) {
+      return;
+    }
+    auto call = [](void * context, size_t chunk_begin, size_t chunk_end) {
+      (*static_cast<std::remove_reference_t<Body> *>(context))(chunk_begin, chunk_end);
+    };
+    void * context = const_cast<void *>(static_cast<const void *>(std::addressof(body)));
+    if (!try_run(begin, end, grain_size, call, context)) {
+      body(begin, end);
+    }
+  }
+
+private:
+  using Call = void (*)(void *, size_t, size_t);
+
+  struct alignas(64) Part
+  {
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  bool try_run(size_t begin, size_t end, size_t grain_size, Call call, void * context);
+  void work(size_t part);
+  bool steal(size_t part);
+  void loop(size_t part);
+  void stop() noexcept;
+
+  std::vector<std::thread> workers_;
+  std::unique_ptr<Part[]> parts_;  // part 0 is the caller's, part i + 1 the worker i's
+  std::mutex run_mutex_;           // held by the caller running a loop
+
+  std::mutex mutex_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+  uint64_t generation_ = 0;
+  size_t running_ = 0;
+  bool stopped_ = false;
+
+  Call call_ = nullptr;
+  void * context_ = nullptr;
+  size_t grain_size_ = 1;
+  std::atomic<bool> failed_{false};
+  std::exception_ptr error_;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__THREAD_POOL_HPP_
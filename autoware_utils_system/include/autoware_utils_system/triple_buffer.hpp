@@ -0,0 +1,133 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__TRIPLE_BUFFER_HPP_
+#define AUTOWARE_UTILS_SYSTEM__TRIPLE_BUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A lock-free holder of the latest value written by one thread and read by another.
+ *
+ * The writer fills its back buffer and publishes it by swapping it with the middle buffer, and
+ * the reader takes the middle buffer when a new one was published, so that neither thread waits
+ * for the other and the reader always sees a complete value. Each buffer is on its own cache line.
+ * The values which are not read are overwritten, and the buffers keep their content, so that a
+ * buffer of ConstSharedPtr keeps up to two old messages alive besides the one being read.
+ *
+ * @code
+ * // the subscription callback
+ * latest_.write(msg);
+ * // the timer callback
+ * latest_.update();
+ * if (const auto & msg = latest_.read()) { process(*msg); }
+ * @endcode
+ *
+ * @tparam T The type of the values, default constructible.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+  TripleBuffer() = default;
+
+  /**
+   * @brief Create the buffer with the same initial value in all the buffers.
+   */
+  explicit TripleBuffer(const T & value)
+  {
+    for (auto & buffer : buffers_) {
+      buffer.value = value;
+    }
+  }
+
+  TripleBuffer(const TripleBuffer &) = delete;
+  TripleBuffer & operator=(const TripleBuffer &) = delete;
+
+  /**
+   * @brief Get the back buffer to fill in place, called by the writer only.
+   */
+  T & write_buffer() { return buffers_[back_].value; }
+
+  /**
+   * @brief Publish the back buffer as the latest value, called by the writer only.
+   */
+  void publish()
+  {
+    const auto published = static_cast<uint8_t>(back_ | dirty);
+    back_ = middle_.exchange(published, std::memory_order_acq_rel) & index_mask;
+  }
+
+  /**
+   * @brief Write and publish a value, called by the writer only.
+   */
+  template <typename U>
+  void write(U && value)
+  {
+    write_buffer() = std::forward<U>(value);
+    publish();
+  }
+
+  /**
+   * @brief Take the latest published value if it is new, called by the reader only.
+   *
+   * @return true if a value was published since the last update.
+   */
+  bool update()
+  {
+    if (!(middle_.load(std::memory_order_relaxed) & dirty)) {
+      return false;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & index_mask;
+    return true;
+  }
+
+  /**
+   * @brief Get the value taken by the last update, called by the reader only.
+   *
+   * @return The value, valid until the next update.
+   */
+  const T & read() const { return buffers_[front_].value; }
+
+  /**
+   * @brief Get the value taken by the last update to modify or move it, called by the reader only.
+   */
+  T & read() { return buffers_[front_].value; }
+
+private:
+  static constexpr uint8_t index_mask = 0x3;
+  static constexpr uint8_t dirty = 0x4;
+  // the size of the padding separating the data written by different threads
+  static constexpr size_t cache_line_size = 64;
+
+  struct alignas(cache_line_size) Buffer
+  {
+    T value{};
+  };
+
+  Buffer buffers_[3];
+  alignas(cache_line_size) std::atomic<uint8_t> middle_{1};
+  alignas(cache_line_size) uint8_t back_ = 0;
+  alignas(cache_line_size) uint8_t front_ = 2;
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__TRIPLE_BUFFER_HPP_
@@ -0,0 +1,305 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_SYSTEM__TWO_QUEUE_CACHE_HPP_
+#define AUTOWARE_UTILS_SYSTEM__TWO_QUEUE_CACHE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace autoware_utils_system
+{
+
+/**
+ * @brief A cache with the 2Q eviction, which resists the scans of keys used once.
+ *
+ * A new key enters a FIFO queue of a quarter of the capacity. It is promoted to the LRU queue of
+ * the frequently used keys only if it is inserted again after being evicted from the FIFO queue,
+ * while it is remembered in a ghost queue of the last evicted keys, without value, of half the
+ * capacity. A scan of new keys thus only cycles the FIFO queue and keeps the working set. The
+ * interface is the same as LRUCache without the weigher and the time to live, so the policy can be
+ * selected by the template parameter of the code using the cache.
+ *
+ * @tparam Key The type of keys.
+ * @tparam Value The type of values.
+ * @tparam Map The type of underlying map, defaulted to std::unordered_map.
+ */
+template <typename Key, typename Value, template <typename...> class Map = std::unordered_map>
+class TwoQueueCache
+{
+public:
+  /// @brief The counters of the cache.
+  struct Stats
+  {
+    size_t hits = 0;       ///< Number of lookups which found the key.
+    size_t misses = 0;     ///< Number of lookups which did not find the key.
+    size_t evictions = 0;  ///< Number of elements removed to fit the capacity.
+  };
+
+private:
+  using List = std::list<std::pair<Key, Value>>;
+
+  struct Resident
+  {
+    typename List::iterator entry;
+    bool frequent;  ///< Whether the entry is in the LRU queue rather than the FIFO queue.
+  };
+
+  size_t capacity_;
+  size_t fifo_capacity_;
+  size_t ghost_capacity_;
+  List fifo_;      ///< Keys inserted once, the newest at the front.
+  List frequent_;  ///< Keys inserted again after their eviction, the most recently used first.
+  std::list<Key> ghosts_;  ///< Keys evicted from the FIFO queue, the newest at the front.
+  Map<Key, Resident> residents_;
+  Map<Key, typename std::list<Key>::iterator> ghost_map_;
+  Stats stats_;
+
+  void evict()
+  {
+    if (fifo_.size() > fifo_capacity_ || frequent_.empty()) {
+      Key & key = fifo_.back().first;
+      residents_.erase(key);
+      ghosts_.push_front(std::move(key));
+      ghost_map_[ghosts_.front()] = ghosts_.begin();
+      if (ghosts_.size() > ghost_capacity_) {
+        ghost_map_.erase(ghosts_.back());
+        ghosts_.pop_back();
+      }
+      fifo_.pop_back();
+    } else {
+      residents_.erase(frequent_.back().first);
+      frequent_.pop_back();
+    }
+    ++stats_.evictions;
+  }
+
+  /// @brief insert the element, return nullptr if it does not fit the capacity
+  template <typename... Args>
+  Value * emplace_impl(const Key & key, Args &&... args)
+  {
+    auto it = residents_.find(key);
+    if (it != residents_.end()) {
+      Resident & resident = it->second;
+      resident.entry->second = Value(std::forward<Args>(args)...);
+      if (resident.frequent) {
+        frequent_.splice(frequent_.begin(), frequent_, resident.entry);
+      }
+      return &resident.entry->second;
+    }
+    if (capacity_ == 0) {
+      return nullptr;
+    }
+
+    List * queue = &fifo_;
+    auto ghost = ghost_map_.find(key);
+    if (ghost != ghost_map_.end()) {
+      ghosts_.erase(ghost->second);
+      ghost_map_.erase(ghost);
+      queue = &frequent_;
+    }
+    if (residents_.size() == capacity_) {
+      evict();
+    }
+    queue->emplace_front(
+      std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+    residents_[key] = Resident{queue->begin(), queue == &frequent_};
+    return &queue->front().second;
+  }
+
+public:
+  /**
+   * @brief Construct a new TwoQueueCache object.
+   *
+   * @param size The capacity of the cache.
+   */
+  explicit TwoQueueCache(size_t size)
+  : capacity_(size), fifo_capacity_(std::max<size_t>(size / 4, 1)),
+    ghost_capacity_(std::max<size_t>(size / 2, 1))
+  {
+  }
+
+  /**
+   * @brief Get the capacity of the cache.
+   *
+   * @return The capacity of the cache.
+   */
+  [[nodiscard]] size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Insert a key-value pair into the cache.
+   *
+   * If the key already exists, its value is updated.
+   * If the cache exceeds its capacity, an element is evicted by the 2Q policy.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, const Value & value) { emplace_impl(key, value); }
+
+  /**
+   * @brief Insert a key-value pair into the cache, moving the value.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, Value && value) { emplace_impl(key, std::move(value)); }
+
+  /**
+   * @brief Construct a value in the cache, replacing the value of the key if any.
+   *
+   * @param key The key to insert.
+   * @param args The arguments of the constructor of the value.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the capacity is 0, as the value would be evicted immediately.
+   */
+  template <typename... Args>
+  Value & emplace(const Key & key, Args &&... args)
+  {
+    Value * value = emplace_impl(key, std::forward<Args>(args)...);
+    if (!value) {
+      throw std::length_error("the capacity of the cache is 0.");
+    }
+    return *value;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache, computing and inserting it if the key does not exist.
+   *
+   * @param key The key to retrieve.
+   * @param factory The function returning the value of the key, only called on a miss.
+   * @return A reference to the value, valid until the element is evicted or replaced.
+   * @throw std::length_error if the capacity is 0, as the value would be evicted immediately.
+   */
+  template <typename Factory>
+  Value & get_or_compute(const Key & key, Factory && factory)
+  {
+    if (Value * value = get_ptr(key)) {
+      return *value;
+    }
+    return emplace(key, std::forward<Factory>(factory)());
+  }
+
+  /**
+   * @brief Retrieve a value from the cache.
+   *
+   * @param key The key to retrieve.
+   * @return The value associated with the key, or std::nullopt if the key does not exist.
+   */
+  std::optional<Value> get(const Key & key)
+  {
+    if (Value * value = get_ptr(key)) {
+      return *value;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it.
+   *
+   * If the key is in the LRU queue, it is moved to its front. The FIFO queue is not reordered.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, valid until the element is evicted or replaced, or nullptr if
+   * the key does not exist.
+   */
+  Value * get_ptr(const Key & key)
+  {
+    auto it = residents_.find(key);
+    if (it == residents_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    if (it->second.frequent) {
+      frequent_.splice(frequent_.begin(), frequent_, it->second.entry);
+    }
+    return &it->second.entry->second;
+  }
+
+  /**
+   * @brief Retrieve a value from the cache without copying it or changing the order of use.
+   *
+   * @param key The key to retrieve.
+   * @return A pointer to the value, or nullptr if the key does not exist.
+   */
+  const Value * peek(const Key & key) const
+  {
+    auto it = residents_.find(key);
+    return it == residents_.end() ? nullptr : &it->second.entry->second;
+  }
+
+  /**
+   * @brief Clear the cache.
+   *
+   * This removes all elements and remembered keys from the cache. The statistics are kept.
+   */
+  void clear()
+  {
+    fifo_.clear();
+    frequent_.clear();
+    ghosts_.clear();
+    residents_.clear();
+    ghost_map_.clear();
+  }
+
+  /**
+   * @brief Get the current size of the cache.
+   *
+   * @return The number of elements in the cache.
+   */
+  [[nodiscard]] size_t size() const { return residents_.size(); }
+
+  /**
+   * @brief Check if the cache is empty.
+   *
+   * @return True if the cache is empty, false otherwise.
+   */
+  [[nodiscard]] bool empty() const { return residents_.empty(); }
+
+  /**
+   * @brief Check if a key exists in the cache.
+   *
+   * @param key The key to check.
+   * @return True if the key exists, false otherwise.
+   */
+  [[nodiscard]] bool contains(const Key & key) const
+  {
+    return residents_.find(key) != residents_.end();
+  }
+
+  /**
+   * @brief Get the counters of the lookups and evictions since the construction or the last reset.
+   *
+   * @return The counters of the cache.
+   */
+  [[nodiscard]] const Stats & stats() const { return stats_; }
+
+  /**
+   * @brief Reset the counters of the cache.
+   */
+  void reset_stats() { stats_ = Stats{}; }
+};
+
+}  // namespace autoware_utils_system
+
+#endif  // AUTOWARE_UTILS_SYSTEM__TWO_QUEUE_CACHE_HPP_
@@ -16,11 +16,16 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <cxxabi.h>
 #include <execinfo.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace autoware_utils_system
@@ -50,4 +55,111 @@ void print_backtrace()
   free(symbol_list);
 }
 
+namespace
+{
+/// @brief demangle the function of a line `binary(function+offset) [address]` of backtrace_symbols
+std::string demangle_impl(const std::string & symbol)
+{
+  const auto begin = symbol.find('(');
+  const auto end = symbol.find('+', begin);
+  if (begin == std::string::npos || end == std::string::npos || end == begin + 1) {
+    return symbol;
+  }
+  const std::string mangled = symbol.substr(begin + 1, end - begin - 1);
+  int status = 0;
+  std::unique_ptr<char, decltype(&std::free)> demangled(
+    abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status), &std::free);
+  if (status != 0) {
+    return symbol;
+  }
+  return symbol.substr(0, begin + 1) + demangled.get() + symbol.substr(end);
+}
+}  // namespace
+
+std::vector<std::string> symbolize(const RawBacktrace & backtrace)
+{
+  std::vector<std::string> lines;
+  if (backtrace.size == 0) {
+    return lines;
+  }
+  const int size = static_cast<int>(backtrace.size);
+  std::unique_ptr<char *, decltype(&std::free)> symbol_list(
+    backtrace_symbols(backtrace.frames.data(), size), &std::free);
+  if (!symbol_list) {
+    return lines;
+  }
+  lines.reserve(backtrace.size);
+  for (int i = 0; i < size; ++i) {
+    lines.push_back(demangle_impl(symbol_list.get()[i]));
+  }
+  return lines;
+}
+
+BacktraceRing::BacktraceRing(size_t capacity)
+: capacity_(capacity), slots_(std::make_unique<Slot[]>(capacity))
+{
+  if (capacity == 0) {
+    throw std::invalid_argument("the capacity of the ring is 0.");
+  }
+  // the first call of backtrace() loads libgcc_s, which allocates
+  void * frames[1];
+  backtrace(frames, 1);
+}
+
+void BacktraceRing::record(size_t skip) noexcept
+{
+  void * frames[RawBacktrace::max_frames];
+  const int size = backtrace(frames, RawBacktrace::max_frames);
+  // skip the frame of this function too
+  const int first = static_cast<int>(std::min<size_t>(skip + 1, size));
+
+  const uint64_t index = next_.fetch_add(1, std::memory_order_relaxed);
+  Slot & slot = slots_[index % capacity_];
+  slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (int i = first; i < size; ++i) {
+    slot.frames[i - first].store(frames[i], std::memory_order_relaxed);
+  }
+  slot.size.store(size - first, std::memory_order_relaxed);
+  slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+std::vector<RawBacktrace> BacktraceRing::drain()
+{
+  std::lock_guard<std::mutex> lock(drain_mutex_);
+  const uint64_t end = next_.load(std::memory_order_acquire);
+  const uint64_t begin = std::max(read_, end > capacity_ ? end - capacity_ : 0);
+  dropped_ += begin - read_;
+  read_ = begin;
+
+  std::vector<RawBacktrace> backtraces;
+  backtraces.reserve(end - begin);
+  for (; read_ < end; ++read_) {
+    const Slot & slot = slots_[read_ % capacity_];
+    const uint64_t written = 2 * read_ + 2;
+    const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before < written) {
+      break;  // still being recorded
+    }
+    RawBacktrace backtrace;
+    backtrace.size = slot.size.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < backtrace.size; ++i) {
+      backtrace.frames[i] = slot.frames[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (before != written || slot.sequence.load(std::memory_order_relaxed) != written) {
+      ++dropped_;  // overwritten by a later record
+      continue;
+    }
+    backtraces.push_back(backtrace);
+  }
+  return backtraces;
+}
+
+uint64_t BacktraceRing::dropped() const
+{
+  std::lock_guard<std::mutex> lock(drain_mutex_);
+  return dropped_;
+}
+
 }  // namespace autoware_utils_system
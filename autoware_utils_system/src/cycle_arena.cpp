@@ -0,0 +1,83 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/cycle_arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace autoware_utils_system
+{
+
+namespace
+{
+constexpr size_t buffer_alignment = alignof(std::max_align_t);
+}  // namespace
+
+CycleArena::CycleArena(size_t initial_size, std::pmr::memory_resource * upstream)
+: upstream_(upstream), overflow_(upstream)
+{
+  if (initial_size != 0) {
+    buffer_ = static_cast<std::byte *>(upstream_->allocate(initial_size, buffer_alignment));
+    capacity_ = initial_size;
+  }
+}
+
+CycleArena::~CycleArena()
+{
+  if (buffer_) {
+    upstream_->deallocate(buffer_, capacity_, buffer_alignment);
+  }
+}
+
+void CycleArena::reset()
+{
+  if (overflow_bytes_ != 0) {
+    // half again of the peak, so that a slowly growing usage does not grow the buffer every cycle
+    const size_t capacity = used_ + used_ / 2;
+    overflow_.release();
+    if (buffer_) {
+      upstream_->deallocate(buffer_, capacity_, buffer_alignment);
+      buffer_ = nullptr;
+      capacity_ = 0;
+    }
+    buffer_ = static_cast<std::byte *>(upstream_->allocate(capacity, buffer_alignment));
+    capacity_ = capacity;
+  }
+  offset_ = 0;
+  used_ = 0;
+  overflow_bytes_ = 0;
+}
+
+void * CycleArena::do_allocate(size_t bytes, size_t alignment)
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(buffer_) + offset_;
+  const size_t padding = (alignment - address % alignment) % alignment;
+  if (buffer_ && padding + bytes <= capacity_ - offset_) {
+    void * p = buffer_ + offset_ + padding;
+    offset_ += padding + bytes;
+    used_ += padding + bytes;
+    return p;
+  }
+  used_ += bytes + alignment;
+  overflow_bytes_ += bytes;
+  return overflow_.allocate(bytes, alignment);
+}
+
+bool CycleArena::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
+
+}  // namespace autoware_utils_system
@@ -0,0 +1,185 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/sampling_profiler.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <signal.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware_utils_system
+{
+
+namespace
+{
+std::atomic<BacktraceRing *> g_ring{nullptr};
+// handlers which may be using the ring, counted before the ring is read so that stop() can wait
+// for them to return before the ring is destroyed
+std::atomic<int> g_running_handlers{0};
+struct sigaction g_previous_action;
+
+void handle_sigprof_impl(int)
+{
+  const int saved_errno = errno;
+  g_running_handlers.fetch_add(1);
+  if (BacktraceRing * ring = g_ring.load()) {
+    // skip this handler and the signal trampoline
+    ring->record(2);
+  }
+  g_running_handlers.fetch_sub(1);
+  errno = saved_errno;
+}
+
+/// @brief the function of a line `binary(function+offset) [address]`, or `[binary]` if unnamed
+std::string frame_name_impl(const std::string & line)
+{
+  const auto begin = line.find('(');
+  const auto end = line.rfind("+0x");
+  if (begin == std::string::npos || end == std::string::npos || end <= begin + 1) {
+    const auto binary = line.substr(0, std::min(begin, line.find(' ')));
+    return "[" + binary.substr(binary.rfind('/') + 1) + "]";
+  }
+  return line.substr(begin + 1, end - begin - 1);
+}
+}  // namespace
+
+SamplingProfiler::SamplingProfiler(double frequency, size_t capacity, const std::string & path)
+: ring_(capacity), path_(path)
+{
+  if (!(frequency > 0.0)) {
+    throw std::invalid_argument("the frequency of the profiler is not positive.");
+  }
+  BacktraceRing * expected = nullptr;
+  if (!g_ring.compare_exchange_strong(expected, &ring_)) {
+    throw std::logic_error("another sampling profiler is running.");
+  }
+
+  struct sigaction action
+  {
+  };
+  action.sa_handler = handle_sigprof_impl;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, &g_previous_action) != 0) {
+    const int error = errno;
+    g_ring.store(nullptr);
+    throw std::system_error(error, std::generic_category(), "sigaction");
+  }
+
+  const auto period = static_cast<long>(std::max(1.0, std::round(1e6 / frequency)));  // NOLINT
+  itimerval timer{};
+  timer.it_interval.tv_sec = period / 1000000;
+  timer.it_interval.tv_usec = period % 1000000;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+    const int error = errno;
+    sigaction(SIGPROF, &g_previous_action, nullptr);
+    g_ring.store(nullptr);
+    throw std::system_error(error, std::generic_category(), "setitimer");
+  }
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+  stop();
+  if (path_.empty()) {
+    return;
+  }
+  try {
+    write_folded(path_);
+  } catch (const std::exception & e) {
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("autoware_utils"), "failed to write the profile: " << e.what());
+  }
+}
+
+void SamplingProfiler::stop() noexcept
+{
+  const itimerval timer{};
+  setitimer(ITIMER_PROF, &timer, nullptr);
+  g_ring.store(nullptr);
+  while (g_running_handlers.load() != 0) {
+    std::this_thread::yield();
+  }
+  // a signal of the timer may still be pending, which terminates the process by default
+  struct sigaction action = g_previous_action;
+  if (action.sa_handler == SIG_DFL) {
+    action.sa_handler = SIG_IGN;
+  }
+  sigaction(SIGPROF, &action, nullptr);
+}
+
+void SamplingProfiler::collect()
+{
+  for (const auto & backtrace : ring_.drain()) {
+    const auto begin = backtrace.frames.begin();
+    ++stacks_[std::vector<void *>(begin, begin + backtrace.size)];
+    ++samples_;
+  }
+}
+
+void SamplingProfiler::write_folded(std::ostream & os)
+{
+  collect();
+
+  // the stacks differing only by the offsets in the functions are merged
+  std::unordered_map<void *, std::string> names;
+  std::map<std::string, size_t> folded;
+  for (const auto & [frames, count] : stacks_) {
+    RawBacktrace backtrace;
+    backtrace.size = frames.size();
+    std::copy(frames.begin(), frames.end(), backtrace.frames.begin());
+    if (!std::all_of(frames.begin(), frames.end(), [&](void * f) { return names.count(f); })) {
+      const auto lines = symbolize(backtrace);
+      for (size_t i = 0; i < lines.size(); ++i) {
+        names.emplace(frames[i], frame_name_impl(lines[i]));
+      }
+    }
+    std::string stack;
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+      if (!stack.empty()) {
+        stack += ';';
+      }
+      stack += names[*it];
+    }
+    folded[stack] += count;
+  }
+  for (const auto & [stack, count] : folded) {
+    os << stack << ' ' << count << '\n';
+  }
+}
+
+void SamplingProfiler::write_folded(const std::string & path)
+{
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("failed to open " + path + ".");
+  }
+  write_folded(file);
+}
+
+}  // namespace autoware_utils_system
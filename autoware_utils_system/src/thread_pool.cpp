@@ -0,0 +1,229 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/thread_pool.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace autoware_utils_system
+{
+
+namespace
+{
+// the pool whose loop the current thread is running, to run the nested loops serially
+thread_local const ThreadPool * g_running_pool = nullptr;
+}  // namespace
+
+ThreadPool::ThreadPool() : ThreadPool(Options())
+{
+}
+
+ThreadPool::ThreadPool(const Options & options)
+{
+  for (const int cpu : options.cpus) {
+    if (cpu < 0 || CPU_SETSIZE <= cpu) {
+      throw std::invalid_argument("the cpu " + std::to_string(cpu) + " is out of range.");
+    }
+  }
+
+  size_t num_threads = options.num_threads;
+  if (num_threads == 0) {
+    num_threads = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+  }
+  parts_ = std::make_unique<Part[]>(num_threads + 1);
+  workers_.reserve(num_threads);
+  try {
+    for (size_t i = 0; i < num_threads; ++i) {
+      workers_.emplace_back([this, i] { loop(i + 1); });
+      const auto handle = workers_.back().native_handle();
+      if (!options.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(options.cpus[i % options.cpus.size()], &set);
+        if (const int error = pthread_setaffinity_np(handle, sizeof(set), &set)) {
+          throw std::system_error(error, std::generic_category(), "pthread_setaffinity_np");
+        }
+      }
+      if (options.priority != 0) {
+        sched_param param{};
+        param.sched_priority = options.priority;
+        if (const int error = pthread_setschedparam(handle, SCHED_FIFO, &param)) {
+          throw std::system_error(error, std::generic_category(), "pthread_setschedparam");
+        }
+      }
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+ThreadPool & ThreadPool::shared()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+void ThreadPool::stop() noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  started_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+bool ThreadPool::try_run(size_t begin, size_t end, size_t grain_size, Call call, void * context)
+{
+  grain_size = std::max<size_t>(grain_size, 1);
+  if (end - begin <= grain_size || workers_.empty() || g_running_pool == this) {
+    return false;
+  }
+  std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+  if (!run_lock) {
+    return false;
+  }
+
+  // split the range evenly, the threads without a part steal from the others
+  const size_t num_chunks = (end - begin + grain_size - 1) / grain_size;
+  const size_t num_parts = std::min(num_chunks, workers_.size() + 1);
+  for (size_t i = 0; i <= workers_.size(); ++i) {
+    std::lock_guard<std::mutex> lock(parts_[i].mutex);
+    const size_t first = std::min(i, num_parts) * num_chunks / num_parts;
+    const size_t last = std::min(i + 1, num_parts) * num_chunks / num_parts;
+    parts_[i].begin = std::min(begin + first * grain_size, end);
+    parts_[i].end = std::min(begin + last * grain_size, end);
+  }
+  call_ = call;
+  context_ = context;
+  grain_size_ = grain_size;
+  failed_.store(false, std::memory_order_relaxed);
+  error_ = nullptr;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    running_ = workers_.size();
+  }
+  started_.notify_all();
+
+  g_running_pool = this;
+  work(0);
+  g_running_pool = nullptr;
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return running_ == 0; });
+    error = std::exchange(error_, nullptr);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return true;
+}
+
+void ThreadPool::work(size_t part)
+{
+  while (true) {
+    size_t chunk_begin = 0;
+    size_t chunk_end = 0;
+    {
+      std::lock_guard<std::mutex> lock(parts_[part].mutex);
+      chunk_begin = parts_[part].begin;
+      chunk_end = std::min(chunk_begin + grain_size_, parts_[part].end);
+      parts_[part].begin = chunk_end;
+    }
+    if (chunk_end <= chunk_begin) {
+      if (steal(part)) {
+        continue;
+      }
+      return;
+    }
+    if (failed_.load(std::memory_order_relaxed)) {
+      continue;
+    }
+    try {
+      call_(context_, chunk_begin, chunk_end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!failed_.exchange(true)) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+bool ThreadPool::steal(size_t part)
+{
+  const size_t num_parts = workers_.size() + 1;
+  for (size_t i = 1; i < num_parts; ++i) {
+    auto & victim = parts_[(part + i) % num_parts];
+    size_t stolen_begin = 0;
+    size_t stolen_end = 0;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (victim.end <= victim.begin) {
+        continue;
+      }
+      // the back half, or the whole part if it is a single chunk
+      const size_t size = victim.end - victim.begin;
+      stolen_begin = size <= grain_size_ ? victim.begin : victim.end - size / 2;
+      stolen_end = victim.end;
+      victim.end = stolen_begin;
+    }
+    std::lock_guard<std::mutex> lock(parts_[part].mutex);
+    parts_[part].begin = stolen_begin;
+    parts_[part].end = stolen_end;
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::loop(size_t part)
+{
+  g_running_pool = this;
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    started_.wait(lock, [this, generation] { return stopped_ || generation_ != generation; });
+    if (stopped_) {
+      return;
+    }
+    generation = generation_;
+    lock.unlock();
+    work(part);
+    lock.lock();
+    if (--running_ == 0) {
+      finished_.notify_one();
+    }
+  }
+}
+
+}  // namespace autoware_utils_system
@@ -16,7 +16,60 @@
 
 #include <gtest/gtest.h>
 
+#include <csignal>
+#include <stdexcept>
+
 TEST(TestBacktrace, Execution)
 {
   autoware_utils_system::print_backtrace();
 }
+
+namespace
+{
+autoware_utils_system::BacktraceRing * g_ring = nullptr;
+
+void record_on_signal(int)
+{
+  g_ring->record();
+}
+
+[[gnu::noinline]] void record_from_function(autoware_utils_system::BacktraceRing & ring)
+{
+  ring.record();
+}
+}  // namespace
+
+TEST(TestBacktraceRing, RecordAndSymbolize)
+{
+  autoware_utils_system::BacktraceRing ring(4);
+  record_from_function(ring);
+  const auto backtraces = ring.drain();
+  ASSERT_EQ(backtraces.size(), 1u);
+  ASSERT_GT(backtraces[0].size, 0u);
+
+  const auto lines = autoware_utils_system::symbolize(backtraces[0]);
+  EXPECT_EQ(lines.size(), backtraces[0].size);
+  EXPECT_TRUE(ring.drain().empty());
+}
+
+TEST(TestBacktraceRing, Overwrite)
+{
+  autoware_utils_system::BacktraceRing ring(2);
+  for (int i = 0; i < 5; ++i) {
+    ring.record();
+  }
+  EXPECT_EQ(ring.drain().size(), 2u);
+  EXPECT_EQ(ring.dropped(), 3u);
+  EXPECT_THROW(autoware_utils_system::BacktraceRing(0), std::invalid_argument);
+}
+
+TEST(TestBacktraceRing, Signal)
+{
+  autoware_utils_system::BacktraceRing ring(4);
+  g_ring = &ring;
+  const auto previous = std::signal(SIGUSR1, record_on_signal);
+  std::raise(SIGUSR1);
+  std::signal(SIGUSR1, previous);
+  g_ring = nullptr;
+  EXPECT_EQ(ring.drain().size(), 1u);
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/concurrent_lru_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(TestConcurrentLruCache, Basic)
+{
+  autoware_utils_system::ConcurrentLRUCache<int, std::string> cache(4, 1);
+  EXPECT_TRUE(cache.empty());
+  for (int i = 0; i < 4; ++i) {
+    cache.put(i, std::to_string(i));
+  }
+  EXPECT_EQ(cache.size(), 4u);
+  EXPECT_EQ(cache.get(2), "2");
+  EXPECT_EQ(cache.get(5), std::nullopt);
+
+  // the referenced entry gets a second chance and the oldest one is evicted
+  cache.put(4, "4");
+  EXPECT_EQ(cache.size(), 4u);
+  EXPECT_TRUE(cache.contains(2));
+  EXPECT_FALSE(cache.contains(0));
+  EXPECT_TRUE(cache.contains(4));
+
+  cache.put(2, "two");
+  EXPECT_EQ(cache.get(2), "two");
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_FALSE(cache.contains(2));
+}
+
+TEST(TestConcurrentLruCache, Capacity)
+{
+  autoware_utils_system::ConcurrentLRUCache<int, int> empty(0);
+  empty.put(1, 1);
+  EXPECT_TRUE(empty.empty());
+
+  autoware_utils_system::ConcurrentLRUCache<int, int> cache(100, 8);
+  EXPECT_EQ(cache.capacity(), 100u);
+  for (int i = 0; i < 1000; ++i) {
+    cache.put(i, i);
+    EXPECT_LE(cache.size(), 100u);
+  }
+  // the last inserted key of each shard is still present
+  EXPECT_TRUE(cache.contains(999));
+}
+
+TEST(TestConcurrentLruCache, Threads)
+{
+  autoware_utils_system::ConcurrentLRUCache<int, int> cache(64, 8);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (int i = 0; i < 20000; ++i) {
+        const int key = (i * 7 + t) % 128;
+        if (i % 4 == 0) {
+          cache.put(key, key * 10);
+        } else if (const auto value = cache.get(key)) {
+          EXPECT_EQ(*value, key * 10);
+        }
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(cache.size(), 64u);
+}
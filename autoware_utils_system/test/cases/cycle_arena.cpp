@@ -0,0 +1,107 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/cycle_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+  size_t allocations = 0;
+  size_t bytes = 0;
+
+private:
+  void * do_allocate(size_t size, size_t alignment) override
+  {
+    ++allocations;
+    bytes += size;
+    return std::pmr::new_delete_resource()->allocate(size, alignment);
+  }
+  void do_deallocate(void * p, size_t size, size_t alignment) override
+  {
+    bytes -= size;
+    std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+void fill_cycle(autoware_utils_system::CycleArena & arena, const size_t size)
+{
+  std::pmr::vector<double> values(&arena);
+  for (size_t i = 0; i < size; ++i) {
+    values.push_back(static_cast<double>(i));
+  }
+  std::pmr::vector<std::pmr::vector<int>> nested(&arena);
+  nested.resize(10);
+  for (auto & inner : nested) {
+    inner.assign(size / 10, 1);
+  }
+}
+}  // namespace
+
+TEST(TestCycleArena, Reset)
+{
+  CountingResource upstream;
+  {
+    autoware_utils_system::CycleArena arena(1024, &upstream);
+    EXPECT_EQ(upstream.allocations, 1u);
+    EXPECT_EQ(arena.capacity(), 1024u);
+
+    // the first cycle overflows, the next ones of the same size use the grown buffer only
+    fill_cycle(arena, 1000);
+    EXPECT_GT(arena.overflow(), 0u);
+    EXPECT_GT(arena.used(), 1024u);
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_GT(arena.capacity(), 1024u);
+
+    const size_t allocations = upstream.allocations;
+    for (int cycle = 0; cycle < 5; ++cycle) {
+      fill_cycle(arena, 1000);
+      EXPECT_EQ(arena.overflow(), 0u);
+      arena.reset();
+    }
+    EXPECT_EQ(upstream.allocations, allocations);
+  }
+  EXPECT_EQ(upstream.bytes, 0u);
+}
+
+TEST(TestCycleArena, Alignment)
+{
+  autoware_utils_system::CycleArena arena(256);
+  for (const size_t alignment : {1u, 2u, 8u, 16u, 64u, 1u, 32u}) {
+    const auto p = reinterpret_cast<std::uintptr_t>(arena.allocate(3, alignment));
+    EXPECT_EQ(p % alignment, 0u);
+  }
+  EXPECT_TRUE(arena.is_equal(arena));
+  EXPECT_FALSE(arena.is_equal(*std::pmr::new_delete_resource()));
+
+  // an arena without an initial buffer takes all from the upstream resource until reset
+  autoware_utils_system::CycleArena empty(0);
+  EXPECT_NE(empty.allocate(100, 8), nullptr);
+  EXPECT_EQ(empty.overflow(), 100u);
+  empty.reset();
+  EXPECT_GE(empty.capacity(), 100u);
+}
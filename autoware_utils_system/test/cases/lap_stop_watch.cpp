@@ -0,0 +1,89 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/lap_stop_watch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+struct FakeClock
+{
+  using duration = std::chrono::microseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() { return current; }
+  static inline time_point current{};
+};
+}  // namespace
+
+TEST(TestLapStopWatch, Summary)
+{
+  using std::chrono::milliseconds;
+  autoware_utils_system::LapStopWatch<milliseconds, std::chrono::microseconds, FakeClock> sw;
+  EXPECT_THROW(sw.lap("foo"), std::out_of_range);
+
+  sw.tic("foo");
+  sw.tic("bar");
+  for (int i = 1; i <= 3; ++i) {
+    FakeClock::current += milliseconds(i);
+    EXPECT_DOUBLE_EQ(sw.lap("foo"), i);
+  }
+  EXPECT_DOUBLE_EQ(sw.lap("bar"), 6.0);
+
+  const auto summaries = sw.summary();
+  ASSERT_EQ(summaries.size(), 2u);
+  EXPECT_EQ(summaries[0].label, "bar");
+  EXPECT_EQ(summaries[1].label, "foo");
+  EXPECT_EQ(summaries[1].count, 3u);
+  EXPECT_DOUBLE_EQ(summaries[1].mean, 2.0);
+  EXPECT_DOUBLE_EQ(summaries[1].min, 1.0);
+  EXPECT_DOUBLE_EQ(summaries[1].max, 3.0);
+  EXPECT_DOUBLE_EQ(summaries[1].p50, 2.0);
+
+  std::ostringstream os;
+  os << summaries[0];
+  EXPECT_EQ(os.str().rfind("bar: count 1", 0), 0u);
+
+  sw.reset();
+  EXPECT_TRUE(sw.summary().empty());
+}
+
+TEST(TestLapStopWatch, Report)
+{
+  using std::chrono::milliseconds;
+  autoware_utils_system::LapStopWatch<milliseconds, std::chrono::microseconds, FakeClock> sw;
+  std::vector<std::vector<autoware_utils_system::LapSummary>> reports;
+  sw.set_report(milliseconds(10), [&reports](const auto & summaries) {
+    reports.push_back(summaries);
+  });
+
+  sw.tic("loop");
+  for (int i = 0; i < 25; ++i) {
+    FakeClock::current += milliseconds(1);
+    sw.lap("loop");
+  }
+  ASSERT_EQ(reports.size(), 2u);
+  EXPECT_EQ(reports[0][0].count, 10u);
+  EXPECT_EQ(reports[1][0].count, 10u);
+  EXPECT_EQ(sw.summary()[0].count, 5u);
+}
@@ -16,7 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <optional>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct ParamLruCache
@@ -42,6 +48,20 @@ TEST_P(TestLruCache, Main)
   }
 }
 
+TEST_P(TestLruCache, Flat)
+{
+  const auto p = GetParam();
+  autoware_utils_system::FlatLRUCache<int, std::string> cache(p.size);
+  for (const auto & v : p.input) {
+    cache.put(v, std::to_string(v));
+  }
+  EXPECT_EQ(cache.size(), p.cache.size());
+  for (const auto & v : p.cache) {
+    EXPECT_TRUE(cache.contains(v));
+    EXPECT_EQ(cache.get(v), std::to_string(v));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
   TestLruCache, TestLruCache,
   testing::Values(
@@ -51,3 +71,173 @@ INSTANTIATE_TEST_SUITE_P(
     ParamLruCache{4, {1, 2, 3, 4, 5, 6}, {3, 4, 5, 6}},
     ParamLruCache{4, {1, 2, 3, 1, 4, 5}, {1, 3, 4, 5}},
     ParamLruCache{4, {1, 2, 3, 2, 4, 5}, {2, 3, 4, 5}}));
+
+// all the keys collide, so that the removals shift the probe sequences
+struct CollidingHash
+{
+  size_t operator()(int key) const { return static_cast<size_t>(key % 3); }
+};
+
+template <class Hash>
+void expect_same_as_lru_cache(const size_t capacity, const int key_count)
+{
+  autoware_utils_system::LRUCache<int, int> expected(capacity);
+  autoware_utils_system::FlatLRUCache<int, int, Hash> cache(capacity);
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<int> key(0, key_count - 1);
+  for (int i = 0; i < 20000; ++i) {
+    const int k = key(generator);
+    if (i % 3 == 0) {
+      EXPECT_EQ(cache.get(k), expected.get(k));
+    } else {
+      cache.put(k, i);
+      expected.put(k, i);
+    }
+    ASSERT_EQ(cache.size(), expected.size());
+    if (i == 10000) {
+      cache.clear();
+      expected.clear();
+      EXPECT_TRUE(cache.empty());
+    }
+  }
+  for (int k = 0; k < key_count; ++k) {
+    EXPECT_EQ(cache.contains(k), expected.contains(k));
+  }
+}
+
+TEST(TestFlatLruCache, SameAsLruCache)
+{
+  expect_same_as_lru_cache<std::hash<int>>(0, 10);
+  expect_same_as_lru_cache<std::hash<int>>(1, 10);
+  expect_same_as_lru_cache<std::hash<int>>(16, 40);
+  expect_same_as_lru_cache<std::hash<int>>(100, 150);
+  expect_same_as_lru_cache<CollidingHash>(7, 20);
+  expect_same_as_lru_cache<CollidingHash>(32, 64);
+}
+
+template <class Cache>
+void expect_reference_access()
+{
+  Cache cache(2);
+  std::string value(100, 'a');
+  cache.put(1, std::move(value));
+  cache.put(2, "b");
+  EXPECT_EQ(*cache.peek(1), std::string(100, 'a'));
+  EXPECT_EQ(cache.peek(3), nullptr);
+
+  // peek does not change the order of use, so 1 is evicted
+  cache.put(3, "c");
+  EXPECT_FALSE(cache.contains(1));
+
+  // get_ptr does, so 3 is evicted
+  std::string * ptr = cache.get_ptr(2);
+  ASSERT_NE(ptr, nullptr);
+  *ptr = "bb";
+  cache.put(4, "d");
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.get(2), "bb");
+
+  std::string & emplaced = cache.emplace(5, 3, 'e');
+  EXPECT_EQ(emplaced, "eee");
+
+  int calls = 0;
+  const auto factory = [&calls] {
+    ++calls;
+    return std::string("f");
+  };
+  EXPECT_EQ(cache.get_or_compute(6, factory), "f");
+  EXPECT_EQ(cache.get_or_compute(6, factory), "f");
+  EXPECT_EQ(cache.get_or_compute(5, factory), "eee");
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(cache.size(), 2u);
+
+  Cache empty(0);
+  EXPECT_THROW(empty.emplace(1, "a"), std::length_error);
+  EXPECT_THROW(empty.get_or_compute(1, factory), std::length_error);
+}
+
+TEST(TestLruCache, ReferenceAccess)
+{
+  expect_reference_access<autoware_utils_system::LRUCache<int, std::string>>();
+  expect_reference_access<autoware_utils_system::FlatLRUCache<int, std::string>>();
+}
+
+TEST(TestLruCache, Weighted)
+{
+  using Cache = autoware_utils_system::LRUCache<int, std::string>;
+  Cache cache(10, [](const int, const std::string & value) { return value.size(); });
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  EXPECT_EQ(cache.weight(), 8u);
+
+  // 1 is evicted to fit the 4 bytes of 3
+  cache.put(3, "cccc");
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_EQ(cache.weight(), 8u);
+
+  // replacing a value updates its weight
+  cache.put(2, "b");
+  EXPECT_EQ(cache.weight(), 5u);
+
+  // a value larger than the budget is not kept and does not flush the others
+  cache.put(4, std::string(11, 'd'));
+  EXPECT_FALSE(cache.contains(4));
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_THROW(cache.emplace(4, 11, 'd'), std::length_error);
+
+  EXPECT_EQ(cache.stats().evictions, 3u);
+  EXPECT_THROW(Cache(10, Cache::Weigher{}), std::invalid_argument);
+}
+
+struct FakeClock
+{
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() { return current; }
+  static inline time_point current{};
+};
+
+TEST(TestLruCache, TimeToLive)
+{
+  using namespace std::chrono_literals;
+  autoware_utils_system::LRUCache<int, int, std::unordered_map, FakeClock> cache(4);
+  cache.put(1, 1);
+  cache.set_time_to_live(10s);
+  cache.put(2, 2);
+  cache.put(3, 3, 20s);
+
+  FakeClock::current += 15s;
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 3u);  // removed lazily
+
+  EXPECT_EQ(cache.get(2), std::nullopt);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.stats().expirations, 1u);
+
+  FakeClock::current += 10s;
+  EXPECT_EQ(cache.get_or_compute(3, [] { return 30; }), 30);
+  EXPECT_EQ(cache.get(1), 1);
+}
+
+TEST(TestLruCache, Stats)
+{
+  autoware_utils_system::LRUCache<int, int> cache(1);
+  cache.put(1, 1);
+  cache.get(1);
+  cache.get(2);
+  cache.put(2, 2);
+  cache.peek(1);
+  EXPECT_EQ(cache.stats().hits, 1u);
+  EXPECT_EQ(cache.stats().misses, 1u);
+  EXPECT_EQ(cache.stats().evictions, 1u);
+
+  cache.reset_stats();
+  EXPECT_EQ(cache.stats().hits, 0u);
+  EXPECT_EQ(cache.stats().evictions, 0u);
+}
@@ -0,0 +1,64 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/object_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+TEST(TestObjectPool, Reuse)
+{
+  autoware_utils_system::ObjectPool<std::vector<int>> pool(1);
+  EXPECT_EQ(pool.available(), 1u);
+
+  const std::vector<int> * address = nullptr;
+  {
+    auto values = pool.acquire();
+    EXPECT_EQ(pool.available(), 0u);
+    EXPECT_EQ(pool.created(), 0u);
+    values->assign(100, 1);
+    address = values.get();
+
+    // a new object while the reserved one is acquired
+    auto other = pool.acquire();
+    EXPECT_EQ(pool.created(), 1u);
+  }
+  EXPECT_EQ(pool.available(), 2u);
+
+  // the last released object is reused first, with its state and its capacity
+  auto values = pool.acquire();
+  auto other = pool.acquire();
+  EXPECT_EQ(values.get(), address);
+  EXPECT_EQ(values->size(), 100u);
+  EXPECT_EQ(pool.created(), 1u);
+
+  values.reset();
+  other.reset();
+  pool.shrink();
+  EXPECT_EQ(pool.available(), 0u);
+}
+
+TEST(TestObjectPool, ResetFunction)
+{
+  autoware_utils_system::ObjectPool<std::vector<int>> pool(
+    0, [](std::vector<int> & values) { values.clear(); });
+  {
+    auto values = pool.acquire();
+    values->assign(100, 1);
+  }
+  auto values = pool.acquire();
+  EXPECT_TRUE(values->empty());
+  EXPECT_GE(values->capacity(), 100u);
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/sampling_profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <signal.h>
+
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+[[gnu::noinline]] double burn_cpu(const std::chrono::milliseconds duration)
+{
+  const auto start = std::chrono::steady_clock::now();
+  volatile double sum = 0.0;
+  while (std::chrono::steady_clock::now() - start < duration) {
+    for (int i = 0; i < 1000; ++i) {
+      sum = sum + std::sqrt(static_cast<double>(i));
+    }
+  }
+  return sum;
+}
+}  // namespace
+
+TEST(TestSamplingProfiler, FoldedStacks)
+{
+  autoware_utils_system::SamplingProfiler profiler(1000.0);
+  EXPECT_THROW(autoware_utils_system::SamplingProfiler(), std::logic_error);
+
+  burn_cpu(std::chrono::milliseconds(200));
+  profiler.collect();
+  EXPECT_GT(profiler.samples(), 0u);
+
+  std::stringstream ss;
+  profiler.write_folded(ss);
+  size_t total = 0;
+  for (std::string line; std::getline(ss, line);) {
+    const auto space = line.rfind(' ');
+    ASSERT_NE(space, std::string::npos);
+    total += std::stoul(line.substr(space + 1));
+  }
+  EXPECT_EQ(total, profiler.samples());
+}
+
+TEST(TestSamplingProfiler, InvalidArgument)
+{
+  EXPECT_THROW(autoware_utils_system::SamplingProfiler(0.0), std::invalid_argument);
+  EXPECT_THROW(autoware_utils_system::SamplingProfiler(99.0, 0), std::invalid_argument);
+}
+
+TEST(TestSamplingProfiler, Stop)
+{
+  // the threads are interrupted while the profilers are destroyed
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] { burn_cpu(std::chrono::milliseconds(300)); });
+  }
+  for (int i = 0; i < 20; ++i) {
+    autoware_utils_system::SamplingProfiler profiler(10000.0, 16);
+    burn_cpu(std::chrono::milliseconds(5));
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // a signal of the timer still pending after the destruction does not terminate the process
+  raise(SIGPROF);
+}
@@ -0,0 +1,91 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/spsc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+TEST(TestSpscQueue, Bounded)
+{
+  EXPECT_THROW(autoware_utils_system::SpscQueue<int>(0), std::invalid_argument);
+
+  autoware_utils_system::SpscQueue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.try_push(i));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4u);
+
+  int value = -1;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.try_emplace(4));
+  for (int i = 1; i < 5; ++i) {
+    EXPECT_EQ(queue.try_pop(), i);
+  }
+  EXPECT_FALSE(queue.try_pop());
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+}
+
+TEST(TestSpscQueue, SharedPtr)
+{
+  const auto message = std::make_shared<const int>(1);
+  {
+    autoware_utils_system::SpscQueue<std::shared_ptr<const int>> queue(4);
+    queue.try_push(message);
+    queue.try_push(message);
+    EXPECT_EQ(message.use_count(), 3);
+
+    // the popped element is released at once, and the remaining ones with the queue
+    EXPECT_EQ(*queue.try_pop().value(), 1);
+    EXPECT_EQ(message.use_count(), 2);
+  }
+  EXPECT_EQ(message.use_count(), 1);
+}
+
+TEST(TestSpscQueue, Threads)
+{
+  autoware_utils_system::SpscQueue<std::unique_ptr<size_t>> queue(64);
+  constexpr size_t count = 200000;
+
+  std::thread producer([&queue] {
+    for (size_t i = 0; i < count;) {
+      if (queue.try_push(std::make_unique<size_t>(i))) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  // the elements arrive complete and in order
+  size_t expected = 0;
+  while (expected < count) {
+    if (auto value = queue.try_pop()) {
+      ASSERT_EQ(**value, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+}
@@ -55,3 +55,38 @@ TEST(TestStopWatch, Abort)
   autoware_utils_system::StopWatch sw;
   EXPECT_THROW(sw.toc("baz"), std::out_of_range);
 }
+
+enum class Stage { preprocess, plan, count };
+
+TEST(TestFixedStopWatch, Default)
+{
+  autoware_utils_system::FixedStopWatch<> sw;
+  sw.tic();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_NEAR(sw.toc(true), 0.01, 0.001);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_NEAR(sw.toc(), 0.01, 0.001);
+}
+
+TEST(TestFixedStopWatch, Keys)
+{
+  constexpr auto stage_count = static_cast<size_t>(Stage::count);
+  autoware_utils_system::FixedStopWatch<stage_count, std::chrono::milliseconds> sw;
+  sw.tic(Stage::preprocess);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  sw.tic<Stage::plan>();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_NEAR(sw.toc<Stage::preprocess>(), 20.0, 1.0);
+  EXPECT_NEAR(sw.toc(1), 10.0, 1.0);
+}
+
+#ifdef CLOCK_MONOTONIC_RAW
+TEST(TestFixedStopWatch, MonotonicRawClock)
+{
+  autoware_utils_system::FixedStopWatch<
+    1, std::chrono::seconds, std::chrono::nanoseconds, autoware_utils_system::MonotonicRawClock>
+    sw;
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_NEAR(sw.toc(), 0.01, 0.001);
+}
+#endif
@@ -0,0 +1,136 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(TestThreadPool, ParallelFor)
+{
+  autoware_utils_system::ThreadPool pool({3, {}, 0});
+  EXPECT_EQ(pool.num_threads(), 3u);
+
+  // each index is visited once, in chunks of the grain size at most
+  for (const size_t size : {0u, 1u, 7u, 64u, 1000u, 12345u}) {
+    std::vector<std::atomic<int>> visits(size);
+    std::atomic<bool> oversized{false};
+    pool.parallel_for(0, size, 16, [&](size_t begin, size_t end) {
+      oversized = oversized || 16 < end - begin;
+      for (size_t i = begin; i < end; ++i) {
+        ++visits[i];
+      }
+    });
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(visits[i].load(), 1) << size << ", " << i;
+    }
+    EXPECT_FALSE(oversized.load());
+  }
+
+  // uneven chunks are stolen by the other threads
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  pool.parallel_for(100, 200, 1, [&](size_t begin, size_t) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(begin < 125 ? 20 : 1));
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  });
+  EXPECT_EQ(threads.size(), 4u);
+}
+
+TEST(TestThreadPool, Serial)
+{
+  autoware_utils_system::ThreadPool pool({2, {}, 0});
+  const auto caller = std::this_thread::get_id();
+
+  // not larger than the grain size
+  size_t calls = 0;
+  pool.parallel_for(0, 10, 10, [&](size_t begin, size_t end) {
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    EXPECT_EQ(begin, 0u);
+    EXPECT_EQ(end, 10u);
+    ++calls;
+  });
+  EXPECT_EQ(calls, 1u);
+
+  // the nested loops run in the thread of the outer chunk
+  std::atomic<size_t> total{0};
+  pool.parallel_for(0, 8, 1, [&](size_t, size_t) {
+    const auto outer = std::this_thread::get_id();
+    pool.parallel_for(0, 100, 1, [&](size_t begin, size_t end) {
+      EXPECT_EQ(std::this_thread::get_id(), outer);
+      total += end - begin;
+    });
+  });
+  EXPECT_EQ(total.load(), 800u);
+
+  // the loops of the other threads while the pool is busy
+  std::atomic<size_t> concurrent{0};
+  std::vector<std::thread> callers;
+  for (int i = 0; i < 4; ++i) {
+    callers.emplace_back([&] {
+      for (int j = 0; j < 20; ++j) {
+        pool.parallel_for(0, 100, 4, [&](size_t begin, size_t end) { concurrent += end - begin; });
+      }
+    });
+  }
+  for (auto & thread : callers) {
+    thread.join();
+  }
+  EXPECT_EQ(concurrent.load(), 8000u);
+}
+
+TEST(TestThreadPool, Exception)
+{
+  autoware_utils_system::ThreadPool pool({2, {}, 0});
+  EXPECT_THROW(
+    pool.parallel_for(
+      0, 1000, 1,
+      [](size_t begin, size_t) {
+        if (begin == 500) {
+          throw std::runtime_error("failed");
+        }
+      }),
+    std::runtime_error);
+
+  // the pool is usable after the exception
+  std::atomic<size_t> total{0};
+  pool.parallel_for(0, 1000, 1, [&](size_t begin, size_t end) { total += end - begin; });
+  EXPECT_EQ(total.load(), 1000u);
+}
+
+TEST(TestThreadPool, Options)
+{
+  // pinned to the first CPU, which always exists
+  autoware_utils_system::ThreadPool pool({2, {0}, 0});
+  std::atomic<size_t> total{0};
+  pool.parallel_for(0, 100, 1, [&](size_t begin, size_t end) { total += end - begin; });
+  EXPECT_EQ(total.load(), 100u);
+
+  EXPECT_THROW(autoware_utils_system::ThreadPool({1, {-1}, 0}), std::invalid_argument);
+
+  auto & shared = autoware_utils_system::ThreadPool::shared();
+  EXPECT_EQ(&shared, &autoware_utils_system::ThreadPool::shared());
+  total = 0;
+  shared.parallel_for(0, 100, 1, [&](size_t begin, size_t end) { total += end - begin; });
+  EXPECT_EQ(total.load(), 100u);
+}
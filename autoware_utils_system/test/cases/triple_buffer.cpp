@@ -0,0 +1,93 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/triple_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+TEST(TestTripleBuffer, Latest)
+{
+  autoware_utils_system::TripleBuffer<int> buffer(-1);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.read(), -1);
+
+  // only the latest of the values written between two updates is read
+  buffer.write(1);
+  buffer.write(2);
+  buffer.write_buffer() = 3;
+  buffer.publish();
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.read(), 3);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.read(), 3);
+
+  buffer.write(4);
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.read(), 4);
+}
+
+TEST(TestTripleBuffer, SharedPtr)
+{
+  autoware_utils_system::TripleBuffer<std::shared_ptr<const int>> buffer;
+  buffer.update();
+  EXPECT_FALSE(buffer.read());
+
+  buffer.write(std::make_shared<const int>(1));
+  ASSERT_TRUE(buffer.update());
+  ASSERT_TRUE(buffer.read());
+  EXPECT_EQ(*buffer.read(), 1);
+}
+
+TEST(TestTripleBuffer, Threads)
+{
+  // the values are arrays of the same number, which are torn if the buffers are shared
+  using Value = std::array<size_t, 16>;
+  autoware_utils_system::TripleBuffer<Value> buffer;
+  constexpr size_t count = 200000;
+  std::atomic<bool> done{false};
+
+  std::thread writer([&] {
+    for (size_t i = 1; i <= count; ++i) {
+      buffer.write_buffer().fill(i);
+      buffer.publish();
+    }
+    done = true;
+  });
+
+  size_t last = 0;
+  while (true) {
+    // the last value is published before done is set
+    const bool finished = done;
+    if (!buffer.update()) {
+      std::this_thread::yield();
+    }
+    const auto & value = buffer.read();
+    for (const auto element : value) {
+      ASSERT_EQ(element, value.front());
+    }
+    ASSERT_LE(last, value.front());
+    last = value.front();
+    if (finished) {
+      break;
+    }
+  }
+  writer.join();
+  EXPECT_EQ(buffer.read().front(), count);
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_system/two_queue_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+TEST(TestTwoQueueCache, Main)
+{
+  autoware_utils_system::TwoQueueCache<int, std::string> cache(4);
+  EXPECT_TRUE(cache.empty());
+  for (int i = 0; i < 4; ++i) {
+    cache.put(i, std::to_string(i));
+  }
+  EXPECT_EQ(cache.size(), 4u);
+  EXPECT_EQ(cache.get(2), "2");
+  EXPECT_EQ(cache.get(9), std::nullopt);
+
+  // the oldest key of the FIFO queue is evicted first, even if it was used
+  cache.put(4, "4");
+  EXPECT_FALSE(cache.contains(0));
+  EXPECT_EQ(cache.size(), 4u);
+
+  cache.put(4, "four");
+  EXPECT_EQ(*cache.peek(4), "four");
+  EXPECT_EQ(cache.stats().hits, 1u);
+  EXPECT_EQ(cache.stats().misses, 1u);
+  EXPECT_EQ(cache.stats().evictions, 1u);
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  autoware_utils_system::TwoQueueCache<int, std::string> empty(0);
+  empty.put(1, "1");
+  EXPECT_TRUE(empty.empty());
+  EXPECT_THROW(empty.emplace(1, "1"), std::length_error);
+}
+
+TEST(TestTwoQueueCache, ScanResistance)
+{
+  autoware_utils_system::TwoQueueCache<int, int> cache(8);
+
+  // a working set of keys inserted again after their eviction from the FIFO queue
+  for (int round = 0; round < 2; ++round) {
+    for (int i = 0; i < 4; ++i) {
+      cache.get_or_compute(i, [i] { return i; });
+    }
+    for (int i = 100 * (round + 1); i < 100 * (round + 1) + 8; ++i) {
+      cache.put(i, i);
+    }
+  }
+
+  // a scan of new keys only cycles the FIFO queue
+  for (int i = 1000; i < 2000; ++i) {
+    cache.put(i, i);
+  }
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(cache.contains(i)) << i;
+  }
+  EXPECT_EQ(cache.size(), 8u);
+}
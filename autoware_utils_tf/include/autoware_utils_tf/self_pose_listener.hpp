@@ -21,17 +21,94 @@
 
 #include <geometry_msgs/msg/pose_stamped.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 namespace autoware_utils_tf
 {
 class SelfPoseListener
 {
 public:
+  using Callback = std::function<void(const geometry_msgs::msg::PoseStamped::ConstSharedPtr &)>;
+
+  /**
+   * @brief Pose of base_link in map in 2D, with the cosine and the sine of its yaw.
+   */
+  struct Pose2dSnapshot
+  {
+    double x;
+    double y;
+    double yaw;
+    double cos_yaw;
+    double sin_yaw;
+    builtin_interfaces::msg::Time stamp;
+  };
+
   explicit SelfPoseListener(rclcpp::Node * node) : transform_listener_(node) {}
 
+  /**
+   * @brief Construct a new SelfPoseListener object, reading the transforms of a buffer which may
+   * be shared, and which must not be static only.
+   */
+  SelfPoseListener(rclcpp::Node * node, std::shared_ptr<TransformBuffer> buffer)
+  : transform_listener_(node, std::move(buffer))
+  {
+  }
+
+  ~SelfPoseListener() { transform_listener_.set_callback(nullptr); }
+
+  SelfPoseListener(const SelfPoseListener &) = delete;
+  SelfPoseListener & operator=(const SelfPoseListener &) = delete;
+
+  /**
+   * @brief Update the pose when a tf message for base_link is received, instead of on demand.
+   *
+   * The pose is then read by get_current_pose() without looking up the transform, and
+   * wait_for_first_pose() returns as soon as the first pose is received.
+   *
+   * @param callback Called with each new pose, in the thread receiving the transforms.
+   */
+  void enable_push(Callback callback = nullptr)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      callback_ = std::move(callback);
+    }
+    transform_listener_.set_callback(
+      [this](const tf2_msgs::msg::TFMessage & msg, const bool is_static) {
+        on_transforms(msg, is_static);
+      });
+    push_enabled_.store(true, std::memory_order_release);
+    // the transform may have been received before
+    update_pose();
+  }
+
   void wait_for_first_pose()
   {
+    if (push_enabled_.load(std::memory_order_acquire)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (rclcpp::ok()) {
+        const auto received = [this] { return std::atomic_load(&cached_pose_) != nullptr; };
+        if (pose_updated_.wait_for(lock, std::chrono::seconds(5), received)) {
+          return;
+        }
+        RCLCPP_INFO(transform_listener_.get_logger(), "waiting for self pose...");
+      }
+      return;
+    }
+
     while (rclcpp::ok()) {
       if (get_current_pose()) {
         return;
@@ -42,18 +119,151 @@ public:
   }
 
   geometry_msgs::msg::PoseStamped::ConstSharedPtr get_current_pose()
+  {
+    if (push_enabled_.load(std::memory_order_acquire)) {
+      const auto cached = std::atomic_load(&cached_pose_);
+      return cached ? cached->second : nullptr;
+    }
+    return lookup_pose();
+  }
+
+  /**
+   * @brief Get the current pose in 2D, computed once per transform.
+   *
+   * With enable_push(), the pose is read without looking up the transform, a lock or an allocation,
+   * e.g. at the beginning of each cycle of a controller. Otherwise, the transform is looked up as
+   * by get_current_pose().
+   *
+   * @return The pose, or std::nullopt if no transform has been received.
+   */
+  std::optional<Pose2dSnapshot> get_current_pose_2d()
+  {
+    if (!push_enabled_.load(std::memory_order_acquire)) {
+      // the snapshot is written by the lookup of a new transform
+      lookup_pose();
+    }
+    return read_snapshot();
+  }
+
+private:
+  using CachedPose = std::pair<
+    geometry_msgs::msg::TransformStamped::ConstSharedPtr,
+    geometry_msgs::msg::PoseStamped::ConstSharedPtr>;
+
+  geometry_msgs::msg::PoseStamped::ConstSharedPtr lookup_pose()
   {
     const auto tf = transform_listener_.get_latest_transform("map", "base_link");
     if (!tf) {
       return {};
     }
 
-    return std::make_shared<const geometry_msgs::msg::PoseStamped>(
+    // the pose is converted once per transform, whose pointer is kept by the transform listener
+    // until it changes
+    const auto cached = std::atomic_load(&cached_pose_);
+    if (cached && cached->first == tf) {
+      return cached->second;
+    }
+    const auto pose = std::make_shared<const geometry_msgs::msg::PoseStamped>(
       autoware_utils_geometry::transform2pose(*tf));
+    write_snapshot(*pose);
+    std::atomic_store(&cached_pose_, std::make_shared<const CachedPose>(tf, pose));
+    return pose;
+  }
+
+  /**
+   * @brief Write the 2D pose as a seqlock, whose sequence is odd while the words are written.
+   */
+  void write_snapshot(const geometry_msgs::msg::PoseStamped & pose)
+  {
+    const double yaw = autoware_utils_geometry::get_yaw(pose.pose.orientation);
+    const std::array<double, 5> values{
+      pose.pose.position.x, pose.pose.position.y, yaw, std::cos(yaw), std::sin(yaw)};
+
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    const auto sequence = snapshot_sequence_.load(std::memory_order_relaxed);
+    snapshot_sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      uint64_t word = 0;
+      std::memcpy(&word, &values[i], sizeof(word));
+      snapshot_words_[i].store(word, std::memory_order_relaxed);
+    }
+    snapshot_words_[values.size()].store(
+      static_cast<uint64_t>(static_cast<uint32_t>(pose.header.stamp.sec)) << 32 |
+        pose.header.stamp.nanosec,
+      std::memory_order_relaxed);
+    snapshot_sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  std::optional<Pose2dSnapshot> read_snapshot() const
+  {
+    std::array<uint64_t, snapshot_words_size> words;
+    while (true) {
+      const auto sequence = snapshot_sequence_.load(std::memory_order_acquire);
+      if (sequence == 0) {
+        return std::nullopt;
+      }
+      if (sequence % 2 == 1) {
+        continue;
+      }
+      for (std::size_t i = 0; i < words.size(); ++i) {
+        words[i] = snapshot_words_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (snapshot_sequence_.load(std::memory_order_relaxed) == sequence) {
+        break;
+      }
+    }
+
+    std::array<double, snapshot_words_size - 1> values;
+    std::memcpy(values.data(), words.data(), sizeof(values));
+    Pose2dSnapshot snapshot{values[0], values[1], values[2], values[3], values[4], {}};
+    snapshot.stamp.sec = static_cast<int32_t>(static_cast<uint32_t>(words.back() >> 32));
+    snapshot.stamp.nanosec = static_cast<uint32_t>(words.back());
+    return snapshot;
+  }
+
+  void on_transforms(const tf2_msgs::msg::TFMessage & msg, const bool is_static)
+  {
+    const auto is_base_link = [](const geometry_msgs::msg::TransformStamped & transform) {
+      return transform.child_frame_id == "base_link";
+    };
+    if (is_static || std::any_of(msg.transforms.begin(), msg.transforms.end(), is_base_link)) {
+      update_pose();
+    }
+  }
+
+  void update_pose()
+  {
+    const auto previous = std::atomic_load(&cached_pose_);
+    const auto pose = lookup_pose();
+    if (!pose || (previous && previous->second == pose)) {
+      return;
+    }
+    Callback callback;
+    {
+      // the waiters check the pose under the lock, so that the notification is not missed
+      std::lock_guard<std::mutex> lock(mutex_);
+      callback = callback_;
+    }
+    pose_updated_.notify_all();
+    if (callback) {
+      callback(pose);
+    }
   }
 
-private:
   TransformListener transform_listener_;
+  std::shared_ptr<const CachedPose> cached_pose_;  //!< Read by std::atomic_load
+  std::atomic<bool> push_enabled_{false};          //!< Whether the pose is updated by tf messages
+  std::mutex mutex_;                               //!< Guards the callback and the waits
+  std::condition_variable pose_updated_;           //!< Notified for each new pose when pushed
+  Callback callback_;
+
+  // x, y, yaw, cos_yaw and sin_yaw as the bits of the doubles, then the stamp
+  static constexpr std::size_t snapshot_words_size = 6;
+  std::array<std::atomic<uint64_t>, snapshot_words_size> snapshot_words_{};
+  std::atomic<uint64_t> snapshot_sequence_{0};  //!< 0 before the first pose, odd while written
+  std::mutex snapshot_mutex_;                   //!< Guards the writers of the snapshot
 };
 }  // namespace autoware_utils_tf
 
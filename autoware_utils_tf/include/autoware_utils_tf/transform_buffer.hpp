@@ -0,0 +1,229 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_TF__TRANSFORM_BUFFER_HPP_
+#define AUTOWARE_UTILS_TF__TRANSFORM_BUFFER_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/create_timer_ros.h>
+#include <tf2_ros/qos.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace autoware_utils_tf
+{
+/**
+ * @brief Receives the transforms into a tf2 buffer in a dedicated thread, as
+ * tf2_ros::TransformListener does, and counts the tf messages for the caches of the listeners.
+ *
+ * A buffer can be shared by the listeners of the nodes of a process, e.g. in a composable node
+ * container, so that the tf messages are deserialized once per process. A static only buffer does
+ * not subscribe to /tf, for the nodes which only need the calibrations of the sensors.
+ */
+class TransformBuffer
+{
+public:
+  using Callback = std::function<void(const tf2_msgs::msg::TFMessage &, bool)>;
+
+  /**
+   * @brief Construct a new TransformBuffer object, receiving the transforms with a node.
+   *
+   * @param node The node of the subscriptions and the clock.
+   * @param static_only Whether only /tf_static is subscribed.
+   */
+  explicit TransformBuffer(rclcpp::Node * node, const bool static_only = false)
+  : static_only_(static_only), logger_(node->get_logger())
+  {
+    init(*node);
+  }
+
+  ~TransformBuffer()
+  {
+    executor_->cancel();
+    executor_thread_.join();
+  }
+
+  TransformBuffer(const TransformBuffer &) = delete;
+  TransformBuffer & operator=(const TransformBuffer &) = delete;
+
+  /**
+   * @brief Get the buffer shared by the process, created on the first call and destroyed with its
+   * last listener.
+   *
+   * The shared buffer receives the transforms with its own node, in the context and with the
+   * use_sim_time parameter of the node creating it.
+   *
+   * @param node The node creating the buffer.
+   * @param static_only Whether only /tf_static is subscribed, shared separately.
+   */
+  static std::shared_ptr<TransformBuffer> get_shared(
+    rclcpp::Node * node, const bool static_only = false)
+  {
+    static std::mutex mutex;
+    static std::weak_ptr<TransformBuffer> buffers[2];
+    std::lock_guard<std::mutex> lock(mutex);
+    auto & weak_buffer = buffers[static_only ? 1 : 0];
+    if (auto buffer = weak_buffer.lock()) {
+      return buffer;
+    }
+
+    const std::string name = std::string("autoware_utils_tf_") +
+                             (static_only ? "static_buffer_" : "buffer_") +
+                             std::to_string(::getpid());
+    const auto options =
+      rclcpp::NodeOptions()
+        .context(node->get_node_base_interface()->get_context())
+        .start_parameter_services(false)
+        .start_parameter_event_publisher(false)
+        .arguments({"--ros-args", "-r", "__node:=" + name, "--"})
+        .parameter_overrides(
+          {rclcpp::Parameter("use_sim_time", node->get_parameter("use_sim_time").as_bool())});
+    const auto own_node = std::make_shared<rclcpp::Node>(name, options);
+    std::shared_ptr<TransformBuffer> buffer(new TransformBuffer(own_node, static_only));
+    weak_buffer = buffer;
+    return buffer;
+  }
+
+  tf2_ros::Buffer & buffer() { return *tf_buffer_; }
+
+  bool is_static_only() const { return static_only_; }
+
+  /**
+   * @brief Get the count of the tf messages received, from 1.
+   */
+  uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Get the count of the static tf messages received, from 1.
+   */
+  uint64_t static_generation() const { return static_generation_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Add a function called after each tf message is added to the buffer, in the thread
+   * receiving the transforms.
+   *
+   * @param callback The function, called with the message and whether it is static.
+   * @return std::size_t The identifier of the function, to remove it.
+   */
+  std::size_t add_callback(Callback callback)
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callbacks_.emplace(next_callback_id_, std::move(callback));
+    return next_callback_id_++;
+  }
+
+  /**
+   * @brief Remove a function, which is not running anymore when this returns.
+   *
+   * @param id The identifier returned by add_callback().
+   */
+  void remove_callback(const std::size_t id)
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callbacks_.erase(id);
+  }
+
+private:
+  TransformBuffer(rclcpp::Node::SharedPtr own_node, const bool static_only)
+  : own_node_(std::move(own_node)),
+    static_only_(static_only),
+    logger_(own_node_->get_logger())
+  {
+    init(*own_node_);
+  }
+
+  void init(rclcpp::Node & node)
+  {
+    tf_buffer_ = std::make_shared<tf2_ros::Buffer>(node.get_clock());
+    auto timer_interface = std::make_shared<tf2_ros::CreateTimerROS>(
+      node.get_node_base_interface(), node.get_node_timers_interface());
+    tf_buffer_->setCreateTimerInterface(timer_interface);
+    // the lookups may wait for the transforms received in the thread below
+    tf_buffer_->setUsingDedicatedThread(true);
+
+    callback_group_ =
+      node.create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+    rclcpp::SubscriptionOptions options;
+    options.callback_group = callback_group_;
+    if (!static_only_) {
+      tf_subscription_ = node.create_subscription<tf2_msgs::msg::TFMessage>(
+        "/tf", tf2_ros::DynamicListenerQoS(),
+        [this](const tf2_msgs::msg::TFMessage::ConstSharedPtr msg) { set_transforms(*msg, false); },
+        options);
+    }
+    tf_static_subscription_ = node.create_subscription<tf2_msgs::msg::TFMessage>(
+      "/tf_static", tf2_ros::StaticListenerQoS(),
+      [this](const tf2_msgs::msg::TFMessage::ConstSharedPtr msg) { set_transforms(*msg, true); },
+      options);
+    executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    executor_->add_callback_group(callback_group_, node.get_node_base_interface());
+    executor_thread_ = std::thread([this] { executor_->spin(); });
+  }
+
+  void set_transforms(const tf2_msgs::msg::TFMessage & msg, const bool is_static)
+  {
+    for (const auto & transform : msg.transforms) {
+      try {
+        tf_buffer_->setTransform(transform, "Authority undetectable", is_static);
+      } catch (const tf2::TransformException & ex) {
+        RCLCPP_ERROR(
+          logger_, "failed to set transform from %s to %s: %s", transform.header.frame_id.c_str(),
+          transform.child_frame_id.c_str(), ex.what());
+      }
+    }
+    if (is_static) {
+      static_generation_.fetch_add(1, std::memory_order_release);
+    }
+    generation_.fetch_add(1, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    for (const auto & [id, callback] : callbacks_) {
+      callback(msg, is_static);
+    }
+  }
+
+  rclcpp::Node::SharedPtr own_node_;  //!< Node of the shared buffer, or nullptr
+  bool static_only_;
+  rclcpp::Logger logger_;
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
+  rclcpp::CallbackGroup::SharedPtr callback_group_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr tf_subscription_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr tf_static_subscription_;
+  rclcpp::executors::SingleThreadedExecutor::SharedPtr executor_;
+  std::thread executor_thread_;
+
+  std::atomic<uint64_t> generation_{1};         //!< Count of the tf messages, from 1
+  std::atomic<uint64_t> static_generation_{1};  //!< Count of the static tf messages, from 1
+  std::mutex callback_mutex_;                   //!< Guards the callbacks, held while they run
+  std::map<std::size_t, Callback> callbacks_;   //!< Callbacks by identifier
+  std::size_t next_callback_id_{0};
+};
+}  // namespace autoware_utils_tf
+
+#endif  // AUTOWARE_UTILS_TF__TRANSFORM_BUFFER_HPP_
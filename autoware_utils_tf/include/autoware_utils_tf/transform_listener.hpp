@@ -15,46 +15,202 @@
 #ifndef AUTOWARE_UTILS_TF__TRANSFORM_LISTENER_HPP_
 #define AUTOWARE_UTILS_TF__TRANSFORM_LISTENER_HPP_
 
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <autoware_utils_tf/transform_buffer.hpp>
+#include <autoware_utils_tf/transform_window.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <geometry_msgs/msg/transform_stamped.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
 
 #include <tf2_ros/buffer.h>
-#include <tf2_ros/create_timer_ros.h>
-#include <tf2_ros/transform_listener.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace autoware_utils_tf
 {
+namespace detail
+{
+/**
+ * @brief Latest transform between a pair of frames, read without locking.
+ */
+struct CachedTransform
+{
+  std::atomic<uint64_t> generation{0};  //!< Generation of the tf messages of the value, 0 if none
+  std::atomic<bool> is_static{false};   //!< Whether the value depends on static frames only
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr value;  //!< Read by std::atomic_load
+};
+
+/**
+ * @brief Orders the pairs of frames, and finds them without copying the names.
+ */
+struct FramePairLess
+{
+  using is_transparent = void;
+
+  template <typename A, typename B>
+  bool operator()(const A & a, const B & b) const
+  {
+    return std::make_pair(std::string_view(a.first), std::string_view(a.second)) <
+           std::make_pair(std::string_view(b.first), std::string_view(b.second));
+  }
+};
+
+/**
+ * @brief Convert a transform to a matrix, e.g. for transform_point_cloud_from_ros_msg().
+ */
+inline Eigen::Matrix4f to_matrix(const geometry_msgs::msg::Transform & transform)
+{
+  const auto & t = transform.translation;
+  const auto & q = transform.rotation;
+  Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+  matrix.topLeftCorner<3, 3>() =
+    Eigen::Quaterniond(q.w, q.x, q.y, q.z).toRotationMatrix().cast<float>();
+  matrix.topRightCorner<3, 1>() = Eigen::Vector3d(t.x, t.y, t.z).cast<float>();
+  return matrix;
+}
+}  // namespace detail
+
+/**
+ * @brief Reason of a failure to get a transform.
+ */
+enum class TransformError {
+  none,           //!< The transform is available
+  unknown_frame,  //!< A frame has not been received
+  unavailable,    //!< The frames are not connected, or not at the time
+};
+
+inline const char * to_string(const TransformError error)
+{
+  switch (error) {
+    case TransformError::none:
+      return "none";
+    case TransformError::unknown_frame:
+      return "unknown frame";
+    case TransformError::unavailable:
+      return "unavailable";
+  }
+  return "unknown error";
+}
+
+/**
+ * @brief Counters of the lookups of a listener, to report the failures as diagnostics.
+ */
+struct TransformLookupStatistics
+{
+  uint64_t lookups{0};         //!< Number of lookups in the buffer
+  uint64_t unknown_frames{0};  //!< Number of failures for a frame not received
+  uint64_t unavailable{0};     //!< Number of failures for a transform not available
+
+  uint64_t failures() const { return unknown_frames + unavailable; }
+
+  /**
+   * @brief Get the ratio of the lookups which failed, or 0 without lookups.
+   */
+  double failure_rate() const
+  {
+    return lookups == 0 ? 0.0 : static_cast<double>(failures()) / lookups;
+  }
+
+  /**
+   * @brief Add the counters as key values of a diagnostic status.
+   *
+   * @tparam Diagnostics A type with add_key_value(key, value), e.g.
+   * autoware_utils_diagnostics::DiagnosticsInterface.
+   * @param diagnostics The diagnostic status to add to.
+   */
+  template <typename Diagnostics>
+  void add_key_values(Diagnostics & diagnostics) const
+  {
+    diagnostics.add_key_value("tf_lookups", lookups);
+    diagnostics.add_key_value("tf_failures", failures());
+    diagnostics.add_key_value("tf_unknown_frames", unknown_frames);
+    diagnostics.add_key_value("tf_unavailable", unavailable);
+    diagnostics.add_key_value("tf_failure_rate", failure_rate());
+  }
+};
+
 class TransformListener
 {
 public:
   explicit TransformListener(rclcpp::Node * node)
-  : clock_(node->get_clock()), logger_(node->get_logger())
+  : TransformListener(node, std::make_shared<TransformBuffer>(node))
   {
-    tf_buffer_ = std::make_shared<tf2_ros::Buffer>(clock_);
-    auto timer_interface = std::make_shared<tf2_ros::CreateTimerROS>(
-      node->get_node_base_interface(), node->get_node_timers_interface());
-    tf_buffer_->setCreateTimerInterface(timer_interface);
-    tf_listener_ = std::make_shared<tf2_ros::TransformListener>(*tf_buffer_);
   }
 
+  /**
+   * @brief Construct a new TransformListener object, reading the transforms of a buffer which may
+   * be shared, e.g. TransformBuffer::get_shared(node) for the nodes of a container.
+   *
+   * @param node The node of the logger and the clock.
+   * @param buffer The buffer receiving the transforms.
+   * @throw std::invalid_argument If the buffer is null.
+   */
+  TransformListener(rclcpp::Node * node, std::shared_ptr<TransformBuffer> buffer)
+  : clock_(node->get_clock()), logger_(node->get_logger()), buffer_(std::move(buffer))
+  {
+    if (!buffer_) {
+      throw std::invalid_argument("The transform buffer is null.");
+    }
+  }
+
+  ~TransformListener() { set_callback(nullptr); }
+
+  TransformListener(const TransformListener &) = delete;
+  TransformListener & operator=(const TransformListener &) = delete;
+
+  /**
+   * @brief Get the latest transform between two frames, cached per pair of frames.
+   *
+   * A transform of static frames only is looked up once, and the others once per tf message. The
+   * cached transforms are read without locking the tf buffer, and the same pointer is returned
+   * until the transform changes.
+   *
+   * @return The transform, or nullptr if it cannot be looked up.
+   */
   geometry_msgs::msg::TransformStamped::ConstSharedPtr get_latest_transform(
     const std::string & from, const std::string & to)
   {
+    auto & cached = cached_transform(from, to);
+    const uint64_t generation = buffer_->generation();
+    const uint64_t static_generation = buffer_->static_generation();
+    const bool is_static = cached.is_static.load(std::memory_order_acquire);
+    if (
+      cached.generation.load(std::memory_order_acquire) ==
+      (is_static ? static_generation : generation)) {
+      return std::atomic_load(&cached.value);
+    }
+
     geometry_msgs::msg::TransformStamped tf;
-    try {
-      tf = tf_buffer_->lookupTransform(from, to, tf2::TimePointZero);
-    } catch (tf2::TransformException & ex) {
-      RCLCPP_WARN_THROTTLE(
-        logger_, *clock_, 5000, "failed to get transform from %s to %s: %s", from.c_str(),
-        to.c_str(), ex.what());
+    const auto error = lookup(from, to, tf2::TimePointZero, tf2::Duration::zero(), tf);
+    if (error != TransformError::none) {
+      warn_failure(from, to, error);
       return {};
     }
 
-    return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    // the latest transform of static frames only has no stamp, and changes with /tf_static only
+    auto value = std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    const bool is_static_value = tf.header.stamp.sec == 0 && tf.header.stamp.nanosec == 0;
+    std::atomic_store(&cached.value, value);
+    cached.is_static.store(is_static_value, std::memory_order_release);
+    cached.generation.store(
+      is_static_value ? static_generation : generation, std::memory_order_release);
+    return value;
   }
 
   geometry_msgs::msg::TransformStamped::ConstSharedPtr get_transform(
@@ -62,25 +218,258 @@ public:
     const rclcpp::Duration & duration)
   {
     geometry_msgs::msg::TransformStamped tf;
-    try {
-      tf = tf_buffer_->lookupTransform(from, to, time, duration);
-    } catch (tf2::TransformException & ex) {
-      RCLCPP_WARN_THROTTLE(
-        logger_, *clock_, 5000, "failed to get transform from %s to %s: %s", from.c_str(),
-        to.c_str(), ex.what());
+    const auto error = try_get_transform(from, to, time, duration, tf);
+    if (error != TransformError::none) {
+      warn_failure(from, to, error);
       return {};
     }
 
     return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
   }
 
+  /**
+   * @brief Get the transform between two frames at a time, without throwing nor logging, e.g. in
+   * the loops which must not pay the unwinding of a tf2::TransformException for each failure.
+   *
+   * The buffer is checked by canTransform() first, and the failures are counted in
+   * lookup_statistics().
+   *
+   * @param from The target frame.
+   * @param to The source frame.
+   * @param time The time of the transform.
+   * @param timeout The longest wait for the transform to be available.
+   * @param transform The transform, unchanged on a failure.
+   * @return TransformError::none, or the reason of the failure.
+   */
+  TransformError try_get_transform(
+    const std::string & from, const std::string & to, const rclcpp::Time & time,
+    const rclcpp::Duration & timeout, geometry_msgs::msg::TransformStamped & transform)
+  {
+    return lookup(from, to, tf2_ros::fromRclcpp(time), tf2_ros::fromRclcpp(timeout), transform);
+  }
+
+  /**
+   * @brief Get the counters of the lookups since the construction or the last clear.
+   */
+  TransformLookupStatistics lookup_statistics() const
+  {
+    TransformLookupStatistics statistics;
+    statistics.lookups = lookups_.load(std::memory_order_relaxed);
+    statistics.unknown_frames = unknown_frames_.load(std::memory_order_relaxed);
+    statistics.unavailable = unavailable_.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+  /**
+   * @brief Reset the counters of the lookups, e.g. after each report.
+   */
+  void clear_lookup_statistics()
+  {
+    lookups_.store(0, std::memory_order_relaxed);
+    unknown_frames_.store(0, std::memory_order_relaxed);
+    unavailable_.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the transforms of several pairs of frames at the same time, as matrices.
+   *
+   * The pairs share the timeout, which bounds the wait for the whole batch, and a failure is
+   * reported once for the batch.
+   *
+   * @param frames The pairs of frames, from and to as for get_transform().
+   * @param time The time of the transforms.
+   * @param timeout The longest wait for the transforms to be available.
+   * @param matrices The matrices in the order of the pairs, cleared first so that their capacity
+   * is reused.
+   * @return true if all the transforms are looked up.
+   */
+  bool get_transforms(
+    const std::vector<std::pair<std::string, std::string>> & frames, const rclcpp::Time & time,
+    const rclcpp::Duration & timeout, std::vector<Eigen::Matrix4f> & matrices)
+  {
+    matrices.clear();
+    const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout.nanoseconds());
+    for (const auto & [from, to] : frames) {
+      const auto remaining = std::max(
+        std::chrono::steady_clock::duration::zero(), deadline - std::chrono::steady_clock::now());
+      geometry_msgs::msg::TransformStamped tf;
+      const auto error = lookup(
+        from, to, tf2_ros::fromRclcpp(time), std::chrono::duration_cast<tf2::Duration>(remaining),
+        tf);
+      if (error != TransformError::none) {
+        warn_failure(from, to, error);
+        matrices.clear();
+        return false;
+      }
+      matrices.push_back(detail::to_matrix(tf.transform));
+    }
+    return true;
+  }
+
+  /**
+   * @brief Get the transforms of several pairs of frames at the same time, as matrices.
+   *
+   * @return The matrices in the order of the pairs, or std::nullopt if one is not looked up.
+   */
+  std::optional<std::vector<Eigen::Matrix4f>> get_transforms(
+    const std::vector<std::pair<std::string, std::string>> & frames, const rclcpp::Time & time,
+    const rclcpp::Duration & timeout)
+  {
+    std::vector<Eigen::Matrix4f> matrices;
+    if (!get_transforms(frames, time, timeout, matrices)) {
+      return std::nullopt;
+    }
+    return matrices;
+  }
+
+  /**
+   * @brief Sample the transforms between two frames over a time window, to be interpolated
+   * locally at the times in the window.
+   *
+   * The transforms are looked up at the start, the end and the times dividing the window into
+   * regular intervals, which share the timeout as in get_transforms().
+   *
+   * @param from The target frame.
+   * @param to The source frame.
+   * @param start The start of the window.
+   * @param end The end of the window.
+   * @param timeout The longest wait for the transforms to be available.
+   * @param intervals The count of the intervals between the samples, more for a faster motion.
+   * @param window The samples, cleared first so that their capacity is reused.
+   * @throw std::invalid_argument If the end is before the start or there are no intervals.
+   * @return true if all the transforms are looked up.
+   */
+  bool get_transform_window(
+    const std::string & from, const std::string & to, const rclcpp::Time & start,
+    const rclcpp::Time & end, const rclcpp::Duration & timeout, const size_t intervals,
+    TransformWindow & window)
+  {
+    if (end < start) {
+      throw std::invalid_argument("The end of the window is before its start.");
+    }
+    if (intervals == 0) {
+      throw std::invalid_argument("The window has no intervals.");
+    }
+    window.clear();
+    const int64_t start_ns = start.nanoseconds();
+    const int64_t duration_ns = end.nanoseconds() - start_ns;
+    // the samples are distinct times, even for a window shorter than the intervals in nanoseconds
+    const int64_t count = std::min(static_cast<int64_t>(intervals), duration_ns);
+    const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout.nanoseconds());
+    for (int64_t k = 0; k <= count; ++k) {
+      const int64_t stamp_ns = 0 < count ? start_ns + duration_ns * k / count : start_ns;
+      const auto remaining = std::max(
+        std::chrono::steady_clock::duration::zero(), deadline - std::chrono::steady_clock::now());
+      geometry_msgs::msg::TransformStamped tf;
+      const auto error = lookup(
+        from, to, tf2::TimePoint(std::chrono::nanoseconds(stamp_ns)),
+        std::chrono::duration_cast<tf2::Duration>(remaining), tf);
+      if (error != TransformError::none) {
+        warn_failure(from, to, error);
+        window.clear();
+        return false;
+      }
+      window.add(stamp_ns, tf.transform);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Sample the transforms between two frames over a time window.
+   *
+   * @return The samples, or std::nullopt if one is not looked up.
+   */
+  std::optional<TransformWindow> get_transform_window(
+    const std::string & from, const std::string & to, const rclcpp::Time & start,
+    const rclcpp::Time & end, const rclcpp::Duration & timeout, const size_t intervals = 1)
+  {
+    TransformWindow window;
+    if (!get_transform_window(from, to, start, end, timeout, intervals, window)) {
+      return std::nullopt;
+    }
+    return window;
+  }
+
   rclcpp::Logger get_logger() { return logger_; }
 
+  const std::shared_ptr<TransformBuffer> & get_buffer() const { return buffer_; }
+
+  /**
+   * @brief Set a function called after each tf message is added to the buffer, in the thread
+   * receiving the transforms. The previous function is not running anymore when this returns.
+   *
+   * @param callback The function, called with the message and whether it is static, or nullptr.
+   */
+  void set_callback(std::function<void(const tf2_msgs::msg::TFMessage &, bool)> callback)
+  {
+    if (callback_id_) {
+      buffer_->remove_callback(*callback_id_);
+      callback_id_.reset();
+    }
+    if (callback) {
+      callback_id_ = buffer_->add_callback(std::move(callback));
+    }
+  }
+
 private:
+  TransformError lookup(
+    const std::string & from, const std::string & to, const tf2::TimePoint & time,
+    const tf2::Duration & timeout, geometry_msgs::msg::TransformStamped & transform)
+  {
+    lookups_.fetch_add(1, std::memory_order_relaxed);
+    auto & buffer = buffer_->buffer();
+    if (!buffer.canTransform(from, to, time, timeout)) {
+      if (!buffer._frameExists(from) || !buffer._frameExists(to)) {
+        unknown_frames_.fetch_add(1, std::memory_order_relaxed);
+        return TransformError::unknown_frame;
+      }
+      unavailable_.fetch_add(1, std::memory_order_relaxed);
+      return TransformError::unavailable;
+    }
+    try {
+      // the transform may be unavailable since the check, e.g. when the buffer is cleared
+      transform = buffer.lookupTransform(from, to, time);
+    } catch (const tf2::TransformException &) {
+      unavailable_.fetch_add(1, std::memory_order_relaxed);
+      return TransformError::unavailable;
+    }
+    return TransformError::none;
+  }
+
+  void warn_failure(const std::string & from, const std::string & to, const TransformError error)
+  {
+    RCLCPP_WARN_THROTTLE(
+      logger_, *clock_, 5000, "failed to get transform from %s to %s: %s", from.c_str(),
+      to.c_str(), to_string(error));
+  }
+
+  detail::CachedTransform & cached_transform(const std::string & from, const std::string & to)
+  {
+    const std::pair<std::string_view, std::string_view> key(from, to);
+    {
+      std::shared_lock<std::shared_mutex> lock(cache_mutex_);
+      const auto it = cache_.find(key);
+      if (it != cache_.end()) {
+        return it->second;
+      }
+    }
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    return cache_.try_emplace(std::make_pair(from, to)).first->second;
+  }
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_;
-  std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
-  std::shared_ptr<tf2_ros::TransformListener> tf_listener_;
+  std::shared_ptr<TransformBuffer> buffer_;
+  std::optional<std::size_t> callback_id_;  //!< Identifier of the callback in the buffer
+
+  std::atomic<uint64_t> lookups_{0};
+  std::atomic<uint64_t> unknown_frames_{0};
+  std::atomic<uint64_t> unavailable_{0};
+  std::shared_mutex cache_mutex_;  //!< Guards the insertions into the cache
+  std::map<std::pair<std::string, std::string>, detail::CachedTransform, detail::FramePairLess>
+    cache_;  //!< Cached transforms by pair of frames, whose addresses are stable
 };
 }  // namespace autoware_utils_tf
 
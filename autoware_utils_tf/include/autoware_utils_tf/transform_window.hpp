@@ -0,0 +1,157 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_TF__TRANSFORM_WINDOW_HPP_
+#define AUTOWARE_UTILS_TF__TRANSFORM_WINDOW_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/transform.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_tf
+{
+/**
+ * @brief Transforms between two frames sampled over a time window, interpolated locally at any
+ * number of times, e.g. for the points of a scan, instead of one lookup in the tf buffer each.
+ *
+ * The translations are interpolated linearly and the rotations by slerp between the samples, as
+ * by the tf buffer between its transforms. The times out of the window are clamped to it.
+ */
+class TransformWindow
+{
+public:
+  /**
+   * @brief Remove the samples, keeping their capacity.
+   */
+  void clear() { samples_.clear(); }
+
+  /**
+   * @brief Add the transform at a time after the samples.
+   *
+   * @throw std::invalid_argument If the time is not after the last sample.
+   */
+  void add(const int64_t stamp_ns, const geometry_msgs::msg::Transform & transform)
+  {
+    if (!samples_.empty() && stamp_ns <= samples_.back().stamp_ns) {
+      throw std::invalid_argument("The transform is not after the last sample of the window.");
+    }
+    const auto & t = transform.translation;
+    const auto & q = transform.rotation;
+    samples_.push_back(
+      {stamp_ns, Eigen::Vector3d(t.x, t.y, t.z), Eigen::Quaterniond(q.w, q.x, q.y, q.z)});
+  }
+
+  void add(const rclcpp::Time & time, const geometry_msgs::msg::Transform & transform)
+  {
+    add(time.nanoseconds(), transform);
+  }
+
+  bool empty() const { return samples_.empty(); }
+  size_t size() const { return samples_.size(); }
+
+  /**
+   * @brief Get the time of the first sample in nanoseconds.
+   *
+   * @throw std::runtime_error If the window is empty.
+   */
+  int64_t start_ns() const { return checked_samples().front().stamp_ns; }
+
+  /**
+   * @brief Get the time of the last sample in nanoseconds.
+   *
+   * @throw std::runtime_error If the window is empty.
+   */
+  int64_t end_ns() const { return checked_samples().back().stamp_ns; }
+
+  /**
+   * @brief Interpolate the transform at a time, clamped to the window.
+   *
+   * @throw std::runtime_error If the window is empty.
+   */
+  Eigen::Isometry3d at(const int64_t stamp_ns) const
+  {
+    const auto & first = checked_samples().front();
+    if (stamp_ns <= first.stamp_ns || samples_.size() == 1) {
+      return to_isometry(first.translation, first.rotation);
+    }
+    const auto next = std::upper_bound(
+      samples_.begin(), samples_.end(), stamp_ns,
+      [](const int64_t stamp, const Sample & sample) { return stamp < sample.stamp_ns; });
+    if (next == samples_.end()) {
+      return to_isometry(samples_.back().translation, samples_.back().rotation);
+    }
+    const auto & prev = *(next - 1);
+    const double ratio = static_cast<double>(stamp_ns - prev.stamp_ns) /
+                         static_cast<double>(next->stamp_ns - prev.stamp_ns);
+    return to_isometry(
+      prev.translation + ratio * (next->translation - prev.translation),
+      prev.rotation.slerp(ratio, next->rotation));
+  }
+
+  Eigen::Isometry3d at(const rclcpp::Time & time) const { return at(time.nanoseconds()); }
+
+  /**
+   * @brief Interpolate the transform at a time, clamped to the window, as a matrix, e.g. for the
+   * SensorMotion of autoware_utils_pcl.
+   *
+   * @throw std::runtime_error If the window is empty.
+   */
+  Eigen::Matrix4f matrix_at(const int64_t stamp_ns) const
+  {
+    return at(stamp_ns).matrix().cast<float>();
+  }
+
+  Eigen::Matrix4f matrix_at(const rclcpp::Time & time) const
+  {
+    return matrix_at(time.nanoseconds());
+  }
+
+private:
+  struct Sample
+  {
+    int64_t stamp_ns;
+    Eigen::Vector3d translation;
+    Eigen::Quaterniond rotation;
+  };
+
+  static Eigen::Isometry3d to_isometry(
+    const Eigen::Vector3d & translation, const Eigen::Quaterniond & rotation)
+  {
+    Eigen::Isometry3d isometry = Eigen::Isometry3d::Identity();
+    isometry.linear() = rotation.toRotationMatrix();
+    isometry.translation() = translation;
+    return isometry;
+  }
+
+  const std::vector<Sample> & checked_samples() const
+  {
+    if (samples_.empty()) {
+      throw std::runtime_error("The transform window is empty.");
+    }
+    return samples_;
+  }
+
+  std::vector<Sample> samples_;
+};
+}  // namespace autoware_utils_tf
+
+#endif  // AUTOWARE_UTILS_TF__TRANSFORM_WINDOW_HPP_
@@ -14,9 +14,83 @@
 
 #include "autoware_utils_tf/self_pose_listener.hpp"
 
+#include <tf2_ros/transform_broadcaster.h>
+
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+
 TEST(TestSelfPoseListener, Main)
 {
   // TODO(Takagi, Isamu): Add test cases. Currently, we are only checking whether it can be built.
 }
+
+TEST(TestSelfPoseListener, Push)
+{
+  const auto node = std::make_shared<rclcpp::Node>("self_pose_listener_push");
+  autoware_utils_tf::SelfPoseListener listener(node.get());
+  std::atomic<int> poses{0};
+  listener.enable_push(
+    [&poses](const geometry_msgs::msg::PoseStamped::ConstSharedPtr &) { ++poses; });
+  EXPECT_EQ(listener.get_current_pose(), nullptr);
+
+  tf2_ros::TransformBroadcaster broadcaster(node);
+  std::thread thread([&broadcaster] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    geometry_msgs::msg::TransformStamped tf;
+    tf.header.frame_id = "map";
+    tf.header.stamp.sec = 1;
+    tf.child_frame_id = "base_link";
+    tf.transform.translation.x = 1.0;
+    tf.transform.rotation.w = 1.0;
+    broadcaster.sendTransform(tf);
+  });
+
+  // the waiter is notified when the transform is received
+  listener.wait_for_first_pose();
+  thread.join();
+  const auto pose = listener.get_current_pose();
+  ASSERT_NE(pose, nullptr);
+  EXPECT_DOUBLE_EQ(pose->pose.position.x, 1.0);
+  EXPECT_EQ(listener.get_current_pose(), pose);
+  EXPECT_EQ(poses, 1);
+}
+
+TEST(TestSelfPoseListener, Pose2dSnapshot)
+{
+  const auto node = std::make_shared<rclcpp::Node>("self_pose_listener_snapshot");
+  autoware_utils_tf::SelfPoseListener listener(node.get());
+  listener.enable_push();
+  EXPECT_FALSE(listener.get_current_pose_2d());
+
+  tf2_ros::TransformBroadcaster broadcaster(node);
+  std::thread thread([&broadcaster] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    geometry_msgs::msg::TransformStamped tf;
+    tf.header.frame_id = "map";
+    tf.header.stamp.sec = 1;
+    tf.header.stamp.nanosec = 2;
+    tf.child_frame_id = "base_link";
+    tf.transform.translation.x = 1.0;
+    tf.transform.translation.y = 2.0;
+    tf.transform.rotation.z = std::sin(0.25);
+    tf.transform.rotation.w = std::cos(0.25);
+    broadcaster.sendTransform(tf);
+  });
+
+  listener.wait_for_first_pose();
+  thread.join();
+  const auto snapshot = listener.get_current_pose_2d();
+  ASSERT_TRUE(snapshot);
+  EXPECT_DOUBLE_EQ(snapshot->x, 1.0);
+  EXPECT_DOUBLE_EQ(snapshot->y, 2.0);
+  EXPECT_NEAR(snapshot->yaw, 0.5, 1e-12);
+  EXPECT_NEAR(snapshot->cos_yaw, std::cos(0.5), 1e-12);
+  EXPECT_NEAR(snapshot->sin_yaw, std::sin(0.5), 1e-12);
+  EXPECT_EQ(snapshot->stamp.sec, 1);
+  EXPECT_EQ(snapshot->stamp.nanosec, 2u);
+}
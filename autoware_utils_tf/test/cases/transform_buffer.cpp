@@ -0,0 +1,100 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_tf/transform_buffer.hpp"
+
+#include "autoware_utils_tf/transform_listener.hpp"
+
+#include <tf2_ros/static_transform_broadcaster.h>
+#include <tf2_ros/transform_broadcaster.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+geometry_msgs::msg::TransformStamped make_transform(
+  const std::string & from, const std::string & to, const int32_t sec, const double x)
+{
+  geometry_msgs::msg::TransformStamped tf;
+  tf.header.frame_id = from;
+  tf.header.stamp.sec = sec;
+  tf.child_frame_id = to;
+  tf.transform.translation.x = x;
+  tf.transform.rotation.w = 1.0;
+  return tf;
+}
+
+template <typename Condition>
+bool wait_for(const Condition & condition)
+{
+  for (int i = 0; i < 500 && !condition(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return condition();
+}
+}  // namespace
+
+TEST(TestTransformBuffer, Shared)
+{
+  const auto node1 = std::make_shared<rclcpp::Node>("transform_buffer_shared_1");
+  const auto node2 = std::make_shared<rclcpp::Node>("transform_buffer_shared_2");
+  const auto buffer = autoware_utils_tf::TransformBuffer::get_shared(node1.get());
+  EXPECT_EQ(autoware_utils_tf::TransformBuffer::get_shared(node2.get()), buffer);
+  EXPECT_NE(autoware_utils_tf::TransformBuffer::get_shared(node2.get(), true), buffer);
+  EXPECT_THROW(autoware_utils_tf::TransformListener(node1.get(), nullptr), std::invalid_argument);
+
+  // the listeners of both nodes read the transforms received once
+  autoware_utils_tf::TransformListener listener1(node1.get(), buffer);
+  autoware_utils_tf::TransformListener listener2(
+    node2.get(), autoware_utils_tf::TransformBuffer::get_shared(node2.get()));
+  std::atomic<int> calls1{0};
+  std::atomic<int> calls2{0};
+  listener1.set_callback([&calls1](const auto &, bool) { ++calls1; });
+  listener2.set_callback([&calls2](const auto &, bool) { ++calls2; });
+
+  tf2_ros::TransformBroadcaster broadcaster(node1);
+  broadcaster.sendTransform(make_transform("map", "base_link", 1, 2.0));
+  ASSERT_TRUE(wait_for([&listener2] {
+    return listener2.get_latest_transform("map", "base_link") != nullptr;
+  }));
+  EXPECT_NE(listener1.get_latest_transform("map", "base_link"), nullptr);
+  EXPECT_TRUE(wait_for([&calls1, &calls2] { return calls1 > 0 && calls2 > 0; }));
+}
+
+TEST(TestTransformBuffer, StaticOnly)
+{
+  const auto node = std::make_shared<rclcpp::Node>("transform_buffer_static_only");
+  const auto buffer = std::make_shared<autoware_utils_tf::TransformBuffer>(node.get(), true);
+  autoware_utils_tf::TransformListener listener(node.get(), buffer);
+  EXPECT_TRUE(buffer->is_static_only());
+
+  tf2_ros::StaticTransformBroadcaster static_broadcaster(node);
+  tf2_ros::TransformBroadcaster broadcaster(node);
+  static_broadcaster.sendTransform(make_transform("base_link", "sensor", 0, 1.0));
+  ASSERT_TRUE(wait_for([&listener] {
+    return listener.get_latest_transform("base_link", "sensor") != nullptr;
+  }));
+
+  // the dynamic transforms are not received
+  broadcaster.sendTransform(make_transform("map", "base_link", 1, 2.0));
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_EQ(listener.get_latest_transform("map", "base_link"), nullptr);
+}
@@ -14,9 +14,159 @@
 
 #include "autoware_utils_tf/transform_listener.hpp"
 
+#include <tf2_ros/static_transform_broadcaster.h>
+#include <tf2_ros/transform_broadcaster.h>
+
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 TEST(TestTransformListener, Main)
 {
   // TODO(Takagi, Isamu): Add test cases. Currently, we are only checking whether it can be built.
 }
+
+namespace
+{
+geometry_msgs::msg::TransformStamped make_transform(
+  const std::string & from, const std::string & to, const int32_t sec, const double x)
+{
+  geometry_msgs::msg::TransformStamped tf;
+  tf.header.frame_id = from;
+  tf.header.stamp.sec = sec;
+  tf.child_frame_id = to;
+  tf.transform.translation.x = x;
+  tf.transform.rotation.w = 1.0;
+  return tf;
+}
+
+template <typename Condition>
+bool wait_for(const Condition & condition)
+{
+  for (int i = 0; i < 500 && !condition(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return condition();
+}
+}  // namespace
+
+TEST(TestTransformListener, Cache)
+{
+  const auto node = std::make_shared<rclcpp::Node>("transform_listener_cache");
+  autoware_utils_tf::TransformListener listener(node.get());
+  tf2_ros::TransformBroadcaster broadcaster(node);
+  tf2_ros::StaticTransformBroadcaster static_broadcaster(node);
+
+  static_broadcaster.sendTransform(make_transform("base_link", "sensor", 0, 1.0));
+  broadcaster.sendTransform(make_transform("map", "base_link", 1, 2.0));
+  ASSERT_TRUE(wait_for([&listener] {
+    return listener.get_latest_transform("map", "base_link") != nullptr;
+  }));
+  ASSERT_TRUE(wait_for([&listener] {
+    return listener.get_latest_transform("base_link", "sensor") != nullptr;
+  }));
+
+  // the same transform is returned until a tf message is received
+  const auto dynamic_tf = listener.get_latest_transform("map", "base_link");
+  const auto static_tf = listener.get_latest_transform("base_link", "sensor");
+  EXPECT_EQ(listener.get_latest_transform("map", "base_link"), dynamic_tf);
+  EXPECT_DOUBLE_EQ(static_tf->transform.translation.x, 1.0);
+
+  // the static transforms are not looked up again for the dynamic messages
+  broadcaster.sendTransform(make_transform("map", "base_link", 2, 3.0));
+  EXPECT_TRUE(wait_for([&listener] {
+    return listener.get_latest_transform("map", "base_link")->transform.translation.x == 3.0;
+  }));
+  EXPECT_EQ(listener.get_latest_transform("base_link", "sensor"), static_tf);
+}
+
+TEST(TestTransformListener, Batch)
+{
+  const auto node = std::make_shared<rclcpp::Node>("transform_listener_batch");
+  autoware_utils_tf::TransformListener listener(node.get());
+  tf2_ros::StaticTransformBroadcaster static_broadcaster(node);
+  static_broadcaster.sendTransform(
+    {make_transform("base_link", "lidar", 0, 1.0), make_transform("base_link", "radar", 0, 2.0)});
+
+  const std::vector<std::pair<std::string, std::string>> frames = {
+    {"base_link", "lidar"}, {"base_link", "radar"}};
+  const auto matrices =
+    listener.get_transforms(frames, rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(5.0));
+  ASSERT_TRUE(matrices);
+  ASSERT_EQ(matrices->size(), 2u);
+  EXPECT_FLOAT_EQ((*matrices)[0](0, 3), 1.0f);
+  EXPECT_FLOAT_EQ((*matrices)[1](0, 3), 2.0f);
+  EXPECT_FLOAT_EQ((*matrices)[1](0, 0), 1.0f);
+
+  // the batch fails if a pair cannot be looked up
+  const std::vector<std::pair<std::string, std::string>> unknown = {
+    {"base_link", "lidar"}, {"base_link", "unknown"}};
+  std::vector<Eigen::Matrix4f> output;
+  EXPECT_FALSE(listener.get_transforms(
+    unknown, rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(0.0), output));
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(TestTransformListener, Window)
+{
+  const auto node = std::make_shared<rclcpp::Node>("transform_listener_window");
+  autoware_utils_tf::TransformListener listener(node.get());
+  tf2_ros::TransformBroadcaster broadcaster(node);
+  broadcaster.sendTransform(
+    {make_transform("map", "base_link", 1, 1.0), make_transform("map", "base_link", 2, 3.0)});
+
+  const auto window = listener.get_transform_window(
+    "map", "base_link", rclcpp::Time(1, 0), rclcpp::Time(2, 0), rclcpp::Duration::from_seconds(5.0),
+    4);
+  ASSERT_TRUE(window);
+  EXPECT_EQ(window->size(), 5u);
+  EXPECT_NEAR(window->at(rclcpp::Time(1, 500000000)).translation().x(), 2.0, 1e-9);
+  EXPECT_NEAR(window->at(rclcpp::Time(1, 125000000)).translation().x(), 1.25, 1e-9);
+
+  EXPECT_THROW(
+    listener.get_transform_window(
+      "map", "base_link", rclcpp::Time(2, 0), rclcpp::Time(1, 0), rclcpp::Duration(0, 0)),
+    std::invalid_argument);
+  EXPECT_FALSE(listener.get_transform_window(
+    "map", "unknown", rclcpp::Time(1, 0), rclcpp::Time(2, 0), rclcpp::Duration(0, 0)));
+}
+
+TEST(TestTransformListener, TryGetTransform)
+{
+  using autoware_utils_tf::TransformError;
+  const auto node = std::make_shared<rclcpp::Node>("transform_listener_try_get");
+  autoware_utils_tf::TransformListener listener(node.get());
+  tf2_ros::StaticTransformBroadcaster static_broadcaster(node);
+  static_broadcaster.sendTransform(
+    {make_transform("base_link", "lidar", 0, 1.0), make_transform("map", "odom", 0, 2.0)});
+
+  geometry_msgs::msg::TransformStamped tf;
+  const auto timeout = rclcpp::Duration::from_seconds(5.0);
+  ASSERT_EQ(
+    listener.try_get_transform("base_link", "lidar", rclcpp::Time(0, 0), timeout, tf),
+    TransformError::none);
+  EXPECT_DOUBLE_EQ(tf.transform.translation.x, 1.0);
+
+  // the failures are returned without exceptions and counted
+  const auto zero = rclcpp::Duration(0, 0);
+  EXPECT_EQ(
+    listener.try_get_transform("base_link", "unknown", rclcpp::Time(0, 0), zero, tf),
+    TransformError::unknown_frame);
+  EXPECT_EQ(
+    listener.try_get_transform("base_link", "odom", rclcpp::Time(0, 0), zero, tf),
+    TransformError::unavailable);
+  const auto statistics = listener.lookup_statistics();
+  EXPECT_EQ(statistics.lookups, 3u);
+  EXPECT_EQ(statistics.unknown_frames, 1u);
+  EXPECT_EQ(statistics.unavailable, 1u);
+  EXPECT_EQ(statistics.failures(), 2u);
+
+  listener.clear_lookup_statistics();
+  EXPECT_EQ(listener.lookup_statistics().lookups, 0u);
+}
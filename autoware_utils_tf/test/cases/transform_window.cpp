@@ -0,0 +1,62 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_tf/transform_window.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+geometry_msgs::msg::Transform make_transform(const double x, const double yaw)
+{
+  geometry_msgs::msg::Transform transform;
+  transform.translation.x = x;
+  transform.rotation.z = std::sin(yaw / 2.0);
+  transform.rotation.w = std::cos(yaw / 2.0);
+  return transform;
+}
+}  // namespace
+
+TEST(TestTransformWindow, Interpolation)
+{
+  autoware_utils_tf::TransformWindow window;
+  EXPECT_TRUE(window.empty());
+  EXPECT_THROW(window.at(int64_t{0}), std::runtime_error);
+
+  window.add(int64_t{100}, make_transform(1.0, 0.0));
+  window.add(int64_t{200}, make_transform(2.0, M_PI / 2.0));
+  window.add(int64_t{400}, make_transform(4.0, M_PI / 2.0));
+  EXPECT_THROW(window.add(int64_t{400}, make_transform(0.0, 0.0)), std::invalid_argument);
+  EXPECT_EQ(window.size(), 3u);
+  EXPECT_EQ(window.start_ns(), 100);
+  EXPECT_EQ(window.end_ns(), 400);
+
+  // lerp and slerp between the samples bracketing the time
+  const auto middle = window.at(int64_t{150});
+  EXPECT_NEAR(middle.translation().x(), 1.5, 1e-9);
+  const Eigen::Quaterniond rotation(middle.linear());
+  EXPECT_NEAR(2.0 * std::atan2(rotation.z(), rotation.w()), M_PI / 4.0, 1e-9);
+  EXPECT_NEAR(window.at(int64_t{300}).translation().x(), 3.0, 1e-9);
+  EXPECT_FLOAT_EQ(window.matrix_at(int64_t{300})(0, 3), 3.0f);
+
+  // the times out of the window are clamped to it
+  EXPECT_NEAR(window.at(int64_t{0}).translation().x(), 1.0, 1e-9);
+  EXPECT_NEAR(window.at(int64_t{500}).translation().x(), 4.0, 1e-9);
+
+  window.clear();
+  EXPECT_TRUE(window.empty());
+}
@@ -20,13 +20,87 @@
 #include <boost/uuid/uuid.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <random>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace autoware_utils_uuid
 {
+namespace detail
+{
+/**
+ * @brief xoshiro256** generator, fast and not cryptographic, seeded with splitmix64.
+ */
+class Xoshiro256
+{
+public:
+  explicit Xoshiro256(uint64_t seed)
+  {
+    for (auto & s : state_) {
+      s = splitmix64(seed);
+    }
+  }
 
+  uint64_t operator()()
+  {
+    const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+    const uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+    return result;
+  }
+
+private:
+  static uint64_t rotl(const uint64_t x, const int k) { return (x << k) | (x >> (64 - k)); }
+
+  static uint64_t splitmix64(uint64_t & x)
+  {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  std::array<uint64_t, 4> state_;
+};
+
+/**
+ * @brief Get the generator of the calling thread, seeded once from std::random_device.
+ */
+inline Xoshiro256 & thread_generator()
+{
+  thread_local Xoshiro256 generator([] {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+  }());
+  return generator;
+}
+
+/**
+ * @brief Fill a UUID with two random words, marked as version 4 and variant RFC 4122.
+ */
+inline void fill_uuid_v4(Xoshiro256 & generator, unique_identifier_msgs::msg::UUID & uuid)
+{
+  const uint64_t words[2] = {generator(), generator()};
+  std::memcpy(uuid.uuid.data(), words, sizeof(words));
+  uuid.uuid[6] = (uuid.uuid[6] & 0x0f) | 0x40;
+  uuid.uuid[8] = (uuid.uuid[8] & 0x3f) | 0x80;
+}
+}  // namespace detail
+
+/**
+ * @brief Generate a random UUID, with a generator seeded for each call from the OS.
+ */
 inline unique_identifier_msgs::msg::UUID generate_uuid()
 {
   // Generate random number
@@ -37,6 +111,35 @@ inline unique_identifier_msgs::msg::UUID generate_uuid()
 
   return uuid;
 }
+
+/**
+ * @brief Generate a random version 4 UUID with the generator of the calling thread, seeded once.
+ *
+ * The generator is fast and not cryptographic, e.g. for the identifiers of the tracked objects.
+ * Use generate_uuid() for the identifiers which must not be predicted.
+ */
+inline unique_identifier_msgs::msg::UUID generate_fast_uuid()
+{
+  unique_identifier_msgs::msg::UUID uuid;
+  detail::fill_uuid_v4(detail::thread_generator(), uuid);
+  return uuid;
+}
+
+/**
+ * @brief Generate random version 4 UUIDs as generate_fast_uuid().
+ *
+ * @param n The number of UUIDs.
+ */
+inline std::vector<unique_identifier_msgs::msg::UUID> generate_uuids(const size_t n)
+{
+  std::vector<unique_identifier_msgs::msg::UUID> uuids(n);
+  auto & generator = detail::thread_generator();
+  for (auto & uuid : uuids) {
+    detail::fill_uuid_v4(generator, uuid);
+  }
+  return uuids;
+}
+
 inline unique_identifier_msgs::msg::UUID generate_default_uuid()
 {
   // Generate UUID with all zeros
@@ -46,13 +149,88 @@ inline unique_identifier_msgs::msg::UUID generate_default_uuid()
 
   return default_uuid;
 }
+/**
+ * @brief Write the 32 lowercase hex digits of a UUID, without a terminating null.
+ */
+inline void to_hex_chars(const unique_identifier_msgs::msg::UUID & id, char (&hex)[32])
+{
+  constexpr char digits[] = "0123456789abcdef";
+  for (size_t i = 0; i < 16; ++i) {
+    hex[2 * i] = digits[id.uuid[i] >> 4];
+    hex[2 * i + 1] = digits[id.uuid[i] & 0x0f];
+  }
+}
+
+/**
+ * @brief Write the hex digits of a UUID into a string, reusing its capacity.
+ */
+inline void to_hex_string(const unique_identifier_msgs::msg::UUID & id, std::string & hex)
+{
+  char chars[32];
+  to_hex_chars(id, chars);
+  hex.assign(chars, sizeof(chars));
+}
+
 inline std::string to_hex_string(const unique_identifier_msgs::msg::UUID & id)
 {
-  std::stringstream ss;
-  for (auto i = 0; i < 16; ++i) {
-    ss << std::hex << std::setfill('0') << std::setw(2) << +id.uuid[i];
+  std::string hex;
+  to_hex_string(id, hex);
+  return hex;
+}
+
+/**
+ * @brief Parse the 32 hex digits of a UUID, in lower or upper case, as written by
+ * to_hex_string().
+ *
+ * @param hex The digits.
+ * @param id The UUID, unchanged if the digits are not valid.
+ * @return true if the digits are valid.
+ */
+inline bool from_hex_string(const std::string_view hex, unique_identifier_msgs::msg::UUID & id)
+{
+  constexpr auto table = [] {
+    std::array<int8_t, 256> values{};
+    for (auto & value : values) {
+      value = -1;
+    }
+    for (int i = 0; i < 10; ++i) {
+      values['0' + i] = static_cast<int8_t>(i);
+    }
+    for (int i = 0; i < 6; ++i) {
+      values['a' + i] = static_cast<int8_t>(10 + i);
+      values['A' + i] = static_cast<int8_t>(10 + i);
+    }
+    return values;
+  }();
+
+  if (hex.size() != 32) {
+    return false;
+  }
+  decltype(id.uuid) bytes;
+  for (size_t i = 0; i < 16; ++i) {
+    const int8_t high = table[static_cast<uint8_t>(hex[2 * i])];
+    const int8_t low = table[static_cast<uint8_t>(hex[2 * i + 1])];
+    if (high < 0 || low < 0) {
+      return false;
+    }
+    bytes[i] = static_cast<uint8_t>((high << 4) | low);
   }
-  return ss.str();
+  id.uuid = bytes;
+  return true;
+}
+
+/**
+ * @brief Parse the 32 hex digits of a UUID.
+ *
+ * @return The UUID, or std::nullopt if the digits are not valid.
+ */
+inline std::optional<unique_identifier_msgs::msg::UUID> from_hex_string(const std::string_view hex)
+{
+  unique_identifier_msgs::msg::UUID id;
+  if (!from_hex_string(hex, id)) {
+    return std::nullopt;
+  }
+  return id;
 }
 
 inline boost::uuids::uuid to_boost_uuid(const unique_identifier_msgs::msg::UUID & id)
@@ -69,6 +247,40 @@ inline unique_identifier_msgs::msg::UUID to_uuid_msg(const boost::uuids::uuid &
   return ros_uuid;
 }
 
+/**
+ * @brief Hash of a UUID, folding its two words without building a string.
+ */
+struct UuidHash
+{
+  size_t operator()(const unique_identifier_msgs::msg::UUID & uuid) const noexcept
+  {
+    uint64_t words[2];
+    std::memcpy(words, uuid.uuid.data(), sizeof(words));
+    return static_cast<size_t>(words[0] ^ (words[1] * 0x9e3779b97f4a7c15ULL));
+  }
+};
+
+/**
+ * @brief Order of the UUIDs by their bytes, e.g. for std::map.
+ */
+struct UuidLess
+{
+  bool operator()(
+    const unique_identifier_msgs::msg::UUID & a,
+    const unique_identifier_msgs::msg::UUID & b) const noexcept
+  {
+    return std::memcmp(a.uuid.data(), b.uuid.data(), a.uuid.size()) < 0;
+  }
+};
+
 }  // namespace autoware_utils_uuid
 
+namespace std
+{
+template <>
+struct hash<unique_identifier_msgs::msg::UUID> : autoware_utils_uuid::UuidHash
+{
+};
+}  // namespace std
+
 #endif  // AUTOWARE_UTILS_UUID__UUID_HELPER_HPP_
@@ -0,0 +1,214 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_UUID__UUID_MAP_HPP_
+#define AUTOWARE_UTILS_UUID__UUID_MAP_HPP_
+
+#include "autoware_utils_uuid/uuid_helper.hpp"
+
+#include <unique_identifier_msgs/msg/uuid.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace autoware_utils_uuid
+{
+/**
+ * @brief Map keyed by UUID, e.g. for the objects of a tracker.
+ *
+ * The entries are stored contiguously, and indexed by an open-addressing hash table with linear
+ * probing, so that a lookup hashes the 16 bytes of the UUID and compares a few of them. The removal
+ * of an entry moves the last entry into its place, and shifts the following slots back, so the
+ * probes stay short without tombstones. The insertions and the removals invalidate the pointers
+ * and the iterators, and do not keep the order of the entries.
+ *
+ * @tparam T The type of values.
+ */
+template <typename T>
+class UuidMap
+{
+public:
+  using key_type = unique_identifier_msgs::msg::UUID;
+  using value_type = std::pair<key_type, T>;
+  using iterator = typename std::vector<value_type>::iterator;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  UuidMap() { rehash(2); }
+
+  /**
+   * @brief Construct a new UuidMap object, allocating the storage of the entries.
+   *
+   * @param capacity The number of entries stored without allocating.
+   */
+  explicit UuidMap(const size_t capacity) : UuidMap() { reserve(capacity); }
+
+  void reserve(const size_t capacity)
+  {
+    entries_.reserve(capacity);
+    if (slots_.size() < 2 * capacity) {
+      rehash(slot_count(capacity));
+    }
+  }
+
+  /**
+   * @brief Get the value of a key.
+   *
+   * @return The value, or nullptr if the key is not in the map.
+   */
+  T * find(const key_type & key)
+  {
+    const size_t entry = slots_[find_slot(key)];
+    return entry == none ? nullptr : &entries_[entry].second;
+  }
+
+  const T * find(const key_type & key) const
+  {
+    const size_t entry = slots_[find_slot(key)];
+    return entry == none ? nullptr : &entries_[entry].second;
+  }
+
+  bool contains(const key_type & key) const { return slots_[find_slot(key)] != none; }
+
+  /**
+   * @brief Insert a value constructed from the arguments if the key is not in the map.
+   *
+   * @return The value of the key, and whether it was inserted.
+   */
+  template <typename... Args>
+  std::pair<T *, bool> try_emplace(const key_type & key, Args &&... args)
+  {
+    size_t slot = find_slot(key);
+    if (slots_[slot] != none) {
+      return {&entries_[slots_[slot]].second, false};
+    }
+    if (slot_count(entries_.size() + 1) > slots_.size()) {
+      rehash(slots_.size() * 2);
+      slot = find_slot(key);
+    }
+    entries_.emplace_back(
+      std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+    slots_[slot] = entries_.size() - 1;
+    return {&entries_.back().second, true};
+  }
+
+  T & operator[](const key_type & key) { return *try_emplace(key).first; }
+
+  /**
+   * @brief Remove a key.
+   *
+   * @return true if the key was in the map.
+   */
+  bool erase(const key_type & key)
+  {
+    const size_t slot = find_slot(key);
+    const size_t entry = slots_[slot];
+    if (entry == none) {
+      return false;
+    }
+    erase_slot(slot);
+    if (entry != entries_.size() - 1) {
+      slots_[find_slot(entries_.back().first)] = entry;
+      entries_[entry] = std::move(entries_.back());
+    }
+    entries_.pop_back();
+    return true;
+  }
+
+  void clear()
+  {
+    entries_.clear();
+    std::fill(slots_.begin(), slots_.end(), none);
+  }
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+
+  iterator begin() { return entries_.begin(); }
+  iterator end() { return entries_.end(); }
+  const_iterator begin() const { return entries_.begin(); }
+  const_iterator end() const { return entries_.end(); }
+
+private:
+  static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+  /// @brief number of slots keeping the load factor at most 1/2
+  static size_t slot_count(const size_t size)
+  {
+    size_t count = 2;
+    while (count < 2 * size) {
+      count *= 2;
+    }
+    return count;
+  }
+
+  size_t home_slot(const key_type & key) const
+  {
+    // Fibonacci hashing spreads the UUIDs which are not random, e.g. from a counter
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>((static_cast<uint64_t>(UuidHash{}(key)) * multiplier) >> shift_);
+  }
+
+  size_t mask() const { return slots_.size() - 1; }
+
+  /// @brief slot of the key, or the empty slot where it would be inserted
+  size_t find_slot(const key_type & key) const
+  {
+    size_t slot = home_slot(key);
+    while (slots_[slot] != none && !(entries_[slots_[slot]].first == key)) {
+      slot = (slot + 1) & mask();
+    }
+    return slot;
+  }
+
+  void erase_slot(size_t slot)
+  {
+    // move back the entries which are after the slot in their probe sequence
+    for (size_t next = (slot + 1) & mask(); slots_[next] != none; next = (next + 1) & mask()) {
+      const size_t home = home_slot(entries_[slots_[next]].first);
+      const bool between = slot <= next ? (slot < home && home <= next)
+                                        : (slot < home || home <= next);
+      if (!between) {
+        slots_[slot] = slots_[next];
+        slot = next;
+      }
+    }
+    slots_[slot] = none;
+  }
+
+  void rehash(const size_t count)
+  {
+    int bits = 0;
+    while ((size_t{1} << bits) < count) {
+      ++bits;
+    }
+    slots_.assign(size_t{1} << bits, none);
+    shift_ = 64 - bits;
+    for (size_t entry = 0; entry < entries_.size(); ++entry) {
+      slots_[find_slot(entries_[entry].first)] = entry;
+    }
+  }
+
+  std::vector<value_type> entries_;  ///< Entries, contiguous for the iteration.
+  std::vector<size_t> slots_;        ///< Entry of each slot of the hash table.
+  int shift_;                        ///< Shift of the hash to the slot index.
+};
+}  // namespace autoware_utils_uuid
+
+#endif  // AUTOWARE_UTILS_UUID__UUID_MAP_HPP_
@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
 #include <string>
 
 TEST(UUIDHelperTest, generate_uuid)
@@ -31,6 +32,33 @@ TEST(UUIDHelperTest, generate_uuid)
                                << autoware_utils_uuid::to_hex_string(uuid2);
 }
 
+TEST(UUIDHelperTest, generate_fast_uuid)
+{
+  const auto uuid1 = autoware_utils_uuid::generate_fast_uuid();
+  const auto uuid2 = autoware_utils_uuid::generate_fast_uuid();
+  EXPECT_FALSE(uuid1 == uuid2) << "Duplicate UUID generated: "
+                               << autoware_utils_uuid::to_hex_string(uuid2);
+
+  // version 4, variant RFC 4122
+  EXPECT_EQ(uuid1.uuid[6] & 0xf0, 0x40);
+  EXPECT_EQ(uuid1.uuid[8] & 0xc0, 0x80);
+}
+
+TEST(UUIDHelperTest, generate_uuids)
+{
+  const auto uuids = autoware_utils_uuid::generate_uuids(1000);
+  ASSERT_EQ(uuids.size(), 1000u);
+
+  std::set<std::string> unique;
+  for (const auto & uuid : uuids) {
+    EXPECT_EQ(uuid.uuid[6] & 0xf0, 0x40);
+    EXPECT_EQ(uuid.uuid[8] & 0xc0, 0x80);
+    unique.insert(autoware_utils_uuid::to_hex_string(uuid));
+  }
+  EXPECT_EQ(unique.size(), uuids.size());
+  EXPECT_TRUE(autoware_utils_uuid::generate_uuids(0).empty());
+}
+
 TEST(UUIDHelperTest, generate_default_uuid)
 {
   // Generate two UUIDs and ensure they are all different
@@ -54,6 +82,27 @@ TEST(UUIDHelperTest, to_hex_string)
   EXPECT_EQ(hex_string, "42424242424242424242424242424242");
 }
 
+TEST(UUIDHelperTest, hex_round_trip)
+{
+  const auto uuid = autoware_utils_uuid::generate_fast_uuid();
+  char chars[32];
+  autoware_utils_uuid::to_hex_chars(uuid, chars);
+  std::string hex;
+  autoware_utils_uuid::to_hex_string(uuid, hex);
+  EXPECT_EQ(hex, std::string(chars, 32));
+  EXPECT_EQ(autoware_utils_uuid::from_hex_string(hex), uuid);
+
+  unique_identifier_msgs::msg::UUID parsed;
+  ASSERT_TRUE(autoware_utils_uuid::from_hex_string("00112233445566778899AABBCCDDEEFF", parsed));
+  EXPECT_EQ(autoware_utils_uuid::to_hex_string(parsed), "00112233445566778899aabbccddeeff");
+
+  // the invalid digits leave the UUID unchanged
+  EXPECT_FALSE(autoware_utils_uuid::from_hex_string("0011", parsed));
+  EXPECT_FALSE(autoware_utils_uuid::from_hex_string("g0112233445566778899aabbccddeeff", parsed));
+  EXPECT_EQ(parsed.uuid[15], 0xff);
+  EXPECT_FALSE(autoware_utils_uuid::from_hex_string(std::string(32, '-')));
+}
+
 TEST(UUIDHelperTest, to_boost_uuid)
 {
   unique_identifier_msgs::msg::UUID uuid;
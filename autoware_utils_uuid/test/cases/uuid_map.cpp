@@ -0,0 +1,107 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_uuid/uuid_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+unique_identifier_msgs::msg::UUID make_uuid(const uint8_t value)
+{
+  unique_identifier_msgs::msg::UUID uuid;
+  std::fill(uuid.uuid.begin(), uuid.uuid.end(), 0);
+  uuid.uuid[15] = value;
+  return uuid;
+}
+}  // namespace
+
+TEST(UUIDMapTest, hash_and_order)
+{
+  const auto a = make_uuid(1);
+  const auto b = make_uuid(2);
+  EXPECT_EQ(std::hash<unique_identifier_msgs::msg::UUID>{}(a), autoware_utils_uuid::UuidHash{}(a));
+  EXPECT_NE(autoware_utils_uuid::UuidHash{}(a), autoware_utils_uuid::UuidHash{}(b));
+  EXPECT_TRUE(autoware_utils_uuid::UuidLess{}(a, b));
+  EXPECT_FALSE(autoware_utils_uuid::UuidLess{}(b, a));
+  EXPECT_FALSE(autoware_utils_uuid::UuidLess{}(a, a));
+
+  std::unordered_map<unique_identifier_msgs::msg::UUID, int> hashed{{a, 1}, {b, 2}};
+  std::map<unique_identifier_msgs::msg::UUID, int, autoware_utils_uuid::UuidLess> ordered{
+    {b, 2}, {a, 1}};
+  EXPECT_EQ(hashed.at(b), 2);
+  EXPECT_EQ(ordered.begin()->second, 1);
+}
+
+TEST(UUIDMapTest, insert_and_erase)
+{
+  autoware_utils_uuid::UuidMap<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(make_uuid(1)), nullptr);
+
+  EXPECT_TRUE(map.try_emplace(make_uuid(1), 10).second);
+  EXPECT_FALSE(map.try_emplace(make_uuid(1), 20).second);
+  map[make_uuid(2)] = 30;
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(*map.find(make_uuid(1)), 10);
+  EXPECT_TRUE(map.contains(make_uuid(2)));
+
+  EXPECT_TRUE(map.erase(make_uuid(1)));
+  EXPECT_FALSE(map.erase(make_uuid(1)));
+  EXPECT_EQ(map.size(), 1u);
+  EXPECT_EQ(map.begin()->second, 30);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(make_uuid(2)));
+}
+
+TEST(UUIDMapTest, random_operations)
+{
+  // the map matches std::unordered_map over random insertions and removals, which grow the table
+  // and shift the probe sequences back
+  autoware_utils_uuid::UuidMap<int> map(4);
+  std::unordered_map<std::string, int> expected;
+  std::mt19937 random(0);
+  std::vector<unique_identifier_msgs::msg::UUID> keys;
+  for (int i = 0; i < 64; ++i) {
+    keys.push_back(autoware_utils_uuid::generate_fast_uuid());
+  }
+  for (int i = 0; i < 5000; ++i) {
+    const auto & key = keys[random() % keys.size()];
+    const auto hex = autoware_utils_uuid::to_hex_string(key);
+    if (random() % 3 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(hex) == 1);
+    } else {
+      map[key] = i;
+      expected[hex] = i;
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  for (const auto & [key, value] : map) {
+    EXPECT_EQ(value, expected.at(autoware_utils_uuid::to_hex_string(key)));
+  }
+  for (const auto & key : keys) {
+    const auto * value = map.find(key);
+    EXPECT_EQ(value != nullptr, expected.count(autoware_utils_uuid::to_hex_string(key)) == 1);
+  }
+}
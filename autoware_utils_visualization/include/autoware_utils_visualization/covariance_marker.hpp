@@ -0,0 +1,96 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE_UTILS_VISUALIZATION__COVARIANCE_MARKER_HPP_
+#define AUTOWARE_UTILS_VISUALIZATION__COVARIANCE_MARKER_HPP_
+
+#include <autoware_utils_geometry/msg/covariance_ops.hpp>
+
+#include <autoware_perception_msgs/msg/detected_objects.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/tracked_objects.hpp>
+#include <visualization_msgs/msg/marker.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware_utils_visualization
+{
+/**
+ * @brief Draws the uncertainty of the poses of all the objects of an array in one LINE_LIST
+ * marker, e.g. created by create_default_marker, keeping the storage between calls.
+ *
+ * The ellipses come from the closed-form eigen solution of the x-y block of each covariance, as
+ * autoware_utils_geometry::calc_position_ellipses, and the sines and cosines from the lookup table
+ * of autoware_utils_math, those of the unit circle once in the constructor. The points are at the
+ * height of the objects.
+ */
+class CovarianceMarkerConverter
+{
+public:
+  /**
+   * @param segments Number of segments of each ellipse
+   * @throw std::invalid_argument if there are less than 3 segments
+   */
+  explicit CovarianceMarkerConverter(size_t segments = 32);
+
+  /**
+   * @brief Append the ellipses of the position covariances of the objects to a LINE_LIST marker.
+   *
+   * @param sigma Scale of the 1-sigma ellipses, e.g. 2 for the 2-sigma ellipses.
+   * @param marker The marker, whose points are reserved once.
+   */
+  void append_position_ellipses(
+    const autoware_perception_msgs::msg::DetectedObjects & objects, double sigma,
+    visualization_msgs::msg::Marker & marker);
+  void append_position_ellipses(
+    const autoware_perception_msgs::msg::TrackedObjects & objects, double sigma,
+    visualization_msgs::msg::Marker & marker);
+  void append_position_ellipses(
+    const autoware_perception_msgs::msg::PredictedObjects & objects, double sigma,
+    visualization_msgs::msg::Marker & marker);
+
+  /**
+   * @brief Append the yaw uncertainty of the objects to a LINE_LIST marker, as two lines from the
+   * position of each object at its yaw plus and minus sigma standard deviations.
+   *
+   * @param sigma Scale of the standard deviation of the yaw.
+   * @param length Length of the lines.
+   * @param marker The marker, whose points are reserved once.
+   */
+  void append_yaw_uncertainties(
+    const autoware_perception_msgs::msg::DetectedObjects & objects, double sigma, double length,
+    visualization_msgs::msg::Marker & marker);
+  void append_yaw_uncertainties(
+    const autoware_perception_msgs::msg::TrackedObjects & objects, double sigma, double length,
+    visualization_msgs::msg::Marker & marker);
+  void append_yaw_uncertainties(
+    const autoware_perception_msgs::msg::PredictedObjects & objects, double sigma, double length,
+    visualization_msgs::msg::Marker & marker);
+
+  size_t segments() const { return unit_cos_.size(); }
+
+private:
+  template <class Objects, class GetPose>
+  void append_ellipses(
+    const Objects & objects, double sigma, const GetPose & get_pose,
+    visualization_msgs::msg::Marker & marker);
+
+  std::vector<float> unit_cos_;  //!< Cosines of the angles of the points of the unit circle
+  std::vector<float> unit_sin_;  //!< Sines of the angles of the points of the unit circle
+  std::vector<autoware_utils_geometry::CovarianceEllipse2d> ellipses_;
+};
+
+}  // namespace autoware_utils_visualization
+
+#endif  // AUTOWARE_UTILS_VISUALIZATION__COVARIANCE_MARKER_HPP_
@@ -0,0 +1,166 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_VISUALIZATION__GEOMETRY_MARKER_HPP_
+#define AUTOWARE_UTILS_VISUALIZATION__GEOMETRY_MARKER_HPP_
+
+#include "autoware_utils_visualization/marker_helper.hpp"
+
+#include <autoware_utils_geometry/alt_geometry.hpp>
+#include <autoware_utils_geometry/boost_geometry.hpp>
+#include <autoware_utils_geometry/ear_clipping.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <visualization_msgs/msg/marker.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace autoware_utils_visualization
+{
+/**
+ * @brief Append the points of a line or a closed ring to a LINE_STRIP marker.
+ *
+ * @param points The points with x() and y(), e.g. a ring of a polygon.
+ * @param z The height of the points.
+ * @param marker The marker, whose points are reserved once.
+ */
+template <class Points>
+void append_line_strip(
+  const Points & points, const double z, visualization_msgs::msg::Marker & marker)
+{
+  marker.points.reserve(marker.points.size() + std::size(points));
+  for (const auto & point : points) {
+    marker.points.push_back(create_marker_position(point.x(), point.y(), z));
+  }
+}
+
+/**
+ * @brief Append the segments of a line or a closed ring to a LINE_LIST marker, e.g. to draw many
+ * polygons with one marker.
+ *
+ * @param points The points with x() and y(), e.g. a ring of a polygon.
+ * @param z The height of the points.
+ * @param marker The marker, whose points are reserved once.
+ */
+template <class Points>
+void append_line_list(
+  const Points & points, const double z, visualization_msgs::msg::Marker & marker)
+{
+  const size_t size = std::size(points);
+  if (size < 2) {
+    return;
+  }
+  marker.points.reserve(marker.points.size() + 2 * (size - 1));
+  auto prev = std::begin(points);
+  for (auto it = std::next(prev); it != std::end(points); prev = it++) {
+    marker.points.push_back(create_marker_position(prev->x(), prev->y(), z));
+    marker.points.push_back(create_marker_position(it->x(), it->y(), z));
+  }
+}
+
+/**
+ * @brief Append the edges of the rings of a polygon, Boost.Geometry or alt, to a LINE_LIST marker.
+ */
+template <class Polygon>
+void append_polygon_lines(
+  const Polygon & polygon, const double z, visualization_msgs::msg::Marker & marker)
+{
+  append_line_list(polygon.outer(), z, marker);
+  for (const auto & inner : polygon.inners()) {
+    append_line_list(inner, z, marker);
+  }
+}
+
+/**
+ * @brief Append the positions of the points of a path or a trajectory to a LINE_STRIP marker.
+ *
+ * @param points The points accepted by autoware_utils_geometry::get_point, e.g. TrajectoryPoint.
+ * @param marker The marker, whose points are reserved once.
+ */
+template <class T>
+void append_path(const std::vector<T> & points, visualization_msgs::msg::Marker & marker)
+{
+  marker.points.reserve(marker.points.size() + points.size());
+  for (const auto & point : points) {
+    marker.points.push_back(autoware_utils_geometry::get_point_view(point));
+  }
+}
+
+/**
+ * @brief Converts the geometries which need scratch storage to the points of markers, keeping the
+ * storage between calls. Use one instance for the markers of a cycle.
+ */
+class GeometryMarkerConverter
+{
+public:
+  /**
+   * @brief Append the triangles of a polygon, with or without holes, to a TRIANGLE_LIST marker.
+   */
+  void append_triangle_list(
+    const autoware_utils_geometry::alt::Polygon2d & polygon, double z,
+    visualization_msgs::msg::Marker & marker);
+
+  /// @brief Boost.Geometry version, which converts the polygon first.
+  void append_triangle_list(
+    const autoware_utils_geometry::Polygon2d & polygon, double z,
+    visualization_msgs::msg::Marker & marker);
+
+  /**
+   * @brief Append a line decimated by the Douglas-Peucker algorithm to a LINE_STRIP marker.
+   *
+   * @param max_distance The largest distance of the removed points to the simplified line.
+   */
+  void append_simplified_line_strip(
+    const autoware_utils_geometry::alt::PointList2d & line, double z, double max_distance,
+    visualization_msgs::msg::Marker & marker);
+
+  /**
+   * @brief Append the positions of a path decimated in 2D by the Douglas-Peucker algorithm to a
+   * LINE_STRIP marker.
+   *
+   * @param max_distance The largest distance of the removed points to the simplified path.
+   */
+  template <class T>
+  void append_simplified_path(
+    const std::vector<T> & points, const double max_distance,
+    visualization_msgs::msg::Marker & marker)
+  {
+    points_.clear();
+    points_.reserve(points.size());
+    for (const auto & point : points) {
+      const auto & position = autoware_utils_geometry::get_point_view(point);
+      points_.emplace_back(position.x, position.y);
+    }
+    simplify(max_distance);
+    marker.points.reserve(marker.points.size() + kept_.size());
+    for (const auto index : kept_) {
+      marker.points.push_back(autoware_utils_geometry::get_point_view(points[index]));
+    }
+  }
+
+private:
+  /// @brief the indices of the points kept by the Douglas-Peucker algorithm
+  void simplify(double max_distance);
+
+  autoware_utils_geometry::Triangulator triangulator_;
+  autoware_utils_geometry::SimplifyBuffer simplify_buffer_;
+  std::vector<autoware_utils_geometry::alt::Point2d> points_;
+  std::vector<size_t> kept_;
+};
+
+}  // namespace autoware_utils_visualization
+
+#endif  // AUTOWARE_UTILS_VISUALIZATION__GEOMETRY_MARKER_HPP_
@@ -0,0 +1,98 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_VISUALIZATION__MARKER_ARRAY_BUILDER_HPP_
+#define AUTOWARE_UTILS_VISUALIZATION__MARKER_ARRAY_BUILDER_HPP_
+
+#include <rclcpp/time.hpp>
+
+#include <builtin_interfaces/msg/time.hpp>
+#include <visualization_msgs/msg/marker_array.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware_utils_visualization
+{
+/**
+ * @brief Builds the markers of each cycle in reused storage, and emits only the markers which are
+ * new or changed since the last cycle, and the deletions of the markers which are gone.
+ *
+ * The ids are assigned per namespace in the order of the markers added in a cycle. As the markers
+ * which do not change are not published again, they must not expire, i.e. their lifetime is zero,
+ * and a subscriber connecting later receives them after invalidate().
+ */
+class MarkerArrayBuilder
+{
+public:
+  explicit MarkerArrayBuilder(std::string frame_id);
+
+  /**
+   * @brief Start a cycle, with no markers.
+   *
+   * @param stamp The stamp of the markers emitted for the cycle.
+   */
+  void begin(const rclcpp::Time & stamp);
+
+  /**
+   * @brief Add a marker to the cycle.
+   *
+   * The marker has the frame, the namespace and the next id of the namespace, the action ADD and an
+   * identity pose, and the other fields are default. Its points, colors and text keep the capacity
+   * of the marker with the same id in the last cycle.
+   *
+   * @param ns The namespace of the marker.
+   * @return The marker, valid until the next call.
+   */
+  visualization_msgs::msg::Marker & add(const std::string & ns);
+
+  /**
+   * @brief Build the changes of the cycle, and store its markers as the published ones.
+   *
+   * @return The new or changed markers, and the deletions of the markers of the last cycle which
+   * are not in this cycle, empty if nothing changed. The array is valid until the next call.
+   */
+  const visualization_msgs::msg::MarkerArray & build();
+
+  /**
+   * @brief Emit all the markers of the next cycle, e.g. when a subscriber connects.
+   */
+  void invalidate() { full_ = true; }
+
+  /**
+   * @brief Get the number of markers of the cycle.
+   */
+  size_t size() const;
+
+private:
+  struct Namespace
+  {
+    std::vector<visualization_msgs::msg::Marker> markers;    ///< Markers, reused across cycles.
+    size_t count{0};                                         ///< Number of markers of the cycle.
+    std::vector<visualization_msgs::msg::Marker> published;  ///< Markers of the last build.
+  };
+
+  std::string frame_id_;
+  builtin_interfaces::msg::Time stamp_;
+  std::map<std::string, Namespace, std::less<>> namespaces_;
+  visualization_msgs::msg::MarkerArray array_;
+  bool full_{false};
+};
+
+}  // namespace autoware_utils_visualization
+
+#endif  // AUTOWARE_UTILS_VISUALIZATION__MARKER_ARRAY_BUILDER_HPP_
@@ -80,6 +80,15 @@ void append_marker_array(
   visualization_msgs::msg::MarkerArray * marker_array,
   const std::optional<rclcpp::Time> & current_time = {});
 
+/**
+ * @brief Move the markers of an array to the end of another, with their points and colors, and
+ * stamp them with the current time if given.
+ */
+void append_marker_array(
+  visualization_msgs::msg::MarkerArray && additional_marker_array,
+  visualization_msgs::msg::MarkerArray * marker_array,
+  const std::optional<rclcpp::Time> & current_time = {});
+
 }  // namespace autoware_utils_visualization
 
 #endif  // AUTOWARE_UTILS_VISUALIZATION__MARKER_HELPER_HPP_
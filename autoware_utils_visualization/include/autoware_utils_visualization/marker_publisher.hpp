@@ -0,0 +1,161 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_UTILS_VISUALIZATION__MARKER_PUBLISHER_HPP_
+#define AUTOWARE_UTILS_VISUALIZATION__MARKER_PUBLISHER_HPP_
+
+#include "autoware_utils_visualization/marker_array_builder.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <visualization_msgs/msg/marker_array.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace autoware_utils_visualization
+{
+/**
+ * @brief Publishes marker arrays only when the topic has subscribers and at most at a rate, and
+ * builds them only then, so that the markers cost nothing when nobody watches them.
+ */
+class MarkerPublisher
+{
+public:
+  /**
+   * @brief Construct a new MarkerPublisher object.
+   *
+   * @param node The node of the publisher and the clock of the rate.
+   * @param topic The topic of the marker arrays.
+   * @param max_rate The highest rate of the publications in Hz, or 0 for no limit.
+   * @param qos The QoS of the publisher.
+   * @throw std::invalid_argument If the rate is negative.
+   */
+  MarkerPublisher(
+    rclcpp::Node * node, const std::string & topic, const double max_rate = 0.0,
+    const rclcpp::QoS & qos = rclcpp::QoS(1))
+  : clock_(node->get_clock()),
+    publisher_(node->create_publisher<visualization_msgs::msg::MarkerArray>(topic, qos)),
+    period_(rclcpp::Duration::from_seconds(0.0))
+  {
+    if (max_rate < 0.0) {
+      throw std::invalid_argument("The rate of the markers is negative.");
+    }
+    if (0.0 < max_rate) {
+      period_ = rclcpp::Duration::from_seconds(1.0 / max_rate);
+    }
+  }
+
+  /**
+   * @brief Check whether the topic has subscribers, in other processes or in this one.
+   */
+  bool has_subscribers() const
+  {
+    return subscriber_count() > 0;
+  }
+
+  /**
+   * @brief Check whether a marker array would be published now, i.e. the topic has subscribers and
+   * the period of the rate has elapsed since the last publication.
+   */
+  bool is_due() const
+  {
+    if (!has_subscribers()) {
+      return false;
+    }
+    if (!last_publish_time_) {
+      return true;
+    }
+    const auto now = clock_->now();
+    // the time may jump back, e.g. when a rosbag loops
+    return now < *last_publish_time_ || period_ <= now - *last_publish_time_;
+  }
+
+  /**
+   * @brief Build and publish a marker array if it is due.
+   *
+   * @param build Callable filling the markers, given as visualization_msgs::msg::MarkerArray &,
+   * which is cleared first and reuses the storage of the last array.
+   * @return Whether the markers were built and published.
+   */
+  template <class Builder>
+  bool publish(Builder && build)
+  {
+    if (!is_due()) {
+      return false;
+    }
+    msg_.markers.clear();
+    std::forward<Builder>(build)(msg_);
+    publisher_->publish(msg_);
+    last_publish_time_ = clock_->now();
+    return true;
+  }
+
+  /**
+   * @brief Build the markers of a cycle with a MarkerArrayBuilder and publish their changes, if it
+   * is due and they changed. All the markers are published again for a new subscriber.
+   *
+   * @param builder The builder, started at the current time.
+   * @param fill Callable adding the markers, given as MarkerArrayBuilder &.
+   * @return Whether the markers were built.
+   */
+  template <class Fill>
+  bool publish(MarkerArrayBuilder & builder, Fill && fill)
+  {
+    if (!is_due()) {
+      return false;
+    }
+    const size_t subscribers = subscriber_count();
+    if (last_subscriber_count_ < subscribers) {
+      builder.invalidate();
+    }
+    last_subscriber_count_ = subscribers;
+
+    const auto now = clock_->now();
+    builder.begin(now);
+    std::forward<Fill>(fill)(builder);
+    const auto & changes = builder.build();
+    if (!changes.markers.empty()) {
+      publisher_->publish(changes);
+    }
+    last_publish_time_ = now;
+    return true;
+  }
+
+  rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr get_publisher() const
+  {
+    return publisher_;
+  }
+
+private:
+  size_t subscriber_count() const
+  {
+    return publisher_->get_subscription_count() +
+           publisher_->get_intra_process_subscription_count();
+  }
+
+  rclcpp::Clock::SharedPtr clock_;
+  rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr publisher_;
+  rclcpp::Duration period_;                         ///< Shortest period of the publications.
+  std::optional<rclcpp::Time> last_publish_time_;   ///< Time of the last publication.
+  size_t last_subscriber_count_{0};                 ///< Subscribers at the last build.
+  visualization_msgs::msg::MarkerArray msg_;        ///< Array reused across the publications.
+};
+
+}  // namespace autoware_utils_visualization
+
+#endif  // AUTOWARE_UTILS_VISUALIZATION__MARKER_PUBLISHER_HPP_
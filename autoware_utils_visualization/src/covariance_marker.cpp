@@ -0,0 +1,155 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_visualization/covariance_marker.hpp"
+
+#include "autoware_utils_visualization/marker_helper.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+#include <autoware_utils_geometry/msg/covariance.hpp>
+#include <autoware_utils_math/constants.hpp>
+#include <autoware_utils_math/trigonometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware_utils_visualization
+{
+namespace
+{
+template <class Objects, class GetPose>
+void append_yaw_lines(
+  const Objects & objects, const double sigma, const double length, const GetPose & get_pose,
+  visualization_msgs::msg::Marker & marker)
+{
+  using autoware_utils_geometry::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  marker.points.reserve(marker.points.size() + 4 * objects.objects.size());
+  for (const auto & object : objects.objects) {
+    const auto & pose_with_covariance = get_pose(object);
+    const auto & position = pose_with_covariance.pose.position;
+    const double yaw = autoware_utils_geometry::get_yaw(
+      pose_with_covariance.pose.orientation, autoware_utils_geometry::TrigonometryMode::fast);
+    const double deviation =
+      sigma * std::sqrt(std::max(0.0, pose_with_covariance.covariance[XYZRPY_COV_IDX::YAW_YAW]));
+    for (const double angle : {yaw - deviation, yaw + deviation}) {
+      const auto [sin_angle, cos_angle] =
+        autoware_utils_math::sin_and_cos(static_cast<float>(angle));
+      marker.points.push_back(position);
+      marker.points.push_back(create_marker_position(
+        position.x + length * cos_angle, position.y + length * sin_angle, position.z));
+    }
+  }
+}
+
+constexpr auto detected_pose = [](const auto & object) -> const auto & {
+  return object.kinematics.pose_with_covariance;
+};
+
+constexpr auto predicted_pose = [](const auto & object) -> const auto & {
+  return object.kinematics.initial_pose_with_covariance;
+};
+}  // namespace
+
+CovarianceMarkerConverter::CovarianceMarkerConverter(const size_t segments)
+{
+  if (segments < 3) {
+    throw std::invalid_argument("An ellipse needs at least 3 segments.");
+  }
+  std::vector<float> angles(segments);
+  for (size_t i = 0; i < segments; ++i) {
+    angles[i] = static_cast<float>(2.0 * autoware_utils_math::pi * i / segments);
+  }
+  unit_sin_.resize(segments);
+  unit_cos_.resize(segments);
+  autoware_utils_math::sin_and_cos(angles.data(), segments, unit_sin_.data(), unit_cos_.data());
+}
+
+template <class Objects, class GetPose>
+void CovarianceMarkerConverter::append_ellipses(
+  const Objects & objects, const double sigma, const GetPose & get_pose,
+  visualization_msgs::msg::Marker & marker)
+{
+  autoware_utils_geometry::calc_position_ellipses(objects, ellipses_);
+  const size_t segments = unit_cos_.size();
+  marker.points.reserve(marker.points.size() + 2 * segments * objects.objects.size());
+  for (size_t i = 0; i < objects.objects.size(); ++i) {
+    const auto & center = get_pose(objects.objects[i]).pose.position;
+    const auto & ellipse = ellipses_[i];
+    const auto [sin_yaw, cos_yaw] =
+      autoware_utils_math::sin_and_cos(static_cast<float>(ellipse.yaw));
+    // the axes of the ellipse, scaled by its semi-axes
+    const double major_x = sigma * ellipse.semi_major * cos_yaw;
+    const double major_y = sigma * ellipse.semi_major * sin_yaw;
+    const double minor_x = -sigma * ellipse.semi_minor * sin_yaw;
+    const double minor_y = sigma * ellipse.semi_minor * cos_yaw;
+    const auto point = [&](const size_t k) {
+      return create_marker_position(
+        center.x + major_x * unit_cos_[k] + minor_x * unit_sin_[k],
+        center.y + major_y * unit_cos_[k] + minor_y * unit_sin_[k], center.z);
+    };
+    auto prev = point(0);
+    for (size_t k = 1; k <= segments; ++k) {
+      const auto next = point(k % segments);
+      marker.points.push_back(prev);
+      marker.points.push_back(next);
+      prev = next;
+    }
+  }
+}
+
+void CovarianceMarkerConverter::append_position_ellipses(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, const double sigma,
+  visualization_msgs::msg::Marker & marker)
+{
+  append_ellipses(objects, sigma, detected_pose, marker);
+}
+
+void CovarianceMarkerConverter::append_position_ellipses(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, const double sigma,
+  visualization_msgs::msg::Marker & marker)
+{
+  append_ellipses(objects, sigma, detected_pose, marker);
+}
+
+void CovarianceMarkerConverter::append_position_ellipses(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, const double sigma,
+  visualization_msgs::msg::Marker & marker)
+{
+  append_ellipses(objects, sigma, predicted_pose, marker);
+}
+
+void CovarianceMarkerConverter::append_yaw_uncertainties(
+  const autoware_perception_msgs::msg::DetectedObjects & objects, const double sigma,
+  const double length, visualization_msgs::msg::Marker & marker)
+{
+  append_yaw_lines(objects, sigma, length, detected_pose, marker);
+}
+
+void CovarianceMarkerConverter::append_yaw_uncertainties(
+  const autoware_perception_msgs::msg::TrackedObjects & objects, const double sigma,
+  const double length, visualization_msgs::msg::Marker & marker)
+{
+  append_yaw_lines(objects, sigma, length, detected_pose, marker);
+}
+
+void CovarianceMarkerConverter::append_yaw_uncertainties(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, const double sigma,
+  const double length, visualization_msgs::msg::Marker & marker)
+{
+  append_yaw_lines(objects, sigma, length, predicted_pose, marker);
+}
+
+}  // namespace autoware_utils_visualization
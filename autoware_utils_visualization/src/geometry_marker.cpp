@@ -0,0 +1,61 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_visualization/geometry_marker.hpp"
+
+#include <vector>
+
+namespace autoware_utils_visualization
+{
+void GeometryMarkerConverter::append_triangle_list(
+  const autoware_utils_geometry::alt::Polygon2d & polygon, const double z,
+  visualization_msgs::msg::Marker & marker)
+{
+  const auto & indices = triangulator_.triangulate(polygon);
+  const auto & points = triangulator_.points();
+  marker.points.reserve(marker.points.size() + indices.size());
+  for (const auto index : indices) {
+    marker.points.push_back(create_marker_position(points[index].x(), points[index].y(), z));
+  }
+}
+
+void GeometryMarkerConverter::append_triangle_list(
+  const autoware_utils_geometry::Polygon2d & polygon, const double z,
+  visualization_msgs::msg::Marker & marker)
+{
+  const auto alt_polygon = autoware_utils_geometry::alt::Polygon2d::create(polygon);
+  if (alt_polygon) {
+    append_triangle_list(*alt_polygon, z, marker);
+  }
+}
+
+void GeometryMarkerConverter::append_simplified_line_strip(
+  const autoware_utils_geometry::alt::PointList2d & line, const double z, const double max_distance,
+  visualization_msgs::msg::Marker & marker)
+{
+  autoware_utils_geometry::simplify_douglas_peucker(
+    line.data(), line.size(), max_distance, kept_, simplify_buffer_);
+  marker.points.reserve(marker.points.size() + kept_.size());
+  for (const auto index : kept_) {
+    marker.points.push_back(create_marker_position(line[index].x(), line[index].y(), z));
+  }
+}
+
+void GeometryMarkerConverter::simplify(const double max_distance)
+{
+  autoware_utils_geometry::simplify_douglas_peucker(
+    points_.data(), points_.size(), max_distance, kept_, simplify_buffer_);
+}
+
+}  // namespace autoware_utils_visualization
@@ -0,0 +1,112 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_visualization/marker_array_builder.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace autoware_utils_visualization
+{
+MarkerArrayBuilder::MarkerArrayBuilder(std::string frame_id) : frame_id_(std::move(frame_id))
+{
+}
+
+void MarkerArrayBuilder::begin(const rclcpp::Time & stamp)
+{
+  stamp_ = stamp;
+  for (auto & [ns, space] : namespaces_) {
+    space.count = 0;
+  }
+}
+
+visualization_msgs::msg::Marker & MarkerArrayBuilder::add(const std::string & ns)
+{
+  auto it = namespaces_.find(ns);
+  if (it == namespaces_.end()) {
+    it = namespaces_.emplace(ns, Namespace{}).first;
+  }
+  auto & space = it->second;
+  if (space.count == space.markers.size()) {
+    space.markers.emplace_back();
+  }
+  auto & marker = space.markers[space.count];
+
+  // reset the marker, keeping the capacity of its arrays
+  auto points = std::move(marker.points);
+  auto colors = std::move(marker.colors);
+  auto text = std::move(marker.text);
+  points.clear();
+  colors.clear();
+  text.clear();
+  marker = visualization_msgs::msg::Marker();
+  marker.points = std::move(points);
+  marker.colors = std::move(colors);
+  marker.text = std::move(text);
+
+  marker.header.frame_id = frame_id_;
+  marker.ns = ns;
+  marker.id = static_cast<int32_t>(space.count);
+  marker.action = visualization_msgs::msg::Marker::ADD;
+  marker.pose.orientation.w = 1.0;
+  ++space.count;
+  return marker;
+}
+
+const visualization_msgs::msg::MarkerArray & MarkerArrayBuilder::build()
+{
+  array_.markers.clear();
+  for (auto & [ns, space] : namespaces_) {
+    for (size_t i = 0; i < space.count; ++i) {
+      auto & marker = space.markers[i];
+      if (i < space.published.size()) {
+        // the markers are compared without their stamps, which change every cycle
+        marker.header.stamp = space.published[i].header.stamp;
+        if (!full_ && marker == space.published[i]) {
+          continue;
+        }
+      }
+      marker.header.stamp = stamp_;
+      array_.markers.push_back(marker);
+      if (i < space.published.size()) {
+        space.published[i] = marker;
+      } else {
+        space.published.push_back(marker);
+      }
+    }
+    for (size_t i = space.count; i < space.published.size(); ++i) {
+      auto & deleted = array_.markers.emplace_back();
+      deleted.header.frame_id = frame_id_;
+      deleted.header.stamp = stamp_;
+      deleted.ns = ns;
+      deleted.id = static_cast<int32_t>(i);
+      deleted.action = visualization_msgs::msg::Marker::DELETE;
+    }
+    space.published.resize(space.count);
+  }
+  full_ = false;
+  return array_;
+}
+
+size_t MarkerArrayBuilder::size() const
+{
+  size_t size = 0;
+  for (const auto & [ns, space] : namespaces_) {
+    size += space.count;
+  }
+  return size;
+}
+
+}  // namespace autoware_utils_visualization
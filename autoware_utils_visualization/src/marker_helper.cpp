@@ -14,10 +14,25 @@
 
 #include "autoware_utils_visualization/marker_helper.hpp"
 
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace autoware_utils_visualization
 {
+namespace
+{
+/// @brief reserve the markers appended at once, keeping the geometric growth of repeated appends
+void reserve_for_append(std::vector<visualization_msgs::msg::Marker> & markers, const size_t count)
+{
+  const size_t size = markers.size() + count;
+  if (markers.capacity() < size) {
+    markers.reserve(std::max(size, 2 * markers.capacity()));
+  }
+}
+}  // namespace
+
 visualization_msgs::msg::Marker create_default_marker(
   const std::string & frame_id, const rclcpp::Time & now, const std::string & ns, const int32_t id,
   const int32_t type, const geometry_msgs::msg::Vector3 & scale,
@@ -60,6 +75,7 @@ void append_marker_array(
   visualization_msgs::msg::MarkerArray * marker_array,
   const std::optional<rclcpp::Time> & current_time)
 {
+  reserve_for_append(marker_array->markers, additional_marker_array.markers.size());
   for (const auto & marker : additional_marker_array.markers) {
     marker_array->markers.push_back(marker);
 
@@ -69,4 +85,25 @@ void append_marker_array(
   }
 }
 
+void append_marker_array(
+  visualization_msgs::msg::MarkerArray && additional_marker_array,
+  visualization_msgs::msg::MarkerArray * marker_array,
+  const std::optional<rclcpp::Time> & current_time)
+{
+  auto & markers = marker_array->markers;
+  if (markers.empty() && !current_time) {
+    markers = std::move(additional_marker_array.markers);
+    return;
+  }
+
+  reserve_for_append(markers, additional_marker_array.markers.size());
+  for (auto & marker : additional_marker_array.markers) {
+    if (current_time) {
+      marker.header.stamp = current_time.value();
+    }
+    markers.push_back(std::move(marker));
+  }
+  additional_marker_array.markers.clear();
+}
+
 }  // namespace autoware_utils_visualization
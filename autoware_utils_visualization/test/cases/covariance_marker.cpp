@@ -0,0 +1,104 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware_utils_visualization/covariance_marker.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+#include <autoware_utils_geometry/msg/covariance.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+using autoware_utils_geometry::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+// the error of the sines and cosines of the lookup table
+constexpr double epsilon = 1e-2;
+
+autoware_perception_msgs::msg::DetectedObject make_object(
+  const double x, const double y, const double xx, const double xy, const double yy)
+{
+  autoware_perception_msgs::msg::DetectedObject object;
+  auto & pose_with_covariance = object.kinematics.pose_with_covariance;
+  pose_with_covariance.pose.position.x = x;
+  pose_with_covariance.pose.position.y = y;
+  pose_with_covariance.pose.position.z = 1.0;
+  pose_with_covariance.pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(0.0);
+  pose_with_covariance.covariance[XYZRPY_COV_IDX::X_X] = xx;
+  pose_with_covariance.covariance[XYZRPY_COV_IDX::X_Y] = xy;
+  pose_with_covariance.covariance[XYZRPY_COV_IDX::Y_X] = xy;
+  pose_with_covariance.covariance[XYZRPY_COV_IDX::Y_Y] = yy;
+  return object;
+}
+}  // namespace
+
+TEST(TestCovarianceMarker, PositionEllipses)
+{
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  objects.objects.push_back(make_object(10.0, 0.0, 4.0, 0.0, 1.0));
+  // the eigenvalues are 4 and 1, the major axis at 45 degrees
+  objects.objects.push_back(make_object(0.0, 10.0, 2.5, 1.5, 2.5));
+
+  autoware_utils_visualization::CovarianceMarkerConverter converter(8);
+  visualization_msgs::msg::Marker marker;
+  converter.append_position_ellipses(objects, 2.0, marker);
+  ASSERT_EQ(marker.points.size(), 2u * 2u * 8u);
+
+  // the 2-sigma ellipse of the first object, closed by its last segment
+  EXPECT_NEAR(marker.points[0].x, 14.0, epsilon);
+  EXPECT_NEAR(marker.points[0].y, 0.0, epsilon);
+  EXPECT_DOUBLE_EQ(marker.points[0].z, 1.0);
+  EXPECT_NEAR(marker.points[4].x, 10.0, epsilon);
+  EXPECT_NEAR(marker.points[4].y, 2.0, epsilon);
+  EXPECT_DOUBLE_EQ(marker.points[15].x, marker.points[0].x);
+  EXPECT_DOUBLE_EQ(marker.points[1].x, marker.points[2].x);
+
+  const auto & rotated = marker.points[16];
+  EXPECT_NEAR(rotated.x, 4.0 / std::sqrt(2.0), epsilon);
+  EXPECT_NEAR(rotated.y, 10.0 + 4.0 / std::sqrt(2.0), epsilon);
+
+  // the points of the next objects are appended
+  autoware_perception_msgs::msg::PredictedObjects predicted;
+  predicted.objects.resize(1);
+  predicted.objects[0].kinematics.initial_pose_with_covariance =
+    objects.objects[0].kinematics.pose_with_covariance;
+  converter.append_position_ellipses(predicted, 2.0, marker);
+  ASSERT_EQ(marker.points.size(), 3u * 2u * 8u);
+  EXPECT_NEAR(marker.points[32].x, 14.0, epsilon);
+}
+
+TEST(TestCovarianceMarker, YawUncertainties)
+{
+  autoware_perception_msgs::msg::TrackedObjects objects;
+  objects.objects.resize(1);
+  auto & pose_with_covariance = objects.objects[0].kinematics.pose_with_covariance;
+  pose_with_covariance.pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(0.0);
+  pose_with_covariance.covariance[XYZRPY_COV_IDX::YAW_YAW] = 0.01;
+
+  autoware_utils_visualization::CovarianceMarkerConverter converter;
+  visualization_msgs::msg::Marker marker;
+  converter.append_yaw_uncertainties(objects, 3.0, 2.0, marker);
+  ASSERT_EQ(marker.points.size(), 4u);
+  EXPECT_DOUBLE_EQ(marker.points[0].x, 0.0);
+  EXPECT_NEAR(marker.points[1].x, 2.0 * std::cos(0.3), epsilon);
+  EXPECT_NEAR(marker.points[1].y, -2.0 * std::sin(0.3), epsilon);
+  EXPECT_NEAR(marker.points[3].y, 2.0 * std::sin(0.3), epsilon);
+}
+
+TEST(TestCovarianceMarker, InvalidSegments)
+{
+  EXPECT_THROW(autoware_utils_visualization::CovarianceMarkerConverter(2), std::invalid_argument);
+}
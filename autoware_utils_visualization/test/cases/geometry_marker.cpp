@@ -0,0 +1,98 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_visualization/geometry_marker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+autoware_utils_geometry::alt::PointList2d make_square()
+{
+  return {{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}, {0.0, 0.0}};
+}
+}  // namespace
+
+TEST(TestGeometryMarker, Lines)
+{
+  visualization_msgs::msg::Marker strip;
+  autoware_utils_visualization::append_line_strip(make_square(), 2.0, strip);
+  ASSERT_EQ(strip.points.size(), 5u);
+  EXPECT_DOUBLE_EQ(strip.points[1].y, 1.0);
+  EXPECT_DOUBLE_EQ(strip.points[1].z, 2.0);
+
+  visualization_msgs::msg::Marker list;
+  autoware_utils_geometry::Polygon2d polygon;
+  polygon.outer() = {{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {0.0, 0.0}};
+  autoware_utils_visualization::append_polygon_lines(polygon, 0.0, list);
+  ASSERT_EQ(list.points.size(), 6u);
+  EXPECT_DOUBLE_EQ(list.points[1].y, 1.0);
+  EXPECT_DOUBLE_EQ(list.points[2].y, 1.0);
+  EXPECT_DOUBLE_EQ(list.points[5].x, 0.0);
+}
+
+TEST(TestGeometryMarker, Path)
+{
+  std::vector<geometry_msgs::msg::Pose> path(5);
+  for (size_t i = 0; i < path.size(); ++i) {
+    path[i].position.x = static_cast<double>(i);
+    path[i].position.z = 3.0;
+  }
+  path[2].position.y = 0.05;
+
+  visualization_msgs::msg::Marker marker;
+  autoware_utils_visualization::append_path(path, marker);
+  ASSERT_EQ(marker.points.size(), 5u);
+  EXPECT_DOUBLE_EQ(marker.points[4].x, 4.0);
+
+  // the points close to the simplified segments are removed
+  autoware_utils_visualization::GeometryMarkerConverter converter;
+  marker.points.clear();
+  converter.append_simplified_path(path, 0.1, marker);
+  ASSERT_EQ(marker.points.size(), 2u);
+  EXPECT_DOUBLE_EQ(marker.points[1].x, 4.0);
+  EXPECT_DOUBLE_EQ(marker.points[1].z, 3.0);
+
+  marker.points.clear();
+  converter.append_simplified_path(path, 0.03, marker);
+  ASSERT_EQ(marker.points.size(), 3u);
+  EXPECT_DOUBLE_EQ(marker.points[1].y, 0.05);
+
+  marker.points.clear();
+  converter.append_simplified_line_strip({{0.0, 0.0}, {1.0, 0.01}, {2.0, 0.0}}, 0.0, 0.1, marker);
+  EXPECT_EQ(marker.points.size(), 2u);
+}
+
+TEST(TestGeometryMarker, Triangles)
+{
+  const auto polygon = autoware_utils_geometry::alt::Polygon2d::create(make_square(), {});
+  ASSERT_TRUE(polygon);
+
+  autoware_utils_visualization::GeometryMarkerConverter converter;
+  visualization_msgs::msg::Marker marker;
+  converter.append_triangle_list(*polygon, 1.0, marker);
+  ASSERT_EQ(marker.points.size(), 6u);
+  double area = 0.0;
+  for (size_t i = 0; i < marker.points.size(); i += 3) {
+    const auto & a = marker.points[i];
+    const auto & b = marker.points[i + 1];
+    const auto & c = marker.points[i + 2];
+    area += std::abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2.0;
+    EXPECT_DOUBLE_EQ(a.z, 1.0);
+  }
+  EXPECT_DOUBLE_EQ(area, 1.0);
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_visualization/marker_array_builder.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestMarkerArrayBuilder, Diff)
+{
+  using visualization_msgs::msg::Marker;
+  autoware_utils_visualization::MarkerArrayBuilder builder("map");
+
+  // the first cycle emits all the markers, with ids per namespace
+  builder.begin(rclcpp::Time(1, 0));
+  builder.add("a").pose.position.x = 1.0;
+  builder.add("a").pose.position.x = 2.0;
+  builder.add("b").points.resize(3);
+  EXPECT_EQ(builder.size(), 3u);
+  const auto & first = builder.build();
+  ASSERT_EQ(first.markers.size(), 3u);
+  EXPECT_EQ(first.markers[0].header.frame_id, "map");
+  EXPECT_EQ(first.markers[0].header.stamp.sec, 1);
+  EXPECT_EQ(first.markers[0].ns, "a");
+  EXPECT_EQ(first.markers[1].id, 1);
+  EXPECT_EQ(first.markers[2].ns, "b");
+  EXPECT_EQ(first.markers[2].id, 0);
+  EXPECT_EQ(first.markers[2].action, Marker::ADD);
+
+  // the same markers are not emitted again
+  builder.begin(rclcpp::Time(2, 0));
+  builder.add("a").pose.position.x = 1.0;
+  builder.add("a").pose.position.x = 2.0;
+  builder.add("b").points.resize(3);
+  EXPECT_TRUE(builder.build().markers.empty());
+
+  // the changed markers are emitted, and the missing ones deleted
+  builder.begin(rclcpp::Time(3, 0));
+  builder.add("a").pose.position.x = 1.0;
+  builder.add("b").points.resize(2);
+  const auto & third = builder.build();
+  ASSERT_EQ(third.markers.size(), 2u);
+  EXPECT_EQ(third.markers[0].ns, "a");
+  EXPECT_EQ(third.markers[0].id, 1);
+  EXPECT_EQ(third.markers[0].action, Marker::DELETE);
+  EXPECT_EQ(third.markers[1].ns, "b");
+  EXPECT_EQ(third.markers[1].points.size(), 2u);
+  EXPECT_EQ(third.markers[1].header.stamp.sec, 3);
+
+  // all the markers are emitted after an invalidation
+  builder.invalidate();
+  builder.begin(rclcpp::Time(4, 0));
+  builder.add("a").pose.position.x = 1.0;
+  builder.add("b").points.resize(2);
+  EXPECT_EQ(builder.build().markers.size(), 2u);
+  builder.begin(rclcpp::Time(5, 0));
+  EXPECT_EQ(builder.build().markers.size(), 2u);
+  EXPECT_TRUE(builder.build().markers.empty());
+}
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
+
 TEST(TestMarkerHelper, CreatePosition)
 {
   const auto r = autoware_utils_visualization::create_marker_position(0.1, 0.2, 0.3);
@@ -116,3 +118,30 @@ TEST(TestMarkerHelper, CreateAppendMarkerArray)
   EXPECT_EQ(array1.markers[3].id, 21);
   EXPECT_EQ(array1.markers[4].id, 22);
 }
+
+TEST(TestMarkerHelper, MoveAppendMarkerArray)
+{
+  visualization_msgs::msg::MarkerArray array1;
+  visualization_msgs::msg::MarkerArray array2;
+  array1.markers.resize(1);
+  array1.markers[0].id = 10;
+  array2.markers.resize(2);
+  array2.markers[0].id = 20;
+  array2.markers[1].id = 21;
+  array2.markers[1].points.resize(1000);
+  const auto * points = array2.markers[1].points.data();
+
+  const auto stamp = rclcpp::Time(12345, 67890);
+  autoware_utils_visualization::append_marker_array(std::move(array2), &array1, stamp);
+  ASSERT_EQ(array1.markers.size(), 3u);
+  EXPECT_EQ(array1.markers[1].id, 20);
+  EXPECT_EQ(array1.markers[2].id, 21);
+  EXPECT_EQ(array1.markers[2].header.stamp.sec, 12345);
+  EXPECT_EQ(array1.markers[0].header.stamp.sec, 0);
+  // the points are moved, not copied
+  EXPECT_EQ(array1.markers[2].points.data(), points);
+
+  visualization_msgs::msg::MarkerArray empty;
+  autoware_utils_visualization::append_marker_array(std::move(array1), &empty);
+  EXPECT_EQ(empty.markers.size(), 3u);
+}
@@ -0,0 +1,106 @@
+// Copyright 2026 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_utils_visualization/marker_publisher.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace
+{
+template <typename Condition>
+bool wait_for(const Condition & condition)
+{
+  for (int i = 0; i < 500 && !condition(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return condition();
+}
+}  // namespace
+
+TEST(TestMarkerPublisher, Subscribers)
+{
+  using visualization_msgs::msg::MarkerArray;
+  const auto node = std::make_shared<rclcpp::Node>("marker_publisher_subscribers");
+  autoware_utils_visualization::MarkerPublisher publisher(node.get(), "~/markers");
+
+  // the markers are not built without subscribers
+  int builds = 0;
+  const auto build = [&builds](MarkerArray & array) {
+    ++builds;
+    array.markers.emplace_back();
+  };
+  EXPECT_FALSE(publisher.has_subscribers());
+  EXPECT_FALSE(publisher.publish(build));
+  EXPECT_EQ(builds, 0);
+
+  const auto subscription = node->create_subscription<MarkerArray>(
+    "~/markers", rclcpp::QoS(1), [](const MarkerArray::ConstSharedPtr) {});
+  ASSERT_TRUE(wait_for([&publisher] { return publisher.has_subscribers(); }));
+  EXPECT_TRUE(publisher.publish(build));
+  EXPECT_TRUE(publisher.publish(build));
+  EXPECT_EQ(builds, 2);
+}
+
+TEST(TestMarkerPublisher, Rate)
+{
+  using visualization_msgs::msg::MarkerArray;
+  const auto node = std::make_shared<rclcpp::Node>("marker_publisher_rate");
+  autoware_utils_visualization::MarkerPublisher publisher(node.get(), "~/markers", 1e-3);
+  const auto subscription = node->create_subscription<MarkerArray>(
+    "~/markers", rclcpp::QoS(1), [](const MarkerArray::ConstSharedPtr) {});
+  ASSERT_TRUE(wait_for([&publisher] { return publisher.has_subscribers(); }));
+
+  // the second array is within the period of the rate
+  const auto build = [](MarkerArray &) {};
+  EXPECT_TRUE(publisher.publish(build));
+  EXPECT_FALSE(publisher.is_due());
+  EXPECT_FALSE(publisher.publish(build));
+
+  EXPECT_THROW(
+    autoware_utils_visualization::MarkerPublisher(node.get(), "~/invalid", -1.0),
+    std::invalid_argument);
+}
+
+TEST(TestMarkerPublisher, Builder)
+{
+  using visualization_msgs::msg::MarkerArray;
+  const auto node = std::make_shared<rclcpp::Node>("marker_publisher_builder");
+  autoware_utils_visualization::MarkerPublisher publisher(node.get(), "~/markers");
+  autoware_utils_visualization::MarkerArrayBuilder builder("map");
+
+  size_t received = 0;
+  const auto subscription = node->create_subscription<MarkerArray>(
+    "~/markers", rclcpp::QoS(10),
+    [&received](const MarkerArray::ConstSharedPtr msg) { received += msg->markers.size(); });
+  ASSERT_TRUE(wait_for([&publisher] { return publisher.has_subscribers(); }));
+
+  // the unchanged markers are not published again
+  const auto fill = [](autoware_utils_visualization::MarkerArrayBuilder & markers) {
+    markers.add("points").pose.position.x = 1.0;
+  };
+  EXPECT_TRUE(publisher.publish(builder, fill));
+  EXPECT_TRUE(publisher.publish(builder, fill));
+  ASSERT_TRUE(wait_for([&node, &received] {
+    rclcpp::spin_some(node);
+    return received == 1;
+  }));
+  rclcpp::spin_some(node);
+  EXPECT_EQ(received, 1u);
+}